@@ -54,6 +54,7 @@ Fl_Menu_Item BreakpointWindow::MenuItems[] =
 				{ "&Registers",		FL_CTRL + '4',	SimulatorWindow::RegistersCB },
 				{ "Pipe&lines",		FL_CTRL + '5',	SimulatorWindow::PipelinesCB },
 				{ "&Programs",		FL_CTRL + '6',	SimulatorWindow::ProgramsCB },
+				{ "S&tatistics",	FL_CTRL + '7',	SimulatorWindow::StatsCB },
 				{ 0 },
 
 			{ "&Edit && Continue", 0, 0, 0, FL_SUBMENU },
@@ -387,7 +388,7 @@ bool BreakpointWindow::Refresh()
 		{
 			ostrstream strBreakpoints;
 			if(InstrIter->second.second.first)
-				strBreakpoints << " " << InputList[InstrIter->second.second.second].c_str() << "(" << InstrIter->second.second.third << "):\t";
+				strBreakpoints << " " << TheContext.InputList[InstrIter->second.second.second].c_str() << "(" << InstrIter->second.second.third << "):\t";
 			strBreakpoints << (const char *)*InstrIter->second.first;
 			if(InstrIter->second.third == GotoEvent)
 				strBreakpoints << " GOTO";
@@ -400,8 +401,10 @@ bool BreakpointWindow::Refresh()
 		{
 			ostrstream strBreakpoints;
 			if(DataIter->second.third.first)
-				strBreakpoints << InputList[DataIter->second.third.second].c_str() << "(" << DataIter->second.third.third << "):\t";
-			strBreakpoints << (const char *)*DataIter->second.first << (const char *)*DataIter->second.fourth << ends;
+				strBreakpoints << TheContext.InputList[DataIter->second.third.second].c_str() << "(" << DataIter->second.third.third << "):\t";
+			string sEvents;
+			DataIter->second.fourth->Print(sEvents);
+			strBreakpoints << (const char *)*DataIter->second.first << sEvents.c_str() << ends;
 			pDataBreakpoints->add(strBreakpoints.str());
 		}
 
@@ -418,7 +421,9 @@ bool BreakpointWindow::Refresh()
 				#else
 					#error "Only MSVC and GCC Compilers Supported"
 				#endif
-				strBreakpoints << MemIter->first.c_str() << sBuff << (const char *)*MemAddrIter->second.second << ends;
+				string sEvents;
+				MemAddrIter->second.second->Print(sEvents);
+				strBreakpoints << MemIter->first.c_str() << sBuff << sEvents.c_str() << ends;
 				pMemBreakpoints->add(strBreakpoints.str());
 			}
 		}
@@ -429,7 +434,9 @@ bool BreakpointWindow::Refresh()
 			for(ArchSim<LC3ISA>::RegisterMap::iterator RegIter = RegSetIter->second.begin(); RegIter != RegSetIter->second.end(); RegIter++)
 			{
 				ostrstream strBreakpoints;
-				strBreakpoints << RegSetIter->first.c_str() << "." << RegIter->first.c_str() << (const char *)*RegIter->second << ends;
+				string sEvents;
+				RegIter->second->Print(sEvents);
+				strBreakpoints << RegSetIter->first.c_str() << "." << RegIter->first.c_str() << sEvents.c_str() << ends;
 				pRegBreakpoints->add(strBreakpoints.str());
 			}
 		}
@@ -442,7 +449,7 @@ bool BreakpointWindow::Refresh()
 		{
 			ostrstream strBreakpoints;
 			if(InstrIter->second.second.first)
-				strBreakpoints << " " << InputList[InstrIter->second.second.second].c_str() << "(" << InstrIter->second.second.third << "):\t";
+				strBreakpoints << " " << TheContext.InputList[InstrIter->second.second.second].c_str() << "(" << InstrIter->second.second.third << "):\t";
 			strBreakpoints << (const char *)*InstrIter->second.first;
 			if(InstrIter->second.third == GotoEvent)
 				strBreakpoints << " GOTO";
@@ -455,8 +462,10 @@ bool BreakpointWindow::Refresh()
 		{
 			ostrstream strBreakpoints;
 			if(DataIter->second.third.first)
-				strBreakpoints << InputList[DataIter->second.third.second].c_str() << "(" << DataIter->second.third.third << "):\t";
-			strBreakpoints << (const char *)*DataIter->second.first << (const char *)*DataIter->second.fourth << ends;
+				strBreakpoints << TheContext.InputList[DataIter->second.third.second].c_str() << "(" << DataIter->second.third.third << "):\t";
+			string sEvents;
+			DataIter->second.fourth->Print(sEvents);
+			strBreakpoints << (const char *)*DataIter->second.first << sEvents.c_str() << ends;
 			pDataBreakpoints->add(strBreakpoints.str());
 		}
 
@@ -473,7 +482,9 @@ bool BreakpointWindow::Refresh()
 				#else
 					#error "Only MSVC and GCC Compilers Supported"
 				#endif
-				strBreakpoints << MemIter->first.c_str() << sBuff << (const char *)*MemAddrIter->second.second << ends;
+				string sEvents;
+				MemAddrIter->second.second->Print(sEvents);
+				strBreakpoints << MemIter->first.c_str() << sBuff << sEvents.c_str() << ends;
 				pMemBreakpoints->add(strBreakpoints.str());
 			}
 		}
@@ -484,7 +495,9 @@ bool BreakpointWindow::Refresh()
 			for(ArchSim<LC3bISA>::RegisterMap::iterator RegIter = RegSetIter->second.begin(); RegIter != RegSetIter->second.end(); RegIter++)
 			{
 				ostrstream strBreakpoints;
-				strBreakpoints << RegSetIter->first.c_str() << "." << RegIter->first.c_str() << (const char *)*RegIter->second << ends;
+				string sEvents;
+				RegIter->second->Print(sEvents);
+				strBreakpoints << RegSetIter->first.c_str() << "." << RegIter->first.c_str() << sEvents.c_str() << ends;
 				pRegBreakpoints->add(strBreakpoints.str());
 			}
 		}
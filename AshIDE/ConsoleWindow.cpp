@@ -56,6 +56,7 @@ Fl_Menu_Item ConsoleWindow::MenuItems[] =
 				{ "&Registers",		FL_CTRL + '4',	SimulatorWindow::RegistersCB },
 				{ "Pipe&lines",		FL_CTRL + '5',	SimulatorWindow::PipelinesCB },
 				{ "&Programs",		FL_CTRL + '6',	SimulatorWindow::ProgramsCB },
+				{ "S&tatistics",	FL_CTRL + '7',	SimulatorWindow::StatsCB },
 				{ 0 },
 
 			{ "&Edit && Continue", 0, 0, 0, FL_SUBMENU },
@@ -128,7 +128,7 @@ bool MessageWindow::Message(MessageEnum MessageType, const string &sMessage, con
 				continue;
 			else
 				LastLocation.clear();
-			FileNameLine(InputList[LocationStack[i].first], LocationStack[i].second);
+			FileNameLine(TheContext.InputList[LocationStack[i].first], LocationStack[i].second);
 			PlainText("    ");
 			MessageID(Info);
 			PlainText("From included file:\n");
@@ -141,7 +141,7 @@ bool MessageWindow::Message(MessageEnum MessageType, const string &sMessage, con
 	case Info:
 		if(!LocationStack.empty())
 		{
-			FileNameLine(InputList[LocationStack[i].first], LocationStack[i].second);
+			FileNameLine(TheContext.InputList[LocationStack[i].first], LocationStack[i].second);
 			MessageID(Info);
 		}
 		break;
@@ -149,20 +149,20 @@ bool MessageWindow::Message(MessageEnum MessageType, const string &sMessage, con
 		TheProject.Warnings++;
 		if(LocationStack.empty())
 			throw "Empty location stack for Warning!";
-		FileNameLine(InputList[LocationStack[i].first], LocationStack[i].second);
+		FileNameLine(TheContext.InputList[LocationStack[i].first], LocationStack[i].second);
 		MessageID(Warning);
 		break;
 	case Error:
 		TheProject.Errors++;
 		if(LocationStack.empty())
 			throw "Empty location stack for Error!";
-		FileNameLine(InputList[LocationStack[i].first], LocationStack[i].second);
+		FileNameLine(TheContext.InputList[LocationStack[i].first], LocationStack[i].second);
 		MessageID(Error);
 		break;
 	case Fatal:
 		TheProject.Errors++;
 		if(!LocationStack.empty())
-			FileNameLine(InputList[LocationStack[i].first], LocationStack[i].second);
+			FileNameLine(TheContext.InputList[LocationStack[i].first], LocationStack[i].second);
 		MessageID(Fatal);
 		break;
 	}
@@ -197,7 +197,7 @@ Project::Project(const string &sWD) : sFileName("")
 	fSettings[UseOS] = DefaultLang == Assembler::LangLC3b ? false : true;
 	fSettings[OldLC3] = DefaultLang == Assembler::LangLC3b ? false : true;
 	//Always update the global flag so that a file opened before an assembly will get highlighted (ISA::Lexer uses this flag)
-	Flags.fOldLC3 = fSettings[OldLC3];
+	TheContext.Flags.fOldLC3 = fSettings[OldLC3];
 
 	for(i = 0; i < NUM_SOURCE_TYPES; i++)
 		fExpanded[i] = true;
@@ -256,8 +256,8 @@ bool Project::LoadSettings(const string &sFN)
 	list<Token *> TokenList;
 	list<Token *>::iterator TokenIter;
 	ProjectLexer TheLexer(TokenList, MainWindow::MessageCallBack, false);
-	InputList.clear();
-	InputList.push_back(sFileName.Name);
+	TheContext.InputList.clear();
+	TheContext.InputList.push_back(sFileName.Name);
 	LocationVector LocationStack;
 	LocationStack.push_back( LocationVector::value_type(0, 1) );
 
@@ -499,7 +499,7 @@ bool Project::SetSetting(SettingEnum Setting, bool fState)
 	}
 	if(Setting == OldLC3)
 		//Always update the global flag so that a file opened before an assembly will get highlighted (ISA::Lexer uses this flag)
-		Flags.fOldLC3 = fState;
+		TheContext.Flags.fOldLC3 = fState;
 	if(fSettings[Setting] != fState)
 		fRebuild = fChanged = true;
 	return fSettings[Setting] = fState;
@@ -764,7 +764,7 @@ bool Project::AssembleFile(FileData *pFileData)
 	else if(pFileData->GetLanguage() == LangLC3b)
 		fRetVal = AssembleLC3b(pFileData);
 
-	FileName sOutputFileName(InputList[pFileData->ProgramNumber]);
+	FileName sOutputFileName(TheContext.InputList[pFileData->ProgramNumber]);
 
 	MainWindow::MessageCallBack(Info, "", LocationVector());
 	sprintf(sMessageBuffer, "%.255s:   %u Error%.1s, %u Warning%.1s", (sOutputFileName.Path+sOutputFileName.Bare).c_str(), Errors, (Errors != 1 ? "s" : ""), Warnings, (Warnings != 1 ? "s" : ""));
@@ -1004,25 +1004,19 @@ bool Project::Simulate()
 	if(!Build())
 		return false;
 
-	//Reset the simulator IDs.
-	//Simulator IDs allowed multiple simulators to work with the same Ctrl-C breakpoints in console-mode
-	//They aren't necessary for the GUI version, nor with any software currently written.
-	ArchSim<LC3ISA>::NextSimID = 1;
-	ArchSim<LC3bISA>::NextSimID = 1;
-
 	//Decide which ISA to simulate
 	if(Programs[LangLC3].size() && !Programs[LangLC3b].size())
 	{
 		pLC3Sim = new ArchSim<LC3ISA>(MainWindow::SimMessageCallBack, MainWindow::SimCallBack, MainWindow::SimCommand, MainWindow::SimReadConsole, MainWindow::SimWriteConsole);
 		pLC3Arch = new LC3Arch(*pLC3Sim);
-		InputList = InputLists[LangLC3];
+		TheContext.InputList = InputLists[LangLC3];
 		SimISA = LangLC3;
 	}
 	else if(!Programs[LangLC3].size() && Programs[LangLC3b].size())
 	{
 		pLC3bSim = new ArchSim<LC3bISA>(MainWindow::SimMessageCallBack, MainWindow::SimCallBack, MainWindow::SimCommand, MainWindow::SimReadConsole, MainWindow::SimWriteConsole);
 		pLC3bArch = new LC3bArch(*pLC3bSim);
-		InputList = InputLists[LangLC3b];
+		TheContext.InputList = InputLists[LangLC3b];
 		SimISA = LangLC3b;
 	}
 	else if(Programs[LangLC3].size() && Programs[LangLC3b].size())
@@ -1035,13 +1029,13 @@ bool Project::Simulate()
 		case 0:
 			pLC3Sim = new ArchSim<LC3ISA>(MainWindow::SimMessageCallBack, MainWindow::SimCallBack, MainWindow::SimCommand, MainWindow::SimReadConsole, MainWindow::SimWriteConsole);
 			pLC3Arch = new LC3Arch(*pLC3Sim);
-			InputList = InputLists[LangLC3];
+			TheContext.InputList = InputLists[LangLC3];
 			SimISA = LangLC3;
 			break;
 		case 1:
 			pLC3bSim = new ArchSim<LC3bISA>(MainWindow::SimMessageCallBack, MainWindow::SimCallBack, MainWindow::SimCommand, MainWindow::SimReadConsole, MainWindow::SimWriteConsole);
 			pLC3bArch = new LC3bArch(*pLC3bSim);
-			InputList = InputLists[LangLC3b];
+			TheContext.InputList = InputLists[LangLC3b];
 			SimISA = LangLC3b;
 			break;
 		case 2:
@@ -1087,8 +1081,8 @@ bool Project::Simulate()
 
 	while(fSimulating && !TheSim(fDone))
 	{
-		//Alternate between executing a simulator cycle and checking for user input
-		TheSim(Run());
+		//Alternate between executing a batch of simulator cycles and checking for user input
+		TheSim(RunBatch(RUN_BATCH_CYCLES));
 		TheSimulatorWindow.Update();
 		if(TheSim(fBreak))
 			Fl::wait();
@@ -1189,14 +1183,14 @@ bool Project::ResetAssembler()
 	}
 
 	JMT::sWorkingDir = sWorkingDir;
-	Flags.fPrintTokens = fSettings[PrintTokens];
-	Flags.fPrintAST = fSettings[PrintAST];
-	Flags.fPrintSymbols = fSettings[PrintSymbols];
-	Flags.fOutputImage = fSettings[OutputImage];
-	Flags.fOutputVHDL = fSettings[OutputVHDL];
-	Flags.fUseOptimizations = fSettings[UseOptimizations];
-	Flags.fUseOS = fSettings[UseOS];
-	Flags.fOldLC3 = fSettings[OldLC3];
+	TheContext.Flags.fPrintTokens = fSettings[PrintTokens];
+	TheContext.Flags.fPrintAST = fSettings[PrintAST];
+	TheContext.Flags.fPrintSymbols = fSettings[PrintSymbols];
+	TheContext.Flags.fOutputImage = fSettings[OutputImage];
+	TheContext.Flags.fOutputVHDL = fSettings[OutputVHDL];
+	TheContext.Flags.fUseOptimizations = fSettings[UseOptimizations];
+	TheContext.Flags.fUseOS = fSettings[UseOS];
+	TheContext.Flags.fOldLC3 = fSettings[OldLC3];
 	fRebuild = false;
 	return true;
 }
@@ -1206,7 +1200,7 @@ bool Project::IsSimulating(const string &sFileName) const
 	if(fSimulating)
 	{
 		string sRelativeFileName = CreateRelativeFileName(sWorkingDir, sFileName);
-		for(vector<string>::iterator FileIter = InputList.begin(); FileIter != InputList.end(); FileIter++)
+		for(vector<string>::iterator FileIter = TheContext.InputList.begin(); FileIter != TheContext.InputList.end(); FileIter++)
 			if(*FileIter == sRelativeFileName)
 				return true;
 	}
@@ -1223,12 +1217,12 @@ bool Project::AssembleLC3(FileData *pFileData)
 	}
 
 	//*** Initialize program ***
-	InputList = InputLists[LangLC3];
+	TheContext.InputList = InputLists[LangLC3];
 	LocationVector LocationStack;
 	LocationStack.push_back( LocationVector::value_type(pFileData->ProgramNumber, 0) );
 	if(pFileData->pProgram)
 		delete pFileData->pProgram;
-	pFileData->pProgram = new Program(LocationStack, InputList[pFileData->ProgramNumber], LC3ISA::Addressability);
+	pFileData->pProgram = new Program(LocationStack, TheContext.InputList[pFileData->ProgramNumber], LC3ISA::Addressability);
 
 	//*** Perform Compilation ***
 	//Lex, parse, and optimize each input asm file
@@ -1339,9 +1333,9 @@ bool Project::AssembleLC3(FileData *pFileData)
 	}
 
 	//*** Add new dependencies ***
-	for(unsigned int i = InputLists[LangLC3].size(); i < InputList.size(); i++)
+	for(unsigned int i = InputLists[LangLC3].size(); i < TheContext.InputList.size(); i++)
 	{
-		string sFileName = CreateFileNameRelative(sWorkingDir, InputList[i]);
+		string sFileName = CreateFileNameRelative(sWorkingDir, TheContext.InputList[i]);
 		FileData *pFD = GetFile(sFileName);
 		if(pFD)
 		{	//File is already in the project
@@ -1358,7 +1352,7 @@ bool Project::AssembleLC3(FileData *pFileData)
 			if(pFW)
 				pFW->AddToProject(true);
 		}
-		InputLists[LangLC3].push_back(InputList[i]);
+		InputLists[LangLC3].push_back(TheContext.InputList[i]);
 	}
 
 	if(!fRetVal)
@@ -1387,12 +1381,12 @@ bool Project::AssembleLC3b(FileData *pFileData)
 	}
 
 	//*** Initialize program ***
-	InputList = InputLists[LangLC3b];
+	TheContext.InputList = InputLists[LangLC3b];
 	LocationVector LocationStack;
 	LocationStack.push_back( LocationVector::value_type(pFileData->ProgramNumber, 0) );
 	if(pFileData->pProgram)
 		delete pFileData->pProgram;
-	pFileData->pProgram = new Program(LocationStack, InputList[pFileData->ProgramNumber], LC3bISA::Addressability);
+	pFileData->pProgram = new Program(LocationStack, TheContext.InputList[pFileData->ProgramNumber], LC3bISA::Addressability);
 
 	//*** Perform Compilation ***
 	//Lex, parse, and optimize each input asm file
@@ -1456,9 +1450,9 @@ bool Project::AssembleLC3b(FileData *pFileData)
 	}
 
 	//*** Add new dependencies ***
-	for(unsigned int i = InputLists[LangLC3b].size(); i < InputList.size(); i++)
+	for(unsigned int i = InputLists[LangLC3b].size(); i < TheContext.InputList.size(); i++)
 	{
-		string sFileName = CreateFileNameRelative(sWorkingDir, InputList[i]);
+		string sFileName = CreateFileNameRelative(sWorkingDir, TheContext.InputList[i]);
 		FileData *pFD = GetFile(sFileName);
 		if(pFD)
 		{	//File is already in the project
@@ -1475,7 +1469,7 @@ bool Project::AssembleLC3b(FileData *pFileData)
 			if(pFW)
 				pFW->AddToProject(true);
 		}
-		InputLists[LangLC3b].push_back(InputList[i]);
+		InputLists[LangLC3b].push_back(TheContext.InputList[i]);
 	}
 
 	if(!fRetVal)
@@ -1497,10 +1491,10 @@ bool Project::AssembleLC3b(FileData *pFileData)
 bool Project::BuildLC3()
 {
 	//Initialize the build
-	InputList = InputLists[LangLC3];
+	TheContext.InputList = InputLists[LangLC3];
 	Programs[LangLC3].clear();
 	vector<string>::iterator InputIter;
-	for(InputIter = InputList.begin(); InputIter != InputList.end(); InputIter++)
+	for(InputIter = TheContext.InputList.begin(); InputIter != TheContext.InputList.end(); InputIter++)
 	{
 		FileData *pFileData = GetFile(CreateFileNameRelative(sWorkingDir, *InputIter));
 		if(!pFileData->IsBuild())
@@ -1509,7 +1503,7 @@ bool Project::BuildLC3()
 	}
 	if(pMemoryImages[LangLC3])
 		delete pMemoryImages[LangLC3];
-	pMemoryImages[LangLC3] = new RamVector;
+	pMemoryImages[LangLC3] = new RamImage;
 
 
 	//Convert the symbolic assembly program into a memory image
@@ -1540,7 +1534,7 @@ bool Project::BuildLC3()
 	}
 
 	//*** Add new resources ***
-	for(InputIter = InputList.begin(); InputIter != InputList.end(); InputIter++)
+	for(InputIter = TheContext.InputList.begin(); InputIter != TheContext.InputList.end(); InputIter++)
 	{
 		FileData *pFileData = GetFile(CreateFileNameRelative(sWorkingDir, *InputIter));
 		if(!pFileData->IsBuild())
@@ -1591,10 +1585,10 @@ bool Project::BuildLC3()
 bool Project::BuildLC3b()
 {
 	//Initialize the build
-	InputList = InputLists[LangLC3b];
+	TheContext.InputList = InputLists[LangLC3b];
 	Programs[LangLC3b].clear();
 	vector<string>::iterator InputIter;
-	for(InputIter = InputList.begin(); InputIter != InputList.end(); InputIter++)
+	for(InputIter = TheContext.InputList.begin(); InputIter != TheContext.InputList.end(); InputIter++)
 	{
 		FileData *pFileData = GetFile(CreateFileNameRelative(sWorkingDir, *InputIter));
 		if(!pFileData->IsBuild())
@@ -1603,7 +1597,7 @@ bool Project::BuildLC3b()
 	}
 	if(pMemoryImages[LangLC3b])
 		delete pMemoryImages[LangLC3b];
-	pMemoryImages[LangLC3b] = new RamVector;
+	pMemoryImages[LangLC3b] = new RamImage;
 
 	//Convert the symbolic assembly program into a memory image
 	char sMessageBuffer[65 + MAX_FILENAME_CHAR];
@@ -1633,7 +1627,7 @@ bool Project::BuildLC3b()
 	}
 
 	//*** Add new resources ***
-	for(InputIter = InputList.begin(); InputIter != InputList.end(); InputIter++)
+	for(InputIter = TheContext.InputList.begin(); InputIter != TheContext.InputList.end(); InputIter++)
 	{
 		FileData *pFileData = GetFile(CreateFileNameRelative(sWorkingDir, *InputIter));
 		if(!pFileData->IsBuild())
@@ -71,7 +71,7 @@ namespace AshIDE
 		//A list of all the program objects generated for the original sources
 		vector<Program *> Programs[NUM_LANGUAGES];
 		//The resultant memory image from a build
-		RamVector *pMemoryImages[NUM_LANGUAGES];
+		RamImage *pMemoryImages[NUM_LANGUAGES];
 
 		//Simulator data
 		bool fSimulating;	//True if simulation is currently happening
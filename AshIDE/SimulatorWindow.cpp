@@ -29,9 +29,11 @@ Fl_Menu_Item SimulatorWindow::MenuItems[] =
 		{ "&Simulator", 0, 0, 0, FL_SUBMENU },
 			{ "&Update Status Every Cycle",	0,				0, 0, FL_MENU_TOGGLE },
 			{ "Enable &Runtime Checks",		0,				SimulatorWindow::RuntimeChecksCB, 0, FL_MENU_TOGGLE },
-			{ "Enable Execution &Trace",	0,				SimulatorWindow::TraceCB, 0, FL_MENU_TOGGLE | FL_MENU_DIVIDER },
+			{ "Enable Execution &Trace",	0,				SimulatorWindow::TraceCB, 0, FL_MENU_TOGGLE },
+			{ "Enable Re&verse Execution",	0,				SimulatorWindow::ReverseExecutionCB, 0, FL_MENU_TOGGLE | FL_MENU_DIVIDER },
 			{ "&Load State",				0,				SimulatorWindow::LoadStateCB },
 			{ "&Save State",				0,				SimulatorWindow::SaveStateCB },
+			{ "Save &Incremental State",	0,				SimulatorWindow::SaveIncrementalStateCB },
 			{ "Load D&ata",					0,				SimulatorWindow::LoadDataCB },
 			{ "Save &Data",					0,				SimulatorWindow::SaveDataCB },
 			{ "Load Program &Object",		0,				SimulatorWindow::LoadObjectCB },
@@ -51,6 +53,8 @@ Fl_Menu_Item SimulatorWindow::MenuItems[] =
 		{ "S&imulate", 0, 0, 0, FL_SUBMENU },
 			{ "&Go",							FL_F + 5,		SimulatorWindow::GoCB },
 			{ "Go One &Instruction",			FL_F + 6,		SimulatorWindow::GoOneCB, 0, FL_MENU_DIVIDER },
+			{ "Go &Back",						FL_SHIFT + FL_F + 5,	SimulatorWindow::GoBackCB },
+			{ "Step Back One Instru&ction",		FL_SHIFT + FL_F + 6,	SimulatorWindow::StepBackCB, 0, FL_MENU_DIVIDER },
 			{ "Step I&nto Next Function",		FL_F + 8,		SimulatorWindow::StepInCB },
 			{ "Step O&ver Next Function",		FL_F + 9,		SimulatorWindow::StepOverCB },
 			{ "Step &Out Of Current Function",	FL_F + 10,		SimulatorWindow::StepOutCB, 0, FL_MENU_DIVIDER },
@@ -73,6 +77,7 @@ Fl_Menu_Item SimulatorWindow::MenuItems[] =
 				{ "&Registers",		FL_CTRL + '4',	SimulatorWindow::RegistersCB },
 				{ "Pipe&lines",		FL_CTRL + '5',	SimulatorWindow::PipelinesCB },
 				{ "&Programs",		FL_CTRL + '6',	SimulatorWindow::ProgramsCB },
+				{ "S&tatistics",	FL_CTRL + '7',	SimulatorWindow::StatsCB },
 			{ 0 },
 
 		{ "&Edit && Continue", 0, 0, 0, FL_SUBMENU },
@@ -268,6 +273,7 @@ SimulatorWindow::SimulatorWindow() : Fl_Double_Window(480, 300)
 	pDisassemblyWindow = NULL;
 	pCallStackWindow = NULL;
 	pProgramsWindow = NULL;
+	pStatsWindow = NULL;
 	pWriteDataWindow = NULL;
 	pWriteRegisterWindow = NULL;
 	pBreakpointWindow = NULL;
@@ -307,6 +313,8 @@ SimulatorWindow::~SimulatorWindow()
 		delete RegisterIter->second;
 	if(pProgramsWindow)
 		delete pProgramsWindow;
+	if(pStatsWindow)
+		delete pStatsWindow;
 	if(pWriteDataWindow)
 		delete pWriteDataWindow;
 	if(pWriteRegisterWindow)
@@ -396,6 +404,8 @@ bool SimulatorWindow::SetStatus()
 		RegisterIter->second->pStatus->value(sBuffer);
 	if(pProgramsWindow)
 		pProgramsWindow->pStatus->value(sBuffer);
+	if(pStatsWindow)
+		pStatsWindow->pStatus->value(sBuffer);
 	if(pWriteDataWindow)
 		pWriteDataWindow->pStatus->value(sBuffer);
 	if(pWriteRegisterWindow)
@@ -489,7 +499,7 @@ bool SimulatorWindow::Update()
 			if(pElement)
 			{
 				string sFileName;
-				FileName sFile = sFileName = CreateFileNameRelative(TheProject.sWorkingDir, InputList[pElement->LocationStack.rbegin()->first]);
+				FileName sFile = sFileName = CreateFileNameRelative(TheProject.sWorkingDir, TheContext.InputList[pElement->LocationStack.rbegin()->first]);
 				if(ToLower(sFile.Ext) != "obj" && ToLower(sFile.Ext) != "bin")
 				{
 					unsigned int LineNumber = pElement->LocationStack.rbegin()->second;
@@ -522,6 +532,8 @@ bool SimulatorWindow::Update()
 			RegisterIter->second->Enter();
 		if(pProgramsWindow)
 			pProgramsWindow->Enter();
+		if(pStatsWindow)
+			pStatsWindow->Enter();
 		if(pBreakpointWindow)
 			pBreakpointWindow->Refresh();
 		fUpdating = false;
@@ -681,9 +693,31 @@ bool SimulatorWindow::StepOut()
 	return fRetVal;
 }
 
+bool SimulatorWindow::GoBack()
+{
+	bool fRetVal = SIM_COMMAND_UPDATE("goback");
+	if(!fRetVal)
+	{
+		fl_alert("Error with go back command. Reverse execution must be enabled first.");
+		show();
+	}
+	return fRetVal;
+}
+
+bool SimulatorWindow::StepBack()
+{
+	bool fRetVal = SIM_COMMAND_UPDATE("stepback");
+	if(!fRetVal)
+	{
+		fl_alert("Error with step back command. Reverse execution must be enabled first.");
+		show();
+	}
+	return fRetVal;
+}
+
 bool SimulatorWindow::Break()
 {
-	TheSim(fControlC) = -1;
+	TheSim(Pause.Set());
 	return true;
 }
 
@@ -796,6 +830,14 @@ bool SimulatorWindow::RuntimeChecks()
 		return SIM_COMMAND("checkoff");
 }
 
+bool SimulatorWindow::ReverseExecution()
+{
+	if(pMainMenu->menu()[4].value() != 0)
+		return SIM_COMMAND("journalon");
+	else
+		return SIM_COMMAND("journaloff");
+}
+
 bool SimulatorWindow::Trace()
 {
 	if(pMainMenu->menu()[3].value() != 0)
@@ -906,6 +948,24 @@ bool SimulatorWindow::SaveState()
 	return fRetVal;
 }
 
+bool SimulatorWindow::SaveIncrementalState()
+{
+	char *sBuffer;
+	sBuffer = fl_file_chooser("Save Incremental State?", NULL, "");
+	if(sBuffer == NULL)
+		return false;
+
+	string sCommand = string("savesi \"")+sBuffer+"\"";
+	bool fRetVal = SIM_COMMAND(sCommand);
+
+	if(!fRetVal)
+	{
+		fl_alert("Error saving incremental state.");
+		show();
+	}
+	return fRetVal;
+}
+
 bool SimulatorWindow::LoadData()
 {
 	char *Buffer;
@@ -1156,6 +1216,15 @@ bool SimulatorWindow::Programs()
 	return true;
 }
 
+bool SimulatorWindow::Stats()
+{
+	if(!pStatsWindow)
+		pStatsWindow = new StatsWindow();
+	else
+		pStatsWindow->show();
+	return true;
+}
+
 bool SimulatorWindow::ViewInstruction(SimWindowEnum WindowType, Fl_Window *pW)
 {
 	string sFileName;
@@ -1454,7 +1523,7 @@ bool SimulatorWindow::Command(const string &scommand, bool fUpdate)
 	string sCommand = scommand;
 
 	//Check to see if we should run the translator on it
-	if(TheProject.SimISA == LangLC3 && Flags.fOldLC3)
+	if(TheProject.SimISA == LangLC3 && TheContext.Flags.fOldLC3)
 	{
 		string sTemp;
 		AsmConvertLC3Line(sCommand, sTemp, LocationVector(), MainWindow::SimMessageCallBack);
@@ -1514,6 +1583,9 @@ bool SimulatorWindow::SimMessage(MessageEnum MessageType, const string &sMessage
 	case SimProgramsWindow:
 		pTextDisplay = ((ProgramsWindow *)pRedirectWindow)->pTextDisplay;
 		break;
+	case SimStatsWindow:
+		pTextDisplay = ((StatsWindow *)pRedirectWindow)->pTextDisplay;
+		break;
 	}
 
 	switch(MessageType)
@@ -1586,6 +1658,9 @@ bool SimulatorWindow::PlainText(const string &sText)
 	case SimProgramsWindow:
 		pTextDisplay = ((ProgramsWindow *)pRedirectWindow)->pTextDisplay;
 		break;
+	case SimStatsWindow:
+		pTextDisplay = ((StatsWindow *)pRedirectWindow)->pTextDisplay;
+		break;
 	}
 
 	pTextDisplay->pStyleBuffer->append(string(sText.size(), 'A').c_str());
@@ -1616,6 +1691,9 @@ bool SimulatorWindow::MessageID(MessageEnum MessageType)
 	case SimProgramsWindow:
 		pTextDisplay = ((ProgramsWindow *)pRedirectWindow)->pTextDisplay;
 		break;
+	case SimStatsWindow:
+		pTextDisplay = ((StatsWindow *)pRedirectWindow)->pTextDisplay;
+		break;
 	}
 
 	switch(MessageType)
@@ -26,6 +26,7 @@
 #include "MemoryBytesWindow.h"
 #include "RegistersWindow.h"
 #include "ProgramsWindow.h"
+#include "StatsWindow.h"
 #include "WriteDataWindow.h"
 #include "WriteRegisterWindow.h"
 #include "BreakpointWindow.h"
@@ -45,7 +46,7 @@ namespace AshIDE
 	{
 	public:
 		enum SimGoEnum {SimNoGo, SimGo, SimGoOne, SimStepIn, SimStepOver, SimStepOut, SimRunToCursor};
-		enum SimWindowEnum {SimNoWindow, SimFileWindow, SimDisassemblyWindow, SimCallStackWindow, SimInstructionsWindow, SimDataValuesWindow, SimMemoryBytesWindow, SimRegistersWindow, SimProgramsWindow};
+		enum SimWindowEnum {SimNoWindow, SimFileWindow, SimDisassemblyWindow, SimCallStackWindow, SimInstructionsWindow, SimDataValuesWindow, SimMemoryBytesWindow, SimRegistersWindow, SimProgramsWindow, SimStatsWindow};
 		#define TheSimulatorWindow	(*SimulatorWindow::pSimulatorWindow)
 		static SimulatorWindow *pSimulatorWindow;
 
@@ -60,6 +61,7 @@ namespace AshIDE
 		friend class MemoryBytesWindow;
 		friend class RegistersWindow;
 		friend class ProgramsWindow;
+		friend class StatsWindow;
 		friend class WriteDataWindow;
 		friend class WriteRegisterWindow;
 		friend class BreakpointWindow;
@@ -127,6 +129,7 @@ namespace AshIDE
 		typedef map<RegistersWindow *, RegistersWindow *> RegistersMap;
 		RegistersMap Registers;
 		ProgramsWindow *pProgramsWindow;
+		StatsWindow *pStatsWindow;
 		WriteDataWindow *pWriteDataWindow;
 		WriteRegisterWindow *pWriteRegisterWindow;
 		BreakpointWindow *pBreakpointWindow;
@@ -249,6 +252,8 @@ namespace AshIDE
 			StepIn( )
 			StepOver( )
 			StepOut( )
+			GoBack( )
+			StepBack( )
 			Break( )
 			Interrupt( )
 			Reset( )
@@ -282,6 +287,10 @@ namespace AshIDE
 		bool StepOver();
 		static void StepOutCB(Fl_Widget *pW, void *pV);
 		bool StepOut();
+		static void GoBackCB(Fl_Widget *pW, void *pV)	{	pSimulatorWindow->GoBack();	}
+		bool GoBack();
+		static void StepBackCB(Fl_Widget *pW, void *pV)	{	pSimulatorWindow->StepBack();	}
+		bool StepBack();
 		static void BreakCB(Fl_Widget *pW, void *pV)	{	pSimulatorWindow->Break();	}
 		bool Break();
 		static void InterruptCB(Fl_Widget *pW, void *pV)	{	pSimulatorWindow->Interrupt();	}
@@ -302,8 +311,10 @@ namespace AshIDE
 		/**********************************************************************\
 			RuntimeChecks( )
 			Trace( )
+			ReverseExecution( )
 			LoadState( )
 			SaveState( )
+			SaveIncrementalState( )
 			LoadData( )
 			SaveData( )
 
@@ -320,10 +331,14 @@ namespace AshIDE
 		bool RuntimeChecks();
 		static void TraceCB(Fl_Widget *pW, void *pV)	{	pSimulatorWindow->Trace();	}
 		bool Trace();
+		static void ReverseExecutionCB(Fl_Widget *pW, void *pV)	{	pSimulatorWindow->ReverseExecution();	}
+		bool ReverseExecution();
 		static void LoadStateCB(Fl_Widget *pW, void *pV)	{	pSimulatorWindow->LoadState();	}
 		bool LoadState();
 		static void SaveStateCB(Fl_Widget *pW, void *pV)	{	pSimulatorWindow->SaveState();	}
 		bool SaveState();
+		static void SaveIncrementalStateCB(Fl_Widget *pW, void *pV)	{	pSimulatorWindow->SaveIncrementalState();	}
+		bool SaveIncrementalState();
 		static void LoadDataCB(Fl_Widget *pW, void *pV)	{	pSimulatorWindow->LoadData();	}
 		bool LoadData();
 		static void SaveDataCB(Fl_Widget *pW, void *pV)	{	pSimulatorWindow->SaveData();	}
@@ -373,6 +388,8 @@ namespace AshIDE
 		bool Pipelines();
 		static void ProgramsCB(Fl_Widget *pW, void *pV)	{	pSimulatorWindow->Programs();	}
 		bool Programs();
+		static void StatsCB(Fl_Widget *pW, void *pV)	{	pSimulatorWindow->Stats();	}
+		bool Stats();
 		static void ViewInstructionCB(SimWindowEnum WindowType, Fl_Window *pW)	{	pSimulatorWindow->ViewInstruction(WindowType, pW);	}
 		bool ViewInstruction(SimWindowEnum, Fl_Window *);
 		static void ViewDataCB(SimWindowEnum WindowType, Fl_Window *pW)	{	pSimulatorWindow->ViewData(WindowType, pW);	}
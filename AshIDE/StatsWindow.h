@@ -0,0 +1,134 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#ifndef STATSWINDOW_H
+#define STATSWINDOW_H
+
+#pragma warning (disable:4786)
+#include <FL/Fl_Double_Window.H>
+#include <FL/Fl_Menu_Bar.H>
+#include <FL/Fl_Output.H>
+#include <string>
+#include "ReadOnlyEditor.h"
+
+using namespace std;
+
+namespace AshIDE
+{
+	class StatsWindow : public Fl_Double_Window
+	{
+	protected:
+		friend class SimulatorWindow;
+
+		//Widgets for main menu
+		Fl_Menu_Bar *pMainMenu;
+		static Fl_Menu_Item MenuItems[];
+
+		//Widgets for Statistics view
+		ReadOnlyEditor *pTextDisplay;
+
+		//Stuff for syntax highlighting
+		static Fl_Text_Display::Style_Table_Entry StyleTable[];
+
+		//Widgets for the status bar
+		Fl_Output *pStatus;
+
+	public:
+		/**********************************************************************\
+			StatsWindow( )
+
+			Constructs the Statistics window.
+			This window only displays text, there is no editing.
+		\******/
+		StatsWindow();
+
+		/**********************************************************************\
+			~StatsWindow( )
+
+			Destructor
+		\******/
+		virtual ~StatsWindow();
+
+
+
+	//*** Window Management Functions ***//
+		static void HelpCB(Fl_Widget *pW, void *pV);
+
+		/**********************************************************************\
+			Close( )
+
+			Closes the window and removes it from the SimulatorWindow.
+		\******/
+		static void CloseCB(Fl_Widget *pW, void *pV)	{	((StatsWindow *)pV)->Close();	}
+		bool Close();
+
+		/**********************************************************************\
+			SetTitle( )
+
+			Sets the title.
+		\******/
+		bool SetTitle();
+
+
+
+	//*** Statistics Management Functions ***//
+		static void SaveCB(Fl_Widget *pW, void *pV)	{	((StatsWindow *)pV)->pTextDisplay->Save();	}
+		static void CopyCB(Fl_Widget *pW, void *pV)	{	((StatsWindow *)pV)->pTextDisplay->Copy();	}
+		static void FindCB(Fl_Widget *pW, void *pV)	{	((StatsWindow *)pV)->pTextDisplay->Find();	}
+		static void FindAgainCB(Fl_Widget *pW, void *pV)	{	((StatsWindow *)pV)->pTextDisplay->FindAgain();	}
+		static void StartCB(Fl_Widget *pW, void *pV)	{	((StatsWindow *)pV)->Start();	}
+		static void StopCB(Fl_Widget *pW, void *pV)	{	((StatsWindow *)pV)->Stop();	}
+		static void RefreshCB(Fl_Widget *pW, void *pV)	{	((StatsWindow *)pV)->Enter();	}
+		static void SaveCSVCB(Fl_Widget *pW, void *pV)	{	((StatsWindow *)pV)->SaveData("csv");	}
+		static void SaveJSONCB(Fl_Widget *pW, void *pV)	{	((StatsWindow *)pV)->SaveData("json");	}
+
+		/**********************************************************************\
+			Start( )
+			Stop( )
+
+			Clears the statistics and starts counting, or stops counting.
+		\******/
+		bool Start();
+		bool Stop();
+
+		/**********************************************************************\
+			SaveData( [in] format )
+
+			Asks for a file name and saves the statistics in the given
+			machine-readable format.
+		\******/
+		bool SaveData(const string &);
+
+		/**********************************************************************\
+			Enter( )
+
+			Displays the statistics.
+		\******/
+		bool Enter();
+
+
+
+	//*** Style Management Functions ***//
+		/**********************************************************************\
+			UpdateStyle( )
+
+			Called when the text changes. Updates the syntax highlighting
+			of the changed text.
+		\******/
+		static void UpdateStyleCB(int Pos, int nInserted, int nDeleted, int nRestyled, const char *pszDeleted, void *pV)
+			{	((StatsWindow *)pV)->UpdateStyle(Pos, nInserted, nDeleted, nRestyled, pszDeleted);	}
+		bool UpdateStyle(int, int, int, int, const char *);
+
+		/**********************************************************************\
+			ParseStyle( [in] updated text, [out] updated style )
+
+			Parses the updated text and updates the style of that text
+			character by character. Only the instruction lines are
+			highlighted.
+		\******/
+		virtual bool ParseStyle(const string &, string &);
+	};
+}
+
+#endif
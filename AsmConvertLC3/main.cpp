@@ -29,18 +29,18 @@ int main(int argc, char* argv[])
 	LocationVector LocationStack;
 	bool fRetVal = true;
 
-	for(unsigned int i = 0; i < InputList.size(); i++)
+	for(unsigned int i = 0; i < TheContext.InputList.size(); i++)
 	{
-		ifstream AsmFile(InputList[i].c_str());
+		ifstream AsmFile(TheContext.InputList[i].c_str());
 		if(!AsmFile.good())
 		{
-			sprintf(sMessageBuffer, "Unable to open file %.255s", InputList[i].c_str());
+			sprintf(sMessageBuffer, "Unable to open file %.255s", TheContext.InputList[i].c_str());
 			AsmCallBack(Fatal, sMessageBuffer, LocationVector());
 			fRetVal = false;
 			continue;
 		}
 
-		string sAsm3FileName = InputList[i]+"3";
+		string sAsm3FileName = TheContext.InputList[i]+"3";
 		ofstream Asm3File(sAsm3FileName.c_str());
 		if(!Asm3File.good())
 		{
@@ -51,7 +51,7 @@ int main(int argc, char* argv[])
 		}
 
 		LocationStack.push_back( LocationVector::value_type(i, 1) );
-		cout << "Translating " << InputList[i].c_str() << endl;
+		cout << "Translating " << TheContext.InputList[i].c_str() << endl;
 		if(!AsmConvertLC3(AsmFile, Asm3File, LocationStack, AsmCallBack))
 		{
 			fRetVal = false;
@@ -85,9 +85,9 @@ bool ProcessArgs(int argc, char* argv[])
 			continue;
 		}
 		//Store the filename
-		InputList.push_back(argv[i]);
+		TheContext.InputList.push_back(argv[i]);
 	}
-	if(InputList.empty())
+	if(TheContext.InputList.empty())
 	{
 		cout << "Error: No input files specified.\n\n";
 		return false;
@@ -60,7 +60,7 @@ bool Assemble<ISA>::Compile(istream &AsmFile, Program &AsmProg, CallBackFunction
 		fRetVal = false;
 
 	//print the tokens
-	if(Flags.fPrintTokens)
+	if(TheContext.Flags.fPrintTokens)
 	{
 		string sTokenFileName;
 		sTokenFileName = AsmProg.sFileName.Path + AsmProg.sFileName.Bare + ".Tokens.txt";
@@ -77,7 +77,7 @@ bool Assemble<ISA>::Compile(istream &AsmFile, Program &AsmProg, CallBackFunction
 			for(TokenIter = TokenList.begin(); TokenIter != TokenList.end(); TokenIter++)
 			{
 				for(LocationVector::iterator LVIter = (*TokenIter)->LocationStack.begin(); LVIter != (*TokenIter)->LocationStack.end(); LVIter++)
-					TokenFile << InputList[LVIter->first].c_str() << "(" << LVIter->second << "): ";
+					TokenFile << TheContext.InputList[LVIter->first].c_str() << "(" << LVIter->second << "): ";
 				TokenFile << (const char *)**TokenIter << endl;
 			}
 		}
@@ -93,7 +93,7 @@ bool Assemble<ISA>::Compile(istream &AsmFile, Program &AsmProg, CallBackFunction
 	for(TokenIter = TokenList.begin(); TokenIter != TokenList.end(); TokenIter++)
  		delete *TokenIter;
 
-	if(Flags.fPrintAST)
+	if(TheContext.Flags.fPrintAST)
 	{
 		string sASTFileName;
 		sASTFileName = AsmProg.sFileName.Path + AsmProg.sFileName.Bare + ".AST.asm";
@@ -126,7 +126,7 @@ bool Assemble<ISA>::Compile(istream &AsmFile, Program &AsmProg, CallBackFunction
 		return false;
 
 	//Run the optimizer
-	if(Flags.fUseOptimizations)
+	if(TheContext.Flags.fUseOptimizations)
 	{
 //		CallBack(Info, "Optimizing...", AsmProg.LocationStack);
 		if(!Optimize(AsmProg))
@@ -154,13 +154,13 @@ bool Assemble<ISA>::Disassemble(istream &AsmFile, Program &AsmProg, CallBackFunc
 		//Load the symbol table into the program.
 		//Get the ID for the new input file.
 		unsigned int IncludeID;
-		for(IncludeID = 0; IncludeID < InputList.size(); IncludeID++)
-			if(InputList[IncludeID] == sSymbolFile)
+		for(IncludeID = 0; IncludeID < TheContext.InputList.size(); IncludeID++)
+			if(TheContext.InputList[IncludeID] == sSymbolFile)
 				//The file is already in the global input list
 				break;
-		if(IncludeID == InputList.size())
+		if(IncludeID == TheContext.InputList.size())
 			//The file is not yet in the global input list
-			InputList.push_back(sSymbolFile);
+			TheContext.InputList.push_back(sSymbolFile);
 
 		//Lexically scan the input
 		list<Token *> TokenList;
@@ -194,7 +194,7 @@ bool Assemble<ISA>::Disassemble(istream &AsmFile, Program &AsmProg, CallBackFunc
 	if(!TheDisassembler.Disassemble(LocationStack, AsmFile, Symbols))
 		fRetVal = false;
 
-	if(Flags.fPrintAST)
+	if(TheContext.Flags.fPrintAST)
 	{
 		string sASTFileName;
 		sASTFileName = AsmProg.sFileName.Path + AsmProg.sFileName.Bare + ".AST.asm";
@@ -214,7 +214,7 @@ bool Assemble<ISA>::Disassemble(istream &AsmFile, Program &AsmProg, CallBackFunc
 }
 
 template<class ISA>
-bool Assemble<ISA>::Link(vector<Program *> &AsmProgs, RamVector &MemoryImage, CallBackFunction)
+bool Assemble<ISA>::Link(vector<Program *> &AsmProgs, RamImage &MemoryImage, CallBackFunction)
 {
 	char sMessageBuffer[65 + MAX(63, MAX_FILENAME_CHAR)];
 	bool fRetVal = true;
@@ -309,13 +309,13 @@ bool Assemble<ISA>::Link(vector<Program *> &AsmProgs, RamVector &MemoryImage, Ca
 		bool fLocalRetVal = true;
 
 //		CallBack(Info, "Building...", AsmProgs[i]->LocationStack);
-		RamVector ProgramImage;
+		RamImage ProgramImage;
 		if(!AsmProgs[i]->GenerateImage(ProgramImage, ISA::fLittleEndian, CallBack))
 			fLocalRetVal = false;
 		if(ProgramImage.empty())
 			CallBack(Warning, "Memory image is empty.", AsmProgs[i]->LocationStack);
 
-		if(Flags.fPrintSymbols)
+		if(TheContext.Flags.fPrintSymbols)
 		{
 			string sSymbolFileName;
 			sSymbolFileName = AsmProgs[i]->sFileName.Path + AsmProgs[i]->sFileName.Bare + ".Symbols.csv";
@@ -330,7 +330,7 @@ bool Assemble<ISA>::Link(vector<Program *> &AsmProgs, RamVector &MemoryImage, Ca
 			else
 				SymbolFile << AsmProgs[i]->TheSymbolTable;
 		}
-		if(fLocalRetVal && Flags.fOutputImage)
+		if(fLocalRetVal && TheContext.Flags.fOutputImage)
 		{
 			string sDumpFileName;
 			sDumpFileName = AsmProgs[i]->sFileName.Path + AsmProgs[i]->sFileName.Bare + ".obj";
@@ -369,31 +369,31 @@ bool Assemble<ISA>::Link(vector<Program *> &AsmProgs, RamVector &MemoryImage, Ca
 				DumpFile.put( (unsigned char)((Size & 0xFF0000000000) >> 40) );
 				DumpFile.put( (unsigned char)((Size & 0xFF000000000000) >> 48) );
 				DumpFile.put( (unsigned char)((Size & 0xFF00000000000000) >> 56) );
-*/				for(RamVector::iterator ProgramIter = ProgramImage.begin(); ProgramIter != ProgramImage.end(); ProgramIter++)
+*/				for(vector<RamImage::Extent>::iterator ExtentIter = ProgramImage.Extents.begin(); ExtentIter != ProgramImage.Extents.end(); ExtentIter++)
 				{
-					for(; Address < ProgramIter->first; Address++)
+					for(; Address < ExtentIter->first; Address++)
 						//This creates an invalid instruction, so a disassembler will always treat it as data.
 						//This is also a reference to one of my favorite japanese animations ^_^
 						DumpFile.put((unsigned char)UNINITIALIZED_VALUE);
-					DumpFile.put(ProgramIter->second);
-					Address++;
+					DumpFile.write((const char *)&ExtentIter->second[0], (streamsize)ExtentIter->second.size());
+					Address += ExtentIter->second.size();
 				}
 				for(; Address < EndAddress; Address++)
 					DumpFile.put((unsigned char)UNINITIALIZED_VALUE);
 			}
 		}
 
-		MemoryImage.insert(MemoryImage.end(), ProgramImage.begin(), ProgramImage.end());
+		MemoryImage.Splice(ProgramImage);
 		if(!fLocalRetVal)
 			fRetVal = false;
 	}
 
-	if(MemoryImage.rbegin() != MemoryImage.rend() && MemoryImage.rbegin()->first > ISA::MaxAddress)
+	if(!MemoryImage.empty() && MemoryImage.LastAddress() > ISA::MaxAddress)
 	{
 		#if defined _MSC_VER
-			sprintf(sMessageBuffer, "Program image (4x%I64X+1 Bytes) too large to fit in memory (4x%I64X+1 Bytes).", MemoryImage.rbegin()->first, ISA::MaxAddress);
+			sprintf(sMessageBuffer, "Program image (4x%I64X+1 Bytes) too large to fit in memory (4x%I64X+1 Bytes).", MemoryImage.LastAddress(), ISA::MaxAddress);
 		#elif defined GPLUSPLUS
-			sprintf(sMessageBuffer, "Program image (4x%llX+1 Bytes) too large to fit in memory (4x%llX+1 Bytes).", MemoryImage.rbegin()->first, ISA::MaxAddress);
+			sprintf(sMessageBuffer, "Program image (4x%llX+1 Bytes) too large to fit in memory (4x%llX+1 Bytes).", MemoryImage.LastAddress(), ISA::MaxAddress);
 		#else
 			#error "Only MSVC and GCC Compilers Supported"
 		#endif
@@ -406,20 +406,23 @@ bool Assemble<ISA>::Link(vector<Program *> &AsmProgs, RamVector &MemoryImage, Ca
 }
 
 template<class ISA>
-bool Assemble<ISA>::VHDLWrite(ostream &OutputStream, const RamVector &MemoryImage, CallBackFunction)
+bool Assemble<ISA>::VHDLWrite(ostream &OutputStream, const RamImage &MemoryImage, CallBackFunction)
 {
 	char sBuffer[128];
 
-	for(RamVector::const_iterator MemoryIter = MemoryImage.begin(); MemoryIter != MemoryImage.end(); MemoryIter++)
+	for(vector<RamImage::Extent>::const_iterator ExtentIter = MemoryImage.Extents.begin(); ExtentIter != MemoryImage.Extents.end(); ExtentIter++)
 	{
-		#if defined _MSC_VER
-			sprintf(sBuffer, "\tmem(%I64u) := To_stdlogicvector(X\"%02X\");\n", MemoryIter->first, MemoryIter->second);
-		#elif defined GPLUSPLUS
-			sprintf(sBuffer, "\tmem(%llu) := To_stdlogicvector(X\"%02X\");\n", MemoryIter->first, MemoryIter->second);
-		#else
-			#error "Only MSVC and GCC Compilers Supported"
-		#endif
-		OutputStream << sBuffer;
+		for(size_t i = 0; i < ExtentIter->second.size(); i++)
+		{
+			#if defined _MSC_VER
+				sprintf(sBuffer, "\tmem(%I64u) := To_stdlogicvector(X\"%02X\");\n", ExtentIter->first + i, ExtentIter->second[i]);
+			#elif defined GPLUSPLUS
+				sprintf(sBuffer, "\tmem(%llu) := To_stdlogicvector(X\"%02X\");\n", ExtentIter->first + i, ExtentIter->second[i]);
+			#else
+				#error "Only MSVC and GCC Compilers Supported"
+			#endif
+			OutputStream << sBuffer;
+		}
 	}
 
 	return true;
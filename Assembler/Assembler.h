@@ -113,7 +113,7 @@ namespace Assembler
 
 			Returns true if it completed linking, else false.
 		\******/
-		static bool Link(vector<Program *> &, RamVector &, CallBackFunction);
+		static bool Link(vector<Program *> &, RamImage &, CallBackFunction);
 
 		/**********************************************************************\
 			VHDLBuild( [in-out] output streamn, [in] memory image,
@@ -121,7 +121,7 @@ namespace Assembler
 
 			Outputs VHDL ram vectors for the image.
 		\******/
-		static bool VHDLWrite(ostream &, const RamVector &, CallBackFunction);
+		static bool VHDLWrite(ostream &, const RamImage &, CallBackFunction);
 
 		/**********************************************************************\
 			Exercises for students could involve implementing the following
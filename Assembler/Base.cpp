@@ -10,11 +10,19 @@ namespace Assembler	{
 
 unsigned int ConsoleWidth = 80;
 const char *const sLanguages[NUM_LANGUAGES] = {"LANG_NONE", "LANG_LC3", "LANG_LC3B"};
-Flags_t Flags = {false, false, false, false, false, false, false, false, false, false};
+Context DefaultContext = {{false, false, false, false, false, false, false, false, false, false}};
+THREAD_LOCAL Context *pCurrentContext = &DefaultContext;
 LanguageEnum DefaultLang = LangNone;
 string sOutputFileName;
 list< pair<string, string> > DefineList;
 
+Context *SetContext(Context *pContext)
+{
+	Context *pOldContext = pCurrentContext;
+	pCurrentContext = pContext;
+	return pOldContext;
+}
+
 }	//namespace Assembler
 
 namespace Simulator {
@@ -36,11 +36,46 @@ namespace Assembler
 	extern const char *const sLanguages[NUM_LANGUAGES];
 
 	//The following are all assembler settings that are setup before compiling
-	extern struct Flags_t
+	struct Flags_t
 	{
 		//Assembler/simulator options
 		bool fStdout, fConsoleWidth, fPrintTokens, fPrintAST, fPrintSymbols, fOutputImage, fOutputVHDL, fUseOptimizations, fOldLC3, fSimulate, fUseOS;
-	} Flags;
+	};
+
+	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
+		Context
+
+		The settings and input files of an assembly, and of the simulation
+		of the program it builds. Each thread works in its own current
+		context, which is DefaultContext until the thread selects another
+		with SetContext.
+
+		The context also holds the text returned by operator const char *()
+		of the elements and numbers which build their text in a string.
+		(Those which fit a fixed size use a buffer of the current thread.)
+		So several assemblies and simulations can run at once in one
+		process, as long as each thread has a context of its own.
+	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
+	struct Context
+	{
+		Flags_t Flags;
+		//A list of filenames being worked on
+		vector<string> InputList;
+		//Text last printed by an element and by a number
+		string sElementText, sNumberText;
+	};
+	extern Context DefaultContext;
+	extern THREAD_LOCAL Context *pCurrentContext;
+	//The current thread's context
+	#define TheContext (*Assembler::pCurrentContext)
+
+	/**********************************************************************\
+		SetContext( [in] context )
+
+		Makes the context the current thread's, and returns the one it had.
+		The context has to outlive its use by the thread.
+	\******/
+	Context *SetContext(Context *);
 	extern LanguageEnum DefaultLang;
 	extern string sOutputFileName;
 	extern list< pair<string, string> > DefineList;
@@ -130,6 +165,8 @@ namespace Simulator
 {
 	const char SIM_VER[] = "1.61";
 	const unsigned int MAX_CALLSTACK_DEPTH = 0x100000;
+	//Number of cycles the IDE runs between checking for user input
+	const unsigned int RUN_BATCH_CYCLES = 0x4000;
 	const unsigned int MAX_DISPLAY_LENGTH = 256;
 	const unsigned int MAX_DISPLAY_LENGTH_LG2 = 17;
 	const unsigned int MAX_DISPLAY_ARRAY_LENGTH_LG2 = 17;
@@ -67,7 +67,7 @@ void Data::AssignValues(vector<Number *>::iterator &StartIter, const vector<Numb
 	}
 }
 
-bool Data::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool Data::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
 	Data1 *TempData;
@@ -84,7 +84,6 @@ bool Data::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
 	Real8 TempReal8;
 	uint64 TempInt64, CurrentAddress = Address;
 
-	vRam.clear();
 
 	for(vector<Number *>::const_iterator DataIter = vData.begin(); DataIter != vData.end(); DataIter++)
 	{
@@ -155,15 +154,15 @@ bool Data::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
 		{
 			if(fLittleEndian)
 #ifdef BIG_ENDIAN_BUILD
-				vRam.push_back(RamVector::value_type(CurrentAddress + i, TempData[vDataBytes[DataType] - i - 1]));
+				Image.Append(CurrentAddress + i, TempData[vDataBytes[DataType] - i - 1]);
 #else
-				vRam.push_back(RamVector::value_type(CurrentAddress + i, TempData[i]));
+				Image.Append(CurrentAddress + i, TempData[i]);
 #endif
 			else	//Big Endian
 #ifdef BIG_ENDIAN_BUILD
-				vRam.push_back(RamVector::value_type(CurrentAddress + i, TempData[i]));
+				Image.Append(CurrentAddress + i, TempData[i]);
 #else
-				vRam.push_back(RamVector::value_type(CurrentAddress + i, TempData[vDataBytes[DataType] - i - 1]));
+				Image.Append(CurrentAddress + i, TempData[vDataBytes[DataType] - i - 1]);
 #endif
 		}
 		CurrentAddress += vDataBytes[DataType];
@@ -174,7 +173,6 @@ bool Data::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
 
 Data::operator const char *() const
 {
-	static string sData;
 	ostrstream strData;
 
 	strData << sDataTypes[DataType];
@@ -205,8 +203,8 @@ Data::operator const char *() const
 	}
 
 	strData << ends;
-	sData = strData.str();
-	return sData.c_str();
+	TheContext.sElementText = strData.str();
+	return TheContext.sElementText.c_str();
 }
 
 Data::~Data()
@@ -330,17 +328,14 @@ void Struct::AssignValues(vector<Number *>::iterator &StartIter, const vector<Nu
 	//*NOTE: Still need to think up some way to initialize nested structures.
 }
 
-bool Struct::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool Struct::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 
 	for(vector<Segment *>::const_iterator SegmentIter = Segments.begin(); SegmentIter != Segments.end(); SegmentIter++)
 	{
-		RamVector SegmentImage;
-		if(!(*SegmentIter)->GenerateImage(SegmentImage, fLittleEndian, CallBack))
+		if(!(*SegmentIter)->GenerateImage(Image, fLittleEndian, CallBack))
 			fRetVal = false;
-		vRam.insert(vRam.end(), SegmentImage.begin(), SegmentImage.end());
 	}
 
 	return true;
@@ -348,7 +343,6 @@ bool Struct::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) con
 
 Struct::operator const char *() const
 {
-	static string sData;
 	ostrstream strData;
 
 	strData << sDataTypes[STRUCT] << " " << pSymbol->sSymbol;
@@ -386,8 +380,8 @@ Struct::operator const char *() const
 	}
 
 	strData << ends;
-	sData = strData.str();
-	return sData.c_str();
+	TheContext.sElementText = strData.str();
+	return TheContext.sElementText.c_str();
 }
 
 Struct::~Struct()
@@ -416,10 +410,9 @@ void Align::AssignValues(vector<Number *>::iterator &StartIter, const vector<Num
 {
 }
 
-bool Align::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool Align::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	//No image
 	return true;
 }
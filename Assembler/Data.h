@@ -57,7 +57,7 @@ namespace Assembler
 
 		virtual Element *Copy() const;
 		virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-		virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+		virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 		virtual operator const char *() const;
 
 		virtual ~Data();
@@ -134,7 +134,7 @@ namespace Assembler
 
 		virtual Element *Copy() const;
 		virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-		virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+		virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 		virtual operator const char *() const;
 
 		virtual ~Struct();
@@ -169,7 +169,7 @@ namespace Assembler
 
 		virtual Element *Copy() const;
 		virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-		virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+		virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 		virtual operator const char *() const;
 
 		virtual ~Align();
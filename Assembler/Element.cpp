@@ -9,8 +9,8 @@ using namespace JMT;
 
 namespace Assembler	{
 
-char Element::sMessageBuffer[130 + 2*MAX_IDENTIFIER_CHAR];
-char Element::sElement[129 + MAX_IDENTIFIER_CHAR];
+THREAD_LOCAL char Element::sMessageBuffer[130 + 2*MAX_IDENTIFIER_CHAR];
+THREAD_LOCAL char Element::sElement[129 + MAX_IDENTIFIER_CHAR];
 
 
 Element::Element(const LocationVector &LS)
@@ -7,6 +7,7 @@
 
 #pragma warning (disable:4786)
 #include "Number.h"
+#include "RamImage.h"
 #include "Base.h"
 
 using namespace std;
@@ -37,20 +38,19 @@ namespace Assembler
 		All previous entries in the stack recursive locations each file was
 		included from in other assembly files.
 
-		In order to enable multi-threaded GetImage(), locks will need to be
-		placed around accesses to sMessageBuffer, or create a non-static buffer
-		unique to each function that uses it.
-
-		Usage of the operator const char *() must be done serially, not
-		multi-threaded.
+		Each thread has its own sMessageBuffer and sElement, and elements
+		which build their text in a string print it to the thread's
+		context, so several threads can call GetImage() and print elements
+		at once. The text returned by operator const char *() lasts until
+		the thread prints another element.
 	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
 	class Element
 	{
 	protected:
 		//Buffer for formatting error messages
-		static char sMessageBuffer[130 + 2*MAX_IDENTIFIER_CHAR];
+		static THREAD_LOCAL char sMessageBuffer[130 + 2*MAX_IDENTIFIER_CHAR];
 		//Buffer for printing elements
-		static char sElement[129 + MAX_IDENTIFIER_CHAR];
+		static THREAD_LOCAL char sElement[129 + MAX_IDENTIFIER_CHAR];
 
 	public:
 		//The type of element this is
@@ -92,17 +92,17 @@ namespace Assembler
 		virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &) = 0;
 
 		/**********************************************************************\
-			GetImage( [out] byte array, [in] endian-ness,
+			GetImage( [in-out] memory image, [in] endian-ness,
 				[in] error callback function )
 			
-			Computes the binary image that this element represents. It returns
-			it in the byte array. The data is converted to bytes based on
-			whether it is little endian (true) or big endian (false).
+			Computes the binary image that this element represents. It appends
+			it to the end of the memory image. The data is converted to bytes
+			based on whether it is little endian (true) or big endian (false).
 
 			If there is an error in the data, it will print an error message and
 			return false.
 		\******/
-		virtual bool GetImage(RamVector &, bool, CallBackFunction) const = 0;
+		virtual bool GetImage(RamImage &, bool, CallBackFunction) const = 0;
 
 		/**********************************************************************\
 			Prints the element
@@ -157,16 +157,16 @@ bool Expander<ISA>::ParseInclude(list<Token *>::iterator &StartIter)
 	TokenIter = StartIter++;
 
 	//The filename must be relative to the working directory
-	sFileName = CreateRelativeFileName(sWorkingDir, CreateFileNameRelative(sWorkingDir, CreateFileNameRelative(InputList[(*OrigIter)->LocationStack.rbegin()->first], sFileName)));
+	sFileName = CreateRelativeFileName(sWorkingDir, CreateFileNameRelative(sWorkingDir, CreateFileNameRelative(TheContext.InputList[(*OrigIter)->LocationStack.rbegin()->first], sFileName)));
 
 	//Get the ID for the new input file.
-	for(IncludeID = 0; IncludeID < InputList.size(); IncludeID++)
-		if(InputList[IncludeID] == sFileName)
+	for(IncludeID = 0; IncludeID < TheContext.InputList.size(); IncludeID++)
+		if(TheContext.InputList[IncludeID] == sFileName)
 			//The file is already in the global input list
 			break;
-	if(IncludeID == InputList.size())
+	if(IncludeID == TheContext.InputList.size())
 		//The file is not yet in the global input list
-		InputList.push_back(sFileName);
+		TheContext.InputList.push_back(sFileName);
 
 	//Update the location stack to include this new file
 	//Use location from the INCLUDE keyword
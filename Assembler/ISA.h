@@ -187,7 +187,7 @@ namespace My
 			Instruction(const LocationVector &);
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			/******************************************************************\
 				Stuff for optimization algorithms
 				GetSources/Destinations will reflect NZP use so that branches
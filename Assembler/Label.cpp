@@ -32,9 +32,8 @@ void Label::AssignValues(vector<Number *>::iterator &StartIter, const vector<Num
 {
 }
 
-bool Label::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool Label::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
-	vRam.clear();
 	return true;
 }
 
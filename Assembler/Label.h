@@ -45,7 +45,7 @@ namespace Assembler
 
 		virtual Element *Copy() const;
 		virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-		virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+		virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 
 		/**********************************************************************\
 			Prints the label
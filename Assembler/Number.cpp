@@ -26,8 +26,8 @@ namespace Assembler	{
 //1 - 1 = 0
 //instead!
 
-char Number::sMessageBuffer[129 + MAX_IDENTIFIER_CHAR];
-char Number::sNumber[MAX(64, 1+MAX_IDENTIFIER_CHAR)];
+THREAD_LOCAL char Number::sMessageBuffer[129 + MAX_IDENTIFIER_CHAR];
+THREAD_LOCAL char Number::sNumber[MAX(64, 1+MAX_IDENTIFIER_CHAR)];
 
 Number::Number(const LocationVector &LS)
 {
@@ -92,7 +92,7 @@ RealNumber::RealNumber(const LocationVector &LocationStack, unsigned char ExpBit
 
 }
 
-RealNumber::RealNumber(const LocationVector &LocationStack, unsigned char ExpBits, unsigned char MantBits, const RamVector &vData, bool fLittleEndian) : Number(LocationStack)
+RealNumber::RealNumber(const LocationVector &LocationStack, unsigned char ExpBits, unsigned char MantBits, const vector<unsigned char> &vData, bool fLittleEndian) : Number(LocationStack)
 {
 	NumberType = NumReal;
 	JMT::ByteData ByteData;
@@ -105,15 +105,15 @@ RealNumber::RealNumber(const LocationVector &LocationStack, unsigned char ExpBit
 	{
 		if(fLittleEndian)
 #ifdef BIG_ENDIAN_BUILD
-			ByteData.Bytes[sizeof(uint64) - i - 1] = vData[i].second;
+			ByteData.Bytes[sizeof(uint64) - i - 1] = vData[i];
 #else
-			ByteData.Bytes[i] = vData[i].second;
+			ByteData.Bytes[i] = vData[i];
 #endif
 		else	//Big Endian
 #ifdef BIG_ENDIAN_BUILD
-			ByteData.Bytes[sizeof(uint64) - i - 1] = vData[vData.size() - i - 1].second;
+			ByteData.Bytes[sizeof(uint64) - i - 1] = vData[vData.size() - i - 1];
 #else
-			ByteData.Bytes[i] = vData[vData.size() - i - 1].second;
+			ByteData.Bytes[i] = vData[vData.size() - i - 1];
 #endif
 	}
 	for(i = vData.size(); i < sizeof(uint64); i++)
@@ -353,7 +353,7 @@ IntegerNumber::IntegerNumber(const LocationVector &LocationStack, uint64 value,
 	fNegative = fnegative;
 }
 
-IntegerNumber::IntegerNumber(const LocationVector &LocationStack, const RamVector &vData, bool fLittleEndian) : Number(LocationStack)
+IntegerNumber::IntegerNumber(const LocationVector &LocationStack, const vector<unsigned char> &vData, bool fLittleEndian) : Number(LocationStack)
 {
 	NumberType = NumInteger;
 	fNegative = false;
@@ -367,15 +367,15 @@ IntegerNumber::IntegerNumber(const LocationVector &LocationStack, const RamVecto
 	{
 		if(fLittleEndian)
 #ifdef BIG_ENDIAN_BUILD
-			ByteData.Bytes[sizeof(uint64) - i - 1] = vData[i].second;
+			ByteData.Bytes[sizeof(uint64) - i - 1] = vData[i];
 #else
-			ByteData.Bytes[i] = vData[i].second;
+			ByteData.Bytes[i] = vData[i];
 #endif
 		else	//Big Endian
 #ifdef BIG_ENDIAN_BUILD
-			ByteData.Bytes[sizeof(uint64) - i - 1] = vData[vData.size() - i - 1].second;
+			ByteData.Bytes[sizeof(uint64) - i - 1] = vData[vData.size() - i - 1];
 #else
-			ByteData.Bytes[i] = vData[vData.size() - i - 1].second;
+			ByteData.Bytes[i] = vData[vData.size() - i - 1];
 #endif
 	}
 	for(i = vData.size(); i < sizeof(uint64); i++)
@@ -920,7 +920,6 @@ bool SymbolNumber::Int(unsigned char Bits, bool fSigned, uint64 &RetInt, CallBac
 
 SymbolNumber::operator const char *() const
 {
-	static string strNumber;
 	ostrstream strNum;
 
 	strNum << pSymbol->sSymbol.c_str();
@@ -936,8 +935,8 @@ SymbolNumber::operator const char *() const
 		strNum << "$" << sAttributes[Attribute];
 
 	strNum << ends;
-	strNumber = strNum.str();
-	return strNumber.c_str();
+	TheContext.sNumberText = strNum.str();
+	return TheContext.sNumberText.c_str();
 }
 
 SymbolNumber::~SymbolNumber()
@@ -26,20 +26,18 @@ namespace Assembler
 		The number could be any type of signed/unsigned integral/real type/
 		character, or a symbol which references an address.
 
-		In order to enable multi-threaded conversions, locks will need to be
-		placed around accesses to sMessageBuffer, or create a non-static buffer
-		unique to each function that uses it.
-
-		Usage of the operator const char *() must be done serially, not
-		multi-threaded.
+		Each thread has its own sMessageBuffer and sNumber, and a symbol is
+		printed to the thread's context, so numbers can be converted and
+		printed by several threads at once. The text returned by
+		operator const char *() lasts until the thread prints another number.
 	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
 	class Number
 	{
 	protected:
 		//Buffer for formatting error messages
-		static char sMessageBuffer[129 + MAX_IDENTIFIER_CHAR];
+		static THREAD_LOCAL char sMessageBuffer[129 + MAX_IDENTIFIER_CHAR];
 		//Buffer for printing numbers
-		static char sNumber[MAX(64, 1+MAX_IDENTIFIER_CHAR)];
+		static THREAD_LOCAL char sNumber[MAX(64, 1+MAX_IDENTIFIER_CHAR)];
 
 	public:
 		NumberEnum NumberType;
@@ -127,7 +125,7 @@ namespace Assembler
 		//#exponent bits, #mantissa bits, float value (right or LSB justified)
 		RealNumber(const LocationVector &, unsigned char, unsigned char, uint64);
 		//#exponent bits, #mantissa bits, memory byte data, true if little endian
-		RealNumber(const LocationVector &, unsigned char, unsigned char, const RamVector &, bool);
+		RealNumber(const LocationVector &, unsigned char, unsigned char, const vector<unsigned char> &, bool);
 
 		virtual Number *Copy() const;
 		virtual bool Float(unsigned char, unsigned char, unsigned char &, unsigned short &, uint64 &, CallBackFunction, const char *sExtra = "", bool fWarnErrors = false, unsigned char Addressability = 0) const;
@@ -148,7 +146,7 @@ namespace Assembler
 		IntegerNumber(const IntegerToken &);
 		IntegerNumber(const LocationVector &, uint64, bool fnegative = false);
 		//memory byte data, true if little endian
-		IntegerNumber(const LocationVector &, const RamVector &, bool);
+		IntegerNumber(const LocationVector &, const vector<unsigned char> &, bool);
 
 		virtual Number *Copy() const;
 		virtual bool Float(unsigned char, unsigned char, unsigned char &, unsigned short &, uint64 &, CallBackFunction, const char *sExtra = "", bool fWarnErrors = false, unsigned char Addressability = 0) const;
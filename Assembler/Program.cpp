@@ -72,18 +72,15 @@ bool Program::ResolveAddresses(uint64 &CurrentAddress, CallBackFunction)
 	return fRetVal;
 }
 
-bool Program::GenerateImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool Program::GenerateImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 
 	//Go over each segment
 	for(list<Segment *>::const_iterator SegmentIter = Segments.begin(); SegmentIter != Segments.end(); SegmentIter++)
 	{
-		RamVector SegmentImage;
-		if( !(*SegmentIter)->GenerateImage(SegmentImage, fLittleEndian, CallBack) )
+		if( !(*SegmentIter)->GenerateImage(Image, fLittleEndian, CallBack) )
 			fRetVal = false;
-		vRam.insert(vRam.end(), SegmentImage.begin(), SegmentImage.end());
 	}
 
 	return fRetVal;
@@ -91,7 +88,7 @@ bool Program::GenerateImage(RamVector &vRam, bool fLittleEndian, CallBackFunctio
 
 Program::operator const char *() const
 {
-	static char sProgram[33 + MAX_FILENAME_CHAR];
+	static THREAD_LOCAL char sProgram[33 + MAX_FILENAME_CHAR];
 	char *psP = sProgram;
 
 	psP += sprintf(psP, "ORIGIN");
@@ -11,6 +11,7 @@
 #include <iostream>
 #include "SymbolTable.h"
 #include "Segment.h"
+#include "RamImage.h"
 #include "Base.h"
 
 using namespace std;
@@ -27,8 +28,8 @@ namespace Assembler
 		A program contains a a series of segments. Each segment contains
 		a sequence of elements, such as data, instructions, and labels.
 
-		Usage of the operator const char *() must be done serially, not
-		multi-threaded.
+		The text returned by operator const char *() is in a buffer of the
+		current thread, and lasts until the thread prints another.
 	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
 	class Program
 	{
@@ -83,12 +84,12 @@ namespace Assembler
 		bool ResolveAddresses(uint64 &, CallBackFunction);
 
 		/**********************************************************************\
-			GenerateImage( [out] array of memory bytes, [in] endian-ness
+			GenerateImage( [in-out] memory image, [in] endian-ness
 				[in] error callback function )
 
-			This runs through the segments and generates the segment images
-			and combines them into a program image. The data can be
-			stored in little endian (true) or big endian (false) format.
+			This runs through the segments and appends their images to the
+			end of the memory image. The data can be stored in little endian
+			(true) or big endian (false) format.
 
 			Uninitialized memory address will be zero-filled
 
@@ -98,7 +99,7 @@ namespace Assembler
 			If there is an error in the data, it will print an error message.
 			It will return false if it was unable to generate the whole image.
 		\******/
-		bool GenerateImage(RamVector &, bool, CallBackFunction) const;
+		bool GenerateImage(RamImage &, bool, CallBackFunction) const;
 
 		/**********************************************************************\
 			Prints the program
@@ -0,0 +1,115 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#include "RamImage.h"
+
+using namespace std;
+using namespace JMT;
+
+namespace Assembler	{
+
+RamImage::RamImage()
+{
+}
+
+void RamImage::Append(uint64 Address, unsigned char Value)
+{
+	if(Extents.empty() || Extents.back().first + Extents.back().second.size() != Address)
+		AddExtent(Address);
+	Extents.back().second.push_back(Value);
+}
+
+void RamImage::Append(const RamImage &Image)
+{
+	vector<Extent>::const_iterator ExtentIter = Image.Extents.begin();
+	if(ExtentIter == Image.Extents.end())
+		return;
+
+	//The first extent may continue our last one
+	if(!Extents.empty() && Extents.back().first + Extents.back().second.size() == ExtentIter->first)
+	{
+		Extents.back().second.insert(Extents.back().second.end(), ExtentIter->second.begin(), ExtentIter->second.end());
+		ExtentIter++;
+	}
+	for(; ExtentIter != Image.Extents.end(); ExtentIter++)
+	{
+		AddExtent(ExtentIter->first);
+		Extents.back().second = ExtentIter->second;
+	}
+}
+
+void RamImage::Splice(RamImage &Image)
+{
+	vector<Extent>::iterator ExtentIter = Image.Extents.begin();
+	if(ExtentIter == Image.Extents.end())
+		return;
+
+	//The first extent may continue our last one
+	if(!Extents.empty() && Extents.back().first + Extents.back().second.size() == ExtentIter->first)
+	{
+		Extents.back().second.insert(Extents.back().second.end(), ExtentIter->second.begin(), ExtentIter->second.end());
+		ExtentIter++;
+	}
+	for(; ExtentIter != Image.Extents.end(); ExtentIter++)
+	{
+		AddExtent(ExtentIter->first);
+		Extents.back().second.swap(ExtentIter->second);
+	}
+	Image.clear();
+}
+
+bool RamImage::empty() const
+{
+	return Extents.empty();
+}
+
+void RamImage::clear()
+{
+	Extents.clear();
+}
+
+uint64 RamImage::Size() const
+{
+	uint64 Bytes = 0;
+	for(vector<Extent>::const_iterator ExtentIter = Extents.begin(); ExtentIter != Extents.end(); ExtentIter++)
+		Bytes += ExtentIter->second.size();
+	return Bytes;
+}
+
+uint64 RamImage::FirstAddress() const
+{
+	return Extents.front().first;
+}
+
+uint64 RamImage::LastAddress() const
+{
+	return Extents.back().first + Extents.back().second.size() - 1;
+}
+
+void RamImage::AddExtent(uint64 Address)
+{
+	if(Extents.size() == Extents.capacity())
+	{
+		vector<Extent> NewExtents(Extents.size());
+		NewExtents.reserve(Extents.empty() ? 4 : 2 * Extents.size());
+		for(size_t i = 0; i < Extents.size(); i++)
+		{
+			NewExtents[i].first = Extents[i].first;
+			NewExtents[i].second.swap(Extents[i].second);
+		}
+		Extents.swap(NewExtents);
+	}
+	Extents.push_back( Extent(Address, vector<unsigned char>()) );
+}
+
+void RamImage::GetRamVector(RamVector &vRam) const
+{
+	vRam.clear();
+	vRam.reserve((size_t)Size());
+	for(vector<Extent>::const_iterator ExtentIter = Extents.begin(); ExtentIter != Extents.end(); ExtentIter++)
+		for(size_t i = 0; i < ExtentIter->second.size(); i++)
+			vRam.push_back( RamVector::value_type(ExtentIter->first + i, ExtentIter->second[i]) );
+}
+
+}	//namespace Assembler
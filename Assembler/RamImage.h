@@ -0,0 +1,86 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#ifndef RAMIMAGE_H
+#define RAMIMAGE_H
+
+#pragma warning (disable:4786)
+#include <vector>
+#include "Base.h"
+
+using namespace std;
+using namespace JMT;
+
+namespace Assembler
+{
+	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
+		RamImage
+
+		An instance of this class is a memory image made of extents. Each
+		extent is a base byte address and the bytes at consecutive addresses
+		from there.
+
+		Bytes appended right after the end of the last extent extend it, so
+		an assembled program is usually only a handful of extents. The
+		extents are kept in the order they were appended, which is not
+		necessarily in order of address.
+
+		A RamVector of <address, byte> pairs can be produced from the image
+		on request, for code that works a byte at a time.
+	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
+	class RamImage
+	{
+	public:
+		//<base address, bytes>
+		typedef pair< uint64, vector<unsigned char> > Extent;
+		vector<Extent> Extents;
+
+		RamImage();
+
+		/**********************************************************************\
+			Append( [in] address, [in] byte value )
+			Append( [in] memory image )
+
+			Adds bytes to the end of the image. Bytes which continue the last
+			extent are added to it, otherwise a new extent is started.
+		\******/
+		void Append(uint64, unsigned char);
+		void Append(const RamImage &);
+
+		/**********************************************************************\
+			Splice( [in-out] memory image )
+
+			Moves the bytes of the image to the end of this one, without
+			copying them unless the first extent continues the last one here.
+			The image is left empty.
+		\******/
+		void Splice(RamImage &);
+
+		//true if there are no bytes in the image
+		bool empty() const;
+		//Remove all bytes
+		void clear();
+		//The number of bytes in the image
+		uint64 Size() const;
+		//The address of the first byte appended. The image must not be empty.
+		uint64 FirstAddress() const;
+		//The address of the last byte appended. The image must not be empty.
+		uint64 LastAddress() const;
+
+		/**********************************************************************\
+			GetRamVector( [out] array of memory bytes )
+
+			Lists every byte of the image as an <address, byte> pair, in the
+			order they were appended.
+		\******/
+		void GetRamVector(RamVector &) const;
+
+	protected:
+		//Starts a new extent at the address. The bytes of the extents are
+		//swapped rather than copied when the list of extents grows.
+		void AddExtent(uint64);
+	};
+}
+
+#endif
@@ -165,18 +165,15 @@ bool Segment::ResolveAddresses(uint64 &CurrentAddress, CallBackFunction)
 	return fRetVal;
 }
 
-bool Segment::GenerateImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool Segment::GenerateImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 
 	//Go over each element in the sequence and add their image to the Ram.
 	for(list<Element *>::const_iterator SequenceIter = Sequence.begin(); SequenceIter != Sequence.end(); SequenceIter++)
 	{
-		RamVector ElementImage;
-		if( !(*SequenceIter)->GetImage(ElementImage, fLittleEndian, CallBack) )
+		if( !(*SequenceIter)->GetImage(Image, fLittleEndian, CallBack) )
 			fRetVal = false;
-		vRam.insert(vRam.end(), ElementImage.begin(), ElementImage.end());
 	}
 
 	return fRetVal;
@@ -184,7 +181,7 @@ bool Segment::GenerateImage(RamVector &vRam, bool fLittleEndian, CallBackFunctio
 
 Segment::operator const char *() const
 {
-	static char sSegment[32 + MAX_IDENTIFIER_CHAR];
+	static THREAD_LOCAL char sSegment[32 + MAX_IDENTIFIER_CHAR];
 
 	if(fStruct)
 		sprintf(sSegment, "STRUCTDEF %.63s", sStruct.c_str());
@@ -9,6 +9,7 @@
 #include <list>
 #include <iostream>
 #include "Element.h"
+#include "RamImage.h"
 #include "Base.h"
 
 using namespace std;
@@ -25,8 +26,8 @@ namespace Assembler
 		A segment begins at a memory address, and contains a sequence of
 		elements, such as instructions and data.
 
-		Usage of the operator const char *() must be done serially, not
-		multi-threaded.
+		The text returned by operator const char *() is in a buffer of the
+		current thread, and lasts until the thread prints another.
 	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
 	class Segment
 	{
@@ -91,12 +92,13 @@ namespace Assembler
 		virtual bool ResolveAddresses(uint64 &, CallBackFunction);
 
 		/**********************************************************************\
-			GenerateImage( [out] array of memory bytes, [in] endian-ness
+			GenerateImage( [in-out] memory image, [in] endian-ness
 				[in] error callback function )
 
-			This runs through the elements and gets their images
-			and combines them into a segment image. The data can be
-			stored in little endian (true) or big endian (false) format.
+			This runs through the elements and appends their images to the
+			end of the memory image, so the segment image is built straight
+			into its extents. The data can be stored in little endian (true)
+			or big endian (false) format.
 
 			ResolveAddresses must be called before this. Otherwise symbols may
 			have the wrong value when they are generated.
@@ -104,7 +106,7 @@ namespace Assembler
 			If there is an error in the data, it will print an error message.
 			It will return false if it was unable to generate the whole image.
 		\******/
-		virtual bool GenerateImage(RamVector &, bool, CallBackFunction) const;
+		virtual bool GenerateImage(RamImage &, bool, CallBackFunction) const;
 
 		/**********************************************************************\
 			Prints the segment
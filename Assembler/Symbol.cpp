@@ -65,7 +65,7 @@ uint64 Symbol::GetSegmentRelativeValue() const
 
 Symbol::operator const char *() const
 {
-	static char sSymb[65 + MAX_IDENTIFIER_CHAR];
+	static THREAD_LOCAL char sSymb[65 + MAX_IDENTIFIER_CHAR];
 	char *psS = sSymb;
 
 	psS += sprintf(psS, "%.63s, %.31s", sSymbol.c_str(), sSymbols[SymbolType]);
@@ -9,7 +9,6 @@ using namespace std;
 namespace JMT	{
 
 string sWorkingDir;
-vector<string> InputList;
 
 bool EndianCheck()
 {
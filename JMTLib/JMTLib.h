@@ -190,8 +190,6 @@ namespace JMT	{
 
 	//The working directory for the current operation
 	extern string sWorkingDir;
-	//A list of filenames being worked on
-	extern vector<string> InputList;
 
 	//The datatype for file locations <InputList index, line number>
 	typedef vector< pair<unsigned int, unsigned int> > LocationVector;
@@ -11,7 +11,9 @@ using namespace std;
 /*============================================================================*\
  *	Macros for cross-platform system functions.
  *
- *	Includes Asynchronous I/O, memory nailing.
+ *	Includes Asynchronous I/O, memory nailing, read-only file mapping,
+ *	threads, thread-local storage, semaphores, atomic operations and
+ *	memory barriers.
 \*============================================================================*/
 
 #if defined WIN32
@@ -29,6 +31,76 @@ using namespace std;
 					Sleep(1);\
 		}
 
+	#define THREAD_TYPE HANDLE
+	#define THREAD_FUNCTION(Function, pParam) DWORD WINAPI Function(LPVOID pParam)
+
+	#define THREAD_CREATE(Thread, Function, pParam)\
+		{\
+			if(!(Thread = CreateThread(NULL, 0, Function, pParam, 0, NULL)))\
+				throw runtime_error("JMTSys: Failed to create thread");\
+		}
+
+	#define THREAD_JOIN(Thread)\
+		{\
+			WaitForSingleObject(Thread, INFINITE);\
+			CloseHandle(Thread);\
+		}
+
+	#define THREAD_LOCAL __declspec(thread)
+
+	#define PROCESSOR_COUNT(Count)\
+		{\
+			SYSTEM_INFO SystemInfo;\
+			GetSystemInfo(&SystemInfo);\
+			Count = SystemInfo.dwNumberOfProcessors;\
+		}
+
+	#define SEMAPHORE_TYPE HANDLE
+
+	#define SEMAPHORE_CREATE(Semaphore)\
+		{\
+			if(!(Semaphore = CreateSemaphore(NULL, 0, MAXLONG, NULL)))\
+				throw runtime_error("JMTSys: Failed to create semaphore");\
+		}
+
+	#define SEMAPHORE_POST(Semaphore)\
+		ReleaseSemaphore(Semaphore, 1, NULL);
+
+	#define SEMAPHORE_WAIT(Semaphore)\
+		WaitForSingleObject(Semaphore, INFINITE);
+
+	#define SEMAPHORE_CLOSE(Semaphore)\
+		CloseHandle(Semaphore);
+
+	//Memory accesses are not moved across the barrier by the compiler or CPU
+	#define MEMORY_BARRIER()\
+		MemoryBarrier();
+
+	//Stores Exchange in the 64 bit Target if it holds Comparand. Evaluates to
+	//the value Target held.
+	#define ATOMIC_COMPARE_EXCHANGE(Target, Exchange, Comparand)\
+		(unsigned __int64)InterlockedCompareExchange64((LONGLONG volatile *)&(Target), (LONGLONG)(Exchange), (LONGLONG)(Comparand))
+
+	//MSVC gives volatile reads acquire semantics and volatile writes release
+	//semantics, so the atomic accesses go through a volatile reference
+	template<class T> inline T AtomicLoad(const volatile T &Target)
+	{
+		return Target;
+	}
+	template<class T, class V> inline void AtomicStore(volatile T &Target, V Value)
+	{
+		Target = (T)Value;
+	}
+
+	//Reads Target, and later memory accesses are not moved before the read
+	#define ATOMIC_LOAD(Target)\
+		AtomicLoad(Target)
+
+	//Writes Value to Target, and earlier memory accesses are not moved after
+	//the write
+	#define ATOMIC_STORE(Target, Value)\
+		AtomicStore(Target, Value);
+
 	#define ASYNC_TYPE HANDLE
 	#define OVERLAP_TYPE OVERLAPPED
 
@@ -95,10 +167,51 @@ using namespace std;
 			if(!VirtualUnlock(pointer, size))\
 				throw runtime_error("JMTSys: Failed to lock memory");\
 		}
+
+	#define MAPPED_FILE_TYPE HANDLE
+	#define MAPPED_FILE_NONE INVALID_HANDLE_VALUE
+
+	//Leaves pData NULL if the file cannot be mapped
+	#define MAPPED_FILE_OPEN(FileName, File, Mapping, pData, Size)\
+		{\
+			pData = NULL;\
+			Size = 0;\
+			Mapping = MAPPED_FILE_NONE;\
+			File = CreateFileA(FileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);\
+			if(File != MAPPED_FILE_NONE)\
+			{\
+				DWORD SizeHigh;\
+				DWORD SizeLow = GetFileSize(File, &SizeHigh);\
+				Size = ((unsigned __int64)SizeHigh << 32) | SizeLow;\
+				if(Size)\
+				{\
+					Mapping = CreateFileMapping(File, NULL, PAGE_READONLY, 0, 0, NULL);\
+					if(!Mapping)\
+						Mapping = MAPPED_FILE_NONE;\
+					else\
+						pData = (const unsigned char *)MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0);\
+				}\
+			}\
+		}
+
+	#define MAPPED_FILE_CLOSE(File, Mapping, pData, Size)\
+		{\
+			if(pData)\
+				UnmapViewOfFile(pData);\
+			if(Mapping != MAPPED_FILE_NONE)\
+				CloseHandle(Mapping);\
+			if(File != MAPPED_FILE_NONE)\
+				CloseHandle(File);\
+		}
 #elif defined UNIX_BUILD
 	#include <unistd.h>
 	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
 	#include <sched.h>
+	#include <pthread.h>
+	#include <semaphore.h>
+	#include <errno.h>
 
 	#define SYNCH_SLEEP(Interval)\
 		{\
@@ -109,6 +222,59 @@ using namespace std;
 					usleep(1000);\
 		}
 
+	#define THREAD_TYPE pthread_t
+	#define THREAD_FUNCTION(Function, pParam) void *Function(void *pParam)
+
+	#define THREAD_CREATE(Thread, Function, pParam)\
+		{\
+			if(pthread_create(&Thread, NULL, Function, pParam))\
+				throw runtime_error("JMTSys: Failed to create thread");\
+		}
+
+	#define THREAD_JOIN(Thread)\
+		pthread_join(Thread, NULL);
+
+	#define THREAD_LOCAL __thread
+
+	#define PROCESSOR_COUNT(Count)\
+		Count = sysconf(_SC_NPROCESSORS_ONLN);
+
+	#define SEMAPHORE_TYPE sem_t
+
+	#define SEMAPHORE_CREATE(Semaphore)\
+		{\
+			if(sem_init(&Semaphore, 0, 0))\
+				throw runtime_error("JMTSys: Failed to create semaphore");\
+		}
+
+	#define SEMAPHORE_POST(Semaphore)\
+		sem_post(&Semaphore);
+
+	//Signals interrupt the wait, so wait again
+	#define SEMAPHORE_WAIT(Semaphore)\
+		while(sem_wait(&Semaphore) && errno == EINTR);
+
+	#define SEMAPHORE_CLOSE(Semaphore)\
+		sem_destroy(&Semaphore);
+
+	//Memory accesses are not moved across the barrier by the compiler or CPU
+	#define MEMORY_BARRIER()\
+		__sync_synchronize();
+
+	//Stores Exchange in the 64 bit Target if it holds Comparand. Evaluates to
+	//the value Target held.
+	#define ATOMIC_COMPARE_EXCHANGE(Target, Exchange, Comparand)\
+		__sync_val_compare_and_swap(&(Target), (Comparand), (Exchange))
+
+	//Reads Target, and later memory accesses are not moved before the read
+	#define ATOMIC_LOAD(Target)\
+		__atomic_load_n(&(Target), __ATOMIC_ACQUIRE)
+
+	//Writes Value to Target, and earlier memory accesses are not moved after
+	//the write
+	#define ATOMIC_STORE(Target, Value)\
+		__atomic_store_n(&(Target), (Value), __ATOMIC_RELEASE);
+
 	#define ASYNC_TYPE unsigned long
 	#define OVERLAP_TYPE unsigned long
 
@@ -142,6 +308,37 @@ using namespace std;
 			if(munlock((void *)pointer, size))\
 				throw runtime_error("JMTSys: Failed to lock memory");\
 		}
+
+	#define MAPPED_FILE_TYPE int
+	#define MAPPED_FILE_NONE -1
+
+	//Leaves pData NULL if the file cannot be mapped
+	#define MAPPED_FILE_OPEN(FileName, File, Mapping, pData, Size)\
+		{\
+			pData = NULL;\
+			Size = 0;\
+			Mapping = MAPPED_FILE_NONE;\
+			File = open(FileName, O_RDONLY);\
+			if(File != MAPPED_FILE_NONE)\
+			{\
+				struct stat FileStat;\
+				if(!fstat(File, &FileStat) && FileStat.st_size > 0)\
+				{\
+					Size = FileStat.st_size;\
+					void *pMap = mmap(NULL, (size_t)Size, PROT_READ, MAP_PRIVATE, File, 0);\
+					if(pMap != MAP_FAILED)\
+						pData = (const unsigned char *)pMap;\
+				}\
+			}\
+		}
+
+	#define MAPPED_FILE_CLOSE(File, Mapping, pData, Size)\
+		{\
+			if(pData)\
+				munmap((void *)pData, (size_t)Size);\
+			if(File != MAPPED_FILE_NONE)\
+				close(File);\
+		}
 #else
 	#error "Only WIN32 and UNIX Systems Supported"
 #endif
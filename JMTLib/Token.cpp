@@ -8,7 +8,7 @@ using namespace std;
 
 namespace JMT	{
 
-char Token::sToken[65 + MAX(63, MAX_IDENTIFIER_CHAR)];
+THREAD_LOCAL char Token::sToken[65 + MAX(63, MAX_IDENTIFIER_CHAR)];
 
 Token::Token(const LocationVector &locationstack)
 {
@@ -92,7 +92,6 @@ Token * StringToken::Copy() const
 
 StringToken::operator const char *() const
 {
-	static string strToken;
 	strToken = "String: \"";
 	for(unsigned int i = 0; i < sString.size(); i++)
 	{
@@ -54,15 +54,17 @@ namespace JMT
 		All previous entries in the stack recursive locations each file was
 		included from in other assembly files.
 
-		Usage of the operator const char *() must be done serially, not
-		multi-threaded.
+		Each thread has its own sToken, so tokens can be printed by several
+		threads at once. The text returned by operator const char *() lasts
+		until the thread prints another token, or for a string token, until
+		the token is printed again or destroyed.
 	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
 
 	class Token
 	{
 	protected:
 		//Buffer for printing tokens
-		static char sToken[65 + MAX(63, MAX_IDENTIFIER_CHAR)];
+		static THREAD_LOCAL char sToken[65 + MAX(63, MAX_IDENTIFIER_CHAR)];
 
 	public:
 		//What kind of token this is
@@ -107,6 +109,9 @@ namespace JMT
 		StringToken(const LocationVector &, const string &);
 		virtual Token * Copy() const;
 		virtual operator const char *() const;
+	protected:
+		//Text last printed. The string is too long for sToken.
+		mutable string strToken;
 	};
 
 	//The token type for integers
@@ -19,7 +19,7 @@ namespace LC3
 
 static unsigned int Warnings = 0, Errors = 0;
 
-bool AssemblerUI(vector<Program *> &AsmPrograms, RamVector &MemoryImage)
+bool AssemblerUI(vector<Program *> &AsmPrograms, RamImage &MemoryImage)
 {
 	bool fRetVal = true;
 	char sMessageBuffer[65 + MAX_FILENAME_CHAR];
@@ -46,7 +46,7 @@ bool AssemblerUI(vector<Program *> &AsmPrograms, RamVector &MemoryImage)
 #endif
 
 	//Check to see if we should run the translator on the command-line DEFEINEs
-	if(Flags.fOldLC3)
+	if(TheContext.Flags.fOldLC3)
 	{
 		for(list< pair<string, string> >::iterator DefineIter = DefineList.begin(); DefineIter != DefineList.end(); DefineIter++)
 		{
@@ -58,11 +58,11 @@ bool AssemblerUI(vector<Program *> &AsmPrograms, RamVector &MemoryImage)
 	}
 
 	//Initialize program list
-	for(i = 0; i < InputList.size(); i++)
+	for(i = 0; i < TheContext.InputList.size(); i++)
 	{
 		LocationVector LocationStack;
 		LocationStack.push_back( LocationVector::value_type(i, 0) );
-		AsmPrograms.push_back(new Program(LocationStack, InputList[i], LC3ISA::Addressability));
+		AsmPrograms.push_back(new Program(LocationStack, TheContext.InputList[i], LC3ISA::Addressability));
 	}
 	
 	//*** Perform Compilation ***
@@ -74,10 +74,10 @@ bool AssemblerUI(vector<Program *> &AsmPrograms, RamVector &MemoryImage)
 		//Open the assembly file
 		if(ToLower(AsmPrograms[i]->sFileName.Ext) == "obj" || ToLower(AsmPrograms[i]->sFileName.Ext) == "bin")
 		{
-			ifstream AsmFile(InputList[i].c_str(), ios::in | ios::binary);
+			ifstream AsmFile(TheContext.InputList[i].c_str(), ios::in | ios::binary);
 			if(!AsmFile.good())
 			{
-				sprintf(sMessageBuffer, "Unable to open file %.255s", InputList[i].c_str());
+				sprintf(sMessageBuffer, "Unable to open file %.255s", TheContext.InputList[i].c_str());
 				AsmCallBack(Fatal, sMessageBuffer, LocationVector());
 				fRetVal = false;
 				continue;
@@ -87,16 +87,16 @@ bool AssemblerUI(vector<Program *> &AsmPrograms, RamVector &MemoryImage)
 		}
 		else
 		{
-			ifstream AsmFile(InputList[i].c_str());
+			ifstream AsmFile(TheContext.InputList[i].c_str());
 			if(!AsmFile.good())
 			{
-				sprintf(sMessageBuffer, "Unable to open file %.255s", InputList[i].c_str());
+				sprintf(sMessageBuffer, "Unable to open file %.255s", TheContext.InputList[i].c_str());
 				AsmCallBack(Fatal, sMessageBuffer, LocationVector());
 				fRetVal = false;
 				continue;
 			}
-			string sAsm3FileName = InputList[i]+"3";
-			if(Flags.fOldLC3)
+			string sAsm3FileName = TheContext.InputList[i]+"3";
+			if(TheContext.Flags.fOldLC3)
 			{
 				ofstream Asm3File(sAsm3FileName.c_str());
 				if(!Asm3File.good())
@@ -138,7 +138,7 @@ bool AssemblerUI(vector<Program *> &AsmPrograms, RamVector &MemoryImage)
 	if(!fRetVal)
 		goto CleanUp;
 
-	if(Flags.fOutputVHDL)
+	if(TheContext.Flags.fOutputVHDL)
 	{
 		//Create output file name. If none is specified, the filename will be the same as
 		//the first input file except the extention is replaced with ".vhd"
@@ -160,7 +160,7 @@ bool AssemblerUI(vector<Program *> &AsmPrograms, RamVector &MemoryImage)
 	else
 		sOutputFileName = AsmPrograms[0]->sFileName.Path + AsmPrograms[0]->sFileName.Bare;
 	//Print VHDL to stdout
-	if(Flags.fStdout)
+	if(TheContext.Flags.fStdout)
 	{
 		cout << endl;
 		Assemble<LC3ISA>::VHDLWrite(cout, MemoryImage, AsmCallBack);
@@ -197,7 +197,7 @@ bool AsmCallBack(MessageEnum MessageType, const string &sMessage, const Location
 				continue;
 			else
 				LastLocation.clear();
-			sMsg << InputList[LocationStack[i].first].c_str() << "(" << LocationStack[i].second <<"):    Info:   From included file:\n";
+			sMsg << TheContext.InputList[LocationStack[i].first].c_str() << "(" << LocationStack[i].second <<"):    Info:   From included file:\n";
 		}
 		LastLocation = LocationStack;
 		StackLength = sMsg.pcount();
@@ -207,24 +207,24 @@ bool AsmCallBack(MessageEnum MessageType, const string &sMessage, const Location
 	{
 	case Info:
 		if(!LocationStack.empty())
-			sMsg << InputList[LocationStack[StackNumber].first].c_str() << "(" << LocationStack[StackNumber].second << "):    Info:   ";
+			sMsg << TheContext.InputList[LocationStack[StackNumber].first].c_str() << "(" << LocationStack[StackNumber].second << "):    Info:   ";
 		break;
 	case Warning:
 		Warnings++;
 		if(LocationStack.empty())
 			throw "Empty location stack for Warning!";
-		sMsg << InputList[LocationStack[StackNumber].first].c_str() << "(" << LocationStack[StackNumber].second << "): Warning:   ";
+		sMsg << TheContext.InputList[LocationStack[StackNumber].first].c_str() << "(" << LocationStack[StackNumber].second << "): Warning:   ";
 		break;
 	case Error:
 		Errors++;
 		if(LocationStack.empty())
 			throw "Empty location stack for Error!";
-		sMsg << InputList[LocationStack[StackNumber].first].c_str() << "(" << LocationStack[StackNumber].second << "):   Error:   ";
+		sMsg << TheContext.InputList[LocationStack[StackNumber].first].c_str() << "(" << LocationStack[StackNumber].second << "):   Error:   ";
 		break;
 	case Fatal:
 		Errors++;
 		if(!LocationStack.empty())
-			sMsg << InputList[LocationStack[StackNumber].first].c_str() << "(" << LocationStack[StackNumber].second << "):   ";
+			sMsg << TheContext.InputList[LocationStack[StackNumber].first].c_str() << "(" << LocationStack[StackNumber].second << "):   ";
 		sMsg << "Fatal:   ";
 		break;
 	}
@@ -25,7 +25,7 @@ namespace LC3
 
 		Returns true if it completed assembling successfully, else false.
 	\******/
-	bool AssemblerUI(vector<Program *> &, RamVector &);
+	bool AssemblerUI(vector<Program *> &, RamImage &);
 
 	/**************************************************************************\
 		AsmCallBack( [in] message type, [in] message, [in] location stack )
@@ -72,7 +72,7 @@ LC3ISA::Lexer::Lexer(list<Token *> &tokenlist, CallBackFunction, bool fcase) : A
 
 Token *LC3ISA::Lexer::LookUpInstruction(const LocationVector &LocationStack, const string &sKeyword, bool fPeek)
 {
-	if(fPeek && Flags.fOldLC3)
+	if(fPeek && TheContext.Flags.fOldLC3)
 	{
 		//Allow highlighting of old LC3 syntax
 		if(sKeyword == "orig" || sKeyword == "external" || sKeyword == "end")
@@ -863,10 +863,9 @@ void LC3ISA::AddInstr::AssignValues(vector<Number *>::iterator &StartIter, const
 	}
 }
 
-bool LC3ISA::AddInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3ISA::AddInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3Instruction Instr;
 
 	if(Address & 1)
@@ -899,13 +898,13 @@ bool LC3ISA::AddInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFun
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -933,13 +932,12 @@ unsigned int LC3ISA::AddInstr::GetDestinations(vector<RegisterEnum> &vReg) const
 
 LC3ISA::AddInstr::operator const char *() const
 {
-	static string sElem;
 	ostrstream strElement;
 
 	strElement << sOpcodes[Opcode] << "\t" << sRegisters[DR] << ", " << sRegisters[SR1] << ", " << (fUseImm ? (const char *)*pSImm5 : sRegisters[SR2]) << ends;
 
-	sElem = strElement.str();
-	return sElem.c_str();
+	TheContext.sElementText = strElement.str();
+	return TheContext.sElementText.c_str();
 }
 
 /******************************************************************************\
@@ -997,10 +995,9 @@ void LC3ISA::AndInstr::AssignValues(vector<Number *>::iterator &StartIter, const
 	}
 }
 
-bool LC3ISA::AndInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3ISA::AndInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3Instruction Instr;
 
 	if(Address & 1)
@@ -1033,13 +1030,13 @@ bool LC3ISA::AndInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFun
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -1067,13 +1064,12 @@ unsigned int LC3ISA::AndInstr::GetDestinations(vector<RegisterEnum> &vReg) const
 
 LC3ISA::AndInstr::operator const char *() const
 {
-	static string sElem;
 	ostrstream strElement;
 
 	strElement << sOpcodes[Opcode] << "\t" << sRegisters[DR] << ", " << sRegisters[SR1] << ", " << (fUseImm ? (const char *)*pSImm5 : sRegisters[SR2]) << ends;
 
-	sElem = strElement.str();
-	return sElem.c_str();
+	TheContext.sElementText = strElement.str();
+	return TheContext.sElementText.c_str();
 }
 
 /******************************************************************************\
@@ -1116,10 +1112,9 @@ void LC3ISA::BrInstr::AssignValues(vector<Number *>::iterator &StartIter, const
 	}
 }
 
-bool LC3ISA::BrInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3ISA::BrInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3Instruction Instr;
 
 	if(Address & 1)
@@ -1145,13 +1140,13 @@ bool LC3ISA::BrInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunc
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -1171,13 +1166,12 @@ bool LC3ISA::BrInstr::IsBranch() const
 
 LC3ISA::BrInstr::operator const char *() const
 {
-	static string sElem;
 	ostrstream strElement;
 
 	strElement << sOpcodes[Opcode] << "\t" << (const char *)*pSOffset9 << ends;
 
-	sElem = strElement.str();
-	return sElem.c_str();
+	TheContext.sElementText = strElement.str();
+	return TheContext.sElementText.c_str();
 }
 
 /******************************************************************************\
@@ -1218,10 +1212,9 @@ void LC3ISA::JsrInstr::AssignValues(vector<Number *>::iterator &StartIter, const
 	}
 }
 
-bool LC3ISA::JsrInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3ISA::JsrInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3Instruction Instr;
 
 	if(Address & 1)
@@ -1245,13 +1238,13 @@ bool LC3ISA::JsrInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFun
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -1271,13 +1264,12 @@ bool LC3ISA::JsrInstr::IsBranch() const
 
 LC3ISA::JsrInstr::operator const char *() const
 {
-	static string sElem;
 	ostrstream strElement;
 
 	strElement << sOpcodes[Opcode] << "\t" << (const char *)*pSOffset11 << ends;
 
-	sElem = strElement.str();
-	return sElem.c_str();
+	TheContext.sElementText = strElement.str();
+	return TheContext.sElementText.c_str();
 }
 
 /******************************************************************************\
@@ -1306,10 +1298,9 @@ void LC3ISA::JsrrInstr::AssignValues(vector<Number *>::iterator &StartIter, cons
 {
 }
 
-bool LC3ISA::JsrrInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3ISA::JsrrInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3Instruction Instr;
 
 	if(Address & 1)
@@ -1329,13 +1320,13 @@ bool LC3ISA::JsrrInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFu
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -1404,10 +1395,9 @@ void LC3ISA::TrapInstr::AssignValues(vector<Number *>::iterator &StartIter, cons
 	}
 }
 
-bool LC3ISA::TrapInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3ISA::TrapInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3Instruction Instr;
 
 	if(Address & 1)
@@ -1431,13 +1421,13 @@ bool LC3ISA::TrapInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFu
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -1462,13 +1452,12 @@ bool LC3ISA::TrapInstr::IsMemory() const
 
 LC3ISA::TrapInstr::operator const char *() const
 {
-	static string sElem;
 	ostrstream strElement;
 
 	strElement << sOpcodes[Opcode] << "\t" << (const char *)*pTrapVect8 << ends;
 
-	sElem = strElement.str();
-	return sElem.c_str();
+	TheContext.sElementText = strElement.str();
+	return TheContext.sElementText.c_str();
 }
 
 /******************************************************************************\
@@ -1497,10 +1486,9 @@ void LC3ISA::JmpInstr::AssignValues(vector<Number *>::iterator &StartIter, const
 {
 }
 
-bool LC3ISA::JmpInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3ISA::JmpInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3Instruction Instr;
 
 	if(Address & 1)
@@ -1519,13 +1507,13 @@ bool LC3ISA::JmpInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFun
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -1588,10 +1576,9 @@ void LC3ISA::LeaInstr::AssignValues(vector<Number *>::iterator &StartIter, const
 	}
 }
 
-bool LC3ISA::LeaInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3ISA::LeaInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3Instruction Instr;
 
 	if(Address & 1)
@@ -1615,13 +1602,13 @@ bool LC3ISA::LeaInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFun
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -1637,13 +1624,12 @@ unsigned int LC3ISA::LeaInstr::GetDestinations(vector<RegisterEnum> &vReg) const
 
 LC3ISA::LeaInstr::operator const char *() const
 {
-	static string sElem;
 	ostrstream strElement;
 
 	strElement << sOpcodes[Opcode] << "\t" << sRegisters[DR] << ", " << (const char *)*pSOffset9 << ends;
 
-	sElem = strElement.str();
-	return sElem.c_str();
+	TheContext.sElementText = strElement.str();
+	return TheContext.sElementText.c_str();
 }
 
 /******************************************************************************\
@@ -1687,10 +1673,9 @@ void LC3ISA::LdInstr::AssignValues(vector<Number *>::iterator &StartIter, const
 	}
 }
 
-bool LC3ISA::LdInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3ISA::LdInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3Instruction Instr;
 
 	if(Address & 1)
@@ -1714,13 +1699,13 @@ bool LC3ISA::LdInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunc
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -1747,13 +1732,12 @@ bool LC3ISA::LdInstr::IsMemory() const
 
 LC3ISA::LdInstr::operator const char *() const
 {
-	static string sElem;
 	ostrstream strElement;
 
 	strElement << sOpcodes[Opcode] << "\t" << sRegisters[DR] << ", " << (const char *)*pSOffset9 << ends;
 
-	sElem = strElement.str();
-	return sElem.c_str();
+	TheContext.sElementText = strElement.str();
+	return TheContext.sElementText.c_str();
 }
 
 /******************************************************************************\
@@ -1796,10 +1780,9 @@ void LC3ISA::LdrInstr::AssignValues(vector<Number *>::iterator &StartIter, const
 	}
 }
 
-bool LC3ISA::LdrInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3ISA::LdrInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3Instruction Instr;
 
 	if(Address & 1)
@@ -1824,13 +1807,13 @@ bool LC3ISA::LdrInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFun
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -1858,13 +1841,12 @@ bool LC3ISA::LdrInstr::IsMemory() const
 
 LC3ISA::LdrInstr::operator const char *() const
 {
-	static string sElem;
 	ostrstream strElement;
 
 	strElement << sOpcodes[Opcode] << "\t" << sRegisters[DR] << ", " << sRegisters[BaseR] << ", " << (const char *)*pSOffset6 << ends;
 
-	sElem = strElement.str();
-	return sElem.c_str();
+	TheContext.sElementText = strElement.str();
+	return TheContext.sElementText.c_str();
 }
 
 /******************************************************************************\
@@ -1908,10 +1890,9 @@ void LC3ISA::StInstr::AssignValues(vector<Number *>::iterator &StartIter, const
 	}
 }
 
-bool LC3ISA::StInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3ISA::StInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3Instruction Instr;
 
 	if(Address & 1)
@@ -1935,13 +1916,13 @@ bool LC3ISA::StInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunc
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -1961,13 +1942,12 @@ bool LC3ISA::StInstr::IsMemory() const
 
 LC3ISA::StInstr::operator const char *() const
 {
-	static string sElem;
 	ostrstream strElement;
 
 	strElement << sOpcodes[Opcode] << "\t" << sRegisters[SR] << ", " << (const char *)*pSOffset9 << ends;
 
-	sElem = strElement.str();
-	return sElem.c_str();
+	TheContext.sElementText = strElement.str();
+	return TheContext.sElementText.c_str();
 }
 
 /******************************************************************************\
@@ -2010,10 +1990,9 @@ void LC3ISA::StrInstr::AssignValues(vector<Number *>::iterator &StartIter, const
 	}
 }
 
-bool LC3ISA::StrInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3ISA::StrInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3Instruction Instr;
 
 	if(Address & 1)
@@ -2038,13 +2017,13 @@ bool LC3ISA::StrInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFun
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -2065,13 +2044,12 @@ bool LC3ISA::StrInstr::IsMemory() const
 
 LC3ISA::StrInstr::operator const char *() const
 {
-	static string sElem;
 	ostrstream strElement;
 
 	strElement << sOpcodes[Opcode] << "\t" << sRegisters[SR] << ", " << sRegisters[BaseR] << ", " << (const char *)*pSOffset6 << ends;
 
-	sElem = strElement.str();
-	return sElem.c_str();
+	TheContext.sElementText = strElement.str();
+	return TheContext.sElementText.c_str();
 }
 
 /******************************************************************************\
@@ -2097,10 +2075,9 @@ void LC3ISA::NotInstr::AssignValues(vector<Number *>::iterator &StartIter, const
 {
 }
 
-bool LC3ISA::NotInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3ISA::NotInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3Instruction Instr;
 
 	if(Address & 1)
@@ -2119,13 +2096,13 @@ bool LC3ISA::NotInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFun
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -2173,10 +2150,9 @@ void LC3ISA::RetInstr::AssignValues(vector<Number *>::iterator &StartIter, const
 {
 }
 
-bool LC3ISA::RetInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3ISA::RetInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3Instruction Instr;
 
 	if(Address & 1)
@@ -2195,13 +2171,13 @@ bool LC3ISA::RetInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFun
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -2246,10 +2222,9 @@ void LC3ISA::RtiInstr::AssignValues(vector<Number *>::iterator &StartIter, const
 {
 }
 
-bool LC3ISA::RtiInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3ISA::RtiInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3Instruction Instr;
 
 	if(Address & 1)
@@ -2266,13 +2241,13 @@ bool LC3ISA::RtiInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFun
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -2330,10 +2305,9 @@ void LC3ISA::NopInstr::AssignValues(vector<Number *>::iterator &StartIter, const
 {
 }
 
-bool LC3ISA::NopInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3ISA::NopInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3Instruction Instr;
 
 	if(Address & 1)
@@ -2349,13 +2323,13 @@ bool LC3ISA::NopInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFun
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -234,7 +234,7 @@ namespace LC3
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetSources(vector<RegisterEnum> &) const;
 			virtual unsigned int GetDestinations(vector<RegisterEnum> &) const;
 			virtual operator const char *() const;
@@ -260,7 +260,7 @@ namespace LC3
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetSources(vector<RegisterEnum> &) const;
 			virtual unsigned int GetDestinations(vector<RegisterEnum> &) const;
 			virtual operator const char *() const;
@@ -282,7 +282,7 @@ namespace LC3
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetSources(vector<RegisterEnum> &) const;
 			virtual bool IsBranch() const;
 			virtual operator const char *() const;
@@ -304,7 +304,7 @@ namespace LC3
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetDestinations(vector<RegisterEnum> &) const;
 			virtual bool IsBranch() const;
 			virtual operator const char *() const;
@@ -325,7 +325,7 @@ namespace LC3
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetDestinations(vector<RegisterEnum> &) const;
 			virtual unsigned int GetSources(vector<RegisterEnum> &) const;
 			virtual bool IsBranch() const;
@@ -348,7 +348,7 @@ namespace LC3
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetDestinations(vector<RegisterEnum> &) const;
 			virtual bool IsBranch() const;
 			virtual bool IsMemory() const;
@@ -370,7 +370,7 @@ namespace LC3
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetSources(vector<RegisterEnum> &vReg) const;
 			virtual bool IsBranch() const;
 			virtual operator const char *() const;
@@ -393,7 +393,7 @@ namespace LC3
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetDestinations(vector<RegisterEnum> &) const;
 			virtual operator const char *() const;
 		};
@@ -416,7 +416,7 @@ namespace LC3
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetSources(vector<RegisterEnum> &) const;
 			virtual unsigned int GetDestinations(vector<RegisterEnum> &) const;
 			virtual bool IsMemory() const;
@@ -441,7 +441,7 @@ namespace LC3
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetSources(vector<RegisterEnum> &) const;
 			virtual unsigned int GetDestinations(vector<RegisterEnum> &) const;
 			virtual bool IsMemory() const;
@@ -466,7 +466,7 @@ namespace LC3
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetSources(vector<RegisterEnum> &) const;
 			virtual bool IsMemory() const;
 			virtual operator const char *() const;
@@ -490,7 +490,7 @@ namespace LC3
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetSources(vector<RegisterEnum> &) const;
 			virtual bool IsMemory() const;
 			virtual operator const char *() const;
@@ -510,7 +510,7 @@ namespace LC3
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetSources(vector<RegisterEnum> &) const;
 			virtual unsigned int GetDestinations(vector<RegisterEnum> &) const;
 			virtual operator const char *() const;
@@ -528,7 +528,7 @@ namespace LC3
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetSources(vector<RegisterEnum> &) const;
 			virtual bool IsBranch() const;
 			virtual operator const char *() const;
@@ -546,7 +546,7 @@ namespace LC3
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetSources(vector<RegisterEnum> &) const;
 			virtual unsigned int GetDestinations(vector<RegisterEnum> &) const;
 			virtual bool IsBranch() const;
@@ -566,7 +566,7 @@ namespace LC3
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual operator const char *() const;
 		};
 
@@ -35,7 +35,7 @@ int main(int argc, char* argv[])
 		//This will hold the symbolic form of the program.
 		vector<Program *> AsmPrograms;
 		//This will hold the memory image of the program
-		RamVector MemoryImage;
+		RamImage MemoryImage;
 
 		AssemblerUI(AsmPrograms, MemoryImage);
 
@@ -78,7 +78,7 @@ void PrintUsage()
 
 bool ProcessArgs(int argc, char* argv[])
 {
-	Flags.fOldLC3 = true;
+	TheContext.Flags.fOldLC3 = true;
 	for(int i = 1; i < argc; i++)
 	{
 		if(argv[i][0] == '-')
@@ -86,27 +86,27 @@ bool ProcessArgs(int argc, char* argv[])
 			switch(argv[i][1])
 			{
 			case '3':
-				if(!Flags.fOldLC3)
+				if(!TheContext.Flags.fOldLC3)
 					cout << "Warning:   -3 specified more than once.";
-				Flags.fOldLC3 = false;
+				TheContext.Flags.fOldLC3 = false;
 				break;
 			case 'a':
 			case 'A':
-				if(Flags.fPrintAST)
+				if(TheContext.Flags.fPrintAST)
 					cout << "Warning:   -a specified more than once.";
-				Flags.fPrintAST = true;
+				TheContext.Flags.fPrintAST = true;
 				break;
 			case 'b':
 			case 'B':
-				if(Flags.fOutputImage)
+				if(TheContext.Flags.fOutputImage)
 					cout << "Warning:   -d specified more than once.";
-				Flags.fOutputImage = true;
+				TheContext.Flags.fOutputImage = true;
 				break;
 			case 'c':
 			case 'C':
-				if(Flags.fStdout)
+				if(TheContext.Flags.fStdout)
 					cout << "Warning:   -c specified more than once.";
-				Flags.fStdout = true;
+				TheContext.Flags.fStdout = true;
 				break;
 			case 'd':
 			case 'D':
@@ -133,27 +133,27 @@ bool ProcessArgs(int argc, char* argv[])
 				break;
 			case 'o':
 			case 'O':
-				if(Flags.fUseOptimizations)
+				if(TheContext.Flags.fUseOptimizations)
 					cout << "Warning:   -o specified more than once.";
-				Flags.fUseOptimizations = true;
+				TheContext.Flags.fUseOptimizations = true;
 				break;
 			case 's':
 			case 'S':
-				if(Flags.fPrintSymbols)
+				if(TheContext.Flags.fPrintSymbols)
 					cout << "Warning:   -s specified more than once.";
-				Flags.fPrintSymbols = true;
+				TheContext.Flags.fPrintSymbols = true;
 				break;
 			case 't':
 			case 'T':
-				if(Flags.fPrintTokens)
+				if(TheContext.Flags.fPrintTokens)
 					cout << "Warning:   -t specified more than once.";
-				Flags.fPrintTokens = true;
+				TheContext.Flags.fPrintTokens = true;
 				break;
 			case 'v':
 			case 'V':
-				if(Flags.fOutputVHDL)
+				if(TheContext.Flags.fOutputVHDL)
 					cout << "Warning:   -v specified more than once.";
-				Flags.fOutputVHDL = true;
+				TheContext.Flags.fOutputVHDL = true;
 				if(i + 1 < argc && argv[i+1][0] != '-')
 				{
 					sOutputFileName = argv[++i];
@@ -162,9 +162,9 @@ bool ProcessArgs(int argc, char* argv[])
 				break;
 			case 'w':
 			case 'W':
-				if(Flags.fConsoleWidth)
+				if(TheContext.Flags.fConsoleWidth)
 					cout << "Warning:   -w specified more than once.";
-				Flags.fConsoleWidth = true;
+				TheContext.Flags.fConsoleWidth = true;
 				if(i + 1 < argc && argv[i+1][0] != '-')
 				{
 					i++;
@@ -189,9 +189,9 @@ bool ProcessArgs(int argc, char* argv[])
 			continue;
 		}
 		//Store the filename
-		InputList.push_back(CreateStandardPath(argv[i]));
+		TheContext.InputList.push_back(CreateStandardPath(argv[i]));
 	}
-	if(InputList.empty())
+	if(TheContext.InputList.empty())
 	{
 		cout << "Error: No input files specified.\n\n";
 		return false;
@@ -0,0 +1,503 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#pragma warning (disable:4786)
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <new.h>
+#include "../LC3Assembler/AsmUI.h"
+#include "../LC3Assembler/LC3ISA.h"
+#include "../LC3Simulator/LC3Arch.h"
+#include "../Simulator/Simulator.h"
+
+using namespace std;
+using namespace JMT;
+using namespace Simulator;
+using namespace LC3;
+
+//The program is run once against each input file. Each run is a job.
+struct Job
+{
+	string sInputFile;
+	//Characters for the program to read, and how many it has read
+	string sInput;
+	size_t InputPosition;
+	//Characters the program wrote
+	string sOutput;
+	//How the run ended, and the last error or exception message
+	string sStatus, sMessage;
+	uint64 Cycles, Instructions;
+	//true if the run reported a breakpoint
+	bool fBreakpoint;
+};
+
+//A thread with its own simulator, and the jobs it has not started yet
+struct Worker
+{
+	ArchSim<LC3ISA> *pSim;
+	LC3Arch *pArch;
+	//The machine control register. The program halts by stopping the clock.
+	Register *pMCR;
+	//The next job in the low 32 bits and the end of the jobs in the high 32
+	//bits. Only changed with ATOMIC_COMPARE_EXCHANGE, since other workers
+	//steal from the end, and only read with ATOMIC_LOAD.
+	volatile uint64 Range;
+	THREAD_TYPE Thread;
+};
+
+void PrintUsage();
+bool ProcessArgs(int, char**);
+int NewHandler(unsigned int);
+bool BatchCallBack(MessageEnum, const string &);
+bool BatchMessageCallBack(MessageEnum, const string &, const LocationVector &);
+bool BatchCommand(string &);
+bool BatchReadConsole(string &, unsigned int, unsigned int &);
+bool BatchWriteConsole(const string &, unsigned int, unsigned int &);
+THREAD_FUNCTION(WorkerThread, pParam);
+
+vector<Job> Jobs;
+vector<Worker> Workers;
+//Cycles each job may run before it is stopped
+uint64 CycleLimit = 10000000;
+//Threads to run, or 0 for one per processor
+unsigned int ThreadCount = 0;
+//Engine the simulators run
+string sEngine = "block";
+//Directory each job's output is saved to, or empty to not save it
+string sOutputDir;
+//The job the current thread is running, for the console callbacks
+THREAD_LOCAL Job *pCurrentJob = NULL;
+//Set once Ctrl-C has stopped a job, so that no more jobs are started
+volatile bool fStopping = false;
+
+int main(int argc, char* argv[])
+{
+#if defined _MSC_VER
+	_set_new_handler(NewHandler);
+#endif
+
+	try
+	{
+		sProgramDir = CreateStandardPath(FileName(argv[0]).Path);
+		if(!ProcessArgs(argc, argv))
+		{
+			PrintUsage();
+			return 0;
+		}
+		TheContext.Flags.fSimulate = true;
+
+		//The program is assembled once and shared, read-only, by every job.
+		//The assembler's messages go to stderr, so that stdout only has the
+		//summary.
+		vector<Program *> AsmPrograms;
+		RamImage MemoryImage;
+		streambuf *pCoutBuffer = cout.rdbuf(cerr.rdbuf());
+		bool fAssembled = AssemblerUI(AsmPrograms, MemoryImage);
+		cout.rdbuf(pCoutBuffer);
+		if(!fAssembled || !TheContext.Flags.fSimulate)
+			return -1;
+
+		if(!ThreadCount)
+			PROCESSOR_COUNT(ThreadCount)
+		if(ThreadCount > Jobs.size())
+			ThreadCount = Jobs.size();
+		if(ThreadCount < 1)
+			ThreadCount = 1;
+
+		//Each worker keeps one simulator for all of its jobs. Resetting it
+		//restores the state after the program was loaded, instead of
+		//loading it again.
+		Workers.resize(ThreadCount);
+		for(unsigned int i = 0; i < ThreadCount; i++)
+		{
+			Worker &TheWorker = Workers[i];
+			TheWorker.pSim = new ArchSim<LC3ISA>(BatchMessageCallBack, BatchCallBack, BatchCommand, BatchReadConsole, BatchWriteConsole);
+			TheWorker.pArch = new LC3Arch(*TheWorker.pSim);
+			unsigned int Engine;
+			for(Engine = 0; Engine < TheWorker.pArch->Engines.size(); Engine++)
+				if(TheWorker.pArch->Engines[Engine] == sEngine)
+					break;
+			if(Engine == TheWorker.pArch->Engines.size())
+			{
+				cerr << "Error:   " << sEngine << " is not an engine of the LC-3 simulator." << endl;
+				return -1;
+			}
+			TheWorker.pArch->Engine = Engine;
+			if(!TheWorker.pSim->Reset(*TheWorker.pArch, AsmPrograms, MemoryImage))
+			{
+				cerr << "Error:   Unable to initialize the simulator." << endl;
+				return -1;
+			}
+			TheWorker.pMCR = &TheWorker.pArch->RegisterSets.find("mmio")->second["mcr"];
+
+			//Start with an even share of the jobs
+			uint64 Begin = (uint64)Jobs.size() * i / ThreadCount, End = (uint64)Jobs.size() * (i + 1) / ThreadCount;
+			TheWorker.Range = Begin | End << 32;
+		}
+
+		for(unsigned int i = 0; i < ThreadCount; i++)
+			THREAD_CREATE(Workers[i].Thread, WorkerThread, (void *)(size_t)i)
+		for(unsigned int i = 0; i < ThreadCount; i++)
+			THREAD_JOIN(Workers[i].Thread)
+
+		//Summary, in the order the inputs were given
+		char sBuffer[128];
+		unsigned int Halted = 0;
+		cout << "Input\tStatus\tCycles\tInstructions\tOutputHash\tMessage\n";
+		for(vector<Job>::iterator JobIter = Jobs.begin(); JobIter != Jobs.end(); JobIter++)
+		{
+			//64 bit FNV-1a hash of the output
+			uint64 Hash = 0xCBF29CE484222325ULL;
+			for(string::size_type i = 0; i < JobIter->sOutput.size(); i++)
+				Hash = (Hash ^ (unsigned char)JobIter->sOutput[i]) * 0x100000001B3ULL;
+			#if defined _MSC_VER
+				sprintf(sBuffer, "\t%.15s\t%I64u\t%I64u\t%016I64X\t", JobIter->sStatus.c_str(), JobIter->Cycles, JobIter->Instructions, Hash);
+			#elif defined GPLUSPLUS
+				sprintf(sBuffer, "\t%.15s\t%llu\t%llu\t%016llX\t", JobIter->sStatus.c_str(), JobIter->Cycles, JobIter->Instructions, Hash);
+			#else
+				#error "Only MSVC and GCC Compilers Supported"
+			#endif
+			cout << JobIter->sInputFile << sBuffer << JobIter->sMessage << "\n";
+			if(JobIter->sStatus == "halted")
+				Halted++;
+		}
+		cout.flush();
+		cerr << Jobs.size() << " job" << (Jobs.size() != 1 ? "s" : "") << " on " << ThreadCount << " thread" << (ThreadCount != 1 ? "s" : "") << ", " << Halted << " halted." << endl;
+
+		for(unsigned int i = 0; i < ThreadCount; i++)
+		{
+			delete Workers[i].pArch;
+			delete Workers[i].pSim;
+		}
+		for(unsigned int i = 0; i < AsmPrograms.size(); i++)
+			delete AsmPrograms[i];
+	}
+	catch(const char *sMsg)
+	{	//*NOTE: MSVC allows "char", but GCC requires "const"
+		printf("***An unexpected problem has occured.\nPlease e-mail the following error message, along with all input command line\noptions and files to the current maintainer, and the bug will be assessed:\n***Fatal:   %s\n", sMsg);
+		fflush(NULL);
+		exit(-1);
+	}
+	catch(runtime_error e)
+	{
+		printf("***An unexpected problem has occured.\nPlease e-mail the following error message, along with all input command line\noptions and files to the current maintainer, and the bug will be assessed:\n***Fatal:   %s\n", e.what());
+		fflush(NULL);
+		exit(-1);
+	}
+
+	return 0;
+}
+
+void PrintUsage()
+{
+	cout << "\n\t\tLC-3 Batch Simulator " << SIM_VER << ", Ashley Wise\n\n";
+	cout << "Give assembly file names as parameters, then -i and the input files.\n";
+	cout << "The program is assembled once and run once for each input file, which\n";
+	cout << "it reads as its console input. A summary line is printed for each run.\n";
+	cout << "Ctrl-C stops the runs in progress and skips the rest.\n";
+	cout << "   -3            Disable support for older LC-3 syntax\n";
+	cout << "   -c Cycles     Stop each run after this many cycles (default 10000000)\n";
+	cout << "   -e Engine     Simulate with pipeline, threaded, block (default) or jit\n";
+	cout << "   -h or -?      Prints this help\n";
+	cout << "   -i Files      Every file name after -i is an input file\n";
+	cout << "   -j Threads    Number of runs at once (default one per processor)\n";
+	cout << "   -o Directory  Saves each run's output to Directory/InputName.out\n";
+	cout << "   -os           Use Ash Operating System.\n\n";
+}
+
+bool ProcessArgs(int argc, char* argv[])
+{
+	TheContext.Flags.fOldLC3 = true;
+	bool fInputs = false;
+	for(int i = 1; i < argc; i++)
+	{
+		if(argv[i][0] == '-' && !fInputs)
+		{
+			switch(argv[i][1])
+			{
+			case '3':
+				if(!TheContext.Flags.fOldLC3)
+					cout << "Warning:   -3 specified more than once.";
+				TheContext.Flags.fOldLC3 = false;
+				break;
+			case 'c':
+			case 'C':
+				if(i + 1 >= argc || !(CycleLimit = strtoul(argv[i+1], NULL, 10)))
+				{
+					cout << "Error:   -c must be followed by a number of cycles." << endl << endl;
+					return false;
+				}
+				i++;
+				break;
+			case 'e':
+			case 'E':
+				if(i + 1 >= argc)
+				{
+					cout << "Error:   -e must be followed by an engine name." << endl << endl;
+					return false;
+				}
+				sEngine = ToLower(argv[++i]);
+				break;
+			case 'i':
+			case 'I':
+				fInputs = true;
+				break;
+			case 'j':
+			case 'J':
+				if(i + 1 >= argc || !(ThreadCount = atoi(argv[i+1])))
+				{
+					cout << "Error:   -j must be followed by a number of threads." << endl << endl;
+					return false;
+				}
+				i++;
+				break;
+			case 'o':
+			case 'O':
+				if(argv[i][2] == 's' || argv[i][2] == 'S')
+				{
+					if(TheContext.Flags.fUseOS)
+						cout << "Warning:   -os specified more than once.";
+					FileName sOSLocation(sProgramDir + "AshOS_LC3.asm");
+					ifstream OSFile(sOSLocation.Full.c_str());
+					if(!OSFile.good())
+					{
+						cout << "Error:   The LC-3 Ash Operating System was not found at " << sOSLocation.Full << endl << endl;
+						return false;
+					}
+					TheContext.InputList.push_back(sOSLocation.Full);
+					TheContext.Flags.fUseOS = true;
+				}
+				else
+				{
+					if(i + 1 >= argc)
+					{
+						cout << "Error:   -o must be followed by a directory." << endl << endl;
+						return false;
+					}
+					sOutputDir = CreateStandardPath(argv[++i]);
+					if(!sOutputDir.empty() && sOutputDir[sOutputDir.size() - 1] != '/')
+						sOutputDir += '/';
+				}
+				break;
+			case '?':
+			case 'h':
+			case 'H':
+			default:
+				return false;
+			}
+			continue;
+		}
+
+		if(fInputs)
+		{
+			Jobs.push_back(Job());
+			Jobs.back().sInputFile = argv[i];
+			//Until it is run
+			Jobs.back().sStatus = "skipped";
+			Jobs.back().Cycles = Jobs.back().Instructions = 0;
+		}
+		else
+			TheContext.InputList.push_back(CreateStandardPath(argv[i]));
+	}
+	if(TheContext.InputList.empty() || Jobs.empty())
+	{
+		cout << "Error: No assembly or input files specified.\n\n";
+		return false;
+	}
+	if(Jobs.size() > 0xFFFFFFFF)
+	{
+		cout << "Error: Too many input files.\n\n";
+		return false;
+	}
+
+	return true;
+}
+
+int NewHandler(unsigned int Size)
+{
+	throw "Out of memory!";
+}
+
+/******************************************************************************\
+	TakeJob( [in-out] worker, [out] job index )
+
+	Takes the next job from the worker's own jobs. Returns false if it has
+	none left.
+\******************************************************************************/
+static bool TakeJob(Worker &TheWorker, size_t &JobIndex)
+{
+	while(true)
+	{
+		uint64 Range = ATOMIC_LOAD(TheWorker.Range), Next = Range & 0xFFFFFFFF, End = Range >> 32;
+		if(Next == End)
+			return false;
+		if(ATOMIC_COMPARE_EXCHANGE(TheWorker.Range, (Next + 1) | End << 32, Range) == Range)
+		{
+			JobIndex = (size_t)Next;
+			return true;
+		}
+	}
+}
+
+/******************************************************************************\
+	StealJobs( [in] index of the worker with no jobs left )
+
+	Moves the last half of the first other worker with jobs left to this
+	worker. Returns false if no other worker has any jobs left.
+
+	A non-empty range can never be seen twice, since each of its jobs is
+	only ever in one range and is removed when it is taken. So a stale
+	range can't be mistaken for a current one by the compare-exchange.
+\******************************************************************************/
+static bool StealJobs(unsigned int WorkerIndex)
+{
+	for(unsigned int i = 1; i < Workers.size(); i++)
+	{
+		Worker &Victim = Workers[(WorkerIndex + i) % Workers.size()];
+		while(true)
+		{
+			uint64 Range = ATOMIC_LOAD(Victim.Range), Next = Range & 0xFFFFFFFF, End = Range >> 32;
+			if(Next == End)
+				break;
+			uint64 Middle = End - (End - Next + 1) / 2;
+			if(ATOMIC_COMPARE_EXCHANGE(Victim.Range, Next | Middle << 32, Range) == Range)
+			{
+				//Only this worker changes its own range while it is empty,
+				//but the exchange keeps the 64 bit store whole on 32 bit systems
+				Worker &Thief = Workers[WorkerIndex];
+				uint64 Empty = ATOMIC_LOAD(Thief.Range);
+				ATOMIC_COMPARE_EXCHANGE(Thief.Range, Middle | End << 32, Empty);
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+/******************************************************************************\
+	RunJob( [in-out] worker, [in-out] job )
+
+	Runs the program from the start with the job's input until it halts,
+	stops with an exception or error, reaches the cycle limit, or is stopped
+	by Ctrl-C.
+\******************************************************************************/
+static void RunJob(Worker &TheWorker, Job &TheJob)
+{
+	ArchSim<LC3ISA> &TheSim = *TheWorker.pSim;
+	TheJob.InputPosition = 0;
+	TheJob.Cycles = 0;
+	TheJob.Instructions = 0;
+	TheJob.fBreakpoint = false;
+
+	ifstream InputFile(TheJob.sInputFile.c_str(), ios::in | ios::binary);
+	if(!InputFile.good())
+	{
+		TheJob.sStatus = "error";
+		TheJob.sMessage = "Unable to open the input file.";
+		return;
+	}
+	ostringstream strInput;
+	strInput << InputFile.rdbuf();
+	TheJob.sInput = strInput.str();
+
+	pCurrentJob = &TheJob;
+	if(!TheSim.Reset())
+		TheJob.sStatus = "error";
+	else
+	{
+		TheSim.BreakCycle = CycleLimit;
+		TheSim.fBreak = false;
+		if(!TheSim.RunBatch(CycleLimit))
+			TheJob.sStatus = "error";
+		else if(!(*TheWorker.pMCR)[15])
+			TheJob.sStatus = "halted";
+		else if(TheSim.SimCycle >= CycleLimit)
+			TheJob.sStatus = "limit";
+		else if(TheJob.fBreakpoint && TheJob.sMessage.empty())
+		{
+			//Only Ctrl-C breaks a job short of the cycle limit
+			TheJob.sStatus = "stopped";
+			fStopping = true;
+		}
+		else
+			TheJob.sStatus = "exception";
+		TheJob.Cycles = TheSim.SimCycle;
+		TheJob.Instructions = TheSim.SimInstruction;
+	}
+	pCurrentJob = NULL;
+	//The clock stopping is how a program halts, not an exception
+	if(TheJob.sStatus == "halted")
+		TheJob.sMessage = "";
+	string().swap(TheJob.sInput);
+
+	if(!sOutputDir.empty())
+	{
+		string sOutputFile = sOutputDir + FileName(CreateStandardPath(TheJob.sInputFile)).Name + ".out";
+		ofstream OutputFile(sOutputFile.c_str(), ios::out | ios::binary | ios::trunc);
+		OutputFile.write(TheJob.sOutput.data(), TheJob.sOutput.size());
+		if(!OutputFile.good())
+			TheJob.sMessage = "Unable to save the output to " + sOutputFile + ". " + TheJob.sMessage;
+	}
+}
+
+THREAD_FUNCTION(WorkerThread, pParam)
+{
+	unsigned int WorkerIndex = (unsigned int)(size_t)pParam;
+	size_t JobIndex;
+	//The simulators print instructions and numbers, so each worker needs
+	//a context of its own
+	Context WorkerContext = DefaultContext;
+	SetContext(&WorkerContext);
+	while(!fStopping)
+	{
+		if(TakeJob(Workers[WorkerIndex], JobIndex))
+			RunJob(Workers[WorkerIndex], Jobs[JobIndex]);
+		else if(!StealJobs(WorkerIndex))
+			break;
+	}
+	return 0;
+}
+
+bool BatchCallBack(MessageEnum MessageType, const string &sMessage)
+{
+	//Keep the reason a job stopped for its summary line
+	if(pCurrentJob && (MessageType == Error || MessageType == Fatal || MessageType == JMT::Exception))
+		pCurrentJob->sMessage = sMessage;
+	else if(pCurrentJob && MessageType == Breakpoint)
+		pCurrentJob->fBreakpoint = true;
+	return true;
+}
+
+bool BatchMessageCallBack(MessageEnum MessageType, const string &sMessage, const LocationVector &)
+{
+	return BatchCallBack(MessageType, sMessage);
+}
+
+bool BatchCommand(string &)
+{
+	//Jobs are run without the command prompt
+	return false;
+}
+
+bool BatchReadConsole(string &sBuffer, unsigned int CharsToRead, unsigned int &CharsRead)
+{
+	Job &TheJob = *pCurrentJob;
+	sBuffer = TheJob.sInput.substr(MIN(TheJob.InputPosition, TheJob.sInput.size()), CharsToRead);
+	CharsRead = sBuffer.size();
+	TheJob.InputPosition += CharsRead;
+	//Running out of input is the same as end of input on the console
+	return CharsRead == CharsToRead;
+}
+
+bool BatchWriteConsole(const string &sBuffer, unsigned int CharsToWrite, unsigned int &CharsWritten)
+{
+	CharsWritten = MIN(CharsToWrite, sBuffer.size());
+	pCurrentJob->sOutput.append(sBuffer, 0, CharsWritten);
+	return true;
+}
@@ -0,0 +1,452 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#pragma warning (disable:4786)
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <new.h>
+#include "../LC3Assembler/AsmUI.h"
+#include "../LC3Assembler/LC3ISA.h"
+#include "../LC3Simulator/LC3Arch.h"
+#include "../Simulator/Simulator.h"
+
+using namespace std;
+using namespace JMT;
+using namespace Simulator;
+using namespace LC3;
+
+//One core of the system, with its own simulator
+struct Core
+{
+	ArchSim<LC3ISA> *pSim;
+	LC3Arch *pArch;
+	//The machine control register. The core halts by stopping the clock.
+	Register *pMCR;
+	//How the core stopped, and the last error or exception message
+	string sStatus, sMessage;
+	//true if the core reported a breakpoint
+	bool fBreakpoint;
+	//true once the core has stopped
+	bool fDone;
+	THREAD_TYPE Thread;
+};
+
+void PrintUsage();
+bool ProcessArgs(int, char**);
+int NewHandler(unsigned int);
+bool MultiCallBack(MessageEnum, const string &);
+bool MultiMessageCallBack(MessageEnum, const string &, const LocationVector &);
+bool MultiCommand(string &);
+bool MultiReadConsole(string &, unsigned int, unsigned int &);
+bool MultiWriteConsole(const string &, unsigned int, unsigned int &);
+static void RunCore(Core &, uint64);
+THREAD_FUNCTION(CoreThread, pParam);
+
+vector<Core> Cores;
+LC3System System;
+//Cores to simulate, or 0 for one per processor
+unsigned int CoreCount = 0;
+//Cycles each core may run before it is stopped
+uint64 CycleLimit = 10000000;
+//Cycles in each core's turn, or 0 to run every core on its own thread
+uint64 Quantum = 0;
+//Engine the simulators run
+string sEngine = "block";
+//File read as console input, or empty for none
+string sInputFile;
+//Characters for the cores to read, and how many they have read
+string sInput;
+size_t InputPosition = 0;
+//Guards the console, which every core shares
+volatile uint64 ConsoleLock = 0;
+//The core the current thread is running, for the callbacks
+THREAD_LOCAL Core *pCurrentCore = NULL;
+
+int main(int argc, char* argv[])
+{
+#if defined _MSC_VER
+	_set_new_handler(NewHandler);
+#endif
+
+	try
+	{
+		sProgramDir = CreateStandardPath(FileName(argv[0]).Path);
+		if(!ProcessArgs(argc, argv))
+		{
+			PrintUsage();
+			return 0;
+		}
+		TheContext.Flags.fSimulate = true;
+
+		//stdout is the system's console, so the assembler's messages go to
+		//stderr
+		vector<Program *> AsmPrograms;
+		RamImage MemoryImage;
+		streambuf *pCoutBuffer = cout.rdbuf(cerr.rdbuf());
+		bool fAssembled = AssemblerUI(AsmPrograms, MemoryImage);
+		cout.rdbuf(pCoutBuffer);
+		if(!fAssembled || !TheContext.Flags.fSimulate)
+			return -1;
+
+		if(!sInputFile.empty())
+		{
+			ifstream InputFile(sInputFile.c_str(), ios::in | ios::binary);
+			if(!InputFile.good())
+			{
+				cerr << "Error:   Unable to open the input file " << sInputFile << endl;
+				return -1;
+			}
+			ostringstream strInput;
+			strInput << InputFile.rdbuf();
+			sInput = strInput.str();
+		}
+
+		if(!CoreCount)
+			PROCESSOR_COUNT(CoreCount)
+		if(CoreCount < 1)
+			CoreCount = 1;
+
+		//Every core loads the program, then joins the system, which keeps
+		//the first core's memory
+		Cores.resize(CoreCount);
+		for(unsigned int i = 0; i < CoreCount; i++)
+		{
+			Core &TheCore = Cores[i];
+			TheCore.pSim = new ArchSim<LC3ISA>(MultiMessageCallBack, MultiCallBack, MultiCommand, MultiReadConsole, MultiWriteConsole);
+			TheCore.pArch = new LC3Arch(*TheCore.pSim);
+			unsigned int Engine;
+			for(Engine = 0; Engine < TheCore.pArch->Engines.size(); Engine++)
+				if(TheCore.pArch->Engines[Engine] == sEngine)
+					break;
+			if(Engine == TheCore.pArch->Engines.size())
+			{
+				cerr << "Error:   " << sEngine << " is not an engine of the LC-3 simulator." << endl;
+				return -1;
+			}
+			TheCore.pArch->Engine = Engine;
+			if(!TheCore.pSim->Reset(*TheCore.pArch, AsmPrograms, MemoryImage))
+			{
+				cerr << "Error:   Unable to initialize the simulator." << endl;
+				return -1;
+			}
+			TheCore.pArch->JoinSystem(System);
+			TheCore.pMCR = &TheCore.pArch->RegisterSets.find("mmio")->second["mcr"];
+			TheCore.pSim->BreakCycle = CycleLimit;
+			TheCore.pSim->fBreak = false;
+			TheCore.fBreakpoint = false;
+			TheCore.fDone = false;
+		}
+
+		//Keep the Ctrl-C handler installed between turns
+		PauseFlag Stop;
+		Stop.Arm();
+		if(Quantum)
+		{
+			//The cores take turns on this thread in a fixed order, so a run
+			//is the same every time
+			bool fRunning = true;
+			while(fRunning)
+			{
+				fRunning = false;
+				for(unsigned int i = 0; i < CoreCount; i++)
+				{
+					if(Cores[i].fDone)
+						continue;
+					pCurrentCore = &Cores[i];
+					RunCore(Cores[i], Quantum);
+					fRunning = fRunning || !Cores[i].fDone;
+				}
+				pCurrentCore = NULL;
+
+				if(Stop.Take())
+				{
+					for(unsigned int i = 0; i < CoreCount; i++)
+					{
+						if(!Cores[i].fDone)
+						{
+							Cores[i].sStatus = "stopped";
+							Cores[i].fDone = true;
+						}
+					}
+					fRunning = false;
+				}
+			}
+		}
+		else
+		{
+			for(unsigned int i = 0; i < CoreCount; i++)
+				THREAD_CREATE(Cores[i].Thread, CoreThread, (void *)(size_t)i)
+			for(unsigned int i = 0; i < CoreCount; i++)
+				THREAD_JOIN(Cores[i].Thread)
+		}
+		Stop.Disarm();
+		fflush(stdout);
+
+		//Summary, after the console output
+		char sBuffer[128];
+		unsigned int Halted = 0;
+		cerr << "\nCore\tStatus\tCycles\tInstructions\tMessage\n";
+		for(unsigned int i = 0; i < CoreCount; i++)
+		{
+			Core &TheCore = Cores[i];
+			#if defined _MSC_VER
+				sprintf(sBuffer, "%u\t%.15s\t%I64u\t%I64u\t", i, TheCore.sStatus.c_str(), TheCore.pSim->SimCycle, TheCore.pSim->SimInstruction);
+			#elif defined GPLUSPLUS
+				sprintf(sBuffer, "%u\t%.15s\t%llu\t%llu\t", i, TheCore.sStatus.c_str(), TheCore.pSim->SimCycle, TheCore.pSim->SimInstruction);
+			#else
+				#error "Only MSVC and GCC Compilers Supported"
+			#endif
+			cerr << sBuffer << TheCore.sMessage << "\n";
+			if(TheCore.sStatus == "halted")
+				Halted++;
+		}
+		cerr << CoreCount << " core" << (CoreCount != 1 ? "s" : "") << (Quantum ? " taking turns" : " on their own threads") << ", " << Halted << " halted." << endl;
+
+		for(unsigned int i = 0; i < CoreCount; i++)
+		{
+			delete Cores[i].pArch;
+			delete Cores[i].pSim;
+		}
+		for(unsigned int i = 0; i < AsmPrograms.size(); i++)
+			delete AsmPrograms[i];
+	}
+	catch(const char *sMsg)
+	{	//*NOTE: MSVC allows "char", but GCC requires "const"
+		printf("***An unexpected problem has occured.\nPlease e-mail the following error message, along with all input command line\noptions and files to the current maintainer, and the bug will be assessed:\n***Fatal:   %s\n", sMsg);
+		fflush(NULL);
+		exit(-1);
+	}
+	catch(runtime_error e)
+	{
+		printf("***An unexpected problem has occured.\nPlease e-mail the following error message, along with all input command line\noptions and files to the current maintainer, and the bug will be assessed:\n***Fatal:   %s\n", e.what());
+		fflush(NULL);
+		exit(-1);
+	}
+
+	return 0;
+}
+
+void PrintUsage()
+{
+	cout << "\n\t\tLC-3 Multiprocessor Simulator " << SIM_VER << ", Ashley Wise\n\n";
+	cout << "Give assembly file names as parameters. The program is assembled once and\n";
+	cout << "run by every core of a system which shares one memory. The cores share the\n";
+	cout << "console, and a summary line is printed for each core once they stop.\n";
+	cout << "A core reads its ID from 4xFE08 and the number of cores from 4xFE0A.\n";
+	cout << "4xFE10 to 4xFE1E are test-and-set locks: a read returns the lock and sets\n";
+	cout << "it, and a write of 0 releases it. Each core after the first starts with R6\n";
+	cout << "4x" << hex << uppercase << LC3Arch::CORE_STACK_WORDS << dec << " words below the previous core's.\n";
+	cout << "   -3            Disable support for older LC-3 syntax\n";
+	cout << "   -c Cycles     Stop each core after this many cycles (default 10000000)\n";
+	cout << "   -e Engine     Simulate with pipeline, threaded, block (default) or jit\n";
+	cout << "   -h or -?      Prints this help\n";
+	cout << "   -i File       Read the console input from File\n";
+	cout << "   -n Cores      Number of cores (default one per processor)\n";
+	cout << "   -os           Use Ash Operating System.\n";
+	cout << "   -q Cycles     Run the cores in turn on one thread, this many cycles each\n";
+	cout << "                 turn, so every run is the same. By default each core runs\n";
+	cout << "                 on its own thread.\n\n";
+}
+
+bool ProcessArgs(int argc, char* argv[])
+{
+	TheContext.Flags.fOldLC3 = true;
+	for(int i = 1; i < argc; i++)
+	{
+		if(argv[i][0] == '-')
+		{
+			switch(argv[i][1])
+			{
+			case '3':
+				if(!TheContext.Flags.fOldLC3)
+					cout << "Warning:   -3 specified more than once.";
+				TheContext.Flags.fOldLC3 = false;
+				break;
+			case 'c':
+			case 'C':
+				if(i + 1 >= argc || !(CycleLimit = strtoul(argv[i+1], NULL, 10)))
+				{
+					cout << "Error:   -c must be followed by a number of cycles." << endl << endl;
+					return false;
+				}
+				i++;
+				break;
+			case 'e':
+			case 'E':
+				if(i + 1 >= argc)
+				{
+					cout << "Error:   -e must be followed by an engine name." << endl << endl;
+					return false;
+				}
+				sEngine = ToLower(argv[++i]);
+				break;
+			case 'i':
+			case 'I':
+				if(i + 1 >= argc)
+				{
+					cout << "Error:   -i must be followed by an input file." << endl << endl;
+					return false;
+				}
+				sInputFile = argv[++i];
+				break;
+			case 'n':
+			case 'N':
+				if(i + 1 >= argc || !(CoreCount = atoi(argv[i+1])))
+				{
+					cout << "Error:   -n must be followed by a number of cores." << endl << endl;
+					return false;
+				}
+				i++;
+				break;
+			case 'o':
+			case 'O':
+				if(argv[i][2] != 's' && argv[i][2] != 'S')
+					return false;
+				if(TheContext.Flags.fUseOS)
+					cout << "Warning:   -os specified more than once.";
+				else
+				{
+					FileName sOSLocation(sProgramDir + "AshOS_LC3.asm");
+					ifstream OSFile(sOSLocation.Full.c_str());
+					if(!OSFile.good())
+					{
+						cout << "Error:   The LC-3 Ash Operating System was not found at " << sOSLocation.Full << endl << endl;
+						return false;
+					}
+					TheContext.InputList.push_back(sOSLocation.Full);
+					TheContext.Flags.fUseOS = true;
+				}
+				break;
+			case 'q':
+			case 'Q':
+				if(i + 1 >= argc || !(Quantum = strtoul(argv[i+1], NULL, 10)))
+				{
+					cout << "Error:   -q must be followed by a number of cycles." << endl << endl;
+					return false;
+				}
+				i++;
+				break;
+			case '?':
+			case 'h':
+			case 'H':
+			default:
+				return false;
+			}
+			continue;
+		}
+
+		TheContext.InputList.push_back(CreateStandardPath(argv[i]));
+	}
+	if(TheContext.InputList.empty())
+	{
+		cout << "Error: No assembly files specified.\n\n";
+		return false;
+	}
+
+	return true;
+}
+
+int NewHandler(unsigned int Size)
+{
+	throw "Out of memory!";
+}
+
+/******************************************************************************\
+	RunCore( [in-out] core, [in] maximum number of cycles )
+
+	Runs the core until it halts, stops with an exception or error, reaches
+	the cycle limit, is stopped by Ctrl-C, or has run the given number of
+	cycles. Sets fDone and the status in every case but the last.
+\******************************************************************************/
+static void RunCore(Core &TheCore, uint64 MaxCycles)
+{
+	ArchSim<LC3ISA> &TheSim = *TheCore.pSim;
+	if(!TheSim.RunBatch(MaxCycles))
+		TheCore.sStatus = "error";
+	else if(!(*TheCore.pMCR)[15])
+		TheCore.sStatus = "halted";
+	else if(TheSim.SimCycle >= CycleLimit)
+		TheCore.sStatus = "limit";
+	else if(!TheSim.fBreak)
+		return;
+	else if(TheCore.fBreakpoint && TheCore.sMessage.empty())
+		//Only Ctrl-C breaks a core short of the cycle limit
+		TheCore.sStatus = "stopped";
+	else
+		TheCore.sStatus = "exception";
+	TheCore.fDone = true;
+	//The clock stopping is how a core halts, not an exception
+	if(TheCore.sStatus == "halted")
+		TheCore.sMessage = "";
+}
+
+THREAD_FUNCTION(CoreThread, pParam)
+{
+	Core &TheCore = Cores[(size_t)pParam];
+	//The simulators print instructions and numbers, so each thread needs
+	//a context of its own
+	Context CoreContext = DefaultContext;
+	SetContext(&CoreContext);
+	pCurrentCore = &TheCore;
+	RunCore(TheCore, CycleLimit);
+	return 0;
+}
+
+//The console lock is only held for a few instructions, so spin rather than sleep
+static void LockConsole()
+{
+	while(ATOMIC_COMPARE_EXCHANGE(ConsoleLock, 1, 0))
+		SYNCH_SLEEP(0)
+}
+
+static void UnlockConsole()
+{
+	ATOMIC_STORE(ConsoleLock, 0)
+}
+
+bool MultiCallBack(MessageEnum MessageType, const string &sMessage)
+{
+	//Keep the reason a core stopped for its summary line
+	if(pCurrentCore && (MessageType == Error || MessageType == Fatal || MessageType == JMT::Exception))
+		pCurrentCore->sMessage = sMessage;
+	else if(pCurrentCore && MessageType == Breakpoint)
+		pCurrentCore->fBreakpoint = true;
+	return true;
+}
+
+bool MultiMessageCallBack(MessageEnum MessageType, const string &sMessage, const LocationVector &)
+{
+	return MultiCallBack(MessageType, sMessage);
+}
+
+bool MultiCommand(string &)
+{
+	//The cores are run without the command prompt
+	return false;
+}
+
+bool MultiReadConsole(string &sBuffer, unsigned int CharsToRead, unsigned int &CharsRead)
+{
+	LockConsole();
+	sBuffer = sInput.substr(MIN(InputPosition, sInput.size()), CharsToRead);
+	CharsRead = sBuffer.size();
+	InputPosition += CharsRead;
+	UnlockConsole();
+	//Running out of input is the same as end of input on the console
+	return CharsRead == CharsToRead;
+}
+
+bool MultiWriteConsole(const string &sBuffer, unsigned int CharsToWrite, unsigned int &CharsWritten)
+{
+	CharsWritten = MIN(CharsToWrite, sBuffer.size());
+	LockConsole();
+	fwrite(sBuffer.data(), 1, CharsWritten, stdout);
+	UnlockConsole();
+	return true;
+}
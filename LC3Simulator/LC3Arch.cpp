@@ -18,6 +18,19 @@ namespace LC3	{
 #undef R
 #define R(Reg) (*pThis->pR[Reg])
 #define CHANGE(Reg) (Reg == TR ? NoEvent : ChangeEvent)
+#define CHANGED(Old, Reg) ((Old) == (Reg).Value ? NoEvent : ChangeEvent)
+
+//Register set names, so that logging an event does not construct a string
+static const string sControlSet("control"), sMMIOSet("mmio"), sRegFileSet("regfile");
+
+LC3System::LC3System()
+{
+	pDRAM = NULL;
+	Cores = 0;
+	for(unsigned int i = 0; i < LOCK_COUNT; i++)
+		Locks[i] = 0;
+	CodeWrites = 0;
+}
 
 LC3Arch::LC3Arch(ArchSim<LC3ISA> &thesim) : TheSim(thesim)
 {
@@ -25,11 +38,339 @@ LC3Arch::LC3Arch(ArchSim<LC3ISA> &thesim) : TheSim(thesim)
 	CreateMemories();
 	CreatePipelines();
 	KeyboardInterruptVector = 0x80;
+	Engines.push_back("threaded");
+	Engines.push_back("block");
+	if(BlockCompiler::Supported())
+		Engines.push_back("jit");
+	fBlockFlushed = false;
+	fMMIOAccess = false;
+	fFetching = false;
+	pSystem = &LocalSystem;
+	LocalSystem.pDRAM = pDRAM;
+	LocalSystem.Cores = 1;
+	CoreID = 0;
+	SeenCodeWrites = 0;
+
+	//Name the opcodes for the statistics, in opcode order
+	const char *const sOpcodeNames[INVALID_OPCODE + 1] = {"BR", "ADD", "LD", "ST", "JSR", "AND", "LDR", "STR", "RTI", "NOT", "LDI", "STI", "JMP", "reserved", "LEA", "TRAP", "invalid"};
+	vector<string> OpcodeNames(sOpcodeNames, sOpcodeNames + INVALID_OPCODE + 1);
+	vector<PerfCounters::OpcodeKindEnum> OpcodeKinds(OpcodeNames.size(), PerfCounters::OtherOpcode);
+	OpcodeKinds[0x2] = OpcodeKinds[0x6] = OpcodeKinds[0xA] = PerfCounters::LoadOpcode;
+	OpcodeKinds[0x3] = OpcodeKinds[0x7] = OpcodeKinds[0xB] = PerfCounters::StoreOpcode;
+	Counters.Create(OpcodeNames, OpcodeKinds, 0x10000, 0);
+}
+
+void LC3Arch::JoinSystem(LC3System &System)
+{
+	if(pSystem != &LocalSystem)
+		throw "Core has already joined a system!";
+
+	CoreID = System.Cores++;
+	if(!CoreID)
+	{
+		System.pDRAM = pDRAM;
+		System.CodeWords.assign(DecodeCache.size(), 0);
+	}
+	else
+	{
+		pDRAM = System.pDRAM;
+		*pR[6] = pR[6]->Value - CoreID * CORE_STACK_WORDS;
+	}
+	//The other cores write the memory without this simulator knowing,
+	//so its snapshot would be wrong
+	pDRAM->DiscardSnapshot();
+	pSystem = &System;
+	SeenCodeWrites = System.CodeWrites;
+	InvalidateDecode();
+}
+
+bool LC3Arch::Run()
+{
+	//The block engine falls back to the threaded engine for single cycles
+	if(Engine != PipelineEngine)
+		return ThreadedPath();
+	return Architecture::Run();
+}
+
+bool LC3Arch::RunCycles(uint64 MaxCycles, uint64 &Cycles)
+{
+	CheckCodeWrites();
+
+	//Translated blocks do not log the fetch and register events of the
+	//threaded engine, so the block engines are only used when nothing
+	//could observe them. The trace also needs an exact cycle count
+	//for every instruction.
+	if( (Engine != BlockEngine && Engine != CompiledEngine) || TheSim.fTrace || !TheSim.RegisterBreakpoints.empty() || !TheSim.DataBreakpoints.empty() || !TheSim.MemoryBreakpoints.empty()
+		|| (*pMCR)[15] != 1 || !InterruptList.empty() || pPC->Value >= 0xFE00 )
+		return Architecture::RunCycles(MaxCycles, Cycles);
+
+	Cycles = 0;
+	fMMIOAccess = false;
+	//Stop between blocks if the simulator is paused, since a block which
+	//branches to itself would otherwise run to the cycle limit. Cache
+	//and branch misprediction stalls count towards the limit, as they
+	//would one cycle at a time.
+	while(Cycles + Caches.Stalls + Branches.Stalls < MaxCycles && !TheSim.Pause.Pending())
+	{
+		CheckCodeWrites();
+		LC3ISA::Word Address = pPC->Value;
+		vector<DecodedInstruction> &Block = Translate(Address);
+		if(Block.empty())
+			break;
+
+		fBlockFlushed = false;
+		unsigned int i = 0;
+		//Run as much of the block as is compiled
+		if(Engine == CompiledEngine && CanRunCompiled(Block.size(), MaxCycles - Cycles))
+		{
+			BlockCompiler::BlockFunction pCompiled = CompiledBlocks[Address];
+			if(!pCompiled)
+				pCompiled = Compile(Address);
+			if(pCompiled)
+			{
+				i = RunCompiled(pCompiled);
+				Cycles += i;
+				if(TheSim.fBreak || fBlockFlushed || fMMIOAccess || !InterruptList.empty())
+					return true;
+			}
+		}
+
+		//Interpret the block, or the rest of it after the compiled code
+		for(; i < Block.size() && Cycles + Caches.Stalls + Branches.Stalls < MaxCycles; )
+		{
+			//A store can discard this block, so execute a copy
+			DecodedInstruction Instr = Block[i++];
+			BeginBlockStep(Instr);
+			Instr.Execute(this, Instr);
+			Cycles++;
+
+			//Return to the simulator for breaks, I/O, and pending interrupts
+			if(EndBlockStep())
+				return true;
+		}
+	}
+
+	return true;
+}
+
+inline void LC3Arch::BeginBlockStep(const DecodedInstruction &Instr)
+{
+	*pIR = Instr.Binary;
+	Counters.Instruction(Instr.Opcode, pPC->Value);
+	Caches.Fetch((uint64)pPC->Value << LC3ISA::Addressability);
+}
+
+inline bool LC3Arch::EndBlockStep()
+{
+	TheSim.InstructionEvent(pPC->Value << LC3ISA::Addressability);
+	return TheSim.fBreak || fBlockFlushed || fMMIOAccess || !InterruptList.empty();
+}
+
+uint64 LC3Arch::CompiledRead(void *pArch, uint64 Address)
+{
+	LC3Arch *pThis = (LC3Arch *)pArch;
+	try
+	{
+		uint64 Value = pThis->DataRead((LC3ISA::Word)Address, 2, 16);
+		return Value | pThis->CompiledStop();
+	}
+	catch(...)
+	{
+		pThis->Compiler.SaveException();
+		return BlockCompiler::ABORT;
+	}
+}
+
+uint64 LC3Arch::CompiledWrite(void *pArch, uint64 Address, uint64 Value)
+{
+	LC3Arch *pThis = (LC3Arch *)pArch;
+	try
+	{
+		pThis->DataWrite((LC3ISA::Word)Address, 2, (LC3ISA::Word)Value, 16);
+		return pThis->CompiledStop();
+	}
+	catch(...)
+	{
+		pThis->Compiler.SaveException();
+		return BlockCompiler::ABORT;
+	}
+}
+
+uint64 LC3Arch::CompiledStop() const
+{
+	return TheSim.fBreak || fBlockFlushed || fMMIOAccess || !InterruptList.empty() ? BlockCompiler::STOP : 0;
+}
+
+uint64 LC3Arch::CompiledCall(void *pArch, uint64 CallAddress, uint64 SubAddress)
+{
+	LC3Arch *pThis = (LC3Arch *)pArch;
+	try
+	{
+		pThis->TheSim.SubInEvent(CallAddress, SubAddress);
+		return pThis->CompiledStop();
+	}
+	catch(...)
+	{
+		pThis->Compiler.SaveException();
+		return BlockCompiler::ABORT;
+	}
+}
+
+uint64 LC3Arch::CompiledReturn(void *pArch)
+{
+	LC3Arch *pThis = (LC3Arch *)pArch;
+	try
+	{
+		pThis->TheSim.SubOutEvent();
+		return pThis->CompiledStop();
+	}
+	catch(...)
+	{
+		pThis->Compiler.SaveException();
+		return BlockCompiler::ABORT;
+	}
+}
+
+bool LC3Arch::CompileOperation(const DecodedInstruction &Instr, LC3ISA::Word Address, BlockCompiler::Operation &Op)
+{
+	LC3ISA::Word NextPC = Address + 1;
+
+	Op.DR = Instr.DR;
+	Op.SR1 = Instr.SR1;
+	Op.SR2 = Instr.SR2;
+	Op.Conditions = 0;
+	Op.Imm = Instr.Imm;
+	Op.PC = Address;
+	Op.Binary = Instr.Binary;
+	Op.NextPC = NextPC;
+	Op.pRead = Op.pIndirectRead = CompiledRead;
+	Op.pWrite = CompiledWrite;
+	Op.pCall = CompiledCall;
+	Op.pReturn = CompiledReturn;
+
+	switch(Instr.Opcode)
+	{
+	case 0x1:	//vOpcodes[ADD]:
+	case 0x5:	//vOpcodes[AND]:
+		Op.Type = Instr.Opcode == 0x1 ? BlockCompiler::AddOperation : BlockCompiler::AndOperation;
+		if(Instr.Flags)
+			Op.SR2 = BlockCompiler::IMMEDIATE;
+		break;
+
+	case 0x9:	//vOpcodes[NOT]:
+		Op.Type = BlockCompiler::NotOperation;
+		break;
+
+	case 0xE:	//vOpcodes[LEA]:
+		Op.Type = BlockCompiler::SetOperation;
+		Op.Imm = (LC3ISA::Word)(NextPC + Instr.Imm);
+		break;
+
+	case 0x2:	//vOpcodes[LD]:
+	case 0xA:	//vOpcodes[LDI]:
+	case 0x3:	//vOpcodes[ST]:
+	case 0xB:	//vOpcodes[STI]:
+		Op.SR1 = BlockCompiler::IMMEDIATE;
+		Op.Imm = (LC3ISA::Word)(NextPC + Instr.Imm);
+		Op.Type = Instr.Opcode == 0x2 ? BlockCompiler::LoadOperation : Instr.Opcode == 0xA ? BlockCompiler::LoadIndirectOperation : Instr.Opcode == 0x3 ? BlockCompiler::StoreOperation : BlockCompiler::StoreIndirectOperation;
+		break;
+
+	case 0x6:	//vOpcodes[LDR]:
+		Op.Type = BlockCompiler::LoadOperation;
+		break;
+
+	case 0x7:	//vOpcodes[STR]:
+		Op.Type = BlockCompiler::StoreOperation;
+		break;
+
+	case 0x0:	//vOpcodes[BR]:
+		Op.Type = BlockCompiler::BranchOperation;
+		Op.Conditions = (Instr.Flags & (1 << N) ? BlockCompiler::NEGATIVE : 0) | (Instr.Flags & (1 << Z) ? BlockCompiler::ZERO : 0) | (Instr.Flags & (1 << P) ? BlockCompiler::POSITIVE : 0);
+		Op.Imm = (LC3ISA::Word)(NextPC + Instr.Imm);
+		break;
+
+	case 0x4:	//vOpcodes[JSR]:
+		Op.Type = BlockCompiler::CallOperation;
+		if(Instr.Flags)
+		{
+			Op.SR1 = BlockCompiler::IMMEDIATE;
+			Op.Imm = (LC3ISA::Word)(NextPC + Instr.Imm);
+		}
+		break;
+
+	case 0xF:	//vOpcodes[TRAP]:
+		Op.Type = BlockCompiler::TrapOperation;
+		break;
+
+	case 0xC:	//vOpcodes[JMP]:
+		Op.Type = Instr.SR1 == LC3ISA::R7 ? BlockCompiler::ReturnOperation : BlockCompiler::JumpOperation;
+		break;
+
+	default:	//RTI and illegal encodings
+		return false;
+	}
+
+	return true;
 }
 
-bool LC3Arch::Reset(const RamVector &MemoryImage)
+BlockCompiler::BlockFunction LC3Arch::Compile(LC3ISA::Word Address)
 {
-	*pPC = Flags.fUseOS ? 0x3000 : MemoryImage.begin()->first >> 1;
+	BlockCompiler::BlockFunction &pCompiled = CompiledBlocks[Address];
+	if(pCompiled || !Compiler.Available())
+		return pCompiled;
+
+	const vector<DecodedInstruction> &Block = BlockCache[Address];
+	BlockCompiler::Operation Ops[MAX_BLOCK_INSTRUCTIONS];
+	unsigned int Count = 0;
+	while(Count < Block.size() && CompileOperation(Block[Count], Address + Count, Ops[Count]))
+		Count++;
+	if(!Count)
+		return NULL;
+	pCompiled = Compiler.Compile(Ops, Count);
+	if(!pCompiled && Compiler.Available())
+	{
+		//The buffer is full, so start it over with this block
+		Compiler.Clear();
+		CompiledBlocks.assign(CompiledBlocks.size(), NULL);
+		pCompiled = Compiler.Compile(Ops, Count);
+	}
+	return pCompiled;
+}
+
+bool LC3Arch::CanRunCompiled(size_t Instructions, uint64 MaxInstructions) const
+{
+	unsigned int CC = pPSR->Value & 0x7;
+	return Compiler.Available() && !Caches.fOn && !Branches.fOn && !Counters.fOn && !TheSim.fCheck && TheSim.InstrBreakpoints.empty()
+		&& Instructions <= MaxInstructions && (TheSim.BreakInstruction <= TheSim.SimInstruction || TheSim.BreakInstruction - TheSim.SimInstruction >= Instructions)
+		&& (CC == (1 << N) || CC == (1 << Z) || CC == (1 << P));
+}
+
+unsigned int LC3Arch::RunCompiled(BlockCompiler::BlockFunction pCompiled)
+{
+	BlockCompiler::State State;
+	unsigned int i;
+	for(i = 0; i < 8; i++)
+		State.R[i] = (unsigned int)pR[i]->Value;
+	State.CC = (*pPSR)[N] ? -1 : (*pPSR)[Z] ? 0 : 1;
+	State.PC = (unsigned int)pPC->Value;
+	State.IR = (unsigned int)pIR->Value;
+	State.pArch = this;
+
+	unsigned int Executed = (unsigned int)pCompiled(&State);
+
+	for(i = 0; i < 8; i++)
+		*pR[i] = State.R[i];
+	SetCC((signed short)State.CC);
+	*pPC = State.PC;
+	*pIR = State.IR;
+	TheSim.InstructionsEvent(Executed);
+	Compiler.RethrowException();
+	return Executed;
+}
+
+bool LC3Arch::Reset(const RamImage &MemoryImage)
+{
+	*pPC = TheContext.Flags.fUseOS ? 0x3000 : MemoryImage.FirstAddress() >> 1;
 	*pIR = 0;
 	*pPSR = 0x8000;
 	*pSSP = 0x3000;
@@ -45,6 +386,7 @@ bool LC3Arch::Reset(const RamVector &MemoryImage)
 	InterruptList.clear();
 
 	pDRAM->Clear();
+	InvalidateDecode();
 	if(!pDRAM->Write(MemoryImage, TheSim.SimCallBack))
 		return false;
 
@@ -55,21 +397,64 @@ bool LC3Arch::Reset(const RamVector &MemoryImage)
 	return true;
 }
 
+bool LC3Arch::TakeSnapshot()
+{
+	if(!Architecture::TakeSnapshot())
+		return false;
+	SnapshotInterrupts = InterruptList;
+	return true;
+}
+
+bool LC3Arch::RestoreSnapshot()
+{
+	if(!Architecture::RestoreSnapshot())
+		return false;
+	InterruptList = SnapshotInterrupts;
+
+	//The first instruction will otherwise not be registered as an event,
+	//since it has to be registered prior to the cycle it occurs 
+	TheSim.InstructionEvent(*pPC << LC3ISA::Addressability);
+
+	return true;
+}
+
 uint64 LC3Arch::NextInstruction()
 {
 	return *pPC << LC3ISA::Addressability;
 }
 
-bool LC3Arch::DataRead(RamVector &MemoryImage, uint64 Address, uint64 Length)
+bool LC3Arch::DataRead(vector<unsigned char> &Bytes, uint64 Address, uint64 Length)
 {
-	return pDRAM->Read(MemoryImage, Address, Length, TheSim.SimCallBack);
+	return pDRAM->Read(Bytes, Address, Length, TheSim.SimCallBack);
 }
 
-bool LC3Arch::DataWrite(const RamVector &MemoryImage)
+bool LC3Arch::DataWrite(const RamImage &MemoryImage)
 {
+	InvalidateDecode(MemoryImage);
 	return pDRAM->Write(MemoryImage, TheSim.SimCallBack);
 }
 
+void LC3Arch::MemoryChanged(const Memory &TheMemory, const RamImage &MemoryImage)
+{
+	if(&TheMemory == pDRAM)
+		InvalidateDecode(MemoryImage);
+}
+
+void LC3Arch::MemoryRestored(const Memory &TheMemory, const vector<uint64> &RestoredPages)
+{
+	if(&TheMemory != pDRAM)
+		return;
+
+	for(vector<uint64>::const_iterator PageIter = RestoredPages.begin(); PageIter != RestoredPages.end(); PageIter++)
+	{
+		for(uint64 Address = *PageIter >> LC3ISA::Addressability; Address <= (*PageIter + MEMORY_PAGE_BYTES - 1) >> LC3ISA::Addressability; Address++)
+		{
+			if(Address < DecodeCache.size())
+				InvalidateDecode((LC3ISA::Word)Address);
+		}
+	}
+}
+
 bool LC3Arch::CreateRegisters()
 {
 	pair<RegisterSetMap::iterator, bool> RegSetIter;
@@ -92,6 +477,7 @@ bool LC3Arch::CreateRegisters()
 	for(int i = 0; i < 8; i++)
 		pR[i] = vRegs[i];
 
+	NumberRegisters();
 	return true;
 }
 
@@ -105,6 +491,11 @@ bool LC3Arch::CreateMemories()
 	pair<MemoryMap::iterator, bool> MemIter;
 	MemIter = Memories.insert( MemoryMap::value_type("dram", Memory("dram", 0, LC3ISA::MaxAddress, BitDivisions)) );
 	pDRAM = &MemIter.first->second;
+	NumberMemories();
+	DecodeCache.resize((LC3ISA::MaxAddress >> LC3ISA::Addressability) + 1);
+	BlockCache.resize(DecodeCache.size());
+	CodeMap.resize(DecodeCache.size());
+	CompiledBlocks.resize(DecodeCache.size(), NULL);
 	return true;
 }
 
@@ -123,312 +514,247 @@ bool LC3Arch::DataPath(Architecture *pArch)
 	Register &PC = *pThis->pPC, &IR = *pThis->pIR, &PSR = *pThis->pPSR, &SSP = *pThis->pSSP, &USP = *pThis->pUSP, &MCR = *pThis->pMCR, TR("", 64), TPC("", 64);
 	Memory &DRAM = *pThis->pDRAM;
 	LC3ISA::Word Address, PreviousPC = PC, Temp;
-	LC3ISA::LC3Instruction Instr;
+	DecodedInstruction Instr;
 
 	//Make sure the clock is started.
 	if(MCR[15] != 1)
 	{
 		TheSim.SimCallBack(Info, "Restarted the clock.");
 		MCR.SetBit(15, 1);
-		TheSim.RegisterEvent("mmio", MCR, (EventEnum)(WriteEvent | ValueEvent | ChangeEvent));
+		TheSim.RegisterEvent(sMMIOSet, MCR, (EventEnum)(WriteEvent | ValueEvent | ChangeEvent));
 	}
-	TheSim.RegisterEvent("mmio", MCR, ReadEvent);
+	TheSim.RegisterEvent(sMMIOSet, MCR, ReadEvent);
 
 	//Get the next instruction
-	TR = IR; IR = Instr.Binary = pThis->DataRead(PC, 2, 16);
-	TheSim.RegisterEvent("control", IR, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(IR)));
+	Instr = pThis->Fetch(PC);
+	TR = IR; IR = Instr.Binary;
+	TheSim.RegisterEvent(sControlSet, IR, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(IR)));
 	TPC = PC;
 
 	//Check for interrupts
 	if(pThis->ProcessInterrupt())
 		return true;
+	pThis->Counters.Instruction(Instr.Opcode, PC.Value);
 
 	//Process the instruction
-	switch(Instr.Base.Opcode)
+	switch(Instr.Opcode)
 	{
 	case 0x1:	//vOpcodes[ADD]:
-		if(Instr.Add.UseImm)
+		if(Instr.Flags)
 		{
-			TR = R(Instr.Add.DR); R(Instr.Add.DR) = R(Instr.Add.SR1) + SEXT(Instr.AddImm.Imm5, 5);
-			TheSim.RegisterEvent("regfile", R(Instr.Add.SR1), ReadEvent);
+			TR = R(Instr.DR); R(Instr.DR) = R(Instr.SR1) + Instr.Imm;
+			TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
 		}
 		else
 		{
-			if(Instr.Add.Zeros)
-				goto Default;
-			TR = R(Instr.Add.DR); R(Instr.Add.DR) = R(Instr.Add.SR1) + R(Instr.Add.SR2);
-			TheSim.RegisterEvent("regfile", R(Instr.Add.SR1), ReadEvent);
-			TheSim.RegisterEvent("regfile", R(Instr.Add.SR2), ReadEvent);
+			TR = R(Instr.DR); R(Instr.DR) = R(Instr.SR1) + R(Instr.SR2);
+			TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+			TheSim.RegisterEvent(sRegFileSet, R(Instr.SR2), ReadEvent);
 		}
-		TheSim.RegisterEvent("regfile", R(Instr.Add.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.Add.DR))));
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.DR))));
 
-		TR = PSR; pThis->SetCC(R(Instr.Add.DR));
-		TheSim.RegisterEvent("control", PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
+		TR = PSR; pThis->SetCC(R(Instr.DR));
+		TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
 
 		PC = PC + 1;
 		break;
 
 	case 0x5:	//vOpcodes[AND]:
-		if(Instr.And.UseImm)
+		if(Instr.Flags)
 		{
-			TR = R(Instr.And.DR); R(Instr.And.DR) = R(Instr.And.SR1) & SEXT(Instr.AndImm.Imm5, 5);
-			TheSim.RegisterEvent("regfile", R(Instr.And.SR1), ReadEvent);
+			TR = R(Instr.DR); R(Instr.DR) = R(Instr.SR1) & Instr.Imm;
+			TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
 		}
 		else
 		{
-			if(Instr.And.Zeros)
-				goto Default;
-			TR = R(Instr.And.DR); R(Instr.And.DR) = R(Instr.And.SR1) & R(Instr.And.SR2);
-			TheSim.RegisterEvent("regfile", R(Instr.And.SR1), ReadEvent);
-			TheSim.RegisterEvent("regfile", R(Instr.And.SR2), ReadEvent);
+			TR = R(Instr.DR); R(Instr.DR) = R(Instr.SR1) & R(Instr.SR2);
+			TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+			TheSim.RegisterEvent(sRegFileSet, R(Instr.SR2), ReadEvent);
 		}
-		TheSim.RegisterEvent("regfile", R(Instr.And.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.And.DR))));
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.DR))));
 
-		TR = PSR; pThis->SetCC(R(Instr.And.DR));
-		TheSim.RegisterEvent("control", PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
+		TR = PSR; pThis->SetCC(R(Instr.DR));
+		TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
 
 		PC = PC + 1;
 		break;
 
 	case 0x0:	//vOpcodes[BR]:
 		bool fBranch;
-		fBranch = false;
-		if(Instr.Br.N)
-		{
-			if(Instr.Br.Z)
-			{
-				if(Instr.Br.P)
-				{
-					if(PSR[N] | PSR[Z] | PSR[P])
-						fBranch = true;
-				}
-				else
-				{
-					if(PSR[N] | PSR[Z])
-						fBranch = true;
-				}
-			}
-			else
-			{
-				if(Instr.Br.P)
-				{
-					if(PSR[N] | PSR[P])
-						fBranch = true;
-				}
-				else
-				{
-					if(PSR[N])
-						fBranch = true;
-				}
-			}
-		}
-		else
-		{
-			if(Instr.Br.Z)
-			{
-				if(Instr.Br.P)
-				{
-					if(PSR[Z] | PSR[P])
-						fBranch = true;
-				}
-				else
-				{
-					if(PSR[Z])
-						fBranch = true;
-				}
-			}
-			else
-			{
-				if(Instr.Br.P)
-				{
-					if(PSR[P])
-						fBranch = true;
-				}
-				else
-				{
-					//This is a NOP
-					fBranch = false;
-				}
-			}
-		}
-		TheSim.RegisterEvent("control", PSR, ReadEvent);
+		//The NZP bits of the instruction line up with the condition codes in the PSR
+		fBranch = (PSR & Instr.Flags) != 0;
+		TheSim.RegisterEvent(sControlSet, PSR, ReadEvent);
+		pThis->Counters.Branch(fBranch);
+		if(Instr.Flags != 0 && Instr.Flags != 7)
+			pThis->Branches.Branch(TPC.Value, fBranch);
 
 		if(fBranch)
-			PC = PC + 1 + SEXT(Instr.Br.Offset9, 9);
+			PC = PC + 1 + Instr.Imm;
 		else
 			PC = PC + 1;
 		break;
 
 	case 0x4:	//vOpcodes[JSR]:
-		if(Instr.Jsr.JsrType)
+		if(Instr.Flags)
 		{	//JSR
 			TR = R(7); R(7) = PC + 1;
-			TheSim.RegisterEvent("regfile", R(7), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(7))));
-			PC = PC + 1 + SEXT(Instr.Jsr.Offset11, 11);
+			TheSim.RegisterEvent(sRegFileSet, R(7), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(7))));
+			PC = PC + 1 + Instr.Imm;
+			pThis->Branches.Call(R(7).Value);
 			TheSim.SubInEvent(TPC, PC);
 		}
 		else
 		{	//JSRR
-			if(Instr.Jsrr.Zero2 || Instr.Jsrr.Zero6)
-				goto Default;
-
 			TR = R(7); R(7) = PC + 1;
-			TheSim.RegisterEvent("regfile", R(7), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(7))));
-			PC = R(Instr.Jsrr.BaseR);
-			TheSim.RegisterEvent("regfile", R(Instr.Jsrr.BaseR), ReadEvent);
+			TheSim.RegisterEvent(sRegFileSet, R(7), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(7))));
+			PC = R(Instr.SR1);
+			TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+			pThis->Branches.Jump(TPC.Value, PC.Value);
+			pThis->Branches.Call(R(7).Value);
 			TheSim.SubInEvent(TPC, PC);
 		}
 		break;
 
 	case 0xF:	//vOpcodes[TRAP]:
-		if(Instr.Trap.Zeros)
-			goto Default;
-
 		TR = R(7); R(7) = PC + 1;
-		TheSim.RegisterEvent("regfile", R(7), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(7))));
+		TheSim.RegisterEvent(sRegFileSet, R(7), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(7))));
 
-		PC = pThis->DataRead(Instr.Trap.TrapVect8, 2, 16);
+		PC = pThis->DataRead(Instr.Imm, 2, 16);
+		pThis->Branches.Call(R(7).Value);
 		TheSim.SubInEvent(TPC, PC);
 		break;
 
 	case 0xC:	//vOpcodes[JMP]:
-		if(Instr.Jmp.Zero3 || Instr.Jmp.Zero6)
-			goto Default;
-
-		if(Instr.Jmp.BaseR == LC3ISA::R7)
+		if(Instr.SR1 == LC3ISA::R7)
 		{	//Ret
 			PC = R(7);
-			TheSim.RegisterEvent("regfile", R(7), ReadEvent);
+			TheSim.RegisterEvent(sRegFileSet, R(7), ReadEvent);
+			pThis->Branches.Return(TPC.Value, PC.Value);
 			TheSim.SubOutEvent();
 			break;
 		}
 
-		PC = R(Instr.Jmp.BaseR);
-		TheSim.RegisterEvent("regfile", R(Instr.Jmp.BaseR), ReadEvent);
+		PC = R(Instr.SR1);
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+		pThis->Branches.Jump(TPC.Value, PC.Value);
 		break;
 
 	case 0xE:	//vOpcodes[LEA]:
-		TR = R(Instr.Lea.DR); R(Instr.Lea.DR) = PC + 1 + SEXT(Instr.Lea.Offset9, 9);
-		TheSim.RegisterEvent("regfile", R(Instr.Lea.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.Lea.DR))));
+		TR = R(Instr.DR); R(Instr.DR) = PC + 1 + Instr.Imm;
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.DR))));
 
-		TR = PSR; pThis->SetCC(R(Instr.Lea.DR));
-		TheSim.RegisterEvent("control", PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
+		TR = PSR; pThis->SetCC(R(Instr.DR));
+		TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
 
 		PC = PC + 1;
 		break;
 
 	case 0x2:	//vOpcodes[LD]:
-		TR = R(Instr.Ld.DR); R(Instr.Ld.DR) = pThis->DataRead(PC + 1 + SEXT(Instr.Ld.Offset9, 9), 2, 16);
-		TheSim.RegisterEvent("regfile", R(Instr.Ld.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.Ld.DR))));
+		TR = R(Instr.DR); R(Instr.DR) = pThis->DataRead(PC + 1 + Instr.Imm, 2, 16);
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.DR))));
 
-		TR = PSR; pThis->SetCC(R(Instr.Ld.DR));
-		TheSim.RegisterEvent("control", PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
+		TR = PSR; pThis->SetCC(R(Instr.DR));
+		TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
 
 		PC = PC + 1;
 		break;
 
 	case 0xA:	//vOpcodes[LDI]:
-		Address = pThis->DataRead(PC + 1 + SEXT(Instr.Ld.Offset9, 9), 2, 16);
+		Address = pThis->DataRead(PC + 1 + Instr.Imm, 2, 16);
 
-		TR = R(Instr.Ld.DR); R(Instr.Ld.DR) = pThis->DataRead(Address, 2, 16);
-		TheSim.RegisterEvent("regfile", R(Instr.Ld.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.Ld.DR))));
+		TR = R(Instr.DR); R(Instr.DR) = pThis->DataRead(Address, 2, 16);
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.DR))));
 
-		TR = PSR; pThis->SetCC(R(Instr.Ld.DR));
-		TheSim.RegisterEvent("control", PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
+		TR = PSR; pThis->SetCC(R(Instr.DR));
+		TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
 
 		PC = PC + 1;
 		break;
 
 	case 0x6:	//vOpcodes[LDR]:
-		TR = R(Instr.Ldr.DR); R(Instr.Ldr.DR) = pThis->DataRead(R(Instr.Ldr.BaseR) + SEXT(Instr.Ldr.Offset6, 6), 2, 16);
-		TheSim.RegisterEvent("regfile", R(Instr.Ldr.BaseR), ReadEvent);
-		TheSim.RegisterEvent("regfile", R(Instr.Ldr.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.Ldr.DR))));
+		TR = R(Instr.DR); R(Instr.DR) = pThis->DataRead(R(Instr.SR1) + Instr.Imm, 2, 16);
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.DR))));
 
-		TR = PSR; pThis->SetCC(R(Instr.Ldr.DR));
-		TheSim.RegisterEvent("control", PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
+		TR = PSR; pThis->SetCC(R(Instr.DR));
+		TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
 
 		PC = PC + 1;
 		break;
 
 	case 0x3:	//vOpcodes[ST]:
-		pThis->DataWrite(PC + 1 + SEXT(Instr.St.Offset9, 9), 2, R(Instr.St.SR), 16);
-		TheSim.RegisterEvent("regfile", R(Instr.St.SR), ReadEvent);
+		pThis->DataWrite(PC + 1 + Instr.Imm, 2, R(Instr.DR), 16);
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), ReadEvent);
 
 		PC = PC + 1;
 		break;
 
 	case 0xB:	//vOpcodes[STI]:
-		Address = pThis->DataRead(PC + 1 + SEXT(Instr.St.Offset9, 9), 2, 16);
+		Address = pThis->DataRead(PC + 1 + Instr.Imm, 2, 16);
 
-		pThis->DataWrite(Address, 2, R(Instr.St.SR), 16);
-		TheSim.RegisterEvent("regfile", R(Instr.St.SR), ReadEvent);
+		pThis->DataWrite(Address, 2, R(Instr.DR), 16);
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), ReadEvent);
 
 		PC = PC + 1;
 		break;
 
 	case 0x7:	//vOpcodes[STR]:
-		pThis->DataWrite(R(Instr.Str.BaseR) + SEXT(Instr.Str.Offset6, 6), 2, R(Instr.Str.SR), 16);
-		TheSim.RegisterEvent("regfile", R(Instr.Str.BaseR), ReadEvent);
-		TheSim.RegisterEvent("regfile", R(Instr.Str.SR), ReadEvent);
+		pThis->DataWrite(R(Instr.SR1) + Instr.Imm, 2, R(Instr.DR), 16);
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), ReadEvent);
 
 		PC = PC + 1;
 		break;
 
 	case 0x9:	//vOpcodes[NOT]:
-		if(Instr.Not.Ones != 0x3F)
-			goto Default;
-
-		TR = R(Instr.Not.DR); R(Instr.Not.DR) = ~R(Instr.Not.SR);
-		TheSim.RegisterEvent("regfile", R(Instr.Not.SR), ReadEvent);
-		TheSim.RegisterEvent("regfile", R(Instr.Not.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.Not.DR))));
+		TR = R(Instr.DR); R(Instr.DR) = ~R(Instr.SR1);
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.DR))));
 
-		TR = PSR; pThis->SetCC(R(Instr.Not.DR));
-		TheSim.RegisterEvent("control", PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
+		TR = PSR; pThis->SetCC(R(Instr.DR));
+		TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
 
 		PC = PC + 1;
 		break;
 
 	case 0x8:	//vOpcodes[RTI]:
-		if(Instr.Rti.Zeros)
-			goto Default;
-
 		if(PSR[15] == 0)
 		{
 			PC = pThis->DataRead(R(6), 2, 16);
 			TR = R(6); R(6) = R(6) + 1;
-			TheSim.RegisterEvent("regfile", R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
+			TheSim.RegisterEvent(sRegFileSet, R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
 
-			TR = PSR; Temp = pThis->DataRead(R(6), 2, 16);
+			Temp = pThis->DataRead(R(6), 2, 16);
 			TR = R(6); R(6) = R(6) + 1;
-			TheSim.RegisterEvent("regfile", R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
-			PSR = Temp;
-			TheSim.RegisterEvent("control", PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
+			TheSim.RegisterEvent(sRegFileSet, R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
+			TR = PSR; PSR = Temp;
+			TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
 			TheSim.SubOutEvent();
 
 			//Save the supervisor stack
 			TR = SSP; SSP = R(6);
-			TheSim.RegisterEvent("regfile", R(6), ReadEvent);
-			TheSim.RegisterEvent("control", SSP, (EventEnum)(WriteEvent | ValueEvent | CHANGE(SSP)));
+			TheSim.RegisterEvent(sRegFileSet, R(6), ReadEvent);
+			TheSim.RegisterEvent(sControlSet, SSP, (EventEnum)(WriteEvent | ValueEvent | CHANGE(SSP)));
 
 			//R6 gets the stack pointer
 			if(PSR[15])
 			{
 				TR = R(6); R(6) = USP;
-				TheSim.RegisterEvent("control", USP, ReadEvent);
-				TheSim.RegisterEvent("regfile", R(6), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(6))));
+				TheSim.RegisterEvent(sControlSet, USP, ReadEvent);
+				TheSim.RegisterEvent(sRegFileSet, R(6), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(6))));
 			}
 			else
 			{
 				TR = R(6); R(6) = SSP;
-				TheSim.RegisterEvent("control", SSP, ReadEvent);
-				TheSim.RegisterEvent("regfile", R(6), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(6))));
+				TheSim.RegisterEvent(sControlSet, SSP, ReadEvent);
+				TheSim.RegisterEvent(sRegFileSet, R(6), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(6))));
 			}
-			TheSim.RegisterEvent("control", PSR, ReadEvent);
+			TheSim.RegisterEvent(sControlSet, PSR, ReadEvent);
 			
 		}
 		else	//Privilege mode exception
 		{
-			TheSim.RegisterEvent("control", PSR, ReadEvent);
+			TheSim.RegisterEvent(sControlSet, PSR, ReadEvent);
 			TheSim.SimCallBack(JMT::Exception, "RTI instruction executed with user privilege.");
 			PC = PC + 1;
 			pThis->Exception(0);
@@ -436,15 +762,14 @@ bool LC3Arch::DataPath(Architecture *pArch)
 
 		break;
 
-	default:
-Default:	//This is not a valid instruction
+	default:	//This is not a valid instruction
 		TheSim.SimCallBack(JMT::Exception, "Invalid instruction.");
 		PC = PC + 1;
 		pThis->Exception(1);
 	}
 	//The PC always changes
 	TR = TPC;
-	TheSim.RegisterEvent("control", PC, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(PC)));
+	TheSim.RegisterEvent(sControlSet, PC, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(PC)));
 
 	//The instruction event for the next instruction is flagged at the end of the preceeding cycle,
 	//so that a breakpoint will be able to stop before the registered instruction event
@@ -455,6 +780,526 @@ Default:	//This is not a valid instruction
 	return true;
 }
 
+bool LC3Arch::ThreadedPath()
+{
+	Register &PC = *pPC, &IR = *pIR, &MCR = *pMCR;
+	LC3ISA::Word OldPC = PC.Value, OldIR = IR.Value;
+
+	//Make sure the clock is started.
+	if(MCR[15] != 1)
+	{
+		TheSim.SimCallBack(Info, "Restarted the clock.");
+		MCR.SetBit(15, 1);
+		TheSim.RegisterEvent(sMMIOSet, MCR, (EventEnum)(WriteEvent | ValueEvent | ChangeEvent));
+	}
+	TheSim.RegisterEvent(sMMIOSet, MCR, ReadEvent);
+
+	//Get the next instruction
+	DecodedInstruction Instr = Fetch(OldPC);
+	IR = Instr.Binary;
+	TheSim.RegisterEvent(sControlSet, IR, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGED(OldIR, IR)));
+
+	//Check for interrupts
+	if(!InterruptList.empty() && ProcessInterrupt())
+		return true;
+	Counters.Instruction(Instr.Opcode, OldPC);
+
+	//Process the instruction
+	Instr.Execute(this, Instr);
+
+	//The PC always changes
+	TheSim.RegisterEvent(sControlSet, PC, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGED(OldPC, PC)));
+
+	//Flag the next instruction, as in DataPath
+	TheSim.InstructionEvent(PC.Value << LC3ISA::Addressability);
+
+	return true;
+}
+
+void LC3Arch::WriteResult(unsigned char DR, LC3ISA::Word Value)
+{
+	Register &Dest = *pR[DR], &PSR = *pPSR;
+	LC3ISA::Word Old = Dest.Value;
+
+	Dest = Value;
+	TheSim.RegisterEvent(sRegFileSet, Dest, (EventEnum)(WriteEvent | ValueEvent | CHANGED(Old, Dest)));
+
+	Old = PSR.Value; SetCC(Value);
+	TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGED(Old, PSR)));
+}
+
+void LC3Arch::ExecuteAdd(LC3Arch *pThis, const DecodedInstruction &Instr)
+{
+	LC3ISA::Word Value = R(Instr.SR1).Value + R(Instr.SR2).Value;
+	pThis->TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+	pThis->TheSim.RegisterEvent(sRegFileSet, R(Instr.SR2), ReadEvent);
+	pThis->WriteResult(Instr.DR, Value);
+	*pThis->pPC = pThis->pPC->Value + 1;
+}
+
+void LC3Arch::ExecuteAddImm(LC3Arch *pThis, const DecodedInstruction &Instr)
+{
+	LC3ISA::Word Value = R(Instr.SR1).Value + Instr.Imm;
+	pThis->TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+	pThis->WriteResult(Instr.DR, Value);
+	*pThis->pPC = pThis->pPC->Value + 1;
+}
+
+void LC3Arch::ExecuteAnd(LC3Arch *pThis, const DecodedInstruction &Instr)
+{
+	LC3ISA::Word Value = R(Instr.SR1).Value & R(Instr.SR2).Value;
+	pThis->TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+	pThis->TheSim.RegisterEvent(sRegFileSet, R(Instr.SR2), ReadEvent);
+	pThis->WriteResult(Instr.DR, Value);
+	*pThis->pPC = pThis->pPC->Value + 1;
+}
+
+void LC3Arch::ExecuteAndImm(LC3Arch *pThis, const DecodedInstruction &Instr)
+{
+	LC3ISA::Word Value = R(Instr.SR1).Value & Instr.Imm;
+	pThis->TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+	pThis->WriteResult(Instr.DR, Value);
+	*pThis->pPC = pThis->pPC->Value + 1;
+}
+
+void LC3Arch::ExecuteBr(LC3Arch *pThis, const DecodedInstruction &Instr)
+{
+	Register &PC = *pThis->pPC, &PSR = *pThis->pPSR;
+
+	//The NZP bits of the instruction line up with the condition codes in the PSR
+	bool fBranch = (PSR.Value & Instr.Flags) != 0;
+	pThis->TheSim.RegisterEvent(sControlSet, PSR, ReadEvent);
+	pThis->Counters.Branch(fBranch);
+	if(Instr.Flags != 0 && Instr.Flags != 7)
+		pThis->Branches.Branch(PC.Value, fBranch);
+
+	if(fBranch)
+		PC = PC.Value + 1 + Instr.Imm;
+	else
+		PC = PC.Value + 1;
+}
+
+void LC3Arch::ExecuteJsr(LC3Arch *pThis, const DecodedInstruction &Instr)
+{
+	Register &PC = *pThis->pPC;
+	LC3ISA::Word OldPC = PC.Value, Old = R(7).Value;
+
+	R(7) = PC.Value + 1;
+	pThis->TheSim.RegisterEvent(sRegFileSet, R(7), (EventEnum)(WriteEvent | ValueEvent | CHANGED(Old, R(7))));
+	PC = PC.Value + 1 + Instr.Imm;
+	pThis->Branches.Call(R(7).Value);
+	pThis->TheSim.SubInEvent(OldPC, PC);
+}
+
+void LC3Arch::ExecuteJsrr(LC3Arch *pThis, const DecodedInstruction &Instr)
+{
+	Register &PC = *pThis->pPC;
+	LC3ISA::Word OldPC = PC.Value, Old = R(7).Value;
+
+	//R7 is written first, so JSRR R7 jumps to the next instruction
+	R(7) = PC.Value + 1;
+	pThis->TheSim.RegisterEvent(sRegFileSet, R(7), (EventEnum)(WriteEvent | ValueEvent | CHANGED(Old, R(7))));
+	PC = R(Instr.SR1).Value;
+	pThis->TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+	pThis->Branches.Jump(OldPC, PC.Value);
+	pThis->Branches.Call(R(7).Value);
+	pThis->TheSim.SubInEvent(OldPC, PC);
+}
+
+void LC3Arch::ExecuteTrap(LC3Arch *pThis, const DecodedInstruction &Instr)
+{
+	Register &PC = *pThis->pPC;
+	LC3ISA::Word OldPC = PC.Value, Old = R(7).Value;
+
+	R(7) = PC.Value + 1;
+	pThis->TheSim.RegisterEvent(sRegFileSet, R(7), (EventEnum)(WriteEvent | ValueEvent | CHANGED(Old, R(7))));
+	PC = pThis->DataRead(Instr.Imm, 2, 16);
+	pThis->Branches.Call(R(7).Value);
+	pThis->TheSim.SubInEvent(OldPC, PC);
+}
+
+void LC3Arch::ExecuteJmp(LC3Arch *pThis, const DecodedInstruction &Instr)
+{
+	pThis->Branches.Jump(pThis->pPC->Value, R(Instr.SR1).Value);
+	*pThis->pPC = R(Instr.SR1).Value;
+	pThis->TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+}
+
+void LC3Arch::ExecuteRet(LC3Arch *pThis, const DecodedInstruction &Instr)
+{
+	pThis->Branches.Return(pThis->pPC->Value, R(7).Value);
+	*pThis->pPC = R(7).Value;
+	pThis->TheSim.RegisterEvent(sRegFileSet, R(7), ReadEvent);
+	pThis->TheSim.SubOutEvent();
+}
+
+void LC3Arch::ExecuteLea(LC3Arch *pThis, const DecodedInstruction &Instr)
+{
+	pThis->WriteResult(Instr.DR, pThis->pPC->Value + 1 + Instr.Imm);
+	*pThis->pPC = pThis->pPC->Value + 1;
+}
+
+void LC3Arch::ExecuteLd(LC3Arch *pThis, const DecodedInstruction &Instr)
+{
+	pThis->WriteResult(Instr.DR, pThis->DataRead(pThis->pPC->Value + 1 + Instr.Imm, 2, 16));
+	*pThis->pPC = pThis->pPC->Value + 1;
+}
+
+void LC3Arch::ExecuteLdi(LC3Arch *pThis, const DecodedInstruction &Instr)
+{
+	LC3ISA::Word Address = pThis->DataRead(pThis->pPC->Value + 1 + Instr.Imm, 2, 16);
+	pThis->WriteResult(Instr.DR, pThis->DataRead(Address, 2, 16));
+	*pThis->pPC = pThis->pPC->Value + 1;
+}
+
+void LC3Arch::ExecuteLdr(LC3Arch *pThis, const DecodedInstruction &Instr)
+{
+	LC3ISA::Word Value = pThis->DataRead(R(Instr.SR1).Value + Instr.Imm, 2, 16);
+	pThis->TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+	pThis->WriteResult(Instr.DR, Value);
+	*pThis->pPC = pThis->pPC->Value + 1;
+}
+
+void LC3Arch::ExecuteSt(LC3Arch *pThis, const DecodedInstruction &Instr)
+{
+	pThis->DataWrite(pThis->pPC->Value + 1 + Instr.Imm, 2, R(Instr.DR).Value, 16);
+	pThis->TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), ReadEvent);
+	*pThis->pPC = pThis->pPC->Value + 1;
+}
+
+void LC3Arch::ExecuteSti(LC3Arch *pThis, const DecodedInstruction &Instr)
+{
+	LC3ISA::Word Address = pThis->DataRead(pThis->pPC->Value + 1 + Instr.Imm, 2, 16);
+	pThis->DataWrite(Address, 2, R(Instr.DR).Value, 16);
+	pThis->TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), ReadEvent);
+	*pThis->pPC = pThis->pPC->Value + 1;
+}
+
+void LC3Arch::ExecuteStr(LC3Arch *pThis, const DecodedInstruction &Instr)
+{
+	pThis->DataWrite(R(Instr.SR1).Value + Instr.Imm, 2, R(Instr.DR).Value, 16);
+	pThis->TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+	pThis->TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), ReadEvent);
+	*pThis->pPC = pThis->pPC->Value + 1;
+}
+
+void LC3Arch::ExecuteNot(LC3Arch *pThis, const DecodedInstruction &Instr)
+{
+	LC3ISA::Word Value = ~R(Instr.SR1).Value;
+	pThis->TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+	pThis->WriteResult(Instr.DR, Value);
+	*pThis->pPC = pThis->pPC->Value + 1;
+}
+
+void LC3Arch::ExecuteRti(LC3Arch *pThis, const DecodedInstruction &Instr)
+{
+	ArchSim<LC3ISA> &TheSim = pThis->TheSim;
+	Register &PC = *pThis->pPC, &PSR = *pThis->pPSR, &SSP = *pThis->pSSP, &USP = *pThis->pUSP;
+	LC3ISA::Word Old, Temp;
+
+	if(PSR[15] == 0)
+	{
+		PC = pThis->DataRead(R(6).Value, 2, 16);
+		Old = R(6).Value; R(6) = R(6).Value + 1;
+		TheSim.RegisterEvent(sRegFileSet, R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGED(Old, R(6))));
+
+		Temp = pThis->DataRead(R(6).Value, 2, 16);
+		Old = R(6).Value; R(6) = R(6).Value + 1;
+		TheSim.RegisterEvent(sRegFileSet, R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGED(Old, R(6))));
+		Old = PSR.Value; PSR = Temp;
+		TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGED(Old, PSR)));
+		TheSim.SubOutEvent();
+
+		//Save the supervisor stack
+		Old = SSP.Value; SSP = R(6).Value;
+		TheSim.RegisterEvent(sRegFileSet, R(6), ReadEvent);
+		TheSim.RegisterEvent(sControlSet, SSP, (EventEnum)(WriteEvent | ValueEvent | CHANGED(Old, SSP)));
+
+		//R6 gets the stack pointer
+		Register &SP = PSR[15] ? USP : SSP;
+		Old = R(6).Value; R(6) = SP.Value;
+		TheSim.RegisterEvent(sControlSet, SP, ReadEvent);
+		TheSim.RegisterEvent(sRegFileSet, R(6), (EventEnum)(WriteEvent | ValueEvent | CHANGED(Old, R(6))));
+		TheSim.RegisterEvent(sControlSet, PSR, ReadEvent);
+	}
+	else	//Privilege mode exception
+	{
+		TheSim.RegisterEvent(sControlSet, PSR, ReadEvent);
+		TheSim.SimCallBack(JMT::Exception, "RTI instruction executed with user privilege.");
+		PC = PC.Value + 1;
+		pThis->Exception(0);
+	}
+}
+
+void LC3Arch::ExecuteInvalid(LC3Arch *pThis, const DecodedInstruction &Instr)
+{
+	pThis->TheSim.SimCallBack(JMT::Exception, "Invalid instruction.");
+	*pThis->pPC = pThis->pPC->Value + 1;
+	pThis->Exception(1);
+}
+
+LC3Arch::DecodedInstruction LC3Arch::Decode(LC3ISA::Word Binary)
+{
+	LC3ISA::LC3Instruction Instr;
+	DecodedInstruction Decoded;
+
+	Instr.Binary = Binary;
+	Decoded.Binary = Binary;
+	Decoded.Imm = 0;
+	Decoded.Opcode = Instr.Base.Opcode;
+	Decoded.DR = Decoded.SR1 = Decoded.SR2 = 0;
+	Decoded.Flags = 0;
+
+	switch(Instr.Base.Opcode)
+	{
+	case 0x1:	//vOpcodes[ADD]:
+		Decoded.DR = Instr.Add.DR;
+		Decoded.SR1 = Instr.Add.SR1;
+		if(Instr.Add.UseImm)
+		{
+			Decoded.Flags = 1;
+			Decoded.Imm = SEXT(Instr.AddImm.Imm5, 5);
+			Decoded.Execute = ExecuteAddImm;
+		}
+		else if(Instr.Add.Zeros)
+			Decoded.Opcode = INVALID_OPCODE;
+		else
+		{
+			Decoded.SR2 = Instr.Add.SR2;
+			Decoded.Execute = ExecuteAdd;
+		}
+		break;
+
+	case 0x5:	//vOpcodes[AND]:
+		Decoded.DR = Instr.And.DR;
+		Decoded.SR1 = Instr.And.SR1;
+		if(Instr.And.UseImm)
+		{
+			Decoded.Flags = 1;
+			Decoded.Imm = SEXT(Instr.AndImm.Imm5, 5);
+			Decoded.Execute = ExecuteAndImm;
+		}
+		else if(Instr.And.Zeros)
+			Decoded.Opcode = INVALID_OPCODE;
+		else
+		{
+			Decoded.SR2 = Instr.And.SR2;
+			Decoded.Execute = ExecuteAnd;
+		}
+		break;
+
+	case 0x0:	//vOpcodes[BR]:
+		Decoded.Flags = (Instr.Br.N << N) | (Instr.Br.Z << Z) | (Instr.Br.P << P);
+		Decoded.Imm = SEXT(Instr.Br.Offset9, 9);
+		Decoded.Execute = ExecuteBr;
+		break;
+
+	case 0x4:	//vOpcodes[JSR]:
+		if(Instr.Jsr.JsrType)
+		{
+			Decoded.Flags = 1;
+			Decoded.Imm = SEXT(Instr.Jsr.Offset11, 11);
+			Decoded.Execute = ExecuteJsr;
+		}
+		else if(Instr.Jsrr.Zero2 || Instr.Jsrr.Zero6)
+			Decoded.Opcode = INVALID_OPCODE;
+		else
+		{
+			Decoded.SR1 = Instr.Jsrr.BaseR;
+			Decoded.Execute = ExecuteJsrr;
+		}
+		break;
+
+	case 0xF:	//vOpcodes[TRAP]:
+		if(Instr.Trap.Zeros)
+			Decoded.Opcode = INVALID_OPCODE;
+		else
+		{
+			Decoded.Imm = Instr.Trap.TrapVect8;
+			Decoded.Execute = ExecuteTrap;
+		}
+		break;
+
+	case 0xC:	//vOpcodes[JMP]:
+		if(Instr.Jmp.Zero3 || Instr.Jmp.Zero6)
+			Decoded.Opcode = INVALID_OPCODE;
+		else
+		{
+			Decoded.SR1 = Instr.Jmp.BaseR;
+			Decoded.Execute = Decoded.SR1 == LC3ISA::R7 ? ExecuteRet : ExecuteJmp;
+		}
+		break;
+
+	case 0xE:	//vOpcodes[LEA]:
+		Decoded.DR = Instr.Lea.DR;
+		Decoded.Imm = SEXT(Instr.Lea.Offset9, 9);
+		Decoded.Execute = ExecuteLea;
+		break;
+
+	case 0x2:	//vOpcodes[LD]:
+	case 0xA:	//vOpcodes[LDI]:
+		Decoded.DR = Instr.Ld.DR;
+		Decoded.Imm = SEXT(Instr.Ld.Offset9, 9);
+		Decoded.Execute = Decoded.Opcode == 0x2 ? ExecuteLd : ExecuteLdi;
+		break;
+
+	case 0x6:	//vOpcodes[LDR]:
+		Decoded.DR = Instr.Ldr.DR;
+		Decoded.SR1 = Instr.Ldr.BaseR;
+		Decoded.Imm = SEXT(Instr.Ldr.Offset6, 6);
+		Decoded.Execute = ExecuteLdr;
+		break;
+
+	case 0x3:	//vOpcodes[ST]:
+	case 0xB:	//vOpcodes[STI]:
+		Decoded.DR = Instr.St.SR;
+		Decoded.Imm = SEXT(Instr.St.Offset9, 9);
+		Decoded.Execute = Decoded.Opcode == 0x3 ? ExecuteSt : ExecuteSti;
+		break;
+
+	case 0x7:	//vOpcodes[STR]:
+		Decoded.DR = Instr.Str.SR;
+		Decoded.SR1 = Instr.Str.BaseR;
+		Decoded.Imm = SEXT(Instr.Str.Offset6, 6);
+		Decoded.Execute = ExecuteStr;
+		break;
+
+	case 0x9:	//vOpcodes[NOT]:
+		if(Instr.Not.Ones != 0x3F)
+			Decoded.Opcode = INVALID_OPCODE;
+		else
+		{
+			Decoded.DR = Instr.Not.DR;
+			Decoded.SR1 = Instr.Not.SR;
+			Decoded.Execute = ExecuteNot;
+		}
+		break;
+
+	case 0x8:	//vOpcodes[RTI]:
+		if(Instr.Rti.Zeros)
+			Decoded.Opcode = INVALID_OPCODE;
+		else
+			Decoded.Execute = ExecuteRti;
+		break;
+
+	default:
+		Decoded.Opcode = INVALID_OPCODE;
+	}
+
+	if(Decoded.Opcode == INVALID_OPCODE)
+		Decoded.Execute = ExecuteInvalid;
+	return Decoded;
+}
+
+LC3Arch::DecodedInstruction LC3Arch::Fetch(LC3ISA::Word Address)
+{
+	DecodedInstruction &Cached = DecodeCache[Address];
+	if(Address < 0xFE00)
+		Caches.Fetch((uint64)Address << LC3ISA::Addressability);
+
+	//MMIO reads can have side effects, so they are never cached
+	if(!Cached.fValid || Address >= 0xFE00)
+	{
+		if(Address < 0xFE00)
+			MarkCode(Address);
+		fFetching = true;
+		DecodedInstruction Instr = Decode(DataRead(Address, 2, 16));
+		fFetching = false;
+		if(Address < 0xFE00)
+		{
+			Cached = Instr;
+			Cached.fValid = true;
+		}
+		return Instr;
+	}
+
+	//Log the same events as DataRead
+	for(uint64 i = 0; i < 2; i++)
+	{
+		TheSim.DataEvent((Address << LC3ISA::Addressability) + i, ReadEvent);
+		TheSim.MemoryEvent(*pDRAM, (Address << LC3ISA::Addressability) + i, ReadEvent);
+	}
+	return Cached;
+}
+
+vector<LC3Arch::DecodedInstruction> &LC3Arch::Translate(LC3ISA::Word Address)
+{
+	vector<DecodedInstruction> &Block = BlockCache[Address];
+	if(!Block.empty())
+		return Block;
+
+	for(unsigned int i = Address; i < 0xFE00 && Block.size() < MAX_BLOCK_INSTRUCTIONS; i++)
+	{
+		//Translation reads memory directly, since nothing is watching the fetch
+		DecodedInstruction &Cached = DecodeCache[i];
+		if(!Cached.fValid)
+		{
+			MarkCode(i);
+			Cached = Decode(pDRAM->Read16(i << LC3ISA::Addressability, LC3ISA::fLittleEndian));
+			Cached.fValid = true;
+		}
+		Block.push_back(Cached);
+		CodeMap[i] = true;
+
+		//Anything that can change the flow of control ends the block
+		switch(Cached.Opcode)
+		{
+		case 0x0:	//vOpcodes[BR]:
+		case 0x4:	//vOpcodes[JSR]:
+		case 0xF:	//vOpcodes[TRAP]:
+		case 0xC:	//vOpcodes[JMP]:
+		case 0x8:	//vOpcodes[RTI]:
+		case INVALID_OPCODE:
+			return Block;
+		}
+	}
+
+	return Block;
+}
+
+void LC3Arch::InvalidateDecode(const RamImage &MemoryImage)
+{
+	for(vector<RamImage::Extent>::const_iterator ExtentIter = MemoryImage.Extents.begin(); ExtentIter != MemoryImage.Extents.end(); ExtentIter++)
+	{
+		uint64 Last = (ExtentIter->first + ExtentIter->second.size() - 1) >> LC3ISA::Addressability;
+		for(uint64 Address = ExtentIter->first >> LC3ISA::Addressability; Address <= Last && Address < DecodeCache.size(); Address++)
+			InvalidateDecode((LC3ISA::Word)Address);
+	}
+}
+
+void LC3Arch::InvalidateDecode(LC3ISA::Word Address)
+{
+	DecodeCache[Address].fValid = false;
+	if(!CodeMap[Address])
+		return;
+
+	//Any block which contains this address starts at most
+	//MAX_BLOCK_INSTRUCTIONS - 1 words before it
+	unsigned int Start = Address < MAX_BLOCK_INSTRUCTIONS ? 0 : Address - (MAX_BLOCK_INSTRUCTIONS - 1);
+	for(unsigned int i = Start; i <= Address; i++)
+	{
+		if(i + BlockCache[i].size() > Address)
+		{
+			BlockCache[i].clear();
+			CompiledBlocks[i] = NULL;
+			fBlockFlushed = true;
+		}
+	}
+}
+
+void LC3Arch::InvalidateDecode()
+{
+	DecodeCache.assign(DecodeCache.size(), DecodedInstruction());
+	for(unsigned int i = 0; i < BlockCache.size(); i++)
+		BlockCache[i].clear();
+	CodeMap.assign(CodeMap.size(), false);
+	//Compiled code is only overwritten by the next Compile, which is
+	//between blocks
+	Compiler.Clear();
+	CompiledBlocks.assign(CompiledBlocks.size(), NULL);
+	fBlockFlushed = true;
+}
+
 LC3ISA::Word LC3Arch::SEXT(LC3ISA::Word Value, unsigned char Bits)
 {
 	LC3ISA::Word BitMask = Bits ? ((LC3ISA::Word)1 << (Bits - 1)) : 0;
@@ -472,14 +1317,6 @@ void LC3Arch::SetCC(signed short Value)
 	*pPSR = (*pPSR & ~0x7) | (Value < 0 ? (1 << N) : 0) | (Value == 0 ? (1 << Z) : 0) | (Value > 0 ? (1 << P) : 0);
 }
 
-LC3ISA::Word LC3Arch::MakeInt(const RamVector &vData, unsigned char Bits, ArchSim<LC3ISA> &TheSim)
-{
-	uint64 TempInt64;
-	IntegerNumber Int(NullLocationStack, vData, LC3ISA::fLittleEndian);
-	Int.Int(Bits, false, TempInt64, TheSim.CallBack);
-	return TempInt64;
-}
-
 bool LC3Arch::Exception(uint64 Vector)
 {
 	LC3Arch *pThis = this;
@@ -513,41 +1350,42 @@ bool LC3Arch::Exception(uint64 Vector)
 	if(PSR[15])
 	{
 		TR = USP; USP = R(6);
-		TheSim.RegisterEvent("regfile", R(6), ReadEvent);
-		TheSim.RegisterEvent("control", USP, (EventEnum)(WriteEvent | ValueEvent | CHANGE(USP)));
+		TheSim.RegisterEvent(sRegFileSet, R(6), ReadEvent);
+		TheSim.RegisterEvent(sControlSet, USP, (EventEnum)(WriteEvent | ValueEvent | CHANGE(USP)));
 	}
 	else
 	{
 		TR = SSP; SSP = R(6);
-		TheSim.RegisterEvent("regfile", R(6), ReadEvent);
-		TheSim.RegisterEvent("control", SSP, (EventEnum)(WriteEvent | ValueEvent | CHANGE(SSP)));
+		TheSim.RegisterEvent(sRegFileSet, R(6), ReadEvent);
+		TheSim.RegisterEvent(sControlSet, SSP, (EventEnum)(WriteEvent | ValueEvent | CHANGE(SSP)));
 	}
-	TheSim.RegisterEvent("control", PSR, ReadEvent);
+	TheSim.RegisterEvent(sControlSet, PSR, ReadEvent);
 
 	//R6 gets the supervisor stack pointer
 	TR = R(6); R(6) = SSP;
-	TheSim.RegisterEvent("control", SSP, ReadEvent);
-	TheSim.RegisterEvent("regfile", R(6), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(6))));
+	TheSim.RegisterEvent(sControlSet, SSP, ReadEvent);
+	TheSim.RegisterEvent(sRegFileSet, R(6), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(6))));
 	
 	//Save PSR and PC to the stack
 	TR = R(6); R(6) = R(6) + -1;
-	TheSim.RegisterEvent("regfile", R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
+	TheSim.RegisterEvent(sRegFileSet, R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
 	DataWrite(R(6), 2, PSR, 16);
-	TheSim.RegisterEvent("control", PSR, ReadEvent);
+	TheSim.RegisterEvent(sControlSet, PSR, ReadEvent);
 	TR = R(6); R(6) = R(6) + -1;
-	TheSim.RegisterEvent("regfile", R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
+	TheSim.RegisterEvent(sRegFileSet, R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
 	DataWrite(R(6), 2, PC, 16);
-	TheSim.RegisterEvent("control", PC, ReadEvent);
+	TheSim.RegisterEvent(sControlSet, PC, ReadEvent);
 
 	//Update PSR
 	TR = PSR; PSR = PSR & 700;
-	TheSim.RegisterEvent("control", PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
+	TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
 
 	//Load the handler address into the PC
 	TR = PC; PC = DataRead(Vector, 2, 16);
-	TheSim.RegisterEvent("control", PC, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PC)));
+	TheSim.RegisterEvent(sControlSet, PC, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PC)));
 	TheSim.SubInEvent(TR, PC);
 
+	Counters.Exception();
 	TheSim.Exception();
 	TheSim.InstructionEvent(PC << LC3ISA::Addressability);
 	return true;
@@ -584,7 +1422,7 @@ bool LC3Arch::ProcessInterrupt()
 		if( ((PSR & 0x700) >> 8) >= NewPriority )
 		{
 			//The priority of the executing program is too high, do not process
-			TheSim.RegisterEvent("control", PSR, ReadEvent);
+			TheSim.RegisterEvent(sControlSet, PSR, ReadEvent);
 /*			if(TheSim.fCheck)
 			{
 				sprintf(sMessageBuffer, "Executing program priority level (%u) higher than keyboard interrupt priority level (%u); interrupt not processed.", ((PSR & 0x700) >> 8), NewPriority);
@@ -592,17 +1430,17 @@ bool LC3Arch::ProcessInterrupt()
 			}*/
 			return false;
 		}
-		TheSim.RegisterEvent("control", PSR, ReadEvent);
+		TheSim.RegisterEvent(sControlSet, PSR, ReadEvent);
 
 		if(!KBSR[0])
 		{
 			//Keyboard interrupt is disabled
-			TheSim.RegisterEvent("mmio", KBSR, ReadEvent);
+			TheSim.RegisterEvent(sMMIOSet, KBSR, ReadEvent);
 //			if(TheSim.fCheck)
 //				TheSim.SimCallBack(Info, "Keyboard interrupt is disabled; interrupt not processed.");
 			return false;
 		}
-		TheSim.RegisterEvent("mmio", KBSR, ReadEvent);
+		TheSim.RegisterEvent(sMMIOSet, KBSR, ReadEvent);
 		break;
 
 	default:
@@ -612,6 +1450,7 @@ bool LC3Arch::ProcessInterrupt()
 		return false;
 	}
 	InterruptList.pop_front();
+	Counters.Interrupt();
 
 	//Convert a vector number into an address
 	Vector = (Vector & 0xFF) | 0x100;
@@ -620,39 +1459,39 @@ bool LC3Arch::ProcessInterrupt()
 	if(PSR[15])
 	{
 		TR = USP; USP = R(6);
-		TheSim.RegisterEvent("regfile", R(6), ReadEvent);
-		TheSim.RegisterEvent("control", USP, (EventEnum)(WriteEvent | ValueEvent | CHANGE(USP)));
+		TheSim.RegisterEvent(sRegFileSet, R(6), ReadEvent);
+		TheSim.RegisterEvent(sControlSet, USP, (EventEnum)(WriteEvent | ValueEvent | CHANGE(USP)));
 	}
 	else
 	{
 		TR = SSP; SSP = R(6);
-		TheSim.RegisterEvent("regfile", R(6), ReadEvent);
-		TheSim.RegisterEvent("control", SSP, (EventEnum)(WriteEvent | ValueEvent | CHANGE(SSP)));
+		TheSim.RegisterEvent(sRegFileSet, R(6), ReadEvent);
+		TheSim.RegisterEvent(sControlSet, SSP, (EventEnum)(WriteEvent | ValueEvent | CHANGE(SSP)));
 	}
-	TheSim.RegisterEvent("control", PSR, ReadEvent);
+	TheSim.RegisterEvent(sControlSet, PSR, ReadEvent);
 
 	//R6 gets the supervisor stack pointer
 	TR = R(6); R(6) = SSP;
-	TheSim.RegisterEvent("control", SSP, ReadEvent);
-	TheSim.RegisterEvent("regfile", R(6), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(6))));
+	TheSim.RegisterEvent(sControlSet, SSP, ReadEvent);
+	TheSim.RegisterEvent(sRegFileSet, R(6), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(6))));
 	
 	//Save PSR and PC to the stack
 	TR = R(6); R(6) = R(6) + -1;
-	TheSim.RegisterEvent("regfile", R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
+	TheSim.RegisterEvent(sRegFileSet, R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
 	DataWrite(R(6), 2, PSR, 16);
-	TheSim.RegisterEvent("control", PSR, ReadEvent);
+	TheSim.RegisterEvent(sControlSet, PSR, ReadEvent);
 	TR = R(6); R(6) = R(6) + -1;
-	TheSim.RegisterEvent("regfile", R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
+	TheSim.RegisterEvent(sRegFileSet, R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
 	DataWrite(R(6), 2, PC, 16);
-	TheSim.RegisterEvent("control", PC, ReadEvent);
+	TheSim.RegisterEvent(sControlSet, PC, ReadEvent);
 
 	//Update PSR
 	TR = PSR; PSR = (NewPriority << 8);
-	TheSim.RegisterEvent("control", PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
+	TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
 
 	//Load the handler address into the PC
 	TR = PC; PC = DataRead(Vector, 2, 16);
-	TheSim.RegisterEvent("control", PC, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PC)));
+	TheSim.RegisterEvent(sControlSet, PC, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PC)));
 	TheSim.SubInEvent(TR, PC);
 
 	TheSim.InstructionEvent(PC << LC3ISA::Addressability);
@@ -663,11 +1502,15 @@ LC3ISA::Word LC3Arch::DataRead(LC3ISA::Word Address, unsigned char Bytes, unsign
 {
 	LC3ISA::Word BitMask = ((LC3ISA::Word)1 << Bits) - 1;
 	LC3ISA::Word Value;
-	RamVector vData;
 	Register &KBSR = *pKBSR, &KBDR = *pKBDR, &DSR = *pDSR, &DDR = *pDDR, &MCR = *pMCR, TR("", 64);
 	bool fRetVal;
 
 	//Second check for Memory-mapped IO
+	if(Address >= 0xFE00)
+	{
+		fMMIOAccess = true;
+		Counters.MMIORead();
+	}
 	string sInput;
 	switch(Address)
 	{
@@ -678,34 +1521,34 @@ LC3ISA::Word LC3Arch::DataRead(LC3ISA::Word Address, unsigned char Bytes, unsign
 		if(CharsRead)
 		{
 			TR = KBSR; KBSR.SetBit(15, 1);
-			TheSim.RegisterEvent("mmio", KBSR, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(KBSR)));
+			TheSim.RegisterEvent(sMMIOSet, KBSR, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(KBSR)));
 			TR = KBDR; KBDR = sInput[0];
-			TheSim.RegisterEvent("mmio", KBDR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(KBDR)));
+			TheSim.RegisterEvent(sMMIOSet, KBDR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(KBDR)));
 		}
 		else if(!fRetVal)	//CTRL-C gave EOF or Error signal
 		{
 			TR = KBSR; KBSR.SetBit(15, 1);
-			TheSim.RegisterEvent("mmio", KBSR, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(KBSR)));
+			TheSim.RegisterEvent(sMMIOSet, KBSR, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(KBSR)));
 			TR = KBDR; KBDR = -1;
-			TheSim.RegisterEvent("mmio", KBDR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(KBDR)));
+			TheSim.RegisterEvent(sMMIOSet, KBDR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(KBDR)));
 		}
 		else	//CTRL-D  gave "no input"
 		{
 			TR = KBSR; KBSR.SetBit(15, 0);
-			TheSim.RegisterEvent("mmio", KBSR, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(KBSR)));
+			TheSim.RegisterEvent(sMMIOSet, KBSR, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(KBSR)));
 		}
 		Value = KBSR;
 		break;
 	case KBDR_ADDRESS:
 		Value = KBDR;
-		TheSim.RegisterEvent("mmio", KBDR, ReadEvent);
+		TheSim.RegisterEvent(sMMIOSet, KBDR, ReadEvent);
 		TR = KBSR; KBSR.SetBit(15, 0);
-		TheSim.RegisterEvent("mmio", KBSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(KBSR)));
+		TheSim.RegisterEvent(sMMIOSet, KBSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(KBSR)));
 		break;
 	case DSR_ADDRESS:
 		//The display is always ready
 		TR = DSR; DSR.SetBit(15, 1);
-		TheSim.RegisterEvent("mmio", DSR, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(DSR)));
+		TheSim.RegisterEvent(sMMIOSet, DSR, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(DSR)));
 		Value = DSR;
 		break;
 	case DDR_ADDRESS:
@@ -714,19 +1557,35 @@ LC3ISA::Word LC3Arch::DataRead(LC3ISA::Word Address, unsigned char Bytes, unsign
 		break;
 	case MCR_ADDRESS:
 		Value = MCR;
-		TheSim.RegisterEvent("mmio", MCR, ReadEvent);
+		TheSim.RegisterEvent(sMMIOSet, MCR, ReadEvent);
 		break;
+	case CIDR_ADDRESS:
+	case CCR_ADDRESS:
+		//Only a core of a system has the multiprocessor registers
+		if(pSystem != &LocalSystem)
+		{
+			Value = Address == CIDR_ADDRESS ? CoreID : pSystem->Cores;
+			break;
+		}
+		//Fall through
 	default:	//No MMIO
+		if(pSystem != &LocalSystem && Address >= LOCK_ADDRESS && Address < LOCK_ADDRESS + 2 * LOCK_COUNT && !((Address - LOCK_ADDRESS) & 1))
+		{
+			//Test and set
+			Value = (LC3ISA::Word)ATOMIC_COMPARE_EXCHANGE(pSystem->Locks[(Address - LOCK_ADDRESS) >> 1], 1, 0);
+			break;
+		}
 		if(Address >= 0xFE00)
 		{
 			//read to undefined MMIO locations
 			sprintf(sMessageBuffer, "Read to undefined MMIO location (4x%x).", Address);
 			TheSim.SimCallBack(Warning, sMessageBuffer);
 		}
+		else if(!fFetching)
+			Caches.Read((uint64)Address << LC3ISA::Addressability);
 
-		pDRAM->Read(vData, Address << LC3ISA::Addressability, Bytes, TheSim.SimCallBack);
-		Value = MakeInt(vData, Bits, TheSim);
-		for(uint64 i = 0; i < Bytes; Bytes++)
+		Value = (LC3ISA::Word)pDRAM->ReadInt(Address << LC3ISA::Addressability, Bytes, LC3ISA::fLittleEndian);
+		for(uint64 i = 0; i < Bytes; i++)
 		{
 			TheSim.DataEvent((Address << LC3ISA::Addressability) + i, ReadEvent);
 			TheSim.MemoryEvent(*pDRAM, (Address << LC3ISA::Addressability) + i, ReadEvent);
@@ -739,37 +1598,41 @@ LC3ISA::Word LC3Arch::DataRead(LC3ISA::Word Address, unsigned char Bytes, unsign
 void LC3Arch::DataWrite(LC3ISA::Word Address, unsigned char Bytes, LC3ISA::Word Value, unsigned char Bits)
 {
 	Value &= ((LC3ISA::Word)1 << Bits) - 1;
-	RamVector vTData, vData;
 	Register &KBSR = *pKBSR, &KBDR = *pKBDR, &DSR = *pDSR, &DDR = *pDDR, &MCR = *pMCR, TR("", 64);
 
 	//Second check for Memory-mapped IO
+	if(Address >= 0xFE00)
+	{
+		fMMIOAccess = true;
+		Counters.MMIOWrite();
+	}
 	string sOutput;
 	switch(Address)
 	{
 	case KBSR_ADDRESS:
 		//Can only write to interrupt enable bit
 		KBSR.SetBit(0, Value & 1);
-		TheSim.RegisterEvent("mmio", KBSR, (EventEnum)(WriteEvent | ValueEvent));
+		TheSim.RegisterEvent(sMMIOSet, KBSR, (EventEnum)(WriteEvent | ValueEvent));
 		break;
 	case KBDR_ADDRESS:
 		//No write to this reg
 		//KBDR = Value;
-		//TheSim.RegisterEvent("mmio", KBDR, (EventEnum)(WriteEvent | ValueEvent));
+		//TheSim.RegisterEvent(sMMIOSet, KBDR, (EventEnum)(WriteEvent | ValueEvent));
 		break;
 	case DSR_ADDRESS:
 		//No write to this reg
 		//DSR = Value;
-		//TheSim.RegisterEvent("control", pDSR->sName, (EventEnum)(WriteEvent | ValueEvent), DSR);
+		//TheSim.RegisterEvent(sControlSet, pDSR->sName, (EventEnum)(WriteEvent | ValueEvent), DSR);
 		break;
 	case DDR_ADDRESS:
 		//Try to write one char to the screen
 		TR = DSR; DSR.SetBit(15, 0);
-		TheSim.RegisterEvent("mmio", DSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(DSR)));
+		TheSim.RegisterEvent(sMMIOSet, DSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(DSR)));
 		unsigned int CharsWritten;
 		sOutput += (char)Value;
 		TR = DDR; DDR = Value;
 		TheSim.WriteConsole(sOutput, 1, CharsWritten);
-		TheSim.RegisterEvent("mmio", DDR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(DDR)));
+		TheSim.RegisterEvent(sMMIOSet, DDR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(DDR)));
 		break;
 	case MCR_ADDRESS:
 		TR = MCR; MCR = Value;
@@ -778,33 +1641,63 @@ void LC3Arch::DataWrite(LC3ISA::Word Address, unsigned char Bytes, LC3ISA::Word
 			TheSim.SimCallBack(JMT::Exception, "Program has stopped the clock. Continuing execution will restart the clock.");
 			TheSim.Exception();
 		}
-		TheSim.RegisterEvent("mmio", MCR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(MCR)));
+		TheSim.RegisterEvent(sMMIOSet, MCR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(MCR)));
 		break;
+	case CIDR_ADDRESS:
+	case CCR_ADDRESS:
+		//No write to these regs of a core of a system
+		if(pSystem != &LocalSystem)
+			break;
+		//Fall through
 	default:	//No MMIO
+		if(pSystem != &LocalSystem && Address >= LOCK_ADDRESS && Address < LOCK_ADDRESS + 2 * LOCK_COUNT && !((Address - LOCK_ADDRESS) & 1))
+		{
+			//The owner's writes must be seen before the lock is released
+			ATOMIC_STORE(pSystem->Locks[(Address - LOCK_ADDRESS) >> 1], Value & 1)
+			break;
+		}
 		if(Address >= 0xFE00)
 		{
 			//write to undefined MMIO locations
 			sprintf(sMessageBuffer, "Write to undefined MMIO location (4x%x).", Address);
 			TheSim.SimCallBack(Warning, sMessageBuffer);
 		}
+		else
+			Caches.Write((uint64)Address << LC3ISA::Addressability);
 
-		pDRAM->Read(vTData, (Address << LC3ISA::Addressability), Bytes, TheSim.SimCallBack);
-		uint64 i;
-		for(i = 0; i < Bytes; i++) 
-			vData.push_back( RamVector::value_type((Address << LC3ISA::Addressability) + i, (Value >> (i*8)) & 0xFF) );
-		pDRAM->Write(vData, TheSim.SimCallBack);
-		for(i = 0; i < Bytes; i++)
+		uint64 OldValue = pDRAM->ReadInt(Address << LC3ISA::Addressability, Bytes, LC3ISA::fLittleEndian);
+		pDRAM->WriteInt(Address << LC3ISA::Addressability, Bytes, Value, LC3ISA::fLittleEndian);
+		InvalidateDecode(Address);
+		if(pSystem->Cores > 1)
+		{
+			//The write must be seen before the mark is checked, the
+			//opposite order to MarkCode
+			MEMORY_BARRIER()
+			if(ATOMIC_LOAD(pSystem->CodeWords[Address]))
+			{
+				uint64 Writes;
+				do
+					Writes = ATOMIC_LOAD(pSystem->CodeWrites);
+				while(ATOMIC_COMPARE_EXCHANGE(pSystem->CodeWrites, Writes + 1, Writes) != Writes);
+				//This core's own decodes were invalidated above
+				if(SeenCodeWrites == Writes)
+					SeenCodeWrites = Writes + 1;
+			}
+		}
+		for(uint64 i = 0; i < Bytes; i++)
 		{
-			TheSim.DataEvent((Address << LC3ISA::Addressability) + i, (EventEnum)(WriteEvent | ValueEvent | (vData == vTData ? NoEvent : ChangeEvent)));
-			TheSim.MemoryEvent(*pDRAM, (Address << LC3ISA::Addressability) + i, (EventEnum)(WriteEvent | ValueEvent | (vData == vTData ? NoEvent : ChangeEvent)));
-			vData.erase(vData.begin());
-			vTData.erase(vTData.begin());
+			//A byte is logged as changed if it or any byte after it changed
+			EventEnum Events = (EventEnum)(WriteEvent | ValueEvent | ((OldValue >> (i*8)) == ((uint64)Value >> (i*8)) ? NoEvent : ChangeEvent));
+			TheSim.DataEvent((Address << LC3ISA::Addressability) + i, Events);
+			TheSim.MemoryEvent(*pDRAM, (Address << LC3ISA::Addressability) + i, Events);
 		}
 	}
 }
 
 istream &LC3Arch::operator <<(istream &Input)
 {
+	//Memory may have been reloaded
+	InvalidateDecode();
 	return Input;
 }
 ostream &LC3Arch::operator >>(ostream &Output) const
@@ -7,6 +7,7 @@
 
 #pragma warning (disable:4786)
 #include "../Simulator/Architecture.h"
+#include "../Simulator/BlockCompiler.h"
 #include "../LC3Assembler/LC3ISA.h"
 #include "../Assembler/Base.h"
 
@@ -25,6 +26,59 @@ namespace LC3
 	const unsigned int DSR_ADDRESS = 0xFE04;
 	const unsigned int DDR_ADDRESS = 0xFE06;
 	const unsigned int MCR_ADDRESS = 0xFFFE;
+	//Multiprocessor registers: this core's ID, the number of cores, and
+	//the first of LOCK_COUNT test-and-set locks, one every 2 words
+	const unsigned int CIDR_ADDRESS = 0xFE08;
+	const unsigned int CCR_ADDRESS = 0xFE0A;
+	const unsigned int LOCK_ADDRESS = 0xFE10;
+	const unsigned int LOCK_COUNT = 8;
+	//Opcode given to illegal instruction encodings when predecoded
+	const unsigned char INVALID_OPCODE = 0x10;
+	//Maximum number of instructions in a translated block
+	const unsigned int MAX_BLOCK_INSTRUCTIONS = 32;
+
+	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
+		LC3System
+
+		The state shared by the cores of a multiprocessor LC-3. Each core is
+		an LC3Arch with its own simulator, and joins the system after it is
+		reset. The first core's memory becomes the memory of every core.
+
+		Each core has its own registers, including the MMIO registers, but
+		they all use the same console. A core reads its ID from CIDR and the
+		number of cores from CCR. Reading a lock register returns the lock
+		and sets it to 1 in one atomic step, so the core which reads 0 owns
+		the lock. Writing 0 releases it. A core which has not joined a
+		system has none of these registers, so their addresses are
+		undefined MMIO locations, read and written as ordinary memory.
+
+		Each core keeps its own decoded instructions. A write to a word
+		which any core has decoded tells every core to discard them, which
+		they do before their next block or cycle.
+
+		Cores may run on their own threads. Word writes are not atomic with
+		respect to the other cores, so shared data should be guarded by a
+		lock.
+	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
+	class LC3System
+	{
+	public:
+		//The shared memory, or NULL until the first core joins
+		Memory *pDRAM;
+		//Number of cores which have joined
+		unsigned int Cores;
+		//The test-and-set locks. Only set with ATOMIC_COMPARE_EXCHANGE, and
+		//released with ATOMIC_STORE.
+		volatile uint64 Locks[LOCK_COUNT];
+		//Nonzero for each word address some core has decoded. Only accessed
+		//with ATOMIC_LOAD and ATOMIC_STORE.
+		vector<unsigned char> CodeWords;
+		//Number of writes to decoded words. Only changed with
+		//ATOMIC_COMPARE_EXCHANGE.
+		volatile uint64 CodeWrites;
+
+		LC3System();
+	};
 
 	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
 		LC3Arch
@@ -47,11 +101,213 @@ namespace LC3
 		enum CCEnum {N = 2, Z = 1, P = 0};
 		//Pending external interrupts
 		list<uint64> InterruptList;
+		//Pending external interrupts saved by TakeSnapshot
+		list<uint64> SnapshotInterrupts;
+
+		//An instruction decoded once and kept for as long as its memory
+		//location is not written.
+		struct DecodedInstruction
+		{
+			//Raw instruction word
+			LC3ISA::Word Binary;
+			//Sign-extended immediate or offset, or the trap vector
+			LC3ISA::Word Imm;
+			//Opcode. Illegal encodings get an opcode that matches no instruction.
+			unsigned char Opcode;
+			//Destination (or store source) register, first source (or base)
+			//register, and second source register
+			unsigned char DR, SR1, SR2;
+			//Immediate operand, JSR (not JSRR), or branch NZP bits
+			unsigned char Flags;
+			//True if this cache entry holds a decoded instruction
+			bool fValid;
+			//Handler which executes the instruction in the threaded engine
+			void (*Execute)(LC3Arch *, const DecodedInstruction &);
+			DecodedInstruction()
+			{
+				fValid = false;
+				Execute = NULL;
+			}
+		};
+		//Predecoded instructions, indexed by instruction word address
+		vector<DecodedInstruction> DecodeCache;
+		//Translated basic blocks, indexed by the address of the first instruction.
+		//An empty block has not been translated.
+		vector< vector<DecodedInstruction> > BlockCache;
+		//True for each instruction word address that is part of a translated block
+		vector<bool> CodeMap;
+		//Compiles the translated blocks for the jit engine
+		BlockCompiler Compiler;
+		//Compiled code of each translated block, or NULL if it has not
+		//been compiled, indexed like BlockCache
+		vector<BlockCompiler::BlockFunction> CompiledBlocks;
+		//Set when a translated block is discarded, so the block engine
+		//stops executing a block that may have been overwritten
+		bool fBlockFlushed;
+		//Set when the datapath accesses an MMIO address
+		bool fMMIOAccess;
+		//Set while Fetch reads an instruction, so that DataRead leaves
+		//the access to the instruction cache
+		bool fFetching;
+
+		//The system this core is part of. Until it joins one, it is the
+		//only core of LocalSystem.
+		LC3System *pSystem, LocalSystem;
+		//This core's index in its system
+		unsigned int CoreID;
+		//The system's CodeWrites when this core last discarded its
+		//decoded instructions
+		uint64 SeenCodeWrites;
+
+		//Discards the decoded instructions if another core has written
+		//over any decoded word since the last check
+		void CheckCodeWrites()
+		{
+			if(pSystem->Cores > 1)
+			{
+				uint64 Writes = ATOMIC_LOAD(pSystem->CodeWrites);
+				if(SeenCodeWrites != Writes)
+				{
+					SeenCodeWrites = Writes;
+					InvalidateDecode();
+				}
+			}
+		}
+
+		/**********************************************************************\
+			MarkCode( [in] address )
+
+			Records in a shared system that the word at the address is
+			about to be decoded. It must be marked before memory is read, so
+			that a write by another core either comes first and is decoded,
+			or sees the mark and invalidates the decode.
+		\******/
+		void MarkCode(LC3ISA::Word Address)
+		{
+			if(pSystem->Cores > 1 && !ATOMIC_LOAD(pSystem->CodeWords[Address]))
+			{
+				ATOMIC_STORE(pSystem->CodeWords[Address], 1)
+				MEMORY_BARRIER()
+			}
+		}
+
+		//Execution engines, in the order they are added to Engines
+		//The jit engine is only added on hosts which can run compiled blocks.
+		enum EngineEnum {PipelineEngine = 0, ThreadedEngine, BlockEngine, CompiledEngine};
 
 		//Pipeline stages
 		//Current implementation only has one pipeline with one stage.
 		static bool DataPath(Architecture *);
 
+		/**********************************************************************\
+			ThreadedPath( )
+
+			Executes one cycle without going through the pipelines. The
+			fetched instruction is dispatched directly to the handler chosen
+			when it was decoded. Architectural state and events are the same
+			as for DataPath.
+		\******/
+		bool ThreadedPath();
+
+		//Instruction handlers for the threaded engine
+		static void ExecuteAdd(LC3Arch *, const DecodedInstruction &);
+		static void ExecuteAddImm(LC3Arch *, const DecodedInstruction &);
+		static void ExecuteAnd(LC3Arch *, const DecodedInstruction &);
+		static void ExecuteAndImm(LC3Arch *, const DecodedInstruction &);
+		static void ExecuteBr(LC3Arch *, const DecodedInstruction &);
+		static void ExecuteJsr(LC3Arch *, const DecodedInstruction &);
+		static void ExecuteJsrr(LC3Arch *, const DecodedInstruction &);
+		static void ExecuteTrap(LC3Arch *, const DecodedInstruction &);
+		static void ExecuteJmp(LC3Arch *, const DecodedInstruction &);
+		static void ExecuteRet(LC3Arch *, const DecodedInstruction &);
+		static void ExecuteLea(LC3Arch *, const DecodedInstruction &);
+		static void ExecuteLd(LC3Arch *, const DecodedInstruction &);
+		static void ExecuteLdi(LC3Arch *, const DecodedInstruction &);
+		static void ExecuteLdr(LC3Arch *, const DecodedInstruction &);
+		static void ExecuteSt(LC3Arch *, const DecodedInstruction &);
+		static void ExecuteSti(LC3Arch *, const DecodedInstruction &);
+		static void ExecuteStr(LC3Arch *, const DecodedInstruction &);
+		static void ExecuteNot(LC3Arch *, const DecodedInstruction &);
+		static void ExecuteRti(LC3Arch *, const DecodedInstruction &);
+		static void ExecuteInvalid(LC3Arch *, const DecodedInstruction &);
+
+		/**********************************************************************\
+			BeginBlockStep( [in] decoded instruction )
+
+			Sets IR before a translated block executes the instruction.
+		\******/
+		void BeginBlockStep(const DecodedInstruction &);
+
+		/**********************************************************************\
+			EndBlockStep( )
+
+			Logs the instruction event after a translated block has executed
+			an instruction. Returns true if the block has to stop, for a
+			break, a discarded block, I/O, or a pending interrupt.
+		\******/
+		bool EndBlockStep();
+
+		//Helper functions of compiled blocks, which read and write memory
+		//and log subroutine calls and returns like the handlers
+		static uint64 CompiledRead(void *, uint64);
+		static uint64 CompiledWrite(void *, uint64, uint64);
+		static uint64 CompiledCall(void *, uint64, uint64);
+		static uint64 CompiledReturn(void *);
+
+		//Returns BlockCompiler::STOP if a compiled block has to stop after
+		//the current instruction, for the same reasons as EndBlockStep
+		uint64 CompiledStop() const;
+
+		/**********************************************************************\
+			CompileOperation( [in] decoded instruction, [in] its address,
+				[out] operation )
+
+			Translates an instruction for the block compiler. Returns false
+			for an instruction which can't be compiled and has to be
+			interpreted: RTI and illegal encodings.
+		\******/
+		static bool CompileOperation(const DecodedInstruction &, LC3ISA::Word, BlockCompiler::Operation &);
+
+		/**********************************************************************\
+			Compile( [in] address )
+
+			Returns the compiled code of the translated block which starts at
+			the given address, compiling it first if necessary. The block
+			has to be translated already. The code stops before the first
+			instruction which can't be compiled, so the rest of the block
+			is interpreted. Returns NULL if none of it can be compiled.
+		\******/
+		BlockCompiler::BlockFunction Compile(LC3ISA::Word);
+
+		/**********************************************************************\
+			CanRunCompiled( [in] instructions in the block, [in] most
+				instructions to execute )
+
+			Compiled code only counts the instructions of a block once it
+			returns, and does not log the events of each instruction. So
+			it only runs blocks which can't pass the instruction limit,
+			while nothing else watches the instructions, and while the
+			condition codes are valid.
+		\******/
+		bool CanRunCompiled(size_t, uint64) const;
+
+		/**********************************************************************\
+			RunCompiled( [in] compiled block )
+
+			Runs a compiled block with this core's registers, and counts
+			its instructions. Returns the number of instructions executed.
+		\******/
+		unsigned int RunCompiled(BlockCompiler::BlockFunction);
+
+		/**********************************************************************\
+			WriteResult( [in] destination register, [in] value )
+
+			Writes the result of an operate or load instruction to the
+			destination register and sets the condition codes, logging the
+			same register events as DataPath.
+		\******/
+		void WriteResult(unsigned char, LC3ISA::Word);
+
 		/**********************************************************************\
 			SEXT( [in] value, [in] bits )
 
@@ -61,20 +317,66 @@ namespace LC3
 		static LC3ISA::Word SEXT(LC3ISA::Word, unsigned char);
 
 		/**********************************************************************\
-			SetCC( [in] value )
+			Decode( [in] instruction word )
 
-			Checks the input value for positive, zero, and negative, and sets
-			the appropriate condition codes.
+			Decodes the instruction word into its opcode, operands, and
+			sign-extended immediate. Illegal encodings are given an
+			opcode that does not match any instruction.
 		\******/
-		void SetCC(signed short);
+		static DecodedInstruction Decode(LC3ISA::Word);
+
+		/**********************************************************************\
+			Fetch( [in] address )
+
+			Reads and decodes the instruction at the given address. The decoded
+			instruction is cached so that the next fetch from the same
+			address skips the memory read and the decode. The data and memory
+			events of the read are logged with the simulator either way.
+			MMIO addresses are never cached.
+		\******/
+		DecodedInstruction Fetch(LC3ISA::Word);
+
+		/**********************************************************************\
+			Translate( [in] address )
+
+			Returns the translated block which starts at the given address,
+			translating it first if necessary. A block ends with the first
+			instruction that can change the flow of control, or after
+			MAX_BLOCK_INSTRUCTIONS. Blocks are never translated from MMIO
+			addresses, so the returned block is empty for those.
+		\******/
+		vector<DecodedInstruction> &Translate(LC3ISA::Word);
 
 		/**********************************************************************\
-			MakeInt( [in] data vector, [in] bits, [in] simulator )
+			InvalidateDecode( [in] memory image )
 
-			Takes a data vector and converts it into an unsigned int of the
-			specified bit length and returns it.
+			Discards the cached decoded instructions and translated blocks
+			that overlap the locations in the memory image.
 		\******/
-		static LC3ISA::Word MakeInt(const RamVector &, unsigned char, ArchSim<LC3ISA> &);
+		void InvalidateDecode(const RamImage &);
+
+		/**********************************************************************\
+			InvalidateDecode( [in] address )
+
+			Discards the cached decoded instruction and the translated blocks
+			that overlap the given instruction word address.
+		\******/
+		void InvalidateDecode(LC3ISA::Word);
+
+		/**********************************************************************\
+			InvalidateDecode( )
+
+			Discards all cached decoded instructions and translated blocks.
+		\******/
+		void InvalidateDecode();
+
+		/**********************************************************************\
+			SetCC( [in] value )
+
+			Checks the input value for positive, zero, and negative, and sets
+			the appropriate condition codes.
+		\******/
+		void SetCC(signed short);
 
 		/**********************************************************************\
 			Exception( [in] exception vector )
@@ -135,11 +437,35 @@ namespace LC3
 
 	public:
 		LC3Arch(ArchSim<LC3ISA> &);
-		virtual bool Reset(const RamVector &);
+
+		/**********************************************************************\
+			JoinSystem( [in-out] system )
+
+			Makes this core the next core of the system. Must be called
+			after the simulator is reset and before any core of the system
+			runs. The first core's memory, with its program, becomes the
+			system's memory, and the others stop using their own. Each core
+			after the first gets its own stack, CORE_STACK_WORDS below the
+			previous core's.
+
+			The shared memory is not snapshotted, so a simulator must not be
+			reset once its core has joined.
+		\******/
+		void JoinSystem(LC3System &);
+		//Words of stack given to each core by JoinSystem
+		static const unsigned int CORE_STACK_WORDS = 0x400;
+
+		virtual bool Run();
+		virtual bool RunCycles(uint64, uint64 &);
+		virtual bool Reset(const RamImage &);
+		virtual bool TakeSnapshot();
+		virtual bool RestoreSnapshot();
 		virtual uint64 NextInstruction();
 		virtual bool Interrupt(uint64);
-		virtual bool DataRead(RamVector &, uint64, uint64);
-		virtual bool DataWrite(const RamVector &);
+		virtual bool DataRead(vector<unsigned char> &, uint64, uint64);
+		virtual bool DataWrite(const RamImage &);
+		virtual void MemoryChanged(const Memory &, const RamImage &);
+		virtual void MemoryRestored(const Memory &, const vector<uint64> &);
 		virtual bool CreateRegisters();
 		virtual bool CreateMemories();
 		virtual bool CreatePipelines();
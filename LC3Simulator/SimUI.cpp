@@ -21,7 +21,7 @@ namespace LC3
 static unsigned int Warnings = 0, Errors = 0;
 static bool fSignalWrite = true, fLeftOvers = false;
 
-bool SimulatorUI(vector<Program *> &AsmPrograms, RamVector &MemoryImage)
+bool SimulatorUI(vector<Program *> &AsmPrograms, RamImage &MemoryImage)
 {
 	ArchSim<LC3ISA> TheSim(SimMessageCallBack, SimCallBack, SimCommand, SimReadConsole, SimWriteConsole);
 	LC3Arch TheArch(TheSim);
@@ -220,7 +220,7 @@ bool SimCommand(string &sCommand)
 	sTemp = sTemp.substr(0, sTemp.find_first_of("\x0A\x0D\x04\xFF"));
 
 	//Check to see if we should run the translator on it
-	if(Flags.fOldLC3)
+	if(TheContext.Flags.fOldLC3)
 	{
 		sCommand = "";
 		if(!AsmConvertLC3Line(sTemp, sCommand, LocationVector(), SimMessageCallBack))
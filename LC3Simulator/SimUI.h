@@ -26,7 +26,7 @@ namespace LC3
 
 		Returns true if it completed simulating successfully, else false.
 	\******/
-	bool SimulatorUI(vector<Program *> &, RamVector &);
+	bool SimulatorUI(vector<Program *> &, RamImage &);
 
 	/**************************************************************************\
 		SimCallBack( [in] message type, [in] message )
@@ -0,0 +1,213 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#pragma warning (disable:4786)
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include "../Simulator/BinaryTrace.h"
+
+using namespace std;
+using namespace JMT;
+using namespace Simulator;
+
+void PrintUsage();
+bool ProcessArgs(int, char**);
+bool ParseRange(const char *, uint64 &, uint64 &);
+bool SimCallBack(MessageEnum, const string &);
+
+//Binary trace to decode
+string sTraceFile;
+//Text file to write, or stdout if empty
+string sOutputFile;
+//Only instructions at addresses and cycles within these ranges are printed
+uint64 BeginAddress = 0, EndAddress = ~(uint64)0;
+uint64 BeginCycle = 0, EndCycle = ~(uint64)0;
+
+int main(int argc, char* argv[])
+{
+	if(!ProcessArgs(argc, argv))
+	{
+		PrintUsage();
+		return 0;
+	}
+
+	BinaryTrace Trace;
+	if(!Trace.Open(sTraceFile, SimCallBack))
+		return -1;
+
+	ofstream OutputFile;
+	if(!sOutputFile.empty())
+	{
+		OutputFile.open(sOutputFile.c_str());
+		if(!OutputFile.good())
+		{
+			cerr << "Error:   Unable to open file " << sOutputFile << endl;
+			return -1;
+		}
+	}
+	ostream &Output = (sOutputFile.empty() ? cout : OutputFile);
+
+	//Decode to the same format as a text trace
+	char sBuffer[64];
+	string sRegisters;
+	while(Trace.Read(SimCallBack))
+	{
+		uint64 Address = Trace.Address >> Trace.Addressability;
+		if(Address < BeginAddress || Address > EndAddress || Trace.Cycle < BeginCycle || Trace.Cycle > EndCycle)
+			continue;
+
+		#if defined _MSC_VER
+			sprintf(sBuffer, "%I64u;\t%I64u;\t", Trace.Cycle, Trace.Instruction);
+		#elif defined GPLUSPLUS
+			sprintf(sBuffer, "%llu;\t%llu;\t", Trace.Cycle, Trace.Instruction);
+		#else
+			#error "Only MSVC and GCC Compilers Supported"
+		#endif
+		sRegisters.erase();
+		for(list<RegisterSet>::iterator RegSetIter = Trace.RegisterSets.begin(); RegSetIter != Trace.RegisterSets.end(); RegSetIter++)
+		{
+			sRegisters += ";\t";
+			RegSetIter->Print(sRegisters);
+		}
+		Output << sBuffer << Trace.Text() << sRegisters << "\n";
+	}
+
+	Output.flush();
+	if(!Output.good())
+	{
+		cerr << "Error:   Error writing the decoded trace." << endl;
+		return -1;
+	}
+	return 0;
+}
+
+void PrintUsage()
+{
+	cout << "\n\t\tLC-3 Trace Decoder " << SIM_VER << ", Ashley Wise\n\n";
+	cout << "Give the binary trace file name (from TRACEON \"FileName\" BINARY) as a parameter\n";
+	cout << "   -a Begin:End  Only print instructions at addresses Begin through End\n";
+	cout << "   -c Begin:End  Only print instructions in cycles Begin through End\n";
+	cout << "                 Either end may be left out. Numbers can be given in\n";
+	cout << "                 decimal or in hex as x3000 or 4x3000.\n";
+	cout << "   -h or -?      Prints this help\n";
+	cout << "   -o Filename   Prints the trace to filename instead of stdout\n\n";
+}
+
+bool ProcessArgs(int argc, char* argv[])
+{
+	for(int i = 1; i < argc; i++)
+	{
+		if(argv[i][0] == '-')
+		{
+			switch(argv[i][1])
+			{
+			case 'a':
+			case 'A':
+				if(i + 1 >= argc || !ParseRange(argv[i+1], BeginAddress, EndAddress))
+				{
+					cout << "Error:   -a must be followed by an address range." << endl << endl;
+					return false;
+				}
+				i++;
+				break;
+			case 'c':
+			case 'C':
+				if(i + 1 >= argc || !ParseRange(argv[i+1], BeginCycle, EndCycle))
+				{
+					cout << "Error:   -c must be followed by a cycle range." << endl << endl;
+					return false;
+				}
+				i++;
+				break;
+			case 'o':
+			case 'O':
+				if(i + 1 >= argc)
+				{
+					cout << "Error:   -o must be followed by a filename." << endl << endl;
+					return false;
+				}
+				if(!sOutputFile.empty())
+					cout << "Warning:   -o specified more than once.";
+				sOutputFile = argv[++i];
+				break;
+			case '?':
+			case 'h':
+			case 'H':
+			default:
+				return false;
+			}
+		}
+		else
+		{
+			if(!sTraceFile.empty())
+			{
+				cout << "Error:   Only one trace file can be decoded at a time." << endl << endl;
+				return false;
+			}
+			sTraceFile = argv[i];
+		}
+	}
+	return !sTraceFile.empty();
+}
+
+//Parse one end of a range. An empty string leaves the value unchanged.
+static bool ParseNumber(const string &sNumber, uint64 &Value)
+{
+	if(sNumber.empty())
+		return true;
+
+	const char *pStart = sNumber.c_str();
+	int Base = 10;
+	if(pStart[0] == 'x' || pStart[0] == 'X')
+	{
+		Base = 16;
+		pStart++;
+	}
+	else if((pStart[0] == '4' || pStart[0] == '0') && (pStart[1] == 'x' || pStart[1] == 'X'))
+	{
+		Base = 16;
+		pStart += 2;
+	}
+
+	char *pEnd;
+	if(!*pStart)
+		return false;
+	#if defined _MSC_VER
+		Value = _strtoui64(pStart, &pEnd, Base);
+	#elif defined GPLUSPLUS
+		Value = strtoull(pStart, &pEnd, Base);
+	#else
+		#error "Only MSVC and GCC Compilers Supported"
+	#endif
+	return !*pEnd;
+}
+
+bool ParseRange(const char *sRange, uint64 &Begin, uint64 &End)
+{
+	string sString = sRange;
+	string::size_type Colon = sString.find(':');
+	if(Colon == string::npos)
+		return ParseNumber(sString, Begin) && ParseNumber(sString, End) && !sString.empty();
+	return ParseNumber(sString.substr(0, Colon), Begin) && ParseNumber(sString.substr(Colon + 1), End) && Begin <= End;
+}
+
+bool SimCallBack(MessageEnum MessageType, const string &sMessage)
+{
+	switch(MessageType)
+	{
+	case Info:
+		cerr << sMessage << endl;
+		break;
+	case Warning:
+		cerr << "Warning:   " << sMessage << endl;
+		break;
+	default:
+		cerr << "Error:   " << sMessage << endl;
+		break;
+	}
+	return true;
+}
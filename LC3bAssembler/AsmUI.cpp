@@ -19,7 +19,7 @@ namespace LC3b
 
 static unsigned int Warnings = 0, Errors = 0;
 
-bool AssemblerUI(vector<Program *> &AsmPrograms, RamVector &MemoryImage)
+bool AssemblerUI(vector<Program *> &AsmPrograms, RamImage &MemoryImage)
 {
 	bool fRetVal = true;
 	char sMessageBuffer[65 + MAX_FILENAME_CHAR];
@@ -46,11 +46,11 @@ bool AssemblerUI(vector<Program *> &AsmPrograms, RamVector &MemoryImage)
 #endif
 
 	//Initialize program list
-	for(i = 0; i < InputList.size(); i++)
+	for(i = 0; i < TheContext.InputList.size(); i++)
 	{
 		LocationVector LocationStack;
 		LocationStack.push_back( LocationVector::value_type(i, 0) );
-		AsmPrograms.push_back(new Program(LocationStack, InputList[i], LC3bISA::Addressability));
+		AsmPrograms.push_back(new Program(LocationStack, TheContext.InputList[i], LC3bISA::Addressability));
 	}
 	
 	//*** Perform Compilation ***
@@ -62,10 +62,10 @@ bool AssemblerUI(vector<Program *> &AsmPrograms, RamVector &MemoryImage)
 		//Open the assembly file
 		if(ToLower(AsmPrograms[i]->sFileName.Ext) == "obj" || ToLower(AsmPrograms[i]->sFileName.Ext) == "bin")
 		{
-			ifstream AsmFile(InputList[i].c_str(), ios::in | ios::binary);
+			ifstream AsmFile(TheContext.InputList[i].c_str(), ios::in | ios::binary);
 			if(!AsmFile.good())
 			{
-				sprintf(sMessageBuffer, "Unable to open file %.255s", InputList[i].c_str());
+				sprintf(sMessageBuffer, "Unable to open file %.255s", TheContext.InputList[i].c_str());
 				AsmCallBack(Fatal, sMessageBuffer, LocationVector());
 				fRetVal = false;
 				continue;
@@ -75,10 +75,10 @@ bool AssemblerUI(vector<Program *> &AsmPrograms, RamVector &MemoryImage)
 		}
 		else
 		{
-			ifstream AsmFile(InputList[i].c_str());
+			ifstream AsmFile(TheContext.InputList[i].c_str());
 			if(!AsmFile.good())
 			{
-				sprintf(sMessageBuffer, "Unable to open file %.255s", InputList[i].c_str());
+				sprintf(sMessageBuffer, "Unable to open file %.255s", TheContext.InputList[i].c_str());
 				AsmCallBack(Fatal, sMessageBuffer, LocationVector());
 				fRetVal = false;
 				continue;
@@ -98,7 +98,7 @@ bool AssemblerUI(vector<Program *> &AsmPrograms, RamVector &MemoryImage)
 	if(!fRetVal)
 		goto CleanUp;
 
-	if(Flags.fOutputVHDL)
+	if(TheContext.Flags.fOutputVHDL)
 	{
 		//Create output file name. If none is specified, the filename will be the same as
 		//the first input file except the extention is replaced with ".vhd"
@@ -120,7 +120,7 @@ bool AssemblerUI(vector<Program *> &AsmPrograms, RamVector &MemoryImage)
 	else
 		sOutputFileName = AsmPrograms[0]->sFileName.Path + AsmPrograms[0]->sFileName.Bare;
 	//Print VHDL to stdout
-	if(Flags.fStdout)
+	if(TheContext.Flags.fStdout)
 	{
 		cout << endl;
 		Assemble<LC3bISA>::VHDLWrite(cout, MemoryImage, AsmCallBack);
@@ -157,7 +157,7 @@ bool AsmCallBack(MessageEnum MessageType, const string &sMessage, const Location
 				continue;
 			else
 				LastLocation.clear();
-			sMsg << InputList[LocationStack[i].first].c_str() << "(" << LocationStack[i].second <<"):    Info:   From included file:\n";
+			sMsg << TheContext.InputList[LocationStack[i].first].c_str() << "(" << LocationStack[i].second <<"):    Info:   From included file:\n";
 		}
 		LastLocation = LocationStack;
 		StackLength = sMsg.pcount();
@@ -167,24 +167,24 @@ bool AsmCallBack(MessageEnum MessageType, const string &sMessage, const Location
 	{
 	case Info:
 		if(!LocationStack.empty())
-			sMsg << InputList[LocationStack[StackNumber].first].c_str() << "(" << LocationStack[StackNumber].second << "):    Info:   ";
+			sMsg << TheContext.InputList[LocationStack[StackNumber].first].c_str() << "(" << LocationStack[StackNumber].second << "):    Info:   ";
 		break;
 	case Warning:
 		Warnings++;
 		if(LocationStack.empty())
 			throw "Empty location stack for Warning!";
-		sMsg << InputList[LocationStack[StackNumber].first].c_str() << "(" << LocationStack[StackNumber].second << "): Warning:   ";
+		sMsg << TheContext.InputList[LocationStack[StackNumber].first].c_str() << "(" << LocationStack[StackNumber].second << "): Warning:   ";
 		break;
 	case Error:
 		Errors++;
 		if(LocationStack.empty())
 			throw "Empty location stack for Error!";
-		sMsg << InputList[LocationStack[StackNumber].first].c_str() << "(" << LocationStack[StackNumber].second << "):   Error:   ";
+		sMsg << TheContext.InputList[LocationStack[StackNumber].first].c_str() << "(" << LocationStack[StackNumber].second << "):   Error:   ";
 		break;
 	case Fatal:
 		Errors++;
 		if(!LocationStack.empty())
-			sMsg << InputList[LocationStack[StackNumber].first].c_str() << "(" << LocationStack[StackNumber].second << "):   ";
+			sMsg << TheContext.InputList[LocationStack[StackNumber].first].c_str() << "(" << LocationStack[StackNumber].second << "):   ";
 		sMsg << "Fatal:   ";
 		break;
 	}
@@ -805,10 +805,9 @@ void LC3bISA::AddInstr::AssignValues(vector<Number *>::iterator &StartIter, cons
 	}
 }
 
-bool LC3bISA::AddInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3bISA::AddInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3bInstruction Instr;
 
 	if(Address & 1)
@@ -841,13 +840,13 @@ bool LC3bISA::AddInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFu
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -875,13 +874,12 @@ unsigned int LC3bISA::AddInstr::GetDestinations(vector<RegisterEnum> &vReg) cons
 
 LC3bISA::AddInstr::operator const char *() const
 {
-	static string sElem;
 	ostrstream strElement;
 
 	strElement << sOpcodes[Opcode] << "\t" << sRegisters[DR] << ", " << sRegisters[SR1] << ", " << (fUseImm ? (const char *)*pSImm5 : sRegisters[SR2]) << ends;
 
-	sElem = strElement.str();
-	return sElem.c_str();
+	TheContext.sElementText = strElement.str();
+	return TheContext.sElementText.c_str();
 }
 
 /******************************************************************************\
@@ -939,10 +937,9 @@ void LC3bISA::AndInstr::AssignValues(vector<Number *>::iterator &StartIter, cons
 	}
 }
 
-bool LC3bISA::AndInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3bISA::AndInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3bInstruction Instr;
 
 	if(Address & 1)
@@ -975,13 +972,13 @@ bool LC3bISA::AndInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFu
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -1009,13 +1006,12 @@ unsigned int LC3bISA::AndInstr::GetDestinations(vector<RegisterEnum> &vReg) cons
 
 LC3bISA::AndInstr::operator const char *() const
 {
-	static string sElem;
 	ostrstream strElement;
 
 	strElement << sOpcodes[Opcode] << "\t" << sRegisters[DR] << ", " << sRegisters[SR1] << ", " << (fUseImm ? (const char *)*pSImm5 : sRegisters[SR2]) << ends;
 
-	sElem = strElement.str();
-	return sElem.c_str();
+	TheContext.sElementText = strElement.str();
+	return TheContext.sElementText.c_str();
 }
 
 /******************************************************************************\
@@ -1058,10 +1054,9 @@ void LC3bISA::BrInstr::AssignValues(vector<Number *>::iterator &StartIter, const
 	}
 }
 
-bool LC3bISA::BrInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3bISA::BrInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3bInstruction Instr;
 
 	if(Address & 1)
@@ -1087,13 +1082,13 @@ bool LC3bISA::BrInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFun
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -1113,13 +1108,12 @@ bool LC3bISA::BrInstr::IsBranch() const
 
 LC3bISA::BrInstr::operator const char *() const
 {
-	static string sElem;
 	ostrstream strElement;
 
 	strElement << sOpcodes[Opcode] << "\t" << (const char *)*pSOffset9 << ends;
 
-	sElem = strElement.str();
-	return sElem.c_str();
+	TheContext.sElementText = strElement.str();
+	return TheContext.sElementText.c_str();
 }
 
 /******************************************************************************\
@@ -1160,10 +1154,9 @@ void LC3bISA::JsrInstr::AssignValues(vector<Number *>::iterator &StartIter, cons
 	}
 }
 
-bool LC3bISA::JsrInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3bISA::JsrInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3bInstruction Instr;
 
 	if(Address & 1)
@@ -1187,13 +1180,13 @@ bool LC3bISA::JsrInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFu
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -1213,13 +1206,12 @@ bool LC3bISA::JsrInstr::IsBranch() const
 
 LC3bISA::JsrInstr::operator const char *() const
 {
-	static string sElem;
 	ostrstream strElement;
 
 	strElement << sOpcodes[Opcode] << "\t" << (const char *)*pSOffset11 << ends;
 
-	sElem = strElement.str();
-	return sElem.c_str();
+	TheContext.sElementText = strElement.str();
+	return TheContext.sElementText.c_str();
 }
 
 /******************************************************************************\
@@ -1248,10 +1240,9 @@ void LC3bISA::JsrrInstr::AssignValues(vector<Number *>::iterator &StartIter, con
 {
 }
 
-bool LC3bISA::JsrrInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3bISA::JsrrInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3bInstruction Instr;
 
 	if(Address & 1)
@@ -1271,13 +1262,13 @@ bool LC3bISA::JsrrInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackF
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -1346,10 +1337,9 @@ void LC3bISA::TrapInstr::AssignValues(vector<Number *>::iterator &StartIter, con
 	}
 }
 
-bool LC3bISA::TrapInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3bISA::TrapInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3bInstruction Instr;
 
 	if(Address & 1)
@@ -1379,13 +1369,13 @@ bool LC3bISA::TrapInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackF
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -1410,13 +1400,12 @@ bool LC3bISA::TrapInstr::IsMemory() const
 
 LC3bISA::TrapInstr::operator const char *() const
 {
-	static string sElem;
 	ostrstream strElement;
 
 	strElement << sOpcodes[Opcode] << "\t" << (const char *)*pTrapVect8 << ends;
 
-	sElem = strElement.str();
-	return sElem.c_str();
+	TheContext.sElementText = strElement.str();
+	return TheContext.sElementText.c_str();
 }
 
 /******************************************************************************\
@@ -1445,10 +1434,9 @@ void LC3bISA::JmpInstr::AssignValues(vector<Number *>::iterator &StartIter, cons
 {
 }
 
-bool LC3bISA::JmpInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3bISA::JmpInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3bInstruction Instr;
 
 	if(Address & 1)
@@ -1467,13 +1455,13 @@ bool LC3bISA::JmpInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFu
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -1529,10 +1517,9 @@ void LC3bISA::LeaInstr::AssignValues(vector<Number *>::iterator &StartIter, cons
 	}
 }
 
-bool LC3bISA::LeaInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3bISA::LeaInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3bInstruction Instr;
 
 	if(Address & 1)
@@ -1556,13 +1543,13 @@ bool LC3bISA::LeaInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFu
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -1578,13 +1565,12 @@ unsigned int LC3bISA::LeaInstr::GetDestinations(vector<RegisterEnum> &vReg) cons
 
 LC3bISA::LeaInstr::operator const char *() const
 {
-	static string sElem;
 	ostrstream strElement;
 
 	strElement << sOpcodes[Opcode] << "\t" << sRegisters[DR] << ", " << (const char *)*pSOffset9 << ends;
 
-	sElem = strElement.str();
-	return sElem.c_str();
+	TheContext.sElementText = strElement.str();
+	return TheContext.sElementText.c_str();
 }
 
 /******************************************************************************\
@@ -1629,10 +1615,9 @@ void LC3bISA::LdrInstr::AssignValues(vector<Number *>::iterator &StartIter, cons
 	}
 }
 
-bool LC3bISA::LdrInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3bISA::LdrInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3bInstruction Instr;
 
 	if(Address & 1)
@@ -1657,13 +1642,13 @@ bool LC3bISA::LdrInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFu
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -1691,13 +1676,12 @@ bool LC3bISA::LdrInstr::IsMemory() const
 
 LC3bISA::LdrInstr::operator const char *() const
 {
-	static string sElem;
 	ostrstream strElement;
 
 	strElement << sOpcodes[Opcode] << "\t" << sRegisters[DR] << ", " << sRegisters[BaseR] << ", " << (const char *)*pSOffset6 << ends;
 
-	sElem = strElement.str();
-	return sElem.c_str();
+	TheContext.sElementText = strElement.str();
+	return TheContext.sElementText.c_str();
 }
 
 /******************************************************************************\
@@ -1742,10 +1726,9 @@ void LC3bISA::StrInstr::AssignValues(vector<Number *>::iterator &StartIter, cons
 	}
 }
 
-bool LC3bISA::StrInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3bISA::StrInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3bInstruction Instr;
 
 	if(Address & 1)
@@ -1770,13 +1753,13 @@ bool LC3bISA::StrInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFu
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -1797,13 +1780,12 @@ bool LC3bISA::StrInstr::IsMemory() const
 
 LC3bISA::StrInstr::operator const char *() const
 {
-	static string sElem;
 	ostrstream strElement;
 
 	strElement << sOpcodes[Opcode] << "\t" << sRegisters[SR] << ", " << sRegisters[BaseR] << ", " << (const char *)*pSOffset6 << ends;
 
-	sElem = strElement.str();
-	return sElem.c_str();
+	TheContext.sElementText = strElement.str();
+	return TheContext.sElementText.c_str();
 }
 
 /******************************************************************************\
@@ -1848,10 +1830,9 @@ void LC3bISA::ShfInstr::AssignValues(vector<Number *>::iterator &StartIter, cons
 	}
 }
 
-bool LC3bISA::ShfInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3bISA::ShfInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3bInstruction Instr;
 
 	if(Address & 1)
@@ -1876,13 +1857,13 @@ bool LC3bISA::ShfInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFu
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -1905,13 +1886,12 @@ unsigned int LC3bISA::ShfInstr::GetDestinations(vector<RegisterEnum> &vReg) cons
 
 LC3bISA::ShfInstr::operator const char *() const
 {
-	static string sElem;
 	ostrstream strElement;
 
 	strElement << sOpcodes[Opcode] << "\t" << sRegisters[DR] << ", " << sRegisters[SR] << ", " << (const char *)*pImm4 << ends;
 
-	sElem = strElement.str();
-	return sElem.c_str();
+	TheContext.sElementText = strElement.str();
+	return TheContext.sElementText.c_str();
 }
 
 /******************************************************************************\
@@ -1937,10 +1917,9 @@ void LC3bISA::NotInstr::AssignValues(vector<Number *>::iterator &StartIter, cons
 {
 }
 
-bool LC3bISA::NotInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3bISA::NotInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3bInstruction Instr;
 
 	if(Address & 1)
@@ -1959,13 +1938,13 @@ bool LC3bISA::NotInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFu
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -2013,10 +1992,9 @@ void LC3bISA::RetInstr::AssignValues(vector<Number *>::iterator &StartIter, cons
 {
 }
 
-bool LC3bISA::RetInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3bISA::RetInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3bInstruction Instr;
 
 	if(Address & 1)
@@ -2035,13 +2013,13 @@ bool LC3bISA::RetInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFu
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -2086,10 +2064,9 @@ void LC3bISA::RtiInstr::AssignValues(vector<Number *>::iterator &StartIter, cons
 {
 }
 
-bool LC3bISA::RtiInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3bISA::RtiInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3bInstruction Instr;
 
 	if(Address & 1)
@@ -2106,13 +2083,13 @@ bool LC3bISA::RtiInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFu
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
@@ -2170,10 +2147,9 @@ void LC3bISA::NopInstr::AssignValues(vector<Number *>::iterator &StartIter, cons
 {
 }
 
-bool LC3bISA::NopInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFunction) const
+bool LC3bISA::NopInstr::GetImage(RamImage &Image, bool fLittleEndian, CallBackFunction) const
 {
 	bool fRetVal = true;
-	vRam.clear();
 	LC3bInstruction Instr;
 
 	if(Address & 1)
@@ -2189,13 +2165,13 @@ bool LC3bISA::NopInstr::GetImage(RamVector &vRam, bool fLittleEndian, CallBackFu
 	//Load the instruction into the RAM
 	if(fLittleEndian)
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)Instr.Binary) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)(Instr.Binary >> 8)) );
+		Image.Append(Address, (unsigned char)Instr.Binary);
+		Image.Append(Address + 1, (unsigned char)(Instr.Binary >> 8));
 	}
 	else	//Big Endian
 	{
-		vRam.push_back( RamVector::value_type(Address, (unsigned char)(Instr.Binary >> 8)) );
-		vRam.push_back( RamVector::value_type(Address + 1, (unsigned char)Instr.Binary) );
+		Image.Append(Address, (unsigned char)(Instr.Binary >> 8));
+		Image.Append(Address + 1, (unsigned char)Instr.Binary);
 	}
 
 	return fRetVal;
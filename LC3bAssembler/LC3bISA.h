@@ -233,7 +233,7 @@ namespace LC3b
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetSources(vector<RegisterEnum> &) const;
 			virtual unsigned int GetDestinations(vector<RegisterEnum> &) const;
 			virtual operator const char *() const;
@@ -259,7 +259,7 @@ namespace LC3b
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetSources(vector<RegisterEnum> &) const;
 			virtual unsigned int GetDestinations(vector<RegisterEnum> &) const;
 			virtual operator const char *() const;
@@ -281,7 +281,7 @@ namespace LC3b
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetSources(vector<RegisterEnum> &) const;
 			virtual bool IsBranch() const;
 			virtual operator const char *() const;
@@ -303,7 +303,7 @@ namespace LC3b
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetDestinations(vector<RegisterEnum> &) const;
 			virtual bool IsBranch() const;
 			virtual operator const char *() const;
@@ -324,7 +324,7 @@ namespace LC3b
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetDestinations(vector<RegisterEnum> &) const;
 			virtual unsigned int GetSources(vector<RegisterEnum> &) const;
 			virtual bool IsBranch() const;
@@ -347,7 +347,7 @@ namespace LC3b
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetDestinations(vector<RegisterEnum> &) const;
 			virtual bool IsBranch() const;
 			virtual bool IsMemory() const;
@@ -369,7 +369,7 @@ namespace LC3b
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual bool IsBranch() const;
 			virtual operator const char *() const;
 		};
@@ -391,7 +391,7 @@ namespace LC3b
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetDestinations(vector<RegisterEnum> &) const;
 			virtual operator const char *() const;
 		};
@@ -414,7 +414,7 @@ namespace LC3b
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetSources(vector<RegisterEnum> &) const;
 			virtual unsigned int GetDestinations(vector<RegisterEnum> &) const;
 			virtual bool IsMemory() const;
@@ -439,7 +439,7 @@ namespace LC3b
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetSources(vector<RegisterEnum> &) const;
 			virtual bool IsMemory() const;
 			virtual operator const char *() const;
@@ -463,7 +463,7 @@ namespace LC3b
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetSources(vector<RegisterEnum> &) const;
 			virtual unsigned int GetDestinations(vector<RegisterEnum> &) const;
 			virtual operator const char *() const;
@@ -483,7 +483,7 @@ namespace LC3b
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetSources(vector<RegisterEnum> &) const;
 			virtual unsigned int GetDestinations(vector<RegisterEnum> &) const;
 			virtual operator const char *() const;
@@ -501,7 +501,7 @@ namespace LC3b
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetSources(vector<RegisterEnum> &) const;
 			virtual bool IsBranch() const;
 			virtual operator const char *() const;
@@ -519,7 +519,7 @@ namespace LC3b
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual unsigned int GetSources(vector<RegisterEnum> &) const;
 			virtual unsigned int GetDestinations(vector<RegisterEnum> &) const;
 			virtual bool IsBranch() const;
@@ -539,7 +539,7 @@ namespace LC3b
 
 			virtual Element *Copy() const;
 			virtual void AssignValues(vector<Number *>::iterator &, const vector<Number *>::iterator &);
-			virtual bool GetImage(RamVector &, bool, CallBackFunction) const;
+			virtual bool GetImage(RamImage &, bool, CallBackFunction) const;
 			virtual operator const char *() const;
 		};
 
@@ -35,7 +35,7 @@ int main(int argc, char* argv[])
 		//This will hold the symbolic form of the program.
 		vector<Program *> AsmPrograms;
 		//This will hold the memory image of the program
-		RamVector MemoryImage;
+		RamImage MemoryImage;
 
 		AssemblerUI(AsmPrograms, MemoryImage);
 
@@ -85,21 +85,21 @@ bool ProcessArgs(int argc, char* argv[])
 			{
 			case 'a':
 			case 'A':
-				if(Flags.fPrintAST)
+				if(TheContext.Flags.fPrintAST)
 					cout << "Warning:   -a specified more than once.";
-				Flags.fPrintAST = true;
+				TheContext.Flags.fPrintAST = true;
 				break;
 			case 'b':
 			case 'B':
-				if(Flags.fOutputImage)
+				if(TheContext.Flags.fOutputImage)
 					cout << "Warning:   -d specified more than once.";
-				Flags.fOutputImage = true;
+				TheContext.Flags.fOutputImage = true;
 				break;
 			case 'c':
 			case 'C':
-				if(Flags.fStdout)
+				if(TheContext.Flags.fStdout)
 					cout << "Warning:   -c specified more than once.";
-				Flags.fStdout = true;
+				TheContext.Flags.fStdout = true;
 				break;
 			case 'd':
 			case 'D':
@@ -126,27 +126,27 @@ bool ProcessArgs(int argc, char* argv[])
 				break;
 			case 'o':
 			case 'O':
-				if(Flags.fUseOptimizations)
+				if(TheContext.Flags.fUseOptimizations)
 					cout << "Warning:   -o specified more than once.";
-				Flags.fUseOptimizations = true;
+				TheContext.Flags.fUseOptimizations = true;
 				break;
 			case 's':
 			case 'S':
-				if(Flags.fPrintSymbols)
+				if(TheContext.Flags.fPrintSymbols)
 					cout << "Warning:   -s specified more than once.";
-				Flags.fPrintSymbols = true;
+				TheContext.Flags.fPrintSymbols = true;
 				break;
 			case 't':
 			case 'T':
-				if(Flags.fPrintTokens)
+				if(TheContext.Flags.fPrintTokens)
 					cout << "Warning:   -t specified more than once.";
-				Flags.fPrintTokens = true;
+				TheContext.Flags.fPrintTokens = true;
 				break;
 			case 'v':
 			case 'V':
-				if(Flags.fOutputVHDL)
+				if(TheContext.Flags.fOutputVHDL)
 					cout << "Warning:   -v specified more than once.";
-				Flags.fOutputVHDL = true;
+				TheContext.Flags.fOutputVHDL = true;
 				if(i + 1 < argc && argv[i+1][0] != '-')
 				{
 					sOutputFileName = argv[++i];
@@ -155,9 +155,9 @@ bool ProcessArgs(int argc, char* argv[])
 				break;
 			case 'w':
 			case 'W':
-				if(Flags.fConsoleWidth)
+				if(TheContext.Flags.fConsoleWidth)
 					cout << "Warning:   -w specified more than once.";
-				Flags.fConsoleWidth = true;
+				TheContext.Flags.fConsoleWidth = true;
 				if(i + 1 < argc && argv[i+1][0] != '-')
 				{
 					i++;
@@ -182,9 +182,9 @@ bool ProcessArgs(int argc, char* argv[])
 			continue;
 		}
 		//Store the filename
-		InputList.push_back(CreateStandardPath(argv[i]));
+		TheContext.InputList.push_back(CreateStandardPath(argv[i]));
 	}
-	if(InputList.empty())
+	if(TheContext.InputList.empty())
 	{
 		cout << "Error: No input files specified.\n\n";
 		return false;
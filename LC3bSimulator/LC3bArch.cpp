@@ -19,17 +19,47 @@ namespace LC3b	{
 #define R(Reg) (*pThis->pR[Reg])
 #define CHANGE(Reg) (Reg == TR ? NoEvent : ChangeEvent)
 
+//Register set names, so that logging an event does not construct a string
+static const string sControlSet("control"), sMMIOSet("mmio"), sRegFileSet("regfile"), sFetchSet("if");
+
+//Alignment, bytes and bits of each memory access of compiled blocks, and the
+//name of its address, in the order of CompiledAccessEnum
+struct CompiledAccess
+{
+	unsigned char Alignment, Bytes, Bits;
+};
+static const CompiledAccess CompiledAccesses[] = {{0, 1, 8}, {1, 2, 16}, {1, 2, 16}, {1, 2, 16}, {0, 1, 8}, {1, 2, 16}, {1, 2, 16}, {1, 2, 16}, {1, 2, 16}};
+static const string sCompiledAccessIDs[] = {"LDb address", "LD address", "LDI first address", "LDI second address", "STb address", "ST address", "STI first address", "STI second address", "PC"};
+
 LC3bArch::LC3bArch(ArchSim<LC3bISA> &thesim) : TheSim(thesim)
 {
 	CreateRegisters();
 	CreateMemories();
 	CreatePipelines();
 	KeyboardInterruptVector = 0x40;
+	Engines.push_back("fivestage");
+	Engines.push_back("block");
+	if(BlockCompiler::Supported())
+		Engines.push_back("jit");
+	fBlockFlushed = false;
+	fMMIOAccess = false;
+	fFetching = false;
+	fFetchBlocked = false;
+
+	//Name the opcodes for the statistics, in opcode order
+	const char *const sOpcodeNames[INVALID_OPCODE + 1] = {"BR", "ADD", "LDB", "STB", "JSR", "AND", "LDR", "STR", "RTI", "NOT", "LDI", "STI", "JMP", "SHF", "LEA", "TRAP", "invalid"};
+	vector<string> OpcodeNames(sOpcodeNames, sOpcodeNames + INVALID_OPCODE + 1);
+	vector<PerfCounters::OpcodeKindEnum> OpcodeKinds(OpcodeNames.size(), PerfCounters::OtherOpcode);
+	OpcodeKinds[0x2] = OpcodeKinds[0x6] = OpcodeKinds[0xA] = PerfCounters::LoadOpcode;
+	OpcodeKinds[0x3] = OpcodeKinds[0x7] = OpcodeKinds[0xB] = PerfCounters::StoreOpcode;
+	//Instructions are word aligned, so the histogram only needs one entry per word
+	Counters.Create(OpcodeNames, OpcodeKinds, 0x8000, 1);
+	Branches.AddressShift = 1;
 }
 
-bool LC3bArch::Reset(const RamVector &MemoryImage)
+bool LC3bArch::Reset(const RamImage &MemoryImage)
 {
-	*pPC = Flags.fUseOS ? 0x3000 : MemoryImage.begin()->first;
+	*pPC = TheContext.Flags.fUseOS ? 0x3000 : MemoryImage.FirstAddress();
 	*pIR = 0;
 	*pPSR = 0x8000;
 	*pSSP = 0x3000;
@@ -44,7 +74,19 @@ bool LC3bArch::Reset(const RamVector &MemoryImage)
 	*pR[6] = 0xE000;
 	InterruptList.clear();
 
+	//Empty the five-stage pipeline
+	const PipelineLatch *pLatches[4] = {&IFID, &IDEX, &EXMEM, &MEMWB};
+	for(int i = 0; i < 4; i++)
+	{
+		RegisterSet &Latch = RegisterSets.find(*pLatches[i]->psSet)->second;
+		for(RegisterSet::RegisterMap::iterator RegIter = Latch.Registers.begin(); RegIter != Latch.Registers.end(); RegIter++)
+			RegIter->second = 0;
+	}
+	*pFetchPC = *pPC;
+	fFetchBlocked = false;
+
 	pDRAM->Clear();
+	InvalidateDecode();
 	if(!pDRAM->Write(MemoryImage, TheSim.SimCallBack))
 		return false;
 
@@ -55,433 +97,1521 @@ bool LC3bArch::Reset(const RamVector &MemoryImage)
 	return true;
 }
 
-uint64 LC3bArch::NextInstruction()
+bool LC3bArch::TakeSnapshot()
+{
+	if(!Architecture::TakeSnapshot())
+		return false;
+	SnapshotInterrupts = InterruptList;
+	return true;
+}
+
+bool LC3bArch::RestoreSnapshot()
+{
+	if(!Architecture::RestoreSnapshot())
+		return false;
+	InterruptList = SnapshotInterrupts;
+
+	//The first instruction will otherwise not be registered as an event,
+	//since it has to be registered prior to the cycle it occurs 
+	TheSim.InstructionEvent(*pPC);
+
+	return true;
+}
+
+bool LC3bArch::Run()
+{
+	if(Engine == FiveStageEngine)
+		return Pipelines[1].Run(this);
+
+	//The instructions in the five-stage pipeline would be stale by the
+	//time it is used again
+	if(IFID.pValid->Value | IDEX.pValid->Value | EXMEM.pValid->Value | MEMWB.pValid->Value)
+	{
+		Squash(IFID);
+		Squash(IDEX);
+		Squash(EXMEM);
+		Squash(MEMWB);
+	}
+	//The block engines also fall back to the datapath for single cycles
+	return Pipelines[0].Run(this);
+}
+
+bool LC3bArch::RunCycles(uint64 MaxCycles, uint64 &Cycles)
+{
+	//Translated blocks do not log the fetch events of the datapath, so
+	//the block engines are only used when nothing could observe them.
+	//The trace also needs an exact cycle count for every instruction.
+	if( (Engine != BlockEngine && Engine != CompiledEngine) || TheSim.fTrace || !TheSim.RegisterBreakpoints.empty() || !TheSim.DataBreakpoints.empty() || !TheSim.MemoryBreakpoints.empty()
+		|| (*pMCR)[15] != 1 || !InterruptList.empty() || pPC->Value >= 0xFE00 || (pPC->Value & 1) )
+		return Architecture::RunCycles(MaxCycles, Cycles);
+
+	Cycles = 0;
+	fMMIOAccess = false;
+	//Stop between blocks if the simulator is paused, since a block which
+	//branches to itself would otherwise run to the cycle limit. Cache
+	//and branch misprediction stalls count towards the limit, as they
+	//would one cycle at a time.
+	while(Cycles + Caches.Stalls + Branches.Stalls < MaxCycles && !TheSim.Pause.Pending())
+	{
+		//An unaligned PC causes an exception, which the datapath handles
+		if(pPC->Value & 1)
+			break;
+		LC3bISA::Word Address = pPC->Value >> 1;
+		vector<DecodedInstruction> &Block = Translate(Address);
+		if(Block.empty())
+			break;
+
+		fBlockFlushed = false;
+		unsigned int i = 0;
+		//Run as much of the block as is compiled
+		if(Engine == CompiledEngine && CanRunCompiled(Block.size(), MaxCycles - Cycles))
+		{
+			BlockCompiler::BlockFunction pCompiled = CompiledBlocks[Address];
+			if(!pCompiled)
+				pCompiled = Compile(Address);
+			if(pCompiled)
+			{
+				i = RunCompiled(pCompiled);
+				Cycles += i;
+				if(TheSim.fBreak || fBlockFlushed || fMMIOAccess || !InterruptList.empty())
+					return true;
+			}
+		}
+
+		//Interpret the block, or the rest of it after the compiled code
+		for(; i < Block.size() && Cycles + Caches.Stalls + Branches.Stalls < MaxCycles; )
+		{
+			//A store can discard this block, so execute a copy
+			DecodedInstruction Instr = Block[i++];
+			Cycles++;
+			//Return to the simulator for breaks, I/O, and pending interrupts
+			if(BlockStep(Instr))
+				return true;
+		}
+	}
+
+	return true;
+}
+
+inline bool LC3bArch::BlockStep(const DecodedInstruction &Instr)
+{
+	Caches.Fetch(pPC->Value);
+	Execute(Instr);
+	return TheSim.fBreak || fBlockFlushed || fMMIOAccess || !InterruptList.empty();
+}
+
+template<unsigned int Access>
+uint64 LC3bArch::CompiledRead(void *pArch, uint64 Address)
+{
+	LC3bArch *pThis = (LC3bArch *)pArch;
+	try
+	{
+		const CompiledAccess &TheAccess = CompiledAccesses[Access];
+		uint64 Value = pThis->DataRead((LC3bISA::Word)Address, TheAccess.Alignment, TheAccess.Bytes, TheAccess.Bits, sCompiledAccessIDs[Access]);
+		return Value | pThis->CompiledStop();
+	}
+	catch(...)
+	{
+		pThis->Compiler.SaveException();
+		return BlockCompiler::ABORT;
+	}
+}
+
+template<unsigned int Access>
+uint64 LC3bArch::CompiledWrite(void *pArch, uint64 Address, uint64 Value)
+{
+	LC3bArch *pThis = (LC3bArch *)pArch;
+	try
+	{
+		const CompiledAccess &TheAccess = CompiledAccesses[Access];
+		pThis->DataWrite((LC3bISA::Word)Address, TheAccess.Alignment, TheAccess.Bytes, (LC3bISA::Word)Value, TheAccess.Bits, sCompiledAccessIDs[Access]);
+		return pThis->CompiledStop();
+	}
+	catch(...)
+	{
+		pThis->Compiler.SaveException();
+		return BlockCompiler::ABORT;
+	}
+}
+
+uint64 LC3bArch::CompiledStop() const
+{
+	return TheSim.fBreak || fBlockFlushed || fMMIOAccess || !InterruptList.empty() ? BlockCompiler::STOP : 0;
+}
+
+uint64 LC3bArch::CompiledCall(void *pArch, uint64 CallAddress, uint64 SubAddress)
+{
+	LC3bArch *pThis = (LC3bArch *)pArch;
+	try
+	{
+		pThis->TheSim.SubInEvent(CallAddress, SubAddress);
+		return pThis->CompiledStop();
+	}
+	catch(...)
+	{
+		pThis->Compiler.SaveException();
+		return BlockCompiler::ABORT;
+	}
+}
+
+uint64 LC3bArch::CompiledReturn(void *pArch)
+{
+	LC3bArch *pThis = (LC3bArch *)pArch;
+	try
+	{
+		pThis->TheSim.SubOutEvent();
+		return pThis->CompiledStop();
+	}
+	catch(...)
+	{
+		pThis->Compiler.SaveException();
+		return BlockCompiler::ABORT;
+	}
+}
+
+bool LC3bArch::CompileOperation(const DecodedInstruction &Instr, LC3bISA::Word Address, BlockCompiler::Operation &Op)
+{
+	LC3bISA::Word NextPC = Address + 2;
+
+	Op.DR = Instr.DR;
+	Op.SR1 = Instr.SR1;
+	Op.SR2 = Instr.SR2;
+	Op.Conditions = 0;
+	Op.Imm = Instr.Imm;
+	Op.PC = Address;
+	Op.Binary = Instr.Binary;
+	Op.NextPC = NextPC;
+	Op.pRead = Op.pIndirectRead = NULL;
+	Op.pWrite = NULL;
+	Op.pCall = CompiledCall;
+	Op.pReturn = CompiledReturn;
+
+	switch(Instr.Opcode)
+	{
+	case 0x1:	//vOpcodes[ADD]:
+	case 0x5:	//vOpcodes[AND]:
+		Op.Type = Instr.Opcode == 0x1 ? BlockCompiler::AddOperation : BlockCompiler::AndOperation;
+		if(Instr.Flags)
+			Op.SR2 = BlockCompiler::IMMEDIATE;
+		break;
+
+	case 0x9:	//vOpcodes[NOT]:
+		Op.Type = BlockCompiler::NotOperation;
+		break;
+
+	case 0xD:	//vOpcodes[SHF]:
+		if(Instr.Flags & 1)
+			Op.Type = Instr.Flags & 2 ? BlockCompiler::ShiftArithmeticOperation : BlockCompiler::ShiftRightOperation;
+		else
+			Op.Type = BlockCompiler::ShiftLeftOperation;
+		break;
+
+	case 0xE:	//vOpcodes[LEA]:
+		Op.Type = BlockCompiler::SetOperation;
+		Op.Imm = (LC3bISA::Word)(NextPC + Instr.Imm);
+		break;
+
+	case 0x2:	//vOpcodes[LDB]:
+		Op.Type = BlockCompiler::LoadOperation;
+		Op.pRead = CompiledRead<LDbAccess>;
+		break;
+
+	case 0x6:	//vOpcodes[LD]:
+		Op.Type = BlockCompiler::LoadOperation;
+		Op.pRead = CompiledRead<LDAccess>;
+		break;
+
+	case 0xA:	//vOpcodes[LDI]:
+		Op.Type = BlockCompiler::LoadIndirectOperation;
+		Op.pRead = CompiledRead<LDIFirstAccess>;
+		Op.pIndirectRead = CompiledRead<LDISecondAccess>;
+		break;
+
+	case 0x3:	//vOpcodes[STB]:
+		Op.Type = BlockCompiler::StoreOperation;
+		Op.pWrite = CompiledWrite<STbAccess>;
+		break;
+
+	case 0x7:	//vOpcodes[ST]:
+		Op.Type = BlockCompiler::StoreOperation;
+		Op.pWrite = CompiledWrite<STAccess>;
+		break;
+
+	case 0xB:	//vOpcodes[STI]:
+		Op.Type = BlockCompiler::StoreIndirectOperation;
+		Op.pRead = CompiledRead<STIFirstAccess>;
+		Op.pWrite = CompiledWrite<STISecondAccess>;
+		break;
+
+	case 0x0:	//vOpcodes[BR]:
+		Op.Type = BlockCompiler::BranchOperation;
+		Op.Conditions = (Instr.Flags & (1 << N) ? BlockCompiler::NEGATIVE : 0) | (Instr.Flags & (1 << Z) ? BlockCompiler::ZERO : 0) | (Instr.Flags & (1 << P) ? BlockCompiler::POSITIVE : 0);
+		Op.Imm = (LC3bISA::Word)(NextPC + Instr.Imm);
+		break;
+
+	case 0x4:	//vOpcodes[JSR]:
+		Op.Type = BlockCompiler::CallOperation;
+		if(Instr.Flags)
+		{
+			Op.SR1 = BlockCompiler::IMMEDIATE;
+			Op.Imm = (LC3bISA::Word)(NextPC + Instr.Imm);
+		}
+		break;
+
+	case 0xF:	//vOpcodes[TRAP]:
+		Op.Type = BlockCompiler::TrapOperation;
+		Op.pRead = CompiledRead<TrapAccess>;
+		break;
+
+	case 0xC:	//vOpcodes[JMP]:
+		Op.Type = Instr.SR1 == LC3bISA::R7 ? BlockCompiler::ReturnOperation : BlockCompiler::JumpOperation;
+		break;
+
+	default:	//RTI and illegal encodings
+		return false;
+	}
+
+	return true;
+}
+
+BlockCompiler::BlockFunction LC3bArch::Compile(LC3bISA::Word Address)
+{
+	BlockCompiler::BlockFunction &pCompiled = CompiledBlocks[Address];
+	if(pCompiled || !Compiler.Available())
+		return pCompiled;
+
+	const vector<DecodedInstruction> &Block = BlockCache[Address];
+	BlockCompiler::Operation Ops[MAX_BLOCK_INSTRUCTIONS];
+	unsigned int Count = 0;
+	while(Count < Block.size() && CompileOperation(Block[Count], (Address + Count) << 1, Ops[Count]))
+		Count++;
+	if(!Count)
+		return NULL;
+	pCompiled = Compiler.Compile(Ops, Count);
+	if(!pCompiled && Compiler.Available())
+	{
+		//The buffer is full, so start it over with this block
+		Compiler.Clear();
+		CompiledBlocks.assign(CompiledBlocks.size(), NULL);
+		pCompiled = Compiler.Compile(Ops, Count);
+	}
+	return pCompiled;
+}
+
+bool LC3bArch::CanRunCompiled(size_t Instructions, uint64 MaxInstructions) const
+{
+	unsigned int CC = pPSR->Value & 0x7;
+	return Compiler.Available() && !Caches.fOn && !Branches.fOn && !Counters.fOn && !TheSim.fCheck && TheSim.InstrBreakpoints.empty()
+		&& Instructions <= MaxInstructions && (TheSim.BreakInstruction <= TheSim.SimInstruction || TheSim.BreakInstruction - TheSim.SimInstruction >= Instructions)
+		&& (CC == (1 << N) || CC == (1 << Z) || CC == (1 << P));
+}
+
+unsigned int LC3bArch::RunCompiled(BlockCompiler::BlockFunction pCompiled)
+{
+	BlockCompiler::State State;
+	unsigned int i;
+	for(i = 0; i < 8; i++)
+		State.R[i] = (unsigned int)pR[i]->Value;
+	State.CC = (*pPSR)[N] ? -1 : (*pPSR)[Z] ? 0 : 1;
+	State.PC = (unsigned int)pPC->Value;
+	State.IR = (unsigned int)pIR->Value;
+	State.pArch = this;
+
+	unsigned int Executed = (unsigned int)pCompiled(&State);
+
+	for(i = 0; i < 8; i++)
+		*pR[i] = State.R[i];
+	SetCC((signed short)State.CC);
+	*pPC = State.PC;
+	*pIR = State.IR;
+	TheSim.InstructionsEvent(Executed);
+	Compiler.RethrowException();
+	return Executed;
+}
+
+uint64 LC3bArch::NextInstruction()
+{
+	return *pPC;
+}
+
+bool LC3bArch::DataRead(vector<unsigned char> &Bytes, uint64 Address, uint64 Length)
+{
+	return pDRAM->Read(Bytes, Address, Length, TheSim.SimCallBack);
+}
+
+bool LC3bArch::DataWrite(const RamImage &MemoryImage)
+{
+	InvalidateDecode(MemoryImage);
+	return pDRAM->Write(MemoryImage, TheSim.SimCallBack);
+}
+
+void LC3bArch::MemoryChanged(const Memory &TheMemory, const RamImage &MemoryImage)
+{
+	if(&TheMemory != pDRAM)
+		return;
+	InvalidateDecode(MemoryImage);
+
+	//Instructions already fetched from the changed locations are stale
+	const PipelineLatch *pLatches[4] = {&IFID, &IDEX, &EXMEM, &MEMWB};
+	for(vector<RamImage::Extent>::const_iterator ExtentIter = MemoryImage.Extents.begin(); ExtentIter != MemoryImage.Extents.end(); ExtentIter++)
+	{
+		for(int i = 0; i < 4; i++)
+		{
+			uint64 PC = pLatches[i]->pPC->Value >> 1;
+			if(pLatches[i]->pValid->Value && PC >= (ExtentIter->first >> 1) && PC <= (ExtentIter->first + ExtentIter->second.size() - 1) >> 1)
+			{
+				for(i = 0; i < 4; i++)
+					Squash(*pLatches[i]);
+				return;
+			}
+		}
+	}
+}
+
+void LC3bArch::MemoryRestored(const Memory &TheMemory, const vector<uint64> &RestoredPages)
+{
+	if(&TheMemory != pDRAM)
+		return;
+
+	for(vector<uint64>::const_iterator PageIter = RestoredPages.begin(); PageIter != RestoredPages.end(); PageIter++)
+	{
+		for(uint64 Address = *PageIter >> 1; Address <= (*PageIter + MEMORY_PAGE_BYTES - 1) >> 1; Address++)
+		{
+			if(Address < DecodeCache.size())
+				InvalidateDecode((LC3bISA::Word)Address);
+		}
+	}
+}
+
+bool LC3bArch::CreateRegisters()
+{
+	pair<RegisterSetMap::iterator, bool> RegSetIter;
+	RegSetIter = RegisterSets.insert( RegisterSetMap::value_type("control", RegisterSet("control")) );
+	pPC = &RegSetIter.first->second.AddRegister("pc", 8*sizeof(LC3bISA::Word));
+	pIR = &RegSetIter.first->second.AddRegister("ir", 8*sizeof(LC3bISA::Word));
+	pPSR = &RegSetIter.first->second.AddRegister("psr", 8*sizeof(LC3bISA::Word));
+	pSSP = &RegSetIter.first->second.AddRegister("ssp", 8*sizeof(LC3bISA::Word));
+	pUSP = &RegSetIter.first->second.AddRegister("usp", 8*sizeof(LC3bISA::Word));
+
+	RegSetIter = RegisterSets.insert( RegisterSetMap::value_type("mmio", RegisterSet("mmio")) );
+	pKBSR = &RegSetIter.first->second.AddRegister("kbsr", 8*sizeof(LC3bISA::Word));
+	pKBDR = &RegSetIter.first->second.AddRegister("kbdr", 8*sizeof(LC3bISA::Word));
+	pDSR = &RegSetIter.first->second.AddRegister("dsr", 8*sizeof(LC3bISA::Word));
+	pDDR = &RegSetIter.first->second.AddRegister("ddr", 8*sizeof(LC3bISA::Word));
+	pMCR = &RegSetIter.first->second.AddRegister("mcr", 8*sizeof(LC3bISA::Word));
+
+	RegSetIter = RegisterSets.insert( RegisterSetMap::value_type("regfile", RegisterSet("regfile")) );
+	vector<Register *> vRegs = RegSetIter.first->second.AddRegisterArray("r", 8*sizeof(LC3bISA::Word), 8);
+	for(int i = 0; i < 8; i++)
+		pR[i] = vRegs[i];
+
+	//Five-stage pipeline latches
+	RegSetIter = RegisterSets.insert( RegisterSetMap::value_type("if", RegisterSet("if")) );
+	pFetchPC = &RegSetIter.first->second.AddRegister("pc", 8*sizeof(LC3bISA::Word));
+	AddLatch("if_id", IFID, false, false);
+	AddLatch("id_ex", IDEX, true, false);
+	AddLatch("ex_mem", EXMEM, false, true);
+	AddLatch("mem_wb", MEMWB, false, true);
+
+	NumberRegisters();
+	return true;
+}
+
+void LC3bArch::AddLatch(const string &sSet, PipelineLatch &Latch, bool fOperands, bool fResults)
+{
+	RegisterSetMap::iterator RegSetIter = RegisterSets.insert( RegisterSetMap::value_type(sSet, RegisterSet(sSet)) ).first;
+	RegisterSet &Set = RegSetIter->second;
+	Latch.psSet = &RegSetIter->first;
+	Latch.pValid = &Set.AddRegister("valid", 1);
+	Latch.pPC = &Set.AddRegister("pc", 8*sizeof(LC3bISA::Word));
+	Latch.pIR = &Set.AddRegister("ir", 8*sizeof(LC3bISA::Word));
+	Latch.pA = fOperands ? &Set.AddRegister("a", 8*sizeof(LC3bISA::Word)) : NULL;
+	Latch.pB = fOperands ? &Set.AddRegister("b", 8*sizeof(LC3bISA::Word)) : NULL;
+	Latch.pCC = fOperands ? &Set.AddRegister("cc", 3) : NULL;
+	Latch.pNPC = fResults ? &Set.AddRegister("npc", 8*sizeof(LC3bISA::Word)) : NULL;
+	Latch.pResult = fResults ? &Set.AddRegister("result", 8*sizeof(LC3bISA::Word)) : NULL;
+	Latch.pData = fResults ? &Set.AddRegister("data", 8*sizeof(LC3bISA::Word)) : NULL;
+	Latch.pReads = fResults ? &Set.AddRegister("reads", 2) : NULL;
+}
+
+bool LC3bArch::CreateMemories()
+{
+	vector<short> BitDivisions;
+	BitDivisions.push_back(-48);
+	BitDivisions.push_back(8);
+	BitDivisions.push_back(8);
+
+	pair<MemoryMap::iterator, bool> MemIter;
+	MemIter = Memories.insert( MemoryMap::value_type("dram", Memory("dram", 0, LC3bISA::MaxAddress, BitDivisions)) );
+	pDRAM = &MemIter.first->second;
+	NumberMemories();
+	//Instructions are two bytes
+	DecodeCache.resize((LC3bISA::MaxAddress >> 1) + 1);
+	BlockCache.resize(DecodeCache.size());
+	CodeMap.resize(DecodeCache.size());
+	CompiledBlocks.resize(DecodeCache.size(), NULL);
+	return true;
+}
+
+bool LC3bArch::CreatePipelines()
+{
+	Pipelines.push_back( Pipeline("datapath") );
+	Pipelines[0].AddStage("rtl", DataPath);
+
+	Pipelines.push_back( Pipeline("fivestage") );
+	Pipelines[1].AddStage("if", FetchStage);
+	Pipelines[1].AddStage("id", DecodeStage);
+	Pipelines[1].AddStage("ex", ExecuteStage);
+	Pipelines[1].AddStage("mem", MemoryStage);
+	Pipelines[1].AddStage("wb", WritebackStage);
+	return true;
+}
+
+bool LC3bArch::DataPath(Architecture *pArch)
+{
+	//Make nice aliases
+	LC3bArch *pThis = reinterpret_cast<LC3bArch *>(pArch);
+	ArchSim<LC3bISA> &TheSim = pThis->TheSim;
+	Register &MCR = *pThis->pMCR;
+
+	//Make sure the clock is started.
+	if(MCR[15] != 1)
+	{
+		TheSim.SimCallBack(Info, "Restarted the clock.");
+		MCR.SetBit(15, 1);
+		TheSim.RegisterEvent(sMMIOSet, MCR, (EventEnum)(WriteEvent | ValueEvent | ChangeEvent));
+	}
+	TheSim.RegisterEvent(sMMIOSet, MCR, ReadEvent);
+
+	//Check for interrupts
+	if(pThis->ProcessInterrupt())
+		return true;
+
+	//Get the next instruction
+	pThis->Execute(pThis->Fetch(*pThis->pPC));
+	return true;
+}
+
+void LC3bArch::Execute(const DecodedInstruction &Instr)
+{
+	//Make nice aliases
+	LC3bArch *pThis = this;
+	Register &PC = *pPC, &IR = *pIR, &PSR = *pPSR, &SSP = *pSSP, &USP = *pUSP, TR("", 64), TPC("", 64);
+	LC3bISA::Word Address, Temp;
+
+	TR = IR; IR = Instr.Binary;
+	TheSim.RegisterEvent(sControlSet, IR, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(IR)));
+	TPC = PC;
+	pThis->Counters.Instruction(Instr.Opcode, PC.Value);
+
+	//Process the instruction
+	switch(Instr.Opcode)
+	{
+	case 0x1:	//vOpcodes[ADD]:
+		if(Instr.Flags)
+		{
+			TR = R(Instr.DR); R(Instr.DR) = R(Instr.SR1) + Instr.Imm;
+			TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+		}
+		else
+		{
+			TR = R(Instr.DR); R(Instr.DR) = R(Instr.SR1) + R(Instr.SR2);
+			TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+			TheSim.RegisterEvent(sRegFileSet, R(Instr.SR2), ReadEvent);
+		}
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.DR))));
+
+		TR = PSR; pThis->SetCC(R(Instr.DR));
+		TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
+
+		PC = PC + 2;
+		break;
+
+	case 0x5:	//vOpcodes[AND]:
+		if(Instr.Flags)
+		{
+			TR = R(Instr.DR); R(Instr.DR) = R(Instr.SR1) & Instr.Imm;
+			TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+		}
+		else
+		{
+			TR = R(Instr.DR); R(Instr.DR) = R(Instr.SR1) & R(Instr.SR2);
+			TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+			TheSim.RegisterEvent(sRegFileSet, R(Instr.SR2), ReadEvent);
+		}
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.DR))));
+
+		TR = PSR; pThis->SetCC(R(Instr.DR));
+		TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
+
+		PC = PC + 2;
+		break;
+
+	case 0x0:	//vOpcodes[BR]:
+		bool fBranch;
+		//The NZP bits of the instruction line up with the condition codes in the PSR
+		fBranch = (PSR & Instr.Flags) != 0;
+		TheSim.RegisterEvent(sControlSet, PSR, ReadEvent);
+		pThis->Counters.Branch(fBranch);
+		if(Instr.Flags != 0 && Instr.Flags != 7)
+			pThis->Branches.Branch(TPC.Value, fBranch);
+
+		if(fBranch)
+			PC = PC + 2 + Instr.Imm;
+		else
+			PC = PC + 2;
+		break;
+
+	case 0x4:	//vOpcodes[JSR]:
+		if(Instr.Flags)
+		{	//JSR
+			TR = R(7); R(7) = PC + 2;
+			TheSim.RegisterEvent(sRegFileSet, R(7), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(7))));
+			PC = PC + 2 + Instr.Imm;
+			pThis->Branches.Call(R(7).Value);
+			TheSim.SubInEvent(TPC, PC);
+		}
+		else
+		{	//JSRR
+			TR = R(7); R(7) = PC + 2;
+			TheSim.RegisterEvent(sRegFileSet, R(7), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(7))));
+			PC = R(Instr.SR1);
+			TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+			pThis->Branches.Jump(TPC.Value, PC.Value);
+			pThis->Branches.Call(R(7).Value);
+			TheSim.SubInEvent(TPC, PC);
+		}
+		break;
+
+	case 0xF:	//vOpcodes[TRAP]:
+		TR = R(7); R(7) = PC + 2;
+		TheSim.RegisterEvent(sRegFileSet, R(7), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(7))));
+
+		PC = pThis->DataRead(Instr.Imm, 1, 2, 16, "PC");
+		pThis->Branches.Call(R(7).Value);
+		TheSim.SubInEvent(TPC, PC);
+		break;
+
+	case 0xC:	//vOpcodes[JMP]:
+		if(Instr.SR1 == LC3bISA::R7)
+		{	//Ret
+			PC = R(7);
+			TheSim.RegisterEvent(sRegFileSet, R(7), ReadEvent);
+			pThis->Branches.Return(TPC.Value, PC.Value);
+			TheSim.SubOutEvent();
+			break;
+		}
+
+		PC = R(Instr.SR1);
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+		pThis->Branches.Jump(TPC.Value, PC.Value);
+		break;
+
+	case 0xE:	//vOpcodes[LEA]:
+		TR = R(Instr.DR); R(Instr.DR) = PC + 2 + Instr.Imm;
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.DR))));
+
+		TR = PSR; pThis->SetCC(R(Instr.DR));
+		TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
+
+		PC = PC + 2;
+		break;
+
+	case 0x2:	//vOpcodes[LDB]:
+		TR = R(Instr.DR); R(Instr.DR) = pThis->DataRead(R(Instr.SR1) + Instr.Imm, 0, 1, 8, "LDb address");
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.DR))));
+
+		TR = PSR; pThis->SetCC(R(Instr.DR));
+		TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
+
+		PC = PC + 2;
+		break;
+
+	case 0xA:	//vOpcodes[LDI]:
+		Address = pThis->DataRead(R(Instr.SR1) + Instr.Imm, 1, 2, 16, "LDI first address");
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+
+		TR = R(Instr.DR); R(Instr.DR) = pThis->DataRead(Address, 1, 2, 16, "LDI second address");
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.DR))));
+
+		TR = PSR; pThis->SetCC(R(Instr.DR));
+		TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
+
+		PC = PC + 2;
+		break;
+
+	case 0x6:	//vOpcodes[LD]:
+		TR = R(Instr.DR); R(Instr.DR) = pThis->DataRead(R(Instr.SR1) + Instr.Imm, 1, 2, 16, "LD address");
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.DR))));
+
+		TR = PSR; pThis->SetCC(R(Instr.DR));
+		TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
+
+		PC = PC + 2;
+		break;
+
+	case 0x3:	//vOpcodes[STB]:
+		pThis->DataWrite(R(Instr.SR1) + Instr.Imm, 0, 1, R(Instr.DR), 8, "STb address");
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), ReadEvent);
+
+		PC = PC + 2;
+		break;
+
+	case 0xB:	//vOpcodes[STI]:
+		Address = pThis->DataRead(R(Instr.SR1) + Instr.Imm, 1, 2, 16, "STI first address");
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+
+		pThis->DataWrite(Address, 1, 2, R(Instr.DR), 16, "STI second address");
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), ReadEvent);
+
+		PC = PC + 2;
+		break;
+
+	case 0x7:	//vOpcodes[ST]:
+		pThis->DataWrite(R(Instr.SR1) + Instr.Imm, 1, 2, R(Instr.DR), 16, "ST address");
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), ReadEvent);
+
+		PC = PC + 2;
+		break;
+
+	case 0xD:	//vOpcodes[SHF]:
+		if(Instr.Flags & 1)	//Shift right
+		{
+			if(Instr.Flags & 2)	//Arithemtic
+			{
+				TR = R(Instr.DR); R(Instr.DR) = SEXT((R(Instr.SR1) >> Instr.Imm), 16 - Instr.Imm);
+			}
+			else	//Logical
+			{
+				TR = R(Instr.DR); R(Instr.DR) = R(Instr.SR1) >> Instr.Imm;
+			}
+		}
+		else	//Shift left
+		{
+				TR = R(Instr.DR); R(Instr.DR) = R(Instr.SR1) << Instr.Imm;
+		}
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.DR))));
+
+		TR = PSR; pThis->SetCC(R(Instr.DR));
+		TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
+
+		PC = PC + 2;
+		break;
+
+	case 0x9:	//vOpcodes[NOT]:
+		TR = R(Instr.DR); R(Instr.DR) = ~R(Instr.SR1);
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.SR1), ReadEvent);
+		TheSim.RegisterEvent(sRegFileSet, R(Instr.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.DR))));
+
+		TR = PSR; pThis->SetCC(R(Instr.DR));
+		TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
+
+		PC = PC + 2;
+		break;
+
+	case 0x8:	//vOpcodes[RTI]:
+		if(PSR[15] == 0)
+		{
+			PC = pThis->DataRead(R(6), 1, 2, 16, "RTI first address");
+			TR = R(6); R(6) = R(6) + 2;
+			TheSim.RegisterEvent(sRegFileSet, R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
+
+			TR = PSR; Temp = pThis->DataRead(R(6), 1, 2, 16, "RTI second address");
+			TR = R(6); R(6) = R(6) + 2;
+			TheSim.RegisterEvent(sRegFileSet, R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
+			PSR = Temp;
+			TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
+			TheSim.SubOutEvent();
+
+			//Save the supervisor stack
+			TR = SSP; SSP = R(6);
+			TheSim.RegisterEvent(sRegFileSet, R(6), ReadEvent);
+			TheSim.RegisterEvent(sControlSet, SSP, (EventEnum)(WriteEvent | ValueEvent | CHANGE(SSP)));
+
+			//R6 gets the stack pointer
+			if(PSR[15])
+			{
+				TR = R(6); R(6) = USP;
+				TheSim.RegisterEvent(sControlSet, USP, ReadEvent);
+				TheSim.RegisterEvent(sRegFileSet, R(6), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(6))));
+			}
+			else
+			{
+				TR = R(6); R(6) = SSP;
+				TheSim.RegisterEvent(sControlSet, SSP, ReadEvent);
+				TheSim.RegisterEvent(sRegFileSet, R(6), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(6))));
+			}
+			TheSim.RegisterEvent(sControlSet, PSR, ReadEvent);
+			
+		}
+		else	//Privilege mode exception
+		{
+			TheSim.RegisterEvent(sControlSet, PSR, ReadEvent);
+			TheSim.SimCallBack(JMT::Exception, "RTI instruction executed with user privilege.");
+			PC = PC + 2;
+			pThis->Exception(0);
+		}
+
+		break;
+
+	default:	//This is not a valid instruction
+		TheSim.SimCallBack(JMT::Exception, "Invalid instruction.");
+		PC = PC + 2;
+		pThis->Exception(1);
+	}
+	//The PC always changes
+	TR = TPC;
+	TheSim.RegisterEvent(sControlSet, PC, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(PC)));
+
+	//The instruction event for the next instruction is flagged at the end of the preceeding cycle,
+	//so that a breakpoint will be able to stop before the registered instruction event
+	//happens, rather than after it has happened.
+	//The trace file will output registers as they are before the instruction has executed.
+	TheSim.InstructionEvent(PC);
+}
+
+bool LC3bArch::FetchStage(Architecture *pArch)
+{
+	//Make nice aliases
+	LC3bArch *pThis = reinterpret_cast<LC3bArch *>(pArch);
+	const PipelineLatch &IFID = pThis->IFID;
+	Register &FetchPC = *pThis->pFetchPC;
+
+	//EX redirected the fetch this cycle
+	if(pThis->fFetchBlocked)
+	{
+		pThis->fFetchBlocked = false;
+		return true;
+	}
+
+	//Decode stalled, so the instruction stays in IF/ID
+	if(IFID.pValid->Value)
+		return true;
+
+	//Nothing is fetched behind an instruction which is executed on its own
+	const PipelineLatch *pLatches[3] = {&pThis->IDEX, &pThis->EXMEM, &pThis->MEMWB};
+	bool fEmpty = true;
+	for(int i = 0; i < 3; i++)
+	{
+		if(!pLatches[i]->pValid->Value)
+			continue;
+		fEmpty = false;
+		if(IsSerializing(Decode((LC3bISA::Word)pLatches[i]->pIR->Value).Opcode))
+		{
+			pThis->Counters.Stall();
+			return true;
+		}
+	}
+
+	//With nothing in the pipeline, the next instruction is at the PC. This
+	//is where the pipeline starts after a reset, a flush from WB, or a
+	//change of engine.
+	if(fEmpty)
+		pThis->SetLatch(sFetchSet, FetchPC, pThis->pPC->Value);
+	//MMIO reads have side effects, so an instruction is only fetched from
+	//MMIO once it is certain to execute
+	else if(FetchPC.Value >= 0xFE00)
+	{
+		pThis->Counters.Stall();
+		return true;
+	}
+
+	DecodedInstruction Instr = pThis->Fetch((LC3bISA::Word)FetchPC.Value);
+	pThis->SetLatch(*IFID.psSet, *IFID.pValid, 1);
+	pThis->SetLatch(*IFID.psSet, *IFID.pPC, FetchPC.Value);
+	pThis->SetLatch(*IFID.psSet, *IFID.pIR, Instr.Binary);
+	pThis->SetLatch(sFetchSet, FetchPC, FetchPC + 2);
+	return true;
+}
+
+bool LC3bArch::DecodeStage(Architecture *pArch)
+{
+	//Make nice aliases
+	LC3bArch *pThis = reinterpret_cast<LC3bArch *>(pArch);
+	const PipelineLatch &IFID = pThis->IFID, &IDEX = pThis->IDEX, &EXMEM = pThis->EXMEM, &MEMWB = pThis->MEMWB;
+
+	if(!IFID.pValid->Value)
+	{
+		pThis->SetLatch(*IDEX.psSet, *IDEX.pValid, 0);
+		return true;
+	}
+	DecodedInstruction Instr = Decode((LC3bISA::Word)IFID.pIR->Value);
+
+	//Find the source registers, and whether the condition codes are read
+	unsigned char SR1 = NO_REGISTER, SR2 = NO_REGISTER;
+	bool fCC = false;
+	switch(Instr.Opcode)
+	{
+	case 0x1:	//vOpcodes[ADD]:
+	case 0x5:	//vOpcodes[AND]:
+		SR1 = Instr.SR1;
+		if(!Instr.Flags)
+			SR2 = Instr.SR2;
+		break;
+
+	case 0x2:	//vOpcodes[LDB]:
+	case 0x6:	//vOpcodes[LD]:
+	case 0xA:	//vOpcodes[LDI]:
+	case 0x9:	//vOpcodes[NOT]:
+	case 0xD:	//vOpcodes[SHF]:
+	case 0xC:	//vOpcodes[JMP]:
+		SR1 = Instr.SR1;
+		break;
+
+	case 0x3:	//vOpcodes[STB]:
+	case 0x7:	//vOpcodes[ST]:
+	case 0xB:	//vOpcodes[STI]:
+		SR1 = Instr.SR1;
+		SR2 = Instr.DR;
+		break;
+
+	case 0x4:	//vOpcodes[JSR]:
+		if(!Instr.Flags)
+			SR1 = Instr.SR1;
+		break;
+
+	case 0x0:	//vOpcodes[BR]:
+		fCC = true;
+		break;
+	}
+
+	//A load's value is not read until MEM, so an instruction which uses
+	//it right behind the load waits a cycle. A read from MMIO is left to
+	//WB, so it waits another. Loads set the condition codes.
+	const PipelineLatch *pAhead[2] = {&EXMEM, &MEMWB};
+	for(int i = 0; i < 2; i++)
+	{
+		if(!pAhead[i]->pValid->Value || (i > 0 && !pAhead[i]->pReads->Value))
+			continue;
+		DecodedInstruction Ahead = Decode((LC3bISA::Word)pAhead[i]->pIR->Value);
+		if(IsLoad(Ahead.Opcode) && (fCC || (SR1 != NO_REGISTER && SR1 == Ahead.DR) || (SR2 != NO_REGISTER && SR2 == Ahead.DR)))
+		{
+			pThis->SetLatch(*IDEX.psSet, *IDEX.pValid, 0);
+			pThis->Counters.Stall();
+			return true;
+		}
+	}
+
+	pThis->SetLatch(*IDEX.psSet, *IDEX.pValid, 1);
+	pThis->SetLatch(*IDEX.psSet, *IDEX.pPC, IFID.pPC->Value);
+	pThis->SetLatch(*IDEX.psSet, *IDEX.pIR, IFID.pIR->Value);
+	pThis->SetLatch(*IDEX.psSet, *IDEX.pA, SR1 != NO_REGISTER ? pThis->ForwardRegister(SR1) : 0);
+	pThis->SetLatch(*IDEX.psSet, *IDEX.pB, SR2 != NO_REGISTER ? pThis->ForwardRegister(SR2) : 0);
+	pThis->SetLatch(*IDEX.psSet, *IDEX.pCC, fCC ? pThis->ForwardCC() : 0);
+
+	//The instruction has moved on, so IF can fetch the next one
+	pThis->SetLatch(*IFID.psSet, *IFID.pValid, 0);
+	return true;
+}
+
+bool LC3bArch::ExecuteStage(Architecture *pArch)
+{
+	//Make nice aliases
+	LC3bArch *pThis = reinterpret_cast<LC3bArch *>(pArch);
+	const PipelineLatch &IDEX = pThis->IDEX, &EXMEM = pThis->EXMEM;
+
+	pThis->SetLatch(*EXMEM.psSet, *EXMEM.pValid, IDEX.pValid->Value);
+	if(!IDEX.pValid->Value)
+		return true;
+	DecodedInstruction Instr = Decode((LC3bISA::Word)IDEX.pIR->Value);
+	LC3bISA::Word PC = (LC3bISA::Word)IDEX.pPC->Value, A = (LC3bISA::Word)IDEX.pA->Value, B = (LC3bISA::Word)IDEX.pB->Value;
+	LC3bISA::Word Result = 0, Data = 0, NPC = PC + 2;
+
+	switch(Instr.Opcode)
+	{
+	case 0x1:	//vOpcodes[ADD]:
+		Result = A + (Instr.Flags ? Instr.Imm : B);
+		break;
+
+	case 0x5:	//vOpcodes[AND]:
+		Result = A & (Instr.Flags ? Instr.Imm : B);
+		break;
+
+	case 0x9:	//vOpcodes[NOT]:
+		Result = ~A;
+		break;
+
+	case 0xD:	//vOpcodes[SHF]:
+		if(Instr.Flags & 1)	//Shift right
+		{
+			if(Instr.Flags & 2)	//Arithemtic
+				Result = SEXT(A >> Instr.Imm, 16 - Instr.Imm);
+			else	//Logical
+				Result = A >> Instr.Imm;
+		}
+		else	//Shift left
+			Result = A << Instr.Imm;
+		break;
+
+	case 0xE:	//vOpcodes[LEA]:
+		Result = PC + 2 + Instr.Imm;
+		break;
+
+	case 0x2:	//vOpcodes[LDB]:
+	case 0x6:	//vOpcodes[LD]:
+	case 0xA:	//vOpcodes[LDI]:
+	case 0x3:	//vOpcodes[STB]:
+	case 0x7:	//vOpcodes[ST]:
+	case 0xB:	//vOpcodes[STI]:
+		//The address, and the value to store
+		Result = A + Instr.Imm;
+		Data = B;
+		break;
+
+	case 0x0:	//vOpcodes[BR]:
+		//The NZP bits of the instruction line up with the condition codes
+		if(IDEX.pCC->Value & Instr.Flags)
+		{
+			Data = 1;
+			NPC = PC + 2 + Instr.Imm;
+		}
+		break;
+
+	case 0x4:	//vOpcodes[JSR]:
+		Result = PC + 2;
+		if(Instr.Flags)
+			NPC = PC + 2 + Instr.Imm;
+		else	//As in DataPath, JSRR reads its base register after writing R7
+			NPC = Instr.SR1 == LC3bISA::R7 ? Result : A;
+		break;
+
+	case 0xC:	//vOpcodes[JMP]:
+		NPC = A;
+		break;
+	}
+
+	pThis->SetLatch(*EXMEM.psSet, *EXMEM.pPC, PC);
+	pThis->SetLatch(*EXMEM.psSet, *EXMEM.pIR, IDEX.pIR->Value);
+	pThis->SetLatch(*EXMEM.psSet, *EXMEM.pNPC, NPC);
+	pThis->SetLatch(*EXMEM.psSet, *EXMEM.pResult, Result);
+	pThis->SetLatch(*EXMEM.psSet, *EXMEM.pData, Data);
+
+	//Branches are predicted not taken, so the instruction in IF/ID and the
+	//one IF would fetch this cycle are on the wrong path
+	if(NPC != (LC3bISA::Word)(PC + 2))
+	{
+		pThis->Counters.Flush(pThis->Squash(pThis->IFID));
+		pThis->SetLatch(sFetchSet, *pThis->pFetchPC, NPC);
+		pThis->fFetchBlocked = true;
+	}
+	return true;
+}
+
+bool LC3bArch::MemoryStage(Architecture *pArch)
+{
+	//Make nice aliases
+	LC3bArch *pThis = reinterpret_cast<LC3bArch *>(pArch);
+	const PipelineLatch &EXMEM = pThis->EXMEM, &MEMWB = pThis->MEMWB;
+
+	pThis->SetLatch(*MEMWB.psSet, *MEMWB.pValid, EXMEM.pValid->Value);
+	if(!EXMEM.pValid->Value)
+		return true;
+	DecodedInstruction Instr = Decode((LC3bISA::Word)EXMEM.pIR->Value);
+	LC3bISA::Word Result = (LC3bISA::Word)EXMEM.pResult->Value;
+
+	//Stores write memory when they retire, after every instruction ahead
+	//of them has. Reads from MMIO have side effects, so they are also left
+	//to WB, where the instruction is certain to retire.
+	unsigned int Reads = pThis->MemoryReads(Instr, Result, ReadCount(Instr.Opcode), false);
+
+	pThis->SetLatch(*MEMWB.psSet, *MEMWB.pPC, EXMEM.pPC->Value);
+	pThis->SetLatch(*MEMWB.psSet, *MEMWB.pIR, EXMEM.pIR->Value);
+	pThis->SetLatch(*MEMWB.psSet, *MEMWB.pNPC, EXMEM.pNPC->Value);
+	pThis->SetLatch(*MEMWB.psSet, *MEMWB.pResult, Result);
+	pThis->SetLatch(*MEMWB.psSet, *MEMWB.pData, EXMEM.pData->Value);
+	pThis->SetLatch(*MEMWB.psSet, *MEMWB.pReads, Reads);
+	return true;
+}
+
+bool LC3bArch::WritebackStage(Architecture *pArch)
+{
+	//Make nice aliases
+	LC3bArch *pThis = reinterpret_cast<LC3bArch *>(pArch);
+	ArchSim<LC3bISA> &TheSim = pThis->TheSim;
+	Register &PC = *pThis->pPC, &IR = *pThis->pIR, &PSR = *pThis->pPSR, &MCR = *pThis->pMCR, TR("", 64);
+	const PipelineLatch &MEMWB = pThis->MEMWB;
+
+	//Make sure the clock is started.
+	if(MCR[15] != 1)
+	{
+		TheSim.SimCallBack(Info, "Restarted the clock.");
+		MCR.SetBit(15, 1);
+		TheSim.RegisterEvent(sMMIOSet, MCR, (EventEnum)(WriteEvent | ValueEvent | ChangeEvent));
+	}
+	TheSim.RegisterEvent(sMMIOSet, MCR, ReadEvent);
+
+	if(!MEMWB.pValid->Value)
+		return true;
+
+	//The PC was changed from outside the pipeline, such as by the user, so
+	//it holds the wrong instructions
+	if(MEMWB.pPC->Value != PC.Value)
+	{
+		pThis->Squash(MEMWB);
+		pThis->Squash(pThis->EXMEM);
+		pThis->Squash(pThis->IDEX);
+		pThis->Squash(pThis->IFID);
+		return true;
+	}
+
+	DecodedInstruction Instr = Decode((LC3bISA::Word)MEMWB.pIR->Value);
+	if(IsSerializing(Instr.Opcode))
+	{
+		//Every instruction ahead of it has retired, and none have been
+		//fetched behind it
+		pThis->Execute(Instr);
+	}
+	else
+	{
+		LC3bISA::Word Result = (LC3bISA::Word)MEMWB.pResult->Value, Data = (LC3bISA::Word)MEMWB.pData->Value;
+
+		TR = IR; IR = Instr.Binary;
+		TheSim.RegisterEvent(sControlSet, IR, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(IR)));
+		pThis->Counters.Instruction(Instr.Opcode, MEMWB.pPC->Value);
+
+		if(MEMWB.pReads->Value)
+			pThis->MemoryReads(Instr, Result, (unsigned int)MEMWB.pReads->Value, true);
+
+		bool fStore = true;
+		switch(Instr.Opcode)
+		{
+		case 0x3:	//vOpcodes[STB]:
+			pThis->DataWrite(Result, 0, 1, Data, 8, "STb address");
+			break;
+
+		case 0x7:	//vOpcodes[ST]:
+			pThis->DataWrite(Result, 1, 2, Data, 16, "ST address");
+			break;
+
+		case 0xB:	//vOpcodes[STI]:
+			pThis->DataWrite(Result, 1, 2, Data, 16, "STI second address");
+			break;
+
+		case 0x0:	//vOpcodes[BR]:
+			pThis->Counters.Branch(Data != 0);
+			if(Instr.Flags != 0 && Instr.Flags != 7)
+				pThis->Branches.Branch(MEMWB.pPC->Value, Data != 0);
+			fStore = false;
+			break;
+
+		default:
+			fStore = false;
+		}
+
+		unsigned char DR = Destination(Instr);
+		if(DR != NO_REGISTER)
+		{
+			TR = R(DR); R(DR) = Result;
+			TheSim.RegisterEvent(sRegFileSet, R(DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(DR))));
+
+			if(SetsCC(Instr.Opcode))
+			{
+				TR = PSR; pThis->SetCC(R(DR));
+				TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
+			}
+		}
+
+		TR = PC; PC = MEMWB.pNPC->Value;
+		if(Instr.Opcode == 0x4)
+		{
+			if(!Instr.Flags)
+				pThis->Branches.Jump(TR.Value, PC.Value);
+			pThis->Branches.Call(R(7).Value);
+			TheSim.SubInEvent(TR, PC);
+		}
+		else if(Instr.Opcode == 0xC && Instr.SR1 == LC3bISA::R7)
+		{
+			pThis->Branches.Return(TR.Value, PC.Value);
+			TheSim.SubOutEvent();
+		}
+		else if(Instr.Opcode == 0xC)
+			pThis->Branches.Jump(TR.Value, PC.Value);
+		TheSim.RegisterEvent(sControlSet, PC, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(PC)));
+		TheSim.InstructionEvent(PC);
+
+		//A store to an instruction which has already been fetched makes it
+		//stale, so everything behind the store is fetched again
+		if(fStore)
+		{
+			const PipelineLatch *pLatches[3] = {&pThis->EXMEM, &pThis->IDEX, &pThis->IFID};
+			for(int i = 0; i < 3; i++)
+			{
+				if(pLatches[i]->pValid->Value && (pLatches[i]->pPC->Value >> 1) == (Result >> 1))
+				{
+					pThis->Flush();
+					break;
+				}
+			}
+		}
+	}
+
+	//Interrupts are taken between instructions
+	if(!pThis->InterruptList.empty() && pThis->ProcessInterrupt())
+		pThis->Flush();
+
+	return true;
+}
+
+void LC3bArch::SetLatch(const string &sSet, Register &Reg, uint64 Value)
+{
+	uint64 OldValue = Reg.Value;
+	Reg = Value;
+	TheSim.RegisterEvent(sSet, Reg, (EventEnum)(WriteEvent | ValueEvent | (OldValue == Reg.Value ? NoEvent : ChangeEvent)));
+}
+
+unsigned int LC3bArch::Squash(const PipelineLatch &Latch)
+{
+	if(!Latch.pValid->Value)
+		return 0;
+	SetLatch(*Latch.psSet, *Latch.pValid, 0);
+	return 1;
+}
+
+void LC3bArch::Flush()
+{
+	Counters.Flush(Squash(EXMEM) + Squash(IDEX) + Squash(IFID));
+}
+
+LC3bISA::Word LC3bArch::ForwardRegister(unsigned char Reg)
+{
+	TheSim.RegisterEvent(sRegFileSet, *pR[Reg], ReadEvent);
+
+	//EX/MEM holds the younger result
+	if(EXMEM.pValid->Value && Destination(Decode((LC3bISA::Word)EXMEM.pIR->Value)) == Reg)
+		return (LC3bISA::Word)EXMEM.pResult->Value;
+	if(MEMWB.pValid->Value && Destination(Decode((LC3bISA::Word)MEMWB.pIR->Value)) == Reg)
+		return (LC3bISA::Word)MEMWB.pResult->Value;
+	return (LC3bISA::Word)pR[Reg]->Value;
+}
+
+LC3bISA::Word LC3bArch::ForwardCC()
+{
+	TheSim.RegisterEvent(sControlSet, *pPSR, ReadEvent);
+
+	if(EXMEM.pValid->Value && SetsCC(Decode((LC3bISA::Word)EXMEM.pIR->Value).Opcode))
+		return CC((LC3bISA::Word)EXMEM.pResult->Value);
+	if(MEMWB.pValid->Value && SetsCC(Decode((LC3bISA::Word)MEMWB.pIR->Value).Opcode))
+		return CC((LC3bISA::Word)MEMWB.pResult->Value);
+	return (LC3bISA::Word)(pPSR->Value & 0x7);
+}
+
+unsigned int LC3bArch::MemoryReads(const DecodedInstruction &Instr, LC3bISA::Word &Address, unsigned int Reads, bool fMMIO)
+{
+	for(; Reads > 0 && (fMMIO || Address < 0xFE00); Reads--)
+	{
+		switch(Instr.Opcode)
+		{
+		case 0x2:	//vOpcodes[LDB]:
+			Address = DataRead(Address, 0, 1, 8, "LDb address");
+			break;
+
+		case 0x6:	//vOpcodes[LD]:
+			Address = DataRead(Address, 1, 2, 16, "LD address");
+			break;
+
+		case 0xA:	//vOpcodes[LDI]:
+			Address = DataRead(Address, 1, 2, 16, Reads == 2 ? "LDI first address" : "LDI second address");
+			break;
+
+		case 0xB:	//vOpcodes[STI]:
+			Address = DataRead(Address, 1, 2, 16, "STI first address");
+			break;
+		}
+	}
+	return Reads;
+}
+
+unsigned char LC3bArch::Destination(const DecodedInstruction &Instr)
 {
-	return *pPC;
+	if(Instr.Opcode == 0x4)	//vOpcodes[JSR]:
+		return LC3bISA::R7;
+	return SetsCC(Instr.Opcode) ? Instr.DR : NO_REGISTER;
 }
 
-bool LC3bArch::DataRead(RamVector &MemoryImage, uint64 Address, uint64 Length)
+bool LC3bArch::SetsCC(unsigned char Opcode)
 {
-	return pDRAM->Read(MemoryImage, Address, Length, TheSim.SimCallBack);
+	switch(Opcode)
+	{
+	case 0x1:	//vOpcodes[ADD]:
+	case 0x5:	//vOpcodes[AND]:
+	case 0x9:	//vOpcodes[NOT]:
+	case 0xD:	//vOpcodes[SHF]:
+	case 0xE:	//vOpcodes[LEA]:
+		return true;
+	default:
+		return IsLoad(Opcode);
+	}
 }
 
-bool LC3bArch::DataWrite(const RamVector &MemoryImage)
+bool LC3bArch::IsLoad(unsigned char Opcode)
 {
-	return pDRAM->Write(MemoryImage, TheSim.SimCallBack);
+	return Opcode == 0x2 || Opcode == 0x6 || Opcode == 0xA;
 }
 
-bool LC3bArch::CreateRegisters()
+unsigned int LC3bArch::ReadCount(unsigned char Opcode)
 {
-	pair<RegisterSetMap::iterator, bool> RegSetIter;
-	RegSetIter = RegisterSets.insert( RegisterSetMap::value_type("control", RegisterSet("control")) );
-	pPC = &RegSetIter.first->second.AddRegister("pc", 8*sizeof(LC3bISA::Word));
-	pIR = &RegSetIter.first->second.AddRegister("ir", 8*sizeof(LC3bISA::Word));
-	pPSR = &RegSetIter.first->second.AddRegister("psr", 8*sizeof(LC3bISA::Word));
-	pSSP = &RegSetIter.first->second.AddRegister("ssp", 8*sizeof(LC3bISA::Word));
-	pUSP = &RegSetIter.first->second.AddRegister("usp", 8*sizeof(LC3bISA::Word));
-
-	RegSetIter = RegisterSets.insert( RegisterSetMap::value_type("mmio", RegisterSet("mmio")) );
-	pKBSR = &RegSetIter.first->second.AddRegister("kbsr", 8*sizeof(LC3bISA::Word));
-	pKBDR = &RegSetIter.first->second.AddRegister("kbdr", 8*sizeof(LC3bISA::Word));
-	pDSR = &RegSetIter.first->second.AddRegister("dsr", 8*sizeof(LC3bISA::Word));
-	pDDR = &RegSetIter.first->second.AddRegister("ddr", 8*sizeof(LC3bISA::Word));
-	pMCR = &RegSetIter.first->second.AddRegister("mcr", 8*sizeof(LC3bISA::Word));
-
-	RegSetIter = RegisterSets.insert( RegisterSetMap::value_type("regfile", RegisterSet("regfile")) );
-	vector<Register *> vRegs = RegSetIter.first->second.AddRegisterArray("r", 8*sizeof(LC3bISA::Word), 8);
-	for(int i = 0; i < 8; i++)
-		pR[i] = vRegs[i];
-
-	return true;
+	if(Opcode == 0xA)	//vOpcodes[LDI]:
+		return 2;
+	return IsLoad(Opcode) || Opcode == 0xB ? 1 : 0;
 }
 
-bool LC3bArch::CreateMemories()
+bool LC3bArch::IsSerializing(unsigned char Opcode)
 {
-	vector<short> BitDivisions;
-	BitDivisions.push_back(-48);
-	BitDivisions.push_back(8);
-	BitDivisions.push_back(8);
-
-	pair<MemoryMap::iterator, bool> MemIter;
-	MemIter = Memories.insert( MemoryMap::value_type("dram", Memory("dram", 0, LC3bISA::MaxAddress, BitDivisions)) );
-	pDRAM = &MemIter.first->second;
-	return true;
+	return Opcode == 0xF || Opcode == 0x8 || Opcode == INVALID_OPCODE;
 }
 
-bool LC3bArch::CreatePipelines()
+LC3bISA::Word LC3bArch::CC(LC3bISA::Word Value)
 {
-	Pipelines.push_back( Pipeline("datapath") );
-	Pipelines[0].AddStage("rtl", DataPath);
-	return true;
+	return ((signed short)Value < 0 ? (1 << N) : 0) | (Value == 0 ? (1 << Z) : 0) | ((signed short)Value > 0 ? (1 << P) : 0);
 }
 
-bool LC3bArch::DataPath(Architecture *pArch)
+LC3bArch::DecodedInstruction LC3bArch::Decode(LC3bISA::Word Binary)
 {
-	//Make nice aliases
-	LC3bArch *pThis = reinterpret_cast<LC3bArch *>(pArch);
-	ArchSim<LC3bISA> &TheSim = pThis->TheSim;
-	Register &PC = *pThis->pPC, &IR = *pThis->pIR, &PSR = *pThis->pPSR, &SSP = *pThis->pSSP, &USP = *pThis->pUSP, &MCR = *pThis->pMCR, TR("", 64), TPC("", 64);
-	Memory &DRAM = *pThis->pDRAM;
-	LC3bISA::Word Address, PreviousPC = PC, Temp;
 	LC3bISA::LC3bInstruction Instr;
+	DecodedInstruction Decoded;
 
-	//Make sure the clock is started.
-	if(MCR[15] != 1)
-	{
-		TheSim.SimCallBack(Info, "Restarted the clock.");
-		MCR.SetBit(15, 1);
-		TheSim.RegisterEvent("mmio", MCR, (EventEnum)(WriteEvent | ValueEvent | ChangeEvent));
-	}
-	TheSim.RegisterEvent("mmio", MCR, ReadEvent);
-
-	//Check for interrupts
-	if(pThis->ProcessInterrupt())
-		return true;
-
-	//Get the next instruction
-	TR = IR; IR = Instr.Binary = pThis->DataRead(PC, 1, 2, 16, "PC");
-	TheSim.RegisterEvent("control", IR, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(IR)));
-	TPC = PC;
+	Instr.Binary = Binary;
+	Decoded.Binary = Binary;
+	Decoded.Imm = 0;
+	Decoded.Opcode = Instr.Base.Opcode;
+	Decoded.DR = Decoded.SR1 = Decoded.SR2 = 0;
+	Decoded.Flags = 0;
 
-	//Process the instruction
 	switch(Instr.Base.Opcode)
 	{
 	case 0x1:	//vOpcodes[ADD]:
+		Decoded.DR = Instr.Add.DR;
+		Decoded.SR1 = Instr.Add.SR1;
 		if(Instr.Add.UseImm)
 		{
-			TR = R(Instr.Add.DR); R(Instr.Add.DR) = R(Instr.Add.SR1) + SEXT(Instr.AddImm.Imm5, 5);
-			TheSim.RegisterEvent("regfile", R(Instr.Add.SR1), ReadEvent);
+			Decoded.Flags = 1;
+			Decoded.Imm = SEXT(Instr.AddImm.Imm5, 5);
 		}
+		else if(Instr.Add.Zeros)
+			Decoded.Opcode = INVALID_OPCODE;
 		else
-		{
-			if(Instr.Add.Zeros)
-				goto Default;
-			TR = R(Instr.Add.DR); R(Instr.Add.DR) = R(Instr.Add.SR1) + R(Instr.Add.SR2);
-			TheSim.RegisterEvent("regfile", R(Instr.Add.SR1), ReadEvent);
-			TheSim.RegisterEvent("regfile", R(Instr.Add.SR2), ReadEvent);
-		}
-		TheSim.RegisterEvent("regfile", R(Instr.Add.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.Add.DR))));
-
-		TR = PSR; pThis->SetCC(R(Instr.Add.DR));
-		TheSim.RegisterEvent("control", PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
-
-		PC = PC + 2;
+			Decoded.SR2 = Instr.Add.SR2;
 		break;
 
 	case 0x5:	//vOpcodes[AND]:
+		Decoded.DR = Instr.And.DR;
+		Decoded.SR1 = Instr.And.SR1;
 		if(Instr.And.UseImm)
 		{
-			TR = R(Instr.And.DR); R(Instr.And.DR) = R(Instr.And.SR1) & SEXT(Instr.AndImm.Imm5, 5);
-			TheSim.RegisterEvent("regfile", R(Instr.And.SR1), ReadEvent);
+			Decoded.Flags = 1;
+			Decoded.Imm = SEXT(Instr.AndImm.Imm5, 5);
 		}
+		else if(Instr.And.Zeros)
+			Decoded.Opcode = INVALID_OPCODE;
 		else
-		{
-			if(Instr.And.Zeros)
-				goto Default;
-			TR = R(Instr.And.DR); R(Instr.And.DR) = R(Instr.And.SR1) & R(Instr.And.SR2);
-			TheSim.RegisterEvent("regfile", R(Instr.And.SR1), ReadEvent);
-			TheSim.RegisterEvent("regfile", R(Instr.And.SR2), ReadEvent);
-		}
-		TheSim.RegisterEvent("regfile", R(Instr.And.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.And.DR))));
-
-		TR = PSR; pThis->SetCC(R(Instr.And.DR));
-		TheSim.RegisterEvent("control", PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
-
-		PC = PC + 2;
+			Decoded.SR2 = Instr.And.SR2;
 		break;
 
 	case 0x0:	//vOpcodes[BR]:
-		bool fBranch;
-		fBranch = false;
-		if(Instr.Br.N)
-		{
-			if(Instr.Br.Z)
-			{
-				if(Instr.Br.P)
-				{
-					if(PSR[N] | PSR[Z] | PSR[P])
-						fBranch = true;
-				}
-				else
-				{
-					if(PSR[N] | PSR[Z])
-						fBranch = true;
-				}
-			}
-			else
-			{
-				if(Instr.Br.P)
-				{
-					if(PSR[N] | PSR[P])
-						fBranch = true;
-				}
-				else
-				{
-					if(PSR[N])
-						fBranch = true;
-				}
-			}
-		}
-		else
-		{
-			if(Instr.Br.Z)
-			{
-				if(Instr.Br.P)
-				{
-					if(PSR[Z] | PSR[P])
-						fBranch = true;
-				}
-				else
-				{
-					if(PSR[Z])
-						fBranch = true;
-				}
-			}
-			else
-			{
-				if(Instr.Br.P)
-				{
-					if(PSR[P])
-						fBranch = true;
-				}
-				else
-				{
-					//This is a NOP
-					fBranch = false;
-				}
-			}
-		}
-		TheSim.RegisterEvent("control", PSR, ReadEvent);
-
-		if(fBranch)
-			PC = PC + 2 + SEXT(Instr.Br.Offset9 << 1, 10);
-		else
-			PC = PC + 2;
+		Decoded.Flags = (Instr.Br.N << N) | (Instr.Br.Z << Z) | (Instr.Br.P << P);
+		Decoded.Imm = SEXT(Instr.Br.Offset9 << 1, 10);
 		break;
 
 	case 0x4:	//vOpcodes[JSR]:
 		if(Instr.Jsr.JsrType)
-		{	//JSR
-			TR = R(7); R(7) = PC + 2;
-			TheSim.RegisterEvent("regfile", R(7), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(7))));
-			PC = PC + 2 + SEXT(Instr.Jsr.Offset11 << 1, 12);
-			TheSim.SubInEvent(TPC, PC);
+		{
+			Decoded.Flags = 1;
+			Decoded.Imm = SEXT(Instr.Jsr.Offset11 << 1, 12);
 		}
+		else if(Instr.Jsrr.Zero2 || Instr.Jsrr.Zero6)
+			Decoded.Opcode = INVALID_OPCODE;
 		else
-		{	//JSRR
-			if(Instr.Jsrr.Zero2 || Instr.Jsrr.Zero6)
-				goto Default;
-
-			TR = R(7); R(7) = PC + 2;
-			TheSim.RegisterEvent("regfile", R(7), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(7))));
-			PC = R(Instr.Jsrr.BaseR);
-			TheSim.RegisterEvent("regfile", R(Instr.Jsrr.BaseR), ReadEvent);
-			TheSim.SubInEvent(TPC, PC);
-		}
+			Decoded.SR1 = Instr.Jsrr.BaseR;
 		break;
 
 	case 0xF:	//vOpcodes[TRAP]:
 		if(Instr.Trap.Zeros)
-			goto Default;
-
-		TR = R(7); R(7) = PC + 2;
-		TheSim.RegisterEvent("regfile", R(7), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(7))));
-
-		PC = pThis->DataRead((Instr.Trap.TrapVect8 << 1), 1, 2, 16, "PC");
-		TheSim.SubInEvent(TPC, PC);
+			Decoded.Opcode = INVALID_OPCODE;
+		else
+			Decoded.Imm = Instr.Trap.TrapVect8 << 1;
 		break;
 
 	case 0xC:	//vOpcodes[JMP]:
 		if(Instr.Jmp.Zero3 || Instr.Jmp.Zero6)
-			goto Default;
-
-		if(Instr.Jmp.BaseR == LC3bISA::R7)
-		{	//Ret
-			PC = R(7);
-			TheSim.RegisterEvent("regfile", R(7), ReadEvent);
-			TheSim.SubOutEvent();
-			break;
-		}
-
-		PC = R(Instr.Jmp.BaseR);
-		TheSim.RegisterEvent("regfile", R(Instr.Jmp.BaseR), ReadEvent);
+			Decoded.Opcode = INVALID_OPCODE;
+		else
+			Decoded.SR1 = Instr.Jmp.BaseR;
 		break;
 
 	case 0xE:	//vOpcodes[LEA]:
-		TR = R(Instr.Lea.DR); R(Instr.Lea.DR) = PC + 2 + SEXT(Instr.Lea.Offset9 << 1, 10);
-		TheSim.RegisterEvent("regfile", R(Instr.Lea.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.Lea.DR))));
-
-		TR = PSR; pThis->SetCC(R(Instr.Lea.DR));
-		TheSim.RegisterEvent("control", PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
-
-		PC = PC + 2;
+		Decoded.DR = Instr.Lea.DR;
+		Decoded.Imm = SEXT(Instr.Lea.Offset9 << 1, 10);
 		break;
 
 	case 0x2:	//vOpcodes[LDB]:
-		TR = R(Instr.Ld.DR); R(Instr.Ld.DR) = pThis->DataRead(R(Instr.Ld.BaseR) + SEXT(Instr.Ld.Offset6, 6), 0, 1, 8, "LDb address");
-		TheSim.RegisterEvent("regfile", R(Instr.Ld.BaseR), ReadEvent);
-		TheSim.RegisterEvent("regfile", R(Instr.Ld.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.Ld.DR))));
-
-		TR = PSR; pThis->SetCC(R(Instr.Ld.DR));
-		TheSim.RegisterEvent("control", PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
-
-		PC = PC + 2;
+		Decoded.DR = Instr.Ld.DR;
+		Decoded.SR1 = Instr.Ld.BaseR;
+		Decoded.Imm = SEXT(Instr.Ld.Offset6, 6);
 		break;
 
 	case 0xA:	//vOpcodes[LDI]:
-		Address = pThis->DataRead(R(Instr.Ld.BaseR) + SEXT(Instr.Ld.Offset6 << 1, 7), 1, 2, 16, "LDI first address");
-		TheSim.RegisterEvent("regfile", R(Instr.Ld.BaseR), ReadEvent);
-
-		TR = R(Instr.Ld.DR); R(Instr.Ld.DR) = pThis->DataRead(Address, 1, 2, 16, "LDI second address");
-		TheSim.RegisterEvent("regfile", R(Instr.Ld.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.Ld.DR))));
-
-		TR = PSR; pThis->SetCC(R(Instr.Ld.DR));
-		TheSim.RegisterEvent("control", PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
-
-		PC = PC + 2;
-		break;
-
 	case 0x6:	//vOpcodes[LD]:
-		TR = R(Instr.Ld.DR); R(Instr.Ld.DR) = pThis->DataRead(R(Instr.Ld.BaseR) + SEXT(Instr.Ld.Offset6 << 1, 7), 1, 2, 16, "LD address");
-		TheSim.RegisterEvent("regfile", R(Instr.Ld.BaseR), ReadEvent);
-		TheSim.RegisterEvent("regfile", R(Instr.Ld.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.Ld.DR))));
-
-		TR = PSR; pThis->SetCC(R(Instr.Ld.DR));
-		TheSim.RegisterEvent("control", PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
-
-		PC = PC + 2;
+		Decoded.DR = Instr.Ld.DR;
+		Decoded.SR1 = Instr.Ld.BaseR;
+		Decoded.Imm = SEXT(Instr.Ld.Offset6 << 1, 7);
 		break;
 
 	case 0x3:	//vOpcodes[STB]:
-		pThis->DataWrite(R(Instr.St.BaseR) + SEXT(Instr.St.Offset6, 6), 0, 1, R(Instr.St.SR), 8, "STb address");
-		TheSim.RegisterEvent("regfile", R(Instr.St.BaseR), ReadEvent);
-		TheSim.RegisterEvent("regfile", R(Instr.St.SR), ReadEvent);
-
-		PC = PC + 2;
+		Decoded.DR = Instr.St.SR;
+		Decoded.SR1 = Instr.St.BaseR;
+		Decoded.Imm = SEXT(Instr.St.Offset6, 6);
 		break;
 
 	case 0xB:	//vOpcodes[STI]:
-		Address = pThis->DataRead(R(Instr.St.BaseR) + SEXT(Instr.St.Offset6 << 1, 7), 1, 2, 16, "STI first address");
-		TheSim.RegisterEvent("regfile", R(Instr.St.BaseR), ReadEvent);
-
-		pThis->DataWrite(Address, 1, 2, R(Instr.St.SR), 16, "STI second address");
-		TheSim.RegisterEvent("regfile", R(Instr.St.SR), ReadEvent);
-
-		PC = PC + 2;
-		break;
-
 	case 0x7:	//vOpcodes[ST]:
-		pThis->DataWrite(R(Instr.St.BaseR) + SEXT(Instr.St.Offset6 << 1, 7), 1, 2, R(Instr.St.SR), 16, "ST address");
-		TheSim.RegisterEvent("regfile", R(Instr.St.BaseR), ReadEvent);
-		TheSim.RegisterEvent("regfile", R(Instr.St.SR), ReadEvent);
-
-		PC = PC + 2;
+		Decoded.DR = Instr.St.SR;
+		Decoded.SR1 = Instr.St.BaseR;
+		Decoded.Imm = SEXT(Instr.St.Offset6 << 1, 7);
 		break;
 
 	case 0xD:	//vOpcodes[SHF]:
-		if(Instr.Shf.D)	//Shift right
-		{
-			if(Instr.Shf.A)	//Arithemtic
-			{
-				TR = R(Instr.Shf.DR); R(Instr.Shf.DR) = SEXT((R(Instr.Shf.SR) >> Instr.Shf.Imm4), 16 - Instr.Shf.Imm4);
-			}
-			else	//Logical
-			{
-				TR = R(Instr.Shf.DR); R(Instr.Shf.DR) = R(Instr.Shf.SR) >> Instr.Shf.Imm4;
-			}
-		}
-		else	//Shift left
-		{
-				TR = R(Instr.Shf.DR); R(Instr.Shf.DR) = R(Instr.Shf.SR) << Instr.Shf.Imm4;
-		}
-		TheSim.RegisterEvent("regfile", R(Instr.Shf.SR), ReadEvent);
-		TheSim.RegisterEvent("regfile", R(Instr.Shf.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.Shf.DR))));
-
-		TR = PSR; pThis->SetCC(R(Instr.Shf.DR));
-		TheSim.RegisterEvent("control", PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
-
-		PC = PC + 2;
+		Decoded.DR = Instr.Shf.DR;
+		Decoded.SR1 = Instr.Shf.SR;
+		Decoded.Flags = Instr.Shf.D | (Instr.Shf.A << 1);
+		Decoded.Imm = Instr.Shf.Imm4;
 		break;
 
 	case 0x9:	//vOpcodes[NOT]:
 		if(Instr.Not.Ones != 0x3F)
-			goto Default;
-
-		TR = R(Instr.Not.DR); R(Instr.Not.DR) = ~R(Instr.Not.SR);
-		TheSim.RegisterEvent("regfile", R(Instr.Not.SR), ReadEvent);
-		TheSim.RegisterEvent("regfile", R(Instr.Not.DR), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(Instr.Not.DR))));
-
-		TR = PSR; pThis->SetCC(R(Instr.Not.DR));
-		TheSim.RegisterEvent("control", PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
-
-		PC = PC + 2;
+			Decoded.Opcode = INVALID_OPCODE;
+		else
+		{
+			Decoded.DR = Instr.Not.DR;
+			Decoded.SR1 = Instr.Not.SR;
+		}
 		break;
 
 	case 0x8:	//vOpcodes[RTI]:
 		if(Instr.Rti.Zeros)
-			goto Default;
+			Decoded.Opcode = INVALID_OPCODE;
+		break;
 
-		if(PSR[15] == 0)
-		{
-			PC = pThis->DataRead(R(6), 1, 2, 16, "RTI first address");
-			TR = R(6); R(6) = R(6) + 2;
-			TheSim.RegisterEvent("regfile", R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
+	default:
+		Decoded.Opcode = INVALID_OPCODE;
+	}
 
-			TR = PSR; Temp = pThis->DataRead(R(6), 1, 2, 16, "RTI second address");
-			TR = R(6); R(6) = R(6) + 2;
-			TheSim.RegisterEvent("regfile", R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
-			PSR = Temp;
-			TheSim.RegisterEvent("control", PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
-			TheSim.SubOutEvent();
+	return Decoded;
+}
 
-			//Save the supervisor stack
-			TR = SSP; SSP = R(6);
-			TheSim.RegisterEvent("regfile", R(6), ReadEvent);
-			TheSim.RegisterEvent("control", SSP, (EventEnum)(WriteEvent | ValueEvent | CHANGE(SSP)));
+LC3bArch::DecodedInstruction LC3bArch::Fetch(LC3bISA::Word Address)
+{
+	if(Address < 0xFE00)
+		Caches.Fetch(Address);
 
-			//R6 gets the stack pointer
-			if(PSR[15])
-			{
-				TR = R(6); R(6) = USP;
-				TheSim.RegisterEvent("control", USP, ReadEvent);
-				TheSim.RegisterEvent("regfile", R(6), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(6))));
-			}
-			else
-			{
-				TR = R(6); R(6) = SSP;
-				TheSim.RegisterEvent("control", SSP, ReadEvent);
-				TheSim.RegisterEvent("regfile", R(6), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(6))));
-			}
-			TheSim.RegisterEvent("control", PSR, ReadEvent);
-			
+	//MMIO reads can have side effects, and unaligned fetches cause an
+	//exception, so neither is cached
+	if(Address >= 0xFE00 || (Address & 1))
+	{
+		fFetching = true;
+		DecodedInstruction Instr = Decode(DataRead(Address, 1, 2, 16, "PC"));
+		fFetching = false;
+		return Instr;
+	}
+
+	DecodedInstruction &Cached = DecodeCache[Address >> 1];
+	if(!Cached.fValid)
+	{
+		fFetching = true;
+		Cached = Decode(DataRead(Address, 1, 2, 16, "PC"));
+		fFetching = false;
+		Cached.fValid = true;
+		return Cached;
+	}
+
+	//Log the same events as DataRead
+	for(uint64 i = 0; i < 2; i++)
+	{
+		TheSim.DataEvent(Address + i, ReadEvent);
+		TheSim.MemoryEvent(*pDRAM, Address + i, ReadEvent);
+	}
+	return Cached;
+}
+
+vector<LC3bArch::DecodedInstruction> &LC3bArch::Translate(LC3bISA::Word Address)
+{
+	vector<DecodedInstruction> &Block = BlockCache[Address];
+	if(!Block.empty())
+		return Block;
+
+	for(unsigned int i = Address; i < (0xFE00 >> 1) && Block.size() < MAX_BLOCK_INSTRUCTIONS; i++)
+	{
+		//Translation reads memory directly, since nothing is watching the fetch
+		DecodedInstruction &Cached = DecodeCache[i];
+		if(!Cached.fValid)
+		{
+			Cached = Decode(pDRAM->Read16(i << 1, LC3bISA::fLittleEndian));
+			Cached.fValid = true;
 		}
-		else	//Privilege mode exception
+		Block.push_back(Cached);
+		CodeMap[i] = true;
+
+		//Anything that can change the flow of control ends the block
+		switch(Cached.Opcode)
 		{
-			TheSim.RegisterEvent("control", PSR, ReadEvent);
-			TheSim.SimCallBack(JMT::Exception, "RTI instruction executed with user privilege.");
-			PC = PC + 2;
-			pThis->Exception(0);
+		case 0x0:	//vOpcodes[BR]:
+		case 0x4:	//vOpcodes[JSR]:
+		case 0xF:	//vOpcodes[TRAP]:
+		case 0xC:	//vOpcodes[JMP]:
+		case 0x8:	//vOpcodes[RTI]:
+		case INVALID_OPCODE:
+			return Block;
 		}
+	}
 
-		break;
+	return Block;
+}
 
-	default:
-Default:	//This is not a valid instruction
-		TheSim.SimCallBack(JMT::Exception, "Invalid instruction.");
-		PC = PC + 2;
-		pThis->Exception(1);
+void LC3bArch::InvalidateDecode(const RamImage &MemoryImage)
+{
+	for(vector<RamImage::Extent>::const_iterator ExtentIter = MemoryImage.Extents.begin(); ExtentIter != MemoryImage.Extents.end(); ExtentIter++)
+	{
+		uint64 Last = (ExtentIter->first + ExtentIter->second.size() - 1) >> 1;
+		for(uint64 Address = ExtentIter->first >> 1; Address <= Last && Address < DecodeCache.size(); Address++)
+			InvalidateDecode((LC3bISA::Word)Address);
 	}
-	//The PC always changes
-	TR = TPC;
-	TheSim.RegisterEvent("control", PC, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(PC)));
+}
 
-	//The instruction event for the next instruction is flagged at the end of the preceeding cycle,
-	//so that a breakpoint will be able to stop before the registered instruction event
-	//happens, rather than after it has happened.
-	//The trace file will output registers as they are before the instruction has executed.
-	TheSim.InstructionEvent(PC);
+void LC3bArch::InvalidateDecode(LC3bISA::Word Address)
+{
+	DecodeCache[Address].fValid = false;
+	if(!CodeMap[Address])
+		return;
+
+	//Any block which contains this address starts at most
+	//MAX_BLOCK_INSTRUCTIONS - 1 words before it
+	unsigned int Start = Address < MAX_BLOCK_INSTRUCTIONS ? 0 : Address - (MAX_BLOCK_INSTRUCTIONS - 1);
+	for(unsigned int i = Start; i <= Address; i++)
+	{
+		if(i + BlockCache[i].size() > Address)
+		{
+			BlockCache[i].clear();
+			CompiledBlocks[i] = NULL;
+			fBlockFlushed = true;
+		}
+	}
+}
 
-	return true;
+void LC3bArch::InvalidateDecode()
+{
+	DecodeCache.assign(DecodeCache.size(), DecodedInstruction());
+	for(unsigned int i = 0; i < BlockCache.size(); i++)
+		BlockCache[i].clear();
+	CodeMap.assign(CodeMap.size(), false);
+	//Compiled code is only overwritten by the next Compile, which is
+	//between blocks
+	Compiler.Clear();
+	CompiledBlocks.assign(CompiledBlocks.size(), NULL);
+	fBlockFlushed = true;
 }
 
 LC3bISA::Word LC3bArch::SEXT(LC3bISA::Word Value, unsigned char Bits)
@@ -501,14 +1631,6 @@ void LC3bArch::SetCC(signed short Value)
 	*pPSR = (*pPSR & ~0x7) | (Value < 0 ? (1 << N) : 0) | (Value == 0 ? (1 << Z) : 0) | (Value > 0 ? (1 << P) : 0);
 }
 
-LC3bISA::Word LC3bArch::MakeInt(const RamVector &vData, unsigned char Bits, ArchSim<LC3bISA> &TheSim)
-{
-	uint64 TempInt64;
-	IntegerNumber Int(NullLocationStack, vData, LC3bISA::fLittleEndian);
-	Int.Int(Bits, false, TempInt64, TheSim.CallBack);
-	return TempInt64;
-}
-
 bool LC3bArch::Exception(uint64 Vector)
 {
 	LC3bArch *pThis = this;
@@ -542,41 +1664,42 @@ bool LC3bArch::Exception(uint64 Vector)
 	if(PSR[15])
 	{
 		TR = USP; USP = R(6);
-		TheSim.RegisterEvent("regfile", R(6), ReadEvent);
-		TheSim.RegisterEvent("control", USP, (EventEnum)(WriteEvent | ValueEvent | CHANGE(USP)));
+		TheSim.RegisterEvent(sRegFileSet, R(6), ReadEvent);
+		TheSim.RegisterEvent(sControlSet, USP, (EventEnum)(WriteEvent | ValueEvent | CHANGE(USP)));
 	}
 	else
 	{
 		TR = SSP; SSP = R(6);
-		TheSim.RegisterEvent("regfile", R(6), ReadEvent);
-		TheSim.RegisterEvent("control", SSP, (EventEnum)(WriteEvent | ValueEvent | CHANGE(SSP)));
+		TheSim.RegisterEvent(sRegFileSet, R(6), ReadEvent);
+		TheSim.RegisterEvent(sControlSet, SSP, (EventEnum)(WriteEvent | ValueEvent | CHANGE(SSP)));
 	}
-	TheSim.RegisterEvent("control", PSR, ReadEvent);
+	TheSim.RegisterEvent(sControlSet, PSR, ReadEvent);
 
 	//R6 gets the supervisor stack pointer
 	TR = R(6); R(6) = SSP;
-	TheSim.RegisterEvent("control", SSP, ReadEvent);
-	TheSim.RegisterEvent("regfile", R(6), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(6))));
+	TheSim.RegisterEvent(sControlSet, SSP, ReadEvent);
+	TheSim.RegisterEvent(sRegFileSet, R(6), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(6))));
 	
 	//Save PSR and PC to the stack
 	TR = R(6); R(6) = R(6) + -2;
-	TheSim.RegisterEvent("regfile", R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
+	TheSim.RegisterEvent(sRegFileSet, R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
 	DataWrite(R(6), 1, 2, PSR, 16, "Exception first address");
-	TheSim.RegisterEvent("control", PSR, ReadEvent);
+	TheSim.RegisterEvent(sControlSet, PSR, ReadEvent);
 	TR = R(6); R(6) = R(6) + -2;
-	TheSim.RegisterEvent("regfile", R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
+	TheSim.RegisterEvent(sRegFileSet, R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
 	DataWrite(R(6), 1, 2, PC, 16, "Exception second address");
-	TheSim.RegisterEvent("control", PC, ReadEvent);
+	TheSim.RegisterEvent(sControlSet, PC, ReadEvent);
 
 	//Update PSR
 	TR = PSR; PSR = PSR & 700;
-	TheSim.RegisterEvent("control", PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
+	TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
 
 	//Load the handler address into the PC
 	TR = PC; PC = DataRead(Vector, 1, 2, 16, "Exception vector");
-	TheSim.RegisterEvent("control", PC, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PC)));
+	TheSim.RegisterEvent(sControlSet, PC, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PC)));
 	TheSim.SubInEvent(TR, PC);
 
+	Counters.Exception();
 	TheSim.Exception();
 	TheSim.InstructionEvent(PC);
 	return true;
@@ -613,7 +1736,7 @@ bool LC3bArch::ProcessInterrupt()
 		if( ((PSR & 0x700) >> 8) >= NewPriority )
 		{
 			//The priority of the executing program is too high, do not process
-			TheSim.RegisterEvent("control", PSR, ReadEvent);
+			TheSim.RegisterEvent(sControlSet, PSR, ReadEvent);
 /*			if(TheSim.fCheck)
 			{
 				sprintf(sMessageBuffer, "Executing program priority level (%u) higher than keyboard interrupt priority level (%u); interrupt not processed.", ((PSR & 0x700) >> 8), NewPriority);
@@ -621,17 +1744,17 @@ bool LC3bArch::ProcessInterrupt()
 			}*/
 			return false;
 		}
-		TheSim.RegisterEvent("control", PSR, ReadEvent);
+		TheSim.RegisterEvent(sControlSet, PSR, ReadEvent);
 
 		if(!KBSR[0])
 		{
 			//Keyboard interrupt is disabled
-			TheSim.RegisterEvent("mmio", KBSR, ReadEvent);
+			TheSim.RegisterEvent(sMMIOSet, KBSR, ReadEvent);
 //			if(TheSim.fCheck)
 //				TheSim.SimCallBack(Info, "Keyboard interrupt is disabled; interrupt not processed.");
 			return false;
 		}
-		TheSim.RegisterEvent("mmio", KBSR, ReadEvent);
+		TheSim.RegisterEvent(sMMIOSet, KBSR, ReadEvent);
 		break;
 
 	default:
@@ -641,6 +1764,7 @@ bool LC3bArch::ProcessInterrupt()
 		return false;
 	}
 	InterruptList.pop_front();
+	Counters.Interrupt();
 
 	//Convert a vector number into an address
 	Vector = ((Vector & 0x7F) * 2) | 0x100;
@@ -649,39 +1773,39 @@ bool LC3bArch::ProcessInterrupt()
 	if(PSR[15])
 	{
 		TR = USP; USP = R(6);
-		TheSim.RegisterEvent("regfile", R(6), ReadEvent);
-		TheSim.RegisterEvent("control", USP, (EventEnum)(WriteEvent | ValueEvent | CHANGE(USP)));
+		TheSim.RegisterEvent(sRegFileSet, R(6), ReadEvent);
+		TheSim.RegisterEvent(sControlSet, USP, (EventEnum)(WriteEvent | ValueEvent | CHANGE(USP)));
 	}
 	else
 	{
 		TR = SSP; SSP = R(6);
-		TheSim.RegisterEvent("regfile", R(6), ReadEvent);
-		TheSim.RegisterEvent("control", SSP, (EventEnum)(WriteEvent | ValueEvent | CHANGE(SSP)));
+		TheSim.RegisterEvent(sRegFileSet, R(6), ReadEvent);
+		TheSim.RegisterEvent(sControlSet, SSP, (EventEnum)(WriteEvent | ValueEvent | CHANGE(SSP)));
 	}
-	TheSim.RegisterEvent("control", PSR, ReadEvent);
+	TheSim.RegisterEvent(sControlSet, PSR, ReadEvent);
 
 	//R6 gets the supervisor stack pointer
 	TR = R(6); R(6) = SSP;
-	TheSim.RegisterEvent("control", SSP, ReadEvent);
-	TheSim.RegisterEvent("regfile", R(6), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(6))));
+	TheSim.RegisterEvent(sControlSet, SSP, ReadEvent);
+	TheSim.RegisterEvent(sRegFileSet, R(6), (EventEnum)(WriteEvent | ValueEvent | CHANGE(R(6))));
 	
 	//Save PSR and PC to the stack
 	TR = R(6); R(6) = R(6) + -2;
-	TheSim.RegisterEvent("regfile", R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
+	TheSim.RegisterEvent(sRegFileSet, R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
 	DataWrite(R(6), 1, 2, PSR, 16, "Interrupt first address");
-	TheSim.RegisterEvent("control", PSR, ReadEvent);
+	TheSim.RegisterEvent(sControlSet, PSR, ReadEvent);
 	TR = R(6); R(6) = R(6) + -2;
-	TheSim.RegisterEvent("regfile", R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
+	TheSim.RegisterEvent(sRegFileSet, R(6), (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(R(6))));
 	DataWrite(R(6), 1, 2, PC, 16, "Interrupt second address");
-	TheSim.RegisterEvent("control", PC, ReadEvent);
+	TheSim.RegisterEvent(sControlSet, PC, ReadEvent);
 
 	//Update PSR
 	TR = PSR; PSR = (NewPriority << 8);
-	TheSim.RegisterEvent("control", PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
+	TheSim.RegisterEvent(sControlSet, PSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PSR)));
 
 	//Load the handler address into the PC
 	TR = PC; PC = DataRead(Vector, 1, 2, 16, "Interrupt vector");
-	TheSim.RegisterEvent("control", PC, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PC)));
+	TheSim.RegisterEvent(sControlSet, PC, (EventEnum)(WriteEvent | ValueEvent | CHANGE(PC)));
 	TheSim.SubInEvent(TR, PC);
 
 	TheSim.InstructionEvent(PC);
@@ -693,7 +1817,6 @@ LC3bISA::Word LC3bArch::DataRead(LC3bISA::Word Address, unsigned char Alignment,
 	LC3bISA::Word AlignMask = ((1 << Alignment) >> 1);
 	LC3bISA::Word BitMask = ((LC3bISA::Word)1 << Bits) - 1;
 	LC3bISA::Word Value;
-	RamVector vData;
 	Register &KBSR = *pKBSR, &KBDR = *pKBDR, &DSR = *pDSR, &DDR = *pDDR, &MCR = *pMCR, TR("", 64);
 	bool fRetVal;
 
@@ -707,6 +1830,11 @@ LC3bISA::Word LC3bArch::DataRead(LC3bISA::Word Address, unsigned char Alignment,
 	}
 
 	//Second check for Memory-mapped IO
+	if(Address >= 0xFE00)
+	{
+		Counters.MMIORead();
+		fMMIOAccess = true;
+	}
 	string sInput;
 	switch(Address)
 	{
@@ -717,34 +1845,34 @@ LC3bISA::Word LC3bArch::DataRead(LC3bISA::Word Address, unsigned char Alignment,
 		if(CharsRead)
 		{
 			TR = KBSR; KBSR.SetBit(15, 1);
-			TheSim.RegisterEvent("mmio", KBSR, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(KBSR)));
+			TheSim.RegisterEvent(sMMIOSet, KBSR, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(KBSR)));
 			TR = KBDR; KBDR = sInput[0];
-			TheSim.RegisterEvent("mmio", KBDR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(KBDR)));
+			TheSim.RegisterEvent(sMMIOSet, KBDR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(KBDR)));
 		}
 		else if(!fRetVal)	//CTRL-C gave EOF or Error signal
 		{
 			TR = KBSR; KBSR.SetBit(15, 1);
-			TheSim.RegisterEvent("mmio", KBSR, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(KBSR)));
+			TheSim.RegisterEvent(sMMIOSet, KBSR, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(KBSR)));
 			TR = KBDR; KBDR = -1;
-			TheSim.RegisterEvent("mmio", KBDR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(KBDR)));
+			TheSim.RegisterEvent(sMMIOSet, KBDR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(KBDR)));
 		}
 		else	//CTRL-D  gave "no input"
 		{
 			TR = KBSR; KBSR.SetBit(15, 0);
-			TheSim.RegisterEvent("mmio", KBSR, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(KBSR)));
+			TheSim.RegisterEvent(sMMIOSet, KBSR, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(KBSR)));
 		}
 		Value = KBSR;
 		break;
 	case KBDR_ADDRESS:
 		Value = KBDR;
-		TheSim.RegisterEvent("mmio", KBDR, ReadEvent);
+		TheSim.RegisterEvent(sMMIOSet, KBDR, ReadEvent);
 		TR = KBSR; KBSR.SetBit(15, 0);
-		TheSim.RegisterEvent("mmio", KBSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(KBSR)));
+		TheSim.RegisterEvent(sMMIOSet, KBSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(KBSR)));
 		break;
 	case DSR_ADDRESS:
 		//The display is always ready
 		TR = DSR; DSR.SetBit(15, 1);
-		TheSim.RegisterEvent("mmio", DSR, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(DSR)));
+		TheSim.RegisterEvent(sMMIOSet, DSR, (EventEnum)(ReadEvent | WriteEvent | ValueEvent | CHANGE(DSR)));
 		Value = DSR;
 		break;
 	case DDR_ADDRESS:
@@ -753,7 +1881,7 @@ LC3bISA::Word LC3bArch::DataRead(LC3bISA::Word Address, unsigned char Alignment,
 		break;
 	case MCR_ADDRESS:
 		Value = MCR;
-		TheSim.RegisterEvent("mmio", MCR, ReadEvent);
+		TheSim.RegisterEvent(sMMIOSet, MCR, ReadEvent);
 		break;
 	default:	//No MMIO
 		if(Address >= 0xFE00)
@@ -762,10 +1890,11 @@ LC3bISA::Word LC3bArch::DataRead(LC3bISA::Word Address, unsigned char Alignment,
 			sprintf(sMessageBuffer, "Read to undefined MMIO location (4x%x).", Address);
 			TheSim.SimCallBack(Warning, sMessageBuffer);
 		}
+		else if(!fFetching)
+			Caches.Read(Address);
 
-		pDRAM->Read(vData, Address, Bytes, TheSim.SimCallBack);
-		Value = MakeInt(vData, Bits, TheSim);
-		for(uint64 i = 0; i < Bytes; Bytes++)
+		Value = (LC3bISA::Word)pDRAM->ReadInt(Address, Bytes, LC3bISA::fLittleEndian);
+		for(uint64 i = 0; i < Bytes; i++)
 		{
 			TheSim.DataEvent(Address + i, ReadEvent);
 			TheSim.MemoryEvent(*pDRAM, Address + i, ReadEvent);
@@ -779,7 +1908,6 @@ void LC3bArch::DataWrite(LC3bISA::Word Address, unsigned char Alignment, unsigne
 {
 	LC3bISA::Word AlignMask = ((1 << Alignment) >> 1);
 	Value &= ((LC3bISA::Word)1 << Bits) - 1;
-	RamVector vTData, vData;
 	Register &KBSR = *pKBSR, &KBDR = *pKBDR, &DSR = *pDSR, &DDR = *pDDR, &MCR = *pMCR, TR("", 64);
 
 	//First check the alignment.
@@ -792,33 +1920,38 @@ void LC3bArch::DataWrite(LC3bISA::Word Address, unsigned char Alignment, unsigne
 	}
 
 	//Second check for Memory-mapped IO
+	if(Address >= 0xFE00)
+	{
+		Counters.MMIOWrite();
+		fMMIOAccess = true;
+	}
 	string sOutput;
 	switch(Address)
 	{
 	case KBSR_ADDRESS:
 		//Can only write to interrupt enable bit
 		KBSR.SetBit(0, Value & 1);
-		TheSim.RegisterEvent("mmio", KBSR, (EventEnum)(WriteEvent | ValueEvent));
+		TheSim.RegisterEvent(sMMIOSet, KBSR, (EventEnum)(WriteEvent | ValueEvent));
 		break;
 	case KBDR_ADDRESS:
 		//No write to this reg
 		//KBDR = Value;
-		//TheSim.RegisterEvent("mmio", KBDR, (EventEnum)(WriteEvent | ValueEvent));
+		//TheSim.RegisterEvent(sMMIOSet, KBDR, (EventEnum)(WriteEvent | ValueEvent));
 		break;
 	case DSR_ADDRESS:
 		//No write to this reg
 		//DSR = Value;
-		//TheSim.RegisterEvent("control", pDSR->sName, (EventEnum)(WriteEvent | ValueEvent), DSR);
+		//TheSim.RegisterEvent(sControlSet, pDSR->sName, (EventEnum)(WriteEvent | ValueEvent), DSR);
 		break;
 	case DDR_ADDRESS:
 		//Try to write one char to the screen
 		TR = DSR; DSR.SetBit(15, 0);
-		TheSim.RegisterEvent("mmio", DSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(DSR)));
+		TheSim.RegisterEvent(sMMIOSet, DSR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(DSR)));
 		unsigned int CharsWritten;
 		sOutput += (char)Value;
 		TR = DDR; DDR = Value;
 		TheSim.WriteConsole(sOutput, 1, CharsWritten);
-		TheSim.RegisterEvent("mmio", DDR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(DDR)));
+		TheSim.RegisterEvent(sMMIOSet, DDR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(DDR)));
 		break;
 	case MCR_ADDRESS:
 		TR = MCR; MCR = Value;
@@ -827,7 +1960,7 @@ void LC3bArch::DataWrite(LC3bISA::Word Address, unsigned char Alignment, unsigne
 			TheSim.SimCallBack(JMT::Exception, "Program has stopped the clock. Continuing execution will restart the clock.");
 			TheSim.Exception();
 		}
-		TheSim.RegisterEvent("mmio", MCR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(MCR)));
+		TheSim.RegisterEvent(sMMIOSet, MCR, (EventEnum)(WriteEvent | ValueEvent | CHANGE(MCR)));
 		break;
 	default:	//No MMIO
 		if(Address >= 0xFE00)
@@ -836,24 +1969,28 @@ void LC3bArch::DataWrite(LC3bISA::Word Address, unsigned char Alignment, unsigne
 			sprintf(sMessageBuffer, "Write to undefined MMIO location (4x%x).", Address);
 			TheSim.SimCallBack(Warning, sMessageBuffer);
 		}
+		else
+			Caches.Write(Address);
 
-		pDRAM->Read(vTData, Address, Bytes, TheSim.SimCallBack);
+		uint64 OldValue = pDRAM->ReadInt(Address, Bytes, LC3bISA::fLittleEndian);
+		pDRAM->WriteInt(Address, Bytes, Value, LC3bISA::fLittleEndian);
 		uint64 i;
-		for(i = 0; i < Bytes; i++) 
-			vData.push_back( RamVector::value_type(Address + i, (Value >> (i*8)) & 0xFF) );
-		pDRAM->Write(vData, TheSim.SimCallBack);
+		for(i = 0; i < Bytes; i++)
+			InvalidateDecode((LC3bISA::Word)((Address + i) >> 1));
 		for(i = 0; i < Bytes; i++)
 		{
-			TheSim.DataEvent(Address + i, (EventEnum)(WriteEvent | ValueEvent | (vData == vTData ? NoEvent : ChangeEvent)));
-			TheSim.MemoryEvent(*pDRAM, Address + i, (EventEnum)(WriteEvent | ValueEvent | (vData == vTData ? NoEvent : ChangeEvent)));
-			vData.erase(vData.begin());
-			vTData.erase(vTData.begin());
+			//A byte is logged as changed if it or any byte after it changed
+			EventEnum Events = (EventEnum)(WriteEvent | ValueEvent | ((OldValue >> (i*8)) == ((uint64)Value >> (i*8)) ? NoEvent : ChangeEvent));
+			TheSim.DataEvent(Address + i, Events);
+			TheSim.MemoryEvent(*pDRAM, Address + i, Events);
 		}
 	}
 }
 
 istream &LC3bArch::operator <<(istream &Input)
 {
+	//Memory may have been reloaded
+	InvalidateDecode();
 	return Input;
 }
 ostream &LC3bArch::operator >>(ostream &Output) const
@@ -9,6 +9,7 @@
 #include <map>
 #include <list>
 #include "../Simulator/Architecture.h"
+#include "../Simulator/BlockCompiler.h"
 #include "../LC3bAssembler/LC3bISA.h"
 #include "../Assembler/Base.h"
 
@@ -27,6 +28,12 @@ namespace LC3b
 	const unsigned int DSR_ADDRESS = 0xFE04;
 	const unsigned int DDR_ADDRESS = 0xFE06;
 	const unsigned int MCR_ADDRESS = 0xFFFE;
+	//Opcode given to illegal instruction encodings when predecoded
+	const unsigned char INVALID_OPCODE = 0x10;
+	//Register number of an instruction which writes no register
+	const unsigned char NO_REGISTER = 8;
+	//Most instructions in a translated block
+	const unsigned int MAX_BLOCK_INSTRUCTIONS = 32;
 
 	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
 		LC3bArch
@@ -35,12 +42,36 @@ namespace LC3b
 
 		It contains functions to initialize the architecture, as well as
 		functions to execute pipeline stage RTL for the ISA.
+
+		The "pipeline" engine executes each instruction in one cycle with the
+		"datapath" pipeline. The "fivestage" engine executes the "fivestage"
+		pipeline, a classic IF/ID/EX/MEM/WB pipeline whose latches are
+		register sets. It forwards results to the instruction in decode,
+		stalls an instruction which uses a load's result in the next cycle,
+		and predicts every branch not taken, flushing the two instructions
+		behind a taken branch or jump when it is resolved in EX.
+
+		Registers, the PSR, and memory are only written when an instruction
+		retires in WB, so at every break they hold the same state as the
+		"pipeline" engine. TRAP, RTI, and illegal instructions are not
+		pipelined: IF stops fetching behind them, and WB executes them on
+		their own with the single-cycle datapath. Interrupts are taken
+		between retiring instructions, flushing the pipeline.
+
+		The "block" engine executes translated basic blocks with the
+		single-cycle datapath, and the "jit" engine compiles them to host
+		code. Both fall back to the "pipeline" engine whenever
+		something could observe the events a block does not log.
 	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
 	class LC3bArch : public Architecture
 	{
 	protected:
 		ArchSim<LC3bISA> &TheSim;
 
+		//Execution engines, in the order they are added to Engines
+		//The jit engine is only added on hosts which can run compiled blocks.
+		enum EngineEnum {PipelineEngine = 0, FiveStageEngine, BlockEngine, CompiledEngine};
+
 		//Registers;
 		Register *pPC, *pIR, *pPSR, *pSSP, *pUSP, *pR[8], *pKBSR, *pKBDR, *pDSR, *pDDR, *pMCR;
 		//MMIO registers
@@ -49,10 +80,232 @@ namespace LC3b
 		enum CCEnum {N = 2, Z = 1, P = 0};
 		//Pending external interrupts
 		list<uint64> InterruptList;
+		//Pending external interrupts saved by TakeSnapshot
+		list<uint64> SnapshotInterrupts;
+
+		//An instruction decoded once and kept for as long as its memory
+		//location is not written.
+		struct DecodedInstruction
+		{
+			//Raw instruction word
+			LC3bISA::Word Binary;
+			//Sign-extended immediate or offset, or the trap vector
+			LC3bISA::Word Imm;
+			//Opcode. Illegal encodings get an opcode that matches no instruction.
+			unsigned char Opcode;
+			//Destination (or store source) register, first source (or base)
+			//register, and second source register
+			unsigned char DR, SR1, SR2;
+			//Immediate operand, JSR (not JSRR), shift direction/type, or branch NZP bits
+			unsigned char Flags;
+			//True if this cache entry holds a decoded instruction
+			bool fValid;
+			DecodedInstruction()
+			{
+				fValid = false;
+			}
+		};
+		//Predecoded instructions, indexed by instruction word address
+		//(byte address / 2)
+		vector<DecodedInstruction> DecodeCache;
+		//Translated basic blocks, indexed by the instruction word address of
+		//the first instruction. An empty block has not been translated.
+		vector< vector<DecodedInstruction> > BlockCache;
+		//True for each instruction word address that is part of a translated block
+		vector<bool> CodeMap;
+		//Compiles the translated blocks for the jit engine
+		BlockCompiler Compiler;
+		//Compiled code of each translated block, or NULL if it has not
+		//been compiled, indexed like BlockCache
+		vector<BlockCompiler::BlockFunction> CompiledBlocks;
+		//Set when a translated block is discarded, so the block engines
+		//stop executing a block that may have been overwritten
+		bool fBlockFlushed;
+		//Set when the datapath accesses an MMIO address
+		bool fMMIOAccess;
+		//Set while Fetch reads an instruction, so that DataRead leaves
+		//the access to the instruction cache
+		bool fFetching;
+
+		//Registers of a latch between two stages of the five-stage
+		//pipeline. Registers a latch does not have are NULL.
+		struct PipelineLatch
+		{
+			//Name of the latch's register set
+			const string *psSet;
+			//true if the latch holds an instruction, rather than a bubble
+			Register *pValid;
+			//Address and word of the instruction
+			Register *pPC, *pIR;
+			//ID/EX: the first and second source operands, and the condition
+			//codes for a branch
+			Register *pA, *pB, *pCC;
+			//EX/MEM and MEM/WB: the address of the next instruction, the
+			//value for the destination register or the memory address, and
+			//the value to store (or 1 for a taken branch)
+			Register *pNPC, *pResult, *pData;
+			//MEM/WB: the number of reads from MMIO left to WB, in which case
+			//the result is the address of the first of them
+			Register *pReads;
+		};
+		PipelineLatch IFID, IDEX, EXMEM, MEMWB;
+		//Address IF fetches from next
+		Register *pFetchPC;
+		//Set by a stage which redirects the fetch, so that IF does not fetch
+		//in the same cycle
+		bool fFetchBlocked;
 
 		//Pipeline stages
-		//Current implementation only has one pipeline with one stage.
+		//The "datapath" pipeline executes an instruction in one stage.
 		static bool DataPath(Architecture *);
+		//The "fivestage" pipeline
+		static bool FetchStage(Architecture *);
+		static bool DecodeStage(Architecture *);
+		static bool ExecuteStage(Architecture *);
+		static bool MemoryStage(Architecture *);
+		static bool WritebackStage(Architecture *);
+
+		/**********************************************************************\
+			Execute( [in] decoded instruction )
+
+			Executes the instruction at the PC in one step, and flags the
+			instruction event of the next instruction.
+		\******/
+		void Execute(const DecodedInstruction &);
+
+		/**********************************************************************\
+			BlockStep( [in] decoded instruction )
+
+			Fetches and executes an instruction of a translated block. Returns
+			true if the block has to stop after it, for a break, a discarded
+			block, I/O, or a pending interrupt.
+		\******/
+		bool BlockStep(const DecodedInstruction &);
+
+		//Memory accesses of compiled blocks, named after the address they
+		//warn about when it is not aligned
+		enum CompiledAccessEnum {LDbAccess = 0, LDAccess, LDIFirstAccess, LDISecondAccess, STbAccess, STAccess, STIFirstAccess, STISecondAccess, TrapAccess};
+
+		//Helper functions of compiled blocks, which read and write memory
+		//and log subroutine calls and returns like Execute
+		template<unsigned int Access>
+		static uint64 CompiledRead(void *, uint64);
+		template<unsigned int Access>
+		static uint64 CompiledWrite(void *, uint64, uint64);
+		static uint64 CompiledCall(void *, uint64, uint64);
+		static uint64 CompiledReturn(void *);
+
+		//Returns BlockCompiler::STOP if a compiled block has to stop after
+		//the current instruction, for the same reasons as BlockStep
+		uint64 CompiledStop() const;
+
+		/**********************************************************************\
+			CompileOperation( [in] decoded instruction, [in] its address,
+				[out] operation )
+
+			Translates an instruction for the block compiler. Returns false
+			for an instruction which can't be compiled and has to be
+			interpreted: RTI and illegal encodings.
+		\******/
+		static bool CompileOperation(const DecodedInstruction &, LC3bISA::Word, BlockCompiler::Operation &);
+
+		/**********************************************************************\
+			Compile( [in] instruction word address )
+
+			Returns the compiled code of the translated block which starts at
+			the given address, compiling it first if necessary. The block
+			has to be translated already. The code stops before the first
+			instruction which can't be compiled, so the rest of the block
+			is interpreted. Returns NULL if none of it can be compiled.
+		\******/
+		BlockCompiler::BlockFunction Compile(LC3bISA::Word);
+
+		/**********************************************************************\
+			CanRunCompiled( [in] instructions in the block, [in] most
+				instructions to execute )
+
+			Compiled code only counts the instructions of a block once it
+			returns, and does not log the events of each instruction. So
+			it only runs blocks which can't pass the instruction limit,
+			while nothing else watches the instructions, and while the
+			condition codes are valid.
+		\******/
+		bool CanRunCompiled(size_t, uint64) const;
+
+		/**********************************************************************\
+			RunCompiled( [in] compiled block )
+
+			Runs a compiled block with the registers, and counts its
+			instructions. Returns the number of instructions executed.
+		\******/
+		unsigned int RunCompiled(BlockCompiler::BlockFunction);
+
+		/**********************************************************************\
+			AddLatch( [in] latch register set name, [out] latch,
+				[in] true if it holds operands, [in] true if it holds results )
+
+			Adds the register set of a pipeline latch.
+		\******/
+		void AddLatch(const string &, PipelineLatch &, bool, bool);
+
+		/**********************************************************************\
+			SetLatch( [in] register set name, [in] register, [in] value )
+
+			Writes a pipeline register and logs the register event.
+		\******/
+		void SetLatch(const string &, Register &, uint64);
+
+		/**********************************************************************\
+			Squash( [in] latch )
+
+			Turns the instruction in the latch into a bubble. Returns 1 if
+			there was an instruction, else 0.
+		\******/
+		unsigned int Squash(const PipelineLatch &);
+
+		/**********************************************************************\
+			Flush( )
+
+			Squashes every instruction behind the one in WB, and counts the
+			flush. IF then fetches from the PC.
+		\******/
+		void Flush();
+
+		/**********************************************************************\
+			ForwardRegister( [in] register number )
+			ForwardCC( )
+
+			Reads a source operand for the instruction in decode. The result
+			of the instruction in EX/MEM or MEM/WB is used if it writes the
+			register (or condition codes); otherwise the register file is
+			read.
+		\******/
+		LC3bISA::Word ForwardRegister(unsigned char);
+		LC3bISA::Word ForwardCC();
+
+		/**********************************************************************\
+			MemoryReads( [in] decoded instruction, [in-out] address,
+				[in] number of reads left, [in] true to read from MMIO )
+
+			Does the last reads of a load, or the first read of STI. The
+			address is replaced by the value read. Unless MMIO is to be
+			read, it stops at an address in MMIO. Returns the number of
+			reads left.
+		\******/
+		unsigned int MemoryReads(const DecodedInstruction &, LC3bISA::Word &, unsigned int, bool);
+
+		//Register the instruction writes, or NO_REGISTER
+		static unsigned char Destination(const DecodedInstruction &);
+		//true if the instruction sets the condition codes from its result
+		static bool SetsCC(unsigned char);
+		//true if the instruction reads memory into its destination register
+		static bool IsLoad(unsigned char);
+		//Number of memory reads the five-stage pipeline does in MEM
+		static unsigned int ReadCount(unsigned char);
+		//true if the five-stage pipeline executes the instruction on its own
+		static bool IsSerializing(unsigned char);
+		//Condition codes for a result
+		static LC3bISA::Word CC(LC3bISA::Word);
 
 		/**********************************************************************\
 			SEXT( [in] value, [in] bits )
@@ -63,20 +316,66 @@ namespace LC3b
 		static LC3bISA::Word SEXT(LC3bISA::Word, unsigned char);
 
 		/**********************************************************************\
-			SetCC( [in] value )
+			Decode( [in] instruction word )
 
-			Checks the input value for positive, zero, and negative, and sets
-			the appropriate condition codes.
+			Decodes the instruction word into its opcode, operands, and
+			sign-extended immediate. Illegal encodings are given an
+			opcode that does not match any instruction.
 		\******/
-		void SetCC( signed short);
+		static DecodedInstruction Decode(LC3bISA::Word);
 
 		/**********************************************************************\
-			MakeInt( [in] data vector, [in] bits, [in] simulator )
+			Fetch( [in] address )
 
-			Takes a data vector and converts it into an unsigned int of the
-			specified bit length and returns it.
+			Reads and decodes the instruction at the given address. The decoded
+			instruction is cached so that the next fetch from the same
+			address skips the memory read and the decode. The data and memory
+			events of the read are logged with the simulator either way.
+			MMIO and unaligned addresses are never cached.
 		\******/
-		static LC3bISA::Word MakeInt(const RamVector &, unsigned char, ArchSim<LC3bISA> &);
+		DecodedInstruction Fetch(LC3bISA::Word);
+
+		/**********************************************************************\
+			Translate( [in] instruction word address )
+
+			Returns the translated block which starts at the given address,
+			translating it first if necessary. A block ends with the first
+			instruction that can change the flow of control, or after
+			MAX_BLOCK_INSTRUCTIONS. Blocks are never translated from MMIO
+			addresses, so the returned block is empty for those.
+		\******/
+		vector<DecodedInstruction> &Translate(LC3bISA::Word);
+
+		/**********************************************************************\
+			InvalidateDecode( [in] memory image )
+
+			Discards the cached decoded instructions and translated blocks
+			that overlap the locations in the memory image.
+		\******/
+		void InvalidateDecode(const RamImage &);
+
+		/**********************************************************************\
+			InvalidateDecode( [in] instruction word address )
+
+			Discards the cached decoded instruction and the translated blocks
+			that overlap the given instruction word address.
+		\******/
+		void InvalidateDecode(LC3bISA::Word);
+
+		/**********************************************************************\
+			InvalidateDecode( )
+
+			Discards all cached decoded instructions and translated blocks.
+		\******/
+		void InvalidateDecode();
+
+		/**********************************************************************\
+			SetCC( [in] value )
+
+			Checks the input value for positive, zero, and negative, and sets
+			the appropriate condition codes.
+		\******/
+		void SetCC( signed short);
 
 		/**********************************************************************\
 			Exception( [in] exception vector )
@@ -132,11 +431,17 @@ namespace LC3b
 
 	public:
 		LC3bArch(ArchSim<LC3bISA> &);
-		virtual bool Reset(const RamVector &);
+		virtual bool Run();
+		virtual bool RunCycles(uint64, uint64 &);
+		virtual bool Reset(const RamImage &);
+		virtual bool TakeSnapshot();
+		virtual bool RestoreSnapshot();
 		virtual uint64 NextInstruction();
 		virtual bool Interrupt(uint64);
-		virtual bool DataRead(RamVector &, uint64, uint64);
-		virtual bool DataWrite(const RamVector &);
+		virtual bool DataRead(vector<unsigned char> &, uint64, uint64);
+		virtual bool DataWrite(const RamImage &);
+		virtual void MemoryChanged(const Memory &, const RamImage &);
+		virtual void MemoryRestored(const Memory &, const vector<uint64> &);
 		virtual bool CreateRegisters();
 		virtual bool CreateMemories();
 		virtual bool CreatePipelines();
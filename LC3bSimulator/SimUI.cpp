@@ -20,7 +20,7 @@ namespace LC3b
 static unsigned int Warnings = 0, Errors = 0;
 static bool fSignalWrite = true, fLeftOvers = false;
 
-bool SimulatorUI(vector<Program *> &AsmPrograms, RamVector &MemoryImage)
+bool SimulatorUI(vector<Program *> &AsmPrograms, RamImage &MemoryImage)
 {
 	ArchSim<LC3bISA> TheSim(SimMessageCallBack, SimCallBack, SimCommand, SimReadConsole, SimWriteConsole);
 	LC3bArch TheArch(TheSim);
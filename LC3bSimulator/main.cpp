@@ -34,14 +34,14 @@ int main(int argc, char* argv[])
 			PrintUsage();
 			return 0;
 		}
-		Flags.fSimulate = true;
+		TheContext.Flags.fSimulate = true;
 		
 		//This will hold the symbolic form of the program.
 		vector<Program *> AsmPrograms;
 		//This will hold the memory image of the program
-		RamVector MemoryImage;
+		RamImage MemoryImage;
 
-		if(AssemblerUI(AsmPrograms, MemoryImage) && Flags.fSimulate)
+		if(AssemblerUI(AsmPrograms, MemoryImage) && TheContext.Flags.fSimulate)
 			SimulatorUI(AsmPrograms, MemoryImage);
 
 		for(unsigned int i = 0; i < AsmPrograms.size(); i++)
@@ -93,21 +93,21 @@ bool ProcessArgs(int argc, char* argv[])
 			{
 			case 'a':
 			case 'A':
-				if(Flags.fPrintAST)
+				if(TheContext.Flags.fPrintAST)
 					cout << "Warning:   -a specified more than once.";
-				Flags.fPrintAST = true;
+				TheContext.Flags.fPrintAST = true;
 				break;
 			case 'b':
 			case 'B':
-				if(Flags.fOutputImage)
+				if(TheContext.Flags.fOutputImage)
 					cout << "Warning:   -d specified more than once.";
-				Flags.fOutputImage = true;
+				TheContext.Flags.fOutputImage = true;
 				break;
 			case 'c':
 			case 'C':
-				if(Flags.fStdout)
+				if(TheContext.Flags.fStdout)
 					cout << "Warning:   -c specified more than once.";
-				Flags.fStdout = true;
+				TheContext.Flags.fStdout = true;
 				break;
 			case 'd':
 			case 'D':
@@ -136,7 +136,7 @@ bool ProcessArgs(int argc, char* argv[])
 			case 'O':
 				if(argv[i][2] == 's' || argv[i][2] == 'S')
 				{
-					if(Flags.fUseOS)
+					if(TheContext.Flags.fUseOS)
 						cout << "Warning:   -os specified more than once.";
 					//first try to open the OS file
 					//*NOTE: GCC bug doesn't recognize char[]->string conversion for "=" constructor,
@@ -160,42 +160,42 @@ bool ProcessArgs(int argc, char* argv[])
 						}
 						break;
 					}
-					InputList.push_back(sOSLocation.Full);
-					Flags.fUseOS = true;
+					TheContext.InputList.push_back(sOSLocation.Full);
+					TheContext.Flags.fUseOS = true;
 				}
 				else
 				{
-					if(Flags.fUseOptimizations)
+					if(TheContext.Flags.fUseOptimizations)
 						cout << "Warning:   -o specified more than once.";
-					Flags.fUseOptimizations = true;
+					TheContext.Flags.fUseOptimizations = true;
 				}
 				break;
 			case 's':
 			case 'S':
 				if( (argv[i][2] == 'i' || argv[i][2] == 'I') && (argv[i][3] == 'm' || argv[i][3] == 'M') )
 				{
-					if(Flags.fSimulate)
+					if(TheContext.Flags.fSimulate)
 						cout << "Warning:   -sim specified more than once.";
-					Flags.fSimulate = true;
+					TheContext.Flags.fSimulate = true;
 				}
 				else
 				{
-					if(Flags.fPrintSymbols)
+					if(TheContext.Flags.fPrintSymbols)
 						cout << "Warning:   -s specified more than once.";
-					Flags.fPrintSymbols = true;
+					TheContext.Flags.fPrintSymbols = true;
 				}
 				break;
 			case 't':
 			case 'T':
-				if(Flags.fPrintTokens)
+				if(TheContext.Flags.fPrintTokens)
 					cout << "Warning:   -t specified more than once.";
-				Flags.fPrintTokens = true;
+				TheContext.Flags.fPrintTokens = true;
 				break;
 			case 'v':
 			case 'V':
-				if(Flags.fOutputVHDL)
+				if(TheContext.Flags.fOutputVHDL)
 					cout << "Warning:   -v specified more than once.";
-				Flags.fOutputVHDL = true;
+				TheContext.Flags.fOutputVHDL = true;
 				if(i + 1 < argc && argv[i+1][0] != '-')
 				{
 					sOutputFileName = argv[++i];
@@ -204,9 +204,9 @@ bool ProcessArgs(int argc, char* argv[])
 				break;
 			case 'w':
 			case 'W':
-				if(Flags.fConsoleWidth)
+				if(TheContext.Flags.fConsoleWidth)
 					cout << "Warning:   -w specified more than once.";
-				Flags.fConsoleWidth = true;
+				TheContext.Flags.fConsoleWidth = true;
 				if(i + 1 < argc && argv[i+1][0] != '-')
 				{
 					i++;
@@ -231,9 +231,9 @@ bool ProcessArgs(int argc, char* argv[])
 			continue;
 		}
 		//Store the filename
-		InputList.push_back(CreateStandardPath(argv[i]));
+		TheContext.InputList.push_back(CreateStandardPath(argv[i]));
 	}
-	if(InputList.empty())
+	if(TheContext.InputList.empty())
 	{
 		cout << "Error: No input files specified.\n\n";
 		return false;
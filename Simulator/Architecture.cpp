@@ -12,6 +12,11 @@ namespace Simulator	{
 Architecture::Architecture()
 {
 	KeyboardInterruptVector = 0;
+	RegisterCount = 0;
+	MemoryCount = 0;
+	Engines.push_back("pipeline");
+	Engine = 0;
+	fSnapshot = false;
 }
 
 bool Architecture::Run()
@@ -22,6 +27,82 @@ bool Architecture::Run()
 	return true;
 }
 
+bool Architecture::RunCycles(uint64 MaxCycles, uint64 &Cycles)
+{
+	Cycles = 0;
+	if(!Run())
+		return false;
+	Cycles = 1;
+	return true;
+}
+
+void Architecture::NumberRegisters()
+{
+	RegisterCount = 0;
+	for(RegisterSetMap::iterator RegSetIter = RegisterSets.begin(); RegSetIter != RegisterSets.end(); RegSetIter++)
+		for(RegisterSet::RegisterMap::iterator RegIter = RegSetIter->second.Registers.begin(); RegIter != RegSetIter->second.Registers.end(); RegIter++)
+			RegIter->second.ID = RegisterCount++;
+}
+
+void Architecture::NumberMemories()
+{
+	MemoryCount = 0;
+	for(MemoryMap::iterator MemIter = Memories.begin(); MemIter != Memories.end(); MemIter++)
+		MemIter->second.ID = MemoryCount++;
+}
+
+void Architecture::MemoryChanged(const Memory &, const RamImage &)
+{
+}
+
+bool Architecture::TakeSnapshot()
+{
+	fSnapshot = false;
+	SnapshotRegisters.clear();
+	for(RegisterSetMap::iterator RegSetIter = RegisterSets.begin(); RegSetIter != RegisterSets.end(); RegSetIter++)
+		for(RegisterSet::RegisterMap::iterator RegIter = RegSetIter->second.Registers.begin(); RegIter != RegSetIter->second.Registers.end(); RegIter++)
+			SnapshotRegisters.push_back(RegIter->second.Value);
+
+	for(MemoryMap::iterator MemIter = Memories.begin(); MemIter != Memories.end(); MemIter++)
+	{
+		if(!MemIter->second.TakeSnapshot())
+		{
+			for(MemIter = Memories.begin(); MemIter != Memories.end(); MemIter++)
+				MemIter->second.DiscardSnapshot();
+			return false;
+		}
+	}
+
+	fSnapshot = true;
+	return true;
+}
+
+bool Architecture::RestoreSnapshot()
+{
+	if(!fSnapshot)
+		return false;
+
+	//Registers are visited in the same order as when they were saved
+	vector<uint64>::iterator ValueIter = SnapshotRegisters.begin();
+	for(RegisterSetMap::iterator RegSetIter = RegisterSets.begin(); RegSetIter != RegisterSets.end(); RegSetIter++)
+		for(RegisterSet::RegisterMap::iterator RegIter = RegSetIter->second.Registers.begin(); RegIter != RegSetIter->second.Registers.end(); RegIter++)
+			RegIter->second.Value = *ValueIter++;
+
+	for(MemoryMap::iterator MemIter = Memories.begin(); MemIter != Memories.end(); MemIter++)
+	{
+		RestoredPages.clear();
+		MemIter->second.RestoreSnapshot(RestoredPages);
+		if(!RestoredPages.empty())
+			MemoryRestored(MemIter->second, RestoredPages);
+	}
+
+	return true;
+}
+
+void Architecture::MemoryRestored(const Memory &, const vector<uint64> &)
+{
+}
+
 Architecture::~Architecture()
 {
 }
@@ -13,6 +13,9 @@
 #include "Pipeline.h"
 #include "Memory.h"
 #include "Register.h"
+#include "PerfCounters.h"
+#include "Cache.h"
+#include "BranchPredictor.h"
 #include "../Assembler/Base.h"
 
 using namespace std;
@@ -71,6 +74,25 @@ namespace Simulator
 		\******/
 		virtual bool CreatePipelines() = 0;
 
+		/**********************************************************************\
+			NumberRegisters( )
+
+			Gives every register in every register set a unique ID, from 0 to
+			RegisterCount - 1, so the simulator can look up register events
+			without comparing names. Should be called at the end of
+			CreateRegisters.
+		\******/
+		void NumberRegisters();
+
+		/**********************************************************************\
+			NumberMemories( )
+
+			Gives every memory a unique ID, from 0 to MemoryCount - 1, so the
+			simulator can look up memory events without comparing names.
+			Should be called at the end of CreateMemories.
+		\******/
+		void NumberMemories();
+
 	public:
 		//List of pipelines. Pipelines must be added in order of propagation.
 		//Pipelines are run in reverse order.
@@ -82,8 +104,30 @@ namespace Simulator
 		//List of register sets
 		typedef map<string, RegisterSet> RegisterSetMap;
 		RegisterSetMap RegisterSets;
+		//Number of IDs given out by NumberRegisters and NumberMemories
+		unsigned int RegisterCount, MemoryCount;
 		//The keyboard interrupt vector
 		uint64 KeyboardInterruptVector;
+		//Names of the execution engines Run can use. The first engine
+		//always executes the pipelines.
+		vector<string> Engines;
+		//Index of the engine Run currently uses
+		unsigned int Engine;
+		//true if TakeSnapshot succeeded, so RestoreSnapshot can be used
+		bool fSnapshot;
+		//Register values saved by TakeSnapshot, in register ID order
+		vector<uint64> SnapshotRegisters;
+		//Byte addresses of the memory pages copied back by RestoreSnapshot
+		vector<uint64> RestoredPages;
+		//Execution statistics. The inherited architecture names its opcodes
+		//and counts the events its engines execute.
+		PerfCounters Counters;
+		//Cache timing model. The inherited architecture reports its
+		//instruction fetches and data accesses to memory.
+		CacheHierarchy Caches;
+		//Branch prediction model. The inherited architecture sets the
+		//address shift and reports its branches, jumps, calls, and returns.
+		BranchModel Branches;
 
 		/**********************************************************************\
 			Architecture( )
@@ -96,17 +140,52 @@ namespace Simulator
 		/**********************************************************************\
 			Run( )
 
-			Executes one cycle of the architecture.
+			Executes one cycle of the architecture. The default implementation
+			runs the pipelines. An architecture that provides additional
+			engines should run the selected engine instead.
 		\******/
 		virtual bool Run();
 
+		/**********************************************************************\
+			RunCycles( [in] maximum cycles, [out] cycles executed )
+
+			Executes at most the given number of cycles and returns how many
+			were executed. Must stop after the first cycle in which the
+			simulator breaks. The default implementation executes one cycle
+			with Run. An engine that runs several cycles per call must log
+			the same events per cycle as Run would.
+		\******/
+		virtual bool RunCycles(uint64, uint64 &);
+
 		/**********************************************************************\
 			Reset( [in] memory image )
 
 			Resets the architecture. Resets memory and register state.
 			Uses the imput memory image of the initial program.
 		\******/
-		virtual bool Reset(const RamVector &) = 0;
+		virtual bool Reset(const RamImage &) = 0;
+
+		/**********************************************************************\
+			TakeSnapshot( )
+
+			Saves the register values and memory contents so that
+			RestoreSnapshot can return the architecture to this state.
+			Returns false if a memory cannot take a snapshot, in which case
+			Reset must be used instead. An architecture with additional
+			state should save it as well.
+		\******/
+		virtual bool TakeSnapshot();
+
+		/**********************************************************************\
+			RestoreSnapshot( )
+
+			Returns the architecture to the state saved by TakeSnapshot.
+			Only the memory pages written since the snapshot are copied back,
+			and MemoryRestored is called for each memory with their
+			addresses. An architecture with additional state should restore
+			it as well.
+		\******/
+		virtual bool RestoreSnapshot();
 
 		/**********************************************************************\
 			NextInstruction( )
@@ -124,15 +203,16 @@ namespace Simulator
 		virtual bool Interrupt(uint64) = 0;
 
 		/**********************************************************************\
-			DataRead( [in] memory image, [in] starting address, [in] length )
+			DataRead( [out] bytes, [in] starting address, [in] length )
 
-			Reads the memory image from the logical program memory.
+			Reads the bytes at consecutive addresses from the logical program
+			memory.
 			A given location in the logical program memory could be located in
 			the architecture's main memory, or it could be loaded into caches
 			or registers. Therefore, it is up to the architecture to find out
 			(or "know") where this location is, and read from it.
 		\******/
-		virtual bool DataRead(RamVector &, uint64, uint64) = 0;
+		virtual bool DataRead(vector<unsigned char> &, uint64, uint64) = 0;
 
 		/**********************************************************************\
 			DataWrite( [in] memory image )
@@ -143,7 +223,29 @@ namespace Simulator
 			or registers. Therefore, it is up to the architecture to find out
 			(or "know") where this location is, and write to it.
 		\******/
-		virtual bool DataWrite(const RamVector &) = 0;
+		virtual bool DataWrite(const RamImage &) = 0;
+
+		/**********************************************************************\
+			MemoryChanged( [in] memory, [in] memory image )
+
+			Called after a memory has been written directly, bypassing
+			DataWrite (such as by the simulator user interface). The memory
+			image holds the locations that were written. An architecture that
+			keeps its own copy of memory contents, such as predecoded
+			instructions, should discard the copy of those locations.
+		\******/
+		virtual void MemoryChanged(const Memory &, const RamImage &);
+
+		/**********************************************************************\
+			MemoryRestored( [in] memory, [in] restored page addresses )
+
+			Called by RestoreSnapshot after pages of a memory have been copied
+			back from the snapshot. Each address is the first byte of a page
+			of MEMORY_PAGE_BYTES bytes. Like MemoryChanged, an architecture
+			that keeps its own copy of memory contents should discard the
+			copy of those locations.
+		\******/
+		virtual void MemoryRestored(const Memory &, const vector<uint64> &);
 
 		//saving and loading snapshots
 		virtual istream &operator <<(istream &) = 0;
@@ -0,0 +1,499 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#include "BinaryTrace.h"
+#include <cstdio>
+#include <cstring>
+
+using namespace std;
+using namespace JMT;
+
+namespace Simulator	{
+
+BinaryTrace::BinaryTrace()
+{
+	Addressability = 0;
+	WordBytes = 0;
+	Cycle = 0;
+	Instruction = 0;
+	Address = 0;
+	Word = 0;
+	SlotWords = 0;
+	RingSlots = 0;
+	WriteIndex = 0;
+	ReadIndex = 0;
+	LocalWrite = 0;
+	CachedRead = 0;
+	FlushRequest = 0;
+	FlushDone = 0;
+	fStop = false;
+	fWriterIdle = false;
+	fProducerWaiting = false;
+	fThread = false;
+	fError = false;
+}
+
+BinaryTrace::~BinaryTrace()
+{
+	Close();
+}
+
+bool BinaryTrace::Create(const string &sFileName, unsigned int addressability, unsigned int wordbytes, const list<const RegisterSet *> &TraceRegSets, SimCallBackFunction)
+{
+	//Buffer for formatting error messages
+	char sMessageBuffer[384];
+
+	Close();
+	File.clear();
+	File.open(sFileName.c_str(), ios::out | ios::binary | ios::trunc);
+	if(!File.good())
+	{
+		File.close();
+		sprintf(sMessageBuffer, "Error opening file %.255s.", sFileName.c_str());
+		SimCallBack(Error, sMessageBuffer);
+		return false;
+	}
+
+	Addressability = addressability;
+	WordBytes = wordbytes;
+	Cycle = 0;
+	Instruction = 0;
+	Address = 0;
+	fError = false;
+	Buffer.reserve(TRACE_BUFFER_BYTES + 1024);
+
+	Buffer.insert(Buffer.end(), "ASHTRACE", "ASHTRACE" + 8);
+	PutVarint(TRACE_FILE_VERSION);
+	PutVarint(Addressability);
+	PutVarint(WordBytes);
+	PutVarint(TraceRegSets.size());
+	for(list<const RegisterSet *>::const_iterator RegSetIter = TraceRegSets.begin(); RegSetIter != TraceRegSets.end(); RegSetIter++)
+	{
+		PutString((*RegSetIter)->sName);
+		PutVarint((*RegSetIter)->Registers.size());
+		for(RegisterSet::RegisterMap::const_iterator RegIter = (*RegSetIter)->Registers.begin(); RegIter != (*RegSetIter)->Registers.end(); RegIter++)
+		{
+			const Register &TheReg = RegIter->second;
+			PutString(TheReg.sName);
+			PutVarint(TheReg.fFloat);
+			if(TheReg.fFloat)
+			{
+				PutVarint(TheReg.ExponentBits);
+				PutVarint(TheReg.MantissaBits);
+			}
+			else
+				PutVarint(TheReg.Bits);
+			PutVarint((uint64)TheReg);
+			TracedRegisters.push_back(&TheReg);
+			Values.push_back((uint64)TheReg);
+		}
+	}
+
+	//The ring holds a power of two slots, so that indexes can wrap
+	SlotWords = SLOT_HEADER_WORDS + TracedRegisters.size();
+	for(RingSlots = 1; RingSlots * 2 * SlotWords * sizeof(uint64) <= TRACE_RING_BYTES; RingSlots *= 2);
+	Ring.resize(RingSlots * SlotWords);
+	WriteIndex = 0;
+	ReadIndex = 0;
+	LocalWrite = 0;
+	CachedRead = 0;
+	FlushRequest = 0;
+	FlushDone = 0;
+	fStop = false;
+	fWriterIdle = false;
+	fProducerWaiting = false;
+	SEMAPHORE_CREATE(WriterWake)
+	SEMAPHORE_CREATE(ProducerWake)
+	THREAD_CREATE(Thread, WriterThread, this)
+	fThread = true;
+	return true;
+}
+
+void BinaryTrace::WriteText(uint64 address, uint64 word, const string &sText)
+{
+	TextWords[address] = word;
+	uint64 *pSlot = NextSlot();
+	pSlot[0] = TextRecord;
+	pSlot[1] = address;
+	pSlot[2] = word;
+	//The writer thread deletes the string once it is encoded
+	pSlot[3] = (uint64)(size_t)new string(sText);
+	CommitSlot();
+}
+
+void BinaryTrace::Flush()
+{
+	if(!fThread)
+		return;
+	Publish();
+	ATOMIC_STORE(FlushRequest, FlushRequest + 1)
+	MEMORY_BARRIER()
+	WakeWriter();
+
+	while(true)
+	{
+		ATOMIC_STORE(fProducerWaiting, true)
+		MEMORY_BARRIER()
+		if(ATOMIC_LOAD(FlushDone) == FlushRequest)
+			break;
+		SEMAPHORE_WAIT(ProducerWake)
+	}
+	ATOMIC_STORE(fProducerWaiting, false)
+}
+
+void BinaryTrace::WaitForSlot()
+{
+	//The writer thread may be waiting for these records to make room
+	Publish();
+	while(true)
+	{
+		ATOMIC_STORE(fProducerWaiting, true)
+		MEMORY_BARRIER()
+		if((CachedRead = ATOMIC_LOAD(ReadIndex)) != LocalWrite - RingSlots)
+			break;
+		SEMAPHORE_WAIT(ProducerWake)
+	}
+	ATOMIC_STORE(fProducerWaiting, false)
+}
+
+void BinaryTrace::Publish()
+{
+	//The records have to be in the ring before the writer can see them
+	ATOMIC_STORE(WriteIndex, LocalWrite)
+	MEMORY_BARRIER()
+	//The writer sleeps until there are enough records to be worth waking for
+	if(LocalWrite - (CachedRead = ATOMIC_LOAD(ReadIndex)) >= RingSlots / 4)
+		WakeWriter();
+}
+
+void BinaryTrace::WakeWriter()
+{
+	//Whichever thread changes its flag second sees the other's change, so
+	//the wakeup can't be lost between the writer's check and its wait
+	if(ATOMIC_LOAD(fWriterIdle))
+	{
+		ATOMIC_STORE(fWriterIdle, false)
+		SEMAPHORE_POST(WriterWake)
+	}
+}
+
+void BinaryTrace::WakeProducer()
+{
+	MEMORY_BARRIER()
+	if(ATOMIC_LOAD(fProducerWaiting))
+	{
+		ATOMIC_STORE(fProducerWaiting, false)
+		SEMAPHORE_POST(ProducerWake)
+	}
+}
+
+THREAD_FUNCTION(BinaryTrace::WriterThread, pParam)
+{
+	((BinaryTrace *)pParam)->WriteRecords();
+	return 0;
+}
+
+void BinaryTrace::WriteRecords()
+{
+	size_t Read = ReadIndex;
+	while(true)
+	{
+		//A flush covers every record published before it was requested
+		unsigned int Request = ATOMIC_LOAD(FlushRequest);
+		bool fStopping = ATOMIC_LOAD(fStop);
+		size_t Write = ATOMIC_LOAD(WriteIndex);
+
+		if(Read != Write)
+		{
+			//Free the slots a batch at a time, so the simulation seldom waits
+			size_t BatchEnd = Read + MIN(Write - Read, RingSlots / 4);
+			for(; Read != BatchEnd; Read++)
+				EncodeSlot(&Ring[(Read & (RingSlots - 1)) * SlotWords]);
+			ATOMIC_STORE(ReadIndex, Read)
+			WakeProducer();
+		}
+		else if(Request != FlushDone)
+		{
+			WriteBuffer();
+			File.flush();
+			if(!File.good())
+				ATOMIC_STORE(fError, true)
+			ATOMIC_STORE(FlushDone, Request)
+			WakeProducer();
+		}
+		else if(fStopping)
+			break;
+		else
+		{
+			//Sleep until Publish, Flush or Close wakes us
+			ATOMIC_STORE(fWriterIdle, true)
+			MEMORY_BARRIER()
+			if(ATOMIC_LOAD(WriteIndex) - Read < RingSlots / 4 && ATOMIC_LOAD(FlushRequest) == FlushDone && !ATOMIC_LOAD(fStop))
+				SEMAPHORE_WAIT(WriterWake)
+			ATOMIC_STORE(fWriterIdle, false)
+		}
+	}
+}
+
+void BinaryTrace::EncodeSlot(const uint64 *pSlot)
+{
+	if(pSlot[0] == TextRecord)
+	{
+		string *psText = (string *)(size_t)pSlot[3];
+		Buffer.push_back(TextRecord);
+		PutVarint(pSlot[1]);
+		PutVarint(pSlot[2]);
+		PutString(*psText);
+		delete psText;
+		return;
+	}
+
+	Buffer.push_back(InstructionRecord);
+	PutSigned((int64)(pSlot[1] - Cycle));
+	PutSigned((int64)(pSlot[2] - Instruction));
+	PutSigned((int64)(pSlot[3] - Address));
+	PutVarint(pSlot[4]);
+	Cycle = pSlot[1];
+	Instruction = pSlot[2];
+	Address = pSlot[3];
+
+	const uint64 *pValues = pSlot + SLOT_HEADER_WORDS;
+	Changed.clear();
+	for(unsigned int i = 0; i < Values.size(); i++)
+		if(pValues[i] != Values[i])
+			Changed.push_back(i);
+	PutVarint(Changed.size());
+	for(vector<unsigned int>::iterator ChangedIter = Changed.begin(); ChangedIter != Changed.end(); ChangedIter++)
+	{
+		PutVarint(*ChangedIter);
+		PutSigned((int64)(pValues[*ChangedIter] - Values[*ChangedIter]));
+		Values[*ChangedIter] = pValues[*ChangedIter];
+	}
+
+	if(Buffer.size() >= TRACE_BUFFER_BYTES)
+		WriteBuffer();
+}
+
+bool BinaryTrace::Open(const string &sFileName, SimCallBackFunction)
+{
+	//Buffer for formatting error messages
+	char sMessageBuffer[384];
+
+	Close();
+	File.clear();
+	File.open(sFileName.c_str(), ios::in | ios::binary);
+	if(!File.good())
+	{
+		File.close();
+		sprintf(sMessageBuffer, "Unable to open file %.255s", sFileName.c_str());
+		SimCallBack(Fatal, sMessageBuffer);
+		return false;
+	}
+
+	char sMagic[8];
+	uint64 Version, Value, SetCount, RegCount, fFloat, Bits, MantissaBits;
+	File.read(sMagic, 8);
+	if(!File.good() || memcmp(sMagic, "ASHTRACE", 8))
+	{
+		sprintf(sMessageBuffer, "%.255s is not a binary trace file.", sFileName.c_str());
+		SimCallBack(Error, sMessageBuffer);
+		Close();
+		return false;
+	}
+	if(!GetVarint(Version) || Version != TRACE_FILE_VERSION)
+	{
+		sprintf(sMessageBuffer, "%.255s was traced by a different version of the simulator.", sFileName.c_str());
+		SimCallBack(Error, sMessageBuffer);
+		Close();
+		return false;
+	}
+
+	Cycle = 0;
+	Instruction = 0;
+	Address = 0;
+	Word = 0;
+	RegisterSets.clear();
+	ReadRegisters.clear();
+	Texts.clear();
+	bool fValid = GetVarint(Value) && Value < 64;
+	Addressability = (unsigned int)Value;
+	fValid = fValid && GetVarint(Value) && Value <= sizeof(uint64);
+	WordBytes = (unsigned int)Value;
+	fValid = fValid && GetVarint(SetCount);
+	for(uint64 i = 0; fValid && i < SetCount; i++)
+	{
+		string sName;
+		fValid = GetString(sName) && GetVarint(RegCount);
+		RegisterSets.push_back(RegisterSet(sName));
+		for(uint64 j = 0; fValid && j < RegCount; j++)
+		{
+			fValid = GetString(sName) && GetVarint(fFloat) && GetVarint(Bits);
+			if(fValid && fFloat)
+				fValid = GetVarint(MantissaBits) && Bits + MantissaBits < 64;
+			fValid = fValid && GetVarint(Value) && Bits <= 64;
+			if(!fValid)
+				break;
+			Register TheReg = (fFloat ? Register(sName, (unsigned char)Bits, (unsigned char)MantissaBits, Value) : Register(sName, (unsigned char)Bits, Value));
+			pair<RegisterSet::RegisterMap::iterator, bool> RegIter = RegisterSets.back().Registers.insert(RegisterSet::RegisterMap::value_type(sName, TheReg));
+			//Registers are written in name order, so each must come after the last
+			if(!RegIter.second || ++RegisterSet::RegisterMap::iterator(RegIter.first) != RegisterSets.back().Registers.end())
+				fValid = false;
+			else
+				ReadRegisters.push_back(&RegIter.first->second);
+		}
+	}
+	if(!fValid)
+	{
+		sprintf(sMessageBuffer, "%.255s is truncated or corrupt.", sFileName.c_str());
+		SimCallBack(Error, sMessageBuffer);
+		Close();
+		return false;
+	}
+	return true;
+}
+
+bool BinaryTrace::Read(SimCallBackFunction)
+{
+	int RecordType;
+	while((RecordType = File.get()) != EOF)
+	{
+		if(RecordType == TextRecord)
+		{
+			uint64 address, word;
+			string sText;
+			if(!GetVarint(address) || !GetVarint(word) || !GetString(sText))
+				break;
+			Texts[address] = sText;
+		}
+		else if(RecordType == InstructionRecord)
+		{
+			int64 Delta;
+			uint64 ChangeCount, Index;
+			if(!GetSigned(Delta))
+				break;
+			Cycle += Delta;
+			if(!GetSigned(Delta))
+				break;
+			Instruction += Delta;
+			if(!GetSigned(Delta))
+				break;
+			Address += Delta;
+			if(!GetVarint(Word) || !GetVarint(ChangeCount))
+				break;
+			uint64 i;
+			for(i = 0; i < ChangeCount; i++)
+			{
+				if(!GetVarint(Index) || Index >= ReadRegisters.size() || !GetSigned(Delta))
+					break;
+				*ReadRegisters[(size_t)Index] = ReadRegisters[(size_t)Index]->Value + Delta;
+			}
+			if(i < ChangeCount)
+				break;
+			return true;
+		}
+		else
+			break;
+	}
+
+	if(RecordType != EOF)
+		SimCallBack(Error, "The trace is truncated or corrupt.");
+	return false;
+}
+
+const string &BinaryTrace::Text() const
+{
+	static const string sNoText = "";
+	map<uint64, string>::const_iterator TextIter = Texts.find(Address);
+	return TextIter == Texts.end() ? sNoText : TextIter->second;
+}
+
+bool BinaryTrace::Close()
+{
+	if(fThread)
+	{
+		Flush();
+		ATOMIC_STORE(fStop, true)
+		MEMORY_BARRIER()
+		WakeWriter();
+		THREAD_JOIN(Thread)
+		SEMAPHORE_CLOSE(WriterWake)
+		SEMAPHORE_CLOSE(ProducerWake)
+		fThread = false;
+	}
+	if(!File.is_open())
+		return true;
+	//A trace being read has nothing to write
+	WriteBuffer();
+	bool fSuccess = !fError;
+	File.close();
+	Buffer.clear();
+	TracedRegisters.clear();
+	Values.clear();
+	TextWords.clear();
+	Ring.clear();
+	return fSuccess;
+}
+
+void BinaryTrace::PutVarint(uint64 Value)
+{
+	while(Value >= 0x80)
+	{
+		Buffer.push_back((unsigned char)(Value | 0x80));
+		Value >>= 7;
+	}
+	Buffer.push_back((unsigned char)Value);
+}
+
+void BinaryTrace::PutString(const string &sString)
+{
+	PutVarint(sString.size());
+	Buffer.insert(Buffer.end(), sString.begin(), sString.end());
+}
+
+void BinaryTrace::WriteBuffer()
+{
+	if(Buffer.empty())
+		return;
+	File.write((const char *)&Buffer[0], Buffer.size());
+	if(!File.good())
+		ATOMIC_STORE(fError, true)
+	Buffer.clear();
+}
+
+bool BinaryTrace::GetVarint(uint64 &Value)
+{
+	Value = 0;
+	for(unsigned int Shift = 0; Shift < 64; Shift += 7)
+	{
+		int Byte = File.get();
+		if(Byte == EOF)
+			return false;
+		Value |= (uint64)(Byte & 0x7F) << Shift;
+		if(!(Byte & 0x80))
+			return true;
+	}
+	return false;
+}
+
+bool BinaryTrace::GetSigned(int64 &Value)
+{
+	uint64 ZigZag;
+	if(!GetVarint(ZigZag))
+		return false;
+	Value = (int64)(ZigZag >> 1) ^ -(int64)(ZigZag & 1);
+	return true;
+}
+
+bool BinaryTrace::GetString(string &sString)
+{
+	uint64 Length;
+	if(!GetVarint(Length) || Length > (1 << 20))
+		return false;
+	sString.resize((size_t)Length);
+	if(Length)
+		File.read(&sString[0], (streamsize)Length);
+	return File.good();
+}
+
+}	//namespace Simulator
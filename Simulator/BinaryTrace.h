@@ -0,0 +1,231 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#ifndef BINARYTRACE_H
+#define BINARYTRACE_H
+
+#pragma warning (disable:4786)
+#include <vector>
+#include <list>
+#include <map>
+#include <string>
+#include <fstream>
+#include "Register.h"
+#include "../Assembler/Base.h"
+
+using namespace std;
+using namespace JMT;
+
+namespace Simulator
+{
+	//Format version written to the header of binary traces
+	const unsigned int TRACE_FILE_VERSION = 1;
+	//Bytes buffered before they are written to the trace file
+	const unsigned int TRACE_BUFFER_BYTES = 1 << 16;
+	//Bytes of the ring buffer which holds records until they are written
+	const unsigned int TRACE_RING_BYTES = 1 << 20;
+	//Number of records the simulation adds to the ring before the writer
+	//thread is told about them
+	const unsigned int TRACE_PUBLISH_RECORDS = 64;
+
+	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
+		BinaryTrace
+
+		An instance of this class writes or reads a binary execution trace.
+		Every integer is an unsigned little endian base 128 varint. Signed
+		values are zigzag encoded first, so that small negative values stay
+		short. Strings are a length followed by the characters.
+
+		Header: "ASHTRACE", version, addressability, instruction word
+		bytes, and the traced register sets. Each set is its name and the
+		number of registers, then each register's name, float flag, bits
+		(exponent and mantissa bits for a float), and initial value.
+
+		The header is followed by records, each starting with a record
+		type byte.
+
+		Text record: address, instruction word, and the text the simulator
+		prints for that instruction. It is written the first time an
+		address executes and whenever the word at that address changes, so
+		the instruction is only formatted once.
+
+		Instruction record: the change in cycle, instruction count and
+		address from the previous instruction record, the instruction word,
+		and the number of registers which changed, followed by the index
+		and change in value of each. Registers are indexed in the order
+		they are listed in the header.
+
+		While writing, the simulation thread only copies each record into
+		a single producer, single consumer ring buffer. A writer thread
+		encodes the records and writes them to the file. If the ring is
+		full, the simulation waits for the writer rather than dropping
+		records. Each thread sleeps on a semaphore while it has nothing to
+		do. Flush waits until every record so far is in the file.
+	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
+	class BinaryTrace
+	{
+	public:
+		enum RecordEnum {TextRecord = 1, InstructionRecord};
+
+		//Byte address bits and bytes per instruction word of the traced ISA
+		unsigned int Addressability, WordBytes;
+		//The traced register sets. While reading, these hold the values
+		//after the last instruction read.
+		list<RegisterSet> RegisterSets;
+		//The last instruction read
+		uint64 Cycle, Instruction, Address, Word;
+
+		BinaryTrace();
+		~BinaryTrace();
+
+		/**********************************************************************\
+			Create( [in] file name, [in] addressability, [in] word bytes,
+				[in] register sets to trace, [in] callback )
+
+			Opens the file for writing, writes the header, and starts the
+			writer thread. The register sets are read after every
+			instruction, so they have to outlive the trace.
+		\******/
+		bool Create(const string &, unsigned int, unsigned int, const list<const RegisterSet *> &, SimCallBackFunction);
+
+		//true if the text for the word at the address has not been written
+		bool NeedsText(uint64 Address, uint64 Word) const
+		{
+			map<uint64, uint64>::const_iterator TextIter = TextWords.find(Address);
+			return TextIter == TextWords.end() || TextIter->second != Word;
+		}
+		//Add a text record (address, instruction word, text)
+		void WriteText(uint64, uint64, const string &);
+		//Add an instruction record (cycle, instruction count, address, word)
+		void WriteInstruction(uint64 cycle, uint64 instruction, uint64 address, uint64 word)
+		{
+			uint64 *pSlot = NextSlot();
+			pSlot[0] = InstructionRecord;
+			pSlot[1] = cycle;
+			pSlot[2] = instruction;
+			pSlot[3] = address;
+			pSlot[4] = word;
+			//Register assignment keeps Value within Bits, so it needs no mask
+			for(size_t i = 0; i < TracedRegisters.size(); i++)
+				pSlot[SLOT_HEADER_WORDS + i] = TracedRegisters[i]->Value;
+			CommitSlot();
+		}
+		//Wait until every record added so far has been written to the file
+		void Flush();
+		//Forget which text records have been written, so that each
+		//instruction is formatted again the next time it executes
+		void ClearText()	{	TextWords.clear();	}
+
+		/**********************************************************************\
+			Open( [in] file name, [in] callback )
+
+			Opens a trace for reading and reads its header into
+			RegisterSets. Returns false if the file is missing or is not a
+			binary trace.
+		\******/
+		bool Open(const string &, SimCallBackFunction);
+
+		/**********************************************************************\
+			Read( [in] callback )
+
+			Reads up to and including the next instruction record. Updates
+			Cycle, Instruction, Address, Word and the registers. Returns
+			false at the end of the trace, or if it is corrupt.
+		\******/
+		bool Read(SimCallBackFunction);
+
+		//Text of the instruction last read
+		const string &Text() const;
+
+		//Flush, stop the writer thread, and close the file. Returns false if
+		//any write failed.
+		bool Close();
+		bool IsOpen() const	{	return File.is_open();	}
+		//false if a write has failed
+		bool Good() const	{	return !ATOMIC_LOAD(fError);	}
+
+	protected:
+		//Words at the start of each slot: record type, then cycle,
+		//instruction count, address and word, or address, word and a
+		//string * for a text record. The register values follow.
+		static const unsigned int SLOT_HEADER_WORDS = 5;
+
+		fstream File;
+		//Encoded bytes not yet written
+		vector<unsigned char> Buffer;
+		//Registers being traced
+		vector<const Register *> TracedRegisters;
+		//Their values in the last record written
+		vector<uint64> Values;
+
+		//The ring of records. Slot i starts at word i * SlotWords.
+		vector<uint64> Ring;
+		size_t SlotWords, RingSlots;
+		//Records added by the simulation, and records written by the writer
+		//thread. Each is only changed by its own thread. These and the other
+		//volatile members are shared with the writer thread, so they are
+		//only accessed with ATOMIC_LOAD and ATOMIC_STORE while it runs.
+		volatile size_t WriteIndex, ReadIndex;
+		//WriteIndex not yet published, and the last ReadIndex seen
+		size_t LocalWrite, CachedRead;
+		//Flushes asked for by the simulation, and done by the writer thread
+		volatile unsigned int FlushRequest, FlushDone;
+		//true to stop the writer thread once the ring is empty
+		volatile bool fStop;
+		//true while the writer thread is, or is about to be, asleep on
+		//WriterWake, and while the simulation is on ProducerWake
+		volatile bool fWriterIdle, fProducerWaiting;
+		SEMAPHORE_TYPE WriterWake, ProducerWake;
+		//true while the writer thread is running
+		bool fThread;
+		THREAD_TYPE Thread;
+		//Registers being read, in the same order
+		vector<Register *> ReadRegisters;
+		//Word whose text was last written for each address
+		map<uint64, uint64> TextWords;
+		//Text last read for each address
+		map<uint64, string> Texts;
+		//Registers which changed in the current instruction
+		vector<unsigned int> Changed;
+		//true if a write failed
+		volatile bool fError;
+
+		//The slot for the next record, after waiting for room in the ring
+		uint64 *NextSlot()
+		{
+			if(LocalWrite - CachedRead == RingSlots)
+				WaitForSlot();
+			return &Ring[(LocalWrite & (RingSlots - 1)) * SlotWords];
+		}
+		void WaitForSlot();
+		//Add the record in the slot returned by NextSlot
+		void CommitSlot()
+		{
+			LocalWrite++;
+			if(!(LocalWrite & (TRACE_PUBLISH_RECORDS - 1)))
+				Publish();
+		}
+		//Let the writer thread see the records added so far
+		void Publish();
+		//Wake whichever thread is sleeping, if it is
+		void WakeWriter();
+		void WakeProducer();
+		//Writer thread, and the loop it runs
+		static THREAD_FUNCTION(WriterThread, pParam);
+		void WriteRecords();
+		//Encode one slot to Buffer
+		void EncodeSlot(const uint64 *);
+		//Write Buffer to the file
+		void WriteBuffer();
+
+		void PutVarint(uint64);
+		void PutSigned(int64 Value)	{	PutVarint(((uint64)Value << 1) ^ (uint64)(Value >> 63));	}
+		void PutString(const string &);
+		bool GetVarint(uint64 &);
+		bool GetSigned(int64 &);
+		bool GetString(string &);
+	};
+}
+
+#endif
@@ -0,0 +1,494 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#pragma warning (disable:4786)
+#include "BlockCompiler.h"
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#ifdef BLOCK_COMPILER_SUPPORTED
+	#include <sys/mman.h>
+#endif
+
+using namespace std;
+using namespace JMT;
+
+namespace Simulator	{
+
+BlockCompiler::BlockCompiler()
+{
+	pBuffer = NULL;
+	fMapFailed = false;
+	Used = 0;
+	fException = false;
+	fRuntimeError = false;
+	sThrown = NULL;
+}
+
+BlockCompiler::~BlockCompiler()
+{
+#ifdef BLOCK_COMPILER_SUPPORTED
+	if(pBuffer)
+		munmap(pBuffer, BLOCK_COMPILER_BYTES);
+#endif
+}
+
+bool BlockCompiler::Supported()
+{
+#ifdef BLOCK_COMPILER_SUPPORTED
+	return true;
+#else
+	return false;
+#endif
+}
+
+#ifdef BLOCK_COMPILER_SUPPORTED
+//Host registers, by their x86-64 encodings
+enum HostRegisterEnum {RAX = 0, RCX, RDX, RBX, RSP, RBP, RSI, RDI, R8, R9, R10, R11, R12, R13, R14, R15};
+//Host register of each simulated register. The helpers preserve R12-R15,
+//so R0-R3 stay in them across calls. R4-R7 are saved to the state before
+//each call and loaded again after it.
+static const unsigned char HostRegister[8] = {R12, R13, R14, R15, R8, R9, R10, R11};
+static const unsigned char SAVED_REGISTERS = 0xF0;
+//Condition codes of the jcc instructions
+enum HostConditionEnum {CarryCondition = 0x2, EqualCondition = 0x4, NotEqualCondition = 0x5, LessCondition = 0xC, GreaterEqualCondition = 0xD, LessEqualCondition = 0xE, GreaterCondition = 0xF};
+//Most exits from the middle of a block for each operation
+static const size_t OPERATION_EXITS = 3;
+//Most bytes of code for the prologue and epilogue of a block, and for
+//each operation and its exits
+static const size_t BLOCK_BYTES = 128;
+static const size_t OPERATION_BYTES = 256;
+
+//An exit from the middle of a block, emitted after the epilogue
+struct BlockExit
+{
+	//The jump to patch
+	unsigned char *pJump;
+	//PC and IR to return, and the number of instructions executed
+	unsigned int PC, IR, Count;
+};
+
+//Appends bytes and little endian numbers to the code
+static void Emit(unsigned char *&pCode, const char *sBytes, size_t Bytes)
+{
+	memcpy(pCode, sBytes, Bytes);
+	pCode += Bytes;
+}
+static void Emit32(unsigned char *&pCode, unsigned int Value)
+{
+	memcpy(pCode, &Value, 4);
+	pCode += 4;
+}
+static void Emit64(unsigned char *&pCode, uint64 Value)
+{
+	memcpy(pCode, &Value, 8);
+	pCode += 8;
+}
+
+/**********************************************************************\
+	EmitRegisters( [in/out] code, [in] true for a 64 bit operation,
+		[in] opcode, [in] opcode bytes, [in] reg field, [in] r/m register )
+
+	Emits an instruction with a register operand in its r/m field. The reg
+	field is a register or an opcode extension.
+\******/
+static void EmitRegisters(unsigned char *&pCode, bool fWide, const char *sOpcode, size_t Bytes, unsigned int Reg, unsigned int RM)
+{
+	unsigned char Prefix = 0x40 | (fWide ? 0x8 : 0) | ((Reg & 0x8) ? 0x4 : 0) | ((RM & 0x8) ? 0x1 : 0);
+	if(Prefix != 0x40)
+		*pCode++ = Prefix;
+	Emit(pCode, sOpcode, Bytes);
+	*pCode++ = 0xC0 | ((Reg & 0x7) << 3) | (RM & 0x7);
+}
+
+/**********************************************************************\
+	EmitState( [in/out] code, [in] true for a 64 bit operation,
+		[in] opcode, [in] opcode bytes, [in] reg field, [in] offset )
+
+	Emits an instruction with a field of the state, addressed by rbx, as
+	its memory operand.
+\******/
+static void EmitState(unsigned char *&pCode, bool fWide, const char *sOpcode, size_t Bytes, unsigned int Reg, size_t Offset)
+{
+	unsigned char Prefix = 0x40 | (fWide ? 0x8 : 0) | ((Reg & 0x8) ? 0x4 : 0);
+	if(Prefix != 0x40)
+		*pCode++ = Prefix;
+	Emit(pCode, sOpcode, Bytes);
+	*pCode++ = 0x40 | ((Reg & 0x7) << 3) | RBX;
+	*pCode++ = (unsigned char)Offset;
+}
+
+//Offsets of the fields of the state
+static size_t RegisterOffset(unsigned int Reg)
+{
+	return offsetof(BlockCompiler::State, R) + Reg * sizeof(unsigned int);
+}
+static const size_t CC_OFFSET = offsetof(BlockCompiler::State, CC);
+static const size_t PC_OFFSET = offsetof(BlockCompiler::State, PC);
+static const size_t IR_OFFSET = offsetof(BlockCompiler::State, IR);
+static const size_t ARCH_OFFSET = offsetof(BlockCompiler::State, pArch);
+
+//mov Reg, Value
+static void EmitMoveImmediate(unsigned char *&pCode, unsigned int Reg, unsigned int Value)
+{
+	if(Reg & 0x8)
+		*pCode++ = 0x41;
+	*pCode++ = 0xB8 + (Reg & 0x7);
+	Emit32(pCode, Value);
+}
+
+//mov [rbx+Offset], Value
+static void EmitStoreImmediate(unsigned char *&pCode, size_t Offset, unsigned int Value)
+{
+	EmitState(pCode, false, "\xC7", 1, 0, Offset);
+	Emit32(pCode, Value);
+}
+
+//Emits a jump, or a conditional jump if Condition is not negative, and
+//returns its displacement to patch
+static unsigned char *EmitJump(unsigned char *&pCode, int Condition)
+{
+	if(Condition < 0)
+		*pCode++ = 0xE9;
+	else
+	{
+		*pCode++ = 0x0F;
+		*pCode++ = 0x80 + Condition;
+	}
+	Emit32(pCode, 0);
+	return pCode - 4;
+}
+
+static void PatchJump(unsigned char *pJump, const unsigned char *pTarget)
+{
+	unsigned int Displacement = (unsigned int)(pTarget - (pJump + 4));
+	memcpy(pJump, &Displacement, 4);
+}
+
+//Finishes an operation whose result is in ax: writes the destination
+//register and the condition codes
+static void EmitResult(unsigned char *&pCode, unsigned char DR)
+{
+	EmitRegisters(pCode, false, "\x0F\xB7", 2, HostRegister[DR], RAX);	//movzx DR, ax
+	EmitRegisters(pCode, false, "\x0F\xBF", 2, RBP, RAX);				//movsx ebp, ax
+}
+
+//Puts the address of a load or store in esi
+static void EmitAddress(unsigned char *&pCode, const BlockCompiler::Operation &Op)
+{
+	if(Op.SR1 == BlockCompiler::IMMEDIATE)
+	{
+		EmitMoveImmediate(pCode, RSI, Op.Imm & 0xFFFF);
+		return;
+	}
+	EmitRegisters(pCode, false, "\x8B", 1, RSI, HostRegister[Op.SR1]);		//mov esi, SR1
+	EmitRegisters(pCode, false, "\x81", 1, 0, RSI);							//add esi, Imm
+	Emit32(pCode, Op.Imm);
+	EmitRegisters(pCode, false, "\x0F\xB7", 2, RSI, RSI);					//movzx esi, si
+}
+
+//Calls a helper with the architecture, and the arguments already in esi
+//and edx. The simulated registers in host registers the helper may change
+//are saved and loaded again around the call.
+static void EmitCall(unsigned char *&pCode, const void *pFunction, unsigned char Registers)
+{
+	unsigned int i;
+	for(i = 0; i < 8; i++)
+		if(Registers & SAVED_REGISTERS & (1 << i))
+			EmitState(pCode, false, "\x89", 1, HostRegister[i], RegisterOffset(i));
+	EmitState(pCode, true, "\x8B", 1, RDI, ARCH_OFFSET);		//mov rdi, [rbx+pArch]
+	Emit(pCode, "\x48\xB8", 2);									//mov rax, function
+	Emit64(pCode, (uint64)(size_t)pFunction);
+	Emit(pCode, "\xFF\xD0", 2);									//call rax
+	for(i = 0; i < 8; i++)
+		if(Registers & SAVED_REGISTERS & (1 << i))
+			EmitState(pCode, false, "\x8B", 1, HostRegister[i], RegisterOffset(i));
+}
+
+//Leaves the block through an exit if bit 32 (STOP) or 33 (ABORT) of a
+//helper's result is set
+static void EmitExitIf(unsigned char *&pCode, BlockExit *pExits, size_t &Exits, unsigned int Bit, unsigned int PC, unsigned int IR, unsigned int Count)
+{
+	Emit(pCode, "\x48\x0F\xBA\xE0", 4);							//bt rax, Bit
+	*pCode++ = (unsigned char)Bit;
+	BlockExit Exit = {EmitJump(pCode, CarryCondition), PC, IR, Count};
+	pExits[Exits++] = Exit;
+}
+#endif
+
+BlockCompiler::BlockFunction BlockCompiler::Compile(const Operation *pOps, size_t Operations)
+{
+#ifdef BLOCK_COMPILER_SUPPORTED
+	if(!Operations)
+		return NULL;
+	if(Operations > MAX_COMPILED_OPERATIONS)
+		throw "Too many operations for a compiled block!";
+	if(!pBuffer)
+	{
+		if(fMapFailed)
+			return NULL;
+		void *pMap = mmap(NULL, BLOCK_COMPILER_BYTES, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if(pMap == MAP_FAILED)
+		{
+			fMapFailed = true;
+			return NULL;
+		}
+		pBuffer = (unsigned char *)pMap;
+	}
+	else if(mprotect(pBuffer, BLOCK_COMPILER_BYTES, PROT_READ | PROT_WRITE))
+	{
+		fMapFailed = true;
+		return NULL;
+	}
+	if(Used + BLOCK_BYTES + OPERATION_BYTES * Operations > BLOCK_COMPILER_BYTES)
+	{
+		//Leave the buffer executable, since its blocks stay in use until
+		//the engine clears it
+		if(mprotect(pBuffer, BLOCK_COMPILER_BYTES, PROT_READ | PROT_EXEC))
+			fMapFailed = true;
+		return NULL;
+	}
+
+	//Find the registers the block uses
+	unsigned char Registers = 0;
+	size_t i;
+	for(i = 0; i < Operations; i++)
+	{
+		const Operation &Op = pOps[i];
+		if(Op.Type >= BranchOperation && i != Operations - 1)
+			throw "Only the last operation can end a compiled block!";
+		if(Op.Type != BranchOperation && Op.Type != TrapOperation)
+		{
+			if(Op.Type <= LoadIndirectOperation || Op.Type == StoreOperation || Op.Type == StoreIndirectOperation)
+				Registers |= 1 << Op.DR;
+			if(Op.Type != SetOperation && Op.SR1 != IMMEDIATE)
+				Registers |= 1 << Op.SR1;
+			if((Op.Type == AddOperation || Op.Type == AndOperation) && Op.SR2 != IMMEDIATE)
+				Registers |= 1 << Op.SR2;
+		}
+		if(Op.Type == CallOperation || Op.Type == TrapOperation)
+			Registers |= 1 << 7;
+	}
+
+	unsigned char *pStart = pBuffer + Used, *pCode = pStart;
+	BlockExit ExitList[OPERATION_EXITS * MAX_COMPILED_OPERATIONS];
+	size_t Exits = 0;
+
+	//The state is kept in rbx and the condition codes in ebp. Six pushes
+	//and the return address leave the stack 8 bytes off the 16 byte
+	//alignment the calls need.
+	Emit(pCode, "\x53\x55\x41\x54\x41\x55\x41\x56\x41\x57", 10);	//push rbx, rbp, r12-r15
+	Emit(pCode, "\x48\x83\xEC\x08", 4);							//sub rsp, 8
+	Emit(pCode, "\x48\x89\xFB", 3);								//mov rbx, rdi
+	for(i = 0; i < 8; i++)
+		if(Registers & (1 << i))
+			EmitState(pCode, false, "\x8B", 1, HostRegister[i], RegisterOffset(i));
+	EmitState(pCode, false, "\x8B", 1, RBP, CC_OFFSET);
+
+	//Whether the last operation stored the PC itself
+	bool fPCStored = false;
+	unsigned int NextPC = 0;
+	for(i = 0; i < Operations; i++)
+	{
+		const Operation &Op = pOps[i];
+		unsigned int Count = (unsigned int)i;
+		bool fLast = i == Operations - 1;
+		NextPC = Op.NextPC;
+		switch(Op.Type)
+		{
+		case AddOperation:
+		case AndOperation:
+			EmitRegisters(pCode, false, "\x8B", 1, RAX, HostRegister[Op.SR1]);		//mov eax, SR1
+			if(Op.SR2 == IMMEDIATE)
+			{
+				EmitRegisters(pCode, false, "\x81", 1, Op.Type == AddOperation ? 0 : 4, RAX);	//add/and eax, Imm
+				Emit32(pCode, Op.Imm);
+			}
+			else
+				EmitRegisters(pCode, false, Op.Type == AddOperation ? "\x03" : "\x23", 1, RAX, HostRegister[Op.SR2]);	//add/and eax, SR2
+			EmitResult(pCode, Op.DR);
+			break;
+
+		case NotOperation:
+			EmitRegisters(pCode, false, "\x8B", 1, RAX, HostRegister[Op.SR1]);		//mov eax, SR1
+			EmitRegisters(pCode, false, "\xF7", 1, 2, RAX);							//not eax
+			EmitResult(pCode, Op.DR);
+			break;
+
+		case SetOperation:
+			EmitMoveImmediate(pCode, RAX, Op.Imm);
+			EmitResult(pCode, Op.DR);
+			break;
+
+		case ShiftLeftOperation:
+		case ShiftRightOperation:
+		case ShiftArithmeticOperation:
+			if(Op.Type == ShiftArithmeticOperation)
+				EmitRegisters(pCode, false, "\x0F\xBF", 2, RAX, HostRegister[Op.SR1]);	//movsx eax, SR1
+			else
+				EmitRegisters(pCode, false, "\x8B", 1, RAX, HostRegister[Op.SR1]);		//mov eax, SR1
+			//shl/shr/sar eax, Imm
+			EmitRegisters(pCode, false, "\xC1", 1, Op.Type == ShiftLeftOperation ? 4 : Op.Type == ShiftRightOperation ? 5 : 7, RAX);
+			*pCode++ = (unsigned char)(Op.Imm & 0x1F);
+			EmitResult(pCode, Op.DR);
+			break;
+
+		case LoadOperation:
+		case LoadIndirectOperation:
+			EmitAddress(pCode, Op);
+			EmitCall(pCode, (const void *)Op.pRead, Registers);
+			EmitExitIf(pCode, ExitList, Exits, 33, Op.PC, Op.Binary, Count);
+			if(Op.Type == LoadIndirectOperation)
+			{
+				EmitRegisters(pCode, false, "\x0F\xB7", 2, RSI, RAX);					//movzx esi, ax
+				EmitCall(pCode, (const void *)Op.pIndirectRead, Registers);
+				EmitExitIf(pCode, ExitList, Exits, 33, Op.PC, Op.Binary, Count);
+			}
+			EmitResult(pCode, Op.DR);
+			if(!fLast)
+				EmitExitIf(pCode, ExitList, Exits, 32, Op.NextPC, Op.Binary, Count + 1);
+			break;
+
+		case StoreOperation:
+		case StoreIndirectOperation:
+			EmitAddress(pCode, Op);
+			if(Op.Type == StoreIndirectOperation)
+			{
+				EmitCall(pCode, (const void *)Op.pRead, Registers);
+				EmitExitIf(pCode, ExitList, Exits, 33, Op.PC, Op.Binary, Count);
+				EmitRegisters(pCode, false, "\x0F\xB7", 2, RSI, RAX);					//movzx esi, ax
+			}
+			EmitRegisters(pCode, false, "\x8B", 1, RDX, HostRegister[Op.DR]);		//mov edx, DR
+			EmitCall(pCode, (const void *)Op.pWrite, Registers);
+			EmitExitIf(pCode, ExitList, Exits, 33, Op.PC, Op.Binary, Count);
+			if(!fLast)
+				EmitExitIf(pCode, ExitList, Exits, 32, Op.NextPC, Op.Binary, Count + 1);
+			break;
+
+		case BranchOperation:
+			if(Op.Conditions == (NEGATIVE | ZERO | POSITIVE))
+				NextPC = Op.Imm;
+			else if(Op.Conditions)
+			{
+				int Condition = 0;
+				switch(Op.Conditions)
+				{
+				case NEGATIVE:				Condition = LessCondition;			break;
+				case ZERO:					Condition = EqualCondition;			break;
+				case POSITIVE:				Condition = GreaterCondition;		break;
+				case NEGATIVE | ZERO:		Condition = LessEqualCondition;		break;
+				case NEGATIVE | POSITIVE:	Condition = NotEqualCondition;		break;
+				case ZERO | POSITIVE:		Condition = GreaterEqualCondition;	break;
+				}
+				EmitRegisters(pCode, false, "\x85", 1, RBP, RBP);				//test ebp, ebp
+				BlockExit Exit = {EmitJump(pCode, Condition), Op.Imm, Op.Binary, Count + 1};
+				ExitList[Exits++] = Exit;
+			}
+			break;
+
+		case JumpOperation:
+		case ReturnOperation:
+			EmitState(pCode, false, "\x89", 1, HostRegister[Op.SR1], PC_OFFSET);	//mov [rbx+PC], SR1
+			fPCStored = true;
+			if(Op.Type == ReturnOperation)
+				EmitCall(pCode, (const void *)Op.pReturn, Registers);
+			break;
+
+		case CallOperation:
+		case TrapOperation:
+			EmitMoveImmediate(pCode, HostRegister[7], Op.NextPC);
+			if(Op.Type == TrapOperation)
+			{
+				EmitMoveImmediate(pCode, RSI, Op.Imm & 0xFFFF);
+				EmitCall(pCode, (const void *)Op.pRead, Registers);
+				EmitExitIf(pCode, ExitList, Exits, 33, Op.PC, Op.Binary, Count);
+				EmitRegisters(pCode, false, "\x0F\xB7", 2, RDX, RAX);			//movzx edx, ax
+			}
+			else if(Op.SR1 == IMMEDIATE)
+				EmitMoveImmediate(pCode, RDX, Op.Imm & 0xFFFF);
+			else
+				EmitRegisters(pCode, false, "\x8B", 1, RDX, HostRegister[Op.SR1]);	//mov edx, SR1
+			EmitState(pCode, false, "\x89", 1, RDX, PC_OFFSET);						//mov [rbx+PC], edx
+			fPCStored = true;
+			EmitMoveImmediate(pCode, RSI, Op.PC);
+			EmitCall(pCode, (const void *)Op.pCall, Registers);
+			break;
+
+		default:
+			throw "Invalid compiled block operation!";
+		}
+	}
+
+	//The end of the block
+	if(!fPCStored)
+		EmitStoreImmediate(pCode, PC_OFFSET, NextPC & 0xFFFF);
+	EmitStoreImmediate(pCode, IR_OFFSET, pOps[Operations - 1].Binary);
+	EmitMoveImmediate(pCode, RAX, (unsigned int)Operations);
+
+	//Epilogue
+	unsigned char *pEpilogue = pCode;
+	for(i = 0; i < 8; i++)
+		if(Registers & (1 << i))
+			EmitState(pCode, false, "\x89", 1, HostRegister[i], RegisterOffset(i));
+	EmitState(pCode, false, "\x89", 1, RBP, CC_OFFSET);
+	Emit(pCode, "\x48\x83\xC4\x08", 4);							//add rsp, 8
+	Emit(pCode, "\x41\x5F\x41\x5E\x41\x5D\x41\x5C\x5D\x5B", 10);	//pop r15-r12, rbp, rbx
+	Emit(pCode, "\xC3", 1);										//ret
+
+	for(i = 0; i < Exits; i++)
+	{
+		PatchJump(ExitList[i].pJump, pCode);
+		EmitStoreImmediate(pCode, PC_OFFSET, ExitList[i].PC & 0xFFFF);
+		EmitStoreImmediate(pCode, IR_OFFSET, ExitList[i].IR);
+		EmitMoveImmediate(pCode, RAX, ExitList[i].Count);
+		PatchJump(EmitJump(pCode, -1), pEpilogue);
+	}
+	if(pCode > pStart + BLOCK_BYTES + OPERATION_BYTES * Operations)
+		throw "Compiled block is larger than its estimate!";
+
+	Used = (pCode - pBuffer + 15) & ~(size_t)15;
+	if(mprotect(pBuffer, BLOCK_COMPILER_BYTES, PROT_READ | PROT_EXEC))
+	{
+		fMapFailed = true;
+		return NULL;
+	}
+	return (BlockFunction)(size_t)pStart;
+#else
+	return NULL;
+#endif
+}
+
+void BlockCompiler::SaveException()
+{
+	fException = true;
+	try
+	{
+		throw;
+	}
+	catch(const char *sMsg)
+	{
+		fRuntimeError = false;
+		sThrown = sMsg;
+	}
+	catch(runtime_error &e)
+	{
+		fRuntimeError = true;
+		sRuntimeError = e.what();
+	}
+	catch(...)
+	{
+		fRuntimeError = false;
+		sThrown = "Unexpected exception in a compiled block!";
+	}
+}
+
+void BlockCompiler::ThrowSaved()
+{
+	fException = false;
+	if(fRuntimeError)
+		throw runtime_error(sRuntimeError);
+	throw sThrown;
+}
+
+}	//namespace Simulator
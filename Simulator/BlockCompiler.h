@@ -0,0 +1,204 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#ifndef BLOCKCOMPILER_H
+#define BLOCKCOMPILER_H
+
+#pragma warning (disable:4786)
+#include <string>
+#include "../Assembler/Base.h"
+
+using namespace std;
+using namespace JMT;
+
+//Machine code is only emitted for x86-64 hosts with the System V calling
+//convention and mmap. Other hosts interpret the translated blocks.
+#if defined(__x86_64__) && defined(UNIX_BUILD)
+	#define BLOCK_COMPILER_SUPPORTED
+#endif
+
+namespace Simulator
+{
+	//Bytes of memory each compiler maps for its code
+	const size_t BLOCK_COMPILER_BYTES = 1 << 20;
+	//Most operations in one compiled block
+	const size_t MAX_COMPILED_OPERATIONS = 64;
+
+	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
+		BlockCompiler
+
+		Compiles translated blocks of a machine with eight 16 bit registers
+		and N, Z and P condition codes, such as the LC-3 and LC-3b, into
+		host machine code. The architecture translates each instruction
+		into an Operation. The compiled code does the arithmetic, logic and
+		branches itself, and keeps the registers and condition codes in
+		host registers for the whole block. Memory accesses and subroutine
+		events call helper functions of the architecture, since they have
+		to go through the events, breakpoints, journal and I/O of the
+		simulator.
+
+		A compiled block is called with a State, which holds the registers
+		on entry and on return. It returns the number of instructions it
+		executed. It runs to its end unless a helper asks it to stop, in
+		which case it stops after the instruction which called the helper.
+
+		The code is kept in one buffer, which is mapped by the first
+		Compile. The buffer is only writable while Compile emits code, and
+		only executable otherwise. Nothing is freed until the buffer is
+		full, when Compile fails and the engine has to Clear it and forget
+		every compiled block. Blocks are only compiled between blocks, so no
+		compiled code is running then.
+
+		C++ exceptions can't unwind through the compiled code. A helper
+		catches them with SaveException, and returns ABORT to stop the
+		block at once. The engine then calls RethrowException after the
+		block returns.
+	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
+	class BlockCompiler
+	{
+	public:
+		//The registers a compiled block reads and writes
+		struct State
+		{
+			//General purpose registers, zero extended
+			unsigned int R[8];
+			//Condition codes: negative, zero or positive as the last result
+			int CC;
+			//Address of the next instruction, and the word of the last one
+			//executed
+			unsigned int PC, IR;
+			//The architecture, passed to each helper
+			void *pArch;
+		};
+
+		//A compiled block. Returns the number of instructions it executed.
+		typedef uint64 (*BlockFunction)(State *);
+
+		//Helper functions (architecture, address) for a read, (architecture,
+		//address, value) for a write, (architecture, address of the call,
+		//address of the subroutine) for a call, and (architecture) for a
+		//return. A read returns the value it read in the low 32 bits. Each
+		//helper may add STOP or ABORT to its result.
+		typedef uint64 (*ReadFunction)(void *, uint64);
+		typedef uint64 (*WriteFunction)(void *, uint64, uint64);
+		typedef uint64 (*CallFunction)(void *, uint64, uint64);
+		typedef uint64 (*ReturnFunction)(void *);
+		//The block stops after this instruction
+		static const uint64 STOP = (uint64)1 << 32;
+		//The helper saved an exception, so the block stops at once
+		static const uint64 ABORT = (uint64)1 << 33;
+
+		enum OperationEnum
+		{
+			//DR = SR1 + SR2, SR1 & SR2, ~SR1, or Imm, and set the condition codes
+			AddOperation = 0, AndOperation, NotOperation, SetOperation,
+			//DR = SR1 shifted by Imm, and set the condition codes
+			ShiftLeftOperation, ShiftRightOperation, ShiftArithmeticOperation,
+			//DR = Read(address), or Read(Read(address)), and set the condition
+			//codes. The address is SR1 + Imm.
+			LoadOperation, LoadIndirectOperation,
+			//Write(address, DR), or Write(Read(address), DR)
+			StoreOperation, StoreIndirectOperation,
+			//The rest end a block. Branch to Imm if the condition codes match.
+			BranchOperation,
+			//Jump to SR1
+			JumpOperation,
+			//R7 = the next address, then jump to SR1 and Call
+			CallOperation,
+			//R7 = the next address, then jump to Read(Imm) and Call
+			TrapOperation,
+			//Jump to SR1 and Return
+			ReturnOperation
+		};
+		//A source register which is the immediate instead, so an address or
+		//jump target is just Imm
+		static const unsigned char IMMEDIATE = 0xFF;
+		//Conditions of a branch
+		enum ConditionEnum {POSITIVE = 1, ZERO = 2, NEGATIVE = 4};
+
+		//One instruction of a block
+		struct Operation
+		{
+			OperationEnum Type;
+			//Destination (or store source) register, first source (or base)
+			//register, and second source register
+			unsigned char DR, SR1, SR2;
+			//Conditions of a branch
+			unsigned char Conditions;
+			//Immediate operand, address offset, or branch or trap address
+			unsigned int Imm;
+			//Address and word of the instruction, and the address of the
+			//next instruction
+			unsigned int PC, Binary, NextPC;
+			//Read of a load or store, or the first read of an indirect one
+			//or a trap
+			ReadFunction pRead;
+			//Second read of an indirect load
+			ReadFunction pIndirectRead;
+			WriteFunction pWrite;
+			CallFunction pCall;
+			ReturnFunction pReturn;
+		};
+
+		BlockCompiler();
+		~BlockCompiler();
+
+		//true if this host can run compiled blocks
+		static bool Supported();
+		//true unless the host is not supported or mapping or protecting the
+		//buffer failed, so a failed Compile means the buffer is full. The
+		//compiled blocks can only be run while it is true.
+		bool Available() const	{	return Supported() && !fMapFailed;	}
+
+		/**********************************************************************\
+			Compile( [in] operations, [in] number of operations )
+
+			Emits the code of a block of at most MAX_COMPILED_OPERATIONS
+			operations. Only the last operation may end a block. A block which
+			does not end with one continues at the next address of its last
+			operation.
+
+			Returns NULL if the host is not supported, the buffer can't be
+			mapped, or the buffer is full.
+		\******/
+		BlockFunction Compile(const Operation *, size_t);
+
+		//Forgets every compiled block, so that the whole buffer can be reused
+		void Clear()	{	Used = 0;	}
+
+		//Called by a helper in its catch(...) handler
+		void SaveException();
+		//Throws the exception saved by the last block, if any
+		void RethrowException()
+		{
+			if(fException)
+				ThrowSaved();
+		}
+
+	protected:
+		//The code buffer, or NULL until it is mapped
+		unsigned char *pBuffer;
+		//true if mapping or protecting the buffer failed, so it is not
+		//tried again
+		bool fMapFailed;
+		//Bytes of the buffer in use
+		size_t Used;
+
+		//The exception caught by a helper. A string thrown as a programmer
+		//error is kept as is, and anything else is rethrown as a
+		//runtime_error with its message.
+		bool fException, fRuntimeError;
+		const char *sThrown;
+		string sRuntimeError;
+
+		void ThrowSaved();
+
+	private:
+		//The compiled blocks belong to one architecture, so it can't be copied
+		BlockCompiler(const BlockCompiler &);
+		BlockCompiler &operator =(const BlockCompiler &);
+	};
+}
+
+#endif
@@ -0,0 +1,284 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#pragma warning (disable:4786)
+#include "BranchPredictor.h"
+#include <algorithm>
+#include <cstdio>
+
+using namespace std;
+using namespace JMT;
+
+namespace Simulator	{
+
+//Moves a two-bit saturating counter towards the outcome
+static void Train(unsigned char &Counter, bool fTaken)
+{
+	if(fTaken)
+	{
+		if(Counter < 3)
+			Counter++;
+	}
+	else if(Counter > 0)
+		Counter--;
+}
+
+Bimodal::Bimodal(unsigned int Bits)
+{
+	Counters.resize((size_t)1 << Bits);
+	Mask = ((uint64)1 << Bits) - 1;
+	Clear();
+}
+
+void Bimodal::Update(uint64 Address, bool fTaken)
+{
+	Train(Counters[(size_t)(Address & Mask)], fTaken);
+}
+
+void Bimodal::Clear()
+{
+	Counters.assign(Counters.size(), 1);
+}
+
+GShare::GShare(unsigned int Bits)
+{
+	Counters.resize((size_t)1 << Bits);
+	Mask = ((uint64)1 << Bits) - 1;
+	Clear();
+}
+
+void GShare::Update(uint64 Address, bool fTaken)
+{
+	Train(Counters[(size_t)((Address ^ History) & Mask)], fTaken);
+	History = ((History << 1) | (fTaken ? 1 : 0)) & Mask;
+}
+
+void GShare::Clear()
+{
+	Counters.assign(Counters.size(), 1);
+	History = 0;
+}
+
+Tournament::Tournament(unsigned int Bits) : Local(Bits), Global(Bits)
+{
+	Choosers.resize((size_t)1 << Bits);
+	Mask = ((uint64)1 << Bits) - 1;
+	Clear();
+}
+
+void Tournament::Update(uint64 Address, bool fTaken)
+{
+	bool fLocal = Local.Predict(Address), fGlobal = Global.Predict(Address);
+	if(fLocal != fGlobal)
+		Train(Choosers[(size_t)(Address & Mask)], fGlobal == fTaken);
+	Local.Update(Address, fTaken);
+	Global.Update(Address, fTaken);
+}
+
+void Tournament::Clear()
+{
+	Local.Clear();
+	Global.Clear();
+	//Start out trusting the bimodal predictor, which learns faster
+	Choosers.assign(Choosers.size(), 1);
+}
+
+BranchModel::BranchModel()
+{
+	fOn = false;
+	AddressShift = 0;
+	Penalty = 0;
+	pPredictor = NULL;
+	Create(BimodalPredictor, DEFAULT_PREDICTOR_BITS, DEFAULT_RETURN_STACK_DEPTH);
+	Clear();
+}
+
+BranchModel::~BranchModel()
+{
+	delete pPredictor;
+}
+
+const char *BranchModel::Check(unsigned int bits, unsigned int returndepth)
+{
+	if(bits < 1 || bits > MAX_PREDICTOR_BITS)
+		return "Branch predictor index bits must be from 1 to 20.";
+	if(returndepth < 1 || returndepth > MAX_RETURN_STACK_DEPTH)
+		return "Return address stack depth must be from 1 to 1024.";
+	return NULL;
+}
+
+void BranchModel::Create(PredictorEnum predictor, unsigned int bits, unsigned int returndepth)
+{
+	if(Check(bits, returndepth))
+		throw "Invalid branch predictor size!";
+
+	Predictor = predictor;
+	Bits = bits;
+	ReturnDepth = returndepth;
+
+	delete pPredictor;
+	switch(Predictor)
+	{
+	case BimodalPredictor:
+		pPredictor = new Bimodal(Bits);
+		break;
+	case GSharePredictor:
+		pPredictor = new GShare(Bits);
+		break;
+	default:
+		pPredictor = new Tournament(Bits);
+		break;
+	}
+
+	Targets.assign((size_t)1 << Bits, 0);
+	ReturnStack.assign(ReturnDepth, 0);
+	ReturnTop = ReturnCount = 0;
+}
+
+void BranchModel::Start(uint64 Instruction)
+{
+	Clear(Instruction);
+	fOn = true;
+}
+
+void BranchModel::Clear(uint64 Instruction)
+{
+	pPredictor->Clear();
+	Targets.assign(Targets.size(), 0);
+	ReturnTop = ReturnCount = 0;
+	for(unsigned int i = 0; i < BranchKinds; i++)
+		Executed[i] = Mispredicted[i] = 0;
+	Sites.clear();
+	PenaltyCycles = Stalls = 0;
+	FirstInstruction = LastInstruction = Instruction;
+}
+
+void BranchModel::Record(uint64 Address, BranchKindEnum Kind, bool fCorrect)
+{
+	Site &TheSite = Sites[Address];
+	TheSite.Kind = Kind;
+	TheSite.Executed++;
+	Executed[Kind]++;
+	if(!fCorrect)
+	{
+		TheSite.Mispredicted++;
+		Mispredicted[Kind]++;
+		Stalls += Penalty;
+	}
+}
+
+void BranchModel::Conditional(uint64 Address, bool fTaken)
+{
+	uint64 Instruction = Address >> AddressShift;
+	Record(Address, ConditionalBranch, pPredictor->Predict(Instruction) == fTaken);
+	pPredictor->Update(Instruction, fTaken);
+}
+
+void BranchModel::Indirect(uint64 Address, uint64 Target)
+{
+	uint64 &LastTarget = Targets[(size_t)((Address >> AddressShift) & (Targets.size() - 1))];
+	Record(Address, IndirectBranch, LastTarget == Target);
+	LastTarget = Target;
+}
+
+void BranchModel::Push(uint64 ReturnAddress)
+{
+	ReturnTop = (ReturnTop + 1) % ReturnDepth;
+	ReturnStack[ReturnTop] = ReturnAddress;
+	if(ReturnCount < ReturnDepth)
+		ReturnCount++;
+}
+
+void BranchModel::Pop(uint64 Address, uint64 Target)
+{
+	//An empty stack has no prediction
+	if(!ReturnCount)
+	{
+		Record(Address, ReturnBranch, false);
+		return;
+	}
+
+	Record(Address, ReturnBranch, ReturnStack[ReturnTop] == Target);
+	ReturnTop = (ReturnTop + ReturnDepth - 1) % ReturnDepth;
+	ReturnCount--;
+}
+
+const char *BranchModel::KindName(BranchKindEnum Kind)
+{
+	switch(Kind)
+	{
+	case ConditionalBranch:
+		return "Conditional";
+	case IndirectBranch:
+		return "Indirect";
+	default:
+		return "Return";
+	}
+}
+
+uint64 BranchModel::Instructions(uint64 Instruction) const
+{
+	uint64 Last = fOn ? Instruction : LastInstruction;
+	return Last > FirstInstruction ? Last - FirstInstruction : 0;
+}
+
+//Orders branches by mispredictions, most first
+static bool WorseSite(const pair<uint64, uint64> &A, const pair<uint64, uint64> &B)
+{
+	return A.first > B.first;
+}
+
+void BranchModel::WorstSites(unsigned int Count, vector<uint64> &Addresses) const
+{
+	vector< pair<uint64, uint64> > Worst;
+	for(map<uint64, Site>::const_iterator SiteIter = Sites.begin(); SiteIter != Sites.end(); SiteIter++)
+		if(SiteIter->second.Mispredicted)
+			Worst.push_back(pair<uint64, uint64>(SiteIter->second.Mispredicted, SiteIter->first));
+	stable_sort(Worst.begin(), Worst.end(), WorseSite);
+	if(Worst.size() > Count)
+		Worst.resize(Count);
+
+	Addresses.clear();
+	for(unsigned int i = 0; i < Worst.size(); i++)
+		Addresses.push_back(Worst[i].second);
+}
+
+bool BranchModel::WriteSummary(ostream &Output, uint64 Instruction) const
+{
+	char sRate[32];
+	uint64 InstructionCount = Instructions(Instruction);
+	uint64 TotalExecuted = 0, TotalMispredicted = 0;
+
+	Output << "Branch model: " << (fOn ? "on" : "off") << "\n";
+	Output << "Predictor: " << PredictorName() << ", " << ((uint64)1 << Bits) << " entries; Return stack: " << ReturnDepth << " entries; Penalty: " << Penalty << " cycles\n";
+	Output << "Instructions: " << InstructionCount << "\n";
+	for(unsigned int i = 0; i <= BranchKinds; i++)
+	{
+		uint64 BranchCount, MissCount;
+		if(i < BranchKinds)
+		{
+			BranchCount = Executed[i];
+			MissCount = Mispredicted[i];
+			TotalExecuted += BranchCount;
+			TotalMispredicted += MissCount;
+			Output << KindName((BranchKindEnum)i) << ": ";
+		}
+		else
+		{
+			BranchCount = TotalExecuted;
+			MissCount = TotalMispredicted;
+			Output << "Total: ";
+		}
+		Output << BranchCount << " branches, " << MissCount << " mispredicted";
+		sprintf(sRate, " (%.2f%% correct, ", BranchCount ? 100.0 * (double)(int64)(BranchCount - MissCount) / (double)(int64)BranchCount : 0.0);
+		Output << sRate;
+		sprintf(sRate, "%.3f MPKI)\n", InstructionCount ? 1000.0 * (double)(int64)MissCount / (double)(int64)InstructionCount : 0.0);
+		Output << sRate;
+	}
+	Output << "Penalty cycles: " << PenaltyCycles << "\n";
+
+	return !Output.fail();
+}
+
+}	//namespace Simulator
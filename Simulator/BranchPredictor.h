@@ -0,0 +1,278 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#ifndef BRANCHPREDICTOR_H
+#define BRANCHPREDICTOR_H
+
+#pragma warning (disable:4786)
+#include <map>
+#include <vector>
+#include <string>
+#include <iostream>
+#include "../Assembler/Base.h"
+
+using namespace std;
+using namespace JMT;
+
+namespace Simulator
+{
+	//Index bits of a predictor table unless told otherwise, and the most
+	//it may have, so a mistyped size does not use up memory
+	const unsigned int DEFAULT_PREDICTOR_BITS = 10;
+	const unsigned int MAX_PREDICTOR_BITS = 20;
+	//Entries in the return address stack unless told otherwise
+	const unsigned int DEFAULT_RETURN_STACK_DEPTH = 8;
+	const unsigned int MAX_RETURN_STACK_DEPTH = 1024;
+
+	//Conditional branch predictors
+	enum PredictorEnum {BimodalPredictor, GSharePredictor, TournamentPredictor};
+
+	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
+		BranchPredictor
+
+		Interface of a conditional branch direction predictor. The branch
+		model calls Predict and then Update for each branch, with the same
+		address, before the next branch. The address is the instruction
+		number, so consecutive instructions differ in bit 0.
+	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
+	class BranchPredictor
+	{
+	public:
+		virtual ~BranchPredictor()	{}
+
+		//Name of the predictor
+		virtual const char *Name() const = 0;
+
+		/**********************************************************************\
+			Predict( [in] instruction number )
+
+			Returns true if the branch is predicted taken.
+		\******/
+		virtual bool Predict(uint64) = 0;
+
+		/**********************************************************************\
+			Update( [in] instruction number, [in] true if taken )
+
+			Trains the predictor with the outcome of the branch.
+		\******/
+		virtual void Update(uint64, bool) = 0;
+
+		//Forgets every outcome
+		virtual void Clear() = 0;
+	};
+
+	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
+		Bimodal
+
+		A table of two-bit saturating counters indexed by the low bits of
+		the branch address. A branch is predicted taken if its counter is
+		2 or 3. The counters start at 1, weakly not taken.
+	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
+	class Bimodal : public BranchPredictor
+	{
+	protected:
+		vector<unsigned char> Counters;
+		uint64 Mask;
+
+	public:
+		Bimodal(unsigned int);
+		virtual const char *Name() const	{	return "bimodal";	}
+		virtual bool Predict(uint64 Address)	{	return Counters[(size_t)(Address & Mask)] >= 2;	}
+		virtual void Update(uint64, bool);
+		virtual void Clear();
+	};
+
+	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
+		GShare
+
+		A table of two-bit saturating counters indexed by the branch address
+		exclusive-ored with the outcomes of the most recent branches, one
+		bit per table index bit.
+	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
+	class GShare : public BranchPredictor
+	{
+	protected:
+		vector<unsigned char> Counters;
+		uint64 Mask;
+		//Most recent outcome in bit 0, 1 if taken
+		uint64 History;
+
+	public:
+		GShare(unsigned int);
+		virtual const char *Name() const	{	return "gshare";	}
+		virtual bool Predict(uint64 Address)	{	return Counters[(size_t)((Address ^ History) & Mask)] >= 2;	}
+		virtual void Update(uint64, bool);
+		virtual void Clear();
+	};
+
+	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
+		Tournament
+
+		A bimodal and a gshare predictor of the same size, and a table of
+		two-bit choosers indexed by the branch address. A chooser of 2 or 3
+		selects the gshare prediction. When the two predictions differ, the
+		chooser moves towards the one which was right.
+	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
+	class Tournament : public BranchPredictor
+	{
+	protected:
+		Bimodal Local;
+		GShare Global;
+		vector<unsigned char> Choosers;
+		uint64 Mask;
+
+	public:
+		Tournament(unsigned int);
+		virtual const char *Name() const	{	return "tournament";	}
+		virtual bool Predict(uint64 Address)	{	return Choosers[(size_t)(Address & Mask)] >= 2 ? Global.Predict(Address) : Local.Predict(Address);	}
+		virtual void Update(uint64, bool);
+		virtual void Clear();
+	};
+
+	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
+		BranchModel
+
+		Measures how well the branches of a program can be predicted. The
+		architecture reports each branch as it executes:
+
+		Conditional branches are predicted by a pluggable BranchPredictor.
+		Returns are predicted by a return address stack, which each call
+		pushes. It has a fixed depth, and a call to a full stack overwrites
+		the oldest entry. Other indirect jumps and calls are predicted to go
+		where they went the last time, from a table of targets indexed like
+		the predictor's. Direct jumps and calls, and branches whose
+		condition is always or never true, are not reported, since their
+		target is known when they are decoded.
+
+		Each misprediction adds Penalty cycles to Stalls, which the simulator
+		adds to the cycle count, as in a pipeline which resolves branches
+		late. Mispredictions are counted for each kind of branch and for
+		each branch address. Each report only tests fOn while the model is
+		off.
+	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
+	class BranchModel
+	{
+	public:
+		enum BranchKindEnum {ConditionalBranch, IndirectBranch, ReturnBranch, BranchKinds};
+
+		//Statistics of one branch instruction
+		struct Site
+		{
+			BranchKindEnum Kind;
+			uint64 Executed, Mispredicted;
+		};
+
+		//true if branches are modelled
+		bool fOn;
+		//An address is shifted right by this to give the instruction number
+		unsigned int AddressShift;
+		//Index bits of the predictor and target tables, and entries in the
+		//return address stack
+		PredictorEnum Predictor;
+		unsigned int Bits, ReturnDepth;
+		//Cycles added by each misprediction
+		unsigned int Penalty;
+		//Branches and mispredictions of each kind
+		uint64 Executed[BranchKinds], Mispredicted[BranchKinds];
+		//Statistics of each branch, by address
+		map<uint64, Site> Sites;
+		//Cycles added by mispredictions, in total and since TakeStalls
+		uint64 PenaltyCycles, Stalls;
+
+	protected:
+		BranchPredictor *pPredictor;
+		//Last target of each indirect jump
+		vector<uint64> Targets;
+		//Return address stack, as a circular buffer
+		vector<uint64> ReturnStack;
+		unsigned int ReturnTop, ReturnCount;
+		//Instruction counts when modelling started and stopped
+		uint64 FirstInstruction, LastInstruction;
+
+		//Owns its predictor, so it is not copied
+		BranchModel(const BranchModel &);
+		BranchModel &operator=(const BranchModel &);
+
+		void Record(uint64, BranchKindEnum, bool);
+		void Conditional(uint64, bool);
+		void Indirect(uint64, uint64);
+		void Push(uint64);
+		void Pop(uint64, uint64);
+
+	public:
+		BranchModel();
+		~BranchModel();
+
+		/**********************************************************************\
+			Create( [in] predictor, [in] index bits, [in] return stack depth )
+
+			Sets the predictor, the size of its tables, and the depth of the
+			return address stack, and empties them. The statistics are kept.
+		\******/
+		void Create(PredictorEnum, unsigned int, unsigned int);
+
+		/**********************************************************************\
+			Check( [in] index bits, [in] return stack depth )
+
+			Returns NULL if Create accepts the sizes, or else a message
+			saying what is wrong with them.
+		\******/
+		static const char *Check(unsigned int, unsigned int);
+
+		/**********************************************************************\
+			Start( [in] instruction count )
+
+			Empties the predictor, clears the statistics, and starts
+			modelling.
+		\******/
+		void Start(uint64);
+		void Stop(uint64 Instruction)	{	fOn = false;	LastInstruction = Instruction;	}
+		void Clear(uint64 Instruction = 0);
+
+		//Reports. Addresses are the architecture's, not byte addresses.
+		void Branch(uint64 Address, bool fTaken)	{	if(fOn) Conditional(Address, fTaken);	}
+		void Jump(uint64 Address, uint64 Target)	{	if(fOn) Indirect(Address, Target);	}
+		void Call(uint64 ReturnAddress)	{	if(fOn) Push(ReturnAddress);	}
+		void Return(uint64 Address, uint64 Target)	{	if(fOn) Pop(Address, Target);	}
+
+		//Returns the cycles added since the last call
+		uint64 TakeStalls()
+		{
+			uint64 Cycles = Stalls;
+			PenaltyCycles += Stalls;
+			Stalls = 0;
+			return Cycles;
+		}
+
+		//Name of a kind of branch, and of the predictor
+		static const char *KindName(BranchKindEnum);
+		const char *PredictorName() const	{	return pPredictor->Name();	}
+
+		/**********************************************************************\
+			Instructions( [in] instruction count )
+
+			Returns the instructions executed while modelling.
+		\******/
+		uint64 Instructions(uint64) const;
+
+		/**********************************************************************\
+			WorstSites( [in] maximum count, [out] addresses )
+
+			Returns the addresses of the branches with the most
+			mispredictions, most first. Branches which were never
+			mispredicted are not returned.
+		\******/
+		void WorstSites(unsigned int, vector<uint64> &) const;
+
+		/**********************************************************************\
+			WriteSummary( [in-out] stream, [in] instruction count )
+
+			Writes the configuration, and the accuracy and mispredictions per
+			thousand instructions (MPKI) of each kind of branch.
+		\******/
+		bool WriteSummary(ostream &, uint64) const;
+	};
+}
+
+#endif
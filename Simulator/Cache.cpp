@@ -0,0 +1,278 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#pragma warning (disable:4786)
+#include "Cache.h"
+#include <cstdio>
+
+using namespace std;
+using namespace JMT;
+
+namespace Simulator	{
+
+//Most lines a cache may have, so a mistyped size does not use up memory
+static const uint64 MAX_CACHE_LINES = 0x100000;
+
+static bool IsPowerOfTwo(uint64 Value)
+{
+	return Value && !(Value & (Value - 1));
+}
+
+Cache::Cache(const string &sname) : sName(sname)
+{
+	Create(1024, 16, 1, LRUReplacement, 0);
+}
+
+const char *Cache::Check(uint64 size, unsigned int linesize, unsigned int ways, ReplacementEnum replacement)
+{
+	if(!IsPowerOfTwo(size) || !IsPowerOfTwo(linesize) || !IsPowerOfTwo(ways))
+		return "Cache size, line size, and ways must be powers of two.";
+	if((uint64)linesize * ways > size)
+		return "Cache must have at least one set.";
+	if(size / linesize > MAX_CACHE_LINES)
+		return "Cache can have at most 1048576 lines.";
+	if(replacement == PLRUReplacement && ways > 64)
+		return "PLRU replacement supports at most 64 ways.";
+	return NULL;
+}
+
+void Cache::Create(uint64 size, unsigned int linesize, unsigned int ways, ReplacementEnum replacement, unsigned int latency)
+{
+	if(Check(size, linesize, ways, replacement))
+		throw "Invalid cache geometry!";
+
+	Size = size;
+	LineSize = linesize;
+	Ways = ways;
+	Replacement = replacement;
+	Latency = latency;
+	Sets = (unsigned int)(Size / LineSize / Ways);
+	for(LineShift = 0; ((unsigned int)1 << LineShift) < LineSize; LineShift++)
+		;
+
+	Tags.resize(Sets * Ways);
+	Dirty.resize(Sets * Ways);
+	Ages.resize(Replacement == LRUReplacement ? Sets * Ways : 0);
+	Trees.resize(Replacement == PLRUReplacement ? Sets : 0);
+	Clear();
+}
+
+void Cache::Clear()
+{
+	Tags.assign(Tags.size(), INVALID_CACHE_TAG);
+	Dirty.assign(Dirty.size(), 0);
+	Ages.assign(Ages.size(), 0);
+	Trees.assign(Trees.size(), 0);
+	Accesses = 0;
+	LastLine = INVALID_CACHE_TAG;
+	LastIndex = 0;
+	RandomState = 0x2545F4914F6CDD1DULL;
+	ReadHits = ReadMisses = WriteHits = WriteMisses = Writebacks = 0;
+}
+
+unsigned int Cache::Victim(unsigned int Set)
+{
+	//An empty way is always used first
+	const uint64 *pTags = &Tags[Set * Ways];
+	for(unsigned int Way = 0; Way < Ways; Way++)
+		if(pTags[Way] == INVALID_CACHE_TAG)
+			return Way;
+
+	unsigned int VictimWay = 0;
+	switch(Replacement)
+	{
+	case LRUReplacement:
+		{
+			const uint64 *pAges = &Ages[Set * Ways];
+			for(unsigned int Way = 1; Way < Ways; Way++)
+				if(pAges[Way] < pAges[VictimWay])
+					VictimWay = Way;
+		}
+		break;
+
+	case PLRUReplacement:
+		{
+			//Follow the tree towards the least recently used half
+			uint64 Tree = Trees[Set];
+			unsigned int Node = 1;
+			for(unsigned int Bit = Ways >> 1; Bit; Bit >>= 1)
+			{
+				unsigned int Direction = (unsigned int)(Tree >> Node) & 1;
+				if(Direction)
+					VictimWay |= Bit;
+				Node = Node * 2 + Direction;
+			}
+		}
+		break;
+
+	case RandomReplacement:
+		//xorshift64
+		RandomState ^= RandomState << 13;
+		RandomState ^= RandomState >> 7;
+		RandomState ^= RandomState << 17;
+		VictimWay = (unsigned int)(RandomState & (Ways - 1));
+		break;
+	}
+
+	return VictimWay;
+}
+
+void Cache::Touch(unsigned int Set, unsigned int Way)
+{
+	switch(Replacement)
+	{
+	case LRUReplacement:
+		Ages[Set * Ways + Way] = ++Accesses;
+		break;
+
+	case PLRUReplacement:
+		{
+			//Point every node on the way's path at the other half
+			uint64 &Tree = Trees[Set];
+			unsigned int Node = 1;
+			for(unsigned int Bit = Ways >> 1; Bit; Bit >>= 1)
+			{
+				unsigned int Direction = (Way & Bit) ? 1 : 0;
+				if(Direction)
+					Tree &= ~((uint64)1 << Node);
+				else
+					Tree |= (uint64)1 << Node;
+				Node = Node * 2 + Direction;
+			}
+		}
+		break;
+
+	case RandomReplacement:
+		break;
+	}
+}
+
+void Cache::Miss(uint64 Line, unsigned int Set, bool fWrite, uint64 &VictimAddress)
+{
+	(fWrite ? WriteMisses : ReadMisses)++;
+
+	unsigned int Way = Victim(Set);
+	unsigned int Index = Set * Ways + Way;
+	if(Tags[Index] != INVALID_CACHE_TAG && Dirty[Index])
+	{
+		Writebacks++;
+		VictimAddress = Tags[Index] << LineShift;
+	}
+	else
+		VictimAddress = INVALID_CACHE_TAG;
+
+	LastLine = Line;
+	LastIndex = Index;
+	Tags[Index] = Line;
+	Dirty[Index] = fWrite;
+	Touch(Set, Way);
+}
+
+const char *Cache::ReplacementName() const
+{
+	switch(Replacement)
+	{
+	case LRUReplacement:
+		return "LRU";
+	case PLRUReplacement:
+		return "PLRU";
+	default:
+		return "random";
+	}
+}
+
+//Percent of the accesses which hit, or 0 if there were none
+static double HitRate(uint64 Hits, uint64 Misses)
+{
+	return Hits + Misses ? 100.0 * (double)(int64)Hits / (double)(int64)(Hits + Misses) : 0.0;
+}
+
+bool Cache::WriteSummary(ostream &Output) const
+{
+	char sRate[16];
+
+	Output << sName << ": " << Size << " bytes, " << LineSize << "-byte lines, " << Ways << "-way, " << ReplacementName() << ", " << Latency << " cycles\n";
+	sprintf(sRate, "%.2f%%", HitRate(ReadHits, ReadMisses));
+	Output << "    Reads: " << ReadHits << " hits, " << ReadMisses << " misses (" << sRate << " hit)";
+	sprintf(sRate, "%.2f%%", HitRate(WriteHits, WriteMisses));
+	Output << "; Writes: " << WriteHits << " hits, " << WriteMisses << " misses (" << sRate << " hit)";
+	Output << "; Writebacks: " << Writebacks << "\n";
+
+	return !Output.fail();
+}
+
+CacheHierarchy::CacheHierarchy() : L1I("l1i"), L1D("l1d"), L2("l2")
+{
+	fOn = false;
+	L1I.Create(4096, 32, 2, LRUReplacement, 0);
+	L1D.Create(4096, 32, 2, LRUReplacement, 0);
+	L2.Create(32768, 64, 8, LRUReplacement, DEFAULT_L2_LATENCY);
+	fL2 = false;
+	MemoryLatency = 50;
+	Clear();
+}
+
+void CacheHierarchy::Start()
+{
+	Clear();
+	fOn = true;
+}
+
+void CacheHierarchy::Clear()
+{
+	L1I.Clear();
+	L1D.Clear();
+	L2.Clear();
+	MemoryReads = MemoryWrites = 0;
+	StallCycles = Stalls = 0;
+}
+
+void CacheHierarchy::Refill(uint64 Address, uint64 VictimAddress)
+{
+	if(!fL2)
+	{
+		Stalls += MemoryLatency;
+		MemoryReads++;
+		if(VictimAddress != INVALID_CACHE_TAG)
+			MemoryWrites++;
+		return;
+	}
+
+	//The missing line is read first, and then the victim is written
+	uint64 L2Victim;
+	Stalls += L2.Latency;
+	if(!L2.Access(Address, false, L2Victim))
+	{
+		Stalls += MemoryLatency;
+		MemoryReads++;
+	}
+	if(L2Victim != INVALID_CACHE_TAG)
+		MemoryWrites++;
+
+	//A whole line is written back, so a miss does not read memory
+	if(VictimAddress != INVALID_CACHE_TAG)
+	{
+		L2.Access(VictimAddress, true, L2Victim);
+		if(L2Victim != INVALID_CACHE_TAG)
+			MemoryWrites++;
+	}
+}
+
+bool CacheHierarchy::WriteSummary(ostream &Output) const
+{
+	Output << "Cache model: " << (fOn ? "on" : "off") << "\n";
+	L1I.WriteSummary(Output);
+	L1D.WriteSummary(Output);
+	if(fL2)
+		L2.WriteSummary(Output);
+	else
+		Output << L2.sName << ": off\n";
+	Output << "memory: " << MemoryLatency << " cycles\n";
+	Output << "    Line reads: " << MemoryReads << "; Line writes: " << MemoryWrites << "\n";
+	Output << "Stall cycles: " << StallCycles << "\n";
+
+	return !Output.fail();
+}
+
+}	//namespace Simulator
@@ -0,0 +1,227 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#ifndef CACHE_H
+#define CACHE_H
+
+#pragma warning (disable:4786)
+#include <vector>
+#include <string>
+#include <iostream>
+#include "../Assembler/Base.h"
+
+using namespace std;
+using namespace JMT;
+
+namespace Simulator
+{
+	//Cycles added to an access which reaches the L2 cache unless told otherwise
+	const unsigned int DEFAULT_L2_LATENCY = 10;
+
+	//Tag of an empty way
+	const uint64 INVALID_CACHE_TAG = (uint64)-1;
+
+	//Line replacement policies
+	enum ReplacementEnum {LRUReplacement, PLRUReplacement, RandomReplacement};
+
+	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
+		Cache
+
+		A timing model of one level of set-associative, write-back,
+		write-allocate cache. It only keeps the tags of the lines it holds,
+		not their data, so the architecture still reads and writes memory
+		directly.
+
+		The tags, dirty bits, and replacement state are each kept in their
+		own array, with the ways of a set next to each other, so a lookup
+		only touches the tags of one set.
+	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
+	class Cache
+	{
+	public:
+		string sName;
+		//Bytes of data, bytes per line, and lines per set. All are powers
+		//of two.
+		uint64 Size;
+		unsigned int LineSize, Ways;
+		ReplacementEnum Replacement;
+		//Cycles added to an access which reaches this level
+		unsigned int Latency;
+		//Accesses, and lines written back to the next level
+		uint64 ReadHits, ReadMisses, WriteHits, WriteMisses, Writebacks;
+
+	protected:
+		unsigned int Sets, LineShift;
+		//Line address held by each way, set by set
+		vector<uint64> Tags;
+		//True for each way whose line has been written
+		vector<unsigned char> Dirty;
+		//LRU: the access count of each way's last access.
+		//PLRU: a tree of Ways - 1 bits for each set, pointing away from the
+		//most recently used half.
+		vector<uint64> Ages;
+		vector<uint64> Trees;
+		uint64 Accesses;
+		//Line of the last access, and the index of its way. Accessing it
+		//again does not change the replacement state, so Access skips
+		//the lookup.
+		uint64 LastLine;
+		unsigned int LastIndex;
+		//State of the random number generator for random replacement
+		uint64 RandomState;
+
+		unsigned int Victim(unsigned int);
+		void Touch(unsigned int, unsigned int);
+		void Miss(uint64, unsigned int, bool, uint64 &);
+
+	public:
+		Cache(const string &);
+
+		/**********************************************************************\
+			Create( [in] size, [in] line size, [in] ways,
+				[in] replacement policy, [in] latency )
+
+			Sets the geometry of the cache and empties it. The sizes must be
+			powers of two, and the line size times the ways must not be
+			more than the size. PLRU supports at most 64 ways.
+		\******/
+		void Create(uint64, unsigned int, unsigned int, ReplacementEnum, unsigned int);
+
+		/**********************************************************************\
+			Check( [in] size, [in] line size, [in] ways,
+				[in] replacement policy )
+
+			Returns NULL if Create accepts the geometry, or else a message
+			saying what is wrong with it.
+		\******/
+		static const char *Check(uint64, unsigned int, unsigned int, ReplacementEnum);
+
+		/**********************************************************************\
+			Access( [in] byte address, [in] true if a write,
+				[out] line address written back )
+
+			Looks up the line holding the address, and allocates it on a
+			miss. Returns true on a hit. If the miss replaces a dirty line,
+			the victim is set to its byte address, else to INVALID_CACHE_TAG.
+		\******/
+		bool Access(uint64 Address, bool fWrite, uint64 &VictimAddress)
+		{
+			uint64 Line = Address >> LineShift;
+			VictimAddress = INVALID_CACHE_TAG;
+			if(Line == LastLine)
+			{
+				(fWrite ? WriteHits : ReadHits)++;
+				if(fWrite)
+					Dirty[LastIndex] = 1;
+				return true;
+			}
+
+			unsigned int Set = (unsigned int)Line & (Sets - 1);
+			const uint64 *pTags = &Tags[Set * Ways];
+			for(unsigned int Way = 0; Way < Ways; Way++)
+			{
+				if(pTags[Way] == Line)
+				{
+					(fWrite ? WriteHits : ReadHits)++;
+					LastLine = Line;
+					LastIndex = Set * Ways + Way;
+					if(fWrite)
+						Dirty[LastIndex] = 1;
+					Touch(Set, Way);
+					return true;
+				}
+			}
+			Miss(Line, Set, fWrite, VictimAddress);
+			return false;
+		}
+
+		//Empties the cache and clears the statistics
+		void Clear();
+
+		//Name of the replacement policy
+		const char *ReplacementName() const;
+
+		/**********************************************************************\
+			WriteSummary( [in-out] stream )
+
+			Writes the geometry and statistics on two lines.
+		\******/
+		bool WriteSummary(ostream &) const;
+	};
+
+	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
+		CacheHierarchy
+
+		Split level 1 instruction and data caches, and an optional unified
+		level 2 cache, in front of main memory. The architecture reports
+		each instruction fetch and each data access to main memory, and
+		the cycles added by the levels each access reaches are collected
+		in Stalls, for the simulator to add to the cycle count. The first
+		level's latency is normally 0, since its hits take no longer than a
+		cycle.
+
+		Lines written back by the first level are written to the second
+		(or to memory), and add no cycles, as if through a write buffer.
+		Each access only tests fOn while the model is off.
+	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
+	class CacheHierarchy
+	{
+	public:
+		//true if accesses are modelled
+		bool fOn;
+		Cache L1I, L1D, L2;
+		//true if the L2 cache is used
+		bool fL2;
+		//Cycles added to an access which reaches memory
+		unsigned int MemoryLatency;
+		//Lines read from and written to memory
+		uint64 MemoryReads, MemoryWrites;
+		//Cycles added by accesses, in total and since TakeStalls
+		uint64 StallCycles, Stalls;
+
+		CacheHierarchy();
+
+		/**********************************************************************\
+			Start( )
+
+			Empties the caches, clears the statistics, and starts modelling.
+		\******/
+		void Start();
+		void Stop()	{	fOn = false;	}
+		void Clear();
+
+		//Accesses. The address is a byte address.
+		void Fetch(uint64 Address)	{	if(fOn) Access(L1I, Address, false);	}
+		void Read(uint64 Address)	{	if(fOn) Access(L1D, Address, false);	}
+		void Write(uint64 Address)	{	if(fOn) Access(L1D, Address, true);	}
+
+		//Returns the cycles added since the last call
+		uint64 TakeStalls()
+		{
+			uint64 Cycles = Stalls;
+			StallCycles += Stalls;
+			Stalls = 0;
+			return Cycles;
+		}
+
+		/**********************************************************************\
+			WriteSummary( [in-out] stream )
+
+			Writes the geometry and statistics of each level.
+		\******/
+		bool WriteSummary(ostream &) const;
+
+	protected:
+		void Access(Cache &L1, uint64 Address, bool fWrite)
+		{
+			uint64 VictimAddress;
+			Stalls += L1.Latency;
+			if(!L1.Access(Address, fWrite, VictimAddress))
+				Refill(Address, VictimAddress);
+		}
+		void Refill(uint64, uint64);
+	};
+}
+
+#endif
@@ -0,0 +1,120 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#include "Journal.h"
+
+using namespace std;
+using namespace JMT;
+
+namespace Simulator	{
+
+Journal::Journal()
+{
+	Cycles = 0;
+	MaxEntries = DEFAULT_JOURNAL_ENTRIES;
+	fOn = false;
+}
+
+void Journal::Start(Architecture &Arch, unsigned int maxentries)
+{
+	Registers.assign(Arch.RegisterCount, NULL);
+	RegisterSetNames.assign(Arch.RegisterCount, NULL);
+	for(Architecture::RegisterSetMap::iterator RegSetIter = Arch.RegisterSets.begin(); RegSetIter != Arch.RegisterSets.end(); RegSetIter++)
+	{
+		for(RegisterSet::RegisterMap::iterator RegIter = RegSetIter->second.Registers.begin(); RegIter != RegSetIter->second.Registers.end(); RegIter++)
+		{
+			if(RegIter->second.ID < Registers.size())
+			{
+				Registers[RegIter->second.ID] = &RegIter->second;
+				RegisterSetNames[RegIter->second.ID] = &RegSetIter->first;
+			}
+		}
+	}
+
+	Memories.assign(Arch.MemoryCount, NULL);
+	for(Architecture::MemoryMap::iterator MemIter = Arch.Memories.begin(); MemIter != Arch.Memories.end(); MemIter++)
+	{
+		if(MemIter->second.ID < Memories.size())
+			Memories[MemIter->second.ID] = &MemIter->second;
+		MemIter->second.pJournal = this;
+	}
+
+	MaxEntries = maxentries;
+	fOn = true;
+	Clear();
+}
+
+void Journal::Stop(Architecture &Arch)
+{
+	for(Architecture::MemoryMap::iterator MemIter = Arch.Memories.begin(); MemIter != Arch.Memories.end(); MemIter++)
+		MemIter->second.pJournal = NULL;
+
+	fOn = false;
+	Clear();
+	//A cleared deque may keep its blocks, so swap them away
+	deque<Entry>().swap(Entries);
+	Registers.clear();
+	Memories.clear();
+	RegisterSetNames.clear();
+	RegisterValues.clear();
+}
+
+void Journal::Clear()
+{
+	Entries.clear();
+	Cycles = 0;
+	RegisterValues.assign(Registers.size(), 0);
+	for(unsigned int i = 0; i < Registers.size(); i++)
+	{
+		if(Registers[i])
+			RegisterValues[i] = Registers[i]->Value;
+	}
+}
+
+unsigned int Journal::EndCycle()
+{
+	for(unsigned int i = 0; i < Registers.size(); i++)
+	{
+		if(Registers[i] && Registers[i]->Value != RegisterValues[i])
+		{
+			Entries.push_back( Entry(RegisterEntry, i, 0, RegisterValues[i]) );
+			RegisterValues[i] = Registers[i]->Value;
+		}
+	}
+
+	//Drop whole cycles, so the oldest entry is always a cycle entry
+	unsigned int Returns = 0;
+	while(Entries.size() > MaxEntries && Cycles > 1)
+	{
+		Entries.pop_front();
+		Cycles--;
+		while(Entries.front().Type != CycleEntry)
+		{
+			if(Entries.front().Type == ReturnEntry)
+				Returns++;
+			Entries.pop_front();
+		}
+	}
+	return Returns;
+}
+
+void Journal::Undo(const Entry &TheEntry)
+{
+	switch(TheEntry.Type)
+	{
+	case RegisterEntry:
+		Registers[TheEntry.ID]->Value = TheEntry.Value;
+		RegisterValues[TheEntry.ID] = TheEntry.Value;
+		break;
+	case MemoryEntry:
+		Memories[TheEntry.ID]->pJournal = NULL;
+		Memories[TheEntry.ID]->WriteInt(TheEntry.Address, TheEntry.Bytes, TheEntry.Value, TheEntry.fLittleEndian);
+		Memories[TheEntry.ID]->pJournal = this;
+		break;
+	default:
+		throw "Only register and memory journal entries can be undone by the journal!";
+	}
+}
+
+}	//namespace Simulator
@@ -0,0 +1,161 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#pragma warning (disable:4786)
+#include <deque>
+#include <vector>
+#include "Architecture.h"
+#include "Memory.h"
+#include "Register.h"
+#include "../Assembler/Base.h"
+
+using namespace std;
+using namespace JMT;
+
+namespace Simulator
+{
+	//Number of entries the journal keeps unless told otherwise
+	const unsigned int DEFAULT_JOURNAL_ENTRIES = 1000000;
+
+	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
+		Journal
+
+		An instance of this class records what each simulated cycle
+		overwrote, so that the cycles can be undone again from the most
+		recent one back.
+
+		Every cycle starts with an entry holding the cycle and instruction
+		counts before it ran. Memory writes made with Memory::WriteInt log
+		the bytes they replace as they happen. Registers are compared to
+		their values at the end of the previous cycle, and each one which
+		changed logs its old value. The simulator logs its own call and
+		return entries for the call-stack.
+
+		Each entry is 24 bytes. Once there are more than MaxEntries, the
+		oldest cycles are dropped, so the journal never holds more than
+		MaxEntries plus the entries of one cycle.
+	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
+	class Journal
+	{
+	public:
+		enum EntryEnum {CycleEntry, RegisterEntry, MemoryEntry, CallEntry, ReturnEntry};
+
+		class Entry
+		{
+		public:
+			//EntryEnum
+			unsigned char Type;
+			//Size and byte order of a memory entry
+			unsigned char Bytes;
+			bool fLittleEndian;
+			//Register or memory ID
+			unsigned int ID;
+			//Memory address, instruction count of a cycle entry, or the
+			//caller's address of a return entry
+			uint64 Address;
+			//Old register or memory value, or cycle count of a cycle entry
+			uint64 Value;
+
+			Entry(unsigned char type, unsigned int id = 0, uint64 address = 0, uint64 value = 0, unsigned char bytes = 0, bool flittleendian = false)
+			{
+				Type = type;
+				ID = id;
+				Address = address;
+				Value = value;
+				Bytes = bytes;
+				fLittleEndian = flittleendian;
+			}
+		};
+
+		//Entries of every journaled cycle, oldest first
+		deque<Entry> Entries;
+		//Number of cycle entries in Entries
+		uint64 Cycles;
+		//Entries to keep before dropping the oldest cycles
+		unsigned int MaxEntries;
+		//True while cycles are being journaled
+		bool fOn;
+		//Registers and memories of the architecture, indexed by ID
+		vector<Register *> Registers;
+		vector<Memory *> Memories;
+		//Name of the register set each register is in, indexed by ID
+		vector<const string *> RegisterSetNames;
+		//Value of each register at the end of the last journaled cycle
+		vector<uint64> RegisterValues;
+
+		Journal();
+
+		/**********************************************************************\
+			Start( [in] architecture, [in] maximum entries )
+
+			Starts journaling the architecture's registers and memories with
+			an empty journal.
+		\******/
+		void Start(Architecture &, unsigned int);
+
+		/**********************************************************************\
+			Stop( [in] architecture )
+
+			Stops journaling and frees the journal.
+		\******/
+		void Stop(Architecture &);
+
+		/**********************************************************************\
+			Clear( )
+
+			Forgets every journaled cycle. The current register values become
+			the starting point for the next cycle.
+		\******/
+		void Clear();
+
+		//Log the start of a cycle (cycle count, instruction count)
+		void BeginCycle(uint64 Cycle, uint64 Instruction)
+		{
+			Entries.push_back( Entry(CycleEntry, 0, Instruction, Cycle) );
+			Cycles++;
+		}
+
+		/**********************************************************************\
+			EndCycle( )
+
+			Logs the old value of every register the cycle changed, then
+			drops the oldest cycles if the journal is full. Returns the number
+			of return entries which were dropped, so the caller can free
+			whatever it kept for them.
+		\******/
+		unsigned int EndCycle();
+
+		//Log the bytes a memory write is about to replace
+		//(memory, address, bytes, old value, true if little endian)
+		void LogMemory(const Memory &TheMemory, uint64 Address, unsigned int Bytes, uint64 Value, bool fLittleEndian)
+		{
+			Entries.push_back( Entry(MemoryEntry, TheMemory.ID, Address, Value, (unsigned char)Bytes, fLittleEndian) );
+		}
+
+		//Log a subroutine call
+		void LogCall()
+		{
+			Entries.push_back( Entry(CallEntry) );
+		}
+
+		//Log a subroutine return (address the caller's frame showed)
+		void LogReturn(uint64 CallerAddress)
+		{
+			Entries.push_back( Entry(ReturnEntry, 0, CallerAddress) );
+		}
+
+		/**********************************************************************\
+			Undo( [in] entry )
+
+			Writes the old value of a register or memory entry back. The
+			write is not journaled. Other entries are left to the caller.
+		\******/
+		void Undo(const Entry &);
+	};
+}
+
+#endif
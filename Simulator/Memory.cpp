@@ -3,7 +3,9 @@
 //	awise@crhc.uiuc.edu
 
 #include "Memory.h"
+#include "Journal.h"
 #include <cstdio>
+#include <cstring>
 
 using namespace std;
 using namespace JMT;
@@ -50,49 +52,90 @@ ostream &operator <<(ostream &Output, const MemoryLocation &TheMemLoc)
 Memory::Memory(const string &sname, uint64 Begin, uint64 End, const vector<short> &BitDivisions) : Array(Begin, End, BitDivisions)
 {
 	sName = sname;
+	ID = NO_ID;
+
+	//The memory can be flat if it only uses a few low address bits.
+	//Unused bits are only allowed at the top, since unused low bits would
+	//make neighboring addresses alias.
+	unsigned int UsedBits = 0;
+	fFlat = true;
+	for(unsigned int i = 0; i < BitDivisions.size(); i++)
+	{
+		if(BitDivisions[i] > 0)
+			UsedBits += BitDivisions[i];
+		else if(UsedBits)
+			fFlat = false;
+	}
+	if(UsedBits > MAX_FLAT_MEMORY_BITS)
+		fFlat = false;
+
+	FlatBegin = Begin;
+	FlatEnd = End;
+	FlatMask = 0;
+	fSnapshot = false;
+	pJournal = NULL;
+	if(fFlat)
+	{
+		FlatMask = ((uint64)1 << UsedBits) - 1;
+		Flat.resize((size_t)MIN(FlatMask, End) + 1);
+	}
 }
 
-bool Memory::Write(const RamVector &vRam, SimCallBackFunction)
+bool Memory::Write(const RamImage &Image, SimCallBackFunction)
 {
 	//Buffer for formatting error messages
 	char sMessageBuffer[256];
+	vector<RamImage::Extent>::const_iterator ExtentIter;
 
-	//Check the memory address range
-	RamVector::const_iterator RamIter = vRam.begin();
-	if(RamIter != vRam.end() && RamIter->first < Array.Begin())
+	//Check the memory address range of every extent before writing any
+	for(ExtentIter = Image.Extents.begin(); ExtentIter != Image.Extents.end(); ExtentIter++)
 	{
-		#if defined _MSC_VER
-			sprintf(sMessageBuffer, "%.63s[4x%I64X] is outside of the memory's address range.", sName.c_str(), RamIter->first);
-		#elif defined GPLUSPLUS
-			sprintf(sMessageBuffer, "%.63s[4x%llX] is outside of the memory's address range.", sName.c_str(), RamIter->first);
-		#else
-			#error "Only MSVC and GCC Compilers Supported"
-		#endif
-		SimCallBack(Error, sMessageBuffer);
-		return false;
-	}
-	RamVector::const_reverse_iterator rRamIter = vRam.rbegin();
-	if(rRamIter != vRam.rend() && rRamIter->first > Array.End())
-	{
-		#if defined _MSC_VER
-			sprintf(sMessageBuffer, "%.63s[4x%I64X] is outside of the memory's address range.", sName.c_str(), rRamIter->first);
-		#elif defined GPLUSPLUS
-			sprintf(sMessageBuffer, "%.63s[4x%llX] is outside of the memory's address range.", sName.c_str(), rRamIter->first);
-		#else
-			#error "Only MSVC and GCC Compilers Supported"
-		#endif
-		SimCallBack(Error, sMessageBuffer);
-		return false;
+		uint64 Address = ExtentIter->first;
+		if(Address >= Array.Begin())
+			Address += ExtentIter->second.size() - 1;
+		if(Address < Array.Begin() || Address > Array.End())
+		{
+			#if defined _MSC_VER
+				sprintf(sMessageBuffer, "%.63s[4x%I64X] is outside of the memory's address range.", sName.c_str(), Address);
+			#elif defined GPLUSPLUS
+				sprintf(sMessageBuffer, "%.63s[4x%llX] is outside of the memory's address range.", sName.c_str(), Address);
+			#else
+				#error "Only MSVC and GCC Compilers Supported"
+			#endif
+			SimCallBack(Error, sMessageBuffer);
+			return false;
+		}
 	}
 
 	//Assign the memory data
-	for(RamIter = vRam.begin(); RamIter != vRam.end(); RamIter++)
-		Array[RamIter->first] = RamIter->second;
+	for(ExtentIter = Image.Extents.begin(); ExtentIter != Image.Extents.end(); ExtentIter++)
+	{
+		const vector<unsigned char> &Bytes = ExtentIter->second;
+		if(!fFlat)
+		{
+			for(size_t i = 0; i < Bytes.size(); i++)
+				Array[ExtentIter->first + i] = Bytes[i];
+			continue;
+		}
+
+		//Copy the extent in pieces which do not wrap around the used address bits.
+		//A MemoryLocation is just its byte value, so the bytes copy straight in.
+		size_t i = 0;
+		while(i < Bytes.size())
+		{
+			size_t Index = (size_t)((ExtentIter->first + i) & FlatMask);
+			size_t Length = (size_t)MIN((uint64)(Bytes.size() - i), FlatMask + 1 - Index);
+			memcpy(&Flat[Index], &Bytes[i], Length);
+			for(size_t Page = Index >> MEMORY_PAGE_BITS; Page <= (Index + Length - 1) >> MEMORY_PAGE_BITS; Page++)
+				MarkDirty(Page << MEMORY_PAGE_BITS);
+			i += Length;
+		}
+	}
 
 	return true;
 }
 
-bool Memory::Read(RamVector &vRam, uint64 Address, uint64 Length, SimCallBackFunction) const
+bool Memory::Read(vector<unsigned char> &Bytes, uint64 Address, uint64 Length, SimCallBackFunction) const
 {
 	//Buffer for formatting error messages
 	char sMessageBuffer[256];
@@ -124,31 +167,197 @@ bool Memory::Read(RamVector &vRam, uint64 Address, uint64 Length, SimCallBackFun
 	}
 
 	//Read the memory data
-	for(uint64 i = Address; i < Address + Length; i++)
-		vRam.push_back( RamVector::value_type(i, Array[i]) );
+	Bytes.resize((size_t)Length);
+	for(size_t i = 0; i < Bytes.size(); i++)
+		Bytes[i] = (*this)[Address + i];
 
 	return true;
 }
 
+uint64 Memory::ReadInt(uint64 Address, unsigned int Bytes, bool fLittleEndian) const
+{
+	if(Bytes < 1 || Bytes > 8)
+		throw "Memory integers must be 1 to 8 bytes!";
+
+	uint64 Value = 0;
+	unsigned int i;
+	if(fFlat)
+	{
+		if(Address < FlatBegin || Address + Bytes - 1 > FlatEnd || Address + Bytes - 1 < Address)
+			throw SparseArray<uint64, MemoryLocation>::OutOfBounds();
+		for(i = 0; i < Bytes; i++)
+			Value |= (uint64)Flat[(size_t)((Address + i) & FlatMask)].Value << 8 * (fLittleEndian ? i : Bytes - 1 - i);
+	}
+	else
+	{
+		for(i = 0; i < Bytes; i++)
+			Value |= (uint64)Array[Address + i].Value << 8 * (fLittleEndian ? i : Bytes - 1 - i);
+	}
+	return Value;
+}
+
+void Memory::WriteInt(uint64 Address, unsigned int Bytes, uint64 Value, bool fLittleEndian)
+{
+	if(Bytes < 1 || Bytes > 8)
+		throw "Memory integers must be 1 to 8 bytes!";
+
+	if(pJournal)
+		pJournal->LogMemory(*this, Address, Bytes, ReadInt(Address, Bytes, fLittleEndian), fLittleEndian);
+
+	unsigned int i;
+	if(fFlat)
+	{
+		if(Address < FlatBegin || Address + Bytes - 1 > FlatEnd || Address + Bytes - 1 < Address)
+			throw SparseArray<uint64, MemoryLocation>::OutOfBounds();
+		for(i = 0; i < Bytes; i++)
+			Flat[(size_t)((Address + i) & FlatMask)] = (unsigned char)(Value >> 8 * (fLittleEndian ? i : Bytes - 1 - i));
+		//An integer is smaller than a page, so it can only touch the pages
+		//of its first and last bytes
+		MarkDirty((size_t)(Address & FlatMask));
+		MarkDirty((size_t)((Address + Bytes - 1) & FlatMask));
+	}
+	else
+	{
+		for(i = 0; i < Bytes; i++)
+			Array[Address + i] = (unsigned char)(Value >> 8 * (fLittleEndian ? i : Bytes - 1 - i));
+	}
+}
+
 void Memory::Clear()
 {
-	Array.Clear(Array.Begin(), Array.End());
+	if(fFlat)
+	{
+		Flat.assign(Flat.size(), MemoryLocation());
+		for(size_t Page = 0; Page < DirtyPages.size(); Page++)
+			MarkDirty(Page << MEMORY_PAGE_BITS);
+	}
+	else
+		Array.Clear(Array.Begin(), Array.End());
+}
+
+bool Memory::TakeSnapshot()
+{
+	if(!fFlat)
+		return false;
+
+	SnapshotFlat = Flat;
+	size_t Pages = PageCount();
+	//Whatever was written before the snapshot is unknown to the last state
+	DirtyPages.assign(Pages, STATE_DIRTY);
+	DirtyList.clear();
+	DirtyList.reserve(Pages);
+	StateDirtyList.clear();
+	StateDirtyList.reserve(Pages);
+	for(size_t Page = 0; Page < Pages; Page++)
+		StateDirtyList.push_back(Page);
+	fSnapshot = true;
+	return true;
+}
+
+void Memory::RestoreSnapshot(vector<uint64> &RestoredPages)
+{
+	if(!fSnapshot)
+		throw "Memory snapshot restored before it was taken!";
+
+	for(vector<size_t>::iterator PageIter = DirtyList.begin(); PageIter != DirtyList.end(); PageIter++)
+	{
+		size_t Index = *PageIter << MEMORY_PAGE_BITS;
+		memcpy(&Flat[Index], &SnapshotFlat[Index], MIN((size_t)MEMORY_PAGE_BYTES, Flat.size() - Index));
+		if(!(DirtyPages[*PageIter] & STATE_DIRTY))
+			StateDirtyList.push_back(*PageIter);
+		DirtyPages[*PageIter] = STATE_DIRTY;
+
+		//Every address whose used bits select this page
+		for(uint64 Address = (FlatBegin & ~FlatMask) | Index; Address <= FlatEnd; Address += FlatMask + 1)
+		{
+			if(Address + MEMORY_PAGE_BYTES > FlatBegin)
+				RestoredPages.push_back(Address);
+			if(FlatEnd - Address <= FlatMask)
+				break;
+		}
+	}
+	DirtyList.clear();
 }
 
-MemoryLocation &Memory::operator[](uint64 Index)
+void Memory::DiscardSnapshot()
 {
-	return Array[Index];
+	fSnapshot = false;
+	vector<MemoryLocation>().swap(SnapshotFlat);
+	vector<unsigned char>().swap(DirtyPages);
+	vector<size_t>().swap(DirtyList);
+	vector<size_t>().swap(StateDirtyList);
+}
+
+bool Memory::StateSaved()
+{
+	if(!fSnapshot)
+		return false;
+
+	for(vector<size_t>::iterator PageIter = StateDirtyList.begin(); PageIter != StateDirtyList.end(); PageIter++)
+		DirtyPages[*PageIter] &= ~STATE_DIRTY;
+	StateDirtyList.clear();
+	return true;
+}
+
+void Memory::WritePage(size_t Page, const unsigned char *pBytes)
+{
+	size_t Index = Page << MEMORY_PAGE_BITS;
+	memcpy(&Flat[Index], pBytes, MIN((size_t)MEMORY_PAGE_BYTES, Flat.size() - Index));
+	MarkDirty(Index);
+}
+
+bool Memory::PageIsClear(size_t Page) const
+{
+	size_t Index = Page << MEMORY_PAGE_BITS;
+	size_t End = MIN(Index + MEMORY_PAGE_BYTES, Flat.size());
+	for(; Index < End; Index++)
+		if(Flat[Index].Value != UNINITIALIZED_VALUE)
+			return false;
+	return true;
 }
 
 istream &operator >>(istream &Input, Memory &TheMem)
 {
-	return Input >> TheMem.Array;
+	if(!TheMem.fFlat)
+		return Input >> TheMem.Array;
+
+	//Read the same "Index,Value\n" format as the SparseArray
+	uint64 Index;
+	MemoryLocation Value;
+	while(true)
+	{
+		Input >> Index;
+		Input.ignore(1);
+		Input >> Value;
+		if(!Input.good())
+			break;
+		if(!(Value == MemoryLocation()))
+			TheMem[Index] = Value;
+		Input.ignore(1);
+	}
+	return Input;
 }
 
 ostream &operator <<(ostream &Output, const Memory &TheMem)
 {
-	//*NOTE: GCC incorrectly calls the non-const << function instead of the const version
-	return Output << TheMem.Array;
+	if(!TheMem.fFlat)
+		//*NOTE: GCC incorrectly calls the non-const << function instead of the const version
+		return Output << TheMem.Array;
+
+	//Write the same "Index,Value\n" format as the SparseArray, skipping default values.
+	//The index is the first address in the memory's range whose used bits
+	//select the location.
+	for(size_t i = 0; i < TheMem.Flat.size(); i++)
+	{
+		if(TheMem.Flat[i] == MemoryLocation())
+			continue;
+		uint64 Address = (TheMem.FlatBegin & ~TheMem.FlatMask) | i;
+		if(Address < TheMem.FlatBegin)
+			Address += TheMem.FlatMask + 1;
+		if(Address <= TheMem.FlatEnd)
+			Output << Address << ',' << TheMem.Flat[i] << '\n';
+	}
+	return Output;
 }
 
 }	//namespace Simulator
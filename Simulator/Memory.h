@@ -11,6 +11,7 @@
 #include <iostream>
 #include "../JMTLib/SparseArray.h"
 #include "../Assembler/Base.h"
+#include "../Assembler/RamImage.h"
 
 using namespace std;
 using namespace JMT;
@@ -18,6 +19,20 @@ using namespace Assembler;
 
 namespace Simulator
 {
+	class Journal;
+
+	//Memories indexed by at most this many low address bits are stored in a
+	//flat array instead of a SparseArray
+	const unsigned int MAX_FLAT_MEMORY_BITS = 20;
+	//Flat memories track the writes made since a snapshot in pages of
+	//2^MEMORY_PAGE_BITS bytes
+	const unsigned int MEMORY_PAGE_BITS = 8;
+	const unsigned int MEMORY_PAGE_BYTES = 1 << MEMORY_PAGE_BITS;
+	//Page flags for a write since the snapshot, and since the last saved
+	//or loaded state
+	const unsigned char SNAPSHOT_DIRTY = 1;
+	const unsigned char STATE_DIRTY = 2;
+
 	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
 		MemoryLocation
 
@@ -50,25 +65,145 @@ namespace Simulator
 
 		A memory array can contain up to 2^64 memory locations (64-bit 
 		indexability), and uses SparseArray to manage the data.
+
+		If the bit divisions only use the low MAX_FLAT_MEMORY_BITS bits or
+		fewer of the address, the data is kept in a flat array instead so
+		that an access is a bounds check and an index. Unused high bits
+		alias the same location, just as they do in the SparseArray.
+
+		A flat memory can take a snapshot of its contents. Every write after
+		that marks its page dirty, so restoring the snapshot only copies
+		back the pages which were written. The pages written since the
+		last saved or loaded state are tracked the same way, so that an
+		incremental state only has to save those pages.
+
+		While a Journal is attached, WriteInt logs the bytes it replaces.
 	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
 	class Memory
 	{
 	public:
-		//The memory array
+		//The memory array. When the memory is flat, this only holds the range.
 		SparseArray<uint64, MemoryLocation> Array;
+		//The flat memory array, indexed by the used bits of the address
+		vector<MemoryLocation> Flat;
+		//true if Flat holds the data instead of Array
+		bool fFlat;
+		//Address range and used address bits of the flat array
+		uint64 FlatBegin, FlatEnd, FlatMask;
+		//Contents of the flat array when the snapshot was taken
+		vector<MemoryLocation> SnapshotFlat;
+		//true if writes are being tracked against a snapshot
+		bool fSnapshot;
+		//SNAPSHOT_DIRTY and STATE_DIRTY flags for each page of the flat
+		//array, and the lists of the pages with each flag
+		vector<unsigned char> DirtyPages;
+		vector<size_t> DirtyList;
+		vector<size_t> StateDirtyList;
+		//Journal which logs the old value of every WriteInt, or NULL
+		Journal *pJournal;
 		//Name of the memory
 		string sName;
+		//ID of a memory which has not been numbered
+		static const unsigned int NO_ID = 0xFFFFFFFF;
+		//Unique index of the memory within its architecture, assigned by
+		//Architecture::NumberMemories. NO_ID until then.
+		unsigned int ID;
 
 		//Construct (name, start byte index, end byte index, bit divisions)
 		Memory(const string &, uint64, uint64, const vector<short> &);
-		//Assign the memory image to the memory array
-		bool Write(const RamVector &, SimCallBackFunction);
-		//Read the memory image from the memory array (image, address, length)
-		bool Read(RamVector &, uint64, uint64, SimCallBackFunction) const;
+		//Assign the memory image to the memory array an extent at a time
+		bool Write(const RamImage &, SimCallBackFunction);
+		//Read bytes at consecutive addresses from the memory array (bytes,
+		//address, length)
+		bool Read(vector<unsigned char> &, uint64, uint64, SimCallBackFunction) const;
 		//Reset the memory
 		void Clear();
 		//Access an element from the memory
-		MemoryLocation &operator[](uint64);
+		MemoryLocation &operator[](uint64 Index)
+		{
+			if(fFlat)
+			{
+				if(Index < FlatBegin || Index > FlatEnd)
+					throw SparseArray<uint64, MemoryLocation>::OutOfBounds();
+				MarkDirty((size_t)(Index & FlatMask));
+				return Flat[(size_t)(Index & FlatMask)];
+			}
+			return Array[Index];
+		}
+		const MemoryLocation &operator[](uint64 Index) const
+		{
+			if(fFlat)
+			{
+				if(Index < FlatBegin || Index > FlatEnd)
+					throw SparseArray<uint64, MemoryLocation>::OutOfBounds();
+				return Flat[(size_t)(Index & FlatMask)];
+			}
+			return Array[Index];
+		}
+		//Read an integer from the memory (address, bytes, true if little endian).
+		//Does one bounds check and builds no vector.
+		uint64 ReadInt(uint64, unsigned int, bool) const;
+		//Write an integer to the memory (address, bytes, value, true if little endian)
+		void WriteInt(uint64, unsigned int, uint64, bool);
+		//Fixed size reads and writes (address, [value], true if little endian)
+		unsigned char Read8(uint64 Address) const	{	return (*this)[Address];	}
+		unsigned short Read16(uint64 Address, bool fLittleEndian) const	{	return (unsigned short)ReadInt(Address, 2, fLittleEndian);	}
+		unsigned int Read32(uint64 Address, bool fLittleEndian) const	{	return (unsigned int)ReadInt(Address, 4, fLittleEndian);	}
+		void Write8(uint64 Address, unsigned char Value)	{	(*this)[Address] = Value;	}
+		void Write16(uint64 Address, unsigned short Value, bool fLittleEndian)	{	WriteInt(Address, 2, Value, fLittleEndian);	}
+		void Write32(uint64 Address, unsigned int Value, bool fLittleEndian)	{	WriteInt(Address, 4, Value, fLittleEndian);	}
+		//Flag the page holding an index of the flat array as written
+		void MarkDirty(size_t FlatIndex)
+		{
+			size_t Page = FlatIndex >> MEMORY_PAGE_BITS;
+			if(fSnapshot && DirtyPages[Page] != (SNAPSHOT_DIRTY | STATE_DIRTY))
+			{
+				if(!(DirtyPages[Page] & SNAPSHOT_DIRTY))
+					DirtyList.push_back(Page);
+				if(!(DirtyPages[Page] & STATE_DIRTY))
+					StateDirtyList.push_back(Page);
+				DirtyPages[Page] = SNAPSHOT_DIRTY | STATE_DIRTY;
+			}
+		}
+		//Number of pages in the flat array
+		size_t PageCount() const	{	return fFlat ? ((Flat.size() - 1) >> MEMORY_PAGE_BITS) + 1 : 0;	}
+		//Copy a page of bytes into the flat array and mark it written
+		void WritePage(size_t, const unsigned char *);
+		//true if every byte of a page of the flat array is uninitialized
+		bool PageIsClear(size_t) const;
+
+		/**********************************************************************\
+			TakeSnapshot( )
+
+			Saves the current contents of the memory and starts tracking
+			which pages are written. Only flat memories can take a snapshot.
+			Returns false for any other memory.
+		\******/
+		bool TakeSnapshot();
+
+		/**********************************************************************\
+			RestoreSnapshot( [out] restored page addresses )
+
+			Copies the pages written since the snapshot back from the
+			snapshot. The byte address of each restored page is appended to
+			the vector, once for every address range that aliases it.
+			TakeSnapshot must have succeeded first.
+		\******/
+		void RestoreSnapshot(vector<uint64> &);
+
+		//Stop tracking writes and free the snapshot
+		void DiscardSnapshot();
+
+		/**********************************************************************\
+			StateSaved( )
+
+			Called once the memory has been saved to or loaded from a state.
+			Clears the list of pages written since the last state. Returns
+			false if writes are not being tracked, in which case the next
+			incremental state has to save every page.
+		\******/
+		bool StateSaved();
+
 		//saving and loading snapshots
 		friend istream &operator >>(istream &, Memory &);
 		friend ostream &operator <<(ostream &, const Memory &);
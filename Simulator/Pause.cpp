@@ -0,0 +1,106 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#pragma warning (disable:4786)
+#include "Pause.h"
+
+using namespace std;
+using namespace JMT;
+
+namespace Simulator	{
+
+volatile sig_atomic_t PauseFlag::Interrupts = 0;
+set<PauseFlag *> PauseFlag::Flags;
+volatile uint64 PauseFlag::Lock = 0;
+volatile unsigned int PauseFlag::Armed = 0;
+void (*PauseFlag::OldSig)(int) = SIG_DFL;
+
+PauseFlag::PauseFlag()
+{
+	fPause = false;
+	SeenInterrupts = ATOMIC_LOAD(Interrupts);
+	AcquireLock();
+	Flags.insert(this);
+	ReleaseLock();
+}
+
+PauseFlag::PauseFlag(const PauseFlag &)
+{
+	fPause = false;
+	SeenInterrupts = ATOMIC_LOAD(Interrupts);
+	AcquireLock();
+	Flags.insert(this);
+	ReleaseLock();
+}
+
+PauseFlag::~PauseFlag()
+{
+	AcquireLock();
+	Flags.erase(this);
+	ReleaseLock();
+}
+
+void PauseFlag::Arm()
+{
+	ATOMIC_STORE(SeenInterrupts, ATOMIC_LOAD(Interrupts))
+	AcquireLock();
+	unsigned int WasArmed = Armed;
+	ATOMIC_STORE(Armed, WasArmed + 1)
+	if(!WasArmed)
+		OldSig = signal(SIGINT, ControlC);
+	ReleaseLock();
+}
+
+void PauseFlag::Disarm()
+{
+	AcquireLock();
+	if(!Armed)
+	{
+		ReleaseLock();
+		throw "Pause flag disarmed more times than armed!";
+	}
+	ATOMIC_STORE(Armed, Armed - 1)
+	if(!Armed)
+		signal(SIGINT, OldSig);
+	ReleaseLock();
+}
+
+void PauseFlag::SetAll()
+{
+	AcquireLock();
+	for(set<PauseFlag *>::iterator FlagIter = Flags.begin(); FlagIter != Flags.end(); FlagIter++)
+		(*FlagIter)->Set();
+	ReleaseLock();
+}
+
+size_t PauseFlag::Count()
+{
+	AcquireLock();
+	size_t Size = Flags.size();
+	ReleaseLock();
+	return Size;
+}
+
+void PauseFlag::AcquireLock()
+{
+	//The lock is only held for a few instructions, so spin rather than sleep
+	while(ATOMIC_COMPARE_EXCHANGE(Lock, 1, 0))
+		SYNCH_SLEEP(0)
+}
+
+void PauseFlag::ReleaseLock()
+{
+	ATOMIC_STORE(Lock, 0)
+}
+
+void PauseFlag::ControlC(int Sig)
+{
+	ATOMIC_STORE(Interrupts, ATOMIC_LOAD(Interrupts) + 1)
+	//*NOTE: reassigning the signal handler appears to be a
+	//one-use only event
+	if(ATOMIC_LOAD(Armed))
+		signal(SIGINT, ControlC);
+}
+
+}	//namespace Simulator
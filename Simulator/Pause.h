@@ -0,0 +1,95 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#ifndef PAUSE_H
+#define PAUSE_H
+
+#pragma warning (disable:4786)
+#include <set>
+#include <signal.h>
+#include "../Assembler/Base.h"
+
+using namespace std;
+using namespace JMT;
+
+namespace Simulator
+{
+	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
+		PauseFlag
+
+		Each simulator owns one of these, and checks it between batches of
+		cycles to see if it should break to the simulator UI. It is set by
+		the simulator's own Set(), by SetAll(), or by Ctrl-C.
+
+		Every flag in the process is kept in one registry, so there is no
+		limit on the number of simulators. A single SIGINT handler is
+		installed while any simulator is running, and the old handler is
+		put back when the last one stops.
+
+		Walking the registry is not safe in a signal handler, so the
+		handler only counts the interrupt. Each flag remembers the count
+		it last saw, so every running simulator sees a new Ctrl-C once.
+	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
+	class PauseFlag
+	{
+	public:
+		PauseFlag();
+		PauseFlag(const PauseFlag &);
+		~PauseFlag();
+		PauseFlag &operator =(const PauseFlag &)	{	return *this;	}
+
+		//Pause this simulator. Safe to call from any thread.
+		void Set()	{	ATOMIC_STORE(fPause, true)	}
+		//true if paused or Ctrl-C was pressed since the last Take
+		bool Pending() const	{	return ATOMIC_LOAD(fPause) || ATOMIC_LOAD(SeenInterrupts) != ATOMIC_LOAD(Interrupts);	}
+		//true if paused or Ctrl-C was pressed since the last call, and clears it
+		bool Take()
+		{
+			if(!Pending())
+				return false;
+			ATOMIC_STORE(fPause, false)
+			ATOMIC_STORE(SeenInterrupts, ATOMIC_LOAD(Interrupts))
+			return true;
+		}
+
+		/**********************************************************************\
+			Arm( )
+
+			Called when the simulator starts running. Installs the SIGINT
+			handler if no other simulator is running, and forgets any
+			Ctrl-C pressed while this simulator was not running.
+		\******/
+		void Arm();
+		//Called when the simulator stops running. Restores the old SIGINT
+		//handler if no other simulator is running.
+		void Disarm();
+
+		//Pause every simulator in the process
+		static void SetAll();
+		//Number of simulators in the process
+		static size_t Count();
+
+	protected:
+		//Every thread reads and writes these with ATOMIC_LOAD and ATOMIC_STORE
+		volatile bool fPause;
+		//Value of Interrupts when this flag last checked it
+		volatile sig_atomic_t SeenInterrupts;
+
+		//Number of times Ctrl-C has been pressed. Only the handler changes it.
+		static volatile sig_atomic_t Interrupts;
+		//Every flag in the process, and the lock which guards it
+		static set<PauseFlag *> Flags;
+		static volatile uint64 Lock;
+		//Number of flags which are armed, and the handler before they were.
+		//Armed is only changed with the lock held, but the handler reads it.
+		static volatile unsigned int Armed;
+		static void (*OldSig)(int);
+
+		static void AcquireLock();
+		static void ReleaseLock();
+		static void ControlC(int);
+	};
+}
+
+#endif
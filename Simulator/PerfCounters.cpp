@@ -0,0 +1,180 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#pragma warning (disable:4786)
+#include "PerfCounters.h"
+#include <algorithm>
+
+using namespace std;
+using namespace JMT;
+
+namespace Simulator	{
+
+PerfCounters::PerfCounters()
+{
+	fOn = false;
+	AddressCount = 0;
+	AddressShift = 0;
+	Clear();
+}
+
+void PerfCounters::Create(const vector<string> &opcodes, const vector<OpcodeKindEnum> &kinds, uint64 addresscount, unsigned int addressshift)
+{
+	if(opcodes.size() != kinds.size())
+		throw "Every opcode needs a kind!";
+
+	Opcodes = opcodes;
+	OpcodeKinds = kinds;
+	AddressCount = addresscount;
+	AddressShift = addressshift;
+	fOn = false;
+	AddressCounts.clear();
+	Clear();
+}
+
+void PerfCounters::Start()
+{
+	//The histogram is only allocated once counting is used
+	if(AddressCounts.size() != AddressCount)
+		AddressCounts.resize((size_t)AddressCount);
+	Clear();
+	fOn = true;
+}
+
+void PerfCounters::Clear()
+{
+	OpcodeCounts.assign(Opcodes.size(), 0);
+	Cycles = 0;
+	Taken = NotTaken = 0;
+	MMIOReads = MMIOWrites = 0;
+	Interrupts = Exceptions = 0;
+	Stalls = Flushes = Flushed = 0;
+	AddressCounts.assign(AddressCounts.size(), 0);
+}
+
+uint64 PerfCounters::Instructions() const
+{
+	uint64 Total = 0;
+	for(unsigned int i = 0; i < OpcodeCounts.size(); i++)
+		Total += OpcodeCounts[i];
+	return Total;
+}
+
+uint64 PerfCounters::Loads() const
+{
+	uint64 Total = 0;
+	for(unsigned int i = 0; i < OpcodeCounts.size(); i++)
+		if(OpcodeKinds[i] == LoadOpcode)
+			Total += OpcodeCounts[i];
+	return Total;
+}
+
+uint64 PerfCounters::Stores() const
+{
+	uint64 Total = 0;
+	for(unsigned int i = 0; i < OpcodeCounts.size(); i++)
+		if(OpcodeKinds[i] == StoreOpcode)
+			Total += OpcodeCounts[i];
+	return Total;
+}
+
+//Orders (count, index) pairs by count, most first, then by address
+static bool HotterAddress(const pair<uint64, uint64> &A, const pair<uint64, uint64> &B)
+{
+	if(A.first != B.first)
+		return A.first > B.first;
+	return A.second < B.second;
+}
+
+void PerfCounters::HotAddresses(unsigned int MaxCount, vector<uint64> &Addresses) const
+{
+	vector< pair<uint64, uint64> > Hot;
+
+	for(size_t i = 0; i < AddressCounts.size(); i++)
+		if(AddressCounts[i])
+			Hot.push_back(pair<uint64, uint64>(AddressCounts[i], i));
+
+	if(Hot.size() > MaxCount)
+	{
+		partial_sort(Hot.begin(), Hot.begin() + MaxCount, Hot.end(), HotterAddress);
+		Hot.resize(MaxCount);
+	}
+	else
+		sort(Hot.begin(), Hot.end(), HotterAddress);
+
+	Addresses.clear();
+	for(size_t i = 0; i < Hot.size(); i++)
+		Addresses.push_back(Hot[i].second << AddressShift);
+}
+
+bool PerfCounters::WriteCSV(ostream &Output) const
+{
+	Output << "kind,name,count\n";
+	Output << "counter,cycles," << Cycles << "\n";
+	Output << "counter,instructions," << Instructions() << "\n";
+	Output << "counter,loads," << Loads() << "\n";
+	Output << "counter,stores," << Stores() << "\n";
+	Output << "counter,taken," << Taken << "\n";
+	Output << "counter,not_taken," << NotTaken << "\n";
+	Output << "counter,mmio_reads," << MMIOReads << "\n";
+	Output << "counter,mmio_writes," << MMIOWrites << "\n";
+	Output << "counter,interrupts," << Interrupts << "\n";
+	Output << "counter,exceptions," << Exceptions << "\n";
+	Output << "counter,stalls," << Stalls << "\n";
+	Output << "counter,flushes," << Flushes << "\n";
+	Output << "counter,flushed," << Flushed << "\n";
+
+	for(unsigned int i = 0; i < Opcodes.size(); i++)
+		if(OpcodeCounts[i])
+			Output << "opcode," << Opcodes[i] << "," << OpcodeCounts[i] << "\n";
+
+	for(size_t i = 0; i < AddressCounts.size(); i++)
+		if(AddressCounts[i])
+			Output << "address,x" << hex << uppercase << ((uint64)i << AddressShift) << nouppercase << dec << "," << AddressCounts[i] << "\n";
+
+	return !Output.fail();
+}
+
+bool PerfCounters::WriteJSON(ostream &Output) const
+{
+	Output << "{\n\t\"counters\": {";
+	Output << "\n\t\t\"cycles\": " << Cycles;
+	Output << ",\n\t\t\"instructions\": " << Instructions();
+	Output << ",\n\t\t\"loads\": " << Loads();
+	Output << ",\n\t\t\"stores\": " << Stores();
+	Output << ",\n\t\t\"taken\": " << Taken;
+	Output << ",\n\t\t\"not_taken\": " << NotTaken;
+	Output << ",\n\t\t\"mmio_reads\": " << MMIOReads;
+	Output << ",\n\t\t\"mmio_writes\": " << MMIOWrites;
+	Output << ",\n\t\t\"interrupts\": " << Interrupts;
+	Output << ",\n\t\t\"exceptions\": " << Exceptions;
+	Output << ",\n\t\t\"stalls\": " << Stalls;
+	Output << ",\n\t\t\"flushes\": " << Flushes;
+	Output << ",\n\t\t\"flushed\": " << Flushed;
+	Output << "\n\t},\n\t\"opcodes\": {";
+
+	const char *sSeparator = "\n";
+	for(unsigned int i = 0; i < Opcodes.size(); i++)
+	{
+		if(!OpcodeCounts[i])
+			continue;
+		Output << sSeparator << "\t\t\"" << Opcodes[i] << "\": " << OpcodeCounts[i];
+		sSeparator = ",\n";
+	}
+	Output << "\n\t},\n\t\"addresses\": {";
+
+	sSeparator = "\n";
+	for(size_t i = 0; i < AddressCounts.size(); i++)
+	{
+		if(!AddressCounts[i])
+			continue;
+		Output << sSeparator << "\t\t\"x" << hex << uppercase << ((uint64)i << AddressShift) << nouppercase << dec << "\": " << AddressCounts[i];
+		sSeparator = ",\n";
+	}
+	Output << "\n\t}\n}\n";
+
+	return !Output.fail();
+}
+
+}	//namespace Simulator
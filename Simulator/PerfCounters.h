@@ -0,0 +1,122 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#ifndef PERFCOUNTERS_H
+#define PERFCOUNTERS_H
+
+#pragma warning (disable:4786)
+#include <vector>
+#include <string>
+#include <iostream>
+#include "../Assembler/Base.h"
+
+using namespace std;
+using namespace JMT;
+
+namespace Simulator
+{
+	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
+		PerfCounters
+
+		Execution statistics for one architecture. The architecture names its
+		opcodes with Create, and then calls the inline counting functions from
+		its engines. Each counting function only tests fOn when counting is
+		off, and the per-address histogram is not allocated until counting is
+		first turned on.
+
+		Loads and stores are counted by instruction, from the kind of each
+		opcode, so that every engine gives the same counts.
+	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
+	class PerfCounters
+	{
+	public:
+		enum OpcodeKindEnum {OtherOpcode, LoadOpcode, StoreOpcode};
+
+		//true if the counting functions count
+		bool fOn;
+		//Name, kind, and execution count of each opcode
+		vector<string> Opcodes;
+		vector<OpcodeKindEnum> OpcodeKinds;
+		vector<uint64> OpcodeCounts;
+		//Cycles run by the simulator while counting
+		uint64 Cycles;
+		//Conditional branches
+		uint64 Taken, NotTaken;
+		//Reads and writes of memory-mapped IO registers
+		uint64 MMIOReads, MMIOWrites;
+		//Interrupts and exceptions taken
+		uint64 Interrupts, Exceptions;
+		//Pipelined engines: cycles an instruction was held back by a
+		//hazard, and flushes with the instructions they discarded
+		uint64 Stalls, Flushes, Flushed;
+		//Instructions executed at each address, indexed by address >> AddressShift
+		vector<uint64> AddressCounts;
+		uint64 AddressCount;
+		unsigned int AddressShift;
+
+		PerfCounters();
+
+		/**********************************************************************\
+			Create( [in] opcode names, [in] opcode kinds,
+				[in] number of instruction addresses, [in] address shift )
+
+			Sets up the counters for an architecture. An opcode number is an
+			index into the names. An instruction address is shifted right by
+			the shift to index the histogram.
+		\******/
+		void Create(const vector<string> &, const vector<OpcodeKindEnum> &, uint64, unsigned int);
+
+		/**********************************************************************\
+			Start( )
+
+			Clears the counters and starts counting.
+		\******/
+		void Start();
+		void Stop()	{	fOn = false;	}
+		void Clear();
+
+		//Counting functions
+		void Instruction(unsigned int Opcode, uint64 Address)
+		{
+			if(!fOn)
+				return;
+			OpcodeCounts[Opcode]++;
+			if((Address >>= AddressShift) < AddressCounts.size())
+				AddressCounts[(size_t)Address]++;
+		}
+		void Branch(bool fTaken)	{	if(fOn) (fTaken ? Taken : NotTaken)++;	}
+		void MMIORead()	{	if(fOn) MMIOReads++;	}
+		void MMIOWrite()	{	if(fOn) MMIOWrites++;	}
+		void Interrupt()	{	if(fOn) Interrupts++;	}
+		void Exception()	{	if(fOn) Exceptions++;	}
+		void Stall()	{	if(fOn) Stalls++;	}
+		void Flush(unsigned int Instructions)	{	if(fOn) { Flushes++; Flushed += Instructions; }	}
+
+		//Totals of the opcode counts
+		uint64 Instructions() const;
+		uint64 Loads() const;
+		uint64 Stores() const;
+
+		/**********************************************************************\
+			HotAddresses( [in] maximum count, [out] addresses )
+
+			Returns the addresses which executed the most instructions, most
+			first. Addresses which never executed are not returned.
+		\******/
+		void HotAddresses(unsigned int, vector<uint64> &) const;
+
+		/**********************************************************************\
+			WriteCSV( [in-out] stream )
+			WriteJSON( [in-out] stream )
+
+			Writes every nonzero counter in a machine-readable form. The CSV
+			has one "kind,name,count" row per counter. Addresses are written
+			in hex.
+		\******/
+		bool WriteCSV(ostream &) const;
+		bool WriteJSON(ostream &) const;
+	};
+}
+
+#endif
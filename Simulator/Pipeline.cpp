@@ -35,7 +35,9 @@ bool Pipeline::AddStage(const string &sStageName, bool (*Run)(Architecture *))
 
 bool Pipeline::Run(Architecture *pArch)
 {
-	for(PipelineStageVector::iterator PipeIter = PipelineStages.begin(); PipeIter != PipelineStages.end(); PipeIter++)
+	//The last stage runs first, so each stage reads its input latch before
+	//the stage in front of it writes the next instruction into it
+	for(PipelineStageVector::reverse_iterator PipeIter = PipelineStages.rbegin(); PipeIter != PipelineStages.rend(); PipeIter++)
 		if(!PipeIter->Run(pArch))
 			return false;
 	return true;
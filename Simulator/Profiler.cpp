@@ -0,0 +1,275 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#pragma warning (disable:4786)
+#include "Profiler.h"
+#include <algorithm>
+#include <iomanip>
+#include <cstdio>
+
+using namespace std;
+using namespace JMT;
+
+namespace Simulator	{
+
+Profiler::Profiler()
+{
+	fOn = false;
+	Interval = DEFAULT_PROFILE_INTERVAL;
+	Clear();
+}
+
+void Profiler::Start(uint64 interval, uint64 Cycle)
+{
+	if(!interval)
+		throw "Profile interval must be at least one cycle!";
+
+	Interval = interval;
+	Clear(Cycle);
+	fOn = true;
+}
+
+void Profiler::Clear(uint64 Cycle)
+{
+	LastCycle = Cycle;
+	Samples = Cycles = 0;
+	Functions.clear();
+	Files.clear();
+	FunctionIDs.clear();
+	FileIDs.clear();
+	Entries.clear();
+	Exclusive.clear();
+	Inclusive.clear();
+	LastSample.clear();
+	Stacks.clear();
+	Lines.clear();
+	Calls.clear();
+}
+
+unsigned int Profiler::FunctionID(const string &sFunction)
+{
+	static const string sUnlabeled = "(unlabeled)";
+	const string &sName = sFunction.empty() ? sUnlabeled : sFunction;
+
+	map<string, unsigned int>::iterator FunctionIter = FunctionIDs.find(sName);
+	if(FunctionIter != FunctionIDs.end())
+		return FunctionIter->second;
+
+	unsigned int ID = (unsigned int)Functions.size();
+	FunctionIDs.insert(map<string, unsigned int>::value_type(sName, ID));
+	Functions.push_back(sName);
+	Entries.push_back(pair<unsigned int, unsigned int>((unsigned int)-1, 0));
+	Exclusive.push_back(0);
+	Inclusive.push_back(0);
+	LastSample.push_back(0);
+	return ID;
+}
+
+unsigned int Profiler::FileID(const string &sFile)
+{
+	map<string, unsigned int>::iterator FileIter = FileIDs.find(sFile);
+	if(FileIter != FileIDs.end())
+		return FileIter->second;
+
+	unsigned int ID = (unsigned int)Files.size();
+	FileIDs.insert(map<string, unsigned int>::value_type(sFile, ID));
+	Files.push_back(sFile);
+	return ID;
+}
+
+unsigned int Profiler::FunctionFile(unsigned int Function) const
+{
+	if(Entries[Function].first != (unsigned int)-1)
+		return Entries[Function].first;
+
+	//Lines and calls are sorted by function first
+	map<LineKey, uint64>::const_iterator LineIter = Lines.lower_bound(LineKey(Function, 0, 0));
+	if(LineIter != Lines.end() && LineIter->first.first == Function)
+		return LineIter->first.second;
+	map<CallKey, pair<uint64, uint64> >::const_iterator CallIter = Calls.lower_bound(CallKey(Function, 0, 0, 0));
+	if(CallIter != Calls.end() && CallIter->first.first == Function)
+		return CallIter->first.second;
+	return (unsigned int)-1;
+}
+
+void Profiler::Sample(const vector<Frame> &CallStack, uint64 Cycle)
+{
+	uint64 Weight = Cycle - LastCycle;
+	LastCycle = Cycle;
+	if(!Weight || CallStack.empty())
+		return;
+
+	Samples++;
+	Cycles += Weight;
+
+	SampleStack.resize(CallStack.size());
+	for(unsigned int i = 0; i < CallStack.size(); i++)
+		SampleStack[i] = FunctionID(*CallStack[i].psFunction);
+	Stacks[SampleStack] += Weight;
+
+	//The top of the stack is executing
+	const Frame &Top = *CallStack.rbegin();
+	Lines[LineKey(*SampleStack.rbegin(), FileID(*Top.psFile), Top.Line)] += Weight;
+	Exclusive[*SampleStack.rbegin()] += Weight;
+
+	//A recursive function or call is only charged once per sample
+	SampleCalls.clear();
+	for(unsigned int i = 0; i < SampleStack.size(); i++)
+	{
+		if(LastSample[SampleStack[i]] != Samples)
+		{
+			LastSample[SampleStack[i]] = Samples;
+			Inclusive[SampleStack[i]] += Weight;
+		}
+		if(i + 1 == SampleStack.size())
+			break;
+
+		CallKey Key(SampleStack[i], FileID(*CallStack[i].psFile), CallStack[i].Line, SampleStack[i+1]);
+		if(find(SampleCalls.begin(), SampleCalls.end(), Key) != SampleCalls.end())
+			continue;
+		SampleCalls.push_back(Key);
+		Calls[Key].second += Weight;
+	}
+}
+
+void Profiler::Call(const Frame &Caller, const Frame &Callee)
+{
+	unsigned int CalleeID = FunctionID(*Callee.psFunction);
+	if(Entries[CalleeID].first == (unsigned int)-1)
+	{
+		Entries[CalleeID].first = FileID(*Callee.psFile);
+		Entries[CalleeID].second = Callee.Line;
+	}
+	Calls[CallKey(FunctionID(*Caller.psFunction), FileID(*Caller.psFile), Caller.Line, CalleeID)].first++;
+}
+
+//Orders function IDs by inclusive cycles, most first
+struct InclusiveOrder
+{
+	const vector<uint64> &Inclusive;
+	InclusiveOrder(const vector<uint64> &inclusive) : Inclusive(inclusive)	{}
+	bool operator()(unsigned int A, unsigned int B) const
+		{	return Inclusive[A] != Inclusive[B] ? Inclusive[A] > Inclusive[B] : A < B;	}
+};
+
+//Orders lines by cycles, most first
+static bool HotterLine(const pair< uint64, triple<unsigned int, unsigned int, unsigned int> > &A, const pair< uint64, triple<unsigned int, unsigned int, unsigned int> > &B)
+{
+	return A.first > B.first;
+}
+
+bool Profiler::WriteSummary(ostream &Output, unsigned int Count) const
+{
+	char sPercent[16];
+
+	Output << "Profiled " << Cycles << " cycles in " << Samples << " samples, one every " << Interval << " cycles.\n";
+	if(!Cycles)
+		return !Output.fail();
+
+	//Calls to each function
+	vector<uint64> CallCounts(Functions.size(), 0);
+	for(map<CallKey, pair<uint64, uint64> >::const_iterator CallIter = Calls.begin(); CallIter != Calls.end(); CallIter++)
+		CallCounts[CallIter->first.fourth] += CallIter->second.first;
+
+	vector<unsigned int> Order;
+	for(unsigned int i = 0; i < Functions.size(); i++)
+		Order.push_back(i);
+	stable_sort(Order.begin(), Order.end(), InclusiveOrder(Inclusive));
+	if(Order.size() > Count)
+		Order.resize(Count);
+
+	Output << "\nFunctions:\n";
+	Output << "   " << setw(12) << "Inclusive" << "       %" << setw(12) << "Exclusive" << "       %" << setw(10) << "Calls" << "  Function\n";
+	for(unsigned int i = 0; i < Order.size(); i++)
+	{
+		unsigned int ID = Order[i];
+		Output << "   " << setw(12) << Inclusive[ID];
+		sprintf(sPercent, "%8.2f", 100.0 * (double)(int64)Inclusive[ID] / (double)(int64)Cycles);
+		Output << sPercent << setw(12) << Exclusive[ID];
+		sprintf(sPercent, "%8.2f", 100.0 * (double)(int64)Exclusive[ID] / (double)(int64)Cycles);
+		Output << sPercent << setw(10) << CallCounts[ID] << "  " << Functions[ID];
+		if(Entries[ID].first != (unsigned int)-1)
+			Output << "  " << Files[Entries[ID].first] << "(" << Entries[ID].second << ")";
+		Output << "\n";
+	}
+
+	vector< pair<uint64, LineKey> > HotLines;
+	for(map<LineKey, uint64>::const_iterator LineIter = Lines.begin(); LineIter != Lines.end(); LineIter++)
+		HotLines.push_back(pair<uint64, LineKey>(LineIter->second, LineIter->first));
+	stable_sort(HotLines.begin(), HotLines.end(), HotterLine);
+	if(HotLines.size() > Count)
+		HotLines.resize(Count);
+
+	Output << "\nLines:\n";
+	Output << "   " << setw(12) << "Exclusive" << "       %" << "  Location\n";
+	for(unsigned int i = 0; i < HotLines.size(); i++)
+	{
+		const LineKey &Key = HotLines[i].second;
+		Output << "   " << setw(12) << HotLines[i].first;
+		sprintf(sPercent, "%8.2f", 100.0 * (double)(int64)HotLines[i].first / (double)(int64)Cycles);
+		Output << sPercent << "  " << Files[Key.second] << "(" << Key.third << "): " << Functions[Key.first] << "\n";
+	}
+
+	return !Output.fail();
+}
+
+bool Profiler::WriteFolded(ostream &Output) const
+{
+	for(map<vector<unsigned int>, uint64>::const_iterator StackIter = Stacks.begin(); StackIter != Stacks.end(); StackIter++)
+	{
+		for(unsigned int i = 0; i < StackIter->first.size(); i++)
+			Output << (i ? ";" : "") << Functions[StackIter->first[i]];
+		Output << " " << StackIter->second << "\n";
+	}
+
+	return !Output.fail();
+}
+
+bool Profiler::WriteCallgrind(ostream &Output) const
+{
+	Output << "# callgrind format\n";
+	Output << "version: 1\n";
+	Output << "creator: LC3Tools\n";
+	Output << "positions: line\n";
+	Output << "events: Cycles\n";
+	Output << "summary: " << Cycles << "\n";
+
+	//Lines and calls are both sorted by function first
+	map<LineKey, uint64>::const_iterator LineIter = Lines.begin();
+	map<CallKey, pair<uint64, uint64> >::const_iterator CallIter = Calls.begin();
+	for(unsigned int Function = 0; Function < Functions.size(); Function++)
+	{
+		unsigned int File = FunctionFile(Function);
+		Output << "\nfl=" << (File == (unsigned int)-1 ? "???" : Files[File]) << "\n";
+		Output << "fn=" << Functions[Function] << "\n";
+
+		for( ; LineIter != Lines.end() && LineIter->first.first == Function; LineIter++)
+		{
+			if(LineIter->first.second != File)
+			{
+				File = LineIter->first.second;
+				Output << "fi=" << Files[File] << "\n";
+			}
+			Output << LineIter->first.third << " " << LineIter->second << "\n";
+		}
+
+		for( ; CallIter != Calls.end() && CallIter->first.first == Function; CallIter++)
+		{
+			if(CallIter->first.second != File)
+			{
+				File = CallIter->first.second;
+				Output << "fi=" << Files[File] << "\n";
+			}
+			unsigned int Callee = CallIter->first.fourth, CalleeFile = FunctionFile(Callee);
+			Output << "cfi=" << (CalleeFile == (unsigned int)-1 ? "???" : Files[CalleeFile]) << "\n";
+			Output << "cfn=" << Functions[Callee] << "\n";
+			Output << "calls=" << CallIter->second.first << " " << Entries[Callee].second << "\n";
+			Output << CallIter->first.third << " " << CallIter->second.second << "\n";
+		}
+	}
+
+	return !Output.fail();
+}
+
+}	//namespace Simulator
@@ -0,0 +1,152 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#pragma warning (disable:4786)
+#include <map>
+#include <vector>
+#include <string>
+#include <iostream>
+#include "../Assembler/Base.h"
+
+using namespace std;
+using namespace JMT;
+
+namespace Simulator
+{
+	//Cycles between samples unless told otherwise
+	const unsigned int DEFAULT_PROFILE_INTERVAL = 1000;
+
+	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
+		Profiler
+
+		A sampling profiler for the simulator's call-stack. Every Interval
+		cycles the simulator passes the call-stack to Sample, and the cycles
+		since the last sample are charged to the source line at the top of
+		the stack (exclusive), to every function on the stack (inclusive),
+		and to every call edge on the stack. The simulator also reports each
+		subroutine call with Call, so the call counts are exact.
+
+		A function is named by the label at its first instruction. Functions
+		without a label are all charged to "(unlabeled)".
+
+		The results can be written as folded stacks, which flamegraph.pl
+		reads, or in the callgrind format, which KCachegrind and
+		callgrind_annotate read.
+	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
+	class Profiler
+	{
+	public:
+		//One call-stack frame: the function, and the location executing in it.
+		//For callers this is the call site.
+		struct Frame
+		{
+			const string *psFunction;
+			const string *psFile;
+			unsigned int Line;
+		};
+
+		//true if the simulator should sample
+		bool fOn;
+		//Cycles between samples
+		uint64 Interval;
+
+	protected:
+		//Cycle of the last sample
+		uint64 LastCycle;
+		//Number of samples and total cycles charged
+		uint64 Samples, Cycles;
+
+		//Interned function and file names
+		vector<string> Functions, Files;
+		map<string, unsigned int> FunctionIDs, FileIDs;
+		//Per function: file and line of the first instruction, if a call
+		//to it was seen, and exclusive and inclusive cycles
+		vector< pair<unsigned int, unsigned int> > Entries;
+		vector<uint64> Exclusive, Inclusive;
+		//Per function: the last sample it was charged inclusive cycles in
+		vector<uint64> LastSample;
+
+		//Cycles for each stack of function IDs, from the root
+		map<vector<unsigned int>, uint64> Stacks;
+		//Exclusive cycles for each <function, file, line>
+		typedef triple<unsigned int, unsigned int, unsigned int> LineKey;
+		map<LineKey, uint64> Lines;
+		//Call count and inclusive cycles for each <caller, call site file, call site line, callee>
+		typedef tetra<unsigned int, unsigned int, unsigned int, unsigned int> CallKey;
+		map<CallKey, pair<uint64, uint64> > Calls;
+
+		//Stack of the current sample, kept to avoid reallocating it
+		vector<unsigned int> SampleStack;
+		vector<CallKey> SampleCalls;
+
+		unsigned int FunctionID(const string &);
+		unsigned int FileID(const string &);
+		//File of the function's first instruction, or of the first place it was seen
+		unsigned int FunctionFile(unsigned int) const;
+
+	public:
+		Profiler();
+
+		/**********************************************************************\
+			Start( [in] cycles between samples, [in] current cycle )
+
+			Clears the profile and starts sampling.
+		\******/
+		void Start(uint64, uint64);
+		void Stop()	{	fOn = false;	}
+		void Clear(uint64 Cycle = 0);
+
+		/**********************************************************************\
+			CyclesToSample( [in] current cycle )
+
+			Returns the number of cycles until the next sample is due. If the
+			simulation has gone back in time, the next sample is rescheduled.
+		\******/
+		uint64 CyclesToSample(uint64 Cycle)
+		{
+			if(Cycle < LastCycle)
+				LastCycle = Cycle;
+			return LastCycle + Interval - Cycle;
+		}
+		bool Due(uint64 Cycle) const	{	return Cycle >= LastCycle + Interval;	}
+
+		/**********************************************************************\
+			Sample( [in] call-stack frames from the root, [in] current cycle )
+
+			Charges the cycles since the last sample.
+		\******/
+		void Sample(const vector<Frame> &, uint64);
+
+		/**********************************************************************\
+			Call( [in] caller frame, [in] callee frame )
+
+			Counts a call. The caller frame is at the call site, and the callee
+			frame is at the callee's first instruction.
+		\******/
+		void Call(const Frame &, const Frame &);
+
+		/**********************************************************************\
+			WriteSummary( [in-out] stream, [in] count )
+
+			Writes the given number of functions with the most inclusive
+			cycles, and of lines with the most exclusive cycles.
+		\******/
+		bool WriteSummary(ostream &, unsigned int) const;
+
+		/**********************************************************************\
+			WriteFolded( [in-out] stream )
+			WriteCallgrind( [in-out] stream )
+
+			Writes the profile as folded stacks, one "root;...;leaf cycles"
+			line per stack, or in the callgrind format.
+		\******/
+		bool WriteFolded(ostream &) const;
+		bool WriteCallgrind(ostream &) const;
+	};
+}
+
+#endif
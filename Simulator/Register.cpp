@@ -5,7 +5,6 @@
 #include "Register.h"
 #include <cmath>
 #include <cstdio>
-#include <strstream>
 #include "../Assembler/Number.h"
 
 using namespace std;
@@ -21,6 +20,7 @@ Register::Register(const string &sname, unsigned char bits, uint64 value)
 	sName = sname;
 	Bits = bits;
 	fFloat = false;
+	ID = NO_ID;
 	//*NOTE: GODAWFUL GCC BUG! See Number.cpp for more details...
 	Value = value & (Bits == 64 ? ~(uint64)0:(((uint64)1 << Bits) - 1));
 }
@@ -34,6 +34,7 @@ Register::Register(const string &sname, unsigned char exponentbits, unsigned cha
 	if(Bits > 64)
 		throw "Register cannot have more than 64 bits!";
 	fFloat = true;
+	ID = NO_ID;
 	//*NOTE: GODAWFUL GCC BUG! See Number.cpp for more details...
 	Value = value & (Bits == 64 ? ~(uint64)0:(((uint64)1 << Bits) - 1));
 }
@@ -121,9 +122,8 @@ Register::operator uint64() const
 	return Value & (Bits == 64 ? ~(uint64)0:(((uint64)1 << Bits) - 1));
 }
 
-Register::operator const char *() const
+char *Register::Print(char *sRegister) const
 {
-	static char sRegister[128];
 	if(fFloat)
 	{
 		RealNumber Real(NullLocationStack, ExponentBits, MantissaBits, Value);
@@ -246,22 +246,17 @@ const Register &RegisterSet::operator[](const string &sRegName) const
 	throw "RegisterSet requested register does not exist!";
 }
 
-RegisterSet::operator const char *() const
+void RegisterSet::Print(string &sRegisterSet) const
 {
-	static string sRegisterSet;
-	ostrstream strRegisterSet;
+	char sRegister[REGISTER_PRINT_CHARS];
 
-	strRegisterSet << sName.c_str() << "\t";
+	(sRegisterSet += sName) += "\t";
 	for(RegisterMap::const_iterator RegIter = Registers.begin(); RegIter != Registers.end(); RegIter++)
 	{
 		if(RegIter != Registers.begin())
-			strRegisterSet << ",\t";
-		strRegisterSet << RegIter->second.sName.c_str() << ": " << (const char *)RegIter->second;
+			sRegisterSet += ",\t";
+		((sRegisterSet += RegIter->second.sName) += ": ") += RegIter->second.Print(sRegister);
 	}
-
-	strRegisterSet << ends;
-	sRegisterSet = strRegisterSet.str();
-	return sRegisterSet.c_str();
 }
 
 istream &operator >>(istream &Input, RegisterSet &TheRegSet)
@@ -16,6 +16,9 @@ using namespace JMT;
 
 namespace Simulator
 {
+	//Characters needed to print a register, including the terminator
+	const unsigned int REGISTER_PRINT_CHARS = 128;
+
 	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
 		Register
 
@@ -32,6 +35,11 @@ namespace Simulator
 		unsigned char Bits, ExponentBits, MantissaBits;
 		//true if this is a floating point register, false if integral
 		bool fFloat;
+		//ID of a register which has not been numbered
+		static const unsigned int NO_ID = 0xFFFFFFFF;
+		//Unique index of the register within its architecture, assigned by
+		//Architecture::NumberRegisters. NO_ID until then.
+		unsigned int ID;
 
 		//Construct (name, #bits, intial value)
 		Register(const string &, unsigned char, uint64 Value = 0);
@@ -63,8 +71,9 @@ namespace Simulator
 		Register &SetBit(unsigned char, unsigned char);
 		//Convert the register to a value
 		operator uint64() const;
-		//Print the contents of the register
-		operator const char *() const;
+		//Print the contents of the register to the buffer, which must hold
+		//REGISTER_PRINT_CHARS. Returns the buffer.
+		char *Print(char *) const;
 		//saving and loading snapshots
 		friend istream &operator >>(istream &, Register &);
 		friend ostream &operator <<(ostream &, const Register &);
@@ -96,8 +105,8 @@ namespace Simulator
 		const Register &operator[](unsigned int) const;
 		Register &operator[](const string &);
 		const Register &operator[](const string &) const;
-		//Print the contents of the registerset
-		operator const char *() const;
+		//Append the contents of the registerset to the string
+		void Print(string &) const;
 		//saving and loading snapshots
 		friend istream &operator >>(istream &, RegisterSet &);
 		friend ostream &operator <<(ostream &, const RegisterSet &);
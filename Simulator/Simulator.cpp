@@ -4,7 +4,6 @@
 
 #pragma warning (disable:4503)
 #include "Simulator.h"
-#include <signal.h>
 #include <strstream>
 #include <cstdio>
 #include <cmath>
@@ -17,11 +16,9 @@ using namespace Assembler;
 
 namespace Simulator	{
 
-template<class ISA>
-uint64 ArchSim<ISA>::fControlC = 0;
-
-template<class ISA>
-uint64 ArchSim<ISA>::NextSimID = 1;
+//File name of a location outside of the programs. It is a string, so that
+//choosing between it and an input file name does not copy the file name.
+static const string sNoFile("NoFile");
 
 //const char *const sEventTypes[ValueEvent+1] = {"NOEVENT", "READEVENT", "WRITEEVENT", "", "CHANGEEVENT", "", "", "", "VALUEEVENT"};
 
@@ -34,11 +31,6 @@ ArchSim<ISA>::ArchSim(CallBackFunction, SimCallBackFunction, SimCommandFunction,
 	this->SimReadConsole = SimReadConsole;
 	this->SimWriteConsole = SimWriteConsole;
 
-	if(!NextSimID)
-		throw "Only 64 simulator instances supported!";
-	SimulatorID = NextSimID;
-	NextSimID <<= 1;
-
 	pArch = NULL;
 	pPrograms = NULL;
 	pMemoryImage = NULL;
@@ -58,17 +50,16 @@ bool ArchSim<ISA>::NullCallBack(MessageEnum MessageType, const string &sMessage,
 }
 
 template<class ISA>
-void ArchSim<ISA>::ControlC(int Sig)
+bool ArchSim<ISA>::Run()
 {
-	fControlC = -1;
-	//*NOTE: reassigning the signal handler appears to be a
-	//one-use only event
-	signal(SIGINT, ControlC);
+	return RunBatch(1);
 }
 
 template<class ISA>
-bool ArchSim<ISA>::Run()
+bool ArchSim<ISA>::RunBatch(uint64 MaxCycles)
 {
+	bool fRetVal = true;
+
 	if(!pArch || !pPrograms || !pMemoryImage)
 		throw "Run executed on uninitialized architecture!";
 
@@ -76,33 +67,71 @@ bool ArchSim<ISA>::Run()
 	if(fBreak)
 		return true;
 
-	OldSig = signal(SIGINT, ControlC);
-	if(!pArch->Run())
+	Pause.Arm();
+	uint64 Cycles;
+	for(uint64 i = 0; i < MaxCycles && !fBreak; i += Cycles)
 	{
-		signal(SIGINT, OldSig);
-		return false;
+		//Never let the architecture run past the cycle limit
+		uint64 Limit = MaxCycles - i;
+		if(BreakCycle > SimCycle && BreakCycle - SimCycle < Limit)
+			Limit = BreakCycle - SimCycle;
+		//Stop at the next profile sample
+		if(Profile.fOn)
+		{
+			uint64 ToSample = Profile.CyclesToSample(SimCycle);
+			if(ToSample < Limit)
+				Limit = ToSample;
+		}
+
+		if(UndoJournal.fOn)
+		{
+			//Every cycle is journaled on its own, so that it can be undone on its own
+			Limit = 1;
+			UndoJournal.BeginCycle(SimCycle, SimInstruction);
+		}
+
+		bool fRan = pArch->RunCycles(Limit, Cycles);
+		if(UndoJournal.fOn)
+		{
+			//Free the frames of returns which fell off the journal
+			for(unsigned int Returns = UndoJournal.EndCycle(); Returns > 0; Returns--)
+				FreeCallFrames.splice(FreeCallFrames.begin(), JournalCallFrames, JournalCallFrames.begin());
+		}
+		if(!fRan)
+		{
+			fRetVal = false;
+			break;
+		}
+
+		//Cache and branch misprediction stalls lengthen the cycles, so they
+		//can pass the cycle limit
+		uint64 StartCycle = SimCycle;
+		SimCycle += Cycles + pArch->Caches.TakeStalls() + pArch->Branches.TakeStalls();
+		if(pArch->Counters.fOn)
+			pArch->Counters.Cycles += SimCycle - StartCycle;
+		if(Profile.fOn && Profile.Due(SimCycle))
+			ProfileSample();
+		if(SimCycle == BreakCycle || (BreakCycle > StartCycle && BreakCycle < SimCycle))
+		{
+			SimCallBack(Breakpoint, "Cycle limit.");
+			fBreak = true;
+		}
+
+		if(Pause.Take())
+		{
+			SimCallBack(Breakpoint, "Forced Break.");
+			fBreak = true;
+		}
 	}
-	signal(SIGINT, OldSig);
+	Pause.Disarm();
+
+	//The current location is only needed once the batch is over
 	uint64 Address = pArch->NextInstruction();
 	Element *pElement = AddressToElement(Address, false, false);
-	CallStack.rbegin()->first = pElement ? InputList[pElement->LocationStack.rbegin()->first] : "NoFile";
+	CallStack.rbegin()->first = pElement ? TheContext.InputList[pElement->LocationStack.rbegin()->first] : sNoFile;
 	CallStack.rbegin()->second = pElement ? pElement->LocationStack.rbegin()->second : 0;
 	CallStack.rbegin()->third = Address;
 
-	SimCycle++;
-	if(SimCycle == BreakCycle)
-	{
-		SimCallBack(Breakpoint, "Cycle limit.");
-		fBreak = true;
-	}
-
-	if(fControlC & SimulatorID)
-	{
-		SimCallBack(Breakpoint, "Forced Break.");
-		fControlC &= ~SimulatorID;
-		fBreak = true;
-	}
-
 	if(fBreak)
 	{
 		fFirstBreak = true;
@@ -112,13 +141,16 @@ bool ArchSim<ISA>::Run()
 		fOverBreakpoint = false;
 		BreakCycle = SimCycle;
 		BreakInstruction = SimInstruction;
+		//The trace file is complete up to the break, so it can be looked at
+		if(BinaryTraceFile.IsOpen())
+			BinaryTraceFile.Flush();
 	}
 
-	return true;
+	return fRetVal;
 }
 
 template<class ISA>
-bool ArchSim<ISA>::CommandRun(Architecture &Arch, vector<Program *> &Programs, RamVector &MemoryImage)
+bool ArchSim<ISA>::CommandRun(Architecture &Arch, vector<Program *> &Programs, RamImage &MemoryImage)
 {
 	fDone = false;
 	fTrace = false;
@@ -133,9 +165,11 @@ bool ArchSim<ISA>::CommandRun(Architecture &Arch, vector<Program *> &Programs, R
 			//Command errors are user errors, so we don't quit when it returns false
 			Command();
 		else
-			Run();
+			RunBatch((uint64)-1);
 	}
 
+	//Finish writing any trace which is still on
+	TraceOff();
 	return true;
 }
 
@@ -310,7 +344,7 @@ bool ArchSim<ISA>::ParseCommand(list<Token *>::iterator &StartIter, const list<T
 	{
 		StartIter++;
 
-		if(!Reset(*pArch, *pPrograms, *pMemoryImage))
+		if(!Reset())
 			goto CleanUp;
 	}
 	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_traceon")
@@ -326,6 +360,13 @@ bool ArchSim<ISA>::ParseCommand(list<Token *>::iterator &StartIter, const list<T
 		string sFileName = ((StringToken *)(*StartIter))->sString;
 		StartIter++;
 
+		bool fBinary = false;
+		if(StartIter != EndIter && (*StartIter)->TokenType == TIdentifier && ((IDToken *)(*StartIter))->sIdentifier == "binary")
+		{
+			fBinary = true;
+			StartIter++;
+		}
+
 		list<string> TraceRegSets;
 
 		while(StartIter != EndIter && (*StartIter)->TokenType == TIdentifier)
@@ -334,7 +375,7 @@ bool ArchSim<ISA>::ParseCommand(list<Token *>::iterator &StartIter, const list<T
 			StartIter++;
 		}
 
-		if(!TraceOn(sFileName, TraceRegSets))
+		if(!TraceOn(sFileName, TraceRegSets, fBinary))
 			goto CleanUp;
 	}
 	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_traceoff")
@@ -358,208 +399,558 @@ bool ArchSim<ISA>::ParseCommand(list<Token *>::iterator &StartIter, const list<T
 		if(!CheckOff())
 			goto CleanUp;
 	}
-	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_saves")
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_journalon")
 	{
 		StartIter++;
-		
-		//Get the filename
-		if(StartIter == EndIter || (*StartIter)->TokenType != TString)
-		{
-			SimCallBack(Error, "Save state command missing filename.");
-			goto CleanUp;
-		}
-		string sFileName = ((StringToken *)(*StartIter))->sString;
-		StartIter++;
 
-		if(!SaveState(sFileName))
+		//See if the optional journal size is given
+		pNumber = TheParser.ParseNumber(TokenIter, StartIter, EndIter, false, false);
+		if(!JournalOn(pNumber))
 			goto CleanUp;
 	}
-	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_loads")
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_journaloff")
 	{
 		StartIter++;
-		
-		//Get the filename
-		if(StartIter == EndIter || (*StartIter)->TokenType != TString)
-		{
-			SimCallBack(Error, "Load state command missing filename.");
-			goto CleanUp;
-		}
-		string sFileName = ((StringToken *)(*StartIter))->sString;
-		StartIter++;
 
-		if(!LoadState(sFileName))
-		{
-			SimCallBack(Error, "Simulator state undefined, forcing reset...");
-			Reset(*pArch, *pPrograms, *pMemoryImage);
+		if(!JournalOff())
 			goto CleanUp;
-		}
 	}
-	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_saved")
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_statson")
 	{
 		StartIter++;
-		
-		if(StartIter == EndIter || (*StartIter)->TokenType != TString)
-		{
-			SimCallBack(Error, "Save data command missing filename.");
-			goto CleanUp;
-		}
-		string sFileName = ((StringToken *)(*StartIter))->sString;
-		StartIter++;
 
-		//Get the data address
-		if(!(pNumber = ParseValue(StartIter, EndIter, "Save data command address", ProgramNumber)))
+		if(!StatsOn())
 			goto CleanUp;
+	}
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_statsoff")
+	{
+		StartIter++;
 
-		//Get the data length
-		if(!(pNumber2 = ParseValue(StartIter, EndIter, "Save data command length", ProgramNumber)))
+		if(!StatsOff())
 			goto CleanUp;
+	}
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_stats")
+	{
+		StartIter++;
 
-		//Get the optional data type
-		//Check for negative sign
-		bool fOpposite = false;
-		if(StartIter != EndIter && (*StartIter)->TokenType == TOperator && ((OpToken *)(*StartIter))->Operator == OpMinus)
-		{
-			fOpposite = true;
-			StartIter++;
-		}
-		if(StartIter != EndIter && (*StartIter)->TokenType == (TokenEnum)TData && ((DataToken *)(*StartIter))->DataType != STRUCT)
+		if(StartIter != EndIter && (*StartIter)->TokenType == TString)
 		{
-			DataType = ((DataToken *)(*StartIter))->DataType;
+			//Save the statistics to a file
+			string sFileName = ((StringToken *)(*StartIter))->sString;
 			StartIter++;
+
+			//Get the optional format
+			string sFormat;
+			if(StartIter != EndIter && (*StartIter)->TokenType == TIdentifier)
+			{
+				sFormat = ((IDToken *)(*StartIter))->sIdentifier;
+				StartIter++;
+			}
+
+			if(!SaveStats(sFileName, sFormat))
+				goto CleanUp;
 		}
 		else
 		{
-			if(fOpposite)
-				//This will cause an error to be printed
-				StartIter--;
+			//Get the optional number of instructions to display
+			Temp1 = 10;
+			if(pNumber = TheParser.ParseNumber(TokenIter, StartIter, EndIter, false, false))
+			{
+				if(!pNumber->Int(8*sizeof(unsigned int), false, TempInt64, CallBack, " for instruction count", true))
+					goto CleanUp;
+				Temp1 = (unsigned int)TempInt64;
+			}
 
-			DataType = STRUCT;
+			if(!DisplayStats(Temp1))
+				goto CleanUp;
 		}
-
-		if(!SaveData(sFileName, pNumber, pNumber2, DataType, fOpposite))
-			goto CleanUp;
 	}
-	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_loadd")
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_profileon")
 	{
 		StartIter++;
-		
-		if(StartIter == EndIter || (*StartIter)->TokenType != TString)
-		{
-			SimCallBack(Error, "Load data command missing filename.");
-			goto CleanUp;
-		}
-		string sFileName = ((StringToken *)(*StartIter))->sString;
-		StartIter++;
 
-		//Get the data address
-		if(!(pNumber = ParseValue(StartIter, EndIter, "Load data command address", ProgramNumber)))
+		//See if the optional sample interval is given
+		pNumber = TheParser.ParseNumber(TokenIter, StartIter, EndIter, false, false);
+		if(!ProfileOn(pNumber))
 			goto CleanUp;
+	}
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_profileoff")
+	{
+		StartIter++;
 
-		//Get the data length
-		if(!(pNumber2 = ParseValue(StartIter, EndIter, "Load data command length", ProgramNumber)))
+		if(!ProfileOff())
 			goto CleanUp;
+	}
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_profile")
+	{
+		StartIter++;
 
-		//Get the optional data type
-		//Check for negative sign
-		bool fOpposite = false;
-		if(StartIter != EndIter && (*StartIter)->TokenType == TOperator && ((OpToken *)(*StartIter))->Operator == OpMinus)
-		{
-			fOpposite = true;
-			StartIter++;
-		}
-		if(StartIter != EndIter && (*StartIter)->TokenType == (TokenEnum)TData && ((DataToken *)(*StartIter))->DataType != STRUCT)
+		if(StartIter != EndIter && (*StartIter)->TokenType == TString)
 		{
-			DataType = ((DataToken *)(*StartIter))->DataType;
+			//Save the profile to a file
+			string sFileName = ((StringToken *)(*StartIter))->sString;
 			StartIter++;
+
+			//Get the optional format
+			string sFormat;
+			if(StartIter != EndIter && (*StartIter)->TokenType == TIdentifier)
+			{
+				sFormat = ((IDToken *)(*StartIter))->sIdentifier;
+				StartIter++;
+			}
+
+			if(!SaveProfile(sFileName, sFormat))
+				goto CleanUp;
 		}
 		else
 		{
-			if(fOpposite)
-				//This will cause an error to be printed
-				StartIter--;
+			//Get the optional number of functions and lines to display
+			Temp1 = 10;
+			if(pNumber = TheParser.ParseNumber(TokenIter, StartIter, EndIter, false, false))
+			{
+				if(!pNumber->Int(8*sizeof(unsigned int), false, TempInt64, CallBack, " for function count", true))
+					goto CleanUp;
+				Temp1 = (unsigned int)TempInt64;
+			}
 
-			DataType = STRUCT;
+			if(!DisplayProfile(Temp1))
+				goto CleanUp;
 		}
-
-		if(!LoadData(sFileName, pNumber, pNumber2, DataType, fOpposite))
-			goto CleanUp;
 	}
-	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_saveo")
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_cacheon")
 	{
 		StartIter++;
-		
-		if(StartIter == EndIter || (*StartIter)->TokenType != TString)
-		{
-			SimCallBack(Error, "Save object command missing filename.");
-			goto CleanUp;
-		}
-		string sFileName = ((StringToken *)(*StartIter))->sString;
-		StartIter++;
-
-		//Get the data address
-		if(!(pNumber = ParseValue(StartIter, EndIter, "Save object command address", ProgramNumber)))
-			goto CleanUp;
-
-		//Get the data length
-		if(!(pNumber2 = ParseValue(StartIter, EndIter, "Save object command length", ProgramNumber)))
-			goto CleanUp;
 
-		if(!SaveObject(sFileName, pNumber, pNumber2))
+		if(!CacheOn())
 			goto CleanUp;
 	}
-	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_loado")
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_cacheoff")
 	{
 		StartIter++;
-		
-		if(StartIter == EndIter || (*StartIter)->TokenType != TString)
-		{
-			SimCallBack(Error, "Load data command missing filename.");
-			goto CleanUp;
-		}
-		string sFileName = ((StringToken *)(*StartIter))->sString;
-		StartIter++;
 
-		if(!LoadObject(sFileName))
+		if(!CacheOff())
 			goto CleanUp;
 	}
-	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_go")
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_cache")
 	{
 		StartIter++;
-		
-		//See if the optional run length is given
-		if(pNumber = TheParser.ParseNumber(TokenIter, StartIter, EndIter, false, false))
+
+		//Get the optional cache level
+		if(StartIter == EndIter || (*StartIter)->TokenType != TIdentifier)
 		{
-			if(!Go(pNumber))
+			if(!DisplayCache())
 				goto CleanUp;
 		}
 		else
 		{
-			if(!Go())
-				goto CleanUp;
+			string sLevel = ToLower(((IDToken *)(*StartIter))->sIdentifier);
+			StartIter++;
+
+			if(sLevel == "memory")
+			{
+				//Get the memory latency
+				if( !(pNumber = TheParser.ParseNumber(TokenIter, StartIter, EndIter, false, false)) )
+				{
+					SimCallBack(Error, "Cache memory command missing latency.");
+					goto CleanUp;
+				}
+				if(!pNumber->Int(8*sizeof(unsigned int), false, TempInt64, CallBack, " for memory latency", true))
+					goto CleanUp;
+
+				if(!SetMemoryLatency((unsigned int)TempInt64))
+					goto CleanUp;
+			}
+			else if(StartIter != EndIter && (*StartIter)->TokenType == TIdentifier && ToLower(((IDToken *)(*StartIter))->sIdentifier) == "off")
+			{
+				StartIter++;
+
+				if(sLevel != "l2")
+				{
+					SimCallBack(Error, "Only the L2 cache can be turned off.");
+					goto CleanUp;
+				}
+				if(!L2CacheOff())
+					goto CleanUp;
+			}
+			else
+			{
+				//Get the size, line size, and ways
+				uint64 Size;
+				if( !(pNumber = TheParser.ParseNumber(TokenIter, StartIter, EndIter, false, false)) )
+				{
+					SimCallBack(Error, "Cache command missing cache size.");
+					goto CleanUp;
+				}
+				if(!pNumber->Int(8*sizeof(unsigned int), false, Size, CallBack, " for cache size", true))
+					goto CleanUp;
+				delete pNumber;
+				pNumber = NULL;
+
+				if( !(pNumber = TheParser.ParseNumber(TokenIter, StartIter, EndIter, false, false)) )
+				{
+					SimCallBack(Error, "Cache command missing line size.");
+					goto CleanUp;
+				}
+				if(!pNumber->Int(8*sizeof(unsigned int), false, TempInt64, CallBack, " for cache line size", true))
+					goto CleanUp;
+				delete pNumber;
+				pNumber = NULL;
+				Temp1 = (unsigned int)TempInt64;
+
+				if( !(pNumber = TheParser.ParseNumber(TokenIter, StartIter, EndIter, false, false)) )
+				{
+					SimCallBack(Error, "Cache command missing ways.");
+					goto CleanUp;
+				}
+				if(!pNumber->Int(8*sizeof(unsigned int), false, TempInt64, CallBack, " for cache ways", true))
+					goto CleanUp;
+				delete pNumber;
+				pNumber = NULL;
+				Temp2 = (unsigned int)TempInt64;
+
+				//Get the optional replacement policy
+				string sReplacement;
+				if(StartIter != EndIter && (*StartIter)->TokenType == TIdentifier)
+				{
+					sReplacement = ((IDToken *)(*StartIter))->sIdentifier;
+					StartIter++;
+				}
+
+				//Get the optional latency
+				TempInt64 = (sLevel == "l2" ? DEFAULT_L2_LATENCY : 0);
+				if(pNumber = TheParser.ParseNumber(TokenIter, StartIter, EndIter, false, false))
+				{
+					if(!pNumber->Int(8*sizeof(unsigned int), false, TempInt64, CallBack, " for cache latency", true))
+						goto CleanUp;
+				}
+
+				if(!SetCache(sLevel, Size, Temp1, Temp2, sReplacement, (unsigned int)TempInt64))
+					goto CleanUp;
+			}
 		}
 	}
-	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_goi")
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_branchon")
 	{
 		StartIter++;
 
-		//See if the run length is given
-		if( !(pNumber = TheParser.ParseNumber(TokenIter, StartIter, EndIter, false, false)) )
-		{
-			SimCallBack(Error, "Go instruction missing instruction run length.");
-			goto CleanUp;
-		}
-
-		if(!GoI(pNumber))
+		if(!BranchOn())
 			goto CleanUp;
 	}
-	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_goin")
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_branchoff")
 	{
 		StartIter++;
 
-		if(!GoIn())
+		if(!BranchOff())
 			goto CleanUp;
 	}
-	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_goover")
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_branch")
+	{
+		StartIter++;
+
+		if(StartIter != EndIter && (*StartIter)->TokenType == TIdentifier)
+		{
+			string sSetting = ToLower(((IDToken *)(*StartIter))->sIdentifier);
+			StartIter++;
+
+			if(sSetting == "predictor")
+			{
+				//Get the predictor name
+				if(StartIter == EndIter || (*StartIter)->TokenType != TIdentifier)
+				{
+					SimCallBack(Error, "Branch predictor command missing predictor name.");
+					goto CleanUp;
+				}
+				string sPredictor = ((IDToken *)(*StartIter))->sIdentifier;
+				StartIter++;
+
+				//Get the optional index bits
+				TempInt64 = DEFAULT_PREDICTOR_BITS;
+				if(pNumber = TheParser.ParseNumber(TokenIter, StartIter, EndIter, false, false))
+				{
+					if(!pNumber->Int(8*sizeof(unsigned int), false, TempInt64, CallBack, " for predictor index bits", true))
+						goto CleanUp;
+					delete pNumber;
+					pNumber = NULL;
+				}
+
+				if(!SetPredictor(sPredictor, (unsigned int)TempInt64))
+					goto CleanUp;
+			}
+			else if(sSetting == "stack" || sSetting == "penalty")
+			{
+				if( !(pNumber = TheParser.ParseNumber(TokenIter, StartIter, EndIter, false, false)) )
+				{
+					SimCallBack(Error, sSetting == "stack" ? "Branch stack command missing depth." : "Branch penalty command missing cycles.");
+					goto CleanUp;
+				}
+				if(!pNumber->Int(8*sizeof(unsigned int), false, TempInt64, CallBack, sSetting == "stack" ? " for return stack depth" : " for branch penalty", true))
+					goto CleanUp;
+				delete pNumber;
+				pNumber = NULL;
+
+				if(sSetting == "stack" ? !SetReturnStack((unsigned int)TempInt64) : !SetBranchPenalty((unsigned int)TempInt64))
+					goto CleanUp;
+			}
+			else
+			{
+				SimCallBack(Error, "Branch command must be followed by PREDICTOR, STACK, PENALTY, or a branch count.");
+				goto CleanUp;
+			}
+		}
+		else
+		{
+			//Get the optional number of branches to display
+			Temp1 = 10;
+			if(pNumber = TheParser.ParseNumber(TokenIter, StartIter, EndIter, false, false))
+			{
+				if(!pNumber->Int(8*sizeof(unsigned int), false, TempInt64, CallBack, " for branch count", true))
+					goto CleanUp;
+				delete pNumber;
+				pNumber = NULL;
+				Temp1 = (unsigned int)TempInt64;
+			}
+
+			if(!DisplayBranches(Temp1))
+				goto CleanUp;
+		}
+	}
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_engine")
+	{
+		StartIter++;
+
+		//Get the optional engine name
+		if(StartIter == EndIter || (*StartIter)->TokenType != TIdentifier)
+		{
+			if(!DisplayEngines())
+				goto CleanUp;
+		}
+		else
+		{
+			string sEngine = ((IDToken *)(*StartIter))->sIdentifier;
+			StartIter++;
+
+			if(!SetEngine(sEngine))
+				goto CleanUp;
+		}
+	}
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_saves")
+	{
+		StartIter++;
+		
+		//Get the filename
+		if(StartIter == EndIter || (*StartIter)->TokenType != TString)
+		{
+			SimCallBack(Error, "Save state command missing filename.");
+			goto CleanUp;
+		}
+		string sFileName = ((StringToken *)(*StartIter))->sString;
+		StartIter++;
+
+		if(!SaveState(sFileName))
+			goto CleanUp;
+	}
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_savesi")
+	{
+		StartIter++;
+		
+		//Get the filename
+		if(StartIter == EndIter || (*StartIter)->TokenType != TString)
+		{
+			SimCallBack(Error, "Save incremental state command missing filename.");
+			goto CleanUp;
+		}
+		string sFileName = ((StringToken *)(*StartIter))->sString;
+		StartIter++;
+
+		if(!SaveState(sFileName, true))
+			goto CleanUp;
+	}
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_loads")
+	{
+		StartIter++;
+		
+		//Get the filename
+		if(StartIter == EndIter || (*StartIter)->TokenType != TString)
+		{
+			SimCallBack(Error, "Load state command missing filename.");
+			goto CleanUp;
+		}
+		string sFileName = ((StringToken *)(*StartIter))->sString;
+		StartIter++;
+
+		if(!LoadState(sFileName))
+		{
+			SimCallBack(Error, "Simulator state undefined, forcing reset...");
+			Reset(*pArch, *pPrograms, *pMemoryImage);
+			goto CleanUp;
+		}
+	}
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_saved")
+	{
+		StartIter++;
+		
+		if(StartIter == EndIter || (*StartIter)->TokenType != TString)
+		{
+			SimCallBack(Error, "Save data command missing filename.");
+			goto CleanUp;
+		}
+		string sFileName = ((StringToken *)(*StartIter))->sString;
+		StartIter++;
+
+		//Get the data address
+		if(!(pNumber = ParseValue(StartIter, EndIter, "Save data command address", ProgramNumber)))
+			goto CleanUp;
+
+		//Get the data length
+		if(!(pNumber2 = ParseValue(StartIter, EndIter, "Save data command length", ProgramNumber)))
+			goto CleanUp;
+
+		//Get the optional data type
+		//Check for negative sign
+		bool fOpposite = false;
+		if(StartIter != EndIter && (*StartIter)->TokenType == TOperator && ((OpToken *)(*StartIter))->Operator == OpMinus)
+		{
+			fOpposite = true;
+			StartIter++;
+		}
+		if(StartIter != EndIter && (*StartIter)->TokenType == (TokenEnum)TData && ((DataToken *)(*StartIter))->DataType != STRUCT)
+		{
+			DataType = ((DataToken *)(*StartIter))->DataType;
+			StartIter++;
+		}
+		else
+		{
+			if(fOpposite)
+				//This will cause an error to be printed
+				StartIter--;
+
+			DataType = STRUCT;
+		}
+
+		if(!SaveData(sFileName, pNumber, pNumber2, DataType, fOpposite))
+			goto CleanUp;
+	}
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_loadd")
+	{
+		StartIter++;
+		
+		if(StartIter == EndIter || (*StartIter)->TokenType != TString)
+		{
+			SimCallBack(Error, "Load data command missing filename.");
+			goto CleanUp;
+		}
+		string sFileName = ((StringToken *)(*StartIter))->sString;
+		StartIter++;
+
+		//Get the data address
+		if(!(pNumber = ParseValue(StartIter, EndIter, "Load data command address", ProgramNumber)))
+			goto CleanUp;
+
+		//Get the data length
+		if(!(pNumber2 = ParseValue(StartIter, EndIter, "Load data command length", ProgramNumber)))
+			goto CleanUp;
+
+		//Get the optional data type
+		//Check for negative sign
+		bool fOpposite = false;
+		if(StartIter != EndIter && (*StartIter)->TokenType == TOperator && ((OpToken *)(*StartIter))->Operator == OpMinus)
+		{
+			fOpposite = true;
+			StartIter++;
+		}
+		if(StartIter != EndIter && (*StartIter)->TokenType == (TokenEnum)TData && ((DataToken *)(*StartIter))->DataType != STRUCT)
+		{
+			DataType = ((DataToken *)(*StartIter))->DataType;
+			StartIter++;
+		}
+		else
+		{
+			if(fOpposite)
+				//This will cause an error to be printed
+				StartIter--;
+
+			DataType = STRUCT;
+		}
+
+		if(!LoadData(sFileName, pNumber, pNumber2, DataType, fOpposite))
+			goto CleanUp;
+	}
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_saveo")
+	{
+		StartIter++;
+		
+		if(StartIter == EndIter || (*StartIter)->TokenType != TString)
+		{
+			SimCallBack(Error, "Save object command missing filename.");
+			goto CleanUp;
+		}
+		string sFileName = ((StringToken *)(*StartIter))->sString;
+		StartIter++;
+
+		//Get the data address
+		if(!(pNumber = ParseValue(StartIter, EndIter, "Save object command address", ProgramNumber)))
+			goto CleanUp;
+
+		//Get the data length
+		if(!(pNumber2 = ParseValue(StartIter, EndIter, "Save object command length", ProgramNumber)))
+			goto CleanUp;
+
+		if(!SaveObject(sFileName, pNumber, pNumber2))
+			goto CleanUp;
+	}
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_loado")
+	{
+		StartIter++;
+		
+		if(StartIter == EndIter || (*StartIter)->TokenType != TString)
+		{
+			SimCallBack(Error, "Load data command missing filename.");
+			goto CleanUp;
+		}
+		string sFileName = ((StringToken *)(*StartIter))->sString;
+		StartIter++;
+
+		if(!LoadObject(sFileName))
+			goto CleanUp;
+	}
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_go")
+	{
+		StartIter++;
+		
+		//See if the optional run length is given
+		if(pNumber = TheParser.ParseNumber(TokenIter, StartIter, EndIter, false, false))
+		{
+			if(!Go(pNumber))
+				goto CleanUp;
+		}
+		else
+		{
+			if(!Go())
+				goto CleanUp;
+		}
+	}
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_goi")
+	{
+		StartIter++;
+
+		//See if the run length is given
+		if( !(pNumber = TheParser.ParseNumber(TokenIter, StartIter, EndIter, false, false)) )
+		{
+			SimCallBack(Error, "Go instruction missing instruction run length.");
+			goto CleanUp;
+		}
+
+		if(!GoI(pNumber))
+			goto CleanUp;
+	}
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_goin")
+	{
+		StartIter++;
+
+		if(!GoIn())
+			goto CleanUp;
+	}
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_goover")
 	{
 		StartIter++;
 
@@ -608,6 +999,29 @@ bool ArchSim<ISA>::ParseCommand(list<Token *>::iterator &StartIter, const list<T
 		if(!GotoI(pNumber, ProgramNumber))
 			goto CleanUp;
 	}
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_stepback")
+	{
+		StartIter++;
+
+		if(!StepBack())
+			goto CleanUp;
+	}
+	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_goback")
+	{
+		StartIter++;
+		
+		//See if the optional cycle count is given
+		if(pNumber = TheParser.ParseNumber(TokenIter, StartIter, EndIter, false, false))
+		{
+			if(!GoBack(pNumber))
+				goto CleanUp;
+		}
+		else
+		{
+			if(!GoBack())
+				goto CleanUp;
+		}
+	}
 	else if(((IDToken *)(*StartIter))->sIdentifier == "sim_bpl")
 	{
 		StartIter++;
@@ -1211,7 +1625,7 @@ bool ArchSim<ISA>::ParseCommand(list<Token *>::iterator &StartIter, const list<T
 		if(!(pNumber = LineToAddress(fNumberSpecified, ProgramNumber, LineNumber, "Write line command address")))
 			goto CleanUp;
 
-		RamVector MemoryImage;
+		RamImage MemoryImage;
 		//Get the data elements
 		if(!ParseElements(StartIter, EndIter, "Write line command address", ProgramNumber, MemoryImage, pNumber))
 			goto CleanUp;
@@ -1229,7 +1643,7 @@ bool ArchSim<ISA>::ParseCommand(list<Token *>::iterator &StartIter, const list<T
 	{
 		StartIter++;
 
-		RamVector MemoryImage;
+		RamImage MemoryImage;
 		//Get the data elements
 		if(!ParseElements(StartIter, EndIter, "Write data command address", ProgramNumber, MemoryImage))
 			goto CleanUp;
@@ -1266,7 +1680,7 @@ bool ArchSim<ISA>::ParseCommand(list<Token *>::iterator &StartIter, const list<T
 			goto CleanUp;
 		}
 
-		RamVector MemoryImage;
+		RamImage MemoryImage;
 		//Get the memory elements
 		if(!ParseElements(StartIter, EndIter, "Write memory command address", ProgramNumber, MemoryImage))
 			goto CleanUp;
@@ -1579,7 +1993,7 @@ CleanUp:
 }
 
 template<class ISA>
-bool ArchSim<ISA>::ParseElements(list<Token *>::iterator &StartIter, const list<Token *>::iterator &EndIter, const string &sExtra, unsigned int &ProgramNumber, RamVector &MemoryImage, Number *pNumber)
+bool ArchSim<ISA>::ParseElements(list<Token *>::iterator &StartIter, const list<Token *>::iterator &EndIter, const string &sExtra, unsigned int &ProgramNumber, RamImage &MemoryImage, Number *pNumber)
 {
 	bool fRetVal = true;
 	Program TempProg(NullLocationStack, "", ISA::Addressability);
@@ -1644,7 +2058,8 @@ Number *ArchSim<ISA>::LineToAddress(bool fNumberSpecified, unsigned int &Program
 {
 	if(fNumberSpecified)
 	{
-		if(ProgramNumber >= pPrograms->size())
+		//Program numbers past the programs are include files
+		if(ProgramNumber >= LineIndex.size())
 		{
 			sprintf(sMessageBuffer, "%.63s program number (%u) is invalid.", sExtra.c_str(), ProgramNumber);
 			SimCallBack(Error, sMessageBuffer);
@@ -1661,54 +2076,32 @@ Number *ArchSim<ISA>::LineToAddress(bool fNumberSpecified, unsigned int &Program
 		}
 	}
 
-	Program &TheProg = *(*pPrograms)[ProgramNumber];
-	Number *pNumber;
-
-	//Go through the segments to find the segment which contains the requested line number
-	list<Segment *>::iterator SegmentIter = TheProg.Segments.begin();
-	if(SegmentIter != TheProg.Segments.end())
+	//Find the first element on or after the requested line
+	LineMap &Lines = LineIndex[ProgramNumber];
+	STDTYPENAME LineMap::iterator LineIter = Lines.lower_bound(LineNumber);
+	if(LineIter != Lines.end())
 	{
-		list<Segment *>::iterator SegmentIter2 = TheProg.Segments.begin();
-		SegmentIter2++;
-		for(; SegmentIter2 != TheProg.Segments.end(); SegmentIter++, SegmentIter2++)
+		Element *pElement = LineIter->second.first;
+		ProgramNumber = LineIter->second.second;
+		if(LineIter->first > LineNumber)
 		{
-			if((*SegmentIter2)->LocationStack[0].second > LineNumber)
-				break;
+			sprintf(sMessageBuffer, "Line %u does not contain an element, moved to line %u.", LineNumber, LineIter->first);
+			SimCallBack(Warning, sMessageBuffer);
+			LineNumber = LineIter->first;
 		}
-	}
-
-	//The element with the requested line number could either be in this segment, or the first element in the next segment
-	Element *pElement;
-	for(; SegmentIter != TheProg.Segments.end(); SegmentIter++)
-	{
-		for(list<Element *>::iterator SequenceIter = (*SegmentIter)->Sequence.begin(); SequenceIter != (*SegmentIter)->Sequence.end(); SequenceIter++)
+		//If the element is a label, find out what it points to
+		if(pElement->ElementType == LabelElement)
 		{
-			//Only allow an element located in this file
-			if((*SequenceIter)->LocationStack[0].second >= LineNumber && (*SequenceIter)->LocationStack.size() == 1)
-			{
-				pElement = *SequenceIter;
-				if(pElement->LocationStack[0].second > LineNumber)
-				{
-					sprintf(sMessageBuffer, "Line %u does not contain an element, moved to line %u.", LineNumber, pElement->LocationStack[0].second);
-					SimCallBack(Warning, sMessageBuffer);
-					LineNumber = pElement->LocationStack[0].second;
-				}
-				//If the element is a label, find out what it points to
-				if(pElement->ElementType == LabelElement)
-				{
-					if(((Label*)pElement)->pElement)
-						//The line number referring to the label now refers to the next instruction/data
-						pElement = ((Label*)pElement)->pElement;
-				}
-				if(pElement->ElementType != InstructionElement)
-				{
-					sprintf(sMessageBuffer, "Line %u element is not an instruction.", pElement->LocationStack[0].second);
-					SimCallBack(Warning, sMessageBuffer);
-				}
-				pNumber = new IntegerNumber(LocationVector(), pElement->Address);
-				return pNumber;
-			}
+			if(((Label*)pElement)->pElement)
+				//The line number referring to the label now refers to the next instruction/data
+				pElement = ((Label*)pElement)->pElement;
+		}
+		if(pElement->ElementType != InstructionElement)
+		{
+			sprintf(sMessageBuffer, "Line %u element is not an instruction.", pElement->LocationStack.rbegin()->second);
+			SimCallBack(Warning, sMessageBuffer);
 		}
+		return new IntegerNumber(LocationVector(), pElement->Address);
 	}
 
 	sprintf(sMessageBuffer, "No element on or after line %u.", LineNumber);
@@ -1719,10 +2112,6 @@ Number *ArchSim<ISA>::LineToAddress(bool fNumberSpecified, unsigned int &Program
 template<class ISA>
 Element *ArchSim<ISA>::AddressToElement(uint64 Address, bool fInside, bool fLabel)
 {
-	//*NOTE: This algorithm does perform a hierarchical search, similar to a B-tree.
-	//However, since each segment could contain 200+ elements, this search has a high constant.
-	//A more efficient method may be looked into in the future.
-
 	//Go through the programs to find the program which contains the requested address
 	vector<Program *>::iterator ProgramIter;
 	for(ProgramIter = pPrograms->begin(); ProgramIter != pPrograms->end(); ProgramIter++)
@@ -1743,61 +2132,127 @@ Element *ArchSim<ISA>::AddressToElement(uint64 Address, bool fInside, bool fLabe
 	if(SegmentIter == (*ProgramIter)->Segments.end())
 		return NULL;
 
-	//Go through the elements to find the element which contains the requested address
-	//This search may take us into a structure instance, which is implemented as a segment.
-	//If so, we will update the ElementIter and EndIter to refer to the new "structure" segment.
-	list<Element *>::iterator ElementIter, EndIter = (*SegmentIter)->Sequence.end();
-	for(ElementIter = (*SegmentIter)->Sequence.begin(); ElementIter != EndIter;)
-	{
-		Element *pElement = *ElementIter;
-		if(pElement->ElementType == LabelElement)
-		{
-			string sLabel = ((Label *)pElement)->sLabel;
+	return SegmentToElement(*SegmentIter, Address, fInside, fLabel);
+}
+
+template<class ISA>
+Element *ArchSim<ISA>::SegmentToElement(Segment *pSegment, uint64 Address, bool fInside, bool fLabel)
+{
+	typename ElementIndexMap::iterator IndexIter = ElementIndex.find(pSegment);
+	if(IndexIter == ElementIndex.end())
+		return NULL;
+	vector<Element *> &Elements = IndexIter->second;
+
+	//Binary search for the first element at or after the requested address
+	unsigned int Low = 0, High = Elements.size();
+	while(Low < High)
+	{
+		unsigned int Middle = (Low + High) / 2;
+		if(Elements[Middle]->Address < Address)
+			Low = Middle + 1;
+		else
+			High = Middle;
+	}
+	//Since the elements are back to back, only the element before that one
+	//can have the requested address inside it
+	if(fInside && Low > 0 && Elements[Low-1]->Address + Elements[Low-1]->Size > Address)
+		Low--;
+
+	//Take the first element in the sequence which contains this address
+	for(unsigned int i = Low; i < Elements.size() && Elements[i]->Address <= Address; i++)
+	{
+		Element *pElement = Elements[i];
+		if(pElement->Address != Address && !(fInside && pElement->Address + pElement->Size > Address))
+			continue;
+
+		//Ok, now we have the element that contains this address. Depending on what the element is
+		//could effect the next move
+		if(pElement->ElementType == StructElement)
+		{
+			//Binary search the segments (array of stucture instances) for the segment
+			//(structure instance) which contains the requested address
+			vector<Segment *> &Instances = reinterpret_cast<Struct *>(pElement)->Segments;
+			Low = 0;
+			High = Instances.size();
+			while(Low < High)
+			{
+				unsigned int Middle = (Low + High) / 2;
+				if(Instances[Middle]->Address <= Address)
+					Low = Middle + 1;
+				else
+					High = Middle;
+			}
+			if(Low == 0 || Instances[Low-1]->Address + Instances[Low-1]->Size <= Address)
+				return NULL;
+
+			return SegmentToElement(Instances[Low-1], Address, fInside, fLabel);
 		}
-		if((*ElementIter)->Address == Address || fInside && (*ElementIter)->Address < Address && (*ElementIter)->Address + (*ElementIter)->Size > Address)
+		else if(pElement->ElementType == LabelElement && (!fLabel || !reinterpret_cast<Label *>(pElement)->pElement || reinterpret_cast<Label *>(pElement)->pElement->ElementType == StructElement))
 		{
-			//Ok, now we have the element that contains this address. Depending on what the element is
-			//could effect the next move
-			if((*ElementIter)->ElementType == StructElement)
-			{
-				//Go through the segments (array of stucture instances) to find the segment
-				//(structure instance) which contains the requested address
-				vector<Segment *>::iterator SegmentIter;
-				for(SegmentIter = (reinterpret_cast<Struct *>(*ElementIter))->Segments.begin(); SegmentIter != (reinterpret_cast<Struct *>(*ElementIter))->Segments.end(); SegmentIter++)
-				{
-					if((*SegmentIter)->Address <= Address && (*SegmentIter)->Address + (*SegmentIter)->Size > Address)
-						break;
-				}
-				if(SegmentIter == (reinterpret_cast<Struct *>(*ElementIter))->Segments.end())
-					return NULL;
+			//Don't allow a label that points to a segment or structure
 
-				ElementIter = ElementIter = (*SegmentIter)->Sequence.begin();
-				EndIter = (*SegmentIter)->Sequence.end();
-				continue;
-			}
-			else if((*ElementIter)->ElementType == LabelElement && (!fLabel || !reinterpret_cast<Label *>(*ElementIter)->pElement || reinterpret_cast<Label *>(*ElementIter)->pElement->ElementType == StructElement))
+			//*NOTE: The case where a label points to a segment, and the segment specified an offset so there is space
+			//between the label and the segment will cause the label to have a different address than the segment.
+			//In this case, an address pointing to the segment start will not find the label.
+			//I'm not sure if there's any case where this matters.
+			continue;
+		}
+		else	//Data or instruction element, or labels allowed
+			//*NOTE: Should we do something about if the address is not the start of the element?
+			//At least for data arrays, it's possible it could be an index into an array, which could be checked.
+			return pElement;
+	}
+
+	return NULL;
+}
+
+template<class ISA>
+void ArchSim<ISA>::IndexElements()
+{
+	ElementIndex.clear();
+	for(vector<Program *>::iterator ProgramIter = pPrograms->begin(); ProgramIter != pPrograms->end(); ProgramIter++)
+		for(list<Segment *>::iterator SegmentIter = (*ProgramIter)->Segments.begin(); SegmentIter != (*ProgramIter)->Segments.end(); SegmentIter++)
+			IndexSegment(*SegmentIter);
+}
+
+template<class ISA>
+void ArchSim<ISA>::IndexLines()
+{
+	LineIndex.clear();
+	LineIndex.resize(MAX(pPrograms->size(), TheContext.InputList.size()));
+	for(unsigned int i = 0; i < pPrograms->size(); i++)
+	{
+		for(list<Segment *>::iterator SegmentIter = (*pPrograms)[i]->Segments.begin(); SegmentIter != (*pPrograms)[i]->Segments.end(); SegmentIter++)
+		{
+			for(list<Element *>::iterator SequenceIter = (*SegmentIter)->Sequence.begin(); SequenceIter != (*SegmentIter)->Sequence.end(); SequenceIter++)
 			{
-				//Don't allow a label that points to a segment or structure
-
-				//*NOTE: The case where a label points to a segment, and the segment specified an offset so there is space
-				//between the label and the segment will cause the label to have a different address than the segment.
-				//In this case, an address pointing to the segment start will not find the label.
-				//I'm not sure if there's any case where this matters.
-				ElementIter++;
-				continue;
+				//Index an element under the file it was written in. Elements in a
+				//program file must be located only in that file; include files take
+				//their elements from wherever they were included.
+				const LocationVector &LocationStack = (*SequenceIter)->LocationStack;
+				unsigned int FileNumber = LocationStack.rbegin()->first;
+				if((LocationStack.size() != 1 && FileNumber < pPrograms->size()) || FileNumber >= LineIndex.size())
+					continue;
+				//The first element on a line keeps it
+				LineIndex[FileNumber].insert(STDTYPENAME LineMap::value_type(LocationStack.rbegin()->second, pair<Element *, unsigned int>(*SequenceIter, i)));
 			}
-			else	//Data or instruction element, or labels allowed
-				break;
 		}
-		ElementIter++;
 	}
-	if(ElementIter == (*SegmentIter)->Sequence.end())
-		return NULL;
-
-	//*NOTE: Should we do something about if the address is not the start of the element?
-	//At least for data arrays, it's possible it could be an index into an array, which could be checked.
+}
 
-	return *ElementIter;
+template<class ISA>
+void ArchSim<ISA>::IndexSegment(Segment *pSegment)
+{
+	vector<Element *> &Elements = ElementIndex[pSegment];
+	Elements.assign(pSegment->Sequence.begin(), pSegment->Sequence.end());
+	for(vector<Element *>::iterator ElementIter = Elements.begin(); ElementIter != Elements.end(); ElementIter++)
+	{
+		if((*ElementIter)->ElementType != StructElement)
+			continue;
+		vector<Segment *> &Instances = reinterpret_cast<Struct *>(*ElementIter)->Segments;
+		for(vector<Segment *>::iterator SegmentIter = Instances.begin(); SegmentIter != Instances.end(); SegmentIter++)
+			IndexSegment(*SegmentIter);
+	}
 }
 
 template<class ISA>
@@ -1821,27 +2276,29 @@ bool ArchSim<ISA>::PrintInstruction(ostream &strOutput, Element *pElement, uint6
 			#error "Only MSVC and GCC Compilers Supported"
 		#endif
 		if(fPrintFile)
-			strOutput << InputList[pElement->LocationStack.rbegin()->first].c_str() << "(" << pElement->LocationStack.rbegin()->second << "): ";
+			strOutput << TheContext.InputList[pElement->LocationStack.rbegin()->first].c_str() << "(" << pElement->LocationStack.rbegin()->second << "): ";
 		strOutput << sMessageBuffer;
 		if(fPrintValue)
 		{
-			RamVector vData;
-			pElement->GetImage(vData, ISA::fLittleEndian, CallBack);
-			if(vData.size())
+			RamImage ElementImage;
+			pElement->GetImage(ElementImage, ISA::fLittleEndian, CallBack);
+			if(!ElementImage.empty())
 			{
 				strOutput << " (4x";
 				if(ISA::fLittleEndian)
-					for(RamVector::reverse_iterator RamIter = vData.rbegin(); RamIter != vData.rend(); RamIter++)
-					{
-						sprintf(sMessageBuffer, "%.2X", RamIter->second);
-						strOutput << sMessageBuffer;
-					}
+					for(vector<RamImage::Extent>::reverse_iterator ExtentIter = ElementImage.Extents.rbegin(); ExtentIter != ElementImage.Extents.rend(); ExtentIter++)
+						for(vector<unsigned char>::reverse_iterator ByteIter = ExtentIter->second.rbegin(); ByteIter != ExtentIter->second.rend(); ByteIter++)
+						{
+							sprintf(sMessageBuffer, "%.2X", *ByteIter);
+							strOutput << sMessageBuffer;
+						}
 				else
-					for(RamVector::iterator RamIter = vData.begin(); RamIter != vData.end(); RamIter++)
-					{
-						sprintf(sMessageBuffer, "%.2X", RamIter->second);
-						strOutput << sMessageBuffer;
-					}
+					for(vector<RamImage::Extent>::iterator ExtentIter = ElementImage.Extents.begin(); ExtentIter != ElementImage.Extents.end(); ExtentIter++)
+						for(vector<unsigned char>::iterator ByteIter = ExtentIter->second.begin(); ByteIter != ExtentIter->second.end(); ByteIter++)
+						{
+							sprintf(sMessageBuffer, "%.2X", *ByteIter);
+							strOutput << sMessageBuffer;
+						}
 				strOutput << "):";
 			}
 		}
@@ -1869,7 +2326,7 @@ bool ArchSim<ISA>::PrintInstruction(ostream &strOutput, Element *pElement, uint6
 		strOutput << sMessageBuffer;
 
 		//Get the instruction binary
-		RamVector vData;
+		vector<unsigned char> vData;
 		//*NOTE: This is assuming the instruction word is the same as the address word.
 		if(!pArch->DataRead(vData, Address, sizeof(typename ISA::Word)))
 			return false;
@@ -1882,15 +2339,15 @@ bool ArchSim<ISA>::PrintInstruction(ostream &strOutput, Element *pElement, uint6
 		{
 			strOutput << " (4x";
 			if(ISA::fLittleEndian)
-				for(RamVector::reverse_iterator RamIter = vData.rbegin(); RamIter != vData.rend(); RamIter++)
+				for(vector<unsigned char>::reverse_iterator ByteIter = vData.rbegin(); ByteIter != vData.rend(); ByteIter++)
 				{
-					sprintf(sMessageBuffer, "%.2X", RamIter->second);
+					sprintf(sMessageBuffer, "%.2X", *ByteIter);
 					strOutput << sMessageBuffer;
 				}
 			else
-				for(RamVector::iterator RamIter = vData.begin(); RamIter != vData.end(); RamIter++)
+				for(vector<unsigned char>::iterator ByteIter = vData.begin(); ByteIter != vData.end(); ByteIter++)
 				{
-					sprintf(sMessageBuffer, "%.2X", RamIter->second);
+					sprintf(sMessageBuffer, "%.2X", *ByteIter);
 					strOutput << sMessageBuffer;
 				}
 			strOutput << "):";
@@ -1900,15 +2357,15 @@ bool ArchSim<ISA>::PrintInstruction(ostream &strOutput, Element *pElement, uint6
 		{
 			if(ISA::fLittleEndian)
 #ifdef BIG_ENDIAN_BUILD
-				wByteData.Bytes[sizeof(uint64) - i - 1] = vData[i].second;
+				wByteData.Bytes[sizeof(uint64) - i - 1] = vData[i];
 #else
-				wByteData.Bytes[i] = vData[i].second;
+				wByteData.Bytes[i] = vData[i];
 #endif
 			else
 #ifdef BIG_ENDIAN_BUILD
-				wByteData.Bytes[i] = vData[i].second;
+				wByteData.Bytes[i] = vData[i];
 #else
-				wByteData.Bytes[sizeof(uint64) - i - 1] = vData[i].second;
+				wByteData.Bytes[sizeof(uint64) - i - 1] = vData[i];
 #endif
 		}
 		//*NOTE: Bug in GCC won't recognize "ISA::Disassembler::DisassemblerInstruction" function call.
@@ -1922,239 +2379,621 @@ bool ArchSim<ISA>::PrintInstruction(ostream &strOutput, Element *pElement, uint6
 }
 
 template<class ISA>
-bool ArchSim<ISA>::SetConsoleWidth(unsigned int Width)
+bool ArchSim<ISA>::SetConsoleWidth(unsigned int Width)
+{
+	if(Width < MIN_CONSOLE_WIDTH || Width > MAX_CONSOLE_WIDTH)
+	{
+		sprintf(sMessageBuffer, "Specified console width is out of range [%u:%u].", MIN_CONSOLE_WIDTH, MAX_CONSOLE_WIDTH);
+		SimCallBack(Error, sMessageBuffer);
+		return false;
+	}
+
+	ConsoleWidth = Width;
+	return true;
+}
+
+template<class ISA>
+bool ArchSim<ISA>::SetPrintI(unsigned int precount, unsigned int postcount)
+{
+	if(precount > MAX_DISPLAY_LENGTH || postcount > MAX_DISPLAY_LENGTH)
+	{
+		sprintf(sMessageBuffer, "Specified pre- and/or post-instruction count is out of range [0:%u].", MAX_DISPLAY_LENGTH);
+		SimCallBack(Error, sMessageBuffer);
+		return false;
+	}
+
+	PreInstructionCount = precount;
+	PostInstructionCount = postcount;
+	return true;
+}
+
+template<class ISA>
+bool ArchSim<ISA>::Reset(Architecture &Arch, vector<Program *> &Programs, RamImage &MemoryImage)
+{
+	SimCallBack(Info, "Initializing architecture...");
+	SimCallBack(Info, "");
+
+	//The binary trace compares against the old architecture's registers
+	if(BinaryTraceFile.IsOpen() && &Arch != pArch)
+		TraceOff();
+	BinaryTraceFile.ClearText();
+
+	pArch = &Arch;
+	pPrograms = &Programs;
+	pMemoryImage = &MemoryImage;
+	IndexElements();
+	IndexLines();
+	
+	if(UndoJournal.fOn)
+		UndoJournal.Start(*pArch, UndoJournal.MaxEntries);
+	if(!pArch->Reset(MemoryImage))
+		return false;
+	pArch->TakeSnapshot();
+	UpdateWatched();
+	ResetSimulation();
+
+	return true;
+}
+
+template<class ISA>
+bool ArchSim<ISA>::Reset()
+{
+	if(!pArch->fSnapshot)
+		return Reset(*pArch, *pPrograms, *pMemoryImage);
+
+	SimCallBack(Info, "Initializing architecture...");
+	SimCallBack(Info, "");
+
+	if(!pArch->RestoreSnapshot())
+		return false;
+	ResetSimulation();
+
+	return true;
+}
+
+template<class ISA>
+void ArchSim<ISA>::ResetSimulation()
+{
+	fBreak = true;
+	SimCycle = 0;
+	BreakCycle = 0;
+	SimInstruction = 0;
+	BreakInstruction = 0;
+	fInBreakpoint = false;
+	fOutBreakpoint = false;
+	fOverBreakpoint = false;
+	fFirstBreak = true;
+	ClearJournal();
+	pArch->Counters.Clear();
+	pArch->Caches.Clear();
+	pArch->Branches.Clear();
+	Profile.Clear();
+	CallStack.clear();
+	uint64 Address = pArch->NextInstruction();
+	Element *pElement, *pLElement = AddressToElement(Address, false, true);
+	if(pLElement && pLElement->ElementType == LabelElement)
+		pElement = reinterpret_cast<Label *>(pLElement)->pElement;
+	else
+		pElement = pLElement;
+	CallStack.push_back( CallStackInfo(
+		pElement ? TheContext.InputList[pElement->LocationStack.rbegin()->first] : sNoFile,
+		pElement ? pElement->LocationStack.rbegin()->second : 0,
+		Address,
+		(pLElement && pLElement->ElementType == LabelElement ? reinterpret_cast<Label *>(pLElement)->sLabel : "")) );
+}
+
+template<class ISA>
+bool ArchSim<ISA>::TraceOn(string sFileName, list<string> &TraceRegSets, bool fBinary)
+{
+	if(fTrace)
+	{
+		TraceOff();
+//		SimCallBack(Error, "Trace is already on. Stop the current trace before starting another.");
+//		return false;
+	}
+
+	for(list<string>::iterator TraceRegIter = TraceRegSets.begin(); TraceRegIter!= TraceRegSets.end(); TraceRegIter++)
+	{
+		//verify this is a valid register set name
+		if(pArch->RegisterSets.find(*TraceRegIter) == pArch->RegisterSets.end())
+		{
+			sprintf(sMessageBuffer, "\"%.63s\" is not a valid register set name.", TraceRegIter->c_str());
+			SimCallBack(Error, sMessageBuffer);
+			return false;
+		}
+	}
+	TraceRegisterSets = TraceRegSets;
+
+	if(fBinary)
+	{
+		list<const RegisterSet *> TraceRegSetPtrs;
+		for(list<string>::iterator RegSetIter = TraceRegisterSets.begin(); RegSetIter != TraceRegisterSets.end(); RegSetIter++)
+			TraceRegSetPtrs.push_back(&pArch->RegisterSets.find(*RegSetIter)->second);
+		if(!BinaryTraceFile.Create(sFileName, ISA::Addressability, sizeof(typename ISA::Word), TraceRegSetPtrs, SimCallBack))
+		{
+			TraceRegisterSets.clear();
+			return false;
+		}
+
+		fTrace = true;
+		//Start tracing the current instruction, which will otherwise be missed
+		TraceBinaryInstruction(SimCycle, pArch->NextInstruction());
+		return true;
+	}
+
+	TraceFile.clear();
+	TraceFile.open(sFileName.c_str());
+
+	if(!TraceFile.good())
+	{
+		TraceFile.close();
+		TraceRegisterSets.clear();
+		sprintf(sMessageBuffer, "Error opening file %.255s.", sFileName.c_str());
+		SimCallBack(Error, sMessageBuffer);
+		return false;
+	}
+
+	fTrace = true;
+
+	//Start tracing the current instruction, which will otherwise be missed
+	Element *pElement = AddressToElement(pArch->NextInstruction(), false, true);
+	#if defined _MSC_VER
+		sprintf(sMessageBuffer, "%I64u;\t%I64u;\t", SimCycle, SimInstruction);
+	#elif defined GPLUSPLUS
+		sprintf(sMessageBuffer, "%llu;\t%llu;\t", SimCycle, SimInstruction);
+	#else
+		#error "Only MSVC and GCC Compilers Supported"
+	#endif
+	TraceFile << sMessageBuffer;
+	if(!PrintInstruction(TraceFile, pElement, pArch->NextInstruction()))
+		return false;
+	sTraceRegisters.erase();
+	for(list<string>::iterator RegSetIter = TraceRegisterSets.begin(); RegSetIter != TraceRegisterSets.end(); RegSetIter++)
+	{
+		sTraceRegisters += ";\t";
+		pArch->RegisterSets.find(*RegSetIter)->second.Print(sTraceRegisters);
+	}
+	TraceFile << sTraceRegisters << endl;
+
+	return true;
+}
+
+template<class ISA>
+bool ArchSim<ISA>::TraceOff()
+{
+	if(!fTrace)
+	{
+//		SimCallBack(Error, "Trace is already off.");
+//		return false;
+	}
+
+	bool fRetVal = true;
+	if(BinaryTraceFile.IsOpen() && !BinaryTraceFile.Close())
+	{
+		SimCallBack(Error, "Error writing to trace file.");
+		fRetVal = false;
+	}
+	TraceFile.close();
+	TraceRegisterSets.clear();
+	fTrace = false;
+	return fRetVal;
+}
+
+template<class ISA>
+void ArchSim<ISA>::TraceBinaryInstruction(uint64 Cycle, uint64 Address)
+{
+	//Assemble the instruction word from its bytes
+	uint64 Word = 0;
+	TraceWord.clear();
+	if(pArch->DataRead(TraceWord, Address, sizeof(typename ISA::Word)))
+	{
+		for(unsigned int i = 0; i < TraceWord.size(); i++)
+		{
+			if(ISA::fLittleEndian)
+				Word |= (uint64)TraceWord[i] << 8 * i;
+			else
+				Word = Word << 8 | TraceWord[i];
+		}
+	}
+
+	//The instruction is only formatted the first time it is traced
+	if(BinaryTraceFile.NeedsText(Address, Word))
+	{
+		ostringstream strInstr;
+		PrintInstruction(strInstr, AddressToElement(Address, false, true), Address);
+		BinaryTraceFile.WriteText(Address, Word, strInstr.str());
+	}
+	BinaryTraceFile.WriteInstruction(Cycle, SimInstruction, Address, Word);
+}
+
+template<class ISA>
+bool ArchSim<ISA>::CheckOn()
+{
+	if(fCheck)
+	{
+//		SimCallBack(Error, "Check is already on.");
+//		return false;
+	}
+	fCheck = true;
+	return true;
+}
+
+template<class ISA>
+bool ArchSim<ISA>::CheckOff()
+{
+	if(!fCheck)
+	{
+//		SimCallBack(Error, "Check is already off.");
+//		return false;
+	}
+	fCheck = false;
+	return true;
+}
+
+template<class ISA>
+bool ArchSim<ISA>::JournalOn(Number *pNumber)
+{
+	unsigned int MaxEntries = DEFAULT_JOURNAL_ENTRIES;
+	if(pNumber)
+	{
+		uint64 TempInt64;
+		if(!pNumber->Int(8*sizeof(unsigned int), false, TempInt64, CallBack, " for journal size", true))
+			return false;
+		MaxEntries = (unsigned int)TempInt64;
+		delete pNumber;
+	}
+
+	//Frames of the returns in the old journal go back to the free list
+	ClearJournal();
+	UndoJournal.Start(*pArch, MaxEntries);
+	return true;
+}
+
+template<class ISA>
+bool ArchSim<ISA>::JournalOff()
+{
+	if(!UndoJournal.fOn)
+	{
+//		SimCallBack(Error, "Journal is already off.");
+//		return false;
+	}
+
+	ClearJournal();
+	UndoJournal.Stop(*pArch);
+	return true;
+}
+
+template<class ISA>
+void ArchSim<ISA>::ClearJournal()
 {
-	if(Width < MIN_CONSOLE_WIDTH || Width > MAX_CONSOLE_WIDTH)
+	UndoJournal.Clear();
+	FreeCallFrames.splice(FreeCallFrames.begin(), JournalCallFrames);
+}
+
+template<class ISA>
+bool ArchSim<ISA>::StatsOn()
+{
+	pArch->Counters.Start();
+	return true;
+}
+
+template<class ISA>
+bool ArchSim<ISA>::StatsOff()
+{
+	pArch->Counters.Stop();
+	return true;
+}
+
+template<class ISA>
+bool ArchSim<ISA>::SaveStats(const string &sFileName, const string &sFormat)
+{
+	string sType = ToLower(sFormat);
+	if(sType.empty())
 	{
-		sprintf(sMessageBuffer, "Specified console width is out of range [%u:%u].", MIN_CONSOLE_WIDTH, MAX_CONSOLE_WIDTH);
+		string::size_type Loc = sFileName.rfind('.');
+		if(Loc != string::npos)
+			sType = ToLower(sFileName.substr(Loc + 1));
+	}
+	if(sType != "csv" && sType != "json")
+	{
+		SimCallBack(Error, "Statistics format must be CSV or JSON.");
+		return false;
+	}
+
+	ofstream OutputFile(sFileName.c_str(), ios::out);
+	if(!OutputFile.good())
+	{
+		sprintf(sMessageBuffer, "Unable to open file %.255s", sFileName.c_str());
 		SimCallBack(Error, sMessageBuffer);
 		return false;
 	}
 
-	ConsoleWidth = Width;
+	if(!(sType == "csv" ? pArch->Counters.WriteCSV(OutputFile) : pArch->Counters.WriteJSON(OutputFile)))
+	{
+		sprintf(sMessageBuffer, "Unable to write file %.255s", sFileName.c_str());
+		SimCallBack(Error, sMessageBuffer);
+		return false;
+	}
 	return true;
 }
 
 template<class ISA>
-bool ArchSim<ISA>::SetPrintI(unsigned int precount, unsigned int postcount)
+bool ArchSim<ISA>::ProfileOn(Number *pNumber)
 {
-	if(precount > MAX_DISPLAY_LENGTH || postcount > MAX_DISPLAY_LENGTH)
+	uint64 Interval = DEFAULT_PROFILE_INTERVAL;
+	if(pNumber)
 	{
-		sprintf(sMessageBuffer, "Specified pre- and/or post-instruction count is out of range [0:%u].", MAX_DISPLAY_LENGTH);
-		SimCallBack(Error, sMessageBuffer);
+		if(!pNumber->Int(8*sizeof(unsigned int), false, Interval, CallBack, " for profile interval", true))
+			return false;
+		delete pNumber;
+	}
+	if(!Interval)
+	{
+		SimCallBack(Error, "Profile interval must be at least one cycle.");
 		return false;
 	}
 
-	PreInstructionCount = precount;
-	PostInstructionCount = postcount;
+	Profile.Start(Interval, SimCycle);
 	return true;
 }
 
 template<class ISA>
-bool ArchSim<ISA>::Reset(Architecture &Arch, vector<Program *> &Programs, RamVector &MemoryImage)
+bool ArchSim<ISA>::ProfileOff()
 {
-	SimCallBack(Info, "Initializing architecture...");
-	SimCallBack(Info, "");
+	Profile.Stop();
+	return true;
+}
 
-	pArch = &Arch;
-	pPrograms = &Programs;
-	pMemoryImage = &MemoryImage;
-	
-	if(!pArch->Reset(MemoryImage))
+template<class ISA>
+bool ArchSim<ISA>::SaveProfile(const string &sFileName, const string &sFormat)
+{
+	string sType = ToLower(sFormat);
+	if(sType.empty())
+		sType = ToLower(sFileName).find("callgrind") != string::npos ? "callgrind" : "folded";
+	if(sType != "folded" && sType != "callgrind")
+	{
+		SimCallBack(Error, "Profile format must be FOLDED or CALLGRIND.");
 		return false;
+	}
 
-	fBreak = true;
-	SimCycle = 0;
-	BreakCycle = 0;
-	SimInstruction = 0;
-	BreakInstruction = 0;
-	fInBreakpoint = false;
-	fOutBreakpoint = false;
-	fOverBreakpoint = false;
-	fFirstBreak = true;
-	CallStack.clear();
-	uint64 Address = pArch->NextInstruction();
-	Element *pElement, *pLElement = AddressToElement(Address, false, true);
-	if(pLElement && pLElement->ElementType == LabelElement)
-		pElement = reinterpret_cast<Label *>(pLElement)->pElement;
-	else
-		pElement = pLElement;
-	CallStack.push_back( CallStackInfo(
-		pElement ? InputList[pElement->LocationStack.rbegin()->first] : "NoFile",
-		pElement ? pElement->LocationStack.rbegin()->second : 0,
-		Address,
-		(pLElement && pLElement->ElementType == LabelElement ? reinterpret_cast<Label *>(pLElement)->sLabel : "")) );
+	ofstream OutputFile(sFileName.c_str(), ios::out);
+	if(!OutputFile.good())
+	{
+		sprintf(sMessageBuffer, "Unable to open file %.255s", sFileName.c_str());
+		SimCallBack(Error, sMessageBuffer);
+		return false;
+	}
 
+	if(!(sType == "folded" ? Profile.WriteFolded(OutputFile) : Profile.WriteCallgrind(OutputFile)))
+	{
+		sprintf(sMessageBuffer, "Unable to write file %.255s", sFileName.c_str());
+		SimCallBack(Error, sMessageBuffer);
+		return false;
+	}
 	return true;
 }
 
 template<class ISA>
-bool ArchSim<ISA>::TraceOn(string sFileName, list<string> &TraceRegSets)
+bool ArchSim<ISA>::CacheOn()
 {
-	if(fTrace)
+	pArch->Caches.Start();
+	return true;
+}
+
+template<class ISA>
+bool ArchSim<ISA>::CacheOff()
+{
+	pArch->Caches.Stop();
+	return true;
+}
+
+template<class ISA>
+bool ArchSim<ISA>::SetCache(const string &sLevel, uint64 Size, unsigned int LineSize, unsigned int Ways, const string &sReplacement, unsigned int Latency)
+{
+	CacheHierarchy &Caches = pArch->Caches;
+	Cache *pCache;
+	if(sLevel == Caches.L1I.sName)
+		pCache = &Caches.L1I;
+	else if(sLevel == Caches.L1D.sName)
+		pCache = &Caches.L1D;
+	else if(sLevel == Caches.L2.sName)
+		pCache = &Caches.L2;
+	else
 	{
-		TraceOff();
-//		SimCallBack(Error, "Trace is already on. Stop the current trace before starting another.");
-//		return false;
+		SimCallBack(Error, "Cache level must be L1I, L1D, or L2.");
+		return false;
 	}
 
-	for(list<string>::iterator TraceRegIter = TraceRegSets.begin(); TraceRegIter!= TraceRegSets.end(); TraceRegIter++)
+	ReplacementEnum Replacement;
+	string sPolicy = ToLower(sReplacement);
+	if(sPolicy.empty() || sPolicy == "lru")
+		Replacement = LRUReplacement;
+	else if(sPolicy == "plru")
+		Replacement = PLRUReplacement;
+	else if(sPolicy == "random")
+		Replacement = RandomReplacement;
+	else
 	{
-		//verify this is a valid register set name
-		if(pArch->RegisterSets.find(*TraceRegIter) == pArch->RegisterSets.end())
-		{
-			sprintf(sMessageBuffer, "\"%.63s\" is not a valid register set name.", TraceRegIter->c_str());
-			SimCallBack(Error, sMessageBuffer);
-			return false;
-		}
+		SimCallBack(Error, "Cache replacement policy must be LRU, PLRU, or RANDOM.");
+		return false;
 	}
-	TraceRegisterSets = TraceRegSets;
-
-	TraceFile.clear();
-	TraceFile.open(sFileName.c_str());
 
-	if(!TraceFile.good())
+	if(const char *sError = Cache::Check(Size, LineSize, Ways, Replacement))
 	{
-		TraceFile.close();
-		TraceRegisterSets.clear();
-		sprintf(sMessageBuffer, "Error opening file %.255s.", sFileName.c_str());
-		SimCallBack(Error, sMessageBuffer);
+		SimCallBack(Error, sError);
 		return false;
 	}
 
-	fTrace = true;
+	pCache->Create(Size, LineSize, Ways, Replacement, Latency);
+	if(pCache == &Caches.L2)
+		Caches.fL2 = true;
+	return true;
+}
 
-	//Start tracing the current instruction, which will otherwise be missed
-	Element *pElement = AddressToElement(pArch->NextInstruction(), false, true);
-	#if defined _MSC_VER
-		sprintf(sMessageBuffer, "%I64u;\t%I64u;\t", SimCycle, SimInstruction);
-	#elif defined GPLUSPLUS
-		sprintf(sMessageBuffer, "%llu;\t%llu;\t", SimCycle, SimInstruction);
-	#else
-		#error "Only MSVC and GCC Compilers Supported"
-	#endif
-	TraceFile << sMessageBuffer;
-	if(!PrintInstruction(TraceFile, pElement, pArch->NextInstruction()))
-		return false;
-	for(list<string>::iterator RegSetIter = TraceRegisterSets.begin(); RegSetIter != TraceRegisterSets.end(); RegSetIter++)
-		TraceFile << ";\t" << (const char *)pArch->RegisterSets.find(*RegSetIter)->second;
-	TraceFile << endl;
+template<class ISA>
+bool ArchSim<ISA>::L2CacheOff()
+{
+	pArch->Caches.fL2 = false;
+	return true;
+}
 
+template<class ISA>
+bool ArchSim<ISA>::SetMemoryLatency(unsigned int Latency)
+{
+	pArch->Caches.MemoryLatency = Latency;
 	return true;
 }
 
 template<class ISA>
-bool ArchSim<ISA>::TraceOff()
+bool ArchSim<ISA>::BranchOn()
 {
-	if(!fTrace)
-	{
-//		SimCallBack(Error, "Trace is already off.");
-//		return false;
-	}
+	pArch->Branches.Start(SimInstruction);
+	return true;
+}
 
-	TraceFile.close();
-	TraceRegisterSets.clear();
-	fTrace = false;
+template<class ISA>
+bool ArchSim<ISA>::BranchOff()
+{
+	pArch->Branches.Stop(SimInstruction);
 	return true;
 }
 
 template<class ISA>
-bool ArchSim<ISA>::CheckOn()
+bool ArchSim<ISA>::SetPredictor(const string &sPredictor, unsigned int Bits)
 {
-	if(fCheck)
+	BranchModel &Branches = pArch->Branches;
+	PredictorEnum Predictor;
+	string sName = ToLower(sPredictor);
+	if(sName == "bimodal")
+		Predictor = BimodalPredictor;
+	else if(sName == "gshare")
+		Predictor = GSharePredictor;
+	else if(sName == "tournament")
+		Predictor = TournamentPredictor;
+	else
 	{
-//		SimCallBack(Error, "Check is already on.");
-//		return false;
+		SimCallBack(Error, "Branch predictor must be BIMODAL, GSHARE, or TOURNAMENT.");
+		return false;
 	}
-	fCheck = true;
+
+	if(const char *sError = BranchModel::Check(Bits, Branches.ReturnDepth))
+	{
+		SimCallBack(Error, sError);
+		return false;
+	}
+
+	Branches.Create(Predictor, Bits, Branches.ReturnDepth);
 	return true;
 }
 
 template<class ISA>
-bool ArchSim<ISA>::CheckOff()
+bool ArchSim<ISA>::SetReturnStack(unsigned int Depth)
 {
-	if(!fCheck)
+	BranchModel &Branches = pArch->Branches;
+	if(const char *sError = BranchModel::Check(Branches.Bits, Depth))
 	{
-//		SimCallBack(Error, "Check is already off.");
-//		return false;
+		SimCallBack(Error, sError);
+		return false;
 	}
-	fCheck = false;
+
+	Branches.Create(Branches.Predictor, Branches.Bits, Depth);
 	return true;
 }
 
 template<class ISA>
-bool ArchSim<ISA>::SaveState(string sFileName)
+bool ArchSim<ISA>::SetBranchPenalty(unsigned int Penalty)
 {
-	//save the memories
-	for(Architecture::MemoryMap::iterator MemIter = pArch->Memories.begin(); MemIter != pArch->Memories.end(); MemIter++)
+	pArch->Branches.Penalty = Penalty;
+	return true;
+}
+
+template<class ISA>
+bool ArchSim<ISA>::SetEngine(const string &sEngine)
+{
+	for(unsigned int i = 0; i < pArch->Engines.size(); i++)
 	{
-		string sTempFileName = sFileName + ".Mem." + MemIter->second.sName + ".bin";
-		ofstream OutputFile(sTempFileName.c_str(), ios::out | ios::binary);
-		if(!OutputFile.good())
-		{
-			sprintf(sMessageBuffer, "Unable to open file %.255s", sTempFileName.c_str());
-			SimCallBack(Fatal, sMessageBuffer);
-			return false;
-		}
-		OutputFile << MemIter->second;
-		if(!OutputFile.good())
+		if(pArch->Engines[i] == sEngine)
 		{
-			sprintf(sMessageBuffer, "Error writing to %.255s", sTempFileName.c_str());
-			SimCallBack(Error, sMessageBuffer);
-			return false;
+			pArch->Engine = i;
+			return true;
 		}
 	}
 
-	//save the registers
-	for(Architecture::RegisterSetMap::iterator RegSetIter = pArch->RegisterSets.begin(); RegSetIter != pArch->RegisterSets.end(); RegSetIter++)
+	sprintf(sMessageBuffer, "Engine %.63s not found. Type \"engine\" for a list of engines.", sEngine.c_str());
+	SimCallBack(Error, sMessageBuffer);
+	return false;
+}
+
+template<class ISA>
+bool ArchSim<ISA>::SaveState(string sFileName, bool fIncremental)
+{
+	StateFile TheFile;
+	TheFile.StateID = StateFile::NewID();
+
+	if(fIncremental)
 	{
-		string sTempFileName = sFileName + ".RegSet." + RegSetIter->second.sName + ".bin";
-		ofstream OutputFile(sTempFileName.c_str(), ios::out | ios::binary);
-		if(!OutputFile.good())
+		if(sStateBase.empty())
 		{
-			sprintf(sMessageBuffer, "Unable to open file %.255s", sTempFileName.c_str());
-			SimCallBack(Fatal, sMessageBuffer);
+			SimCallBack(Error, "No state has been saved or loaded to save an incremental state against. Type \"saves\" to save a full state first.");
 			return false;
 		}
-		OutputFile << RegSetIter->second;
-		if(!OutputFile.good())
+		if(sStateBase == sFileName)
 		{
-			sprintf(sMessageBuffer, "Error writing to %.255s", sTempFileName.c_str());
+			sprintf(sMessageBuffer, "An incremental state cannot replace its own base state %.255s.", sFileName.c_str());
 			SimCallBack(Error, sMessageBuffer);
 			return false;
 		}
+		TheFile.fIncremental = true;
+		TheFile.BaseID = StateBaseID;
+		TheFile.AddSection(StateFile::BaseSection, "", sStateBase);
 	}
 
-	//Save the architecture
+	//save the memories
+	for(Architecture::MemoryMap::iterator MemIter = pArch->Memories.begin(); MemIter != pArch->Memories.end(); MemIter++)
 	{
-		string sTempFileName = sFileName + ".Arch.bin";
-		ofstream OutputFile(sTempFileName.c_str(), ios::out | ios::binary);
-		if(!OutputFile.good())
+		Memory &TheMemory = MemIter->second;
+		if(!TheMemory.fFlat)
 		{
-			sprintf(sMessageBuffer, "Unable to open file %.255s", sTempFileName.c_str());
-			SimCallBack(Fatal, sMessageBuffer);
-			return false;
+			//A sparse memory has no pages, so it is streamed whole
+			ostringstream OutputData(ios::out | ios::binary);
+			OutputData << TheMemory;
+			TheFile.AddSection(StateFile::StreamMemorySection, TheMemory.sName, OutputData.str());
 		}
-		*pArch >> OutputFile;
-		if(!OutputFile.good())
+		else if(fIncremental && TheMemory.fSnapshot)
 		{
-			sprintf(sMessageBuffer, "Error writing to %.255s", sTempFileName.c_str());
-			SimCallBack(Error, sMessageBuffer);
-			return false;
+			//Only the pages written since the base state
+			vector<size_t> Pages(TheMemory.StateDirtyList);
+			sort(Pages.begin(), Pages.end());
+			TheFile.AddMemory(TheMemory, Pages, false);
+		}
+		else
+		{
+			vector<size_t> Pages;
+			for(size_t Page = 0; Page < TheMemory.PageCount(); Page++)
+				if(!TheMemory.PageIsClear(Page))
+					Pages.push_back(Page);
+			TheFile.AddMemory(TheMemory, Pages, true);
 		}
 	}
 
-	//Save the simulator
+	//save the registers
+	for(Architecture::RegisterSetMap::iterator RegSetIter = pArch->RegisterSets.begin(); RegSetIter != pArch->RegisterSets.end(); RegSetIter++)
 	{
-		string sTempFileName = sFileName + ".Sim.bin";
-		ofstream OutputFile(sTempFileName.c_str(), ios::out | ios::binary);
-		if(!OutputFile.good())
-		{
-			sprintf(sMessageBuffer, "Unable to open file %.255s", sTempFileName.c_str());
-			SimCallBack(Fatal, sMessageBuffer);
-			return false;
-		}
+		ostringstream OutputData(ios::out | ios::binary);
+		OutputData << RegSetIter->second;
+		TheFile.AddSection(StateFile::RegisterSetSection, RegSetIter->second.sName, OutputData.str());
+	}
+
+	//Save the architecture
+	{
+		ostringstream OutputData(ios::out | ios::binary);
+		*pArch >> OutputData;
+		TheFile.AddSection(StateFile::ArchSection, "", OutputData.str());
+	}
 
+	//Save the simulator
+	{
+		ostringstream OutputData(ios::out | ios::binary);
 		unsigned int i;
 		JMT::ByteData ByteData;
 
@@ -2162,18 +3001,18 @@ bool ArchSim<ISA>::SaveState(string sFileName)
 		ByteData.UI64 = SimCycle;
 		for(i = 0; i < sizeof(uint64); i++)
 #ifdef BIG_ENDIAN_BUILD
-			OutputFile.put(ByteData.Bytes[sizeof(uint64) - i - 1]);
+			OutputData.put(ByteData.Bytes[sizeof(uint64) - i - 1]);
 #else
-			OutputFile.put(ByteData.Bytes[i]);
+			OutputData.put(ByteData.Bytes[i]);
 #endif
 
 		//Save the instruction count
 		ByteData.UI64 = SimInstruction;
 		for(i = 0; i < sizeof(uint64); i++)
 #ifdef BIG_ENDIAN_BUILD
-			OutputFile.put(ByteData.Bytes[sizeof(uint64) - i - 1]);
+			OutputData.put(ByteData.Bytes[sizeof(uint64) - i - 1]);
 #else
-			OutputFile.put(ByteData.Bytes[i]);
+			OutputData.put(ByteData.Bytes[i]);
 #endif
 
 		//Save the call stack
@@ -2181,9 +3020,9 @@ bool ArchSim<ISA>::SaveState(string sFileName)
 		ByteData.UI64 = CallStack.size();
 		for(i = 0; i < sizeof(uint64); i++)
 #ifdef BIG_ENDIAN_BUILD
-			OutputFile.put(ByteData.Bytes[sizeof(uint64) - i - 1]);
+			OutputData.put(ByteData.Bytes[sizeof(uint64) - i - 1]);
 #else
-			OutputFile.put(ByteData.Bytes[i]);
+			OutputData.put(ByteData.Bytes[i]);
 #endif
 		//Then write each entry of the call stack
 		for(CallStackList::iterator CSIter = CallStack.begin(); CSIter != CallStack.end(); CSIter++)
@@ -2194,149 +3033,166 @@ bool ArchSim<ISA>::SaveState(string sFileName)
 			ByteData.UI64 = SCInfo.first.size();
 			for(i = 0; i < sizeof(uint64); i++)
 #ifdef BIG_ENDIAN_BUILD
-				OutputFile.put(ByteData.Bytes[sizeof(uint64) - i - 1]);
+				OutputData.put(ByteData.Bytes[sizeof(uint64) - i - 1]);
 #else
-				OutputFile.put(ByteData.Bytes[i]);
+				OutputData.put(ByteData.Bytes[i]);
 #endif
 			for(i = 0; i < SCInfo.first.size(); i++)
-				OutputFile.put(SCInfo.first[i]);
+				OutputData.put(SCInfo.first[i]);
 
 			//Second is the line number
 			ByteData.UI64 = SCInfo.second;
 			for(i = 0; i < sizeof(uint64); i++)
 #ifdef BIG_ENDIAN_BUILD
-				OutputFile.put(ByteData.Bytes[sizeof(uint64) - i - 1]);
+				OutputData.put(ByteData.Bytes[sizeof(uint64) - i - 1]);
 #else
-				OutputFile.put(ByteData.Bytes[i]);
+				OutputData.put(ByteData.Bytes[i]);
 #endif
 
 			//third is the address
 			ByteData.UI64 = SCInfo.third;
 			for(i = 0; i < sizeof(uint64); i++)
 #ifdef BIG_ENDIAN_BUILD
-				OutputFile.put(ByteData.Bytes[sizeof(uint64) - i - 1]);
+				OutputData.put(ByteData.Bytes[sizeof(uint64) - i - 1]);
 #else
-				OutputFile.put(ByteData.Bytes[i]);
+				OutputData.put(ByteData.Bytes[i]);
 #endif
 
 			//Fourth is the label
 			ByteData.UI64 = SCInfo.fourth.size();
 			for(i = 0; i < sizeof(uint64); i++)
 #ifdef BIG_ENDIAN_BUILD
-				OutputFile.put(ByteData.Bytes[sizeof(uint64) - i - 1]);
+				OutputData.put(ByteData.Bytes[sizeof(uint64) - i - 1]);
 #else
-				OutputFile.put(ByteData.Bytes[i]);
+				OutputData.put(ByteData.Bytes[i]);
 #endif
 			for(i = 0; i < SCInfo.fourth.size(); i++)
-				OutputFile.put(SCInfo.fourth[i]);
+				OutputData.put(SCInfo.fourth[i]);
 		}
 
-		if(!OutputFile.good())
+		TheFile.AddSection(StateFile::SimSection, "", OutputData.str());
+	}
+
+	if(!TheFile.Write(sFileName, SimCallBack))
+		return false;
+
+	//The next incremental state only needs what is written after this one
+	for(Architecture::MemoryMap::iterator MemIter = pArch->Memories.begin(); MemIter != pArch->Memories.end(); MemIter++)
+		MemIter->second.StateSaved();
+	sStateBase = sFileName;
+	StateBaseID = TheFile.StateID;
+	return true;
+}
+
+template<class ISA>
+bool ArchSim<ISA>::LoadState(string sFileName)
+{
+	StateFile TheFile;
+	const StateFile::Section *pSection;
+
+	if(!TheFile.Open(sFileName, SimCallBack))
+		return false;
+
+	//Check the file holds every component of this architecture before changing any
+	for(Architecture::MemoryMap::iterator MemIter = pArch->Memories.begin(); MemIter != pArch->Memories.end(); MemIter++)
+	{
+		Memory &TheMemory = MemIter->second;
+		bool fValid = true;
+		if(pSection = TheFile.Find(StateFile::MemorySection, TheMemory.sName))
+		{
+			if(!TheMemory.fFlat)
+				fValid = false;
+			for(size_t i = 0; fValid && i < pSection->Count; i++)
+				if(TheFile.PageNumber(*pSection, i) >= TheMemory.PageCount())
+					fValid = false;
+		}
+		else if(!TheFile.Find(StateFile::StreamMemorySection, TheMemory.sName))
+			fValid = false;
+		if(!fValid)
 		{
-			sprintf(sMessageBuffer, "Error writing to %.255s", sTempFileName.c_str());
+			sprintf(sMessageBuffer, "%.255s does not hold a state for memory %.63s.", sFileName.c_str(), TheMemory.sName.c_str());
 			SimCallBack(Error, sMessageBuffer);
 			return false;
 		}
 	}
-
-	//Output a file using the bare filename so that the user will have a file to select when re-loading.
+	for(Architecture::RegisterSetMap::iterator RegSetIter = pArch->RegisterSets.begin(); RegSetIter != pArch->RegisterSets.end(); RegSetIter++)
 	{
-		string sTempFileName = sFileName + ".Sim.bin";
-		ofstream OutputFile(sTempFileName.c_str());
-		if(!OutputFile.good())
+		pSection = TheFile.Find(StateFile::RegisterSetSection, RegSetIter->second.sName);
+		if(!pSection || pSection->Size != RegSetIter->second.Registers.size() * sizeof(uint64))
 		{
-			sprintf(sMessageBuffer, "Unable to open file %.255s", sTempFileName.c_str());
-			SimCallBack(Fatal, sMessageBuffer);
+			sprintf(sMessageBuffer, "%.255s does not hold a state for register set %.63s.", sFileName.c_str(), RegSetIter->second.sName.c_str());
+			SimCallBack(Error, sMessageBuffer);
 			return false;
 		}
+	}
+	if(!TheFile.Find(StateFile::ArchSection) || !TheFile.Find(StateFile::SimSection) || TheFile.fIncremental && !TheFile.Find(StateFile::BaseSection))
+	{
+		sprintf(sMessageBuffer, "%.255s is missing part of the simulator state.", sFileName.c_str());
+		SimCallBack(Error, sMessageBuffer);
+		return false;
+	}
 
-		//Dump the time to the file for something to do.
-		time_t Time = time(NULL);
-		OutputFile << ctime(&Time) << endl;
+	//An incremental state is laid over its base
+	if(TheFile.fIncremental)
+	{
+		pSection = TheFile.Find(StateFile::BaseSection);
+		string sBaseName((const char *)TheFile.Data(*pSection), (size_t)pSection->Size);
 
-		if(!OutputFile.good())
+		//Make sure the base was not saved over before loading it
+		StateFile BaseFile;
+		if(!BaseFile.Open(sBaseName, SimCallBack))
+			return false;
+		if(BaseFile.StateID != TheFile.BaseID)
 		{
-			sprintf(sMessageBuffer, "Error writing to %.255s", sTempFileName.c_str());
+			sprintf(sMessageBuffer, "%.255s has been saved over since %.255s was saved against it.", sBaseName.c_str(), sFileName.c_str());
 			SimCallBack(Error, sMessageBuffer);
 			return false;
 		}
+		BaseFile.Close();
+
+		if(!LoadState(sBaseName))
+			return false;
 	}
-	
-	return true;
-}
 
-template<class ISA>
-bool ArchSim<ISA>::LoadState(string sFileName)
-{
-	//Load the memories
+	//Load the memories straight from the mapped pages
 	for(Architecture::MemoryMap::iterator MemIter = pArch->Memories.begin(); MemIter != pArch->Memories.end(); MemIter++)
 	{
-		string sTempFileName = sFileName + ".Mem." + MemIter->second.sName + ".bin";
-		ifstream InputFile(sTempFileName.c_str(), ios::in | ios::binary);
-		if(!InputFile.good())
+		Memory &TheMemory = MemIter->second;
+		if(pSection = TheFile.Find(StateFile::MemorySection, TheMemory.sName))
 		{
-			sprintf(sMessageBuffer, "Unable to open file %.255s", sTempFileName.c_str());
-			SimCallBack(Fatal, sMessageBuffer);
-			return false;
+			if(pSection->Flags & StateFile::FULL_MEMORY)
+				TheMemory.Clear();
+			for(size_t i = 0; i < pSection->Count; i++)
+				TheMemory.WritePage((size_t)TheFile.PageNumber(*pSection, i), TheFile.PageData(*pSection, i));
 		}
-		InputFile >> MemIter->second;
-		if(!InputFile.good() && !InputFile.eof())
+		else
 		{
-			sprintf(sMessageBuffer, "Error reading from %.255s", sTempFileName.c_str());
-			SimCallBack(Error, sMessageBuffer);
-			return false;
+			pSection = TheFile.Find(StateFile::StreamMemorySection, TheMemory.sName);
+			istringstream InputData(string((const char *)TheFile.Data(*pSection), (size_t)pSection->Size), ios::in | ios::binary);
+			TheMemory.Clear();
+			InputData >> TheMemory;
 		}
 	}
 
 	//Load the registers
 	for(Architecture::RegisterSetMap::iterator RegSetIter = pArch->RegisterSets.begin(); RegSetIter != pArch->RegisterSets.end(); RegSetIter++)
 	{
-		string sTempFileName = sFileName + ".RegSet." + RegSetIter->second.sName + ".bin";
-		ifstream InputFile(sTempFileName.c_str(), ios::in | ios::binary);
-		if(!InputFile.good())
-		{
-			sprintf(sMessageBuffer, "Unable to open file %.255s", sTempFileName.c_str());
-			SimCallBack(Fatal, sMessageBuffer);
-			return false;
-		}
-		InputFile >> RegSetIter->second;
-		if(!InputFile.good())
-		{
-			sprintf(sMessageBuffer, "Error reading from %.255s", sTempFileName.c_str());
-			SimCallBack(Error, sMessageBuffer);
-			return false;
-		}
+		pSection = TheFile.Find(StateFile::RegisterSetSection, RegSetIter->second.sName);
+		istringstream InputData(string((const char *)TheFile.Data(*pSection), (size_t)pSection->Size), ios::in | ios::binary);
+		InputData >> RegSetIter->second;
 	}
 
 	//Load the architecture
 	{
-		string sTempFileName = sFileName + ".Arch.bin";
-		ifstream InputFile(sTempFileName.c_str(), ios::in | ios::binary);
-		if(!InputFile.good())
-		{
-			sprintf(sMessageBuffer, "Unable to open file %.255s", sTempFileName.c_str());
-			SimCallBack(Fatal, sMessageBuffer);
-			return false;
-		}
-		*pArch << InputFile;
-		if(!InputFile.good())
-		{
-			sprintf(sMessageBuffer, "Error reading from %.255s", sTempFileName.c_str());
-			SimCallBack(Error, sMessageBuffer);
-			return false;
-		}
+		pSection = TheFile.Find(StateFile::ArchSection);
+		istringstream InputData(string((const char *)TheFile.Data(*pSection), (size_t)pSection->Size), ios::in | ios::binary);
+		*pArch << InputData;
 	}
 
 	//Load the simulator
 	{
-		string sTempFileName = sFileName + ".Sim.bin";
-		ifstream InputFile(sTempFileName.c_str(), ios::in | ios::binary);
-		if(!InputFile.good())
-		{
-			sprintf(sMessageBuffer, "Unable to open file %.255s", sTempFileName.c_str());
-			SimCallBack(Fatal, sMessageBuffer);
-			return false;
-		}
+		pSection = TheFile.Find(StateFile::SimSection);
+		istringstream InputData(string((const char *)TheFile.Data(*pSection), (size_t)pSection->Size), ios::in | ios::binary);
 
 		unsigned int i;
 		JMT::ByteData ByteData;
@@ -2344,18 +3200,18 @@ bool ArchSim<ISA>::LoadState(string sFileName)
 		//Load the cycle count
 		for(i = 0; i < sizeof(uint64); i++)
 #ifdef BIG_ENDIAN_BUILD
-			ByteData.Bytes[sizeof(uint64) - i - 1] = InputFile.get();
+			ByteData.Bytes[sizeof(uint64) - i - 1] = InputData.get();
 #else
-			ByteData.Bytes[i] = InputFile.get();
+			ByteData.Bytes[i] = InputData.get();
 #endif
 		SimCycle = ByteData.UI64;
 
 		//Load the instruction count
 		for(i = 0; i < sizeof(uint64); i++)
 #ifdef BIG_ENDIAN_BUILD
-			ByteData.Bytes[sizeof(uint64) - i - 1] = InputFile.get();
+			ByteData.Bytes[sizeof(uint64) - i - 1] = InputData.get();
 #else
-			ByteData.Bytes[i] = InputFile.get();
+			ByteData.Bytes[i] = InputData.get();
 #endif
 		SimInstruction = ByteData.UI64;
 
@@ -2364,9 +3220,9 @@ bool ArchSim<ISA>::LoadState(string sFileName)
 		//First load the length
 		for(i = 0; i < sizeof(uint64); i++)
 #ifdef BIG_ENDIAN_BUILD
-			ByteData.Bytes[sizeof(uint64) - i - 1] = InputFile.get();
+			ByteData.Bytes[sizeof(uint64) - i - 1] = InputData.get();
 #else
-			ByteData.Bytes[i] = InputFile.get();
+			ByteData.Bytes[i] = InputData.get();
 #endif
 		unsigned int CSSize = (unsigned int)ByteData.UI64;
 
@@ -2378,53 +3234,61 @@ bool ArchSim<ISA>::LoadState(string sFileName)
 			//First is the filename
 			for(i = 0; i < sizeof(uint64); i++)
 #ifdef BIG_ENDIAN_BUILD
-				ByteData.Bytes[sizeof(uint64) - i - 1] = InputFile.get();
+				ByteData.Bytes[sizeof(uint64) - i - 1] = InputData.get();
 #else
-				ByteData.Bytes[i] = InputFile.get();
+				ByteData.Bytes[i] = InputData.get();
 #endif
 			SCInfo.first.resize((unsigned int)ByteData.UI64);
 			for(i = 0; i < SCInfo.first.size(); i++)
-				SCInfo.first[i] = InputFile.get();
+				SCInfo.first[i] = InputData.get();
 
 			//Second is the line number
 			for(i = 0; i < sizeof(uint64); i++)
 #ifdef BIG_ENDIAN_BUILD
-				ByteData.Bytes[sizeof(uint64) - i - 1] = InputFile.get();
+				ByteData.Bytes[sizeof(uint64) - i - 1] = InputData.get();
 #else
-				ByteData.Bytes[i] = InputFile.get();
+				ByteData.Bytes[i] = InputData.get();
 #endif
 			SCInfo.second = (unsigned int)ByteData.UI64;
 
 			//third is the address
 			for(i = 0; i < sizeof(uint64); i++)
 #ifdef BIG_ENDIAN_BUILD
-				ByteData.Bytes[sizeof(uint64) - i - 1] = InputFile.get();
+				ByteData.Bytes[sizeof(uint64) - i - 1] = InputData.get();
 #else
-				ByteData.Bytes[i] = InputFile.get();
+				ByteData.Bytes[i] = InputData.get();
 #endif
 			SCInfo.third = ByteData.UI64;
 
 			//Fourth is the label
 			for(i = 0; i < sizeof(uint64); i++)
 #ifdef BIG_ENDIAN_BUILD
-				ByteData.Bytes[sizeof(uint64) - i - 1] = InputFile.get();
+				ByteData.Bytes[sizeof(uint64) - i - 1] = InputData.get();
 #else
-				ByteData.Bytes[i] = InputFile.get();
+				ByteData.Bytes[i] = InputData.get();
 #endif
 			SCInfo.fourth.resize((unsigned int)ByteData.UI64);
 			for(i = 0; i < SCInfo.fourth.size(); i++)
-				SCInfo.fourth[i] = InputFile.get();
+				SCInfo.fourth[i] = InputData.get();
 			CallStack.push_back(SCInfo);
 		}
 
-		if(!InputFile.good())
+		if(!InputData.good())
 		{
-			sprintf(sMessageBuffer, "Error reading from %.255s", sTempFileName.c_str());
+			sprintf(sMessageBuffer, "Error reading from %.255s", sFileName.c_str());
 			SimCallBack(Error, sMessageBuffer);
 			return false;
 		}
 	}
 
+	//The next incremental state only needs what is written after this one
+	for(Architecture::MemoryMap::iterator MemIter = pArch->Memories.begin(); MemIter != pArch->Memories.end(); MemIter++)
+		MemIter->second.StateSaved();
+	sStateBase = sFileName;
+	StateBaseID = TheFile.StateID;
+
+	//The journal cannot undo the load
+	ClearJournal();
 	fBreak = true;
 	fFirstBreak = true;
 	return true;
@@ -2465,19 +3329,15 @@ bool ArchSim<ISA>::SaveData(string sFileName, Number *pAddress, Number *pLength,
 		SimCallBack(Fatal, sMessageBuffer);
 		return false;
 	}
-	for(uint64 i = 0; i < Length; i++)
-	{
-		RamVector vRam;
-		pArch->DataRead(vRam, Address, DataBytes);
-		for(unsigned int j = 0; j < DataBytes; j++)
-		{
-			if(fOpposite)
-				OutputFile.put(vRam[DataBytes - j - 1].second);
-			else
-				OutputFile.put(vRam[j].second);
-		}
-		Address += DataBytes;
-	}
+	//Read the whole range at once
+	vector<unsigned char> vData;
+	if(Length && !pArch->DataRead(vData, Address, Length * DataBytes))
+		return false;
+	if(fOpposite)
+		for(size_t i = 0; i < vData.size(); i += DataBytes)
+			reverse(vData.begin() + i, vData.begin() + i + DataBytes);
+	if(!vData.empty())
+		OutputFile.write((const char *)&vData[0], (streamsize)vData.size());
 	if(!OutputFile.good())
 	{
 		sprintf(sMessageBuffer, "Error writing to %.255s", sFileName.c_str());
@@ -2524,19 +3384,16 @@ bool ArchSim<ISA>::LoadData(string sFileName, Number *pAddress, Number *pLength,
 		SimCallBack(Fatal, sMessageBuffer);
 		return false;
 	}
-	for(uint64 i = 0; i < Length; i++)
+	//Read the whole range into one extent, and only write the elements
+	//which were read completely
+	RamImage DataImage;
+	DataImage.Extents.push_back( RamImage::Extent(Address, vector<unsigned char>((size_t)(Length * DataBytes))) );
+	vector<unsigned char> &vData = DataImage.Extents.back().second;
+	if(!vData.empty())
+		InputFile.read((char *)&vData[0], (streamsize)vData.size());
+	if(InputFile.eof())
 	{
-		RamVector vRam;
-		vRam.resize(DataBytes);
-		for(unsigned int j = 0; j < DataBytes; j++)
-		{
-			if(fOpposite)
-				vRam[DataBytes - j - 1] = RamVector::value_type(Address + DataBytes - j - 1, InputFile.get());
-			else
-				vRam[j] = RamVector::value_type(Address + j, InputFile.get());
-		}
-		if(InputFile.eof())
-		{
+		uint64 i = (uint64)InputFile.gcount() / DataBytes;
 		#if defined _MSC_VER
 			sprintf(sMessageBuffer, "EOF encountered after %I64u data elements (%I64u bytes) read from %.255s", i+1, (i+1)*DataBytes, sFileName.c_str());
 		#elif defined GPLUSPLUS
@@ -2544,17 +3401,20 @@ bool ArchSim<ISA>::LoadData(string sFileName, Number *pAddress, Number *pLength,
 		#else
 			#error "Only MSVC and GCC Compilers Supported"
 		#endif
-			SimCallBack(Warning, sMessageBuffer);
-			break;
-		}
-		pArch->DataWrite(vRam);
-		Address += DataBytes;
-	}
+		SimCallBack(Warning, sMessageBuffer);
+		vData.resize((size_t)(i * DataBytes));
+	}
+	if(fOpposite)
+		for(size_t i = 0; i < vData.size(); i += DataBytes)
+			reverse(vData.begin() + i, vData.begin() + i + DataBytes);
+	if(!vData.empty())
+		pArch->DataWrite(DataImage);
 	if(InputFile.bad() || InputFile.fail() && !InputFile.eof())
 	{
 		sprintf(sMessageBuffer, "Error reading from %.255s", sFileName.c_str());
 		SimCallBack(Error, sMessageBuffer);
 	}
+	ClearJournal();
 
 	delete pAddress;
 	delete pLength;
@@ -2598,13 +3458,11 @@ bool ArchSim<ISA>::SaveObject(string sFileName, Number *pAddress, Number *pLengt
 		OutputFile.put( (unsigned char)(Address >> 8 * i) );
 	for(i = 0; i < sizeof(uint64); i++)
 		OutputFile.put( (unsigned char)(Length  >> 8 * i) );
-	for(i = 0; i < Length; i++)
-	{
-		RamVector vRam;
-		pArch->DataRead(vRam, Address, 1);
-		OutputFile.put(vRam[0].second);
-		Address++;
-	}
+	vector<unsigned char> vData;
+	if(Length && !pArch->DataRead(vData, Address, Length))
+		return false;
+	if(!vData.empty())
+		OutputFile.write((const char *)&vData[0], (streamsize)vData.size());
 	if(!OutputFile.good())
 	{
 		sprintf(sMessageBuffer, "Error writing to %.255s", sFileName.c_str());
@@ -2678,13 +3536,15 @@ bool ArchSim<ISA>::LoadObject(string sFileName)
 		return false;
 	}
 
-	for(i = 0; i < Length; i++)
+	//Read the whole object into one extent
+	RamImage ObjectImage;
+	ObjectImage.Extents.push_back( RamImage::Extent(Address, vector<unsigned char>((size_t)Length)) );
+	vector<unsigned char> &vData = ObjectImage.Extents.back().second;
+	if(!vData.empty())
+		InputFile.read((char *)&vData[0], (streamsize)vData.size());
+	if(InputFile.eof())
 	{
-		RamVector vRam;
-		vRam.resize(1);
-				vRam[0] = RamVector::value_type(Address, InputFile.get());
-		if(InputFile.eof())
-		{
+		i = (uint64)InputFile.gcount();
 		#if defined _MSC_VER
 			sprintf(sMessageBuffer, "EOF encountered after %I64u bytes read from %.255s", i+1, sFileName.c_str());
 		#elif defined GPLUSPLUS
@@ -2692,17 +3552,17 @@ bool ArchSim<ISA>::LoadObject(string sFileName)
 		#else
 			#error "Only MSVC and GCC Compilers Supported"
 		#endif
-			SimCallBack(Warning, sMessageBuffer);
-			break;
-		}
-		pArch->DataWrite(vRam);
-		Address++;
+		SimCallBack(Warning, sMessageBuffer);
+		vData.resize((size_t)i);
 	}
+	if(!vData.empty())
+		pArch->DataWrite(ObjectImage);
 	if(InputFile.bad() || InputFile.fail() && !InputFile.eof())
 	{
 		sprintf(sMessageBuffer, "Error reading from %.255s", sFileName.c_str());
 		SimCallBack(Error, sMessageBuffer);
 	}
+	ClearJournal();
 
 	return true;
 }
@@ -2786,7 +3646,9 @@ bool ArchSim<ISA>::GoOut()
 template<class ISA>
 bool ArchSim<ISA>::GotoL(bool fNumberSpecified, unsigned int ProgramNumber, unsigned int LineNumber)
 {
-	//Convert the program and line numbers into an address
+	//Convert the program and line numbers into an address. The program number
+	//becomes the owning program if the line is in an include file.
+	unsigned int FileNumber = fNumberSpecified ? ProgramNumber : 0;
 	Number *pNumber;
 	if( !(pNumber = LineToAddress(fNumberSpecified, ProgramNumber, LineNumber, "Goto line command")) )
 		return false;
@@ -2805,7 +3667,7 @@ bool ArchSim<ISA>::GotoL(bool fNumberSpecified, unsigned int ProgramNumber, unsi
 	}
 
 	//Finalize the breakpoint
-	if(!BreakpointInstruction(pNumber, true, ProgramNumber, LineNumber, GotoEvent))
+	if(!BreakpointInstruction(pNumber, true, FileNumber, LineNumber, GotoEvent))
 	{
 		delete pNumber;
 		return false;
@@ -2829,10 +3691,141 @@ bool ArchSim<ISA>::GotoI(Number *pNumber, unsigned int ProgramNumber)
 	return true;
 }
 
+template<class ISA>
+bool ArchSim<ISA>::StepBack()
+{
+	return Undo((uint64)-1, 1, false);
+}
+
+template<class ISA>
+bool ArchSim<ISA>::GoBack()
+{
+	return Undo((uint64)-1, (uint64)-1, true);
+}
+
+template<class ISA>
+bool ArchSim<ISA>::GoBack(Number *pNumber)
+{
+	if(!pNumber)
+		throw "NULL parameter to GoBack!";
+
+	uint64 TempInt64;
+	if(!pNumber->Int(64, false, TempInt64, CallBack, "", true))
+		return false;
+	if(!Undo(TempInt64, (uint64)-1, true))
+		return false;
+
+	delete pNumber;
+	return true;
+}
+
+template<class ISA>
+bool ArchSim<ISA>::Undo(uint64 MaxCycles, uint64 MaxInstructions, bool fBreakpoints)
+{
+	if(!UndoJournal.fOn)
+	{
+		SimCallBack(Error, "Reverse execution needs the journal. Type \"journalon\" to start journaling.");
+		return false;
+	}
+
+	uint64 Cycles = 0, StartInstruction = SimInstruction;
+	bool fHit = false;
+	while(UndoJournal.Cycles > 0 && Cycles < MaxCycles && StartInstruction - SimInstruction < MaxInstructions && !fHit)
+	{
+		//Undo the last cycle's entries, newest first, back to its cycle entry
+		while(true)
+		{
+			Journal::Entry TheEntry = UndoJournal.Entries.back();
+			UndoJournal.Entries.pop_back();
+			if(TheEntry.Type == Journal::CycleEntry)
+			{
+				SimCycle = TheEntry.Value;
+				SimInstruction = TheEntry.Address;
+				UndoJournal.Cycles--;
+				break;
+			}
+
+			switch(TheEntry.Type)
+			{
+			case Journal::RegisterEntry:
+				UndoJournal.Undo(TheEntry);
+				//Only changed registers are journaled
+				if(fBreakpoints && RegisterEvent(*UndoJournal.RegisterSetNames[TheEntry.ID], *UndoJournal.Registers[TheEntry.ID], (EventEnum)(WriteEvent | ValueEvent | ChangeEvent)))
+					fHit = true;
+				break;
+			case Journal::MemoryEntry:
+			{
+				Memory &TheMemory = *UndoJournal.Memories[TheEntry.ID];
+				uint64 NewValue = TheMemory.ReadInt(TheEntry.Address, TheEntry.Bytes, TheEntry.fLittleEndian);
+				UndoJournal.Undo(TheEntry);
+				RamImage Undone;
+				Undone.Extents.push_back( RamImage::Extent(TheEntry.Address, vector<unsigned char>()) );
+				TheMemory.Read(Undone.Extents.back().second, TheEntry.Address, TheEntry.Bytes, SimCallBack);
+				pArch->MemoryChanged(TheMemory, Undone);
+				if(!fBreakpoints)
+					break;
+				for(unsigned int i = 0; i < TheEntry.Bytes; i++)
+				{
+					unsigned int Shift = 8 * (TheEntry.fLittleEndian ? i : TheEntry.Bytes - 1 - i);
+					EventEnum Events = (EventEnum)(WriteEvent | ValueEvent | ((unsigned char)(NewValue >> Shift) == (unsigned char)(TheEntry.Value >> Shift) ? NoEvent : ChangeEvent));
+					//Both architectures keep logical data at the same byte
+					//addresses of their data memory
+					if(DataEvent(TheEntry.Address + i, Events))
+						fHit = true;
+					if(MemoryEvent(TheMemory, TheEntry.Address + i, Events))
+						fHit = true;
+				}
+				break;
+			}
+			case Journal::CallEntry:
+				FreeCallFrames.splice(FreeCallFrames.begin(), CallStack, --CallStack.end());
+				break;
+			case Journal::ReturnEntry:
+			{
+				//The caller's frame showed the call site while the subroutine ran
+				Element *pCallElement = AddressToElement(TheEntry.Address, false, false);
+				CallStack.rbegin()->first = pCallElement ? TheContext.InputList[pCallElement->LocationStack.rbegin()->first] : "NoFile";
+				CallStack.rbegin()->second = pCallElement ? pCallElement->LocationStack.rbegin()->second : 0;
+				CallStack.rbegin()->third = TheEntry.Address;
+				CallStack.splice(CallStack.end(), JournalCallFrames, --JournalCallFrames.end());
+				break;
+			}
+			default:
+				throw "Invalid journal entry!";
+			}
+		}
+		Cycles++;
+
+		//Break before the instruction, as a forward run would
+		if(fBreakpoints && (InstrEvents[pArch->NextInstruction()] & InstrEvent) && InstructionBreakpointEvent(pArch->NextInstruction()))
+			fHit = true;
+	}
+	if(UndoJournal.Cycles == 0 && Cycles < MaxCycles && StartInstruction - SimInstruction < MaxInstructions && !fHit)
+		SimCallBack(Breakpoint, "Start of journal.");
+
+	//Update the current location, as at the end of a run batch
+	uint64 Address = pArch->NextInstruction();
+	Element *pElement = AddressToElement(Address, false, false);
+	CallStack.rbegin()->first = pElement ? TheContext.InputList[pElement->LocationStack.rbegin()->first] : "NoFile";
+	CallStack.rbegin()->second = pElement ? pElement->LocationStack.rbegin()->second : 0;
+	CallStack.rbegin()->third = Address;
+
+	fBreak = true;
+	fFirstBreak = true;
+	fInBreakpoint = false;
+	fOutBreakpoint = false;
+	fOverBreakpoint = false;
+	BreakCycle = SimCycle;
+	BreakInstruction = SimInstruction;
+	return true;
+}
+
 template<class ISA>
 bool ArchSim<ISA>::BreakpointLine(bool fNumberSpecified, unsigned int ProgramNumber, unsigned int LineNumber, EventEnum Events)
 {
-	//Convert the program and line numbers into an address
+	//Convert the program and line numbers into an address. The program number
+	//becomes the owning program if the line is in an include file.
+	unsigned int FileNumber = fNumberSpecified ? ProgramNumber : 0;
 	Number *pNumber;
 	if( !(pNumber = LineToAddress(fNumberSpecified, ProgramNumber, LineNumber, "Breakpoint line command")) )
 		return false;
@@ -2851,7 +3844,7 @@ bool ArchSim<ISA>::BreakpointLine(bool fNumberSpecified, unsigned int ProgramNum
 	}
 
 	//Finalize the breakpoint
-	if(!BreakpointInstruction(pNumber, true, ProgramNumber, LineNumber, Events))
+	if(!BreakpointInstruction(pNumber, true, FileNumber, LineNumber, Events))
 	{
 		delete pNumber;
 		return false;
@@ -2928,6 +3921,7 @@ bool ArchSim<ISA>::BreakpointInstruction(Number *pNumber, bool fLineInfo, unsign
 		InstrBreakpoints.erase(InstrInsert.first);
 	}
 
+	UpdateWatched();
 	return true;
 }
 
@@ -2938,6 +3932,7 @@ bool ArchSim<ISA>::BreakpointInstructionClear()
 		delete InstrIter->second.first;
 	InstrBreakpoints.clear();
 	
+	UpdateWatched();
 	return true;
 }
 
@@ -3053,6 +4048,7 @@ bool ArchSim<ISA>::BreakpointData(Number *pNumber, DataEnum DataType, EventInfo
 		DataBreakpoints.erase(DataInsert.first);
 	}
 
+	UpdateWatched();
 	return true;
 }
 
@@ -3066,6 +4062,7 @@ bool ArchSim<ISA>::BreakpointDataClear()
 	}
 	DataBreakpoints.clear();
 
+	UpdateWatched();
 	return true;
 }
 
@@ -3159,6 +4156,7 @@ bool ArchSim<ISA>::BreakpointMemory(const string &sMemory, Number *pNumber, Data
 			MemoryBreakpoints.erase(MemoryInsert.first);
 	}
 
+	UpdateWatched();
 	return true;
 }
 
@@ -3172,6 +4170,7 @@ bool ArchSim<ISA>::BreakpointMemoryClear()
 	}
 	MemoryBreakpoints.clear();
 
+	UpdateWatched();
 	return true;
 }
 
@@ -3240,6 +4239,7 @@ bool ArchSim<ISA>::BreakpointRegister(const string &sRegisterSet, const string &
 			RegisterBreakpoints.erase(RegSetInsert.first);
 	}
 
+	UpdateWatched();
 	return true;
 }
 
@@ -3253,9 +4253,54 @@ bool ArchSim<ISA>::BreakpointRegisterClear()
 	}
 	RegisterBreakpoints.clear();
 
+	UpdateWatched();
 	return true;
 }
 
+template<class ISA>
+void ArchSim<ISA>::UpdateWatched()
+{
+	//The tables are built when the architecture is set by Reset
+	if(!pArch)
+		return;
+
+	WatchedRegisters.assign(pArch->RegisterCount, false);
+	for(typename RegisterSetMap::iterator RegSetIter = RegisterBreakpoints.begin(); RegSetIter != RegisterBreakpoints.end(); RegSetIter++)
+	{
+		Architecture::RegisterSetMap::iterator ArchRegSetIter = pArch->RegisterSets.find(RegSetIter->first);
+		if(ArchRegSetIter == pArch->RegisterSets.end())
+			continue;
+		for(typename RegisterMap::iterator RegIter = RegSetIter->second.begin(); RegIter != RegSetIter->second.end(); RegIter++)
+		{
+			RegisterSet::RegisterMap::iterator ArchRegIter = ArchRegSetIter->second.Registers.find(RegIter->first);
+			if(ArchRegIter != ArchRegSetIter->second.Registers.end() && ArchRegIter->second.ID < WatchedRegisters.size())
+				WatchedRegisters[ArchRegIter->second.ID] = true;
+		}
+	}
+
+	MemoryEvents.resize(pArch->MemoryCount);
+	for(Architecture::MemoryMap::iterator ArchMemIter = pArch->Memories.begin(); ArchMemIter != pArch->Memories.end(); ArchMemIter++)
+	{
+		if(ArchMemIter->second.ID >= MemoryEvents.size())
+			continue;
+		EventTable &TheTable = MemoryEvents[ArchMemIter->second.ID];
+		TheTable.Reset(ArchMemIter->second.Array.Begin(), ArchMemIter->second.Array.End());
+		typename MemoryMap::iterator MemIter = MemoryBreakpoints.find(ArchMemIter->first);
+		if(MemIter == MemoryBreakpoints.end())
+			continue;
+		for(typename MemoryAddrMap::iterator MemAddrIter = MemIter->second.begin(); MemAddrIter != MemIter->second.end(); MemAddrIter++)
+			TheTable.Add(MemAddrIter->first, MemAddrIter->second.second->Events);
+	}
+
+	InstrEvents.Reset(0, ISA::MaxAddress);
+	for(typename InstrMap::iterator InstrIter = InstrBreakpoints.begin(); InstrIter != InstrBreakpoints.end(); InstrIter++)
+		InstrEvents.Add(InstrIter->first, InstrIter->second.third);
+
+	DataEvents.Reset(0, ISA::MaxAddress);
+	for(typename DataMap::iterator DataIter = DataBreakpoints.begin(); DataIter != DataBreakpoints.end(); DataIter++)
+		DataEvents.Add(DataIter->first, DataIter->second.fourth->Events);
+}
+
 template<class ISA>
 bool ArchSim<ISA>::DisplayHelp(string sCommand)
 {
@@ -3290,13 +4335,16 @@ bool ArchSim<ISA>::DisplayHelp(string sCommand)
 		SimCallBack(Info, "Syntax: PRINTI number number");
 		SimCallBack(Info, "    Sets the pre-instruction count and post-instruction count to the specified number. When the current instruction is printed, the specified number of instructions before and after it are also printed. The default is 1 before and 3 after.");
 	}
-	else if(sCommand == "sim_saves" || sCommand == "sim_loads")
+	else if(sCommand == "sim_saves" || sCommand == "sim_savesi" || sCommand == "sim_loads")
 	{
 		SimCallBack(Info, "Syntax: SAVES \"filename\"");
-		SimCallBack(Info, "    Saves the state of the simulation. All of the memories will be saved to FileName.Mem.Name.bin, all of the register sets will be saved to FileName.RegSet.Name.bin, any architecture state which is not in registers is saved to FileName.Arch.bin, and any required simulator data is saved to FileName.Sim.bin. The filename must be enclosed in quotes, and does not need an extension.");
+		SimCallBack(Info, "    Saves the state of the simulation to a single file. The file holds all of the memories, all of the register sets, any architecture state which is not in registers, and any required simulator data. Memory is saved in pages, and pages which were never written are left out. The filename must be enclosed in quotes.");
+		SimCallBack(Info, "");
+		SimCallBack(Info, "Syntax: SAVESI \"filename\"");
+		SimCallBack(Info, "    Saves an incremental state, which only holds the memory pages written since the state last saved or loaded. That state's file is its base, and must be kept as it is, since loading the incremental state loads the base first. Saving a checkpoint every so often this way only costs the memory the program has written in between.");
 		SimCallBack(Info, "");
 		SimCallBack(Info, "Syntax: LOADS \"filename\"");
-		SimCallBack(Info, "    Loads the state of the simulation from a previous save.");
+		SimCallBack(Info, "    Loads the state of the simulation from a previous save. Loading starts a new journal.");
 	}
 	else if(sCommand == "sim_saved" || sCommand == "sim_loadd")
 	{
@@ -3322,8 +4370,9 @@ bool ArchSim<ISA>::DisplayHelp(string sCommand)
 	}
 	else if(sCommand == "sim_trace" || sCommand == "sim_traceon" || sCommand == "sim_traceoff")
 	{
-		SimCallBack(Info, "Syntax: TRACEON \"FileName\" [(list of register set names)]");
+		SimCallBack(Info, "Syntax: TRACEON \"FileName\" [BINARY] [(list of register set names)]");
 		SimCallBack(Info, "    Turns on a trace of the dynamically executing instructions. If a list of register set names is provided (each name separated by whitespace only), then the contents of those register sets will be dumped to file along with the instruction trace. The filename must be enclosed in quotes. Whenever possible, the originating program filename and line number for the executing instruction will be recorded in the trace file.");
+		SimCallBack(Info, "    BINARY writes a compact binary trace instead, which only records the registers that each instruction changed and formats each instruction once. It is many times faster and smaller than the text trace. The LC3Trace tool converts it to the text format, and can select a range of addresses or cycles. A separate thread writes the binary trace, and it is complete up to the current instruction at every break.");
 		SimCallBack(Info, "");
 		SimCallBack(Info, "Syntax: TRACEOFF");
 		SimCallBack(Info, "    Turns off the trace and closes the file.");
@@ -3337,6 +4386,91 @@ bool ArchSim<ISA>::DisplayHelp(string sCommand)
 		SimCallBack(Info, "Syntax: CHECKOFF");
 		SimCallBack(Info, "    Disables runtime checking. Architectural processor exceptions are not disabled. Runtime checking could be a considerable overhead in a large program.");
 	}
+	else if(sCommand == "sim_journal" || sCommand == "sim_journalon" || sCommand == "sim_journaloff")
+	{
+		SimCallBack(Info, "Syntax: JOURNALON [maximum entries]");
+		SimCallBack(Info, "    Starts journaling the simulation, so that the STEPBACK and GOBACK commands can undo it. Each cycle adds one entry, plus one for each register it changes, each memory write, and each subroutine call or return. An entry takes 24 bytes, and the oldest cycles are forgotten once the journal has more than the maximum number of entries. The default is 1000000 entries (24MB), which is typically over 200000 cycles.");
+		SimCallBack(Info, "    While journaling, the simulator runs one cycle at a time and compares every register after each cycle, which adds roughly 100ns to every cycle on a typical PC. Depending on the engine, simulation runs 1.5 to 3 times slower. Resetting, loading a state, and editing data, memory, or registers start a new journal.");
+		SimCallBack(Info, "");
+		SimCallBack(Info, "Syntax: JOURNALOFF");
+		SimCallBack(Info, "    Stops journaling and frees the journal.");
+	}
+	else if(sCommand == "sim_stats" || sCommand == "sim_statson" || sCommand == "sim_statsoff")
+	{
+		SimCallBack(Info, "Syntax: STATSON");
+		SimCallBack(Info, "    Clears the execution statistics and starts counting. The statistics count the instructions executed of each opcode, taken and not taken branches, loads and stores, memory-mapped IO reads and writes, interrupts and exceptions, the stalls and flushes of a pipelined engine, and the instructions executed at each address. Resetting the simulation clears them. Stepping back does not undo them.");
+		SimCallBack(Info, "");
+		SimCallBack(Info, "Syntax: STATSOFF");
+		SimCallBack(Info, "    Stops counting. The statistics are kept until the next STATSON or reset. While counting is off it costs nothing.");
+		SimCallBack(Info, "");
+		SimCallBack(Info, "Syntax: STATS [count]");
+		SimCallBack(Info, "    Displays the statistics, including the cycles per instruction, and the specified number of most executed instructions. The default is 10.");
+		SimCallBack(Info, "");
+		SimCallBack(Info, "Syntax: STATS \"filename\" [CSV | JSON]");
+		SimCallBack(Info, "    Saves the statistics to the specified file. If no format is given, it is taken from the file extension. The CSV file has one \"kind,name,count\" row per counter, opcode, and address. The filename must be enclosed in quotes.");
+	}
+	else if(sCommand == "sim_profile" || sCommand == "sim_profileon" || sCommand == "sim_profileoff")
+	{
+		SimCallBack(Info, "Syntax: PROFILEON [interval]");
+		SimCallBack(Info, "    Clears the profile and starts sampling the call-stack every interval cycles. The cycles between samples are charged to the source line being executed (exclusive), and to every function on the call-stack (inclusive). Calls are counted exactly. A function is named by the label of its first instruction. The default interval is 1000 cycles, and a smaller interval is more accurate but slower. Resetting the simulation clears the profile. Stepping back does not undo it.");
+		SimCallBack(Info, "");
+		SimCallBack(Info, "Syntax: PROFILEOFF");
+		SimCallBack(Info, "    Stops sampling. The profile is kept until the next PROFILEON or reset.");
+		SimCallBack(Info, "");
+		SimCallBack(Info, "Syntax: PROFILE [count]");
+		SimCallBack(Info, "    Displays the specified number of functions with the most inclusive cycles, and of source lines with the most exclusive cycles. The default is 10.");
+		SimCallBack(Info, "");
+		SimCallBack(Info, "Syntax: PROFILE \"filename\" [FOLDED | CALLGRIND]");
+		SimCallBack(Info, "    Saves the profile to the specified file. FOLDED writes one \"main;sub;leaf cycles\" line per call-stack, which flamegraph.pl reads. CALLGRIND writes the callgrind format, which KCachegrind and callgrind_annotate read. If no format is given, CALLGRIND is used if the filename contains \"callgrind\", otherwise FOLDED. The filename must be enclosed in quotes.");
+	}
+	else if(sCommand == "sim_cache" || sCommand == "sim_cacheon" || sCommand == "sim_cacheoff")
+	{
+		SimCallBack(Info, "Syntax: CACHEON");
+		SimCallBack(Info, "    Empties the caches, clears their statistics, and starts modelling them. Every instruction fetch goes to the L1I cache, and every data read and write to memory goes to the L1D cache. The caches are write-back and write-allocate. A level 1 miss goes to the L2 cache if it is on, or else to memory, and each access adds the latency of every level it reaches to the cycle count. Lines written back add no cycles. The caches only model timing, so they never change what a program does. Resetting the simulation empties them. Stepping back does not undo them.");
+		SimCallBack(Info, "");
+		SimCallBack(Info, "Syntax: CACHEOFF");
+		SimCallBack(Info, "    Stops modelling the caches. The statistics are kept until the next CACHEON or reset.");
+		SimCallBack(Info, "");
+		SimCallBack(Info, "Syntax: CACHE");
+		SimCallBack(Info, "    Displays the geometry, hits, misses, and writebacks of each cache, and the cycles the caches have added.");
+		SimCallBack(Info, "");
+		SimCallBack(Info, "Syntax: CACHE (L1I | L1D | L2) (size) (line size) (ways) [LRU | PLRU | RANDOM] [latency]");
+		SimCallBack(Info, "    Sets the size in bytes, bytes per line, and lines per set of a cache, and empties it. The sizes and ways must be powers of two. The default replacement policy is LRU. The latency is the cycles added to an access which reaches the cache. The default is 0 for the level 1 caches and 10 for the L2 cache. Setting the L2 cache turns it on. The level 1 caches are 4096 bytes, with 32 byte lines and 2 ways, unless set.");
+		SimCallBack(Info, "");
+		SimCallBack(Info, "Syntax: CACHE L2 OFF");
+		SimCallBack(Info, "    Stops using the L2 cache. It is off unless set.");
+		SimCallBack(Info, "");
+		SimCallBack(Info, "Syntax: CACHE MEMORY (latency)");
+		SimCallBack(Info, "    Sets the cycles added to an access which reaches memory. The default is 50.");
+	}
+	else if(sCommand == "sim_branch" || sCommand == "sim_branchon" || sCommand == "sim_branchoff")
+	{
+		SimCallBack(Info, "Syntax: BRANCHON");
+		SimCallBack(Info, "    Empties the branch predictor, clears its statistics, and starts modelling branches. Conditional branches are predicted by the selected predictor. Returns (JMP R7) are predicted by a return address stack, which JSR, JSRR, and TRAP push. Other JMP and JSRR instructions are predicted to jump where they jumped the last time. Branches which are always or never taken, JSR, and TRAP are not predicted, since their targets are known when they are decoded. Each misprediction adds the penalty to the cycle count. The model only measures predictability, so it never changes what a program does. Resetting the simulation empties it. Stepping back does not undo it.");
+		SimCallBack(Info, "");
+		SimCallBack(Info, "Syntax: BRANCHOFF");
+		SimCallBack(Info, "    Stops modelling branches. The statistics are kept until the next BRANCHON or reset.");
+		SimCallBack(Info, "");
+		SimCallBack(Info, "Syntax: BRANCH [count]");
+		SimCallBack(Info, "    Displays the accuracy and mispredictions per thousand instructions (MPKI) of each kind of branch, and the specified number of most mispredicted branches with their source lines. The default is 10.");
+		SimCallBack(Info, "");
+		SimCallBack(Info, "Syntax: BRANCH PREDICTOR (BIMODAL | GSHARE | TOURNAMENT) [index bits]");
+		SimCallBack(Info, "    Selects the conditional branch predictor and empties it. BIMODAL has a two-bit counter for each branch address. GSHARE indexes its counters with the branch address exclusive-ored with the outcomes of the latest branches. TOURNAMENT chooses between a bimodal and a gshare predictor for each branch address. Each table has 2 to the power of the index bits entries, from 1 to 20 bits. The default is 10. The predictor is BIMODAL unless selected.");
+		SimCallBack(Info, "");
+		SimCallBack(Info, "Syntax: BRANCH STACK (depth)");
+		SimCallBack(Info, "    Sets the number of entries in the return address stack, from 1 to 1024, and empties it. The default is 8.");
+		SimCallBack(Info, "");
+		SimCallBack(Info, "Syntax: BRANCH PENALTY (cycles)");
+		SimCallBack(Info, "    Sets the cycles each misprediction adds to the cycle count, as in a pipeline which resolves branches late. The default is 0. An engine which executes a multi-stage pipeline already stalls for its own branches, so the penalty is normally left at 0 with it.");
+	}
+	else if(sCommand == "sim_engine")
+	{
+		SimCallBack(Info, "Syntax: ENGINE");
+		SimCallBack(Info, "    Displays the names of the architecture's execution engines and which one is selected.");
+		SimCallBack(Info, "");
+		SimCallBack(Info, "Syntax: ENGINE (engine name)");
+		SimCallBack(Info, "    Selects the engine used to simulate the architecture. The \"pipeline\" engine executes the first pipeline shown by \"DPL\". An engine named after another pipeline executes that pipeline instead, which may take several cycles per instruction. Other engines produce the same architectural state and breakpoints, but may simulate faster. The engine can be changed at any time.");
+	}
 	else if(sCommand == "sim_go" || sCommand == "sim_goi" || sCommand == "sim_goin" || sCommand == "sim_goover" || sCommand == "sim_goout")
 	{
 		SimCallBack(Info, "Syntax: GO");
@@ -3360,6 +4494,21 @@ bool ArchSim<ISA>::DisplayHelp(string sCommand)
 		SimCallBack(Info, "Notes:");
 		SimCallBack(Info, "    A number parameter can be of any integral or real syntax as defined in the Assembler documentation.");
 	}
+	else if(sCommand == "sim_stepback" || sCommand == "sim_goback")
+	{
+		SimCallBack(Info, "Syntax: STEPBACK");
+		SimCallBack(Info, "    Undoes the last instruction.");
+		SimCallBack(Info, "");
+		SimCallBack(Info, "Syntax: GOBACK");
+		SimCallBack(Info, "    Undoes cycles until a breakpoint is reached or the start of the journal.");
+		SimCallBack(Info, "");
+		SimCallBack(Info, "Syntax: GOBACK (cycle count)");
+		SimCallBack(Info, "    Undoes the specified number of cycles, unless a breakpoint or the start of the journal intervenes.");
+		SimCallBack(Info, "");
+		SimCallBack(Info, "Notes:");
+		SimCallBack(Info, "    These commands need the journal to be started with JOURNALON. Undoing a cycle restores the registers, memory, call-stack, and cycle and instruction counts from before it. Console input and output, and external interrupts, are not undone.");
+		SimCallBack(Info, "    GOBACK breaks at an instruction breakpoint when the undone cycles return to that instruction. Undoing a write triggers data, memory, and register breakpoints as a write of the old value would.");
+	}
 	else if(sCommand == "sim_goto" || sCommand == "sim_gotol" || sCommand == "sim_gotoi")
 	{
 		SimCallBack(Info, "Syntax: GOTOL (line number)");
@@ -3535,9 +4684,12 @@ bool ArchSim<ISA>::DisplayHelp(string sCommand)
 	else
 	{
 		SimCallBack(Info, "HELP, RESET, QUIT, EXIT, CONSOLE, PRINTI");
-		SimCallBack(Info, "SAVES, LOADS, SAVED, LOADD, SAVEO, LOADO");
-		SimCallBack(Info, "TRACEON, TRACEOFF, CHECKON, CHECKOFF");
+		SimCallBack(Info, "SAVES, SAVESI, LOADS, SAVED, LOADD, SAVEO, LOADO");
+		SimCallBack(Info, "TRACEON, TRACEOFF, CHECKON, CHECKOFF, ENGINE, JOURNALON, JOURNALOFF");
+		SimCallBack(Info, "STATSON, STATSOFF, STATS, PROFILEON, PROFILEOFF, PROFILE");
+		SimCallBack(Info, "CACHEON, CACHEOFF, CACHE, BRANCHON, BRANCHOFF, BRANCH");
 		SimCallBack(Info, "GO, GO #, GOI, GOIN, GOOVER, GOOUT, GOTOL, GOTOI");
+		SimCallBack(Info, "STEPBACK, GOBACK, GOBACK #");
 		SimCallBack(Info, "BPL, BPI, BPD, BPM, BPR (Breakpoint: Line, Instruction, Data, Memory, Register)");
 		SimCallBack(Info, "    BPIC, BPDC, BPMC, BPRC (Breakpoint Clear)");
 		SimCallBack(Info, "    EVENTLIST (Syntax used for breakpoint commands)");
@@ -3593,7 +4745,7 @@ bool ArchSim<ISA>::DisplayInstruction(Number *pNumber, Number *pLength)
 	}
 
 	//Get the data
-	RamVector vData;
+	vector<unsigned char> vData;
 	if(!pArch->DataRead(vData, Address, Length * sizeof(typename ISA::Word)))
 		return false;
 
@@ -3686,7 +4838,7 @@ bool ArchSim<ISA>::DisplayData(Number *pAddress, Number *pLength, DataEnum DataT
 		}
 
 		//Get the data
-		RamVector vData;
+		vector<unsigned char> vData;
 		if(!pArch->DataRead(vData, Address, vDataBytes[DataType]))
 			return false;
 
@@ -3787,7 +4939,7 @@ bool ArchSim<ISA>::DisplayDataArray(Number *pAddress, Number *pLength)
 		return false;
 
 	//Get the memory data
-	RamVector vData;
+	vector<unsigned char> vData;
 	if(!pArch->DataRead(vData, Address, Length))
 		return false;
 
@@ -3821,7 +4973,7 @@ bool ArchSim<ISA>::DisplayDataArray(Number *pAddress, Number *pLength)
 		{
 			if(i < Address + Length && i >= Address)
 			{
-				unsigned char Byte = vData[(unsigned int)(i - Address)].second;
+				unsigned char Byte = vData[(unsigned int)(i - Address)];
 				psDB += sprintf(psDB, " %.2X", Byte);
 				if(Byte <= 0x1F || Byte >= 0x7F)
 					psDC += sprintf(psDC, ".");
@@ -3918,7 +5070,7 @@ bool ArchSim<ISA>::DisplayMemory(const string &sMemory, Number *pAddress, Number
 	for(uint64 i = 0; i < Length; i++)
 	{
 		//Get the memory data
-		RamVector vData;
+		vector<unsigned char> vData;
 		if(!MemIter->second.Read(vData, Address, vDataBytes[DataType], SimCallBack))
 			return false;
 
@@ -4012,7 +5164,7 @@ bool ArchSim<ISA>::DisplayMemoryArray(const string &sMemory, Number *pAddress, N
 		return false;
 
 	//Get the memory data
-	RamVector vData;
+	vector<unsigned char> vData;
 	if(!MemIter->second.Read(vData, Address, Length, SimCallBack))
 		return false;
 
@@ -4055,7 +5207,7 @@ bool ArchSim<ISA>::DisplayMemoryArray(const string &sMemory, Number *pAddress, N
 		{
 			if(i < Address + Length && i >= Address)
 			{
-				unsigned char Byte = vData[(unsigned int)(i - Address)].second;
+				unsigned char Byte = vData[(unsigned int)(i - Address)];
 				psDB += sprintf(psDB, " %.2X", Byte);
 				if(Byte <= 0x1F || Byte >= 0x7F)
 					psDC += sprintf(psDC, ".");
@@ -4111,12 +5263,12 @@ bool ArchSim<ISA>::DisplayRegisterSet(const string &sRegisterSet)
 		return false;
 	}
 
+	char sRegister[REGISTER_PRINT_CHARS];
 	for(RegisterSet::RegisterMap::iterator RegIter = RegSetIter->second.Registers.begin(); RegIter != RegSetIter->second.Registers.end(); RegIter++)
 	{
-		sprintf(sMessageBuffer, "%.63s:\t%.63s", RegIter->second.sName.c_str(), (const char *)RegIter->second);
+		sprintf(sMessageBuffer, "%.63s:\t%.63s", RegIter->second.sName.c_str(), RegIter->second.Print(sRegister));
 		SimCallBack(Info, sMessageBuffer);
 	}
-//	SimCallBack(Info, (const char *)RegSetIter->second);
 
 	return true;
 }
@@ -4142,8 +5294,8 @@ bool ArchSim<ISA>::DisplayRegister(const string &sRegisterSet, const string &sRe
 		return false;
 	}
 
-//	sprintf(sMessageBuffer, "%.63s.%.63s:\t%.63s", sRegisterSet.c_str(), sRegister.c_str(), (const char *)RegIter->second);
-	SimCallBack(Info, (const char *)RegIter->second);
+	char sValue[REGISTER_PRINT_CHARS];
+	SimCallBack(Info, RegIter->second.Print(sValue));
 
 	return true;
 }
@@ -4167,6 +5319,160 @@ bool ArchSim<ISA>::DisplayPipelines()
 	return true;
 }
 
+template<class ISA>
+bool ArchSim<ISA>::DisplayEngines()
+{
+	for(unsigned int i = 0; i < pArch->Engines.size(); i++)
+	{
+		string sEngine = pArch->Engines[i];
+		if(i == pArch->Engine)
+			sEngine += " (selected)";
+		SimCallBack(Info, sEngine.c_str());
+	}
+
+	return true;
+}
+
+template<class ISA>
+bool ArchSim<ISA>::DisplayStats(unsigned int Count)
+{
+	const PerfCounters &Counters = pArch->Counters;
+	uint64 Instructions = Counters.Instructions();
+
+	if(!Counters.fOn && !Instructions)
+	{
+		SimCallBack(Info, "Statistics are off. Use STATSON to start counting.");
+		return true;
+	}
+
+	//The counters are 64-bit, so format them with a stream
+	ostringstream strTotals;
+	strTotals << "Counting: " << (Counters.fOn ? "on" : "off") << "\n";
+	strTotals << "Cycles: " << Counters.Cycles << "\n";
+	strTotals << "Instructions: " << Instructions << "\n";
+	if(Instructions)
+	{
+		sprintf(sMessageBuffer, "CPI: %.3f\n", (double)(int64)Counters.Cycles / (double)(int64)Instructions);
+		strTotals << sMessageBuffer;
+	}
+	strTotals << "Loads: " << Counters.Loads() << "\n";
+	strTotals << "Stores: " << Counters.Stores() << "\n";
+	strTotals << "Branches: " << Counters.Taken << " taken, " << Counters.NotTaken << " not taken\n";
+	strTotals << "MMIO: " << Counters.MMIOReads << " reads, " << Counters.MMIOWrites << " writes\n";
+	strTotals << "Interrupts: " << Counters.Interrupts << "\n";
+	strTotals << "Exceptions: " << Counters.Exceptions << "\n";
+	strTotals << "Pipeline: " << Counters.Stalls << " stall cycles, " << Counters.Flushes << " flushes, " << Counters.Flushed << " instructions flushed\n";
+	strTotals << "\n";
+	strTotals << "Opcodes:";
+	istringstream strLines(strTotals.str());
+	string sLine;
+	while(getline(strLines, sLine))
+		SimCallBack(Info, sLine.c_str());
+
+	for(unsigned int i = 0; i < Counters.Opcodes.size(); i++)
+	{
+		if(!Counters.OpcodeCounts[i])
+			continue;
+		ostringstream strOpcode;
+		strOpcode << "    " << setw(10) << left << Counters.Opcodes[i] << right << setw(12) << Counters.OpcodeCounts[i];
+		sprintf(sMessageBuffer, "%.127s %6.2f%%", strOpcode.str().c_str(), 100.0 * (double)(int64)Counters.OpcodeCounts[i] / (double)(int64)Instructions);
+		SimCallBack(Info, sMessageBuffer);
+	}
+
+	vector<uint64> Hot;
+	Counters.HotAddresses(Count, Hot);
+	if(Hot.empty())
+		return true;
+
+	SimCallBack(Info, "");
+	SimCallBack(Info, "Most executed instructions:");
+	for(unsigned int i = 0; i < Hot.size(); i++)
+	{
+		uint64 Address = Hot[i] << ISA::Addressability;
+		ostringstream strInstr;
+		strInstr << "    " << setw(12) << Counters.AddressCounts[(size_t)(Hot[i] >> Counters.AddressShift)] << "  ";
+		if(!PrintInstruction(strInstr, AddressToElement(Address, false, true), Address))
+			return false;
+		SimCallBack(Info, strInstr.str().c_str());
+	}
+
+	return true;
+}
+
+template<class ISA>
+bool ArchSim<ISA>::DisplayProfile(unsigned int Count)
+{
+	if(!Profile.fOn)
+		SimCallBack(Info, "Profiling is off. Use PROFILEON to start sampling.");
+
+	//The profile is 64-bit, so format it with a stream
+	ostringstream strProfile;
+	Profile.WriteSummary(strProfile, Count);
+	istringstream strLines(strProfile.str());
+	string sLine;
+	while(getline(strLines, sLine))
+		SimCallBack(Info, sLine.c_str());
+
+	return true;
+}
+
+template<class ISA>
+bool ArchSim<ISA>::DisplayCache()
+{
+	//The statistics are 64-bit, so format them with a stream
+	ostringstream strCache;
+	pArch->Caches.WriteSummary(strCache);
+	istringstream strLines(strCache.str());
+	string sLine;
+	while(getline(strLines, sLine))
+		SimCallBack(Info, sLine.c_str());
+
+	return true;
+}
+
+template<class ISA>
+bool ArchSim<ISA>::DisplayBranches(unsigned int Count)
+{
+	const BranchModel &Branches = pArch->Branches;
+	if(!Branches.fOn)
+		SimCallBack(Info, "Branch modelling is off. Use BRANCHON to start it.");
+
+	//The statistics are 64-bit, so format them with a stream
+	ostringstream strBranches;
+	Branches.WriteSummary(strBranches, SimInstruction);
+	istringstream strLines(strBranches.str());
+	string sLine;
+	while(getline(strLines, sLine))
+		SimCallBack(Info, sLine.c_str());
+
+	vector<uint64> Worst;
+	Branches.WorstSites(Count, Worst);
+	if(Worst.empty())
+		return true;
+
+	uint64 Instructions = Branches.Instructions(SimInstruction);
+	SimCallBack(Info, "");
+	SimCallBack(Info, "Most mispredicted branches:");
+	for(unsigned int i = 0; i < Worst.size(); i++)
+	{
+		const BranchModel::Site &TheSite = Branches.Sites.find(Worst[i])->second;
+		uint64 Address = Worst[i] << ISA::Addressability;
+		ostringstream strInstr;
+		strInstr << "    ";
+		if(!PrintInstruction(strInstr, AddressToElement(Address, false, true), Address))
+			return false;
+		SimCallBack(Info, strInstr.str().c_str());
+
+		ostringstream strSite;
+		strSite << "        " << TheSite.Executed << " executed, " << TheSite.Mispredicted << " mispredicted";
+		sprintf(sMessageBuffer, " (%.2f%% correct, %.3f MPKI)", 100.0 * (double)(int64)(TheSite.Executed - TheSite.Mispredicted) / (double)(int64)TheSite.Executed, Instructions ? 1000.0 * (double)(int64)TheSite.Mispredicted / (double)(int64)Instructions : 0.0);
+		strSite << sMessageBuffer;
+		SimCallBack(Info, strSite.str().c_str());
+	}
+
+	return true;
+}
+
 template<class ISA>
 bool ArchSim<ISA>::DisplayCycleInstruction()
 {
@@ -4238,7 +5544,7 @@ bool ArchSim<ISA>::DisplayBreakpoints()
 	{
 		ostrstream strBreakpoints;
 		if(InstrIter->second.second.first)
-			strBreakpoints << InputList[InstrIter->second.second.second].c_str() << "(" << InstrIter->second.second.third << "):\t";
+			strBreakpoints << TheContext.InputList[InstrIter->second.second.second].c_str() << "(" << InstrIter->second.second.third << "):\t";
 		strBreakpoints << (const char *)*InstrIter->second.first;
 		if(InstrIter->second.third == GotoEvent)
 			strBreakpoints << " GOTO";
@@ -4257,8 +5563,10 @@ bool ArchSim<ISA>::DisplayBreakpoints()
 	{
 		ostrstream strBreakpoints;
 		if(DataIter->second.third.first)
-			strBreakpoints << InputList[DataIter->second.third.second].c_str() << "(" << DataIter->second.third.third << "):\t";
-		strBreakpoints << (const char *)*DataIter->second.first << (const char *)*DataIter->second.fourth << ends;
+			strBreakpoints << TheContext.InputList[DataIter->second.third.second].c_str() << "(" << DataIter->second.third.third << "):\t";
+		string sEvents;
+		DataIter->second.fourth->Print(sEvents);
+		strBreakpoints << (const char *)*DataIter->second.first << sEvents.c_str() << ends;
 		SimCallBack(Info, strBreakpoints.str());
 		fSomething = true;
 	}
@@ -4281,7 +5589,9 @@ bool ArchSim<ISA>::DisplayBreakpoints()
 			#else
 				#error "Only MSVC and GCC Compilers Supported"
 			#endif
-			strBreakpoints << MemIter->first.c_str() << sMessageBuffer << (const char *)*MemAddrIter->second.second << ends;
+			string sEvents;
+			MemAddrIter->second.second->Print(sEvents);
+			strBreakpoints << MemIter->first.c_str() << sMessageBuffer << sEvents.c_str() << ends;
 			SimCallBack(Info, strBreakpoints.str());
 		}
 		fSomething = true;
@@ -4298,7 +5608,9 @@ bool ArchSim<ISA>::DisplayBreakpoints()
 		for(typename RegisterMap::iterator RegIter = RegSetIter->second.begin(); RegIter != RegSetIter->second.end(); RegIter++)
 		{
 			ostrstream strBreakpoints;
-			strBreakpoints << RegSetIter->first.c_str() << "." << RegIter->first.c_str() << (const char *)*RegIter->second << ends;
+			string sEvents;
+			RegIter->second->Print(sEvents);
+			strBreakpoints << RegSetIter->first.c_str() << "." << RegIter->first.c_str() << sEvents.c_str() << ends;
 			SimCallBack(Info, strBreakpoints.str());
 		}
 	}
@@ -4307,14 +5619,16 @@ bool ArchSim<ISA>::DisplayBreakpoints()
 }
 
 template<class ISA>
-bool ArchSim<ISA>::WriteData(const RamVector &DataImage)
+bool ArchSim<ISA>::WriteData(const RamImage &DataImage)
 {
 	//The physical location(s) of logical data is determined by the architecture
-	return pArch->DataWrite(DataImage);
+	bool fRetVal = pArch->DataWrite(DataImage);
+	ClearJournal();
+	return fRetVal;
 }
 
 template<class ISA>
-bool ArchSim<ISA>::WriteMemory(const string &sMemory, const RamVector &DataImage)
+bool ArchSim<ISA>::WriteMemory(const string &sMemory, const RamImage &DataImage)
 {
 	//Check the memory name
 	if(pArch->Memories.find(sMemory) == pArch->Memories.end())
@@ -4325,7 +5639,11 @@ bool ArchSim<ISA>::WriteMemory(const string &sMemory, const RamVector &DataImage
 	}
 
 	//Assign the memory data
-	return pArch->Memories.find(sMemory)->second.Write(DataImage, SimCallBack);
+	Memory &TheMemory = pArch->Memories.find(sMemory)->second;
+	bool fRetVal = TheMemory.Write(DataImage, SimCallBack);
+	pArch->MemoryChanged(TheMemory, DataImage);
+	ClearJournal();
+	return fRetVal;
 }
 
 template<class ISA>
@@ -4368,6 +5686,7 @@ bool ArchSim<ISA>::WriteRegister(const string &sRegisterSet, const string &sRegi
 			return false;
 	}
 	RegIter->second = Value;
+	ClearJournal();
 
 	delete pNumber;
 	return true;
@@ -4409,14 +5728,33 @@ bool ArchSim<ISA>::SubInEvent(uint64 CallAddress, uint64 SubAddress)
 		}
 	}
 
-	//Update callstack
-	Element *pCallElement = AddressToElement(CallAddress, false, true);
+	//Update callstack. The caller's location is normally only refreshed when
+	//a run batch ends, so record the call site before pushing the new frame.
+	Element *pCallElement = AddressToElement(CallAddress, false, false);
+	CallStack.rbegin()->first = pCallElement ? TheContext.InputList[pCallElement->LocationStack.rbegin()->first] : sNoFile;
+	CallStack.rbegin()->second = pCallElement ? pCallElement->LocationStack.rbegin()->second : 0;
+	CallStack.rbegin()->third = CallAddress;
 	Element *pSubElement = AddressToElement(SubAddress, false, true);
-	CallStack.push_back( CallStackInfo(
-		pSubElement ? InputList[pSubElement->LocationStack.rbegin()->first] : "NoFile",
-		pSubElement ? pSubElement->LocationStack.rbegin()->second : 0,
-		SubAddress,
-		(pSubElement && pSubElement->ElementType == LabelElement ? reinterpret_cast<Label *>(pSubElement)->sLabel : "")) );
+	if(FreeCallFrames.empty())
+		CallStack.push_back(CallStackInfo());
+	else
+		CallStack.splice(CallStack.end(), FreeCallFrames, FreeCallFrames.begin());
+	CallStackInfo &SubInfo = *CallStack.rbegin();
+	SubInfo.first = pSubElement ? TheContext.InputList[pSubElement->LocationStack.rbegin()->first] : sNoFile;
+	SubInfo.second = pSubElement ? pSubElement->LocationStack.rbegin()->second : 0;
+	SubInfo.third = SubAddress;
+	if(pSubElement && pSubElement->ElementType == LabelElement)
+		SubInfo.fourth = reinterpret_cast<Label *>(pSubElement)->sLabel;
+	else
+		SubInfo.fourth.erase();
+	if(UndoJournal.fOn)
+		UndoJournal.LogCall();
+	if(Profile.fOn)
+	{
+		Profiler::Frame Caller = {&(++CallStack.rbegin())->fourth, &(++CallStack.rbegin())->first, (++CallStack.rbegin())->second};
+		Profiler::Frame Callee = {&SubInfo.fourth, &SubInfo.first, SubInfo.second};
+		Profile.Call(Caller, Callee);
+	}
 
 	if(fCheck && CallStack.size() >= MAX_CALLSTACK_DEPTH)
 	{
@@ -4456,12 +5794,39 @@ bool ArchSim<ISA>::SubOutEvent()
 			fBreak = true;
 		}
 	}
+	else if(UndoJournal.fOn)
+	{
+		//Keep the frame until the return is undone or falls off the journal
+		UndoJournal.LogReturn((++CallStack.rbegin())->third);
+		JournalCallFrames.splice(JournalCallFrames.end(), CallStack, --CallStack.end());
+	}
 	else
-		CallStack.pop_back();
+		FreeCallFrames.splice(FreeCallFrames.begin(), CallStack, --CallStack.end());
 
 	return true;
 }
 
+template<class ISA>
+void ArchSim<ISA>::ProfileSample()
+{
+	//The call-stack only has the current location once a batch is over
+	uint64 Address = pArch->NextInstruction();
+	Element *pElement = AddressToElement(Address, false, false);
+	CallStack.rbegin()->first = pElement ? TheContext.InputList[pElement->LocationStack.rbegin()->first] : "NoFile";
+	CallStack.rbegin()->second = pElement ? pElement->LocationStack.rbegin()->second : 0;
+	CallStack.rbegin()->third = Address;
+
+	ProfileFrames.resize(CallStack.size());
+	vector<Profiler::Frame>::iterator FrameIter = ProfileFrames.begin();
+	for(typename CallStackList::const_iterator CallIter = CallStack.begin(); CallIter != CallStack.end(); CallIter++, FrameIter++)
+	{
+		FrameIter->psFunction = &CallIter->fourth;
+		FrameIter->psFile = &CallIter->first;
+		FrameIter->Line = CallIter->second;
+	}
+	Profile.Sample(ProfileFrames, SimCycle);
+}
+
 template<class ISA>
 bool ArchSim<ISA>::InstructionEvent(uint64 Address)
 {
@@ -4474,7 +5839,7 @@ bool ArchSim<ISA>::InstructionEvent(uint64 Address)
 		fBreak = true;
 	}
 
-	if(fTrace || fCheck)
+	if(fTrace && !BinaryTraceFile.IsOpen() || fCheck)
 		pElement = AddressToElement(Address, false, true);
 	if(fCheck)
 	{
@@ -4484,7 +5849,16 @@ bool ArchSim<ISA>::InstructionEvent(uint64 Address)
 			fBreak = true;
 		}
 	}
-	if(fTrace)
+	if(fTrace && BinaryTraceFile.IsOpen())
+	{
+		TraceBinaryInstruction(SimCycle+1, Address);
+		if(!BinaryTraceFile.Good())
+		{
+			SimCallBack(Error, "Error writing to trace file.");
+			fBreak = true;
+		}
+	}
+	else if(fTrace)
 	{
 		#if defined _MSC_VER
 			sprintf(sMessageBuffer, "%I64u;\t%I64u;\t", SimCycle+1, SimInstruction);
@@ -4496,9 +5870,13 @@ bool ArchSim<ISA>::InstructionEvent(uint64 Address)
 		TraceFile << sMessageBuffer;
 		if(!PrintInstruction(TraceFile, pElement, Address))
 			return false;
+		sTraceRegisters.erase();
 		for(list<string>::iterator RegSetIter = TraceRegisterSets.begin(); RegSetIter != TraceRegisterSets.end(); RegSetIter++)
-			TraceFile << ";\t" << (const char *)pArch->RegisterSets.find(*RegSetIter)->second;
-		TraceFile << endl;
+		{
+			sTraceRegisters += ";\t";
+			pArch->RegisterSets.find(*RegSetIter)->second.Print(sTraceRegisters);
+		}
+		TraceFile << sTraceRegisters << endl;
 		if(!TraceFile.good())
 		{
 			SimCallBack(Error, "Error writing to trace file.");
@@ -4507,6 +5885,14 @@ bool ArchSim<ISA>::InstructionEvent(uint64 Address)
 	}
 
 	//See if there are breakpoints for this address
+	if(!InstrEvents[Address])
+		return false;
+	return InstructionBreakpointEvent(Address);
+}
+
+template<class ISA>
+bool ArchSim<ISA>::InstructionBreakpointEvent(uint64 Address)
+{
 	typename InstrMap::iterator InstrIter = InstrBreakpoints.find(Address);
 	if(InstrIter == InstrBreakpoints.end())
 		return false;
@@ -4515,7 +5901,7 @@ bool ArchSim<ISA>::InstructionEvent(uint64 Address)
 	strBreakpoints << "Instruction: ";
 	strBreakpoints << (const char *)*InstrIter->second.first << ":";
 	if(InstrIter->second.second.first)
-		strBreakpoints << " " << InputList[InstrIter->second.second.second].c_str() << "(" << InstrIter->second.second.third << ")";
+		strBreakpoints << " " << TheContext.InputList[InstrIter->second.second.second].c_str() << "(" << InstrIter->second.second.third << ")";
 	if(InstrIter->second.third == GotoEvent)
 		strBreakpoints << " GOTO";
 	strBreakpoints << ends;
@@ -4527,13 +5913,14 @@ bool ArchSim<ISA>::InstructionEvent(uint64 Address)
 	{
 		delete InstrIter->second.first;
 		InstrBreakpoints.erase(InstrIter);
+		InstrEvents.Remove(Address);
 	}
 
 	return true;
 }
 
 template<class ISA>
-bool ArchSim<ISA>::DataEvent(uint64 Address, EventEnum Events)
+bool ArchSim<ISA>::DataBreakpointEvent(uint64 Address, EventEnum Events)
 {
 	//See if there are breakpoints for this address
 	typename DataMap::iterator DataIter = DataBreakpoints.find(Address);
@@ -4551,7 +5938,7 @@ bool ArchSim<ISA>::DataEvent(uint64 Address, EventEnum Events)
 	if(pEvents->Events & Events & ValueEvent)
 	{
 		//Get the data for comparison
-		RamVector vData;
+		vector<unsigned char> vData;
 		pArch->DataRead(vData, Address, vDataBytes[DataType]);
 		RealNumber Real(NullLocationStack, vExponentBits[DataType], vMantissaBits[DataType], vData, ISA::fLittleEndian);
 		IntegerNumber Int(NullLocationStack, vData, ISA::fLittleEndian);
@@ -4605,7 +5992,7 @@ bool ArchSim<ISA>::DataEvent(uint64 Address, EventEnum Events)
 }
 
 template<class ISA>
-bool ArchSim<ISA>::MemoryEvent(const Memory &TheMem, uint64 Address, EventEnum Events)
+bool ArchSim<ISA>::MemoryBreakpointEvent(const Memory &TheMem, uint64 Address, EventEnum Events)
 {
 	//See if there are breakpoints for this memory
 	typename MemoryMap::iterator MemIter = MemoryBreakpoints.find(TheMem.sName);
@@ -4627,7 +6014,7 @@ bool ArchSim<ISA>::MemoryEvent(const Memory &TheMem, uint64 Address, EventEnum E
 	if(pEvents->Events & Events & ValueEvent)
 	{
 		//Get the data for comparison
-		RamVector vData;
+		vector<unsigned char> vData;
 		TheMem.Read(vData, Address, vDataBytes[DataType], SimCallBack);
 		RealNumber Real(NullLocationStack, vExponentBits[DataType], vMantissaBits[DataType], vData, ISA::fLittleEndian);
 		IntegerNumber Int(NullLocationStack, vData, ISA::fLittleEndian);
@@ -4689,7 +6076,7 @@ bool ArchSim<ISA>::MemoryEvent(const Memory &TheMem, uint64 Address, EventEnum E
 }
 
 template<class ISA>
-bool ArchSim<ISA>::RegisterEvent(const string &sRegisterSet, const Register &TheReg, EventEnum Events)
+bool ArchSim<ISA>::RegisterBreakpointEvent(const string &sRegisterSet, const Register &TheReg, EventEnum Events)
 {
 	//See if there are breakpoints for this register set
 	typename RegisterSetMap::iterator RegSetIter = RegisterBreakpoints.find(sRegisterSet);
@@ -4801,8 +6188,6 @@ ArchSim<ISA>::~ArchSim()
 		for(typename RegisterMap::iterator RegIter = RegSetIter->second.begin(); RegIter != RegSetIter->second.end(); RegIter++)
 			delete RegIter->second;
 	}
-
-	signal(SIGINT, OldSig);
 }
 
 }	//namespace Simulator
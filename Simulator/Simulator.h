@@ -10,8 +10,16 @@
 #include <list>
 #include <vector>
 #include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
 #include <string>
 #include "Architecture.h"
+#include "BinaryTrace.h"
+#include "Journal.h"
+#include "Pause.h"
+#include "Profiler.h"
+#include "StateFile.h"
 #include "../Assembler/Program.h"
 #include "../Assembler/Symbol.h"
 #include "../Assembler/Number.h"
@@ -29,6 +37,91 @@ namespace Simulator
 	//So it's just declared multiple times in each header
 //	extern const char *const sEventTypes[ValueEvent+1];
 	const char *const sEventTypes[ValueEvent+1] = {"NOEVENT", "READEVENT", "WRITEEVENT", "", "CHANGEEVENT", "", "", "", "VALUEEVENT"};
+	//Address ranges up to this many bits wide get a flat EventTable
+	const unsigned int MAX_DENSE_ADDRESS_BITS = 24;
+
+	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
+		EventTable
+
+		An instance of this class records which events have breakpoints at
+		each address of an address range, so that an event can be dismissed
+		with a single lookup before searching the breakpoint maps.
+
+		If the range is no wider than MAX_DENSE_ADDRESS_BITS, the table is a
+		flat array with one entry per address, which is only allocated once
+		the first address is added. Wider ranges use a sparse map instead.
+	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
+	class EventTable
+	{
+	protected:
+		//First and last address in the range
+		uint64 Begin, End;
+		//true if the flat array is used
+		bool fDense;
+		//Events for each address, offset by Begin
+		vector<unsigned char> Dense;
+		//Events for addresses which have any
+		map<uint64, unsigned char> Sparse;
+
+	public:
+		EventTable()
+		{
+			Begin = End = 0;
+			fDense = true;
+		}
+
+		//Set the address range (first address, last address) and clear the table
+		void Reset(uint64 begin, uint64 end)
+		{
+			Begin = begin;
+			End = end;
+			fDense = (End - Begin) >> MAX_DENSE_ADDRESS_BITS == 0;
+			Dense.clear();
+			Sparse.clear();
+		}
+
+		//Remove all events, keeping the address range
+		void Clear()
+		{
+			Dense.assign(Dense.size(), 0);
+			Sparse.clear();
+		}
+
+		//Add events at an address (address, events)
+		void Add(uint64 Address, unsigned char Events)
+		{
+			if(Address < Begin || Address > End)
+				return;
+			if(!fDense)
+				Sparse[Address] |= Events;
+			else
+			{
+				if(Dense.empty())
+					Dense.resize((size_t)(End - Begin) + 1, 0);
+				Dense[(size_t)(Address - Begin)] |= Events;
+			}
+		}
+
+		//Remove all events at an address
+		void Remove(uint64 Address)
+		{
+			if(!fDense)
+				Sparse.erase(Address);
+			else if(Address - Begin < Dense.size())
+				Dense[(size_t)(Address - Begin)] = 0;
+		}
+
+		//Events at an address
+		unsigned char operator[](uint64 Address) const
+		{
+			if(fDense)
+				return Address - Begin < Dense.size() ? Dense[(size_t)(Address - Begin)] : 0;
+			if(Sparse.empty())
+				return 0;
+			map<uint64, unsigned char>::const_iterator SparseIter = Sparse.find(Address);
+			return SparseIter == Sparse.end() ? 0 : SparseIter->second;
+		}
+	};
 
 	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
 		ArchSim
@@ -43,7 +136,7 @@ namespace Simulator
 		char sMessageBuffer[65 + MAX_FILENAME_CHAR];
 		Architecture *pArch;
 		vector<Program *> *pPrograms;
-		RamVector *pMemoryImage;
+		RamImage *pMemoryImage;
 
 		/**********************************************************************\
 			NullCallBack( [in] message type, [in] message,
@@ -56,16 +149,10 @@ namespace Simulator
 		bool (*SimReadConsole)(string &, unsigned int, unsigned int &);
 		bool (*SimWriteConsole)(const string &, unsigned int, unsigned int &);
 
-		//Each Simulator class owns one bit of this flag. 64 simultaneous simulators
-		//(possibly simulating a multi-processor system) and be paused
-		//asynchronously.
-		static uint64 fControlC;
-		//This is the next ID for simulator instances. So far only used for the
-		//pause flag (fControlC)
-		static uint64 NextSimID;
-		uint64 SimulatorID;
-		//Store old signal handler
-		void (*OldSig)(int);
+		//Set to pause the simulation asynchronously, from another thread or by
+		//Ctrl-C. Any number of simulators (possibly simulating a
+		//multi-processor system) can be paused independently.
+		PauseFlag Pause;
 //		friend class Architecture;
 		//True if should break to the simulator UI before the next run
 		bool fBreak;
@@ -80,6 +167,12 @@ namespace Simulator
 		bool fCheck;
 		ofstream TraceFile;
 		list<string> TraceRegisterSets;
+		//Trace written instead of TraceFile while it is open
+		BinaryTrace BinaryTraceFile;
+		//Bytes of the instruction word being traced
+		vector<unsigned char> TraceWord;
+		//Register sets of the line being traced. Kept so that its buffer is reused.
+		string sTraceRegisters;
 		//current cycle
 		uint64 SimCycle;
 		//current instruction
@@ -88,6 +181,21 @@ namespace Simulator
 		typedef tetra<string, unsigned int, uint64, string> CallStackInfo;
 		typedef list<CallStackInfo> CallStackList;
 		CallStackList CallStack;
+		//Frames returned from, kept so that calls reuse their nodes and strings
+		CallStackList FreeCallFrames;
+		//Sampling profile of the call-stack
+		Profiler Profile;
+		//Call-stack passed to the profiler. Kept so that its buffer is reused.
+		vector<Profiler::Frame> ProfileFrames;
+		//Undo journal of the recent cycles, for reverse execution
+		Journal UndoJournal;
+		//Frames returned from in journaled cycles, oldest first. They go
+		//back on the call-stack if the return is undone.
+		CallStackList JournalCallFrames;
+		//File and ID of the state last saved or loaded, which an
+		//incremental state is saved against. Empty if there is none.
+		string sStateBase;
+		uint64 StateBaseID;
 		//The number of instructions before and after the current instruction to print
 		unsigned int PreInstructionCount, PostInstructionCount;
 
@@ -119,11 +227,9 @@ namespace Simulator
 
 				return *this;
 			}
-			//Prints the event info
-			operator const char *()
+			//Appends the event info to the string
+			void Print(string &sEvents) const
 			{
-				static string sEvents;
-				sEvents = "";
 				if(Events == NoEvent)
 					(sEvents += " ") += sEventTypes[NoEvent];
 				if(Events & ReadEvent)
@@ -134,10 +240,9 @@ namespace Simulator
 					(sEvents += " ") += sEventTypes[ChangeEvent];
 				if(Events & ValueEvent)
 				{
-					for(list<Number *>::iterator ValueIter = ValueList.begin(); ValueIter != ValueList.end(); ValueIter++)
+					for(list<Number *>::const_iterator ValueIter = ValueList.begin(); ValueIter != ValueList.end(); ValueIter++)
 						(((sEvents += " ") += sEventTypes[ValueEvent]) += " ") += (const char *)**ValueIter;
 				}
-				return sEvents.c_str();
 			}
 			~EventInfo()
 			{
@@ -153,12 +258,16 @@ namespace Simulator
 		//	<address of instruction, info>
 		typedef map<uint64, InstrInfo> InstrMap;
 		InstrMap InstrBreakpoints;
+		//Addresses which have instruction breakpoints
+		EventTable InstrEvents;
 
 		//	<symbolic address of data, data type for value events, event info>
 		typedef tetra<Number *, DataEnum, LineInfo, EventInfo *> DataInfo;
 		//	<address of data, info>
 		typedef map<uint64, DataInfo> DataMap;
 		DataMap DataBreakpoints;
+		//Events which have data breakpoints at each address
+		EventTable DataEvents;
 
 		//	<data type for value events, event info>
 		typedef pair<DataEnum, EventInfo *> MemoryInfo;
@@ -174,6 +283,27 @@ namespace Simulator
 		typedef map<string, RegisterMap> RegisterSetMap;
 		RegisterSetMap RegisterBreakpoints;
 
+		//Indexed by Register::ID. True if the register has any breakpoints,
+		//so that events for everything else can be dismissed without looking
+		//up names.
+		vector<bool> WatchedRegisters;
+		//Indexed by Memory::ID. Events which have memory breakpoints at each
+		//address of the memory.
+		vector<EventTable> MemoryEvents;
+
+		//The elements of each segment and structure instance, in sequence
+		//order. Since the assembler lays elements out back to back, they are
+		//also in address order, which lets AddressToElement binary search them.
+		typedef map<Segment *, vector<Element *> > ElementIndexMap;
+		ElementIndexMap ElementIndex;
+
+		//<line number, <element, number of the program it is in>>
+		typedef map<unsigned int, pair<Element *, unsigned int> > LineMap;
+		//The elements on each line of each input file, indexed by input file
+		//number. Program files only have the elements from their own lines.
+		//Include files have the elements from every place they are included.
+		vector<LineMap> LineIndex;
+
 		//Cycle breakpoint
 		uint64 BreakCycle;
 		//Instruction breakpoint
@@ -182,12 +312,6 @@ namespace Simulator
 		bool fInBreakpoint, fOutBreakpoint, fOverBreakpoint;
 		unsigned int DepthCount;
 
-		/**********************************************************************\
-			ControlC( [in] signal type )
-
-			Called when Ctrl-C is pressed (used for pausing/breaking simulation)
-		\******/
-		static void ControlC(int sig);
 	
 	//*** Functions to process simulation commands ***
 
@@ -255,7 +379,7 @@ namespace Simulator
 			If starting address is not provided, it parses the first token
 			as the address.
 		\******/
-		virtual bool ParseElements(list<Token *>::iterator &, const list<Token *>::iterator &, const string &, unsigned int &, RamVector &, Number *pNumber = NULL);
+		virtual bool ParseElements(list<Token *>::iterator &, const list<Token *>::iterator &, const string &, unsigned int &, RamImage &, Number *pNumber = NULL);
 
 		/**********************************************************************\
 			LineToAddress( [in] true if program number specified,
@@ -266,12 +390,24 @@ namespace Simulator
 			address. If the program number is not specified, it guesses the
 			program number.
 
+			The program number may also be the input file number of an
+			include file. The program number is then changed to the number
+			of the program the line's element was found in.
+
 			If the line number does not point to an element, it will be
 			moved to the next available element, and the line number is updated
 			to the new one.
 		\******/
 		virtual Number *LineToAddress(bool, unsigned int &, unsigned int &, const string &);
 
+		/**********************************************************************\
+			IndexLines( )
+
+			Rebuilds LineIndex from the programs. Must be called whenever
+			the programs' elements change.
+		\******/
+		void IndexLines();
+
 		/**********************************************************************\
 			AddressToElement( [in] address, [in] true if inside element
 				[in] true if find label element )
@@ -287,6 +423,31 @@ namespace Simulator
 		\******/
 		virtual Element *AddressToElement(uint64, bool fInside = true, bool fLabel = false);
 
+		/**********************************************************************\
+			SegmentToElement( [in] segment, [in] address,
+				[in] true if inside element, [in] true if find label element )
+
+			Finds the element of the segment that corresponds to the given
+			address, using ElementIndex. Called by AddressToElement once the
+			segment is known, and for structure instances.
+		\******/
+		Element *SegmentToElement(Segment *, uint64, bool, bool);
+
+		/**********************************************************************\
+			IndexElements( )
+
+			Rebuilds ElementIndex from the programs. Must be called whenever
+			the programs' elements change.
+		\******/
+		void IndexElements();
+
+		/**********************************************************************\
+			IndexSegment( [in] segment )
+
+			Adds the segment and the structure instances in it to ElementIndex.
+		\******/
+		void IndexSegment(Segment *);
+
 		/**********************************************************************\
 			PrintInstruction( [in] output stream, [in] element to print,
 				[in] address, [in] true if print file info,
@@ -331,18 +492,40 @@ namespace Simulator
 				[in-out] memory image)
 
 			This initializes the specified architecture using the specified
-			program and associated memory image.
+			program and associated memory image. The architecture then takes
+			a snapshot of its initial state for Reset().
 		\******/
-		virtual bool Reset(Architecture &, vector<Program *> &, RamVector &);	
+		virtual bool Reset(Architecture &, vector<Program *> &, RamImage &);	
 
 		/**********************************************************************\
-			TraceOn( [in] file name, [in] trace register set list )
+			Reset( )
+
+			Returns the architecture to its state right after the last
+			initialization by restoring its snapshot, which only copies back
+			the memory pages written since. The programs are not indexed again.
+			If the architecture could not take a snapshot, this does a full
+			initialization instead.
+		\******/
+		virtual bool Reset();
+
+		/**********************************************************************\
+			ResetSimulation( )
+
+			Clears the cycle and instruction counts, breakpoint state, and
+			call stack, for a freshly reset architecture.
+		\******/
+		void ResetSimulation();
+
+		/**********************************************************************\
+			TraceOn( [in] file name, [in] trace register set list,
+				[in] true for a binary trace )
 
 			Opens the given file and sets it up as a trace file.
 			Every instruction along with a snapshot of the specified register
-			sets will be traced to the file.
+			sets will be traced to the file. A binary trace only records the
+			registers which changed, and is decoded by the LC3Trace tool.
 		\******/
-		virtual bool TraceOn(string, list<string> &);
+		virtual bool TraceOn(string, list<string> &, bool fBinary = false);
 
 		/**********************************************************************\
 			TraceOff( )
@@ -351,6 +534,9 @@ namespace Simulator
 		\******/
 		virtual bool TraceOff();
 
+		//Write the instruction at the address to the binary trace (cycle, address)
+		void TraceBinaryInstruction(uint64, uint64);
+
 		/**********************************************************************\
 			CheckOn( )
 
@@ -366,15 +552,179 @@ namespace Simulator
 		virtual bool CheckOff();
 
 		/**********************************************************************\
-			SaveState( [in] file name )
+			JournalOn( [in] maximum entries )
+
+			Starts journaling every cycle so that it can be undone. The
+			maximum number of entries can be NULL for the default.
+		\******/
+		virtual bool JournalOn(Number *);
+
+		/**********************************************************************\
+			JournalOff( )
+
+			Stops journaling and frees the journal.
+		\******/
+		virtual bool JournalOff();
+
+		/**********************************************************************\
+			ClearJournal( )
+
+			Forgets the journaled cycles. Called whenever the state is changed
+			by something other than a cycle.
+		\******/
+		void ClearJournal();
+
+		/**********************************************************************\
+			StatsOn( )
+
+			Clears the architecture's execution statistics and starts
+			counting.
+		\******/
+		virtual bool StatsOn();
+
+		/**********************************************************************\
+			StatsOff( )
+
+			Stops counting. The statistics are kept until the next StatsOn
+			or reset.
+		\******/
+		virtual bool StatsOff();
+
+		/**********************************************************************\
+			SaveStats( [in] file name, [in] format )
+
+			Writes the execution statistics to the given file as "csv" or
+			"json". If the format is empty, it is taken from the extension.
+		\******/
+		virtual bool SaveStats(const string &, const string &);
+
+		/**********************************************************************\
+			ProfileOn( [in] cycles between samples )
+
+			Clears the profile and starts sampling the call-stack. If the
+			number is NULL, the default interval is used.
+		\******/
+		virtual bool ProfileOn(Number *);
+
+		/**********************************************************************\
+			ProfileOff( )
+
+			Stops sampling. The profile is kept until the next ProfileOn
+			or reset.
+		\******/
+		virtual bool ProfileOff();
+
+		/**********************************************************************\
+			SaveProfile( [in] file name, [in] format )
+
+			Writes the profile to the given file as "folded" stacks or in the
+			"callgrind" format. If the format is empty, callgrind is used
+			when the file name contains "callgrind".
+		\******/
+		virtual bool SaveProfile(const string &, const string &);
+
+		/**********************************************************************\
+			CacheOn( )
+
+			Empties the architecture's caches, clears their statistics, and
+			starts modelling them. Each access adds the latency of the levels
+			it reaches to the cycle count.
+		\******/
+		virtual bool CacheOn();
+
+		/**********************************************************************\
+			CacheOff( )
+
+			Stops modelling the caches. The statistics are kept until the
+			next CacheOn or reset.
+		\******/
+		virtual bool CacheOff();
+
+		/**********************************************************************\
+			SetCache( [in] level name, [in] size, [in] line size, [in] ways,
+				[in] replacement policy name, [in] latency )
+
+			Sets the geometry of the "l1i", "l1d", or "l2" cache, and empties
+			it. Setting the L2 cache turns it on. The policy is "lru",
+			"plru", or "random", or LRU if empty.
+		\******/
+		virtual bool SetCache(const string &, uint64, unsigned int, unsigned int, const string &, unsigned int);
+
+		/**********************************************************************\
+			L2CacheOff( )
+
+			Stops using the L2 cache, so level 1 misses go to memory.
+		\******/
+		virtual bool L2CacheOff();
+
+		/**********************************************************************\
+			SetMemoryLatency( [in] latency )
+
+			Sets the cycles added to an access which reaches memory.
+		\******/
+		virtual bool SetMemoryLatency(unsigned int);
+
+		/**********************************************************************\
+			BranchOn( )
+
+			Empties the architecture's branch predictor, clears its
+			statistics, and starts modelling branches. Each misprediction
+			adds the penalty to the cycle count.
+		\******/
+		virtual bool BranchOn();
+
+		/**********************************************************************\
+			BranchOff( )
+
+			Stops modelling branches. The statistics are kept until the next
+			BranchOn or reset.
+		\******/
+		virtual bool BranchOff();
+
+		/**********************************************************************\
+			SetPredictor( [in] predictor name, [in] index bits )
+
+			Selects the "bimodal", "gshare", or "tournament" conditional
+			branch predictor, with tables of 2^bits entries, and empties it.
+		\******/
+		virtual bool SetPredictor(const string &, unsigned int);
+
+		/**********************************************************************\
+			SetReturnStack( [in] depth )
+
+			Sets the entries in the return address stack, and empties it.
+		\******/
+		virtual bool SetReturnStack(unsigned int);
+
+		/**********************************************************************\
+			SetBranchPenalty( [in] cycles )
+
+			Sets the cycles added by each misprediction.
+		\******/
+		virtual bool SetBranchPenalty(unsigned int);
+
+		/**********************************************************************\
+			SetEngine( [in] engine name )
+
+			Selects the engine the architecture uses to execute cycles.
+			All engines share the same architectural state, so the engine
+			may be changed at any point during simulation.
+		\******/
+		virtual bool SetEngine(const string &);
+
+		/**********************************************************************\
+			SaveState( [in] file name, [in] true if incremental )
 
 			Opens the given file and writes the simulator state to it.
 			This includes writing all rams and register sets, as well as
 			any architecture state not already in the registers, and any
-			required simulator state. Each saved component is written to a
-			different file using the component name in the extension.
+			required simulator state. Each component is a section of the
+			one StateFile.
+
+			An incremental state only writes the memory pages written since
+			the state last saved or loaded, and refers to that state's file.
 		\******/
-		virtual bool SaveState(string);
+		virtual bool SaveState(string, bool fIncremental = false);
 
 		/**********************************************************************\
 			LoadState( [in] file name )
@@ -382,8 +732,9 @@ namespace Simulator
 			Opens the given file and reads the simulator state from it.
 			This includes loading all rams and register sets, as well as
 			any architecture state not already in the registers, and any
-			required simulator state. Each saved component is read from a
-			different file using the component name in the extension.
+			required simulator state. The file is mapped, and memory pages
+			are copied straight out of it. The base of an incremental state
+			is loaded first.
 
 			If load state returns false (failure), it is highly recommended
 			that the simulator be reset, since the state of the simulator
@@ -520,6 +871,41 @@ namespace Simulator
 		\******/
 		virtual bool GotoI(Number *, unsigned int);
 
+		/**********************************************************************\
+			StepBack( )
+
+			Undoes the last instruction.
+		\******/
+		virtual bool StepBack();
+
+		/**********************************************************************\
+			GoBack( )
+
+			Undoes cycles until a breakpoint is reached or the journal runs
+			out.
+		\******/
+		virtual bool GoBack();
+
+		/**********************************************************************\
+			GoBack( [in] cycle count )
+
+			Undoes cycles until a breakpoint is reached or cycle count cycles
+			have been undone.
+		\******/
+		virtual bool GoBack(Number *);
+
+		/**********************************************************************\
+			Undo( [in] maximum cycles, [in] maximum instructions,
+				[in] true to stop at breakpoints )
+
+			Undoes journaled cycles, newest first, until either maximum is
+			reached. Undoing a write is checked against data, memory, and
+			register breakpoints as if it were a write of the old value, and
+			the instruction each undone cycle returns to is checked against
+			instruction breakpoints.
+		\******/
+		bool Undo(uint64, uint64, bool);
+
 		/**********************************************************************\
 			BreakpointLine( [in] true if program number specified,
 				[in] program number, [in] line number, [in] event info )
@@ -592,6 +978,15 @@ namespace Simulator
 		\******/
 		virtual bool BreakpointRegisterClear();
 
+		/**********************************************************************\
+			UpdateWatched( )
+
+			Rebuilds WatchedRegisters, InstrEvents, DataEvents and
+			MemoryEvents from the breakpoint maps. Must be called whenever
+			they change.
+		\******/
+		void UpdateWatched();
+
 		/**********************************************************************\
 			DisplayHelp( [in] command name )
 
@@ -717,6 +1112,45 @@ namespace Simulator
 		\******/
 		virtual bool DisplayPipelines();
 
+		/**********************************************************************\
+			DisplayEngines( )
+
+			Displays the names of the architecture's execution engines and
+			which one is selected.
+		\******/
+		virtual bool DisplayEngines();
+
+		/**********************************************************************\
+			DisplayStats( [in] instruction count )
+
+			Displays the execution statistics, followed by the given number
+			of most executed instructions.
+		\******/
+		virtual bool DisplayStats(unsigned int);
+
+		/**********************************************************************\
+			DisplayProfile( [in] count )
+
+			Displays the given number of functions with the most inclusive
+			cycles, and of source lines with the most exclusive cycles.
+		\******/
+		virtual bool DisplayProfile(unsigned int);
+
+		/**********************************************************************\
+			DisplayCache( )
+
+			Displays the geometry and statistics of each cache level.
+		\******/
+		virtual bool DisplayCache();
+
+		/**********************************************************************\
+			DisplayBranches( [in] count )
+
+			Displays the accuracy and MPKI of each kind of branch, and the
+			given number of branches with the most mispredictions.
+		\******/
+		virtual bool DisplayBranches(unsigned int);
+
 		/**********************************************************************\
 			DisplayCycleInstruction( )
 
@@ -751,14 +1185,14 @@ namespace Simulator
 
 			Performs a write to program memory by the user interface.
 		\******/
-		virtual bool WriteData(const RamVector &);
+		virtual bool WriteData(const RamImage &);
 
 		/**********************************************************************\
 			WriteMemory( [in] memory name, [in] memory image )
 
 			Performs a write to memory by the user interface.
 		\******/
-		virtual bool WriteMemory(const string &, const RamVector &);
+		virtual bool WriteMemory(const string &, const RamImage &);
 
 		/**********************************************************************\
 			WriteRegister( [in] register set name, [in] register name,
@@ -797,7 +1231,7 @@ namespace Simulator
 			line mode until a command is given to run the architecture.
 			The architecture runs until a breakpoint occurs
 		\******/
-		virtual bool CommandRun(Architecture &, vector<Program *> &, RamVector &);	
+		virtual bool CommandRun(Architecture &, vector<Program *> &, RamImage &);	
 
 		/**********************************************************************\
 			Run( )
@@ -810,6 +1244,21 @@ namespace Simulator
 		\******/
 		virtual bool Run();	
 
+		/**********************************************************************\
+			RunBatch( [in] maximum number of cycles )
+
+			This runs up to the given number of cycles in one call, stopping
+			early on any break condition (cycle, instruction, breakpoint,
+			Ctrl-C, etc). The Ctrl-C handler is installed once for the whole
+			batch and the source location at the top of the call-stack is
+			only updated when the batch ends, so this is much cheaper per
+			cycle than calling Run() repeatedly.
+
+			The simulator MUST have been initialized via a call to Reset()
+			first.
+		\******/
+		virtual bool RunBatch(uint64);
+
 		//Destructor
 		~ArchSim();
 
@@ -834,6 +1283,14 @@ namespace Simulator
 		\******/
 		bool SubOutEvent();
 
+		/**********************************************************************\
+			ProfileSample( )
+
+			Passes the call-stack, with the current location on top, to the
+			profiler.
+		\******/
+		void ProfileSample();
+
 		/**********************************************************************\
 			InstructionEvent( [in] memory address )
 
@@ -842,29 +1299,99 @@ namespace Simulator
 		\******/
 		bool InstructionEvent(uint64);
 
+		/**********************************************************************\
+			InstructionsEvent( [in] number of instructions )
+
+			Counts instructions which were executed without an instruction
+			event each, and breaks if they reach the instruction limit. Only
+			for compiled code, which does not run while anything else could
+			see the instruction events.
+		\******/
+		void InstructionsEvent(uint64 Count)
+		{
+			uint64 Start = SimInstruction;
+			SimInstruction += Count;
+			if(BreakInstruction > Start && BreakInstruction <= SimInstruction)
+			{
+				SimCallBack(Breakpoint, "Instruction limit.");
+				fBreak = true;
+			}
+		}
+
+		/**********************************************************************\
+			InstructionBreakpointEvent( [in] memory address )
+
+			Looks up the breakpoint for an instruction event on a watched
+			address.
+		\******/
+		bool InstructionBreakpointEvent(uint64);
+
 		/**********************************************************************\
 			DataEvent( [in] memory address, [in] event type )
 
 			Checks to see if a breakpoint is waiting on this data event.
-			Parameter must be a byte address.
+			Parameter must be a byte address. Only calls DataBreakpointEvent
+			if DataEvents has a breakpoint for the event at this address.
+		\******/
+		bool DataEvent(uint64 Address, EventEnum Events)
+		{
+			if(!(DataEvents[Address] & Events))
+				return false;
+			return DataBreakpointEvent(Address, Events);
+		}
+
+		/**********************************************************************\
+			DataBreakpointEvent( [in] memory address, [in] event type )
+
+			Looks up the breakpoint for a data event on a watched address.
 		\******/
-		bool DataEvent(uint64, EventEnum);
+		bool DataBreakpointEvent(uint64, EventEnum);
 
 		/**********************************************************************\
 			MemoryEvent( [in] the memory, [in] memory address,
 				[in] event type )
 
 			Checks to see if a breakpoint is waiting on this memory event.
+			Only calls MemoryBreakpointEvent if MemoryEvents has a breakpoint
+			for the event at this address.
+		\******/
+		bool MemoryEvent(const Memory &TheMem, uint64 Address, EventEnum Events)
+		{
+			if(TheMem.ID >= MemoryEvents.size() || !(MemoryEvents[TheMem.ID][Address] & Events))
+				return false;
+			return MemoryBreakpointEvent(TheMem, Address, Events);
+		}
+
+		/**********************************************************************\
+			MemoryBreakpointEvent( [in] the memory, [in] memory address,
+				[in] event type )
+
+			Looks up the breakpoint for a memory event on a watched memory.
 		\******/
-		bool MemoryEvent(const Memory &, uint64, EventEnum);
+		bool MemoryBreakpointEvent(const Memory &, uint64, EventEnum);
 
 		/**********************************************************************\
 			RegisterEvent( [in] register set name, [in] the register,
 				[in] event type )
 
 			Checks to see if a breakpoint is waiting on this register event.
+			Only calls RegisterBreakpointEvent if the register is watched.
+		\******/
+		bool RegisterEvent(const string &sRegisterSet, const Register &TheReg, EventEnum Events)
+		{
+			if(TheReg.ID >= WatchedRegisters.size() || !WatchedRegisters[TheReg.ID])
+				return false;
+			return RegisterBreakpointEvent(sRegisterSet, TheReg, Events);
+		}
+
+		/**********************************************************************\
+			RegisterBreakpointEvent( [in] register set name, [in] the register,
+				[in] event type )
+
+			Looks up the breakpoint for a register event on a watched
+			register.
 		\******/
-		bool RegisterEvent(const string &, const Register &, EventEnum);
+		bool RegisterBreakpointEvent(const string &, const Register &, EventEnum);
 
 		/**********************************************************************\
 			ReadConsole( [out] input buffer, [in] characters to read,
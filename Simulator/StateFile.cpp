@@ -0,0 +1,270 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#include "StateFile.h"
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+using namespace std;
+using namespace JMT;
+
+namespace Simulator	{
+
+//Integers are stored little endian whatever the build
+static void PutInt(unsigned char *pBytes, uint64 Value, unsigned int Bytes)
+{
+	for(unsigned int i = 0; i < Bytes; i++)
+		pBytes[i] = (unsigned char)(Value >> 8 * i);
+}
+
+static uint64 GetInt(const unsigned char *pBytes, unsigned int Bytes)
+{
+	uint64 Value = 0;
+	for(unsigned int i = 0; i < Bytes; i++)
+		Value |= (uint64)pBytes[i] << 8 * i;
+	return Value;
+}
+
+//Round up to the next page boundary
+static uint64 PageAlign(uint64 Offset)
+{
+	return (Offset + MEMORY_PAGE_BYTES - 1) & ~(uint64)(MEMORY_PAGE_BYTES - 1);
+}
+
+StateFile::StateFile()
+{
+	fIncremental = false;
+	StateID = 0;
+	BaseID = 0;
+	pMapped = NULL;
+	MappedSize = 0;
+	hFile = MAPPED_FILE_NONE;
+	hMapping = MAPPED_FILE_NONE;
+}
+
+StateFile::~StateFile()
+{
+	Close();
+}
+
+void StateFile::AddSection(unsigned int Type, const string &sName, const string &sData)
+{
+	Sections.push_back(Section());
+	Section &TheSection = Sections.back();
+	TheSection.Type = Type;
+	TheSection.Flags = 0;
+	TheSection.Offset = 0;
+	TheSection.Size = sData.size();
+	TheSection.Count = 0;
+	TheSection.sName = sName;
+	TheSection.sData = sData;
+	TheSection.pMemory = NULL;
+}
+
+void StateFile::AddMemory(const Memory &TheMemory, const vector<size_t> &Pages, bool fFull)
+{
+	AddSection(MemorySection, TheMemory.sName, "");
+	Section &TheSection = Sections.back();
+	TheSection.Flags = (fFull ? FULL_MEMORY : 0);
+	TheSection.Count = Pages.size();
+	TheSection.Size = PageAlign(Pages.size() * sizeof(uint64)) + Pages.size() * MEMORY_PAGE_BYTES;
+	TheSection.pMemory = &TheMemory;
+	TheSection.Pages = Pages;
+}
+
+bool StateFile::Write(const string &sFileName, SimCallBackFunction)
+{
+	//Buffer for formatting error messages
+	char sMessageBuffer[384];
+	unsigned char Header[STATE_HEADER_BYTES];
+	vector<unsigned char> Table(Sections.size() * STATE_SECTION_BYTES, 0);
+	vector<Section>::iterator SectionIter;
+
+	//Lay out the sections after the table
+	uint64 Offset = PageAlign(STATE_HEADER_BYTES + Table.size());
+	for(SectionIter = Sections.begin(); SectionIter != Sections.end(); SectionIter++)
+	{
+		if(SectionIter->sName.size() > STATE_NAME_LENGTH)
+		{
+			sprintf(sMessageBuffer, "State section name %.63s is longer than %u characters.", SectionIter->sName.c_str(), STATE_NAME_LENGTH);
+			SimCallBack(Error, sMessageBuffer);
+			return false;
+		}
+		SectionIter->Offset = Offset;
+		Offset = PageAlign(Offset + SectionIter->Size);
+
+		unsigned char *pEntry = &Table[(SectionIter - Sections.begin()) * STATE_SECTION_BYTES];
+		PutInt(pEntry, SectionIter->Type, 4);
+		PutInt(pEntry + 4, SectionIter->Flags, 4);
+		PutInt(pEntry + 8, SectionIter->Offset, 8);
+		PutInt(pEntry + 16, SectionIter->Size, 8);
+		PutInt(pEntry + 24, SectionIter->Count, 8);
+		memcpy(pEntry + 32, SectionIter->sName.data(), SectionIter->sName.size());
+	}
+
+	memset(Header, 0, STATE_HEADER_BYTES);
+	memcpy(Header, "ASHSTATE", 8);
+	PutInt(Header + 8, STATE_FILE_VERSION, 4);
+	PutInt(Header + 12, fIncremental ? INCREMENTAL : 0, 4);
+	PutInt(Header + 16, MEMORY_PAGE_BYTES, 4);
+	PutInt(Header + 20, Sections.size(), 4);
+	PutInt(Header + 24, STATE_HEADER_BYTES, 8);
+	PutInt(Header + 32, StateID, 8);
+	PutInt(Header + 40, BaseID, 8);
+
+	ofstream OutputFile(sFileName.c_str(), ios::out | ios::binary | ios::trunc);
+	if(!OutputFile.good())
+	{
+		sprintf(sMessageBuffer, "Unable to open file %.255s", sFileName.c_str());
+		SimCallBack(Fatal, sMessageBuffer);
+		return false;
+	}
+	OutputFile.write((const char *)Header, STATE_HEADER_BYTES);
+	if(!Table.empty())
+		OutputFile.write((const char *)&Table[0], Table.size());
+	Offset = STATE_HEADER_BYTES + Table.size();
+
+	static const char Padding[MEMORY_PAGE_BYTES] = {0};
+	for(SectionIter = Sections.begin(); SectionIter != Sections.end(); SectionIter++)
+	{
+		OutputFile.write(Padding, (streamsize)(SectionIter->Offset - Offset));
+		Offset = SectionIter->Offset + SectionIter->Size;
+		if(!SectionIter->pMemory)
+		{
+			OutputFile.write(SectionIter->sData.data(), SectionIter->sData.size());
+			continue;
+		}
+
+		//Page numbers, then the pages themselves from the flat memory
+		const vector<MemoryLocation> &Flat = SectionIter->pMemory->Flat;
+		vector<unsigned char> PageNumbers((size_t)PageAlign(SectionIter->Pages.size() * sizeof(uint64)), 0);
+		size_t i;
+		for(i = 0; i < SectionIter->Pages.size(); i++)
+			PutInt(&PageNumbers[i * sizeof(uint64)], SectionIter->Pages[i], 8);
+		if(!PageNumbers.empty())
+			OutputFile.write((const char *)&PageNumbers[0], PageNumbers.size());
+		for(i = 0; i < SectionIter->Pages.size(); i++)
+		{
+			size_t Index = SectionIter->Pages[i] << MEMORY_PAGE_BITS;
+			size_t Length = MIN((size_t)MEMORY_PAGE_BYTES, Flat.size() - Index);
+			OutputFile.write((const char *)&Flat[Index], Length);
+			OutputFile.write(Padding, MEMORY_PAGE_BYTES - Length);
+		}
+	}
+
+	if(!OutputFile.good())
+	{
+		sprintf(sMessageBuffer, "Error writing to %.255s", sFileName.c_str());
+		SimCallBack(Error, sMessageBuffer);
+		return false;
+	}
+	return true;
+}
+
+bool StateFile::Open(const string &sFileName, SimCallBackFunction)
+{
+	//Buffer for formatting error messages
+	char sMessageBuffer[384];
+
+	Close();
+	Sections.clear();
+	MAPPED_FILE_OPEN(sFileName.c_str(), hFile, hMapping, pMapped, MappedSize);
+	if(hFile == MAPPED_FILE_NONE)
+	{
+		sprintf(sMessageBuffer, "Unable to open file %.255s", sFileName.c_str());
+		SimCallBack(Fatal, sMessageBuffer);
+		return false;
+	}
+
+	if(!pMapped || MappedSize < STATE_HEADER_BYTES || memcmp(pMapped, "ASHSTATE", 8))
+	{
+		sprintf(sMessageBuffer, "%.255s is not a simulator state file.", sFileName.c_str());
+		SimCallBack(Error, sMessageBuffer);
+		Close();
+		return false;
+	}
+	if(GetInt(pMapped + 8, 4) != STATE_FILE_VERSION || GetInt(pMapped + 16, 4) != MEMORY_PAGE_BYTES)
+	{
+		sprintf(sMessageBuffer, "%.255s was saved by a different version of the simulator.", sFileName.c_str());
+		SimCallBack(Error, sMessageBuffer);
+		Close();
+		return false;
+	}
+
+	fIncremental = (GetInt(pMapped + 12, 4) & INCREMENTAL) != 0;
+	uint64 SectionCount = GetInt(pMapped + 20, 4);
+	uint64 TableOffset = GetInt(pMapped + 24, 8);
+	StateID = GetInt(pMapped + 32, 8);
+	BaseID = GetInt(pMapped + 40, 8);
+
+	//Every section must lie inside the file
+	bool fValid = TableOffset <= MappedSize && SectionCount <= (MappedSize - TableOffset) / STATE_SECTION_BYTES;
+	for(uint64 i = 0; fValid && i < SectionCount; i++)
+	{
+		const unsigned char *pEntry = pMapped + TableOffset + i * STATE_SECTION_BYTES;
+		Section TheSection;
+		TheSection.Type = (unsigned int)GetInt(pEntry, 4);
+		TheSection.Flags = (unsigned int)GetInt(pEntry + 4, 4);
+		TheSection.Offset = GetInt(pEntry + 8, 8);
+		TheSection.Size = GetInt(pEntry + 16, 8);
+		TheSection.Count = GetInt(pEntry + 24, 8);
+		TheSection.sName.assign((const char *)pEntry + 32, STATE_NAME_LENGTH);
+		TheSection.sName.resize(strlen(TheSection.sName.c_str()));
+		TheSection.pMemory = NULL;
+
+		if(TheSection.Offset > MappedSize || TheSection.Size > MappedSize - TheSection.Offset)
+			fValid = false;
+		else if(TheSection.Type == MemorySection && (TheSection.Count > TheSection.Size / MEMORY_PAGE_BYTES || PageAlign(TheSection.Count * sizeof(uint64)) + TheSection.Count * MEMORY_PAGE_BYTES != TheSection.Size))
+			fValid = false;
+		else
+			Sections.push_back(TheSection);
+	}
+	if(!fValid)
+	{
+		sprintf(sMessageBuffer, "%.255s is truncated or corrupt.", sFileName.c_str());
+		SimCallBack(Error, sMessageBuffer);
+		Close();
+		return false;
+	}
+
+	return true;
+}
+
+void StateFile::Close()
+{
+	if(hFile != MAPPED_FILE_NONE)
+		MAPPED_FILE_CLOSE(hFile, hMapping, pMapped, MappedSize);
+	pMapped = NULL;
+	MappedSize = 0;
+	hFile = MAPPED_FILE_NONE;
+	hMapping = MAPPED_FILE_NONE;
+}
+
+const StateFile::Section *StateFile::Find(unsigned int Type, const string &sName) const
+{
+	for(vector<Section>::const_iterator SectionIter = Sections.begin(); SectionIter != Sections.end(); SectionIter++)
+		if(SectionIter->Type == Type && SectionIter->sName == sName)
+			return &*SectionIter;
+	return NULL;
+}
+
+uint64 StateFile::PageNumber(const Section &TheSection, size_t i) const
+{
+	return GetInt(Data(TheSection) + i * sizeof(uint64), 8);
+}
+
+const unsigned char *StateFile::PageData(const Section &TheSection, size_t i) const
+{
+	return Data(TheSection) + PageAlign(TheSection.Count * sizeof(uint64)) + i * MEMORY_PAGE_BYTES;
+}
+
+uint64 StateFile::NewID()
+{
+	static unsigned int Count = 0;
+	return ((uint64)time(NULL) << 32) ^ ((uint64)clock() << 12) ^ ++Count;
+}
+
+}	//namespace Simulator
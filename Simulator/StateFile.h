@@ -0,0 +1,134 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#ifndef STATEFILE_H
+#define STATEFILE_H
+
+#pragma warning (disable:4786)
+#include <vector>
+#include <string>
+#include "Memory.h"
+#include "../Assembler/Base.h"
+
+using namespace std;
+using namespace JMT;
+
+namespace Simulator
+{
+	//Format version written to the header of state files
+	const unsigned int STATE_FILE_VERSION = 1;
+	//Byte size of the header and of each entry of the section table
+	const unsigned int STATE_HEADER_BYTES = 64;
+	const unsigned int STATE_SECTION_BYTES = 64;
+	//Longest name a section may have
+	const unsigned int STATE_NAME_LENGTH = 32;
+
+	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
+		StateFile
+
+		An instance of this class writes or reads a saved simulator state.
+		The whole state is one file, made of a header, a section table, and
+		the sections. Every integer in the header and table is stored little
+		endian.
+
+		Header: "ASHSTATE", version, flags, page bytes, section count, table
+		offset, ID of this state, and the ID of its base state.
+
+		Section table entry: type, flags, offset, byte size, count, name.
+
+		Each section begins on a MEMORY_PAGE_BYTES boundary. A memory
+		section holds Count page numbers followed by Count pages of data,
+		so the pages can be copied straight out of the mapped file. A full
+		memory section holds every page which is not uninitialized, and the
+		memory is cleared before they are loaded. Otherwise the pages are
+		laid over the memory of the base state.
+
+		An incremental state only holds the memory pages written since its
+		base state, and names the base file in a base section. The base
+		has to be loaded first.
+
+		Reading maps the file into memory rather than streaming it.
+	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
+	class StateFile
+	{
+	public:
+		enum SectionEnum {SimSection = 1, ArchSection, RegisterSetSection, MemorySection, StreamMemorySection, BaseSection};
+		//Section flag of a memory section which replaces the whole memory
+		static const unsigned int FULL_MEMORY = 1;
+		//Header flag of an incremental state
+		static const unsigned int INCREMENTAL = 1;
+
+		class Section
+		{
+		public:
+			//SectionEnum
+			unsigned int Type;
+			unsigned int Flags;
+			//Byte offset and size of the section in the file
+			uint64 Offset, Size;
+			//Number of pages in a memory section
+			uint64 Count;
+			//Name of the memory or register set
+			string sName;
+			//Data of a section being written. Memory sections write their
+			//pages straight from pMemory.
+			string sData;
+			const Memory *pMemory;
+			vector<size_t> Pages;
+		};
+
+		//true if this state only holds the changes since its base state
+		bool fIncremental;
+		//Unique ID of this state, and of the base state if incremental
+		uint64 StateID, BaseID;
+		vector<Section> Sections;
+
+		StateFile();
+		~StateFile();
+
+		//Add a section of bytes to write (type, name, data)
+		void AddSection(unsigned int, const string &, const string &);
+		//Add a memory section to write (memory, page numbers, true if full)
+		void AddMemory(const Memory &, const vector<size_t> &, bool);
+
+		/**********************************************************************\
+			Write( [in] file name, [in] callback )
+
+			Lays out the sections added so far and writes the file.
+		\******/
+		bool Write(const string &, SimCallBackFunction);
+
+		/**********************************************************************\
+			Open( [in] file name, [in] callback )
+
+			Maps the file into memory and reads its header and section
+			table. Returns false if the file is missing or is not a valid
+			state file. The sections stay readable until Close.
+		\******/
+		bool Open(const string &, SimCallBackFunction);
+
+		//Unmap the file
+		void Close();
+
+		//Find a section by type and name. Returns NULL if there is none.
+		const Section *Find(unsigned int, const string &sName = "") const;
+		//The mapped bytes of a section
+		const unsigned char *Data(const Section &TheSection) const	{	return pMapped + TheSection.Offset;	}
+		//Page number of entry i of a memory section
+		uint64 PageNumber(const Section &, size_t) const;
+		//Data of entry i of a memory section
+		const unsigned char *PageData(const Section &, size_t) const;
+
+		//Make a new state ID, which is unlikely to match any other
+		static uint64 NewID();
+
+	protected:
+		//The mapped file
+		const unsigned char *pMapped;
+		uint64 MappedSize;
+		MAPPED_FILE_TYPE hFile, hMapping;
+	};
+}
+
+#endif
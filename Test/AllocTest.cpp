@@ -0,0 +1,178 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#pragma warning (disable:4786)
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+#include "SimTest.h"
+#include "../LC3Assembler/LC3ISA.h"
+#include "../LC3Simulator/LC3Arch.h"
+#include "../LC3bAssembler/LC3bISA.h"
+#include "../LC3bSimulator/LC3bArch.h"
+
+using namespace std;
+using namespace JMT;
+using namespace Assembler;
+using namespace Simulator;
+using namespace SimTest;
+
+//Number of times operator new has been called
+static unsigned long Allocations = 0;
+
+//The replacements have no exception specifications, so that they match
+//the library's declarations in every language standard
+void *operator new(size_t Size)
+{
+	Allocations++;
+	void *pMemory = malloc(Size ? Size : 1);
+	if(!pMemory)
+		throw bad_alloc();
+	return pMemory;
+}
+void *operator new[](size_t Size)
+{
+	return operator new(Size);
+}
+void operator delete(void *pMemory)
+{
+	free(pMemory);
+}
+void operator delete[](void *pMemory)
+{
+	free(pMemory);
+}
+
+//A program which runs forever, once it has warmed up
+struct AllocCase
+{
+	const char *sName;
+	LanguageEnum Language;
+};
+
+const AllocCase AllocCases[] =
+{
+	{"LC3Loop.asm", LangLC3},
+	{"LC3Memory.asm", LangLC3},
+	{"LC3SelfModify.asm", LangLC3},
+	{"LC3bLoop.asm", LangLC3b},
+	{"LC3bBytes.asm", LangLC3b},
+	{"LC3bPipe.asm", LangLC3b},
+};
+const unsigned int ALLOC_CASE_COUNT = sizeof(AllocCases) / sizeof(AllocCase);
+
+//Cycles run before counting, so that the caches and call frames are
+//allocated, and cycles counted in one run
+const uint64 WARMUP_CYCLES = 10000;
+const uint64 COUNTED_CYCLES = 100000;
+//Runs of one cycle counted, since the simulator does some work after each run
+const unsigned int COUNTED_STEPS = 1000;
+
+/******************************************************************************\
+	CountAllocations( [in] test case, [in] program, [in] engine )
+
+	Runs the program on the engine until it has warmed up, and then checks
+	that a long run and many one cycle runs make no heap allocations.
+\******************************************************************************/
+template<class ISA, class ArchType>
+static bool CountAllocations(const AllocCase &Case, TestProgram &TheProgram, const string &sEngine)
+{
+	TestSim<ISA, ArchType> *pTestSim = new TestSim<ISA, ArchType>;
+	bool fRetVal = pTestSim->Load(TheProgram, sEngine) && pTestSim->Run(WARMUP_CYCLES);
+	//A block engine translates a new block wherever a run stops, so the
+	//one cycle runs are warmed up too
+	for(unsigned int i = 0; i < COUNTED_STEPS && fRetVal; i++)
+		fRetVal = pTestSim->Run(1);
+	if(!fRetVal)
+		cout << "Failed:  " << Case.sName << " on " << sEngine << ": unable to run" << endl;
+
+	unsigned long RunAllocations = 0, StepAllocations = 0;
+	if(fRetVal)
+	{
+		Allocations = 0;
+		pTestSim->Run(COUNTED_CYCLES);
+		RunAllocations = Allocations;
+
+		Allocations = 0;
+		for(unsigned int i = 0; i < COUNTED_STEPS; i++)
+			pTestSim->Run(1);
+		StepAllocations = Allocations;
+
+		if(pTestSim->Halted() || pTestSim->Sim.SimCycle < WARMUP_CYCLES + COUNTED_CYCLES + 2 * COUNTED_STEPS)
+		{
+			cout << "Failed:  " << Case.sName << " on " << sEngine << ": stopped after " << (unsigned int)pTestSim->Sim.SimCycle << " cycles" << endl;
+			fRetVal = false;
+		}
+		else if(RunAllocations || StepAllocations)
+		{
+			cout << "Failed:  " << Case.sName << " on " << sEngine << ": " << RunAllocations << " allocations in " << (unsigned int)COUNTED_CYCLES << " cycles, "
+				<< StepAllocations << " in " << COUNTED_STEPS << " runs of one cycle" << endl;
+			fRetVal = false;
+		}
+		else
+			cout << "Passed:  " << Case.sName << " on " << sEngine << endl;
+	}
+
+	delete pTestSim;
+	return fRetVal;
+}
+
+template<class ISA, class ArchType>
+static bool CountEngines(const AllocCase &Case, TestProgram &TheProgram)
+{
+	TestSim<ISA, ArchType> *pTestSim = new TestSim<ISA, ArchType>;
+	vector<string> Engines = pTestSim->Arch.Engines;
+	delete pTestSim;
+
+	bool fRetVal = true;
+	for(unsigned int i = 0; i < Engines.size(); i++)
+		if(!CountAllocations<ISA, ArchType>(Case, TheProgram, Engines[i]))
+			fRetVal = false;
+	return fRetVal;
+}
+
+int main(int argc, char* argv[])
+{
+	try
+	{
+		unsigned int Failures = 0;
+		for(unsigned int i = 0; i < ALLOC_CASE_COUNT; i++)
+		{
+			const AllocCase &Case = AllocCases[i];
+			TestProgram TheProgram;
+			bool fPassed;
+			if(!AssembleTest(TheProgram, Case.sName, Case.Language, false))
+				fPassed = false;
+			else if(Case.Language == LangLC3)
+				fPassed = CountEngines<LC3::LC3ISA, LC3::LC3Arch>(Case, TheProgram);
+			else
+				fPassed = CountEngines<LC3b::LC3bISA, LC3b::LC3bArch>(Case, TheProgram);
+			if(!fPassed)
+				Failures++;
+		}
+
+		if(Failures)
+		{
+			cout << Failures << " of " << ALLOC_CASE_COUNT << " programs failed." << endl;
+			return -1;
+		}
+		cout << "All " << ALLOC_CASE_COUNT << " programs passed." << endl;
+		return 0;
+	}
+	catch(const char *sMsg)
+	{	//*NOTE: MSVC allows "char", but GCC requires "const"
+		printf("***Fatal:   %s\n", sMsg);
+		fflush(NULL);
+		exit(-1);
+	}
+	catch(runtime_error e)
+	{
+		printf("***Fatal:   %s\n", e.what());
+		fflush(NULL);
+		exit(-1);
+	}
+}
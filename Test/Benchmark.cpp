@@ -0,0 +1,657 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#pragma warning (disable:4786)
+#include <iostream>
+#include <iomanip>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <sstream>
+#include <vector>
+#include <list>
+#include <algorithm>
+#include "SimTest.h"
+#include "../Simulator/Memory.h"
+#include "../LC3Assembler/LC3ISA.h"
+#include "../LC3Simulator/LC3Arch.h"
+#include "../LC3bAssembler/LC3bISA.h"
+#include "../LC3bSimulator/LC3bArch.h"
+#if defined WIN32
+	#include <windows.h>
+	#include <psapi.h>
+	#pragma comment(lib, "psapi.lib")
+#else
+	#include <sys/resource.h>
+#endif
+
+using namespace std;
+using namespace JMT;
+using namespace Assembler;
+using namespace Simulator;
+using namespace SimTest;
+
+//A benchmark prints one line for each measurement. It returns false if it
+//was unable to run.
+struct Benchmark
+{
+	const char *sName;
+	bool (*pFunction)();
+	const char *sDescription;
+};
+
+void PrintUsage();
+bool ProcessArgs(int, char**);
+bool DecodeBenchmark();
+bool ElementsBenchmark();
+bool ImageBenchmark();
+bool ResetBenchmark();
+bool TraceBenchmark();
+bool CacheBenchmark();
+bool BreakpointsBenchmark();
+bool FetchBenchmark();
+
+const Benchmark Benchmarks[] =
+{
+	{"decode", DecodeBenchmark, "Instructions per second of a hot loop on each engine"},
+	{"elements", ElementsBenchmark, "Finding the element at an address in a 25k element program"},
+	{"image", ImageBenchmark, "Assembling and loading a program which fills the LC-3b memory"},
+	{"reset", ResetBenchmark, "Resetting a program on AshOS after it wrote a few pages"},
+	{"trace", TraceBenchmark, "Simulation with a binary trace of the registers, and without"},
+	{"cache", CacheBenchmark, "The decode loop on each engine with the cache model on and off"},
+	{"breakpoints", BreakpointsBenchmark, "The decode loop with no, a few, and many breakpoints which never break"},
+	{"fetch", FetchBenchmark, "Instruction words read from a flat and a sparse memory"},
+};
+const unsigned int BENCHMARK_COUNT = sizeof(Benchmarks) / sizeof(Benchmark);
+
+//Cycles each run simulates
+uint64 BenchCycles = 20000000;
+//Benchmarks to run, or empty for all of them
+vector<string> BenchNames;
+
+int main(int argc, char* argv[])
+{
+	try
+	{
+		if(!ProcessArgs(argc, argv))
+		{
+			PrintUsage();
+			return 0;
+		}
+
+		bool fRetVal = true;
+		cout << "Benchmark\tProgram\tEngine\tSeconds\tMeasure\n";
+		for(unsigned int i = 0; i < BENCHMARK_COUNT; i++)
+		{
+			if(!BenchNames.empty() && find(BenchNames.begin(), BenchNames.end(), Benchmarks[i].sName) == BenchNames.end())
+				continue;
+			if(!Benchmarks[i].pFunction())
+			{
+				cerr << "Error:   The " << Benchmarks[i].sName << " benchmark failed." << endl;
+				fRetVal = false;
+			}
+		}
+		return fRetVal ? 0 : -1;
+	}
+	catch(const char *sMsg)
+	{	//*NOTE: MSVC allows "char", but GCC requires "const"
+		printf("***Fatal:   %s\n", sMsg);
+		fflush(NULL);
+		exit(-1);
+	}
+	catch(runtime_error e)
+	{
+		printf("***Fatal:   %s\n", e.what());
+		fflush(NULL);
+		exit(-1);
+	}
+}
+
+void PrintUsage()
+{
+	cout << "\n\t\tSimulator Benchmarks " << SIM_VER << ", Ashley Wise\n\n";
+	cout << "Run from the top of the source tree. Give the names of the benchmarks\n";
+	cout << "to run as parameters, or none to run them all. Times are CPU seconds.\n";
+	cout << "   -c Cycles     Cycles simulated by each run (default 20000000)\n";
+	cout << "   -h or -?      Prints this help\n\n";
+	for(unsigned int i = 0; i < BENCHMARK_COUNT; i++)
+		cout << "   " << setw(14) << left << Benchmarks[i].sName << Benchmarks[i].sDescription << "\n";
+	cout << "\n";
+}
+
+bool ProcessArgs(int argc, char* argv[])
+{
+	for(int i = 1; i < argc; i++)
+	{
+		if(argv[i][0] == '-')
+		{
+			switch(argv[i][1])
+			{
+			case 'c':
+			case 'C':
+				if(i + 1 >= argc || !(BenchCycles = strtoul(argv[i+1], NULL, 10)))
+				{
+					cout << "Error:   -c must be followed by a number of cycles." << endl << endl;
+					return false;
+				}
+				i++;
+				break;
+			case '?':
+			case 'h':
+			case 'H':
+			default:
+				return false;
+			}
+			continue;
+		}
+
+		unsigned int Bench;
+		for(Bench = 0; Bench < BENCHMARK_COUNT; Bench++)
+			if(ToLower(argv[i]) == Benchmarks[Bench].sName)
+				break;
+		if(Bench == BENCHMARK_COUNT)
+		{
+			cout << "Error:   " << argv[i] << " is not a benchmark." << endl << endl;
+			return false;
+		}
+		BenchNames.push_back(Benchmarks[Bench].sName);
+	}
+	return true;
+}
+
+/******************************************************************************\
+	PrintMeasure( [in] benchmark, [in] program, [in] engine, [in] seconds,
+		[in] what was measured, [in] how many )
+
+	Prints the rate of what was measured per second.
+\******************************************************************************/
+static void PrintMeasure(const string &sBench, const string &sProgram, const string &sEngine, double Seconds, const char *sUnit, uint64 Count)
+{
+	cout << sBench << "\t" << sProgram << "\t" << sEngine << "\t" << fixed << setprecision(2) << Seconds << "\t";
+	if(Seconds > 0)
+		cout << setprecision(1) << (double)(int64)Count / Seconds / 1000000 << " M" << sUnit << "/s\n";
+	else
+		cout << "-\n";
+	cout.flush();
+}
+
+/******************************************************************************\
+	PrintLatency( [in] benchmark, [in] program, [in] engine, [in] seconds,
+		[in] what was measured, [in] how many )
+
+	Prints the microseconds each of what was measured took, for those too
+	slow to count in millions a second.
+\******************************************************************************/
+static void PrintLatency(const string &sBench, const string &sProgram, const string &sEngine, double Seconds, const char *sUnit, uint64 Count)
+{
+	cout << sBench << "\t" << sProgram << "\t" << sEngine << "\t" << fixed << setprecision(2) << Seconds << "\t";
+	if(Count)
+		cout << setprecision(2) << Seconds * 1000000 / (double)(int64)Count << " us/" << sUnit << "\n";
+	else
+		cout << "-\n";
+	cout.flush();
+}
+
+/******************************************************************************\
+	PeakMemory()
+
+	Returns the most bytes of memory the process has held so far, or 0 if
+	the system can't tell.
+\******************************************************************************/
+static uint64 PeakMemory()
+{
+#if defined WIN32
+	PROCESS_MEMORY_COUNTERS Counters;
+	if(!GetProcessMemoryInfo(GetCurrentProcess(), &Counters, sizeof(Counters)))
+		return 0;
+	return Counters.PeakWorkingSetSize;
+#else
+	struct rusage Usage;
+	if(getrusage(RUSAGE_SELF, &Usage))
+		return 0;
+	//ru_maxrss is in kilobytes
+	return (uint64)Usage.ru_maxrss * 1024;
+#endif
+}
+
+/******************************************************************************\
+	RunEngines( [in] benchmark, [in] program )
+
+	Runs the program for BenchCycles cycles on each engine of its
+	architecture, and prints how many instructions a second it simulated.
+\******************************************************************************/
+template<class ISA, class ArchType>
+static bool RunEngines(const string &sBench, TestProgram &TheProgram)
+{
+	TestSim<ISA, ArchType> *pTestSim = new TestSim<ISA, ArchType>;
+	vector<string> Engines = pTestSim->Arch.Engines;
+	bool fRetVal = true;
+	for(unsigned int i = 0; i < Engines.size() && fRetVal; i++)
+	{
+		if(!pTestSim->Load(TheProgram, Engines[i]))
+		{
+			fRetVal = false;
+			break;
+		}
+		double Start = CPUSeconds();
+		fRetVal = pTestSim->Run(BenchCycles);
+		double Seconds = CPUSeconds() - Start;
+		PrintMeasure(sBench, TheProgram.sName, Engines[i], Seconds, "instr", pTestSim->Sim.SimInstruction);
+	}
+	delete pTestSim;
+	return fRetVal;
+}
+
+/******************************************************************************\
+	DecodeBenchmark()
+
+	A loop of ALU, load, store, call and branch instructions. Its speed is
+	mostly that of fetching, decoding and dispatching instructions. The
+	LC-3 also runs a loop of one long block, where the block engines spend
+	the least time between blocks.
+\******************************************************************************/
+bool DecodeBenchmark()
+{
+	TestProgram LC3Program, LC3StraightProgram, LC3bProgram;
+	if(!AssembleTest(LC3Program, "LC3Loop.asm", LangLC3, false) || !AssembleTest(LC3StraightProgram, "LC3Straight.asm", LangLC3, false)
+		|| !AssembleTest(LC3bProgram, "LC3bLoop.asm", LangLC3b, false))
+		return false;
+	return RunEngines<LC3::LC3ISA, LC3::LC3Arch>("decode", LC3Program) && RunEngines<LC3::LC3ISA, LC3::LC3Arch>("decode", LC3StraightProgram)
+		&& RunEngines<LC3b::LC3bISA, LC3b::LC3bArch>("decode", LC3bProgram);
+}
+
+/******************************************************************************\
+	ElementsBenchmark()
+
+	A program of 25000 labelled data elements, with a loop after the first
+	20000 of them. Check mode finds the element of every instruction, and
+	the simulator finds the element of the PC after each run, so it runs
+	once in check mode and then one cycle at a time.
+\******************************************************************************/
+bool ElementsBenchmark()
+{
+	ostringstream strSource;
+	strSource << "\t.ORIG x0100\n\tLD R0, STARTP\n\tJMP R0\nSTARTP\t.FILL START\n";
+	for(unsigned int i = 0; i < 25000; i++)
+	{
+		if(i == 20000)
+			strSource << "START\tADD R1, R1, #1\n\tBRnzp START\n";
+		strSource << "D" << i << "\t.FILL #" << i % 1000 << "\n";
+	}
+	strSource << "\t.END\n";
+
+	TestProgram TheProgram;
+	if(!AssembleTest(TheProgram, "LC3Elements.asm", LangLC3, false, strSource.str()))
+		return false;
+	TestSim<LC3::LC3ISA, LC3::LC3Arch> *pTestSim = new TestSim<LC3::LC3ISA, LC3::LC3Arch>;
+	bool fRetVal = pTestSim->Load(TheProgram, "pipeline");
+
+	//Check mode is far slower than the engines, so it runs for fewer cycles
+	if(fRetVal)
+	{
+		pTestSim->Sim.fCheck = true;
+		double Start = CPUSeconds();
+		fRetVal = pTestSim->Run(BenchCycles / 10);
+		PrintMeasure("elements", TheProgram.sName, "check", CPUSeconds() - Start, "instr", pTestSim->Sim.SimInstruction);
+		pTestSim->Sim.fCheck = false;
+	}
+
+	if(fRetVal)
+	{
+		uint64 Runs = BenchCycles / 100;
+		double Start = CPUSeconds();
+		for(uint64 i = 0; i < Runs && fRetVal; i++)
+			fRetVal = pTestSim->Run(1);
+		PrintMeasure("elements", TheProgram.sName, "step", CPUSeconds() - Start, "run", Runs);
+	}
+
+	delete pTestSim;
+	return fRetVal;
+}
+
+/******************************************************************************\
+	ImageBenchmark()
+
+	A program of 64 bit data which fills the LC-3b memory from 4x0200 to
+	4xFBFF. Each run assembles it and loads it into a new simulator, so it
+	times building the memory image and copying it into memory. The peak
+	memory is how far the process's peak grew during the runs, so it is
+	only right when the benchmark is run by itself.
+\******************************************************************************/
+bool ImageBenchmark()
+{
+	ostringstream strSource;
+	strSource << "ORIGIN 4x0200\nSEGMENT\nLoop:\tbr Loop\n";
+	for(unsigned int i = 0; i < 250; i++)
+	{
+		strSource << "D" << i << ":\tdata8[]";
+		for(unsigned int j = 0; j < 32; j++)
+			strSource << (j ? ", " : " ") << "4x" << hex << i * 32 + j << "0123456789AB" << dec;
+		strSource << "\n";
+	}
+	string sSource = strSource.str();
+
+	unsigned int Runs = 10;
+	uint64 Bytes = 0, Peak = PeakMemory();
+	bool fRetVal = true;
+	double Start = CPUSeconds();
+	for(unsigned int i = 0; i < Runs && fRetVal; i++)
+	{
+		TestProgram TheProgram;
+		if(!AssembleTest(TheProgram, "LC3bImage.asm", LangLC3b, false, sSource))
+			return false;
+		TestSim<LC3b::LC3bISA, LC3b::LC3bArch> *pTestSim = new TestSim<LC3b::LC3bISA, LC3b::LC3bArch>;
+		fRetVal = pTestSim->Load(TheProgram, "pipeline");
+		Bytes += TheProgram.Image.Size();
+		delete pTestSim;
+	}
+	PrintMeasure("image", "LC3bImage.asm", "pipeline", CPUSeconds() - Start, "byte", Bytes);
+	cout << "image\tLC3bImage.asm\tpeak\t-\t" << setprecision(1) << (double)(int64)(PeakMemory() - Peak) / 1048576 << " MB\n";
+	cout.flush();
+	return fRetVal;
+}
+
+/******************************************************************************\
+	ResetBenchmark()
+
+	The loop program on AshOS. Each reset follows writes to DirtyPages
+	pages of DRAM, spread over the memory, as a run would leave them.
+	"reset" restores the snapshot taken by the load, and "reload" clears
+	the memory and loads the whole image again, as every reset did before
+	the snapshots.
+\******************************************************************************/
+bool ResetBenchmark()
+{
+	const unsigned int DirtyPages = 8;
+	TestProgram TheProgram;
+	if(!AssembleTest(TheProgram, "LC3Loop.asm", LangLC3, true))
+		return false;
+	TestSim<LC3::LC3ISA, LC3::LC3Arch> *pTestSim = new TestSim<LC3::LC3ISA, LC3::LC3Arch>;
+	bool fRetVal = pTestSim->Load(TheProgram, "pipeline") && pTestSim->Run(1000);
+	Memory &DRAM = pTestSim->Arch.Memories.find("dram")->second;
+	uint64 Stride = (DRAM.PageCount() / DirtyPages) << MEMORY_PAGE_BITS;
+
+	uint64 Runs = BenchCycles / 200;
+	double Start = CPUSeconds();
+	for(uint64 i = 0; i < Runs && fRetVal; i++)
+	{
+		for(unsigned int j = 0; j < DirtyPages; j++)
+			DRAM.Write16(j * Stride, (unsigned short)i, false);
+		fRetVal = pTestSim->Sim.Reset();
+	}
+	if(fRetVal)
+		PrintLatency("reset", TheProgram.sName, "pipeline", CPUSeconds() - Start, "reset", Runs);
+
+	//A full load is far slower
+	Runs /= 100;
+	Start = CPUSeconds();
+	for(uint64 i = 0; i < Runs && fRetVal; i++)
+	{
+		for(unsigned int j = 0; j < DirtyPages; j++)
+			DRAM.Write16(j * Stride, (unsigned short)i, false);
+		fRetVal = pTestSim->Load(TheProgram, "pipeline");
+	}
+	if(fRetVal)
+		PrintLatency("reload", TheProgram.sName, "pipeline", CPUSeconds() - Start, "reset", Runs);
+
+	delete pTestSim;
+	return fRetVal;
+}
+
+/******************************************************************************\
+	RunTraced( [in] program )
+
+	Runs the program for a tenth of BenchCycles cycles untraced, and again
+	with a binary trace of the register file, and prints both speeds and
+	how many times longer the traced run took. The traced time includes
+	the trace writer thread and the flush when the trace is turned off.
+\******************************************************************************/
+template<class ISA, class ArchType>
+static bool RunTraced(TestProgram &TheProgram)
+{
+	TestSim<ISA, ArchType> *pTestSim = new TestSim<ISA, ArchType>;
+	string sTraceFile = string(sTestScratchDir) + "Benchmark.trace";
+	list<string> TraceRegSets;
+	TraceRegSets.push_back("regfile");
+	double Seconds[2];
+	bool fRetVal = true;
+	for(unsigned int i = 0; i < 2 && fRetVal; i++)
+	{
+		if(!pTestSim->Load(TheProgram, "pipeline"))
+		{
+			fRetVal = false;
+			break;
+		}
+		double Start = CPUSeconds();
+		if(i && !pTestSim->Sim.TraceOn(sTraceFile, TraceRegSets, true))
+		{
+			fRetVal = false;
+			break;
+		}
+		fRetVal = pTestSim->Run(BenchCycles / 10);
+		if(i)
+			pTestSim->Sim.TraceOff();
+		Seconds[i] = CPUSeconds() - Start;
+		PrintMeasure("trace", TheProgram.sName, i ? "traced" : "pipeline", Seconds[i], "instr", pTestSim->Sim.SimInstruction);
+	}
+	if(fRetVal && Seconds[0] > 0)
+		cout << "trace\t" << TheProgram.sName << "\tratio\t-\t" << setprecision(2) << Seconds[1] / Seconds[0] << "x\n";
+	cout.flush();
+	remove(sTraceFile.c_str());
+
+	delete pTestSim;
+	return fRetVal;
+}
+
+/******************************************************************************\
+	TraceBenchmark()
+
+	The LC-3b square root, which spins once it is done, and the loop
+	program on AshOS.
+\******************************************************************************/
+bool TraceBenchmark()
+{
+	TestProgram SqrtProgram, LoopProgram;
+	if(!AssembleTest(SqrtProgram, "LC3bSqrt.asm", LangLC3b, false) || !AssembleTest(LoopProgram, "LC3Loop.asm", LangLC3, true))
+		return false;
+	return RunTraced<LC3b::LC3bISA, LC3b::LC3bArch>(SqrtProgram) && RunTraced<LC3::LC3ISA, LC3::LC3Arch>(LoopProgram);
+}
+
+/******************************************************************************\
+	RunCached( [in] program )
+
+	Runs the program on each engine of its architecture with the cache
+	model off, and then on with its default configuration, and prints both
+	speeds and the speed with the caches as a fraction of that without.
+	The misses add cycles, so the runs with the caches on simulate fewer
+	instructions in the same number of cycles.
+\******************************************************************************/
+template<class ISA, class ArchType>
+static bool RunCached(TestProgram &TheProgram)
+{
+	TestSim<ISA, ArchType> *pTestSim = new TestSim<ISA, ArchType>;
+	vector<string> Engines = pTestSim->Arch.Engines;
+	bool fRetVal = true;
+	for(unsigned int i = 0; i < Engines.size() && fRetVal; i++)
+	{
+		double Rate[2];
+		for(unsigned int j = 0; j < 2 && fRetVal; j++)
+		{
+			if(!pTestSim->Load(TheProgram, Engines[i]))
+			{
+				fRetVal = false;
+				break;
+			}
+			if(j)
+				pTestSim->Sim.CacheOn();
+			double Start = CPUSeconds();
+			fRetVal = pTestSim->Run(BenchCycles);
+			double Seconds = CPUSeconds() - Start;
+			pTestSim->Sim.CacheOff();
+			Rate[j] = Seconds > 0 ? (double)(int64)pTestSim->Sim.SimInstruction / Seconds : 0;
+			PrintMeasure("cache", TheProgram.sName, j ? Engines[i] + "+cache" : Engines[i], Seconds, "instr", pTestSim->Sim.SimInstruction);
+		}
+		if(fRetVal && Rate[0] > 0)
+			cout << "cache\t" << TheProgram.sName << "\t" << Engines[i] << " ratio\t-\t" << setprecision(2) << Rate[1] / Rate[0] << "x\n";
+	}
+	cout.flush();
+	delete pTestSim;
+	return fRetVal;
+}
+
+/******************************************************************************\
+	CacheBenchmark()
+
+	The loops of the decode benchmark, whose code and data fit in the
+	caches, so nearly every access hits and the cost is that of the
+	lookups.
+\******************************************************************************/
+bool CacheBenchmark()
+{
+	TestProgram LC3Program, LC3bProgram;
+	if(!AssembleTest(LC3Program, "LC3Loop.asm", LangLC3, false) || !AssembleTest(LC3bProgram, "LC3bLoop.asm", LangLC3b, false))
+		return false;
+	return RunCached<LC3::LC3ISA, LC3::LC3Arch>(LC3Program) && RunCached<LC3b::LC3bISA, LC3b::LC3bArch>(LC3bProgram);
+}
+
+/******************************************************************************\
+	SetValueBreakpoint( [in] simulator, [in] register set, [in] register,
+		[in] value )
+
+	Breaks when the register is set to the value.
+\******************************************************************************/
+template<class ISA, class ArchType>
+static bool SetValueBreakpoint(TestSim<ISA, ArchType> &Sim, const string &sRegisterSet, const string &sRegister, uint64 Value)
+{
+	list<Number *> ValueList;
+	ValueList.push_back(new IntegerNumber(LocationVector(), Value));
+	return Sim.Sim.BreakpointRegister(sRegisterSet, sRegister, new typename ArchSim<ISA>::EventInfo(ValueEvent, ValueList));
+}
+
+/******************************************************************************\
+	SetMemoryBreakpoint( [in] simulator, [in] memory address, [in] events,
+		[in] value of a value event )
+
+	Sets a breakpoint on the word of DRAM at the address.
+\******************************************************************************/
+template<class ISA, class ArchType>
+static bool SetMemoryBreakpoint(TestSim<ISA, ArchType> &Sim, uint64 Address, EventEnum Events, uint64 Value)
+{
+	list<Number *> ValueList;
+	if(Events & ValueEvent)
+		ValueList.push_back(new IntegerNumber(LocationVector(), Value));
+	IntegerNumber AddressNumber(LocationVector(), Address);
+	return Sim.Sim.BreakpointMemory("dram", &AddressNumber, DATA2, new typename ArchSim<ISA>::EventInfo(Events, ValueList));
+}
+
+/******************************************************************************\
+	BreakpointsBenchmark()
+
+	The LC-3 loop of the decode benchmark, run on each engine for a quarter
+	of BenchCycles cycles with three sets of breakpoints, none of which
+	ever break:
+	- none
+	- few: values that R3, R7 and the word at DATA are set to every
+	  iteration, but never reach
+	- many: those, values the PC and IR never reach, and reads and writes
+	  of 64 words the loop never touches
+\******************************************************************************/
+bool BreakpointsBenchmark()
+{
+	//Byte address of DATA in LC3Loop.asm
+	const uint64 DataAddress = 0x3009 << LC3::LC3ISA::Addressability;
+	const char *const sSets[] = {"none", "few", "many"};
+
+	TestProgram TheProgram;
+	if(!AssembleTest(TheProgram, "LC3Loop.asm", LangLC3, false))
+		return false;
+	TestSim<LC3::LC3ISA, LC3::LC3Arch> *pTestSim = new TestSim<LC3::LC3ISA, LC3::LC3Arch>;
+	vector<string> Engines = pTestSim->Arch.Engines;
+	bool fRetVal = true;
+	for(unsigned int i = 0; i < Engines.size() && fRetVal; i++)
+	{
+		for(unsigned int Set = 0; Set < 3 && fRetVal; Set++)
+		{
+			if(!pTestSim->Load(TheProgram, Engines[i]))
+			{
+				fRetVal = false;
+				break;
+			}
+			pTestSim->Sim.BreakpointRegisterClear();
+			pTestSim->Sim.BreakpointMemoryClear();
+			if(Set >= 1)
+			{
+				fRetVal = SetValueBreakpoint(*pTestSim, "regfile", "r3", 1) && SetValueBreakpoint(*pTestSim, "regfile", "r7", 0)
+					&& SetMemoryBreakpoint(*pTestSim, DataAddress, ValueEvent, 1);
+			}
+			if(Set >= 2)
+			{
+				fRetVal = fRetVal && SetValueBreakpoint(*pTestSim, "control", "pc", 0) && SetValueBreakpoint(*pTestSim, "control", "ir", 0);
+				for(unsigned int j = 0; j < 64 && fRetVal; j++)
+					fRetVal = SetMemoryBreakpoint(*pTestSim, (0x4000 + 0x100 * j) << LC3::LC3ISA::Addressability, (EventEnum)(ReadEvent | WriteEvent), 0);
+			}
+			if(!fRetVal)
+				break;
+
+			double Start = CPUSeconds();
+			fRetVal = pTestSim->Run(BenchCycles / 4);
+			double Seconds = CPUSeconds() - Start;
+			if(fRetVal && pTestSim->Sim.SimCycle < BenchCycles / 4)
+			{
+				cerr << "Error:   A breakpoint broke the " << Engines[i] << " run." << endl;
+				fRetVal = false;
+			}
+			PrintMeasure("breakpoints", TheProgram.sName, Engines[i] + " " + sSets[Set], Seconds, "cycle", pTestSim->Sim.SimCycle);
+		}
+	}
+	pTestSim->Sim.BreakpointRegisterClear();
+	pTestSim->Sim.BreakpointMemoryClear();
+
+	delete pTestSim;
+	return fRetVal;
+}
+
+/******************************************************************************\
+	FetchBenchmark()
+
+	Reads BenchCycles instruction words in order from 4K words of code at
+	4x3000 in the LC-3 DRAM's address range, as the engines fetch them when
+	they miss the decode cache. The range is the same for both memories,
+	but the sparse one decodes 24 address bits, which is too many to keep
+	flat.
+\******************************************************************************/
+bool FetchBenchmark()
+{
+	const uint64 Begin = 0x3000 << LC3::LC3ISA::Addressability, Words = 0x1000;
+	const char *const sMemories[] = {"flat", "sparse"};
+	uint64 Sums[2];
+	for(unsigned int i = 0; i < 2; i++)
+	{
+		vector<short> BitDivisions;
+		BitDivisions.push_back(i ? -40 : -48);
+		for(unsigned int Bits = 0; Bits < (i ? 24u : 16u); Bits += 8)
+			BitDivisions.push_back(8);
+		Memory DRAM("dram", 0, LC3::LC3ISA::MaxAddress, BitDivisions);
+		if(DRAM.fFlat == (i != 0))
+		{
+			cerr << "Error:   The " << sMemories[i] << " memory is not " << sMemories[i] << "." << endl;
+			return false;
+		}
+		for(uint64 j = 0; j < Words; j++)
+			DRAM.Write16(Begin + 2 * j, (unsigned short)(j * 0x9E37), LC3::LC3ISA::fLittleEndian);
+
+		uint64 Sum = 0;
+		double Start = CPUSeconds();
+		for(uint64 j = 0; j < BenchCycles; j++)
+			Sum += DRAM.Read16(Begin + 2 * (j & (Words - 1)), LC3::LC3ISA::fLittleEndian);
+		PrintMeasure("fetch", "dram", sMemories[i], CPUSeconds() - Start, "word", BenchCycles);
+		Sums[i] = Sum;
+	}
+	if(Sums[0] != Sums[1])
+	{
+		cerr << "Error:   The flat and sparse memories read different words." << endl;
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,172 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#pragma warning (disable:4786)
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "SimTest.h"
+#include "../LC3Assembler/LC3ISA.h"
+#include "../LC3Simulator/LC3Arch.h"
+#include "../LC3bAssembler/LC3bISA.h"
+#include "../LC3bSimulator/LC3bArch.h"
+
+using namespace std;
+using namespace JMT;
+using namespace Assembler;
+using namespace Simulator;
+using namespace SimTest;
+
+//A program every engine runs, its console input, and the cycles it runs
+//for unless it halts first
+struct EngineCase
+{
+	const char *sName;
+	LanguageEnum Language;
+	bool fUseOS;
+	const char *sInput;
+	uint64 Cycles;
+};
+
+const EngineCase EngineCases[] =
+{
+	{"LC3All.asm", LangLC3, true, "", 100000},
+	{"LC3Patch.asm", LangLC3, true, "", 10000},
+	{"LC3SelfModify.asm", LangLC3, false, "", 2000},
+	{"LC3Calls.asm", LangLC3, true, "", 100000},
+	{"LC3Echo.asm", LangLC3, true, "engines\n", 100000},
+	{"LC3Memory.asm", LangLC3, false, "", 20000},
+	{"LC3Loop.asm", LangLC3, false, "", 20000},
+	{"LC3Straight.asm", LangLC3, false, "", 20000},
+	{"LC3bPipe.asm", LangLC3b, false, "", 20000},
+	{"LC3bBytes.asm", LangLC3b, false, "", 2000},
+	{"LC3bTraps.asm", LangLC3b, true, "", 100000},
+	{"LC3bSqrt.asm", LangLC3b, false, "", 20000},
+	{"LC3bLoop.asm", LangLC3b, false, "", 20000},
+};
+const unsigned int ENGINE_CASE_COUNT = sizeof(EngineCases) / sizeof(EngineCase);
+
+//Cycles each engine runs between comparisons, in turn. Runs of one cycle
+//make the block engines fall back in the middle of a block, and the
+//longer runs stop in the middle of one.
+const uint64 ChunkCycles[] = {1, 3, 17, 1, 250, 1000};
+const unsigned int CHUNK_COUNT = sizeof(ChunkCycles) / sizeof(uint64);
+
+/******************************************************************************\
+	CompareEngine( [in] test case, [in] program, [in] engine )
+
+	Runs the program on the engine and on the pipeline engine side by side,
+	and compares their architectural state after every run. The state
+	includes the cycle count, since every engine but the five-stage
+	pipeline takes one cycle for each instruction.
+
+	Returns false and prints the first difference if they disagree.
+\******************************************************************************/
+template<class ISA, class ArchType>
+static bool CompareEngine(const EngineCase &Case, TestProgram &TheProgram, const string &sEngine)
+{
+	TestSim<ISA, ArchType> *pExpected = new TestSim<ISA, ArchType>, *pTestSim = new TestSim<ISA, ArchType>;
+	bool fRetVal = pExpected->Load(TheProgram, "pipeline") && pTestSim->Load(TheProgram, sEngine);
+	if(!fRetVal)
+		cout << "Failed:  " << Case.sName << " on " << sEngine << ": unable to load" << endl;
+	pExpected->Console.sInput = pTestSim->Console.sInput = Case.sInput;
+
+	//The five-stage pipeline's latches are not part of the other engines
+	vector<string> Excluded;
+	Excluded.push_back("if");
+	Excluded.push_back("if_id");
+	Excluded.push_back("id_ex");
+	Excluded.push_back("ex_mem");
+	Excluded.push_back("mem_wb");
+
+	TestState ExpectedState, State;
+	for(unsigned int i = 0; fRetVal && pExpected->Sim.SimCycle < Case.Cycles && !pExpected->Halted(); i++)
+	{
+		uint64 Cycles = ChunkCycles[i % CHUNK_COUNT];
+		pExpected->Run(Cycles);
+		pTestSim->Run(Cycles);
+		pExpected->Capture(Excluded, ExpectedState);
+		pTestSim->Capture(Excluded, State);
+		string sDifference = CompareStates(ExpectedState, State);
+		if(sDifference.empty() && pExpected->Console.sMessage != pTestSim->Console.sMessage)
+			sDifference = "message \"" + pTestSim->Console.sMessage + "\", expected \"" + pExpected->Console.sMessage + "\"";
+		if(!sDifference.empty())
+		{
+			cout << "Failed:  " << Case.sName << " on " << sEngine << " after " << (unsigned int)pExpected->Sim.SimCycle << " cycles: " << sDifference << endl;
+			fRetVal = false;
+		}
+	}
+	if(fRetVal)
+		cout << "Passed:  " << Case.sName << " on " << sEngine << ", " << (unsigned int)pExpected->Sim.SimInstruction << " instructions" << endl;
+
+	delete pExpected;
+	delete pTestSim;
+	return fRetVal;
+}
+
+/******************************************************************************\
+	CompareEngines( [in] test case, [in] program )
+
+	Compares every engine of the architecture but the pipeline and the
+	five-stage pipeline with the pipeline engine.
+\******************************************************************************/
+template<class ISA, class ArchType>
+static bool CompareEngines(const EngineCase &Case, TestProgram &TheProgram)
+{
+	TestSim<ISA, ArchType> *pTestSim = new TestSim<ISA, ArchType>;
+	vector<string> Engines = pTestSim->Arch.Engines;
+	delete pTestSim;
+
+	bool fRetVal = true;
+	for(unsigned int i = 0; i < Engines.size(); i++)
+	{
+		if(Engines[i] != "pipeline" && Engines[i] != "fivestage" && !CompareEngine<ISA, ArchType>(Case, TheProgram, Engines[i]))
+			fRetVal = false;
+	}
+	return fRetVal;
+}
+
+int main(int argc, char* argv[])
+{
+	try
+	{
+		unsigned int Failures = 0;
+		for(unsigned int i = 0; i < ENGINE_CASE_COUNT; i++)
+		{
+			const EngineCase &Case = EngineCases[i];
+			TestProgram TheProgram;
+			bool fPassed;
+			if(!AssembleTest(TheProgram, Case.sName, Case.Language, Case.fUseOS))
+				fPassed = false;
+			else if(Case.Language == LangLC3)
+				fPassed = CompareEngines<LC3::LC3ISA, LC3::LC3Arch>(Case, TheProgram);
+			else
+				fPassed = CompareEngines<LC3b::LC3bISA, LC3b::LC3bArch>(Case, TheProgram);
+			if(!fPassed)
+				Failures++;
+		}
+
+		if(Failures)
+		{
+			cout << Failures << " of " << ENGINE_CASE_COUNT << " programs failed." << endl;
+			return -1;
+		}
+		cout << "All " << ENGINE_CASE_COUNT << " programs passed." << endl;
+		return 0;
+	}
+	catch(const char *sMsg)
+	{	//*NOTE: MSVC allows "char", but GCC requires "const"
+		printf("***Fatal:   %s\n", sMsg);
+		fflush(NULL);
+		exit(-1);
+	}
+	catch(runtime_error e)
+	{
+		printf("***Fatal:   %s\n", e.what());
+		fflush(NULL);
+		exit(-1);
+	}
+}
@@ -0,0 +1,140 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#pragma warning (disable:4786)
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "SimTest.h"
+#include "../LC3bAssembler/LC3bISA.h"
+#include "../LC3bSimulator/LC3bArch.h"
+
+using namespace std;
+using namespace JMT;
+using namespace Assembler;
+using namespace Simulator;
+using namespace SimTest;
+
+//An LC-3b program, and the instructions it retires unless it halts first
+struct LockstepCase
+{
+	const char *sName;
+	bool fUseOS;
+	uint64 Instructions;
+};
+
+const LockstepCase LockstepCases[] =
+{
+	{"LC3bPipe.asm", false, 5000},
+	{"LC3bBytes.asm", false, 2000},
+	{"LC3bTraps.asm", true, 20000},
+	{"LC3bSqrt.asm", false, 5000},
+	{"LC3bLoop.asm", false, 5000},
+};
+const unsigned int LOCKSTEP_CASE_COUNT = sizeof(LockstepCases) / sizeof(LockstepCase);
+
+//Most cycles the five-stage pipeline may take to retire one instruction,
+//beyond which it is taken to be stuck
+const uint64 MAX_RETIRE_CYCLES = 100;
+
+/******************************************************************************\
+	CompareRetirements( [in] test case, [in] program )
+
+	Runs the program on the five-stage pipeline one cycle at a time, and on
+	the pipeline engine one instruction at a time. Each time the five-stage
+	pipeline retires an instruction, the pipeline engine runs until it has
+	retired as many, and their registers, memory, and console output are
+	compared. The cycle counts and the five-stage pipeline's latches are
+	left out, since they depend on the timing.
+
+	Returns false and prints the first difference if they disagree.
+\******************************************************************************/
+static bool CompareRetirements(const LockstepCase &Case, TestProgram &TheProgram)
+{
+	typedef TestSim<LC3b::LC3bISA, LC3b::LC3bArch> LC3bTestSim;
+	LC3bTestSim *pExpected = new LC3bTestSim, *pTestSim = new LC3bTestSim;
+	bool fRetVal = pExpected->Load(TheProgram, "pipeline") && pTestSim->Load(TheProgram, "fivestage");
+	if(!fRetVal)
+		cout << "Failed:  " << Case.sName << ": unable to load" << endl;
+
+	vector<string> Excluded;
+	Excluded.push_back("if");
+	Excluded.push_back("if_id");
+	Excluded.push_back("id_ex");
+	Excluded.push_back("ex_mem");
+	Excluded.push_back("mem_wb");
+
+	TestState ExpectedState, State;
+	while(fRetVal && pTestSim->Sim.SimInstruction < Case.Instructions && !pTestSim->Halted())
+	{
+		//Run the five-stage pipeline until it retires an instruction
+		uint64 Retired = pTestSim->Sim.SimInstruction, Cycles;
+		for(Cycles = 0; Cycles < MAX_RETIRE_CYCLES && pTestSim->Sim.SimInstruction == Retired && !pTestSim->Halted(); Cycles++)
+			pTestSim->Run(1);
+		if(Cycles == MAX_RETIRE_CYCLES)
+		{
+			cout << "Failed:  " << Case.sName << " after " << (unsigned int)Retired << " instructions: nothing retired in " << (unsigned int)MAX_RETIRE_CYCLES << " cycles" << endl;
+			fRetVal = false;
+			break;
+		}
+
+		//The pipeline engine retires an instruction every cycle
+		while(pExpected->Sim.SimInstruction < pTestSim->Sim.SimInstruction && !pExpected->Halted())
+			pExpected->Run(1);
+
+		pExpected->Capture(Excluded, ExpectedState);
+		pTestSim->Capture(Excluded, State);
+		string sDifference = CompareStates(ExpectedState, State, false);
+		if(sDifference.empty() && pExpected->Console.sMessage != pTestSim->Console.sMessage)
+			sDifference = "message \"" + pTestSim->Console.sMessage + "\", expected \"" + pExpected->Console.sMessage + "\"";
+		if(!sDifference.empty())
+		{
+			cout << "Failed:  " << Case.sName << " after " << (unsigned int)pExpected->Sim.SimInstruction << " instructions: " << sDifference << endl;
+			fRetVal = false;
+		}
+	}
+	if(fRetVal)
+		cout << "Passed:  " << Case.sName << ", " << (unsigned int)pTestSim->Sim.SimInstruction << " instructions in " << (unsigned int)pTestSim->Sim.SimCycle << " cycles" << endl;
+
+	delete pExpected;
+	delete pTestSim;
+	return fRetVal;
+}
+
+int main(int argc, char* argv[])
+{
+	try
+	{
+		unsigned int Failures = 0;
+		for(unsigned int i = 0; i < LOCKSTEP_CASE_COUNT; i++)
+		{
+			const LockstepCase &Case = LockstepCases[i];
+			TestProgram TheProgram;
+			if(!AssembleTest(TheProgram, Case.sName, LangLC3b, Case.fUseOS) || !CompareRetirements(Case, TheProgram))
+				Failures++;
+		}
+
+		if(Failures)
+		{
+			cout << Failures << " of " << LOCKSTEP_CASE_COUNT << " programs failed." << endl;
+			return -1;
+		}
+		cout << "All " << LOCKSTEP_CASE_COUNT << " programs passed." << endl;
+		return 0;
+	}
+	catch(const char *sMsg)
+	{	//*NOTE: MSVC allows "char", but GCC requires "const"
+		printf("***Fatal:   %s\n", sMsg);
+		fflush(NULL);
+		exit(-1);
+	}
+	catch(runtime_error e)
+	{
+		printf("***Fatal:   %s\n", e.what());
+		fflush(NULL);
+		exit(-1);
+	}
+}
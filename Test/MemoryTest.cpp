@@ -0,0 +1,99 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#pragma warning (disable:4786)
+#include <iostream>
+#include <sstream>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "../Simulator/Memory.h"
+
+using namespace std;
+using namespace JMT;
+using namespace Simulator;
+
+//A memory to save and restore, and the addresses written in it
+struct MemoryCase
+{
+	const char *sName;
+	uint64 Begin, End;
+	//Address bits which select a location, a multiple of 8
+	short UsedBits;
+	uint64 Addresses[4];
+};
+
+const MemoryCase MemoryCases[] =
+{
+	{"zero based", 0, 0xFFFF, 16, {0, 0x3000, 0xFE00, 0xFFFF}},
+	{"based at 4x10000", 0x10000, 0x1FFFF, 16, {0x10000, 0x13000, 0x1FE00, 0x1FFFF}},
+	{"range across an alias", 0x18000, 0x27FFF, 16, {0x18000, 0x1FFFF, 0x20000, 0x27FFF}},
+	{"sparse, based at 4x10000", 0x10000, 0x1FFFFFF, 24, {0x10000, 0x13000, 0x1FE00, 0x1FFFFFF}},
+};
+const unsigned int MEMORY_CASE_COUNT = sizeof(MemoryCases) / sizeof(MemoryCase);
+
+/******************************************************************************\
+	RoundTrip( [in] test case )
+
+	Writes a value at each address of the case, saves the memory and loads
+	it into a new memory. Returns false and prints the first address whose
+	value was not restored.
+\******************************************************************************/
+static bool RoundTrip(const MemoryCase &Case)
+{
+	vector<short> BitDivisions;
+	BitDivisions.push_back(Case.UsedBits - 64);
+	for(short Bits = 0; Bits < Case.UsedBits; Bits += 8)
+		BitDivisions.push_back(8);
+	Memory TheMemory("test", Case.Begin, Case.End, BitDivisions), Restored("test", Case.Begin, Case.End, BitDivisions);
+	for(unsigned int i = 0; i < 4; i++)
+		TheMemory.Write8(Case.Addresses[i], (unsigned char)(0x11 * (i + 1)));
+
+	stringstream strState;
+	strState << TheMemory;
+	strState >> Restored;
+
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		if(Restored.Read8(Case.Addresses[i]) != (unsigned char)(0x11 * (i + 1)))
+		{
+			printf("Failed:  %s, 4x%X = 4x%02X, expected 4x%02X\n", Case.sName, (unsigned int)Case.Addresses[i], Restored.Read8(Case.Addresses[i]), 0x11 * (i + 1));
+			return false;
+		}
+	}
+	cout << "Passed:  " << Case.sName << (TheMemory.fFlat ? ", flat" : "") << endl;
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	try
+	{
+		unsigned int Failures = 0;
+		for(unsigned int i = 0; i < MEMORY_CASE_COUNT; i++)
+			if(!RoundTrip(MemoryCases[i]))
+				Failures++;
+
+		if(Failures)
+		{
+			cout << Failures << " of " << MEMORY_CASE_COUNT << " memories failed." << endl;
+			return -1;
+		}
+		cout << "All " << MEMORY_CASE_COUNT << " memories passed." << endl;
+		return 0;
+	}
+	catch(const char *sMsg)
+	{	//*NOTE: MSVC allows "char", but GCC requires "const"
+		printf("***Fatal:   %s\n", sMsg);
+		fflush(NULL);
+		exit(-1);
+	}
+	catch(SparseArray<uint64, MemoryLocation>::OutOfBounds)
+	{
+		printf("***Fatal:   Memory address out of bounds.\n");
+		fflush(NULL);
+		exit(-1);
+	}
+}
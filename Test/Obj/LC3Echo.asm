@@ -0,0 +1,12 @@
+;Echoes each character of a line, plus one. Runs with the operating system.
+	.ORIG x3000
+loop	GETC
+	ADD R1, R0, #0
+	BRn done
+	ADD R1, R0, #-10
+	BRz done
+	ADD R0, R0, #1
+	OUT
+	BR loop
+done	HALT
+	.END
@@ -0,0 +1,25007 @@
+	.ORIG x0100
+	LD R0, STARTP
+	JMP R0
+STARTP	.FILL START
+D0	.FILL #0
+D1	.FILL #1
+D2	.FILL #2
+D3	.FILL #3
+D4	.FILL #4
+D5	.FILL #5
+D6	.FILL #6
+D7	.FILL #7
+D8	.FILL #8
+D9	.FILL #9
+D10	.FILL #10
+D11	.FILL #11
+D12	.FILL #12
+D13	.FILL #13
+D14	.FILL #14
+D15	.FILL #15
+D16	.FILL #16
+D17	.FILL #17
+D18	.FILL #18
+D19	.FILL #19
+D20	.FILL #20
+D21	.FILL #21
+D22	.FILL #22
+D23	.FILL #23
+D24	.FILL #24
+D25	.FILL #25
+D26	.FILL #26
+D27	.FILL #27
+D28	.FILL #28
+D29	.FILL #29
+D30	.FILL #30
+D31	.FILL #31
+D32	.FILL #32
+D33	.FILL #33
+D34	.FILL #34
+D35	.FILL #35
+D36	.FILL #36
+D37	.FILL #37
+D38	.FILL #38
+D39	.FILL #39
+D40	.FILL #40
+D41	.FILL #41
+D42	.FILL #42
+D43	.FILL #43
+D44	.FILL #44
+D45	.FILL #45
+D46	.FILL #46
+D47	.FILL #47
+D48	.FILL #48
+D49	.FILL #49
+D50	.FILL #50
+D51	.FILL #51
+D52	.FILL #52
+D53	.FILL #53
+D54	.FILL #54
+D55	.FILL #55
+D56	.FILL #56
+D57	.FILL #57
+D58	.FILL #58
+D59	.FILL #59
+D60	.FILL #60
+D61	.FILL #61
+D62	.FILL #62
+D63	.FILL #63
+D64	.FILL #64
+D65	.FILL #65
+D66	.FILL #66
+D67	.FILL #67
+D68	.FILL #68
+D69	.FILL #69
+D70	.FILL #70
+D71	.FILL #71
+D72	.FILL #72
+D73	.FILL #73
+D74	.FILL #74
+D75	.FILL #75
+D76	.FILL #76
+D77	.FILL #77
+D78	.FILL #78
+D79	.FILL #79
+D80	.FILL #80
+D81	.FILL #81
+D82	.FILL #82
+D83	.FILL #83
+D84	.FILL #84
+D85	.FILL #85
+D86	.FILL #86
+D87	.FILL #87
+D88	.FILL #88
+D89	.FILL #89
+D90	.FILL #90
+D91	.FILL #91
+D92	.FILL #92
+D93	.FILL #93
+D94	.FILL #94
+D95	.FILL #95
+D96	.FILL #96
+D97	.FILL #97
+D98	.FILL #98
+D99	.FILL #99
+D100	.FILL #100
+D101	.FILL #101
+D102	.FILL #102
+D103	.FILL #103
+D104	.FILL #104
+D105	.FILL #105
+D106	.FILL #106
+D107	.FILL #107
+D108	.FILL #108
+D109	.FILL #109
+D110	.FILL #110
+D111	.FILL #111
+D112	.FILL #112
+D113	.FILL #113
+D114	.FILL #114
+D115	.FILL #115
+D116	.FILL #116
+D117	.FILL #117
+D118	.FILL #118
+D119	.FILL #119
+D120	.FILL #120
+D121	.FILL #121
+D122	.FILL #122
+D123	.FILL #123
+D124	.FILL #124
+D125	.FILL #125
+D126	.FILL #126
+D127	.FILL #127
+D128	.FILL #128
+D129	.FILL #129
+D130	.FILL #130
+D131	.FILL #131
+D132	.FILL #132
+D133	.FILL #133
+D134	.FILL #134
+D135	.FILL #135
+D136	.FILL #136
+D137	.FILL #137
+D138	.FILL #138
+D139	.FILL #139
+D140	.FILL #140
+D141	.FILL #141
+D142	.FILL #142
+D143	.FILL #143
+D144	.FILL #144
+D145	.FILL #145
+D146	.FILL #146
+D147	.FILL #147
+D148	.FILL #148
+D149	.FILL #149
+D150	.FILL #150
+D151	.FILL #151
+D152	.FILL #152
+D153	.FILL #153
+D154	.FILL #154
+D155	.FILL #155
+D156	.FILL #156
+D157	.FILL #157
+D158	.FILL #158
+D159	.FILL #159
+D160	.FILL #160
+D161	.FILL #161
+D162	.FILL #162
+D163	.FILL #163
+D164	.FILL #164
+D165	.FILL #165
+D166	.FILL #166
+D167	.FILL #167
+D168	.FILL #168
+D169	.FILL #169
+D170	.FILL #170
+D171	.FILL #171
+D172	.FILL #172
+D173	.FILL #173
+D174	.FILL #174
+D175	.FILL #175
+D176	.FILL #176
+D177	.FILL #177
+D178	.FILL #178
+D179	.FILL #179
+D180	.FILL #180
+D181	.FILL #181
+D182	.FILL #182
+D183	.FILL #183
+D184	.FILL #184
+D185	.FILL #185
+D186	.FILL #186
+D187	.FILL #187
+D188	.FILL #188
+D189	.FILL #189
+D190	.FILL #190
+D191	.FILL #191
+D192	.FILL #192
+D193	.FILL #193
+D194	.FILL #194
+D195	.FILL #195
+D196	.FILL #196
+D197	.FILL #197
+D198	.FILL #198
+D199	.FILL #199
+D200	.FILL #200
+D201	.FILL #201
+D202	.FILL #202
+D203	.FILL #203
+D204	.FILL #204
+D205	.FILL #205
+D206	.FILL #206
+D207	.FILL #207
+D208	.FILL #208
+D209	.FILL #209
+D210	.FILL #210
+D211	.FILL #211
+D212	.FILL #212
+D213	.FILL #213
+D214	.FILL #214
+D215	.FILL #215
+D216	.FILL #216
+D217	.FILL #217
+D218	.FILL #218
+D219	.FILL #219
+D220	.FILL #220
+D221	.FILL #221
+D222	.FILL #222
+D223	.FILL #223
+D224	.FILL #224
+D225	.FILL #225
+D226	.FILL #226
+D227	.FILL #227
+D228	.FILL #228
+D229	.FILL #229
+D230	.FILL #230
+D231	.FILL #231
+D232	.FILL #232
+D233	.FILL #233
+D234	.FILL #234
+D235	.FILL #235
+D236	.FILL #236
+D237	.FILL #237
+D238	.FILL #238
+D239	.FILL #239
+D240	.FILL #240
+D241	.FILL #241
+D242	.FILL #242
+D243	.FILL #243
+D244	.FILL #244
+D245	.FILL #245
+D246	.FILL #246
+D247	.FILL #247
+D248	.FILL #248
+D249	.FILL #249
+D250	.FILL #250
+D251	.FILL #251
+D252	.FILL #252
+D253	.FILL #253
+D254	.FILL #254
+D255	.FILL #255
+D256	.FILL #256
+D257	.FILL #257
+D258	.FILL #258
+D259	.FILL #259
+D260	.FILL #260
+D261	.FILL #261
+D262	.FILL #262
+D263	.FILL #263
+D264	.FILL #264
+D265	.FILL #265
+D266	.FILL #266
+D267	.FILL #267
+D268	.FILL #268
+D269	.FILL #269
+D270	.FILL #270
+D271	.FILL #271
+D272	.FILL #272
+D273	.FILL #273
+D274	.FILL #274
+D275	.FILL #275
+D276	.FILL #276
+D277	.FILL #277
+D278	.FILL #278
+D279	.FILL #279
+D280	.FILL #280
+D281	.FILL #281
+D282	.FILL #282
+D283	.FILL #283
+D284	.FILL #284
+D285	.FILL #285
+D286	.FILL #286
+D287	.FILL #287
+D288	.FILL #288
+D289	.FILL #289
+D290	.FILL #290
+D291	.FILL #291
+D292	.FILL #292
+D293	.FILL #293
+D294	.FILL #294
+D295	.FILL #295
+D296	.FILL #296
+D297	.FILL #297
+D298	.FILL #298
+D299	.FILL #299
+D300	.FILL #300
+D301	.FILL #301
+D302	.FILL #302
+D303	.FILL #303
+D304	.FILL #304
+D305	.FILL #305
+D306	.FILL #306
+D307	.FILL #307
+D308	.FILL #308
+D309	.FILL #309
+D310	.FILL #310
+D311	.FILL #311
+D312	.FILL #312
+D313	.FILL #313
+D314	.FILL #314
+D315	.FILL #315
+D316	.FILL #316
+D317	.FILL #317
+D318	.FILL #318
+D319	.FILL #319
+D320	.FILL #320
+D321	.FILL #321
+D322	.FILL #322
+D323	.FILL #323
+D324	.FILL #324
+D325	.FILL #325
+D326	.FILL #326
+D327	.FILL #327
+D328	.FILL #328
+D329	.FILL #329
+D330	.FILL #330
+D331	.FILL #331
+D332	.FILL #332
+D333	.FILL #333
+D334	.FILL #334
+D335	.FILL #335
+D336	.FILL #336
+D337	.FILL #337
+D338	.FILL #338
+D339	.FILL #339
+D340	.FILL #340
+D341	.FILL #341
+D342	.FILL #342
+D343	.FILL #343
+D344	.FILL #344
+D345	.FILL #345
+D346	.FILL #346
+D347	.FILL #347
+D348	.FILL #348
+D349	.FILL #349
+D350	.FILL #350
+D351	.FILL #351
+D352	.FILL #352
+D353	.FILL #353
+D354	.FILL #354
+D355	.FILL #355
+D356	.FILL #356
+D357	.FILL #357
+D358	.FILL #358
+D359	.FILL #359
+D360	.FILL #360
+D361	.FILL #361
+D362	.FILL #362
+D363	.FILL #363
+D364	.FILL #364
+D365	.FILL #365
+D366	.FILL #366
+D367	.FILL #367
+D368	.FILL #368
+D369	.FILL #369
+D370	.FILL #370
+D371	.FILL #371
+D372	.FILL #372
+D373	.FILL #373
+D374	.FILL #374
+D375	.FILL #375
+D376	.FILL #376
+D377	.FILL #377
+D378	.FILL #378
+D379	.FILL #379
+D380	.FILL #380
+D381	.FILL #381
+D382	.FILL #382
+D383	.FILL #383
+D384	.FILL #384
+D385	.FILL #385
+D386	.FILL #386
+D387	.FILL #387
+D388	.FILL #388
+D389	.FILL #389
+D390	.FILL #390
+D391	.FILL #391
+D392	.FILL #392
+D393	.FILL #393
+D394	.FILL #394
+D395	.FILL #395
+D396	.FILL #396
+D397	.FILL #397
+D398	.FILL #398
+D399	.FILL #399
+D400	.FILL #400
+D401	.FILL #401
+D402	.FILL #402
+D403	.FILL #403
+D404	.FILL #404
+D405	.FILL #405
+D406	.FILL #406
+D407	.FILL #407
+D408	.FILL #408
+D409	.FILL #409
+D410	.FILL #410
+D411	.FILL #411
+D412	.FILL #412
+D413	.FILL #413
+D414	.FILL #414
+D415	.FILL #415
+D416	.FILL #416
+D417	.FILL #417
+D418	.FILL #418
+D419	.FILL #419
+D420	.FILL #420
+D421	.FILL #421
+D422	.FILL #422
+D423	.FILL #423
+D424	.FILL #424
+D425	.FILL #425
+D426	.FILL #426
+D427	.FILL #427
+D428	.FILL #428
+D429	.FILL #429
+D430	.FILL #430
+D431	.FILL #431
+D432	.FILL #432
+D433	.FILL #433
+D434	.FILL #434
+D435	.FILL #435
+D436	.FILL #436
+D437	.FILL #437
+D438	.FILL #438
+D439	.FILL #439
+D440	.FILL #440
+D441	.FILL #441
+D442	.FILL #442
+D443	.FILL #443
+D444	.FILL #444
+D445	.FILL #445
+D446	.FILL #446
+D447	.FILL #447
+D448	.FILL #448
+D449	.FILL #449
+D450	.FILL #450
+D451	.FILL #451
+D452	.FILL #452
+D453	.FILL #453
+D454	.FILL #454
+D455	.FILL #455
+D456	.FILL #456
+D457	.FILL #457
+D458	.FILL #458
+D459	.FILL #459
+D460	.FILL #460
+D461	.FILL #461
+D462	.FILL #462
+D463	.FILL #463
+D464	.FILL #464
+D465	.FILL #465
+D466	.FILL #466
+D467	.FILL #467
+D468	.FILL #468
+D469	.FILL #469
+D470	.FILL #470
+D471	.FILL #471
+D472	.FILL #472
+D473	.FILL #473
+D474	.FILL #474
+D475	.FILL #475
+D476	.FILL #476
+D477	.FILL #477
+D478	.FILL #478
+D479	.FILL #479
+D480	.FILL #480
+D481	.FILL #481
+D482	.FILL #482
+D483	.FILL #483
+D484	.FILL #484
+D485	.FILL #485
+D486	.FILL #486
+D487	.FILL #487
+D488	.FILL #488
+D489	.FILL #489
+D490	.FILL #490
+D491	.FILL #491
+D492	.FILL #492
+D493	.FILL #493
+D494	.FILL #494
+D495	.FILL #495
+D496	.FILL #496
+D497	.FILL #497
+D498	.FILL #498
+D499	.FILL #499
+D500	.FILL #500
+D501	.FILL #501
+D502	.FILL #502
+D503	.FILL #503
+D504	.FILL #504
+D505	.FILL #505
+D506	.FILL #506
+D507	.FILL #507
+D508	.FILL #508
+D509	.FILL #509
+D510	.FILL #510
+D511	.FILL #511
+D512	.FILL #512
+D513	.FILL #513
+D514	.FILL #514
+D515	.FILL #515
+D516	.FILL #516
+D517	.FILL #517
+D518	.FILL #518
+D519	.FILL #519
+D520	.FILL #520
+D521	.FILL #521
+D522	.FILL #522
+D523	.FILL #523
+D524	.FILL #524
+D525	.FILL #525
+D526	.FILL #526
+D527	.FILL #527
+D528	.FILL #528
+D529	.FILL #529
+D530	.FILL #530
+D531	.FILL #531
+D532	.FILL #532
+D533	.FILL #533
+D534	.FILL #534
+D535	.FILL #535
+D536	.FILL #536
+D537	.FILL #537
+D538	.FILL #538
+D539	.FILL #539
+D540	.FILL #540
+D541	.FILL #541
+D542	.FILL #542
+D543	.FILL #543
+D544	.FILL #544
+D545	.FILL #545
+D546	.FILL #546
+D547	.FILL #547
+D548	.FILL #548
+D549	.FILL #549
+D550	.FILL #550
+D551	.FILL #551
+D552	.FILL #552
+D553	.FILL #553
+D554	.FILL #554
+D555	.FILL #555
+D556	.FILL #556
+D557	.FILL #557
+D558	.FILL #558
+D559	.FILL #559
+D560	.FILL #560
+D561	.FILL #561
+D562	.FILL #562
+D563	.FILL #563
+D564	.FILL #564
+D565	.FILL #565
+D566	.FILL #566
+D567	.FILL #567
+D568	.FILL #568
+D569	.FILL #569
+D570	.FILL #570
+D571	.FILL #571
+D572	.FILL #572
+D573	.FILL #573
+D574	.FILL #574
+D575	.FILL #575
+D576	.FILL #576
+D577	.FILL #577
+D578	.FILL #578
+D579	.FILL #579
+D580	.FILL #580
+D581	.FILL #581
+D582	.FILL #582
+D583	.FILL #583
+D584	.FILL #584
+D585	.FILL #585
+D586	.FILL #586
+D587	.FILL #587
+D588	.FILL #588
+D589	.FILL #589
+D590	.FILL #590
+D591	.FILL #591
+D592	.FILL #592
+D593	.FILL #593
+D594	.FILL #594
+D595	.FILL #595
+D596	.FILL #596
+D597	.FILL #597
+D598	.FILL #598
+D599	.FILL #599
+D600	.FILL #600
+D601	.FILL #601
+D602	.FILL #602
+D603	.FILL #603
+D604	.FILL #604
+D605	.FILL #605
+D606	.FILL #606
+D607	.FILL #607
+D608	.FILL #608
+D609	.FILL #609
+D610	.FILL #610
+D611	.FILL #611
+D612	.FILL #612
+D613	.FILL #613
+D614	.FILL #614
+D615	.FILL #615
+D616	.FILL #616
+D617	.FILL #617
+D618	.FILL #618
+D619	.FILL #619
+D620	.FILL #620
+D621	.FILL #621
+D622	.FILL #622
+D623	.FILL #623
+D624	.FILL #624
+D625	.FILL #625
+D626	.FILL #626
+D627	.FILL #627
+D628	.FILL #628
+D629	.FILL #629
+D630	.FILL #630
+D631	.FILL #631
+D632	.FILL #632
+D633	.FILL #633
+D634	.FILL #634
+D635	.FILL #635
+D636	.FILL #636
+D637	.FILL #637
+D638	.FILL #638
+D639	.FILL #639
+D640	.FILL #640
+D641	.FILL #641
+D642	.FILL #642
+D643	.FILL #643
+D644	.FILL #644
+D645	.FILL #645
+D646	.FILL #646
+D647	.FILL #647
+D648	.FILL #648
+D649	.FILL #649
+D650	.FILL #650
+D651	.FILL #651
+D652	.FILL #652
+D653	.FILL #653
+D654	.FILL #654
+D655	.FILL #655
+D656	.FILL #656
+D657	.FILL #657
+D658	.FILL #658
+D659	.FILL #659
+D660	.FILL #660
+D661	.FILL #661
+D662	.FILL #662
+D663	.FILL #663
+D664	.FILL #664
+D665	.FILL #665
+D666	.FILL #666
+D667	.FILL #667
+D668	.FILL #668
+D669	.FILL #669
+D670	.FILL #670
+D671	.FILL #671
+D672	.FILL #672
+D673	.FILL #673
+D674	.FILL #674
+D675	.FILL #675
+D676	.FILL #676
+D677	.FILL #677
+D678	.FILL #678
+D679	.FILL #679
+D680	.FILL #680
+D681	.FILL #681
+D682	.FILL #682
+D683	.FILL #683
+D684	.FILL #684
+D685	.FILL #685
+D686	.FILL #686
+D687	.FILL #687
+D688	.FILL #688
+D689	.FILL #689
+D690	.FILL #690
+D691	.FILL #691
+D692	.FILL #692
+D693	.FILL #693
+D694	.FILL #694
+D695	.FILL #695
+D696	.FILL #696
+D697	.FILL #697
+D698	.FILL #698
+D699	.FILL #699
+D700	.FILL #700
+D701	.FILL #701
+D702	.FILL #702
+D703	.FILL #703
+D704	.FILL #704
+D705	.FILL #705
+D706	.FILL #706
+D707	.FILL #707
+D708	.FILL #708
+D709	.FILL #709
+D710	.FILL #710
+D711	.FILL #711
+D712	.FILL #712
+D713	.FILL #713
+D714	.FILL #714
+D715	.FILL #715
+D716	.FILL #716
+D717	.FILL #717
+D718	.FILL #718
+D719	.FILL #719
+D720	.FILL #720
+D721	.FILL #721
+D722	.FILL #722
+D723	.FILL #723
+D724	.FILL #724
+D725	.FILL #725
+D726	.FILL #726
+D727	.FILL #727
+D728	.FILL #728
+D729	.FILL #729
+D730	.FILL #730
+D731	.FILL #731
+D732	.FILL #732
+D733	.FILL #733
+D734	.FILL #734
+D735	.FILL #735
+D736	.FILL #736
+D737	.FILL #737
+D738	.FILL #738
+D739	.FILL #739
+D740	.FILL #740
+D741	.FILL #741
+D742	.FILL #742
+D743	.FILL #743
+D744	.FILL #744
+D745	.FILL #745
+D746	.FILL #746
+D747	.FILL #747
+D748	.FILL #748
+D749	.FILL #749
+D750	.FILL #750
+D751	.FILL #751
+D752	.FILL #752
+D753	.FILL #753
+D754	.FILL #754
+D755	.FILL #755
+D756	.FILL #756
+D757	.FILL #757
+D758	.FILL #758
+D759	.FILL #759
+D760	.FILL #760
+D761	.FILL #761
+D762	.FILL #762
+D763	.FILL #763
+D764	.FILL #764
+D765	.FILL #765
+D766	.FILL #766
+D767	.FILL #767
+D768	.FILL #768
+D769	.FILL #769
+D770	.FILL #770
+D771	.FILL #771
+D772	.FILL #772
+D773	.FILL #773
+D774	.FILL #774
+D775	.FILL #775
+D776	.FILL #776
+D777	.FILL #777
+D778	.FILL #778
+D779	.FILL #779
+D780	.FILL #780
+D781	.FILL #781
+D782	.FILL #782
+D783	.FILL #783
+D784	.FILL #784
+D785	.FILL #785
+D786	.FILL #786
+D787	.FILL #787
+D788	.FILL #788
+D789	.FILL #789
+D790	.FILL #790
+D791	.FILL #791
+D792	.FILL #792
+D793	.FILL #793
+D794	.FILL #794
+D795	.FILL #795
+D796	.FILL #796
+D797	.FILL #797
+D798	.FILL #798
+D799	.FILL #799
+D800	.FILL #800
+D801	.FILL #801
+D802	.FILL #802
+D803	.FILL #803
+D804	.FILL #804
+D805	.FILL #805
+D806	.FILL #806
+D807	.FILL #807
+D808	.FILL #808
+D809	.FILL #809
+D810	.FILL #810
+D811	.FILL #811
+D812	.FILL #812
+D813	.FILL #813
+D814	.FILL #814
+D815	.FILL #815
+D816	.FILL #816
+D817	.FILL #817
+D818	.FILL #818
+D819	.FILL #819
+D820	.FILL #820
+D821	.FILL #821
+D822	.FILL #822
+D823	.FILL #823
+D824	.FILL #824
+D825	.FILL #825
+D826	.FILL #826
+D827	.FILL #827
+D828	.FILL #828
+D829	.FILL #829
+D830	.FILL #830
+D831	.FILL #831
+D832	.FILL #832
+D833	.FILL #833
+D834	.FILL #834
+D835	.FILL #835
+D836	.FILL #836
+D837	.FILL #837
+D838	.FILL #838
+D839	.FILL #839
+D840	.FILL #840
+D841	.FILL #841
+D842	.FILL #842
+D843	.FILL #843
+D844	.FILL #844
+D845	.FILL #845
+D846	.FILL #846
+D847	.FILL #847
+D848	.FILL #848
+D849	.FILL #849
+D850	.FILL #850
+D851	.FILL #851
+D852	.FILL #852
+D853	.FILL #853
+D854	.FILL #854
+D855	.FILL #855
+D856	.FILL #856
+D857	.FILL #857
+D858	.FILL #858
+D859	.FILL #859
+D860	.FILL #860
+D861	.FILL #861
+D862	.FILL #862
+D863	.FILL #863
+D864	.FILL #864
+D865	.FILL #865
+D866	.FILL #866
+D867	.FILL #867
+D868	.FILL #868
+D869	.FILL #869
+D870	.FILL #870
+D871	.FILL #871
+D872	.FILL #872
+D873	.FILL #873
+D874	.FILL #874
+D875	.FILL #875
+D876	.FILL #876
+D877	.FILL #877
+D878	.FILL #878
+D879	.FILL #879
+D880	.FILL #880
+D881	.FILL #881
+D882	.FILL #882
+D883	.FILL #883
+D884	.FILL #884
+D885	.FILL #885
+D886	.FILL #886
+D887	.FILL #887
+D888	.FILL #888
+D889	.FILL #889
+D890	.FILL #890
+D891	.FILL #891
+D892	.FILL #892
+D893	.FILL #893
+D894	.FILL #894
+D895	.FILL #895
+D896	.FILL #896
+D897	.FILL #897
+D898	.FILL #898
+D899	.FILL #899
+D900	.FILL #900
+D901	.FILL #901
+D902	.FILL #902
+D903	.FILL #903
+D904	.FILL #904
+D905	.FILL #905
+D906	.FILL #906
+D907	.FILL #907
+D908	.FILL #908
+D909	.FILL #909
+D910	.FILL #910
+D911	.FILL #911
+D912	.FILL #912
+D913	.FILL #913
+D914	.FILL #914
+D915	.FILL #915
+D916	.FILL #916
+D917	.FILL #917
+D918	.FILL #918
+D919	.FILL #919
+D920	.FILL #920
+D921	.FILL #921
+D922	.FILL #922
+D923	.FILL #923
+D924	.FILL #924
+D925	.FILL #925
+D926	.FILL #926
+D927	.FILL #927
+D928	.FILL #928
+D929	.FILL #929
+D930	.FILL #930
+D931	.FILL #931
+D932	.FILL #932
+D933	.FILL #933
+D934	.FILL #934
+D935	.FILL #935
+D936	.FILL #936
+D937	.FILL #937
+D938	.FILL #938
+D939	.FILL #939
+D940	.FILL #940
+D941	.FILL #941
+D942	.FILL #942
+D943	.FILL #943
+D944	.FILL #944
+D945	.FILL #945
+D946	.FILL #946
+D947	.FILL #947
+D948	.FILL #948
+D949	.FILL #949
+D950	.FILL #950
+D951	.FILL #951
+D952	.FILL #952
+D953	.FILL #953
+D954	.FILL #954
+D955	.FILL #955
+D956	.FILL #956
+D957	.FILL #957
+D958	.FILL #958
+D959	.FILL #959
+D960	.FILL #960
+D961	.FILL #961
+D962	.FILL #962
+D963	.FILL #963
+D964	.FILL #964
+D965	.FILL #965
+D966	.FILL #966
+D967	.FILL #967
+D968	.FILL #968
+D969	.FILL #969
+D970	.FILL #970
+D971	.FILL #971
+D972	.FILL #972
+D973	.FILL #973
+D974	.FILL #974
+D975	.FILL #975
+D976	.FILL #976
+D977	.FILL #977
+D978	.FILL #978
+D979	.FILL #979
+D980	.FILL #980
+D981	.FILL #981
+D982	.FILL #982
+D983	.FILL #983
+D984	.FILL #984
+D985	.FILL #985
+D986	.FILL #986
+D987	.FILL #987
+D988	.FILL #988
+D989	.FILL #989
+D990	.FILL #990
+D991	.FILL #991
+D992	.FILL #992
+D993	.FILL #993
+D994	.FILL #994
+D995	.FILL #995
+D996	.FILL #996
+D997	.FILL #997
+D998	.FILL #998
+D999	.FILL #999
+D1000	.FILL #0
+D1001	.FILL #1
+D1002	.FILL #2
+D1003	.FILL #3
+D1004	.FILL #4
+D1005	.FILL #5
+D1006	.FILL #6
+D1007	.FILL #7
+D1008	.FILL #8
+D1009	.FILL #9
+D1010	.FILL #10
+D1011	.FILL #11
+D1012	.FILL #12
+D1013	.FILL #13
+D1014	.FILL #14
+D1015	.FILL #15
+D1016	.FILL #16
+D1017	.FILL #17
+D1018	.FILL #18
+D1019	.FILL #19
+D1020	.FILL #20
+D1021	.FILL #21
+D1022	.FILL #22
+D1023	.FILL #23
+D1024	.FILL #24
+D1025	.FILL #25
+D1026	.FILL #26
+D1027	.FILL #27
+D1028	.FILL #28
+D1029	.FILL #29
+D1030	.FILL #30
+D1031	.FILL #31
+D1032	.FILL #32
+D1033	.FILL #33
+D1034	.FILL #34
+D1035	.FILL #35
+D1036	.FILL #36
+D1037	.FILL #37
+D1038	.FILL #38
+D1039	.FILL #39
+D1040	.FILL #40
+D1041	.FILL #41
+D1042	.FILL #42
+D1043	.FILL #43
+D1044	.FILL #44
+D1045	.FILL #45
+D1046	.FILL #46
+D1047	.FILL #47
+D1048	.FILL #48
+D1049	.FILL #49
+D1050	.FILL #50
+D1051	.FILL #51
+D1052	.FILL #52
+D1053	.FILL #53
+D1054	.FILL #54
+D1055	.FILL #55
+D1056	.FILL #56
+D1057	.FILL #57
+D1058	.FILL #58
+D1059	.FILL #59
+D1060	.FILL #60
+D1061	.FILL #61
+D1062	.FILL #62
+D1063	.FILL #63
+D1064	.FILL #64
+D1065	.FILL #65
+D1066	.FILL #66
+D1067	.FILL #67
+D1068	.FILL #68
+D1069	.FILL #69
+D1070	.FILL #70
+D1071	.FILL #71
+D1072	.FILL #72
+D1073	.FILL #73
+D1074	.FILL #74
+D1075	.FILL #75
+D1076	.FILL #76
+D1077	.FILL #77
+D1078	.FILL #78
+D1079	.FILL #79
+D1080	.FILL #80
+D1081	.FILL #81
+D1082	.FILL #82
+D1083	.FILL #83
+D1084	.FILL #84
+D1085	.FILL #85
+D1086	.FILL #86
+D1087	.FILL #87
+D1088	.FILL #88
+D1089	.FILL #89
+D1090	.FILL #90
+D1091	.FILL #91
+D1092	.FILL #92
+D1093	.FILL #93
+D1094	.FILL #94
+D1095	.FILL #95
+D1096	.FILL #96
+D1097	.FILL #97
+D1098	.FILL #98
+D1099	.FILL #99
+D1100	.FILL #100
+D1101	.FILL #101
+D1102	.FILL #102
+D1103	.FILL #103
+D1104	.FILL #104
+D1105	.FILL #105
+D1106	.FILL #106
+D1107	.FILL #107
+D1108	.FILL #108
+D1109	.FILL #109
+D1110	.FILL #110
+D1111	.FILL #111
+D1112	.FILL #112
+D1113	.FILL #113
+D1114	.FILL #114
+D1115	.FILL #115
+D1116	.FILL #116
+D1117	.FILL #117
+D1118	.FILL #118
+D1119	.FILL #119
+D1120	.FILL #120
+D1121	.FILL #121
+D1122	.FILL #122
+D1123	.FILL #123
+D1124	.FILL #124
+D1125	.FILL #125
+D1126	.FILL #126
+D1127	.FILL #127
+D1128	.FILL #128
+D1129	.FILL #129
+D1130	.FILL #130
+D1131	.FILL #131
+D1132	.FILL #132
+D1133	.FILL #133
+D1134	.FILL #134
+D1135	.FILL #135
+D1136	.FILL #136
+D1137	.FILL #137
+D1138	.FILL #138
+D1139	.FILL #139
+D1140	.FILL #140
+D1141	.FILL #141
+D1142	.FILL #142
+D1143	.FILL #143
+D1144	.FILL #144
+D1145	.FILL #145
+D1146	.FILL #146
+D1147	.FILL #147
+D1148	.FILL #148
+D1149	.FILL #149
+D1150	.FILL #150
+D1151	.FILL #151
+D1152	.FILL #152
+D1153	.FILL #153
+D1154	.FILL #154
+D1155	.FILL #155
+D1156	.FILL #156
+D1157	.FILL #157
+D1158	.FILL #158
+D1159	.FILL #159
+D1160	.FILL #160
+D1161	.FILL #161
+D1162	.FILL #162
+D1163	.FILL #163
+D1164	.FILL #164
+D1165	.FILL #165
+D1166	.FILL #166
+D1167	.FILL #167
+D1168	.FILL #168
+D1169	.FILL #169
+D1170	.FILL #170
+D1171	.FILL #171
+D1172	.FILL #172
+D1173	.FILL #173
+D1174	.FILL #174
+D1175	.FILL #175
+D1176	.FILL #176
+D1177	.FILL #177
+D1178	.FILL #178
+D1179	.FILL #179
+D1180	.FILL #180
+D1181	.FILL #181
+D1182	.FILL #182
+D1183	.FILL #183
+D1184	.FILL #184
+D1185	.FILL #185
+D1186	.FILL #186
+D1187	.FILL #187
+D1188	.FILL #188
+D1189	.FILL #189
+D1190	.FILL #190
+D1191	.FILL #191
+D1192	.FILL #192
+D1193	.FILL #193
+D1194	.FILL #194
+D1195	.FILL #195
+D1196	.FILL #196
+D1197	.FILL #197
+D1198	.FILL #198
+D1199	.FILL #199
+D1200	.FILL #200
+D1201	.FILL #201
+D1202	.FILL #202
+D1203	.FILL #203
+D1204	.FILL #204
+D1205	.FILL #205
+D1206	.FILL #206
+D1207	.FILL #207
+D1208	.FILL #208
+D1209	.FILL #209
+D1210	.FILL #210
+D1211	.FILL #211
+D1212	.FILL #212
+D1213	.FILL #213
+D1214	.FILL #214
+D1215	.FILL #215
+D1216	.FILL #216
+D1217	.FILL #217
+D1218	.FILL #218
+D1219	.FILL #219
+D1220	.FILL #220
+D1221	.FILL #221
+D1222	.FILL #222
+D1223	.FILL #223
+D1224	.FILL #224
+D1225	.FILL #225
+D1226	.FILL #226
+D1227	.FILL #227
+D1228	.FILL #228
+D1229	.FILL #229
+D1230	.FILL #230
+D1231	.FILL #231
+D1232	.FILL #232
+D1233	.FILL #233
+D1234	.FILL #234
+D1235	.FILL #235
+D1236	.FILL #236
+D1237	.FILL #237
+D1238	.FILL #238
+D1239	.FILL #239
+D1240	.FILL #240
+D1241	.FILL #241
+D1242	.FILL #242
+D1243	.FILL #243
+D1244	.FILL #244
+D1245	.FILL #245
+D1246	.FILL #246
+D1247	.FILL #247
+D1248	.FILL #248
+D1249	.FILL #249
+D1250	.FILL #250
+D1251	.FILL #251
+D1252	.FILL #252
+D1253	.FILL #253
+D1254	.FILL #254
+D1255	.FILL #255
+D1256	.FILL #256
+D1257	.FILL #257
+D1258	.FILL #258
+D1259	.FILL #259
+D1260	.FILL #260
+D1261	.FILL #261
+D1262	.FILL #262
+D1263	.FILL #263
+D1264	.FILL #264
+D1265	.FILL #265
+D1266	.FILL #266
+D1267	.FILL #267
+D1268	.FILL #268
+D1269	.FILL #269
+D1270	.FILL #270
+D1271	.FILL #271
+D1272	.FILL #272
+D1273	.FILL #273
+D1274	.FILL #274
+D1275	.FILL #275
+D1276	.FILL #276
+D1277	.FILL #277
+D1278	.FILL #278
+D1279	.FILL #279
+D1280	.FILL #280
+D1281	.FILL #281
+D1282	.FILL #282
+D1283	.FILL #283
+D1284	.FILL #284
+D1285	.FILL #285
+D1286	.FILL #286
+D1287	.FILL #287
+D1288	.FILL #288
+D1289	.FILL #289
+D1290	.FILL #290
+D1291	.FILL #291
+D1292	.FILL #292
+D1293	.FILL #293
+D1294	.FILL #294
+D1295	.FILL #295
+D1296	.FILL #296
+D1297	.FILL #297
+D1298	.FILL #298
+D1299	.FILL #299
+D1300	.FILL #300
+D1301	.FILL #301
+D1302	.FILL #302
+D1303	.FILL #303
+D1304	.FILL #304
+D1305	.FILL #305
+D1306	.FILL #306
+D1307	.FILL #307
+D1308	.FILL #308
+D1309	.FILL #309
+D1310	.FILL #310
+D1311	.FILL #311
+D1312	.FILL #312
+D1313	.FILL #313
+D1314	.FILL #314
+D1315	.FILL #315
+D1316	.FILL #316
+D1317	.FILL #317
+D1318	.FILL #318
+D1319	.FILL #319
+D1320	.FILL #320
+D1321	.FILL #321
+D1322	.FILL #322
+D1323	.FILL #323
+D1324	.FILL #324
+D1325	.FILL #325
+D1326	.FILL #326
+D1327	.FILL #327
+D1328	.FILL #328
+D1329	.FILL #329
+D1330	.FILL #330
+D1331	.FILL #331
+D1332	.FILL #332
+D1333	.FILL #333
+D1334	.FILL #334
+D1335	.FILL #335
+D1336	.FILL #336
+D1337	.FILL #337
+D1338	.FILL #338
+D1339	.FILL #339
+D1340	.FILL #340
+D1341	.FILL #341
+D1342	.FILL #342
+D1343	.FILL #343
+D1344	.FILL #344
+D1345	.FILL #345
+D1346	.FILL #346
+D1347	.FILL #347
+D1348	.FILL #348
+D1349	.FILL #349
+D1350	.FILL #350
+D1351	.FILL #351
+D1352	.FILL #352
+D1353	.FILL #353
+D1354	.FILL #354
+D1355	.FILL #355
+D1356	.FILL #356
+D1357	.FILL #357
+D1358	.FILL #358
+D1359	.FILL #359
+D1360	.FILL #360
+D1361	.FILL #361
+D1362	.FILL #362
+D1363	.FILL #363
+D1364	.FILL #364
+D1365	.FILL #365
+D1366	.FILL #366
+D1367	.FILL #367
+D1368	.FILL #368
+D1369	.FILL #369
+D1370	.FILL #370
+D1371	.FILL #371
+D1372	.FILL #372
+D1373	.FILL #373
+D1374	.FILL #374
+D1375	.FILL #375
+D1376	.FILL #376
+D1377	.FILL #377
+D1378	.FILL #378
+D1379	.FILL #379
+D1380	.FILL #380
+D1381	.FILL #381
+D1382	.FILL #382
+D1383	.FILL #383
+D1384	.FILL #384
+D1385	.FILL #385
+D1386	.FILL #386
+D1387	.FILL #387
+D1388	.FILL #388
+D1389	.FILL #389
+D1390	.FILL #390
+D1391	.FILL #391
+D1392	.FILL #392
+D1393	.FILL #393
+D1394	.FILL #394
+D1395	.FILL #395
+D1396	.FILL #396
+D1397	.FILL #397
+D1398	.FILL #398
+D1399	.FILL #399
+D1400	.FILL #400
+D1401	.FILL #401
+D1402	.FILL #402
+D1403	.FILL #403
+D1404	.FILL #404
+D1405	.FILL #405
+D1406	.FILL #406
+D1407	.FILL #407
+D1408	.FILL #408
+D1409	.FILL #409
+D1410	.FILL #410
+D1411	.FILL #411
+D1412	.FILL #412
+D1413	.FILL #413
+D1414	.FILL #414
+D1415	.FILL #415
+D1416	.FILL #416
+D1417	.FILL #417
+D1418	.FILL #418
+D1419	.FILL #419
+D1420	.FILL #420
+D1421	.FILL #421
+D1422	.FILL #422
+D1423	.FILL #423
+D1424	.FILL #424
+D1425	.FILL #425
+D1426	.FILL #426
+D1427	.FILL #427
+D1428	.FILL #428
+D1429	.FILL #429
+D1430	.FILL #430
+D1431	.FILL #431
+D1432	.FILL #432
+D1433	.FILL #433
+D1434	.FILL #434
+D1435	.FILL #435
+D1436	.FILL #436
+D1437	.FILL #437
+D1438	.FILL #438
+D1439	.FILL #439
+D1440	.FILL #440
+D1441	.FILL #441
+D1442	.FILL #442
+D1443	.FILL #443
+D1444	.FILL #444
+D1445	.FILL #445
+D1446	.FILL #446
+D1447	.FILL #447
+D1448	.FILL #448
+D1449	.FILL #449
+D1450	.FILL #450
+D1451	.FILL #451
+D1452	.FILL #452
+D1453	.FILL #453
+D1454	.FILL #454
+D1455	.FILL #455
+D1456	.FILL #456
+D1457	.FILL #457
+D1458	.FILL #458
+D1459	.FILL #459
+D1460	.FILL #460
+D1461	.FILL #461
+D1462	.FILL #462
+D1463	.FILL #463
+D1464	.FILL #464
+D1465	.FILL #465
+D1466	.FILL #466
+D1467	.FILL #467
+D1468	.FILL #468
+D1469	.FILL #469
+D1470	.FILL #470
+D1471	.FILL #471
+D1472	.FILL #472
+D1473	.FILL #473
+D1474	.FILL #474
+D1475	.FILL #475
+D1476	.FILL #476
+D1477	.FILL #477
+D1478	.FILL #478
+D1479	.FILL #479
+D1480	.FILL #480
+D1481	.FILL #481
+D1482	.FILL #482
+D1483	.FILL #483
+D1484	.FILL #484
+D1485	.FILL #485
+D1486	.FILL #486
+D1487	.FILL #487
+D1488	.FILL #488
+D1489	.FILL #489
+D1490	.FILL #490
+D1491	.FILL #491
+D1492	.FILL #492
+D1493	.FILL #493
+D1494	.FILL #494
+D1495	.FILL #495
+D1496	.FILL #496
+D1497	.FILL #497
+D1498	.FILL #498
+D1499	.FILL #499
+D1500	.FILL #500
+D1501	.FILL #501
+D1502	.FILL #502
+D1503	.FILL #503
+D1504	.FILL #504
+D1505	.FILL #505
+D1506	.FILL #506
+D1507	.FILL #507
+D1508	.FILL #508
+D1509	.FILL #509
+D1510	.FILL #510
+D1511	.FILL #511
+D1512	.FILL #512
+D1513	.FILL #513
+D1514	.FILL #514
+D1515	.FILL #515
+D1516	.FILL #516
+D1517	.FILL #517
+D1518	.FILL #518
+D1519	.FILL #519
+D1520	.FILL #520
+D1521	.FILL #521
+D1522	.FILL #522
+D1523	.FILL #523
+D1524	.FILL #524
+D1525	.FILL #525
+D1526	.FILL #526
+D1527	.FILL #527
+D1528	.FILL #528
+D1529	.FILL #529
+D1530	.FILL #530
+D1531	.FILL #531
+D1532	.FILL #532
+D1533	.FILL #533
+D1534	.FILL #534
+D1535	.FILL #535
+D1536	.FILL #536
+D1537	.FILL #537
+D1538	.FILL #538
+D1539	.FILL #539
+D1540	.FILL #540
+D1541	.FILL #541
+D1542	.FILL #542
+D1543	.FILL #543
+D1544	.FILL #544
+D1545	.FILL #545
+D1546	.FILL #546
+D1547	.FILL #547
+D1548	.FILL #548
+D1549	.FILL #549
+D1550	.FILL #550
+D1551	.FILL #551
+D1552	.FILL #552
+D1553	.FILL #553
+D1554	.FILL #554
+D1555	.FILL #555
+D1556	.FILL #556
+D1557	.FILL #557
+D1558	.FILL #558
+D1559	.FILL #559
+D1560	.FILL #560
+D1561	.FILL #561
+D1562	.FILL #562
+D1563	.FILL #563
+D1564	.FILL #564
+D1565	.FILL #565
+D1566	.FILL #566
+D1567	.FILL #567
+D1568	.FILL #568
+D1569	.FILL #569
+D1570	.FILL #570
+D1571	.FILL #571
+D1572	.FILL #572
+D1573	.FILL #573
+D1574	.FILL #574
+D1575	.FILL #575
+D1576	.FILL #576
+D1577	.FILL #577
+D1578	.FILL #578
+D1579	.FILL #579
+D1580	.FILL #580
+D1581	.FILL #581
+D1582	.FILL #582
+D1583	.FILL #583
+D1584	.FILL #584
+D1585	.FILL #585
+D1586	.FILL #586
+D1587	.FILL #587
+D1588	.FILL #588
+D1589	.FILL #589
+D1590	.FILL #590
+D1591	.FILL #591
+D1592	.FILL #592
+D1593	.FILL #593
+D1594	.FILL #594
+D1595	.FILL #595
+D1596	.FILL #596
+D1597	.FILL #597
+D1598	.FILL #598
+D1599	.FILL #599
+D1600	.FILL #600
+D1601	.FILL #601
+D1602	.FILL #602
+D1603	.FILL #603
+D1604	.FILL #604
+D1605	.FILL #605
+D1606	.FILL #606
+D1607	.FILL #607
+D1608	.FILL #608
+D1609	.FILL #609
+D1610	.FILL #610
+D1611	.FILL #611
+D1612	.FILL #612
+D1613	.FILL #613
+D1614	.FILL #614
+D1615	.FILL #615
+D1616	.FILL #616
+D1617	.FILL #617
+D1618	.FILL #618
+D1619	.FILL #619
+D1620	.FILL #620
+D1621	.FILL #621
+D1622	.FILL #622
+D1623	.FILL #623
+D1624	.FILL #624
+D1625	.FILL #625
+D1626	.FILL #626
+D1627	.FILL #627
+D1628	.FILL #628
+D1629	.FILL #629
+D1630	.FILL #630
+D1631	.FILL #631
+D1632	.FILL #632
+D1633	.FILL #633
+D1634	.FILL #634
+D1635	.FILL #635
+D1636	.FILL #636
+D1637	.FILL #637
+D1638	.FILL #638
+D1639	.FILL #639
+D1640	.FILL #640
+D1641	.FILL #641
+D1642	.FILL #642
+D1643	.FILL #643
+D1644	.FILL #644
+D1645	.FILL #645
+D1646	.FILL #646
+D1647	.FILL #647
+D1648	.FILL #648
+D1649	.FILL #649
+D1650	.FILL #650
+D1651	.FILL #651
+D1652	.FILL #652
+D1653	.FILL #653
+D1654	.FILL #654
+D1655	.FILL #655
+D1656	.FILL #656
+D1657	.FILL #657
+D1658	.FILL #658
+D1659	.FILL #659
+D1660	.FILL #660
+D1661	.FILL #661
+D1662	.FILL #662
+D1663	.FILL #663
+D1664	.FILL #664
+D1665	.FILL #665
+D1666	.FILL #666
+D1667	.FILL #667
+D1668	.FILL #668
+D1669	.FILL #669
+D1670	.FILL #670
+D1671	.FILL #671
+D1672	.FILL #672
+D1673	.FILL #673
+D1674	.FILL #674
+D1675	.FILL #675
+D1676	.FILL #676
+D1677	.FILL #677
+D1678	.FILL #678
+D1679	.FILL #679
+D1680	.FILL #680
+D1681	.FILL #681
+D1682	.FILL #682
+D1683	.FILL #683
+D1684	.FILL #684
+D1685	.FILL #685
+D1686	.FILL #686
+D1687	.FILL #687
+D1688	.FILL #688
+D1689	.FILL #689
+D1690	.FILL #690
+D1691	.FILL #691
+D1692	.FILL #692
+D1693	.FILL #693
+D1694	.FILL #694
+D1695	.FILL #695
+D1696	.FILL #696
+D1697	.FILL #697
+D1698	.FILL #698
+D1699	.FILL #699
+D1700	.FILL #700
+D1701	.FILL #701
+D1702	.FILL #702
+D1703	.FILL #703
+D1704	.FILL #704
+D1705	.FILL #705
+D1706	.FILL #706
+D1707	.FILL #707
+D1708	.FILL #708
+D1709	.FILL #709
+D1710	.FILL #710
+D1711	.FILL #711
+D1712	.FILL #712
+D1713	.FILL #713
+D1714	.FILL #714
+D1715	.FILL #715
+D1716	.FILL #716
+D1717	.FILL #717
+D1718	.FILL #718
+D1719	.FILL #719
+D1720	.FILL #720
+D1721	.FILL #721
+D1722	.FILL #722
+D1723	.FILL #723
+D1724	.FILL #724
+D1725	.FILL #725
+D1726	.FILL #726
+D1727	.FILL #727
+D1728	.FILL #728
+D1729	.FILL #729
+D1730	.FILL #730
+D1731	.FILL #731
+D1732	.FILL #732
+D1733	.FILL #733
+D1734	.FILL #734
+D1735	.FILL #735
+D1736	.FILL #736
+D1737	.FILL #737
+D1738	.FILL #738
+D1739	.FILL #739
+D1740	.FILL #740
+D1741	.FILL #741
+D1742	.FILL #742
+D1743	.FILL #743
+D1744	.FILL #744
+D1745	.FILL #745
+D1746	.FILL #746
+D1747	.FILL #747
+D1748	.FILL #748
+D1749	.FILL #749
+D1750	.FILL #750
+D1751	.FILL #751
+D1752	.FILL #752
+D1753	.FILL #753
+D1754	.FILL #754
+D1755	.FILL #755
+D1756	.FILL #756
+D1757	.FILL #757
+D1758	.FILL #758
+D1759	.FILL #759
+D1760	.FILL #760
+D1761	.FILL #761
+D1762	.FILL #762
+D1763	.FILL #763
+D1764	.FILL #764
+D1765	.FILL #765
+D1766	.FILL #766
+D1767	.FILL #767
+D1768	.FILL #768
+D1769	.FILL #769
+D1770	.FILL #770
+D1771	.FILL #771
+D1772	.FILL #772
+D1773	.FILL #773
+D1774	.FILL #774
+D1775	.FILL #775
+D1776	.FILL #776
+D1777	.FILL #777
+D1778	.FILL #778
+D1779	.FILL #779
+D1780	.FILL #780
+D1781	.FILL #781
+D1782	.FILL #782
+D1783	.FILL #783
+D1784	.FILL #784
+D1785	.FILL #785
+D1786	.FILL #786
+D1787	.FILL #787
+D1788	.FILL #788
+D1789	.FILL #789
+D1790	.FILL #790
+D1791	.FILL #791
+D1792	.FILL #792
+D1793	.FILL #793
+D1794	.FILL #794
+D1795	.FILL #795
+D1796	.FILL #796
+D1797	.FILL #797
+D1798	.FILL #798
+D1799	.FILL #799
+D1800	.FILL #800
+D1801	.FILL #801
+D1802	.FILL #802
+D1803	.FILL #803
+D1804	.FILL #804
+D1805	.FILL #805
+D1806	.FILL #806
+D1807	.FILL #807
+D1808	.FILL #808
+D1809	.FILL #809
+D1810	.FILL #810
+D1811	.FILL #811
+D1812	.FILL #812
+D1813	.FILL #813
+D1814	.FILL #814
+D1815	.FILL #815
+D1816	.FILL #816
+D1817	.FILL #817
+D1818	.FILL #818
+D1819	.FILL #819
+D1820	.FILL #820
+D1821	.FILL #821
+D1822	.FILL #822
+D1823	.FILL #823
+D1824	.FILL #824
+D1825	.FILL #825
+D1826	.FILL #826
+D1827	.FILL #827
+D1828	.FILL #828
+D1829	.FILL #829
+D1830	.FILL #830
+D1831	.FILL #831
+D1832	.FILL #832
+D1833	.FILL #833
+D1834	.FILL #834
+D1835	.FILL #835
+D1836	.FILL #836
+D1837	.FILL #837
+D1838	.FILL #838
+D1839	.FILL #839
+D1840	.FILL #840
+D1841	.FILL #841
+D1842	.FILL #842
+D1843	.FILL #843
+D1844	.FILL #844
+D1845	.FILL #845
+D1846	.FILL #846
+D1847	.FILL #847
+D1848	.FILL #848
+D1849	.FILL #849
+D1850	.FILL #850
+D1851	.FILL #851
+D1852	.FILL #852
+D1853	.FILL #853
+D1854	.FILL #854
+D1855	.FILL #855
+D1856	.FILL #856
+D1857	.FILL #857
+D1858	.FILL #858
+D1859	.FILL #859
+D1860	.FILL #860
+D1861	.FILL #861
+D1862	.FILL #862
+D1863	.FILL #863
+D1864	.FILL #864
+D1865	.FILL #865
+D1866	.FILL #866
+D1867	.FILL #867
+D1868	.FILL #868
+D1869	.FILL #869
+D1870	.FILL #870
+D1871	.FILL #871
+D1872	.FILL #872
+D1873	.FILL #873
+D1874	.FILL #874
+D1875	.FILL #875
+D1876	.FILL #876
+D1877	.FILL #877
+D1878	.FILL #878
+D1879	.FILL #879
+D1880	.FILL #880
+D1881	.FILL #881
+D1882	.FILL #882
+D1883	.FILL #883
+D1884	.FILL #884
+D1885	.FILL #885
+D1886	.FILL #886
+D1887	.FILL #887
+D1888	.FILL #888
+D1889	.FILL #889
+D1890	.FILL #890
+D1891	.FILL #891
+D1892	.FILL #892
+D1893	.FILL #893
+D1894	.FILL #894
+D1895	.FILL #895
+D1896	.FILL #896
+D1897	.FILL #897
+D1898	.FILL #898
+D1899	.FILL #899
+D1900	.FILL #900
+D1901	.FILL #901
+D1902	.FILL #902
+D1903	.FILL #903
+D1904	.FILL #904
+D1905	.FILL #905
+D1906	.FILL #906
+D1907	.FILL #907
+D1908	.FILL #908
+D1909	.FILL #909
+D1910	.FILL #910
+D1911	.FILL #911
+D1912	.FILL #912
+D1913	.FILL #913
+D1914	.FILL #914
+D1915	.FILL #915
+D1916	.FILL #916
+D1917	.FILL #917
+D1918	.FILL #918
+D1919	.FILL #919
+D1920	.FILL #920
+D1921	.FILL #921
+D1922	.FILL #922
+D1923	.FILL #923
+D1924	.FILL #924
+D1925	.FILL #925
+D1926	.FILL #926
+D1927	.FILL #927
+D1928	.FILL #928
+D1929	.FILL #929
+D1930	.FILL #930
+D1931	.FILL #931
+D1932	.FILL #932
+D1933	.FILL #933
+D1934	.FILL #934
+D1935	.FILL #935
+D1936	.FILL #936
+D1937	.FILL #937
+D1938	.FILL #938
+D1939	.FILL #939
+D1940	.FILL #940
+D1941	.FILL #941
+D1942	.FILL #942
+D1943	.FILL #943
+D1944	.FILL #944
+D1945	.FILL #945
+D1946	.FILL #946
+D1947	.FILL #947
+D1948	.FILL #948
+D1949	.FILL #949
+D1950	.FILL #950
+D1951	.FILL #951
+D1952	.FILL #952
+D1953	.FILL #953
+D1954	.FILL #954
+D1955	.FILL #955
+D1956	.FILL #956
+D1957	.FILL #957
+D1958	.FILL #958
+D1959	.FILL #959
+D1960	.FILL #960
+D1961	.FILL #961
+D1962	.FILL #962
+D1963	.FILL #963
+D1964	.FILL #964
+D1965	.FILL #965
+D1966	.FILL #966
+D1967	.FILL #967
+D1968	.FILL #968
+D1969	.FILL #969
+D1970	.FILL #970
+D1971	.FILL #971
+D1972	.FILL #972
+D1973	.FILL #973
+D1974	.FILL #974
+D1975	.FILL #975
+D1976	.FILL #976
+D1977	.FILL #977
+D1978	.FILL #978
+D1979	.FILL #979
+D1980	.FILL #980
+D1981	.FILL #981
+D1982	.FILL #982
+D1983	.FILL #983
+D1984	.FILL #984
+D1985	.FILL #985
+D1986	.FILL #986
+D1987	.FILL #987
+D1988	.FILL #988
+D1989	.FILL #989
+D1990	.FILL #990
+D1991	.FILL #991
+D1992	.FILL #992
+D1993	.FILL #993
+D1994	.FILL #994
+D1995	.FILL #995
+D1996	.FILL #996
+D1997	.FILL #997
+D1998	.FILL #998
+D1999	.FILL #999
+D2000	.FILL #0
+D2001	.FILL #1
+D2002	.FILL #2
+D2003	.FILL #3
+D2004	.FILL #4
+D2005	.FILL #5
+D2006	.FILL #6
+D2007	.FILL #7
+D2008	.FILL #8
+D2009	.FILL #9
+D2010	.FILL #10
+D2011	.FILL #11
+D2012	.FILL #12
+D2013	.FILL #13
+D2014	.FILL #14
+D2015	.FILL #15
+D2016	.FILL #16
+D2017	.FILL #17
+D2018	.FILL #18
+D2019	.FILL #19
+D2020	.FILL #20
+D2021	.FILL #21
+D2022	.FILL #22
+D2023	.FILL #23
+D2024	.FILL #24
+D2025	.FILL #25
+D2026	.FILL #26
+D2027	.FILL #27
+D2028	.FILL #28
+D2029	.FILL #29
+D2030	.FILL #30
+D2031	.FILL #31
+D2032	.FILL #32
+D2033	.FILL #33
+D2034	.FILL #34
+D2035	.FILL #35
+D2036	.FILL #36
+D2037	.FILL #37
+D2038	.FILL #38
+D2039	.FILL #39
+D2040	.FILL #40
+D2041	.FILL #41
+D2042	.FILL #42
+D2043	.FILL #43
+D2044	.FILL #44
+D2045	.FILL #45
+D2046	.FILL #46
+D2047	.FILL #47
+D2048	.FILL #48
+D2049	.FILL #49
+D2050	.FILL #50
+D2051	.FILL #51
+D2052	.FILL #52
+D2053	.FILL #53
+D2054	.FILL #54
+D2055	.FILL #55
+D2056	.FILL #56
+D2057	.FILL #57
+D2058	.FILL #58
+D2059	.FILL #59
+D2060	.FILL #60
+D2061	.FILL #61
+D2062	.FILL #62
+D2063	.FILL #63
+D2064	.FILL #64
+D2065	.FILL #65
+D2066	.FILL #66
+D2067	.FILL #67
+D2068	.FILL #68
+D2069	.FILL #69
+D2070	.FILL #70
+D2071	.FILL #71
+D2072	.FILL #72
+D2073	.FILL #73
+D2074	.FILL #74
+D2075	.FILL #75
+D2076	.FILL #76
+D2077	.FILL #77
+D2078	.FILL #78
+D2079	.FILL #79
+D2080	.FILL #80
+D2081	.FILL #81
+D2082	.FILL #82
+D2083	.FILL #83
+D2084	.FILL #84
+D2085	.FILL #85
+D2086	.FILL #86
+D2087	.FILL #87
+D2088	.FILL #88
+D2089	.FILL #89
+D2090	.FILL #90
+D2091	.FILL #91
+D2092	.FILL #92
+D2093	.FILL #93
+D2094	.FILL #94
+D2095	.FILL #95
+D2096	.FILL #96
+D2097	.FILL #97
+D2098	.FILL #98
+D2099	.FILL #99
+D2100	.FILL #100
+D2101	.FILL #101
+D2102	.FILL #102
+D2103	.FILL #103
+D2104	.FILL #104
+D2105	.FILL #105
+D2106	.FILL #106
+D2107	.FILL #107
+D2108	.FILL #108
+D2109	.FILL #109
+D2110	.FILL #110
+D2111	.FILL #111
+D2112	.FILL #112
+D2113	.FILL #113
+D2114	.FILL #114
+D2115	.FILL #115
+D2116	.FILL #116
+D2117	.FILL #117
+D2118	.FILL #118
+D2119	.FILL #119
+D2120	.FILL #120
+D2121	.FILL #121
+D2122	.FILL #122
+D2123	.FILL #123
+D2124	.FILL #124
+D2125	.FILL #125
+D2126	.FILL #126
+D2127	.FILL #127
+D2128	.FILL #128
+D2129	.FILL #129
+D2130	.FILL #130
+D2131	.FILL #131
+D2132	.FILL #132
+D2133	.FILL #133
+D2134	.FILL #134
+D2135	.FILL #135
+D2136	.FILL #136
+D2137	.FILL #137
+D2138	.FILL #138
+D2139	.FILL #139
+D2140	.FILL #140
+D2141	.FILL #141
+D2142	.FILL #142
+D2143	.FILL #143
+D2144	.FILL #144
+D2145	.FILL #145
+D2146	.FILL #146
+D2147	.FILL #147
+D2148	.FILL #148
+D2149	.FILL #149
+D2150	.FILL #150
+D2151	.FILL #151
+D2152	.FILL #152
+D2153	.FILL #153
+D2154	.FILL #154
+D2155	.FILL #155
+D2156	.FILL #156
+D2157	.FILL #157
+D2158	.FILL #158
+D2159	.FILL #159
+D2160	.FILL #160
+D2161	.FILL #161
+D2162	.FILL #162
+D2163	.FILL #163
+D2164	.FILL #164
+D2165	.FILL #165
+D2166	.FILL #166
+D2167	.FILL #167
+D2168	.FILL #168
+D2169	.FILL #169
+D2170	.FILL #170
+D2171	.FILL #171
+D2172	.FILL #172
+D2173	.FILL #173
+D2174	.FILL #174
+D2175	.FILL #175
+D2176	.FILL #176
+D2177	.FILL #177
+D2178	.FILL #178
+D2179	.FILL #179
+D2180	.FILL #180
+D2181	.FILL #181
+D2182	.FILL #182
+D2183	.FILL #183
+D2184	.FILL #184
+D2185	.FILL #185
+D2186	.FILL #186
+D2187	.FILL #187
+D2188	.FILL #188
+D2189	.FILL #189
+D2190	.FILL #190
+D2191	.FILL #191
+D2192	.FILL #192
+D2193	.FILL #193
+D2194	.FILL #194
+D2195	.FILL #195
+D2196	.FILL #196
+D2197	.FILL #197
+D2198	.FILL #198
+D2199	.FILL #199
+D2200	.FILL #200
+D2201	.FILL #201
+D2202	.FILL #202
+D2203	.FILL #203
+D2204	.FILL #204
+D2205	.FILL #205
+D2206	.FILL #206
+D2207	.FILL #207
+D2208	.FILL #208
+D2209	.FILL #209
+D2210	.FILL #210
+D2211	.FILL #211
+D2212	.FILL #212
+D2213	.FILL #213
+D2214	.FILL #214
+D2215	.FILL #215
+D2216	.FILL #216
+D2217	.FILL #217
+D2218	.FILL #218
+D2219	.FILL #219
+D2220	.FILL #220
+D2221	.FILL #221
+D2222	.FILL #222
+D2223	.FILL #223
+D2224	.FILL #224
+D2225	.FILL #225
+D2226	.FILL #226
+D2227	.FILL #227
+D2228	.FILL #228
+D2229	.FILL #229
+D2230	.FILL #230
+D2231	.FILL #231
+D2232	.FILL #232
+D2233	.FILL #233
+D2234	.FILL #234
+D2235	.FILL #235
+D2236	.FILL #236
+D2237	.FILL #237
+D2238	.FILL #238
+D2239	.FILL #239
+D2240	.FILL #240
+D2241	.FILL #241
+D2242	.FILL #242
+D2243	.FILL #243
+D2244	.FILL #244
+D2245	.FILL #245
+D2246	.FILL #246
+D2247	.FILL #247
+D2248	.FILL #248
+D2249	.FILL #249
+D2250	.FILL #250
+D2251	.FILL #251
+D2252	.FILL #252
+D2253	.FILL #253
+D2254	.FILL #254
+D2255	.FILL #255
+D2256	.FILL #256
+D2257	.FILL #257
+D2258	.FILL #258
+D2259	.FILL #259
+D2260	.FILL #260
+D2261	.FILL #261
+D2262	.FILL #262
+D2263	.FILL #263
+D2264	.FILL #264
+D2265	.FILL #265
+D2266	.FILL #266
+D2267	.FILL #267
+D2268	.FILL #268
+D2269	.FILL #269
+D2270	.FILL #270
+D2271	.FILL #271
+D2272	.FILL #272
+D2273	.FILL #273
+D2274	.FILL #274
+D2275	.FILL #275
+D2276	.FILL #276
+D2277	.FILL #277
+D2278	.FILL #278
+D2279	.FILL #279
+D2280	.FILL #280
+D2281	.FILL #281
+D2282	.FILL #282
+D2283	.FILL #283
+D2284	.FILL #284
+D2285	.FILL #285
+D2286	.FILL #286
+D2287	.FILL #287
+D2288	.FILL #288
+D2289	.FILL #289
+D2290	.FILL #290
+D2291	.FILL #291
+D2292	.FILL #292
+D2293	.FILL #293
+D2294	.FILL #294
+D2295	.FILL #295
+D2296	.FILL #296
+D2297	.FILL #297
+D2298	.FILL #298
+D2299	.FILL #299
+D2300	.FILL #300
+D2301	.FILL #301
+D2302	.FILL #302
+D2303	.FILL #303
+D2304	.FILL #304
+D2305	.FILL #305
+D2306	.FILL #306
+D2307	.FILL #307
+D2308	.FILL #308
+D2309	.FILL #309
+D2310	.FILL #310
+D2311	.FILL #311
+D2312	.FILL #312
+D2313	.FILL #313
+D2314	.FILL #314
+D2315	.FILL #315
+D2316	.FILL #316
+D2317	.FILL #317
+D2318	.FILL #318
+D2319	.FILL #319
+D2320	.FILL #320
+D2321	.FILL #321
+D2322	.FILL #322
+D2323	.FILL #323
+D2324	.FILL #324
+D2325	.FILL #325
+D2326	.FILL #326
+D2327	.FILL #327
+D2328	.FILL #328
+D2329	.FILL #329
+D2330	.FILL #330
+D2331	.FILL #331
+D2332	.FILL #332
+D2333	.FILL #333
+D2334	.FILL #334
+D2335	.FILL #335
+D2336	.FILL #336
+D2337	.FILL #337
+D2338	.FILL #338
+D2339	.FILL #339
+D2340	.FILL #340
+D2341	.FILL #341
+D2342	.FILL #342
+D2343	.FILL #343
+D2344	.FILL #344
+D2345	.FILL #345
+D2346	.FILL #346
+D2347	.FILL #347
+D2348	.FILL #348
+D2349	.FILL #349
+D2350	.FILL #350
+D2351	.FILL #351
+D2352	.FILL #352
+D2353	.FILL #353
+D2354	.FILL #354
+D2355	.FILL #355
+D2356	.FILL #356
+D2357	.FILL #357
+D2358	.FILL #358
+D2359	.FILL #359
+D2360	.FILL #360
+D2361	.FILL #361
+D2362	.FILL #362
+D2363	.FILL #363
+D2364	.FILL #364
+D2365	.FILL #365
+D2366	.FILL #366
+D2367	.FILL #367
+D2368	.FILL #368
+D2369	.FILL #369
+D2370	.FILL #370
+D2371	.FILL #371
+D2372	.FILL #372
+D2373	.FILL #373
+D2374	.FILL #374
+D2375	.FILL #375
+D2376	.FILL #376
+D2377	.FILL #377
+D2378	.FILL #378
+D2379	.FILL #379
+D2380	.FILL #380
+D2381	.FILL #381
+D2382	.FILL #382
+D2383	.FILL #383
+D2384	.FILL #384
+D2385	.FILL #385
+D2386	.FILL #386
+D2387	.FILL #387
+D2388	.FILL #388
+D2389	.FILL #389
+D2390	.FILL #390
+D2391	.FILL #391
+D2392	.FILL #392
+D2393	.FILL #393
+D2394	.FILL #394
+D2395	.FILL #395
+D2396	.FILL #396
+D2397	.FILL #397
+D2398	.FILL #398
+D2399	.FILL #399
+D2400	.FILL #400
+D2401	.FILL #401
+D2402	.FILL #402
+D2403	.FILL #403
+D2404	.FILL #404
+D2405	.FILL #405
+D2406	.FILL #406
+D2407	.FILL #407
+D2408	.FILL #408
+D2409	.FILL #409
+D2410	.FILL #410
+D2411	.FILL #411
+D2412	.FILL #412
+D2413	.FILL #413
+D2414	.FILL #414
+D2415	.FILL #415
+D2416	.FILL #416
+D2417	.FILL #417
+D2418	.FILL #418
+D2419	.FILL #419
+D2420	.FILL #420
+D2421	.FILL #421
+D2422	.FILL #422
+D2423	.FILL #423
+D2424	.FILL #424
+D2425	.FILL #425
+D2426	.FILL #426
+D2427	.FILL #427
+D2428	.FILL #428
+D2429	.FILL #429
+D2430	.FILL #430
+D2431	.FILL #431
+D2432	.FILL #432
+D2433	.FILL #433
+D2434	.FILL #434
+D2435	.FILL #435
+D2436	.FILL #436
+D2437	.FILL #437
+D2438	.FILL #438
+D2439	.FILL #439
+D2440	.FILL #440
+D2441	.FILL #441
+D2442	.FILL #442
+D2443	.FILL #443
+D2444	.FILL #444
+D2445	.FILL #445
+D2446	.FILL #446
+D2447	.FILL #447
+D2448	.FILL #448
+D2449	.FILL #449
+D2450	.FILL #450
+D2451	.FILL #451
+D2452	.FILL #452
+D2453	.FILL #453
+D2454	.FILL #454
+D2455	.FILL #455
+D2456	.FILL #456
+D2457	.FILL #457
+D2458	.FILL #458
+D2459	.FILL #459
+D2460	.FILL #460
+D2461	.FILL #461
+D2462	.FILL #462
+D2463	.FILL #463
+D2464	.FILL #464
+D2465	.FILL #465
+D2466	.FILL #466
+D2467	.FILL #467
+D2468	.FILL #468
+D2469	.FILL #469
+D2470	.FILL #470
+D2471	.FILL #471
+D2472	.FILL #472
+D2473	.FILL #473
+D2474	.FILL #474
+D2475	.FILL #475
+D2476	.FILL #476
+D2477	.FILL #477
+D2478	.FILL #478
+D2479	.FILL #479
+D2480	.FILL #480
+D2481	.FILL #481
+D2482	.FILL #482
+D2483	.FILL #483
+D2484	.FILL #484
+D2485	.FILL #485
+D2486	.FILL #486
+D2487	.FILL #487
+D2488	.FILL #488
+D2489	.FILL #489
+D2490	.FILL #490
+D2491	.FILL #491
+D2492	.FILL #492
+D2493	.FILL #493
+D2494	.FILL #494
+D2495	.FILL #495
+D2496	.FILL #496
+D2497	.FILL #497
+D2498	.FILL #498
+D2499	.FILL #499
+D2500	.FILL #500
+D2501	.FILL #501
+D2502	.FILL #502
+D2503	.FILL #503
+D2504	.FILL #504
+D2505	.FILL #505
+D2506	.FILL #506
+D2507	.FILL #507
+D2508	.FILL #508
+D2509	.FILL #509
+D2510	.FILL #510
+D2511	.FILL #511
+D2512	.FILL #512
+D2513	.FILL #513
+D2514	.FILL #514
+D2515	.FILL #515
+D2516	.FILL #516
+D2517	.FILL #517
+D2518	.FILL #518
+D2519	.FILL #519
+D2520	.FILL #520
+D2521	.FILL #521
+D2522	.FILL #522
+D2523	.FILL #523
+D2524	.FILL #524
+D2525	.FILL #525
+D2526	.FILL #526
+D2527	.FILL #527
+D2528	.FILL #528
+D2529	.FILL #529
+D2530	.FILL #530
+D2531	.FILL #531
+D2532	.FILL #532
+D2533	.FILL #533
+D2534	.FILL #534
+D2535	.FILL #535
+D2536	.FILL #536
+D2537	.FILL #537
+D2538	.FILL #538
+D2539	.FILL #539
+D2540	.FILL #540
+D2541	.FILL #541
+D2542	.FILL #542
+D2543	.FILL #543
+D2544	.FILL #544
+D2545	.FILL #545
+D2546	.FILL #546
+D2547	.FILL #547
+D2548	.FILL #548
+D2549	.FILL #549
+D2550	.FILL #550
+D2551	.FILL #551
+D2552	.FILL #552
+D2553	.FILL #553
+D2554	.FILL #554
+D2555	.FILL #555
+D2556	.FILL #556
+D2557	.FILL #557
+D2558	.FILL #558
+D2559	.FILL #559
+D2560	.FILL #560
+D2561	.FILL #561
+D2562	.FILL #562
+D2563	.FILL #563
+D2564	.FILL #564
+D2565	.FILL #565
+D2566	.FILL #566
+D2567	.FILL #567
+D2568	.FILL #568
+D2569	.FILL #569
+D2570	.FILL #570
+D2571	.FILL #571
+D2572	.FILL #572
+D2573	.FILL #573
+D2574	.FILL #574
+D2575	.FILL #575
+D2576	.FILL #576
+D2577	.FILL #577
+D2578	.FILL #578
+D2579	.FILL #579
+D2580	.FILL #580
+D2581	.FILL #581
+D2582	.FILL #582
+D2583	.FILL #583
+D2584	.FILL #584
+D2585	.FILL #585
+D2586	.FILL #586
+D2587	.FILL #587
+D2588	.FILL #588
+D2589	.FILL #589
+D2590	.FILL #590
+D2591	.FILL #591
+D2592	.FILL #592
+D2593	.FILL #593
+D2594	.FILL #594
+D2595	.FILL #595
+D2596	.FILL #596
+D2597	.FILL #597
+D2598	.FILL #598
+D2599	.FILL #599
+D2600	.FILL #600
+D2601	.FILL #601
+D2602	.FILL #602
+D2603	.FILL #603
+D2604	.FILL #604
+D2605	.FILL #605
+D2606	.FILL #606
+D2607	.FILL #607
+D2608	.FILL #608
+D2609	.FILL #609
+D2610	.FILL #610
+D2611	.FILL #611
+D2612	.FILL #612
+D2613	.FILL #613
+D2614	.FILL #614
+D2615	.FILL #615
+D2616	.FILL #616
+D2617	.FILL #617
+D2618	.FILL #618
+D2619	.FILL #619
+D2620	.FILL #620
+D2621	.FILL #621
+D2622	.FILL #622
+D2623	.FILL #623
+D2624	.FILL #624
+D2625	.FILL #625
+D2626	.FILL #626
+D2627	.FILL #627
+D2628	.FILL #628
+D2629	.FILL #629
+D2630	.FILL #630
+D2631	.FILL #631
+D2632	.FILL #632
+D2633	.FILL #633
+D2634	.FILL #634
+D2635	.FILL #635
+D2636	.FILL #636
+D2637	.FILL #637
+D2638	.FILL #638
+D2639	.FILL #639
+D2640	.FILL #640
+D2641	.FILL #641
+D2642	.FILL #642
+D2643	.FILL #643
+D2644	.FILL #644
+D2645	.FILL #645
+D2646	.FILL #646
+D2647	.FILL #647
+D2648	.FILL #648
+D2649	.FILL #649
+D2650	.FILL #650
+D2651	.FILL #651
+D2652	.FILL #652
+D2653	.FILL #653
+D2654	.FILL #654
+D2655	.FILL #655
+D2656	.FILL #656
+D2657	.FILL #657
+D2658	.FILL #658
+D2659	.FILL #659
+D2660	.FILL #660
+D2661	.FILL #661
+D2662	.FILL #662
+D2663	.FILL #663
+D2664	.FILL #664
+D2665	.FILL #665
+D2666	.FILL #666
+D2667	.FILL #667
+D2668	.FILL #668
+D2669	.FILL #669
+D2670	.FILL #670
+D2671	.FILL #671
+D2672	.FILL #672
+D2673	.FILL #673
+D2674	.FILL #674
+D2675	.FILL #675
+D2676	.FILL #676
+D2677	.FILL #677
+D2678	.FILL #678
+D2679	.FILL #679
+D2680	.FILL #680
+D2681	.FILL #681
+D2682	.FILL #682
+D2683	.FILL #683
+D2684	.FILL #684
+D2685	.FILL #685
+D2686	.FILL #686
+D2687	.FILL #687
+D2688	.FILL #688
+D2689	.FILL #689
+D2690	.FILL #690
+D2691	.FILL #691
+D2692	.FILL #692
+D2693	.FILL #693
+D2694	.FILL #694
+D2695	.FILL #695
+D2696	.FILL #696
+D2697	.FILL #697
+D2698	.FILL #698
+D2699	.FILL #699
+D2700	.FILL #700
+D2701	.FILL #701
+D2702	.FILL #702
+D2703	.FILL #703
+D2704	.FILL #704
+D2705	.FILL #705
+D2706	.FILL #706
+D2707	.FILL #707
+D2708	.FILL #708
+D2709	.FILL #709
+D2710	.FILL #710
+D2711	.FILL #711
+D2712	.FILL #712
+D2713	.FILL #713
+D2714	.FILL #714
+D2715	.FILL #715
+D2716	.FILL #716
+D2717	.FILL #717
+D2718	.FILL #718
+D2719	.FILL #719
+D2720	.FILL #720
+D2721	.FILL #721
+D2722	.FILL #722
+D2723	.FILL #723
+D2724	.FILL #724
+D2725	.FILL #725
+D2726	.FILL #726
+D2727	.FILL #727
+D2728	.FILL #728
+D2729	.FILL #729
+D2730	.FILL #730
+D2731	.FILL #731
+D2732	.FILL #732
+D2733	.FILL #733
+D2734	.FILL #734
+D2735	.FILL #735
+D2736	.FILL #736
+D2737	.FILL #737
+D2738	.FILL #738
+D2739	.FILL #739
+D2740	.FILL #740
+D2741	.FILL #741
+D2742	.FILL #742
+D2743	.FILL #743
+D2744	.FILL #744
+D2745	.FILL #745
+D2746	.FILL #746
+D2747	.FILL #747
+D2748	.FILL #748
+D2749	.FILL #749
+D2750	.FILL #750
+D2751	.FILL #751
+D2752	.FILL #752
+D2753	.FILL #753
+D2754	.FILL #754
+D2755	.FILL #755
+D2756	.FILL #756
+D2757	.FILL #757
+D2758	.FILL #758
+D2759	.FILL #759
+D2760	.FILL #760
+D2761	.FILL #761
+D2762	.FILL #762
+D2763	.FILL #763
+D2764	.FILL #764
+D2765	.FILL #765
+D2766	.FILL #766
+D2767	.FILL #767
+D2768	.FILL #768
+D2769	.FILL #769
+D2770	.FILL #770
+D2771	.FILL #771
+D2772	.FILL #772
+D2773	.FILL #773
+D2774	.FILL #774
+D2775	.FILL #775
+D2776	.FILL #776
+D2777	.FILL #777
+D2778	.FILL #778
+D2779	.FILL #779
+D2780	.FILL #780
+D2781	.FILL #781
+D2782	.FILL #782
+D2783	.FILL #783
+D2784	.FILL #784
+D2785	.FILL #785
+D2786	.FILL #786
+D2787	.FILL #787
+D2788	.FILL #788
+D2789	.FILL #789
+D2790	.FILL #790
+D2791	.FILL #791
+D2792	.FILL #792
+D2793	.FILL #793
+D2794	.FILL #794
+D2795	.FILL #795
+D2796	.FILL #796
+D2797	.FILL #797
+D2798	.FILL #798
+D2799	.FILL #799
+D2800	.FILL #800
+D2801	.FILL #801
+D2802	.FILL #802
+D2803	.FILL #803
+D2804	.FILL #804
+D2805	.FILL #805
+D2806	.FILL #806
+D2807	.FILL #807
+D2808	.FILL #808
+D2809	.FILL #809
+D2810	.FILL #810
+D2811	.FILL #811
+D2812	.FILL #812
+D2813	.FILL #813
+D2814	.FILL #814
+D2815	.FILL #815
+D2816	.FILL #816
+D2817	.FILL #817
+D2818	.FILL #818
+D2819	.FILL #819
+D2820	.FILL #820
+D2821	.FILL #821
+D2822	.FILL #822
+D2823	.FILL #823
+D2824	.FILL #824
+D2825	.FILL #825
+D2826	.FILL #826
+D2827	.FILL #827
+D2828	.FILL #828
+D2829	.FILL #829
+D2830	.FILL #830
+D2831	.FILL #831
+D2832	.FILL #832
+D2833	.FILL #833
+D2834	.FILL #834
+D2835	.FILL #835
+D2836	.FILL #836
+D2837	.FILL #837
+D2838	.FILL #838
+D2839	.FILL #839
+D2840	.FILL #840
+D2841	.FILL #841
+D2842	.FILL #842
+D2843	.FILL #843
+D2844	.FILL #844
+D2845	.FILL #845
+D2846	.FILL #846
+D2847	.FILL #847
+D2848	.FILL #848
+D2849	.FILL #849
+D2850	.FILL #850
+D2851	.FILL #851
+D2852	.FILL #852
+D2853	.FILL #853
+D2854	.FILL #854
+D2855	.FILL #855
+D2856	.FILL #856
+D2857	.FILL #857
+D2858	.FILL #858
+D2859	.FILL #859
+D2860	.FILL #860
+D2861	.FILL #861
+D2862	.FILL #862
+D2863	.FILL #863
+D2864	.FILL #864
+D2865	.FILL #865
+D2866	.FILL #866
+D2867	.FILL #867
+D2868	.FILL #868
+D2869	.FILL #869
+D2870	.FILL #870
+D2871	.FILL #871
+D2872	.FILL #872
+D2873	.FILL #873
+D2874	.FILL #874
+D2875	.FILL #875
+D2876	.FILL #876
+D2877	.FILL #877
+D2878	.FILL #878
+D2879	.FILL #879
+D2880	.FILL #880
+D2881	.FILL #881
+D2882	.FILL #882
+D2883	.FILL #883
+D2884	.FILL #884
+D2885	.FILL #885
+D2886	.FILL #886
+D2887	.FILL #887
+D2888	.FILL #888
+D2889	.FILL #889
+D2890	.FILL #890
+D2891	.FILL #891
+D2892	.FILL #892
+D2893	.FILL #893
+D2894	.FILL #894
+D2895	.FILL #895
+D2896	.FILL #896
+D2897	.FILL #897
+D2898	.FILL #898
+D2899	.FILL #899
+D2900	.FILL #900
+D2901	.FILL #901
+D2902	.FILL #902
+D2903	.FILL #903
+D2904	.FILL #904
+D2905	.FILL #905
+D2906	.FILL #906
+D2907	.FILL #907
+D2908	.FILL #908
+D2909	.FILL #909
+D2910	.FILL #910
+D2911	.FILL #911
+D2912	.FILL #912
+D2913	.FILL #913
+D2914	.FILL #914
+D2915	.FILL #915
+D2916	.FILL #916
+D2917	.FILL #917
+D2918	.FILL #918
+D2919	.FILL #919
+D2920	.FILL #920
+D2921	.FILL #921
+D2922	.FILL #922
+D2923	.FILL #923
+D2924	.FILL #924
+D2925	.FILL #925
+D2926	.FILL #926
+D2927	.FILL #927
+D2928	.FILL #928
+D2929	.FILL #929
+D2930	.FILL #930
+D2931	.FILL #931
+D2932	.FILL #932
+D2933	.FILL #933
+D2934	.FILL #934
+D2935	.FILL #935
+D2936	.FILL #936
+D2937	.FILL #937
+D2938	.FILL #938
+D2939	.FILL #939
+D2940	.FILL #940
+D2941	.FILL #941
+D2942	.FILL #942
+D2943	.FILL #943
+D2944	.FILL #944
+D2945	.FILL #945
+D2946	.FILL #946
+D2947	.FILL #947
+D2948	.FILL #948
+D2949	.FILL #949
+D2950	.FILL #950
+D2951	.FILL #951
+D2952	.FILL #952
+D2953	.FILL #953
+D2954	.FILL #954
+D2955	.FILL #955
+D2956	.FILL #956
+D2957	.FILL #957
+D2958	.FILL #958
+D2959	.FILL #959
+D2960	.FILL #960
+D2961	.FILL #961
+D2962	.FILL #962
+D2963	.FILL #963
+D2964	.FILL #964
+D2965	.FILL #965
+D2966	.FILL #966
+D2967	.FILL #967
+D2968	.FILL #968
+D2969	.FILL #969
+D2970	.FILL #970
+D2971	.FILL #971
+D2972	.FILL #972
+D2973	.FILL #973
+D2974	.FILL #974
+D2975	.FILL #975
+D2976	.FILL #976
+D2977	.FILL #977
+D2978	.FILL #978
+D2979	.FILL #979
+D2980	.FILL #980
+D2981	.FILL #981
+D2982	.FILL #982
+D2983	.FILL #983
+D2984	.FILL #984
+D2985	.FILL #985
+D2986	.FILL #986
+D2987	.FILL #987
+D2988	.FILL #988
+D2989	.FILL #989
+D2990	.FILL #990
+D2991	.FILL #991
+D2992	.FILL #992
+D2993	.FILL #993
+D2994	.FILL #994
+D2995	.FILL #995
+D2996	.FILL #996
+D2997	.FILL #997
+D2998	.FILL #998
+D2999	.FILL #999
+D3000	.FILL #0
+D3001	.FILL #1
+D3002	.FILL #2
+D3003	.FILL #3
+D3004	.FILL #4
+D3005	.FILL #5
+D3006	.FILL #6
+D3007	.FILL #7
+D3008	.FILL #8
+D3009	.FILL #9
+D3010	.FILL #10
+D3011	.FILL #11
+D3012	.FILL #12
+D3013	.FILL #13
+D3014	.FILL #14
+D3015	.FILL #15
+D3016	.FILL #16
+D3017	.FILL #17
+D3018	.FILL #18
+D3019	.FILL #19
+D3020	.FILL #20
+D3021	.FILL #21
+D3022	.FILL #22
+D3023	.FILL #23
+D3024	.FILL #24
+D3025	.FILL #25
+D3026	.FILL #26
+D3027	.FILL #27
+D3028	.FILL #28
+D3029	.FILL #29
+D3030	.FILL #30
+D3031	.FILL #31
+D3032	.FILL #32
+D3033	.FILL #33
+D3034	.FILL #34
+D3035	.FILL #35
+D3036	.FILL #36
+D3037	.FILL #37
+D3038	.FILL #38
+D3039	.FILL #39
+D3040	.FILL #40
+D3041	.FILL #41
+D3042	.FILL #42
+D3043	.FILL #43
+D3044	.FILL #44
+D3045	.FILL #45
+D3046	.FILL #46
+D3047	.FILL #47
+D3048	.FILL #48
+D3049	.FILL #49
+D3050	.FILL #50
+D3051	.FILL #51
+D3052	.FILL #52
+D3053	.FILL #53
+D3054	.FILL #54
+D3055	.FILL #55
+D3056	.FILL #56
+D3057	.FILL #57
+D3058	.FILL #58
+D3059	.FILL #59
+D3060	.FILL #60
+D3061	.FILL #61
+D3062	.FILL #62
+D3063	.FILL #63
+D3064	.FILL #64
+D3065	.FILL #65
+D3066	.FILL #66
+D3067	.FILL #67
+D3068	.FILL #68
+D3069	.FILL #69
+D3070	.FILL #70
+D3071	.FILL #71
+D3072	.FILL #72
+D3073	.FILL #73
+D3074	.FILL #74
+D3075	.FILL #75
+D3076	.FILL #76
+D3077	.FILL #77
+D3078	.FILL #78
+D3079	.FILL #79
+D3080	.FILL #80
+D3081	.FILL #81
+D3082	.FILL #82
+D3083	.FILL #83
+D3084	.FILL #84
+D3085	.FILL #85
+D3086	.FILL #86
+D3087	.FILL #87
+D3088	.FILL #88
+D3089	.FILL #89
+D3090	.FILL #90
+D3091	.FILL #91
+D3092	.FILL #92
+D3093	.FILL #93
+D3094	.FILL #94
+D3095	.FILL #95
+D3096	.FILL #96
+D3097	.FILL #97
+D3098	.FILL #98
+D3099	.FILL #99
+D3100	.FILL #100
+D3101	.FILL #101
+D3102	.FILL #102
+D3103	.FILL #103
+D3104	.FILL #104
+D3105	.FILL #105
+D3106	.FILL #106
+D3107	.FILL #107
+D3108	.FILL #108
+D3109	.FILL #109
+D3110	.FILL #110
+D3111	.FILL #111
+D3112	.FILL #112
+D3113	.FILL #113
+D3114	.FILL #114
+D3115	.FILL #115
+D3116	.FILL #116
+D3117	.FILL #117
+D3118	.FILL #118
+D3119	.FILL #119
+D3120	.FILL #120
+D3121	.FILL #121
+D3122	.FILL #122
+D3123	.FILL #123
+D3124	.FILL #124
+D3125	.FILL #125
+D3126	.FILL #126
+D3127	.FILL #127
+D3128	.FILL #128
+D3129	.FILL #129
+D3130	.FILL #130
+D3131	.FILL #131
+D3132	.FILL #132
+D3133	.FILL #133
+D3134	.FILL #134
+D3135	.FILL #135
+D3136	.FILL #136
+D3137	.FILL #137
+D3138	.FILL #138
+D3139	.FILL #139
+D3140	.FILL #140
+D3141	.FILL #141
+D3142	.FILL #142
+D3143	.FILL #143
+D3144	.FILL #144
+D3145	.FILL #145
+D3146	.FILL #146
+D3147	.FILL #147
+D3148	.FILL #148
+D3149	.FILL #149
+D3150	.FILL #150
+D3151	.FILL #151
+D3152	.FILL #152
+D3153	.FILL #153
+D3154	.FILL #154
+D3155	.FILL #155
+D3156	.FILL #156
+D3157	.FILL #157
+D3158	.FILL #158
+D3159	.FILL #159
+D3160	.FILL #160
+D3161	.FILL #161
+D3162	.FILL #162
+D3163	.FILL #163
+D3164	.FILL #164
+D3165	.FILL #165
+D3166	.FILL #166
+D3167	.FILL #167
+D3168	.FILL #168
+D3169	.FILL #169
+D3170	.FILL #170
+D3171	.FILL #171
+D3172	.FILL #172
+D3173	.FILL #173
+D3174	.FILL #174
+D3175	.FILL #175
+D3176	.FILL #176
+D3177	.FILL #177
+D3178	.FILL #178
+D3179	.FILL #179
+D3180	.FILL #180
+D3181	.FILL #181
+D3182	.FILL #182
+D3183	.FILL #183
+D3184	.FILL #184
+D3185	.FILL #185
+D3186	.FILL #186
+D3187	.FILL #187
+D3188	.FILL #188
+D3189	.FILL #189
+D3190	.FILL #190
+D3191	.FILL #191
+D3192	.FILL #192
+D3193	.FILL #193
+D3194	.FILL #194
+D3195	.FILL #195
+D3196	.FILL #196
+D3197	.FILL #197
+D3198	.FILL #198
+D3199	.FILL #199
+D3200	.FILL #200
+D3201	.FILL #201
+D3202	.FILL #202
+D3203	.FILL #203
+D3204	.FILL #204
+D3205	.FILL #205
+D3206	.FILL #206
+D3207	.FILL #207
+D3208	.FILL #208
+D3209	.FILL #209
+D3210	.FILL #210
+D3211	.FILL #211
+D3212	.FILL #212
+D3213	.FILL #213
+D3214	.FILL #214
+D3215	.FILL #215
+D3216	.FILL #216
+D3217	.FILL #217
+D3218	.FILL #218
+D3219	.FILL #219
+D3220	.FILL #220
+D3221	.FILL #221
+D3222	.FILL #222
+D3223	.FILL #223
+D3224	.FILL #224
+D3225	.FILL #225
+D3226	.FILL #226
+D3227	.FILL #227
+D3228	.FILL #228
+D3229	.FILL #229
+D3230	.FILL #230
+D3231	.FILL #231
+D3232	.FILL #232
+D3233	.FILL #233
+D3234	.FILL #234
+D3235	.FILL #235
+D3236	.FILL #236
+D3237	.FILL #237
+D3238	.FILL #238
+D3239	.FILL #239
+D3240	.FILL #240
+D3241	.FILL #241
+D3242	.FILL #242
+D3243	.FILL #243
+D3244	.FILL #244
+D3245	.FILL #245
+D3246	.FILL #246
+D3247	.FILL #247
+D3248	.FILL #248
+D3249	.FILL #249
+D3250	.FILL #250
+D3251	.FILL #251
+D3252	.FILL #252
+D3253	.FILL #253
+D3254	.FILL #254
+D3255	.FILL #255
+D3256	.FILL #256
+D3257	.FILL #257
+D3258	.FILL #258
+D3259	.FILL #259
+D3260	.FILL #260
+D3261	.FILL #261
+D3262	.FILL #262
+D3263	.FILL #263
+D3264	.FILL #264
+D3265	.FILL #265
+D3266	.FILL #266
+D3267	.FILL #267
+D3268	.FILL #268
+D3269	.FILL #269
+D3270	.FILL #270
+D3271	.FILL #271
+D3272	.FILL #272
+D3273	.FILL #273
+D3274	.FILL #274
+D3275	.FILL #275
+D3276	.FILL #276
+D3277	.FILL #277
+D3278	.FILL #278
+D3279	.FILL #279
+D3280	.FILL #280
+D3281	.FILL #281
+D3282	.FILL #282
+D3283	.FILL #283
+D3284	.FILL #284
+D3285	.FILL #285
+D3286	.FILL #286
+D3287	.FILL #287
+D3288	.FILL #288
+D3289	.FILL #289
+D3290	.FILL #290
+D3291	.FILL #291
+D3292	.FILL #292
+D3293	.FILL #293
+D3294	.FILL #294
+D3295	.FILL #295
+D3296	.FILL #296
+D3297	.FILL #297
+D3298	.FILL #298
+D3299	.FILL #299
+D3300	.FILL #300
+D3301	.FILL #301
+D3302	.FILL #302
+D3303	.FILL #303
+D3304	.FILL #304
+D3305	.FILL #305
+D3306	.FILL #306
+D3307	.FILL #307
+D3308	.FILL #308
+D3309	.FILL #309
+D3310	.FILL #310
+D3311	.FILL #311
+D3312	.FILL #312
+D3313	.FILL #313
+D3314	.FILL #314
+D3315	.FILL #315
+D3316	.FILL #316
+D3317	.FILL #317
+D3318	.FILL #318
+D3319	.FILL #319
+D3320	.FILL #320
+D3321	.FILL #321
+D3322	.FILL #322
+D3323	.FILL #323
+D3324	.FILL #324
+D3325	.FILL #325
+D3326	.FILL #326
+D3327	.FILL #327
+D3328	.FILL #328
+D3329	.FILL #329
+D3330	.FILL #330
+D3331	.FILL #331
+D3332	.FILL #332
+D3333	.FILL #333
+D3334	.FILL #334
+D3335	.FILL #335
+D3336	.FILL #336
+D3337	.FILL #337
+D3338	.FILL #338
+D3339	.FILL #339
+D3340	.FILL #340
+D3341	.FILL #341
+D3342	.FILL #342
+D3343	.FILL #343
+D3344	.FILL #344
+D3345	.FILL #345
+D3346	.FILL #346
+D3347	.FILL #347
+D3348	.FILL #348
+D3349	.FILL #349
+D3350	.FILL #350
+D3351	.FILL #351
+D3352	.FILL #352
+D3353	.FILL #353
+D3354	.FILL #354
+D3355	.FILL #355
+D3356	.FILL #356
+D3357	.FILL #357
+D3358	.FILL #358
+D3359	.FILL #359
+D3360	.FILL #360
+D3361	.FILL #361
+D3362	.FILL #362
+D3363	.FILL #363
+D3364	.FILL #364
+D3365	.FILL #365
+D3366	.FILL #366
+D3367	.FILL #367
+D3368	.FILL #368
+D3369	.FILL #369
+D3370	.FILL #370
+D3371	.FILL #371
+D3372	.FILL #372
+D3373	.FILL #373
+D3374	.FILL #374
+D3375	.FILL #375
+D3376	.FILL #376
+D3377	.FILL #377
+D3378	.FILL #378
+D3379	.FILL #379
+D3380	.FILL #380
+D3381	.FILL #381
+D3382	.FILL #382
+D3383	.FILL #383
+D3384	.FILL #384
+D3385	.FILL #385
+D3386	.FILL #386
+D3387	.FILL #387
+D3388	.FILL #388
+D3389	.FILL #389
+D3390	.FILL #390
+D3391	.FILL #391
+D3392	.FILL #392
+D3393	.FILL #393
+D3394	.FILL #394
+D3395	.FILL #395
+D3396	.FILL #396
+D3397	.FILL #397
+D3398	.FILL #398
+D3399	.FILL #399
+D3400	.FILL #400
+D3401	.FILL #401
+D3402	.FILL #402
+D3403	.FILL #403
+D3404	.FILL #404
+D3405	.FILL #405
+D3406	.FILL #406
+D3407	.FILL #407
+D3408	.FILL #408
+D3409	.FILL #409
+D3410	.FILL #410
+D3411	.FILL #411
+D3412	.FILL #412
+D3413	.FILL #413
+D3414	.FILL #414
+D3415	.FILL #415
+D3416	.FILL #416
+D3417	.FILL #417
+D3418	.FILL #418
+D3419	.FILL #419
+D3420	.FILL #420
+D3421	.FILL #421
+D3422	.FILL #422
+D3423	.FILL #423
+D3424	.FILL #424
+D3425	.FILL #425
+D3426	.FILL #426
+D3427	.FILL #427
+D3428	.FILL #428
+D3429	.FILL #429
+D3430	.FILL #430
+D3431	.FILL #431
+D3432	.FILL #432
+D3433	.FILL #433
+D3434	.FILL #434
+D3435	.FILL #435
+D3436	.FILL #436
+D3437	.FILL #437
+D3438	.FILL #438
+D3439	.FILL #439
+D3440	.FILL #440
+D3441	.FILL #441
+D3442	.FILL #442
+D3443	.FILL #443
+D3444	.FILL #444
+D3445	.FILL #445
+D3446	.FILL #446
+D3447	.FILL #447
+D3448	.FILL #448
+D3449	.FILL #449
+D3450	.FILL #450
+D3451	.FILL #451
+D3452	.FILL #452
+D3453	.FILL #453
+D3454	.FILL #454
+D3455	.FILL #455
+D3456	.FILL #456
+D3457	.FILL #457
+D3458	.FILL #458
+D3459	.FILL #459
+D3460	.FILL #460
+D3461	.FILL #461
+D3462	.FILL #462
+D3463	.FILL #463
+D3464	.FILL #464
+D3465	.FILL #465
+D3466	.FILL #466
+D3467	.FILL #467
+D3468	.FILL #468
+D3469	.FILL #469
+D3470	.FILL #470
+D3471	.FILL #471
+D3472	.FILL #472
+D3473	.FILL #473
+D3474	.FILL #474
+D3475	.FILL #475
+D3476	.FILL #476
+D3477	.FILL #477
+D3478	.FILL #478
+D3479	.FILL #479
+D3480	.FILL #480
+D3481	.FILL #481
+D3482	.FILL #482
+D3483	.FILL #483
+D3484	.FILL #484
+D3485	.FILL #485
+D3486	.FILL #486
+D3487	.FILL #487
+D3488	.FILL #488
+D3489	.FILL #489
+D3490	.FILL #490
+D3491	.FILL #491
+D3492	.FILL #492
+D3493	.FILL #493
+D3494	.FILL #494
+D3495	.FILL #495
+D3496	.FILL #496
+D3497	.FILL #497
+D3498	.FILL #498
+D3499	.FILL #499
+D3500	.FILL #500
+D3501	.FILL #501
+D3502	.FILL #502
+D3503	.FILL #503
+D3504	.FILL #504
+D3505	.FILL #505
+D3506	.FILL #506
+D3507	.FILL #507
+D3508	.FILL #508
+D3509	.FILL #509
+D3510	.FILL #510
+D3511	.FILL #511
+D3512	.FILL #512
+D3513	.FILL #513
+D3514	.FILL #514
+D3515	.FILL #515
+D3516	.FILL #516
+D3517	.FILL #517
+D3518	.FILL #518
+D3519	.FILL #519
+D3520	.FILL #520
+D3521	.FILL #521
+D3522	.FILL #522
+D3523	.FILL #523
+D3524	.FILL #524
+D3525	.FILL #525
+D3526	.FILL #526
+D3527	.FILL #527
+D3528	.FILL #528
+D3529	.FILL #529
+D3530	.FILL #530
+D3531	.FILL #531
+D3532	.FILL #532
+D3533	.FILL #533
+D3534	.FILL #534
+D3535	.FILL #535
+D3536	.FILL #536
+D3537	.FILL #537
+D3538	.FILL #538
+D3539	.FILL #539
+D3540	.FILL #540
+D3541	.FILL #541
+D3542	.FILL #542
+D3543	.FILL #543
+D3544	.FILL #544
+D3545	.FILL #545
+D3546	.FILL #546
+D3547	.FILL #547
+D3548	.FILL #548
+D3549	.FILL #549
+D3550	.FILL #550
+D3551	.FILL #551
+D3552	.FILL #552
+D3553	.FILL #553
+D3554	.FILL #554
+D3555	.FILL #555
+D3556	.FILL #556
+D3557	.FILL #557
+D3558	.FILL #558
+D3559	.FILL #559
+D3560	.FILL #560
+D3561	.FILL #561
+D3562	.FILL #562
+D3563	.FILL #563
+D3564	.FILL #564
+D3565	.FILL #565
+D3566	.FILL #566
+D3567	.FILL #567
+D3568	.FILL #568
+D3569	.FILL #569
+D3570	.FILL #570
+D3571	.FILL #571
+D3572	.FILL #572
+D3573	.FILL #573
+D3574	.FILL #574
+D3575	.FILL #575
+D3576	.FILL #576
+D3577	.FILL #577
+D3578	.FILL #578
+D3579	.FILL #579
+D3580	.FILL #580
+D3581	.FILL #581
+D3582	.FILL #582
+D3583	.FILL #583
+D3584	.FILL #584
+D3585	.FILL #585
+D3586	.FILL #586
+D3587	.FILL #587
+D3588	.FILL #588
+D3589	.FILL #589
+D3590	.FILL #590
+D3591	.FILL #591
+D3592	.FILL #592
+D3593	.FILL #593
+D3594	.FILL #594
+D3595	.FILL #595
+D3596	.FILL #596
+D3597	.FILL #597
+D3598	.FILL #598
+D3599	.FILL #599
+D3600	.FILL #600
+D3601	.FILL #601
+D3602	.FILL #602
+D3603	.FILL #603
+D3604	.FILL #604
+D3605	.FILL #605
+D3606	.FILL #606
+D3607	.FILL #607
+D3608	.FILL #608
+D3609	.FILL #609
+D3610	.FILL #610
+D3611	.FILL #611
+D3612	.FILL #612
+D3613	.FILL #613
+D3614	.FILL #614
+D3615	.FILL #615
+D3616	.FILL #616
+D3617	.FILL #617
+D3618	.FILL #618
+D3619	.FILL #619
+D3620	.FILL #620
+D3621	.FILL #621
+D3622	.FILL #622
+D3623	.FILL #623
+D3624	.FILL #624
+D3625	.FILL #625
+D3626	.FILL #626
+D3627	.FILL #627
+D3628	.FILL #628
+D3629	.FILL #629
+D3630	.FILL #630
+D3631	.FILL #631
+D3632	.FILL #632
+D3633	.FILL #633
+D3634	.FILL #634
+D3635	.FILL #635
+D3636	.FILL #636
+D3637	.FILL #637
+D3638	.FILL #638
+D3639	.FILL #639
+D3640	.FILL #640
+D3641	.FILL #641
+D3642	.FILL #642
+D3643	.FILL #643
+D3644	.FILL #644
+D3645	.FILL #645
+D3646	.FILL #646
+D3647	.FILL #647
+D3648	.FILL #648
+D3649	.FILL #649
+D3650	.FILL #650
+D3651	.FILL #651
+D3652	.FILL #652
+D3653	.FILL #653
+D3654	.FILL #654
+D3655	.FILL #655
+D3656	.FILL #656
+D3657	.FILL #657
+D3658	.FILL #658
+D3659	.FILL #659
+D3660	.FILL #660
+D3661	.FILL #661
+D3662	.FILL #662
+D3663	.FILL #663
+D3664	.FILL #664
+D3665	.FILL #665
+D3666	.FILL #666
+D3667	.FILL #667
+D3668	.FILL #668
+D3669	.FILL #669
+D3670	.FILL #670
+D3671	.FILL #671
+D3672	.FILL #672
+D3673	.FILL #673
+D3674	.FILL #674
+D3675	.FILL #675
+D3676	.FILL #676
+D3677	.FILL #677
+D3678	.FILL #678
+D3679	.FILL #679
+D3680	.FILL #680
+D3681	.FILL #681
+D3682	.FILL #682
+D3683	.FILL #683
+D3684	.FILL #684
+D3685	.FILL #685
+D3686	.FILL #686
+D3687	.FILL #687
+D3688	.FILL #688
+D3689	.FILL #689
+D3690	.FILL #690
+D3691	.FILL #691
+D3692	.FILL #692
+D3693	.FILL #693
+D3694	.FILL #694
+D3695	.FILL #695
+D3696	.FILL #696
+D3697	.FILL #697
+D3698	.FILL #698
+D3699	.FILL #699
+D3700	.FILL #700
+D3701	.FILL #701
+D3702	.FILL #702
+D3703	.FILL #703
+D3704	.FILL #704
+D3705	.FILL #705
+D3706	.FILL #706
+D3707	.FILL #707
+D3708	.FILL #708
+D3709	.FILL #709
+D3710	.FILL #710
+D3711	.FILL #711
+D3712	.FILL #712
+D3713	.FILL #713
+D3714	.FILL #714
+D3715	.FILL #715
+D3716	.FILL #716
+D3717	.FILL #717
+D3718	.FILL #718
+D3719	.FILL #719
+D3720	.FILL #720
+D3721	.FILL #721
+D3722	.FILL #722
+D3723	.FILL #723
+D3724	.FILL #724
+D3725	.FILL #725
+D3726	.FILL #726
+D3727	.FILL #727
+D3728	.FILL #728
+D3729	.FILL #729
+D3730	.FILL #730
+D3731	.FILL #731
+D3732	.FILL #732
+D3733	.FILL #733
+D3734	.FILL #734
+D3735	.FILL #735
+D3736	.FILL #736
+D3737	.FILL #737
+D3738	.FILL #738
+D3739	.FILL #739
+D3740	.FILL #740
+D3741	.FILL #741
+D3742	.FILL #742
+D3743	.FILL #743
+D3744	.FILL #744
+D3745	.FILL #745
+D3746	.FILL #746
+D3747	.FILL #747
+D3748	.FILL #748
+D3749	.FILL #749
+D3750	.FILL #750
+D3751	.FILL #751
+D3752	.FILL #752
+D3753	.FILL #753
+D3754	.FILL #754
+D3755	.FILL #755
+D3756	.FILL #756
+D3757	.FILL #757
+D3758	.FILL #758
+D3759	.FILL #759
+D3760	.FILL #760
+D3761	.FILL #761
+D3762	.FILL #762
+D3763	.FILL #763
+D3764	.FILL #764
+D3765	.FILL #765
+D3766	.FILL #766
+D3767	.FILL #767
+D3768	.FILL #768
+D3769	.FILL #769
+D3770	.FILL #770
+D3771	.FILL #771
+D3772	.FILL #772
+D3773	.FILL #773
+D3774	.FILL #774
+D3775	.FILL #775
+D3776	.FILL #776
+D3777	.FILL #777
+D3778	.FILL #778
+D3779	.FILL #779
+D3780	.FILL #780
+D3781	.FILL #781
+D3782	.FILL #782
+D3783	.FILL #783
+D3784	.FILL #784
+D3785	.FILL #785
+D3786	.FILL #786
+D3787	.FILL #787
+D3788	.FILL #788
+D3789	.FILL #789
+D3790	.FILL #790
+D3791	.FILL #791
+D3792	.FILL #792
+D3793	.FILL #793
+D3794	.FILL #794
+D3795	.FILL #795
+D3796	.FILL #796
+D3797	.FILL #797
+D3798	.FILL #798
+D3799	.FILL #799
+D3800	.FILL #800
+D3801	.FILL #801
+D3802	.FILL #802
+D3803	.FILL #803
+D3804	.FILL #804
+D3805	.FILL #805
+D3806	.FILL #806
+D3807	.FILL #807
+D3808	.FILL #808
+D3809	.FILL #809
+D3810	.FILL #810
+D3811	.FILL #811
+D3812	.FILL #812
+D3813	.FILL #813
+D3814	.FILL #814
+D3815	.FILL #815
+D3816	.FILL #816
+D3817	.FILL #817
+D3818	.FILL #818
+D3819	.FILL #819
+D3820	.FILL #820
+D3821	.FILL #821
+D3822	.FILL #822
+D3823	.FILL #823
+D3824	.FILL #824
+D3825	.FILL #825
+D3826	.FILL #826
+D3827	.FILL #827
+D3828	.FILL #828
+D3829	.FILL #829
+D3830	.FILL #830
+D3831	.FILL #831
+D3832	.FILL #832
+D3833	.FILL #833
+D3834	.FILL #834
+D3835	.FILL #835
+D3836	.FILL #836
+D3837	.FILL #837
+D3838	.FILL #838
+D3839	.FILL #839
+D3840	.FILL #840
+D3841	.FILL #841
+D3842	.FILL #842
+D3843	.FILL #843
+D3844	.FILL #844
+D3845	.FILL #845
+D3846	.FILL #846
+D3847	.FILL #847
+D3848	.FILL #848
+D3849	.FILL #849
+D3850	.FILL #850
+D3851	.FILL #851
+D3852	.FILL #852
+D3853	.FILL #853
+D3854	.FILL #854
+D3855	.FILL #855
+D3856	.FILL #856
+D3857	.FILL #857
+D3858	.FILL #858
+D3859	.FILL #859
+D3860	.FILL #860
+D3861	.FILL #861
+D3862	.FILL #862
+D3863	.FILL #863
+D3864	.FILL #864
+D3865	.FILL #865
+D3866	.FILL #866
+D3867	.FILL #867
+D3868	.FILL #868
+D3869	.FILL #869
+D3870	.FILL #870
+D3871	.FILL #871
+D3872	.FILL #872
+D3873	.FILL #873
+D3874	.FILL #874
+D3875	.FILL #875
+D3876	.FILL #876
+D3877	.FILL #877
+D3878	.FILL #878
+D3879	.FILL #879
+D3880	.FILL #880
+D3881	.FILL #881
+D3882	.FILL #882
+D3883	.FILL #883
+D3884	.FILL #884
+D3885	.FILL #885
+D3886	.FILL #886
+D3887	.FILL #887
+D3888	.FILL #888
+D3889	.FILL #889
+D3890	.FILL #890
+D3891	.FILL #891
+D3892	.FILL #892
+D3893	.FILL #893
+D3894	.FILL #894
+D3895	.FILL #895
+D3896	.FILL #896
+D3897	.FILL #897
+D3898	.FILL #898
+D3899	.FILL #899
+D3900	.FILL #900
+D3901	.FILL #901
+D3902	.FILL #902
+D3903	.FILL #903
+D3904	.FILL #904
+D3905	.FILL #905
+D3906	.FILL #906
+D3907	.FILL #907
+D3908	.FILL #908
+D3909	.FILL #909
+D3910	.FILL #910
+D3911	.FILL #911
+D3912	.FILL #912
+D3913	.FILL #913
+D3914	.FILL #914
+D3915	.FILL #915
+D3916	.FILL #916
+D3917	.FILL #917
+D3918	.FILL #918
+D3919	.FILL #919
+D3920	.FILL #920
+D3921	.FILL #921
+D3922	.FILL #922
+D3923	.FILL #923
+D3924	.FILL #924
+D3925	.FILL #925
+D3926	.FILL #926
+D3927	.FILL #927
+D3928	.FILL #928
+D3929	.FILL #929
+D3930	.FILL #930
+D3931	.FILL #931
+D3932	.FILL #932
+D3933	.FILL #933
+D3934	.FILL #934
+D3935	.FILL #935
+D3936	.FILL #936
+D3937	.FILL #937
+D3938	.FILL #938
+D3939	.FILL #939
+D3940	.FILL #940
+D3941	.FILL #941
+D3942	.FILL #942
+D3943	.FILL #943
+D3944	.FILL #944
+D3945	.FILL #945
+D3946	.FILL #946
+D3947	.FILL #947
+D3948	.FILL #948
+D3949	.FILL #949
+D3950	.FILL #950
+D3951	.FILL #951
+D3952	.FILL #952
+D3953	.FILL #953
+D3954	.FILL #954
+D3955	.FILL #955
+D3956	.FILL #956
+D3957	.FILL #957
+D3958	.FILL #958
+D3959	.FILL #959
+D3960	.FILL #960
+D3961	.FILL #961
+D3962	.FILL #962
+D3963	.FILL #963
+D3964	.FILL #964
+D3965	.FILL #965
+D3966	.FILL #966
+D3967	.FILL #967
+D3968	.FILL #968
+D3969	.FILL #969
+D3970	.FILL #970
+D3971	.FILL #971
+D3972	.FILL #972
+D3973	.FILL #973
+D3974	.FILL #974
+D3975	.FILL #975
+D3976	.FILL #976
+D3977	.FILL #977
+D3978	.FILL #978
+D3979	.FILL #979
+D3980	.FILL #980
+D3981	.FILL #981
+D3982	.FILL #982
+D3983	.FILL #983
+D3984	.FILL #984
+D3985	.FILL #985
+D3986	.FILL #986
+D3987	.FILL #987
+D3988	.FILL #988
+D3989	.FILL #989
+D3990	.FILL #990
+D3991	.FILL #991
+D3992	.FILL #992
+D3993	.FILL #993
+D3994	.FILL #994
+D3995	.FILL #995
+D3996	.FILL #996
+D3997	.FILL #997
+D3998	.FILL #998
+D3999	.FILL #999
+D4000	.FILL #0
+D4001	.FILL #1
+D4002	.FILL #2
+D4003	.FILL #3
+D4004	.FILL #4
+D4005	.FILL #5
+D4006	.FILL #6
+D4007	.FILL #7
+D4008	.FILL #8
+D4009	.FILL #9
+D4010	.FILL #10
+D4011	.FILL #11
+D4012	.FILL #12
+D4013	.FILL #13
+D4014	.FILL #14
+D4015	.FILL #15
+D4016	.FILL #16
+D4017	.FILL #17
+D4018	.FILL #18
+D4019	.FILL #19
+D4020	.FILL #20
+D4021	.FILL #21
+D4022	.FILL #22
+D4023	.FILL #23
+D4024	.FILL #24
+D4025	.FILL #25
+D4026	.FILL #26
+D4027	.FILL #27
+D4028	.FILL #28
+D4029	.FILL #29
+D4030	.FILL #30
+D4031	.FILL #31
+D4032	.FILL #32
+D4033	.FILL #33
+D4034	.FILL #34
+D4035	.FILL #35
+D4036	.FILL #36
+D4037	.FILL #37
+D4038	.FILL #38
+D4039	.FILL #39
+D4040	.FILL #40
+D4041	.FILL #41
+D4042	.FILL #42
+D4043	.FILL #43
+D4044	.FILL #44
+D4045	.FILL #45
+D4046	.FILL #46
+D4047	.FILL #47
+D4048	.FILL #48
+D4049	.FILL #49
+D4050	.FILL #50
+D4051	.FILL #51
+D4052	.FILL #52
+D4053	.FILL #53
+D4054	.FILL #54
+D4055	.FILL #55
+D4056	.FILL #56
+D4057	.FILL #57
+D4058	.FILL #58
+D4059	.FILL #59
+D4060	.FILL #60
+D4061	.FILL #61
+D4062	.FILL #62
+D4063	.FILL #63
+D4064	.FILL #64
+D4065	.FILL #65
+D4066	.FILL #66
+D4067	.FILL #67
+D4068	.FILL #68
+D4069	.FILL #69
+D4070	.FILL #70
+D4071	.FILL #71
+D4072	.FILL #72
+D4073	.FILL #73
+D4074	.FILL #74
+D4075	.FILL #75
+D4076	.FILL #76
+D4077	.FILL #77
+D4078	.FILL #78
+D4079	.FILL #79
+D4080	.FILL #80
+D4081	.FILL #81
+D4082	.FILL #82
+D4083	.FILL #83
+D4084	.FILL #84
+D4085	.FILL #85
+D4086	.FILL #86
+D4087	.FILL #87
+D4088	.FILL #88
+D4089	.FILL #89
+D4090	.FILL #90
+D4091	.FILL #91
+D4092	.FILL #92
+D4093	.FILL #93
+D4094	.FILL #94
+D4095	.FILL #95
+D4096	.FILL #96
+D4097	.FILL #97
+D4098	.FILL #98
+D4099	.FILL #99
+D4100	.FILL #100
+D4101	.FILL #101
+D4102	.FILL #102
+D4103	.FILL #103
+D4104	.FILL #104
+D4105	.FILL #105
+D4106	.FILL #106
+D4107	.FILL #107
+D4108	.FILL #108
+D4109	.FILL #109
+D4110	.FILL #110
+D4111	.FILL #111
+D4112	.FILL #112
+D4113	.FILL #113
+D4114	.FILL #114
+D4115	.FILL #115
+D4116	.FILL #116
+D4117	.FILL #117
+D4118	.FILL #118
+D4119	.FILL #119
+D4120	.FILL #120
+D4121	.FILL #121
+D4122	.FILL #122
+D4123	.FILL #123
+D4124	.FILL #124
+D4125	.FILL #125
+D4126	.FILL #126
+D4127	.FILL #127
+D4128	.FILL #128
+D4129	.FILL #129
+D4130	.FILL #130
+D4131	.FILL #131
+D4132	.FILL #132
+D4133	.FILL #133
+D4134	.FILL #134
+D4135	.FILL #135
+D4136	.FILL #136
+D4137	.FILL #137
+D4138	.FILL #138
+D4139	.FILL #139
+D4140	.FILL #140
+D4141	.FILL #141
+D4142	.FILL #142
+D4143	.FILL #143
+D4144	.FILL #144
+D4145	.FILL #145
+D4146	.FILL #146
+D4147	.FILL #147
+D4148	.FILL #148
+D4149	.FILL #149
+D4150	.FILL #150
+D4151	.FILL #151
+D4152	.FILL #152
+D4153	.FILL #153
+D4154	.FILL #154
+D4155	.FILL #155
+D4156	.FILL #156
+D4157	.FILL #157
+D4158	.FILL #158
+D4159	.FILL #159
+D4160	.FILL #160
+D4161	.FILL #161
+D4162	.FILL #162
+D4163	.FILL #163
+D4164	.FILL #164
+D4165	.FILL #165
+D4166	.FILL #166
+D4167	.FILL #167
+D4168	.FILL #168
+D4169	.FILL #169
+D4170	.FILL #170
+D4171	.FILL #171
+D4172	.FILL #172
+D4173	.FILL #173
+D4174	.FILL #174
+D4175	.FILL #175
+D4176	.FILL #176
+D4177	.FILL #177
+D4178	.FILL #178
+D4179	.FILL #179
+D4180	.FILL #180
+D4181	.FILL #181
+D4182	.FILL #182
+D4183	.FILL #183
+D4184	.FILL #184
+D4185	.FILL #185
+D4186	.FILL #186
+D4187	.FILL #187
+D4188	.FILL #188
+D4189	.FILL #189
+D4190	.FILL #190
+D4191	.FILL #191
+D4192	.FILL #192
+D4193	.FILL #193
+D4194	.FILL #194
+D4195	.FILL #195
+D4196	.FILL #196
+D4197	.FILL #197
+D4198	.FILL #198
+D4199	.FILL #199
+D4200	.FILL #200
+D4201	.FILL #201
+D4202	.FILL #202
+D4203	.FILL #203
+D4204	.FILL #204
+D4205	.FILL #205
+D4206	.FILL #206
+D4207	.FILL #207
+D4208	.FILL #208
+D4209	.FILL #209
+D4210	.FILL #210
+D4211	.FILL #211
+D4212	.FILL #212
+D4213	.FILL #213
+D4214	.FILL #214
+D4215	.FILL #215
+D4216	.FILL #216
+D4217	.FILL #217
+D4218	.FILL #218
+D4219	.FILL #219
+D4220	.FILL #220
+D4221	.FILL #221
+D4222	.FILL #222
+D4223	.FILL #223
+D4224	.FILL #224
+D4225	.FILL #225
+D4226	.FILL #226
+D4227	.FILL #227
+D4228	.FILL #228
+D4229	.FILL #229
+D4230	.FILL #230
+D4231	.FILL #231
+D4232	.FILL #232
+D4233	.FILL #233
+D4234	.FILL #234
+D4235	.FILL #235
+D4236	.FILL #236
+D4237	.FILL #237
+D4238	.FILL #238
+D4239	.FILL #239
+D4240	.FILL #240
+D4241	.FILL #241
+D4242	.FILL #242
+D4243	.FILL #243
+D4244	.FILL #244
+D4245	.FILL #245
+D4246	.FILL #246
+D4247	.FILL #247
+D4248	.FILL #248
+D4249	.FILL #249
+D4250	.FILL #250
+D4251	.FILL #251
+D4252	.FILL #252
+D4253	.FILL #253
+D4254	.FILL #254
+D4255	.FILL #255
+D4256	.FILL #256
+D4257	.FILL #257
+D4258	.FILL #258
+D4259	.FILL #259
+D4260	.FILL #260
+D4261	.FILL #261
+D4262	.FILL #262
+D4263	.FILL #263
+D4264	.FILL #264
+D4265	.FILL #265
+D4266	.FILL #266
+D4267	.FILL #267
+D4268	.FILL #268
+D4269	.FILL #269
+D4270	.FILL #270
+D4271	.FILL #271
+D4272	.FILL #272
+D4273	.FILL #273
+D4274	.FILL #274
+D4275	.FILL #275
+D4276	.FILL #276
+D4277	.FILL #277
+D4278	.FILL #278
+D4279	.FILL #279
+D4280	.FILL #280
+D4281	.FILL #281
+D4282	.FILL #282
+D4283	.FILL #283
+D4284	.FILL #284
+D4285	.FILL #285
+D4286	.FILL #286
+D4287	.FILL #287
+D4288	.FILL #288
+D4289	.FILL #289
+D4290	.FILL #290
+D4291	.FILL #291
+D4292	.FILL #292
+D4293	.FILL #293
+D4294	.FILL #294
+D4295	.FILL #295
+D4296	.FILL #296
+D4297	.FILL #297
+D4298	.FILL #298
+D4299	.FILL #299
+D4300	.FILL #300
+D4301	.FILL #301
+D4302	.FILL #302
+D4303	.FILL #303
+D4304	.FILL #304
+D4305	.FILL #305
+D4306	.FILL #306
+D4307	.FILL #307
+D4308	.FILL #308
+D4309	.FILL #309
+D4310	.FILL #310
+D4311	.FILL #311
+D4312	.FILL #312
+D4313	.FILL #313
+D4314	.FILL #314
+D4315	.FILL #315
+D4316	.FILL #316
+D4317	.FILL #317
+D4318	.FILL #318
+D4319	.FILL #319
+D4320	.FILL #320
+D4321	.FILL #321
+D4322	.FILL #322
+D4323	.FILL #323
+D4324	.FILL #324
+D4325	.FILL #325
+D4326	.FILL #326
+D4327	.FILL #327
+D4328	.FILL #328
+D4329	.FILL #329
+D4330	.FILL #330
+D4331	.FILL #331
+D4332	.FILL #332
+D4333	.FILL #333
+D4334	.FILL #334
+D4335	.FILL #335
+D4336	.FILL #336
+D4337	.FILL #337
+D4338	.FILL #338
+D4339	.FILL #339
+D4340	.FILL #340
+D4341	.FILL #341
+D4342	.FILL #342
+D4343	.FILL #343
+D4344	.FILL #344
+D4345	.FILL #345
+D4346	.FILL #346
+D4347	.FILL #347
+D4348	.FILL #348
+D4349	.FILL #349
+D4350	.FILL #350
+D4351	.FILL #351
+D4352	.FILL #352
+D4353	.FILL #353
+D4354	.FILL #354
+D4355	.FILL #355
+D4356	.FILL #356
+D4357	.FILL #357
+D4358	.FILL #358
+D4359	.FILL #359
+D4360	.FILL #360
+D4361	.FILL #361
+D4362	.FILL #362
+D4363	.FILL #363
+D4364	.FILL #364
+D4365	.FILL #365
+D4366	.FILL #366
+D4367	.FILL #367
+D4368	.FILL #368
+D4369	.FILL #369
+D4370	.FILL #370
+D4371	.FILL #371
+D4372	.FILL #372
+D4373	.FILL #373
+D4374	.FILL #374
+D4375	.FILL #375
+D4376	.FILL #376
+D4377	.FILL #377
+D4378	.FILL #378
+D4379	.FILL #379
+D4380	.FILL #380
+D4381	.FILL #381
+D4382	.FILL #382
+D4383	.FILL #383
+D4384	.FILL #384
+D4385	.FILL #385
+D4386	.FILL #386
+D4387	.FILL #387
+D4388	.FILL #388
+D4389	.FILL #389
+D4390	.FILL #390
+D4391	.FILL #391
+D4392	.FILL #392
+D4393	.FILL #393
+D4394	.FILL #394
+D4395	.FILL #395
+D4396	.FILL #396
+D4397	.FILL #397
+D4398	.FILL #398
+D4399	.FILL #399
+D4400	.FILL #400
+D4401	.FILL #401
+D4402	.FILL #402
+D4403	.FILL #403
+D4404	.FILL #404
+D4405	.FILL #405
+D4406	.FILL #406
+D4407	.FILL #407
+D4408	.FILL #408
+D4409	.FILL #409
+D4410	.FILL #410
+D4411	.FILL #411
+D4412	.FILL #412
+D4413	.FILL #413
+D4414	.FILL #414
+D4415	.FILL #415
+D4416	.FILL #416
+D4417	.FILL #417
+D4418	.FILL #418
+D4419	.FILL #419
+D4420	.FILL #420
+D4421	.FILL #421
+D4422	.FILL #422
+D4423	.FILL #423
+D4424	.FILL #424
+D4425	.FILL #425
+D4426	.FILL #426
+D4427	.FILL #427
+D4428	.FILL #428
+D4429	.FILL #429
+D4430	.FILL #430
+D4431	.FILL #431
+D4432	.FILL #432
+D4433	.FILL #433
+D4434	.FILL #434
+D4435	.FILL #435
+D4436	.FILL #436
+D4437	.FILL #437
+D4438	.FILL #438
+D4439	.FILL #439
+D4440	.FILL #440
+D4441	.FILL #441
+D4442	.FILL #442
+D4443	.FILL #443
+D4444	.FILL #444
+D4445	.FILL #445
+D4446	.FILL #446
+D4447	.FILL #447
+D4448	.FILL #448
+D4449	.FILL #449
+D4450	.FILL #450
+D4451	.FILL #451
+D4452	.FILL #452
+D4453	.FILL #453
+D4454	.FILL #454
+D4455	.FILL #455
+D4456	.FILL #456
+D4457	.FILL #457
+D4458	.FILL #458
+D4459	.FILL #459
+D4460	.FILL #460
+D4461	.FILL #461
+D4462	.FILL #462
+D4463	.FILL #463
+D4464	.FILL #464
+D4465	.FILL #465
+D4466	.FILL #466
+D4467	.FILL #467
+D4468	.FILL #468
+D4469	.FILL #469
+D4470	.FILL #470
+D4471	.FILL #471
+D4472	.FILL #472
+D4473	.FILL #473
+D4474	.FILL #474
+D4475	.FILL #475
+D4476	.FILL #476
+D4477	.FILL #477
+D4478	.FILL #478
+D4479	.FILL #479
+D4480	.FILL #480
+D4481	.FILL #481
+D4482	.FILL #482
+D4483	.FILL #483
+D4484	.FILL #484
+D4485	.FILL #485
+D4486	.FILL #486
+D4487	.FILL #487
+D4488	.FILL #488
+D4489	.FILL #489
+D4490	.FILL #490
+D4491	.FILL #491
+D4492	.FILL #492
+D4493	.FILL #493
+D4494	.FILL #494
+D4495	.FILL #495
+D4496	.FILL #496
+D4497	.FILL #497
+D4498	.FILL #498
+D4499	.FILL #499
+D4500	.FILL #500
+D4501	.FILL #501
+D4502	.FILL #502
+D4503	.FILL #503
+D4504	.FILL #504
+D4505	.FILL #505
+D4506	.FILL #506
+D4507	.FILL #507
+D4508	.FILL #508
+D4509	.FILL #509
+D4510	.FILL #510
+D4511	.FILL #511
+D4512	.FILL #512
+D4513	.FILL #513
+D4514	.FILL #514
+D4515	.FILL #515
+D4516	.FILL #516
+D4517	.FILL #517
+D4518	.FILL #518
+D4519	.FILL #519
+D4520	.FILL #520
+D4521	.FILL #521
+D4522	.FILL #522
+D4523	.FILL #523
+D4524	.FILL #524
+D4525	.FILL #525
+D4526	.FILL #526
+D4527	.FILL #527
+D4528	.FILL #528
+D4529	.FILL #529
+D4530	.FILL #530
+D4531	.FILL #531
+D4532	.FILL #532
+D4533	.FILL #533
+D4534	.FILL #534
+D4535	.FILL #535
+D4536	.FILL #536
+D4537	.FILL #537
+D4538	.FILL #538
+D4539	.FILL #539
+D4540	.FILL #540
+D4541	.FILL #541
+D4542	.FILL #542
+D4543	.FILL #543
+D4544	.FILL #544
+D4545	.FILL #545
+D4546	.FILL #546
+D4547	.FILL #547
+D4548	.FILL #548
+D4549	.FILL #549
+D4550	.FILL #550
+D4551	.FILL #551
+D4552	.FILL #552
+D4553	.FILL #553
+D4554	.FILL #554
+D4555	.FILL #555
+D4556	.FILL #556
+D4557	.FILL #557
+D4558	.FILL #558
+D4559	.FILL #559
+D4560	.FILL #560
+D4561	.FILL #561
+D4562	.FILL #562
+D4563	.FILL #563
+D4564	.FILL #564
+D4565	.FILL #565
+D4566	.FILL #566
+D4567	.FILL #567
+D4568	.FILL #568
+D4569	.FILL #569
+D4570	.FILL #570
+D4571	.FILL #571
+D4572	.FILL #572
+D4573	.FILL #573
+D4574	.FILL #574
+D4575	.FILL #575
+D4576	.FILL #576
+D4577	.FILL #577
+D4578	.FILL #578
+D4579	.FILL #579
+D4580	.FILL #580
+D4581	.FILL #581
+D4582	.FILL #582
+D4583	.FILL #583
+D4584	.FILL #584
+D4585	.FILL #585
+D4586	.FILL #586
+D4587	.FILL #587
+D4588	.FILL #588
+D4589	.FILL #589
+D4590	.FILL #590
+D4591	.FILL #591
+D4592	.FILL #592
+D4593	.FILL #593
+D4594	.FILL #594
+D4595	.FILL #595
+D4596	.FILL #596
+D4597	.FILL #597
+D4598	.FILL #598
+D4599	.FILL #599
+D4600	.FILL #600
+D4601	.FILL #601
+D4602	.FILL #602
+D4603	.FILL #603
+D4604	.FILL #604
+D4605	.FILL #605
+D4606	.FILL #606
+D4607	.FILL #607
+D4608	.FILL #608
+D4609	.FILL #609
+D4610	.FILL #610
+D4611	.FILL #611
+D4612	.FILL #612
+D4613	.FILL #613
+D4614	.FILL #614
+D4615	.FILL #615
+D4616	.FILL #616
+D4617	.FILL #617
+D4618	.FILL #618
+D4619	.FILL #619
+D4620	.FILL #620
+D4621	.FILL #621
+D4622	.FILL #622
+D4623	.FILL #623
+D4624	.FILL #624
+D4625	.FILL #625
+D4626	.FILL #626
+D4627	.FILL #627
+D4628	.FILL #628
+D4629	.FILL #629
+D4630	.FILL #630
+D4631	.FILL #631
+D4632	.FILL #632
+D4633	.FILL #633
+D4634	.FILL #634
+D4635	.FILL #635
+D4636	.FILL #636
+D4637	.FILL #637
+D4638	.FILL #638
+D4639	.FILL #639
+D4640	.FILL #640
+D4641	.FILL #641
+D4642	.FILL #642
+D4643	.FILL #643
+D4644	.FILL #644
+D4645	.FILL #645
+D4646	.FILL #646
+D4647	.FILL #647
+D4648	.FILL #648
+D4649	.FILL #649
+D4650	.FILL #650
+D4651	.FILL #651
+D4652	.FILL #652
+D4653	.FILL #653
+D4654	.FILL #654
+D4655	.FILL #655
+D4656	.FILL #656
+D4657	.FILL #657
+D4658	.FILL #658
+D4659	.FILL #659
+D4660	.FILL #660
+D4661	.FILL #661
+D4662	.FILL #662
+D4663	.FILL #663
+D4664	.FILL #664
+D4665	.FILL #665
+D4666	.FILL #666
+D4667	.FILL #667
+D4668	.FILL #668
+D4669	.FILL #669
+D4670	.FILL #670
+D4671	.FILL #671
+D4672	.FILL #672
+D4673	.FILL #673
+D4674	.FILL #674
+D4675	.FILL #675
+D4676	.FILL #676
+D4677	.FILL #677
+D4678	.FILL #678
+D4679	.FILL #679
+D4680	.FILL #680
+D4681	.FILL #681
+D4682	.FILL #682
+D4683	.FILL #683
+D4684	.FILL #684
+D4685	.FILL #685
+D4686	.FILL #686
+D4687	.FILL #687
+D4688	.FILL #688
+D4689	.FILL #689
+D4690	.FILL #690
+D4691	.FILL #691
+D4692	.FILL #692
+D4693	.FILL #693
+D4694	.FILL #694
+D4695	.FILL #695
+D4696	.FILL #696
+D4697	.FILL #697
+D4698	.FILL #698
+D4699	.FILL #699
+D4700	.FILL #700
+D4701	.FILL #701
+D4702	.FILL #702
+D4703	.FILL #703
+D4704	.FILL #704
+D4705	.FILL #705
+D4706	.FILL #706
+D4707	.FILL #707
+D4708	.FILL #708
+D4709	.FILL #709
+D4710	.FILL #710
+D4711	.FILL #711
+D4712	.FILL #712
+D4713	.FILL #713
+D4714	.FILL #714
+D4715	.FILL #715
+D4716	.FILL #716
+D4717	.FILL #717
+D4718	.FILL #718
+D4719	.FILL #719
+D4720	.FILL #720
+D4721	.FILL #721
+D4722	.FILL #722
+D4723	.FILL #723
+D4724	.FILL #724
+D4725	.FILL #725
+D4726	.FILL #726
+D4727	.FILL #727
+D4728	.FILL #728
+D4729	.FILL #729
+D4730	.FILL #730
+D4731	.FILL #731
+D4732	.FILL #732
+D4733	.FILL #733
+D4734	.FILL #734
+D4735	.FILL #735
+D4736	.FILL #736
+D4737	.FILL #737
+D4738	.FILL #738
+D4739	.FILL #739
+D4740	.FILL #740
+D4741	.FILL #741
+D4742	.FILL #742
+D4743	.FILL #743
+D4744	.FILL #744
+D4745	.FILL #745
+D4746	.FILL #746
+D4747	.FILL #747
+D4748	.FILL #748
+D4749	.FILL #749
+D4750	.FILL #750
+D4751	.FILL #751
+D4752	.FILL #752
+D4753	.FILL #753
+D4754	.FILL #754
+D4755	.FILL #755
+D4756	.FILL #756
+D4757	.FILL #757
+D4758	.FILL #758
+D4759	.FILL #759
+D4760	.FILL #760
+D4761	.FILL #761
+D4762	.FILL #762
+D4763	.FILL #763
+D4764	.FILL #764
+D4765	.FILL #765
+D4766	.FILL #766
+D4767	.FILL #767
+D4768	.FILL #768
+D4769	.FILL #769
+D4770	.FILL #770
+D4771	.FILL #771
+D4772	.FILL #772
+D4773	.FILL #773
+D4774	.FILL #774
+D4775	.FILL #775
+D4776	.FILL #776
+D4777	.FILL #777
+D4778	.FILL #778
+D4779	.FILL #779
+D4780	.FILL #780
+D4781	.FILL #781
+D4782	.FILL #782
+D4783	.FILL #783
+D4784	.FILL #784
+D4785	.FILL #785
+D4786	.FILL #786
+D4787	.FILL #787
+D4788	.FILL #788
+D4789	.FILL #789
+D4790	.FILL #790
+D4791	.FILL #791
+D4792	.FILL #792
+D4793	.FILL #793
+D4794	.FILL #794
+D4795	.FILL #795
+D4796	.FILL #796
+D4797	.FILL #797
+D4798	.FILL #798
+D4799	.FILL #799
+D4800	.FILL #800
+D4801	.FILL #801
+D4802	.FILL #802
+D4803	.FILL #803
+D4804	.FILL #804
+D4805	.FILL #805
+D4806	.FILL #806
+D4807	.FILL #807
+D4808	.FILL #808
+D4809	.FILL #809
+D4810	.FILL #810
+D4811	.FILL #811
+D4812	.FILL #812
+D4813	.FILL #813
+D4814	.FILL #814
+D4815	.FILL #815
+D4816	.FILL #816
+D4817	.FILL #817
+D4818	.FILL #818
+D4819	.FILL #819
+D4820	.FILL #820
+D4821	.FILL #821
+D4822	.FILL #822
+D4823	.FILL #823
+D4824	.FILL #824
+D4825	.FILL #825
+D4826	.FILL #826
+D4827	.FILL #827
+D4828	.FILL #828
+D4829	.FILL #829
+D4830	.FILL #830
+D4831	.FILL #831
+D4832	.FILL #832
+D4833	.FILL #833
+D4834	.FILL #834
+D4835	.FILL #835
+D4836	.FILL #836
+D4837	.FILL #837
+D4838	.FILL #838
+D4839	.FILL #839
+D4840	.FILL #840
+D4841	.FILL #841
+D4842	.FILL #842
+D4843	.FILL #843
+D4844	.FILL #844
+D4845	.FILL #845
+D4846	.FILL #846
+D4847	.FILL #847
+D4848	.FILL #848
+D4849	.FILL #849
+D4850	.FILL #850
+D4851	.FILL #851
+D4852	.FILL #852
+D4853	.FILL #853
+D4854	.FILL #854
+D4855	.FILL #855
+D4856	.FILL #856
+D4857	.FILL #857
+D4858	.FILL #858
+D4859	.FILL #859
+D4860	.FILL #860
+D4861	.FILL #861
+D4862	.FILL #862
+D4863	.FILL #863
+D4864	.FILL #864
+D4865	.FILL #865
+D4866	.FILL #866
+D4867	.FILL #867
+D4868	.FILL #868
+D4869	.FILL #869
+D4870	.FILL #870
+D4871	.FILL #871
+D4872	.FILL #872
+D4873	.FILL #873
+D4874	.FILL #874
+D4875	.FILL #875
+D4876	.FILL #876
+D4877	.FILL #877
+D4878	.FILL #878
+D4879	.FILL #879
+D4880	.FILL #880
+D4881	.FILL #881
+D4882	.FILL #882
+D4883	.FILL #883
+D4884	.FILL #884
+D4885	.FILL #885
+D4886	.FILL #886
+D4887	.FILL #887
+D4888	.FILL #888
+D4889	.FILL #889
+D4890	.FILL #890
+D4891	.FILL #891
+D4892	.FILL #892
+D4893	.FILL #893
+D4894	.FILL #894
+D4895	.FILL #895
+D4896	.FILL #896
+D4897	.FILL #897
+D4898	.FILL #898
+D4899	.FILL #899
+D4900	.FILL #900
+D4901	.FILL #901
+D4902	.FILL #902
+D4903	.FILL #903
+D4904	.FILL #904
+D4905	.FILL #905
+D4906	.FILL #906
+D4907	.FILL #907
+D4908	.FILL #908
+D4909	.FILL #909
+D4910	.FILL #910
+D4911	.FILL #911
+D4912	.FILL #912
+D4913	.FILL #913
+D4914	.FILL #914
+D4915	.FILL #915
+D4916	.FILL #916
+D4917	.FILL #917
+D4918	.FILL #918
+D4919	.FILL #919
+D4920	.FILL #920
+D4921	.FILL #921
+D4922	.FILL #922
+D4923	.FILL #923
+D4924	.FILL #924
+D4925	.FILL #925
+D4926	.FILL #926
+D4927	.FILL #927
+D4928	.FILL #928
+D4929	.FILL #929
+D4930	.FILL #930
+D4931	.FILL #931
+D4932	.FILL #932
+D4933	.FILL #933
+D4934	.FILL #934
+D4935	.FILL #935
+D4936	.FILL #936
+D4937	.FILL #937
+D4938	.FILL #938
+D4939	.FILL #939
+D4940	.FILL #940
+D4941	.FILL #941
+D4942	.FILL #942
+D4943	.FILL #943
+D4944	.FILL #944
+D4945	.FILL #945
+D4946	.FILL #946
+D4947	.FILL #947
+D4948	.FILL #948
+D4949	.FILL #949
+D4950	.FILL #950
+D4951	.FILL #951
+D4952	.FILL #952
+D4953	.FILL #953
+D4954	.FILL #954
+D4955	.FILL #955
+D4956	.FILL #956
+D4957	.FILL #957
+D4958	.FILL #958
+D4959	.FILL #959
+D4960	.FILL #960
+D4961	.FILL #961
+D4962	.FILL #962
+D4963	.FILL #963
+D4964	.FILL #964
+D4965	.FILL #965
+D4966	.FILL #966
+D4967	.FILL #967
+D4968	.FILL #968
+D4969	.FILL #969
+D4970	.FILL #970
+D4971	.FILL #971
+D4972	.FILL #972
+D4973	.FILL #973
+D4974	.FILL #974
+D4975	.FILL #975
+D4976	.FILL #976
+D4977	.FILL #977
+D4978	.FILL #978
+D4979	.FILL #979
+D4980	.FILL #980
+D4981	.FILL #981
+D4982	.FILL #982
+D4983	.FILL #983
+D4984	.FILL #984
+D4985	.FILL #985
+D4986	.FILL #986
+D4987	.FILL #987
+D4988	.FILL #988
+D4989	.FILL #989
+D4990	.FILL #990
+D4991	.FILL #991
+D4992	.FILL #992
+D4993	.FILL #993
+D4994	.FILL #994
+D4995	.FILL #995
+D4996	.FILL #996
+D4997	.FILL #997
+D4998	.FILL #998
+D4999	.FILL #999
+D5000	.FILL #0
+D5001	.FILL #1
+D5002	.FILL #2
+D5003	.FILL #3
+D5004	.FILL #4
+D5005	.FILL #5
+D5006	.FILL #6
+D5007	.FILL #7
+D5008	.FILL #8
+D5009	.FILL #9
+D5010	.FILL #10
+D5011	.FILL #11
+D5012	.FILL #12
+D5013	.FILL #13
+D5014	.FILL #14
+D5015	.FILL #15
+D5016	.FILL #16
+D5017	.FILL #17
+D5018	.FILL #18
+D5019	.FILL #19
+D5020	.FILL #20
+D5021	.FILL #21
+D5022	.FILL #22
+D5023	.FILL #23
+D5024	.FILL #24
+D5025	.FILL #25
+D5026	.FILL #26
+D5027	.FILL #27
+D5028	.FILL #28
+D5029	.FILL #29
+D5030	.FILL #30
+D5031	.FILL #31
+D5032	.FILL #32
+D5033	.FILL #33
+D5034	.FILL #34
+D5035	.FILL #35
+D5036	.FILL #36
+D5037	.FILL #37
+D5038	.FILL #38
+D5039	.FILL #39
+D5040	.FILL #40
+D5041	.FILL #41
+D5042	.FILL #42
+D5043	.FILL #43
+D5044	.FILL #44
+D5045	.FILL #45
+D5046	.FILL #46
+D5047	.FILL #47
+D5048	.FILL #48
+D5049	.FILL #49
+D5050	.FILL #50
+D5051	.FILL #51
+D5052	.FILL #52
+D5053	.FILL #53
+D5054	.FILL #54
+D5055	.FILL #55
+D5056	.FILL #56
+D5057	.FILL #57
+D5058	.FILL #58
+D5059	.FILL #59
+D5060	.FILL #60
+D5061	.FILL #61
+D5062	.FILL #62
+D5063	.FILL #63
+D5064	.FILL #64
+D5065	.FILL #65
+D5066	.FILL #66
+D5067	.FILL #67
+D5068	.FILL #68
+D5069	.FILL #69
+D5070	.FILL #70
+D5071	.FILL #71
+D5072	.FILL #72
+D5073	.FILL #73
+D5074	.FILL #74
+D5075	.FILL #75
+D5076	.FILL #76
+D5077	.FILL #77
+D5078	.FILL #78
+D5079	.FILL #79
+D5080	.FILL #80
+D5081	.FILL #81
+D5082	.FILL #82
+D5083	.FILL #83
+D5084	.FILL #84
+D5085	.FILL #85
+D5086	.FILL #86
+D5087	.FILL #87
+D5088	.FILL #88
+D5089	.FILL #89
+D5090	.FILL #90
+D5091	.FILL #91
+D5092	.FILL #92
+D5093	.FILL #93
+D5094	.FILL #94
+D5095	.FILL #95
+D5096	.FILL #96
+D5097	.FILL #97
+D5098	.FILL #98
+D5099	.FILL #99
+D5100	.FILL #100
+D5101	.FILL #101
+D5102	.FILL #102
+D5103	.FILL #103
+D5104	.FILL #104
+D5105	.FILL #105
+D5106	.FILL #106
+D5107	.FILL #107
+D5108	.FILL #108
+D5109	.FILL #109
+D5110	.FILL #110
+D5111	.FILL #111
+D5112	.FILL #112
+D5113	.FILL #113
+D5114	.FILL #114
+D5115	.FILL #115
+D5116	.FILL #116
+D5117	.FILL #117
+D5118	.FILL #118
+D5119	.FILL #119
+D5120	.FILL #120
+D5121	.FILL #121
+D5122	.FILL #122
+D5123	.FILL #123
+D5124	.FILL #124
+D5125	.FILL #125
+D5126	.FILL #126
+D5127	.FILL #127
+D5128	.FILL #128
+D5129	.FILL #129
+D5130	.FILL #130
+D5131	.FILL #131
+D5132	.FILL #132
+D5133	.FILL #133
+D5134	.FILL #134
+D5135	.FILL #135
+D5136	.FILL #136
+D5137	.FILL #137
+D5138	.FILL #138
+D5139	.FILL #139
+D5140	.FILL #140
+D5141	.FILL #141
+D5142	.FILL #142
+D5143	.FILL #143
+D5144	.FILL #144
+D5145	.FILL #145
+D5146	.FILL #146
+D5147	.FILL #147
+D5148	.FILL #148
+D5149	.FILL #149
+D5150	.FILL #150
+D5151	.FILL #151
+D5152	.FILL #152
+D5153	.FILL #153
+D5154	.FILL #154
+D5155	.FILL #155
+D5156	.FILL #156
+D5157	.FILL #157
+D5158	.FILL #158
+D5159	.FILL #159
+D5160	.FILL #160
+D5161	.FILL #161
+D5162	.FILL #162
+D5163	.FILL #163
+D5164	.FILL #164
+D5165	.FILL #165
+D5166	.FILL #166
+D5167	.FILL #167
+D5168	.FILL #168
+D5169	.FILL #169
+D5170	.FILL #170
+D5171	.FILL #171
+D5172	.FILL #172
+D5173	.FILL #173
+D5174	.FILL #174
+D5175	.FILL #175
+D5176	.FILL #176
+D5177	.FILL #177
+D5178	.FILL #178
+D5179	.FILL #179
+D5180	.FILL #180
+D5181	.FILL #181
+D5182	.FILL #182
+D5183	.FILL #183
+D5184	.FILL #184
+D5185	.FILL #185
+D5186	.FILL #186
+D5187	.FILL #187
+D5188	.FILL #188
+D5189	.FILL #189
+D5190	.FILL #190
+D5191	.FILL #191
+D5192	.FILL #192
+D5193	.FILL #193
+D5194	.FILL #194
+D5195	.FILL #195
+D5196	.FILL #196
+D5197	.FILL #197
+D5198	.FILL #198
+D5199	.FILL #199
+D5200	.FILL #200
+D5201	.FILL #201
+D5202	.FILL #202
+D5203	.FILL #203
+D5204	.FILL #204
+D5205	.FILL #205
+D5206	.FILL #206
+D5207	.FILL #207
+D5208	.FILL #208
+D5209	.FILL #209
+D5210	.FILL #210
+D5211	.FILL #211
+D5212	.FILL #212
+D5213	.FILL #213
+D5214	.FILL #214
+D5215	.FILL #215
+D5216	.FILL #216
+D5217	.FILL #217
+D5218	.FILL #218
+D5219	.FILL #219
+D5220	.FILL #220
+D5221	.FILL #221
+D5222	.FILL #222
+D5223	.FILL #223
+D5224	.FILL #224
+D5225	.FILL #225
+D5226	.FILL #226
+D5227	.FILL #227
+D5228	.FILL #228
+D5229	.FILL #229
+D5230	.FILL #230
+D5231	.FILL #231
+D5232	.FILL #232
+D5233	.FILL #233
+D5234	.FILL #234
+D5235	.FILL #235
+D5236	.FILL #236
+D5237	.FILL #237
+D5238	.FILL #238
+D5239	.FILL #239
+D5240	.FILL #240
+D5241	.FILL #241
+D5242	.FILL #242
+D5243	.FILL #243
+D5244	.FILL #244
+D5245	.FILL #245
+D5246	.FILL #246
+D5247	.FILL #247
+D5248	.FILL #248
+D5249	.FILL #249
+D5250	.FILL #250
+D5251	.FILL #251
+D5252	.FILL #252
+D5253	.FILL #253
+D5254	.FILL #254
+D5255	.FILL #255
+D5256	.FILL #256
+D5257	.FILL #257
+D5258	.FILL #258
+D5259	.FILL #259
+D5260	.FILL #260
+D5261	.FILL #261
+D5262	.FILL #262
+D5263	.FILL #263
+D5264	.FILL #264
+D5265	.FILL #265
+D5266	.FILL #266
+D5267	.FILL #267
+D5268	.FILL #268
+D5269	.FILL #269
+D5270	.FILL #270
+D5271	.FILL #271
+D5272	.FILL #272
+D5273	.FILL #273
+D5274	.FILL #274
+D5275	.FILL #275
+D5276	.FILL #276
+D5277	.FILL #277
+D5278	.FILL #278
+D5279	.FILL #279
+D5280	.FILL #280
+D5281	.FILL #281
+D5282	.FILL #282
+D5283	.FILL #283
+D5284	.FILL #284
+D5285	.FILL #285
+D5286	.FILL #286
+D5287	.FILL #287
+D5288	.FILL #288
+D5289	.FILL #289
+D5290	.FILL #290
+D5291	.FILL #291
+D5292	.FILL #292
+D5293	.FILL #293
+D5294	.FILL #294
+D5295	.FILL #295
+D5296	.FILL #296
+D5297	.FILL #297
+D5298	.FILL #298
+D5299	.FILL #299
+D5300	.FILL #300
+D5301	.FILL #301
+D5302	.FILL #302
+D5303	.FILL #303
+D5304	.FILL #304
+D5305	.FILL #305
+D5306	.FILL #306
+D5307	.FILL #307
+D5308	.FILL #308
+D5309	.FILL #309
+D5310	.FILL #310
+D5311	.FILL #311
+D5312	.FILL #312
+D5313	.FILL #313
+D5314	.FILL #314
+D5315	.FILL #315
+D5316	.FILL #316
+D5317	.FILL #317
+D5318	.FILL #318
+D5319	.FILL #319
+D5320	.FILL #320
+D5321	.FILL #321
+D5322	.FILL #322
+D5323	.FILL #323
+D5324	.FILL #324
+D5325	.FILL #325
+D5326	.FILL #326
+D5327	.FILL #327
+D5328	.FILL #328
+D5329	.FILL #329
+D5330	.FILL #330
+D5331	.FILL #331
+D5332	.FILL #332
+D5333	.FILL #333
+D5334	.FILL #334
+D5335	.FILL #335
+D5336	.FILL #336
+D5337	.FILL #337
+D5338	.FILL #338
+D5339	.FILL #339
+D5340	.FILL #340
+D5341	.FILL #341
+D5342	.FILL #342
+D5343	.FILL #343
+D5344	.FILL #344
+D5345	.FILL #345
+D5346	.FILL #346
+D5347	.FILL #347
+D5348	.FILL #348
+D5349	.FILL #349
+D5350	.FILL #350
+D5351	.FILL #351
+D5352	.FILL #352
+D5353	.FILL #353
+D5354	.FILL #354
+D5355	.FILL #355
+D5356	.FILL #356
+D5357	.FILL #357
+D5358	.FILL #358
+D5359	.FILL #359
+D5360	.FILL #360
+D5361	.FILL #361
+D5362	.FILL #362
+D5363	.FILL #363
+D5364	.FILL #364
+D5365	.FILL #365
+D5366	.FILL #366
+D5367	.FILL #367
+D5368	.FILL #368
+D5369	.FILL #369
+D5370	.FILL #370
+D5371	.FILL #371
+D5372	.FILL #372
+D5373	.FILL #373
+D5374	.FILL #374
+D5375	.FILL #375
+D5376	.FILL #376
+D5377	.FILL #377
+D5378	.FILL #378
+D5379	.FILL #379
+D5380	.FILL #380
+D5381	.FILL #381
+D5382	.FILL #382
+D5383	.FILL #383
+D5384	.FILL #384
+D5385	.FILL #385
+D5386	.FILL #386
+D5387	.FILL #387
+D5388	.FILL #388
+D5389	.FILL #389
+D5390	.FILL #390
+D5391	.FILL #391
+D5392	.FILL #392
+D5393	.FILL #393
+D5394	.FILL #394
+D5395	.FILL #395
+D5396	.FILL #396
+D5397	.FILL #397
+D5398	.FILL #398
+D5399	.FILL #399
+D5400	.FILL #400
+D5401	.FILL #401
+D5402	.FILL #402
+D5403	.FILL #403
+D5404	.FILL #404
+D5405	.FILL #405
+D5406	.FILL #406
+D5407	.FILL #407
+D5408	.FILL #408
+D5409	.FILL #409
+D5410	.FILL #410
+D5411	.FILL #411
+D5412	.FILL #412
+D5413	.FILL #413
+D5414	.FILL #414
+D5415	.FILL #415
+D5416	.FILL #416
+D5417	.FILL #417
+D5418	.FILL #418
+D5419	.FILL #419
+D5420	.FILL #420
+D5421	.FILL #421
+D5422	.FILL #422
+D5423	.FILL #423
+D5424	.FILL #424
+D5425	.FILL #425
+D5426	.FILL #426
+D5427	.FILL #427
+D5428	.FILL #428
+D5429	.FILL #429
+D5430	.FILL #430
+D5431	.FILL #431
+D5432	.FILL #432
+D5433	.FILL #433
+D5434	.FILL #434
+D5435	.FILL #435
+D5436	.FILL #436
+D5437	.FILL #437
+D5438	.FILL #438
+D5439	.FILL #439
+D5440	.FILL #440
+D5441	.FILL #441
+D5442	.FILL #442
+D5443	.FILL #443
+D5444	.FILL #444
+D5445	.FILL #445
+D5446	.FILL #446
+D5447	.FILL #447
+D5448	.FILL #448
+D5449	.FILL #449
+D5450	.FILL #450
+D5451	.FILL #451
+D5452	.FILL #452
+D5453	.FILL #453
+D5454	.FILL #454
+D5455	.FILL #455
+D5456	.FILL #456
+D5457	.FILL #457
+D5458	.FILL #458
+D5459	.FILL #459
+D5460	.FILL #460
+D5461	.FILL #461
+D5462	.FILL #462
+D5463	.FILL #463
+D5464	.FILL #464
+D5465	.FILL #465
+D5466	.FILL #466
+D5467	.FILL #467
+D5468	.FILL #468
+D5469	.FILL #469
+D5470	.FILL #470
+D5471	.FILL #471
+D5472	.FILL #472
+D5473	.FILL #473
+D5474	.FILL #474
+D5475	.FILL #475
+D5476	.FILL #476
+D5477	.FILL #477
+D5478	.FILL #478
+D5479	.FILL #479
+D5480	.FILL #480
+D5481	.FILL #481
+D5482	.FILL #482
+D5483	.FILL #483
+D5484	.FILL #484
+D5485	.FILL #485
+D5486	.FILL #486
+D5487	.FILL #487
+D5488	.FILL #488
+D5489	.FILL #489
+D5490	.FILL #490
+D5491	.FILL #491
+D5492	.FILL #492
+D5493	.FILL #493
+D5494	.FILL #494
+D5495	.FILL #495
+D5496	.FILL #496
+D5497	.FILL #497
+D5498	.FILL #498
+D5499	.FILL #499
+D5500	.FILL #500
+D5501	.FILL #501
+D5502	.FILL #502
+D5503	.FILL #503
+D5504	.FILL #504
+D5505	.FILL #505
+D5506	.FILL #506
+D5507	.FILL #507
+D5508	.FILL #508
+D5509	.FILL #509
+D5510	.FILL #510
+D5511	.FILL #511
+D5512	.FILL #512
+D5513	.FILL #513
+D5514	.FILL #514
+D5515	.FILL #515
+D5516	.FILL #516
+D5517	.FILL #517
+D5518	.FILL #518
+D5519	.FILL #519
+D5520	.FILL #520
+D5521	.FILL #521
+D5522	.FILL #522
+D5523	.FILL #523
+D5524	.FILL #524
+D5525	.FILL #525
+D5526	.FILL #526
+D5527	.FILL #527
+D5528	.FILL #528
+D5529	.FILL #529
+D5530	.FILL #530
+D5531	.FILL #531
+D5532	.FILL #532
+D5533	.FILL #533
+D5534	.FILL #534
+D5535	.FILL #535
+D5536	.FILL #536
+D5537	.FILL #537
+D5538	.FILL #538
+D5539	.FILL #539
+D5540	.FILL #540
+D5541	.FILL #541
+D5542	.FILL #542
+D5543	.FILL #543
+D5544	.FILL #544
+D5545	.FILL #545
+D5546	.FILL #546
+D5547	.FILL #547
+D5548	.FILL #548
+D5549	.FILL #549
+D5550	.FILL #550
+D5551	.FILL #551
+D5552	.FILL #552
+D5553	.FILL #553
+D5554	.FILL #554
+D5555	.FILL #555
+D5556	.FILL #556
+D5557	.FILL #557
+D5558	.FILL #558
+D5559	.FILL #559
+D5560	.FILL #560
+D5561	.FILL #561
+D5562	.FILL #562
+D5563	.FILL #563
+D5564	.FILL #564
+D5565	.FILL #565
+D5566	.FILL #566
+D5567	.FILL #567
+D5568	.FILL #568
+D5569	.FILL #569
+D5570	.FILL #570
+D5571	.FILL #571
+D5572	.FILL #572
+D5573	.FILL #573
+D5574	.FILL #574
+D5575	.FILL #575
+D5576	.FILL #576
+D5577	.FILL #577
+D5578	.FILL #578
+D5579	.FILL #579
+D5580	.FILL #580
+D5581	.FILL #581
+D5582	.FILL #582
+D5583	.FILL #583
+D5584	.FILL #584
+D5585	.FILL #585
+D5586	.FILL #586
+D5587	.FILL #587
+D5588	.FILL #588
+D5589	.FILL #589
+D5590	.FILL #590
+D5591	.FILL #591
+D5592	.FILL #592
+D5593	.FILL #593
+D5594	.FILL #594
+D5595	.FILL #595
+D5596	.FILL #596
+D5597	.FILL #597
+D5598	.FILL #598
+D5599	.FILL #599
+D5600	.FILL #600
+D5601	.FILL #601
+D5602	.FILL #602
+D5603	.FILL #603
+D5604	.FILL #604
+D5605	.FILL #605
+D5606	.FILL #606
+D5607	.FILL #607
+D5608	.FILL #608
+D5609	.FILL #609
+D5610	.FILL #610
+D5611	.FILL #611
+D5612	.FILL #612
+D5613	.FILL #613
+D5614	.FILL #614
+D5615	.FILL #615
+D5616	.FILL #616
+D5617	.FILL #617
+D5618	.FILL #618
+D5619	.FILL #619
+D5620	.FILL #620
+D5621	.FILL #621
+D5622	.FILL #622
+D5623	.FILL #623
+D5624	.FILL #624
+D5625	.FILL #625
+D5626	.FILL #626
+D5627	.FILL #627
+D5628	.FILL #628
+D5629	.FILL #629
+D5630	.FILL #630
+D5631	.FILL #631
+D5632	.FILL #632
+D5633	.FILL #633
+D5634	.FILL #634
+D5635	.FILL #635
+D5636	.FILL #636
+D5637	.FILL #637
+D5638	.FILL #638
+D5639	.FILL #639
+D5640	.FILL #640
+D5641	.FILL #641
+D5642	.FILL #642
+D5643	.FILL #643
+D5644	.FILL #644
+D5645	.FILL #645
+D5646	.FILL #646
+D5647	.FILL #647
+D5648	.FILL #648
+D5649	.FILL #649
+D5650	.FILL #650
+D5651	.FILL #651
+D5652	.FILL #652
+D5653	.FILL #653
+D5654	.FILL #654
+D5655	.FILL #655
+D5656	.FILL #656
+D5657	.FILL #657
+D5658	.FILL #658
+D5659	.FILL #659
+D5660	.FILL #660
+D5661	.FILL #661
+D5662	.FILL #662
+D5663	.FILL #663
+D5664	.FILL #664
+D5665	.FILL #665
+D5666	.FILL #666
+D5667	.FILL #667
+D5668	.FILL #668
+D5669	.FILL #669
+D5670	.FILL #670
+D5671	.FILL #671
+D5672	.FILL #672
+D5673	.FILL #673
+D5674	.FILL #674
+D5675	.FILL #675
+D5676	.FILL #676
+D5677	.FILL #677
+D5678	.FILL #678
+D5679	.FILL #679
+D5680	.FILL #680
+D5681	.FILL #681
+D5682	.FILL #682
+D5683	.FILL #683
+D5684	.FILL #684
+D5685	.FILL #685
+D5686	.FILL #686
+D5687	.FILL #687
+D5688	.FILL #688
+D5689	.FILL #689
+D5690	.FILL #690
+D5691	.FILL #691
+D5692	.FILL #692
+D5693	.FILL #693
+D5694	.FILL #694
+D5695	.FILL #695
+D5696	.FILL #696
+D5697	.FILL #697
+D5698	.FILL #698
+D5699	.FILL #699
+D5700	.FILL #700
+D5701	.FILL #701
+D5702	.FILL #702
+D5703	.FILL #703
+D5704	.FILL #704
+D5705	.FILL #705
+D5706	.FILL #706
+D5707	.FILL #707
+D5708	.FILL #708
+D5709	.FILL #709
+D5710	.FILL #710
+D5711	.FILL #711
+D5712	.FILL #712
+D5713	.FILL #713
+D5714	.FILL #714
+D5715	.FILL #715
+D5716	.FILL #716
+D5717	.FILL #717
+D5718	.FILL #718
+D5719	.FILL #719
+D5720	.FILL #720
+D5721	.FILL #721
+D5722	.FILL #722
+D5723	.FILL #723
+D5724	.FILL #724
+D5725	.FILL #725
+D5726	.FILL #726
+D5727	.FILL #727
+D5728	.FILL #728
+D5729	.FILL #729
+D5730	.FILL #730
+D5731	.FILL #731
+D5732	.FILL #732
+D5733	.FILL #733
+D5734	.FILL #734
+D5735	.FILL #735
+D5736	.FILL #736
+D5737	.FILL #737
+D5738	.FILL #738
+D5739	.FILL #739
+D5740	.FILL #740
+D5741	.FILL #741
+D5742	.FILL #742
+D5743	.FILL #743
+D5744	.FILL #744
+D5745	.FILL #745
+D5746	.FILL #746
+D5747	.FILL #747
+D5748	.FILL #748
+D5749	.FILL #749
+D5750	.FILL #750
+D5751	.FILL #751
+D5752	.FILL #752
+D5753	.FILL #753
+D5754	.FILL #754
+D5755	.FILL #755
+D5756	.FILL #756
+D5757	.FILL #757
+D5758	.FILL #758
+D5759	.FILL #759
+D5760	.FILL #760
+D5761	.FILL #761
+D5762	.FILL #762
+D5763	.FILL #763
+D5764	.FILL #764
+D5765	.FILL #765
+D5766	.FILL #766
+D5767	.FILL #767
+D5768	.FILL #768
+D5769	.FILL #769
+D5770	.FILL #770
+D5771	.FILL #771
+D5772	.FILL #772
+D5773	.FILL #773
+D5774	.FILL #774
+D5775	.FILL #775
+D5776	.FILL #776
+D5777	.FILL #777
+D5778	.FILL #778
+D5779	.FILL #779
+D5780	.FILL #780
+D5781	.FILL #781
+D5782	.FILL #782
+D5783	.FILL #783
+D5784	.FILL #784
+D5785	.FILL #785
+D5786	.FILL #786
+D5787	.FILL #787
+D5788	.FILL #788
+D5789	.FILL #789
+D5790	.FILL #790
+D5791	.FILL #791
+D5792	.FILL #792
+D5793	.FILL #793
+D5794	.FILL #794
+D5795	.FILL #795
+D5796	.FILL #796
+D5797	.FILL #797
+D5798	.FILL #798
+D5799	.FILL #799
+D5800	.FILL #800
+D5801	.FILL #801
+D5802	.FILL #802
+D5803	.FILL #803
+D5804	.FILL #804
+D5805	.FILL #805
+D5806	.FILL #806
+D5807	.FILL #807
+D5808	.FILL #808
+D5809	.FILL #809
+D5810	.FILL #810
+D5811	.FILL #811
+D5812	.FILL #812
+D5813	.FILL #813
+D5814	.FILL #814
+D5815	.FILL #815
+D5816	.FILL #816
+D5817	.FILL #817
+D5818	.FILL #818
+D5819	.FILL #819
+D5820	.FILL #820
+D5821	.FILL #821
+D5822	.FILL #822
+D5823	.FILL #823
+D5824	.FILL #824
+D5825	.FILL #825
+D5826	.FILL #826
+D5827	.FILL #827
+D5828	.FILL #828
+D5829	.FILL #829
+D5830	.FILL #830
+D5831	.FILL #831
+D5832	.FILL #832
+D5833	.FILL #833
+D5834	.FILL #834
+D5835	.FILL #835
+D5836	.FILL #836
+D5837	.FILL #837
+D5838	.FILL #838
+D5839	.FILL #839
+D5840	.FILL #840
+D5841	.FILL #841
+D5842	.FILL #842
+D5843	.FILL #843
+D5844	.FILL #844
+D5845	.FILL #845
+D5846	.FILL #846
+D5847	.FILL #847
+D5848	.FILL #848
+D5849	.FILL #849
+D5850	.FILL #850
+D5851	.FILL #851
+D5852	.FILL #852
+D5853	.FILL #853
+D5854	.FILL #854
+D5855	.FILL #855
+D5856	.FILL #856
+D5857	.FILL #857
+D5858	.FILL #858
+D5859	.FILL #859
+D5860	.FILL #860
+D5861	.FILL #861
+D5862	.FILL #862
+D5863	.FILL #863
+D5864	.FILL #864
+D5865	.FILL #865
+D5866	.FILL #866
+D5867	.FILL #867
+D5868	.FILL #868
+D5869	.FILL #869
+D5870	.FILL #870
+D5871	.FILL #871
+D5872	.FILL #872
+D5873	.FILL #873
+D5874	.FILL #874
+D5875	.FILL #875
+D5876	.FILL #876
+D5877	.FILL #877
+D5878	.FILL #878
+D5879	.FILL #879
+D5880	.FILL #880
+D5881	.FILL #881
+D5882	.FILL #882
+D5883	.FILL #883
+D5884	.FILL #884
+D5885	.FILL #885
+D5886	.FILL #886
+D5887	.FILL #887
+D5888	.FILL #888
+D5889	.FILL #889
+D5890	.FILL #890
+D5891	.FILL #891
+D5892	.FILL #892
+D5893	.FILL #893
+D5894	.FILL #894
+D5895	.FILL #895
+D5896	.FILL #896
+D5897	.FILL #897
+D5898	.FILL #898
+D5899	.FILL #899
+D5900	.FILL #900
+D5901	.FILL #901
+D5902	.FILL #902
+D5903	.FILL #903
+D5904	.FILL #904
+D5905	.FILL #905
+D5906	.FILL #906
+D5907	.FILL #907
+D5908	.FILL #908
+D5909	.FILL #909
+D5910	.FILL #910
+D5911	.FILL #911
+D5912	.FILL #912
+D5913	.FILL #913
+D5914	.FILL #914
+D5915	.FILL #915
+D5916	.FILL #916
+D5917	.FILL #917
+D5918	.FILL #918
+D5919	.FILL #919
+D5920	.FILL #920
+D5921	.FILL #921
+D5922	.FILL #922
+D5923	.FILL #923
+D5924	.FILL #924
+D5925	.FILL #925
+D5926	.FILL #926
+D5927	.FILL #927
+D5928	.FILL #928
+D5929	.FILL #929
+D5930	.FILL #930
+D5931	.FILL #931
+D5932	.FILL #932
+D5933	.FILL #933
+D5934	.FILL #934
+D5935	.FILL #935
+D5936	.FILL #936
+D5937	.FILL #937
+D5938	.FILL #938
+D5939	.FILL #939
+D5940	.FILL #940
+D5941	.FILL #941
+D5942	.FILL #942
+D5943	.FILL #943
+D5944	.FILL #944
+D5945	.FILL #945
+D5946	.FILL #946
+D5947	.FILL #947
+D5948	.FILL #948
+D5949	.FILL #949
+D5950	.FILL #950
+D5951	.FILL #951
+D5952	.FILL #952
+D5953	.FILL #953
+D5954	.FILL #954
+D5955	.FILL #955
+D5956	.FILL #956
+D5957	.FILL #957
+D5958	.FILL #958
+D5959	.FILL #959
+D5960	.FILL #960
+D5961	.FILL #961
+D5962	.FILL #962
+D5963	.FILL #963
+D5964	.FILL #964
+D5965	.FILL #965
+D5966	.FILL #966
+D5967	.FILL #967
+D5968	.FILL #968
+D5969	.FILL #969
+D5970	.FILL #970
+D5971	.FILL #971
+D5972	.FILL #972
+D5973	.FILL #973
+D5974	.FILL #974
+D5975	.FILL #975
+D5976	.FILL #976
+D5977	.FILL #977
+D5978	.FILL #978
+D5979	.FILL #979
+D5980	.FILL #980
+D5981	.FILL #981
+D5982	.FILL #982
+D5983	.FILL #983
+D5984	.FILL #984
+D5985	.FILL #985
+D5986	.FILL #986
+D5987	.FILL #987
+D5988	.FILL #988
+D5989	.FILL #989
+D5990	.FILL #990
+D5991	.FILL #991
+D5992	.FILL #992
+D5993	.FILL #993
+D5994	.FILL #994
+D5995	.FILL #995
+D5996	.FILL #996
+D5997	.FILL #997
+D5998	.FILL #998
+D5999	.FILL #999
+D6000	.FILL #0
+D6001	.FILL #1
+D6002	.FILL #2
+D6003	.FILL #3
+D6004	.FILL #4
+D6005	.FILL #5
+D6006	.FILL #6
+D6007	.FILL #7
+D6008	.FILL #8
+D6009	.FILL #9
+D6010	.FILL #10
+D6011	.FILL #11
+D6012	.FILL #12
+D6013	.FILL #13
+D6014	.FILL #14
+D6015	.FILL #15
+D6016	.FILL #16
+D6017	.FILL #17
+D6018	.FILL #18
+D6019	.FILL #19
+D6020	.FILL #20
+D6021	.FILL #21
+D6022	.FILL #22
+D6023	.FILL #23
+D6024	.FILL #24
+D6025	.FILL #25
+D6026	.FILL #26
+D6027	.FILL #27
+D6028	.FILL #28
+D6029	.FILL #29
+D6030	.FILL #30
+D6031	.FILL #31
+D6032	.FILL #32
+D6033	.FILL #33
+D6034	.FILL #34
+D6035	.FILL #35
+D6036	.FILL #36
+D6037	.FILL #37
+D6038	.FILL #38
+D6039	.FILL #39
+D6040	.FILL #40
+D6041	.FILL #41
+D6042	.FILL #42
+D6043	.FILL #43
+D6044	.FILL #44
+D6045	.FILL #45
+D6046	.FILL #46
+D6047	.FILL #47
+D6048	.FILL #48
+D6049	.FILL #49
+D6050	.FILL #50
+D6051	.FILL #51
+D6052	.FILL #52
+D6053	.FILL #53
+D6054	.FILL #54
+D6055	.FILL #55
+D6056	.FILL #56
+D6057	.FILL #57
+D6058	.FILL #58
+D6059	.FILL #59
+D6060	.FILL #60
+D6061	.FILL #61
+D6062	.FILL #62
+D6063	.FILL #63
+D6064	.FILL #64
+D6065	.FILL #65
+D6066	.FILL #66
+D6067	.FILL #67
+D6068	.FILL #68
+D6069	.FILL #69
+D6070	.FILL #70
+D6071	.FILL #71
+D6072	.FILL #72
+D6073	.FILL #73
+D6074	.FILL #74
+D6075	.FILL #75
+D6076	.FILL #76
+D6077	.FILL #77
+D6078	.FILL #78
+D6079	.FILL #79
+D6080	.FILL #80
+D6081	.FILL #81
+D6082	.FILL #82
+D6083	.FILL #83
+D6084	.FILL #84
+D6085	.FILL #85
+D6086	.FILL #86
+D6087	.FILL #87
+D6088	.FILL #88
+D6089	.FILL #89
+D6090	.FILL #90
+D6091	.FILL #91
+D6092	.FILL #92
+D6093	.FILL #93
+D6094	.FILL #94
+D6095	.FILL #95
+D6096	.FILL #96
+D6097	.FILL #97
+D6098	.FILL #98
+D6099	.FILL #99
+D6100	.FILL #100
+D6101	.FILL #101
+D6102	.FILL #102
+D6103	.FILL #103
+D6104	.FILL #104
+D6105	.FILL #105
+D6106	.FILL #106
+D6107	.FILL #107
+D6108	.FILL #108
+D6109	.FILL #109
+D6110	.FILL #110
+D6111	.FILL #111
+D6112	.FILL #112
+D6113	.FILL #113
+D6114	.FILL #114
+D6115	.FILL #115
+D6116	.FILL #116
+D6117	.FILL #117
+D6118	.FILL #118
+D6119	.FILL #119
+D6120	.FILL #120
+D6121	.FILL #121
+D6122	.FILL #122
+D6123	.FILL #123
+D6124	.FILL #124
+D6125	.FILL #125
+D6126	.FILL #126
+D6127	.FILL #127
+D6128	.FILL #128
+D6129	.FILL #129
+D6130	.FILL #130
+D6131	.FILL #131
+D6132	.FILL #132
+D6133	.FILL #133
+D6134	.FILL #134
+D6135	.FILL #135
+D6136	.FILL #136
+D6137	.FILL #137
+D6138	.FILL #138
+D6139	.FILL #139
+D6140	.FILL #140
+D6141	.FILL #141
+D6142	.FILL #142
+D6143	.FILL #143
+D6144	.FILL #144
+D6145	.FILL #145
+D6146	.FILL #146
+D6147	.FILL #147
+D6148	.FILL #148
+D6149	.FILL #149
+D6150	.FILL #150
+D6151	.FILL #151
+D6152	.FILL #152
+D6153	.FILL #153
+D6154	.FILL #154
+D6155	.FILL #155
+D6156	.FILL #156
+D6157	.FILL #157
+D6158	.FILL #158
+D6159	.FILL #159
+D6160	.FILL #160
+D6161	.FILL #161
+D6162	.FILL #162
+D6163	.FILL #163
+D6164	.FILL #164
+D6165	.FILL #165
+D6166	.FILL #166
+D6167	.FILL #167
+D6168	.FILL #168
+D6169	.FILL #169
+D6170	.FILL #170
+D6171	.FILL #171
+D6172	.FILL #172
+D6173	.FILL #173
+D6174	.FILL #174
+D6175	.FILL #175
+D6176	.FILL #176
+D6177	.FILL #177
+D6178	.FILL #178
+D6179	.FILL #179
+D6180	.FILL #180
+D6181	.FILL #181
+D6182	.FILL #182
+D6183	.FILL #183
+D6184	.FILL #184
+D6185	.FILL #185
+D6186	.FILL #186
+D6187	.FILL #187
+D6188	.FILL #188
+D6189	.FILL #189
+D6190	.FILL #190
+D6191	.FILL #191
+D6192	.FILL #192
+D6193	.FILL #193
+D6194	.FILL #194
+D6195	.FILL #195
+D6196	.FILL #196
+D6197	.FILL #197
+D6198	.FILL #198
+D6199	.FILL #199
+D6200	.FILL #200
+D6201	.FILL #201
+D6202	.FILL #202
+D6203	.FILL #203
+D6204	.FILL #204
+D6205	.FILL #205
+D6206	.FILL #206
+D6207	.FILL #207
+D6208	.FILL #208
+D6209	.FILL #209
+D6210	.FILL #210
+D6211	.FILL #211
+D6212	.FILL #212
+D6213	.FILL #213
+D6214	.FILL #214
+D6215	.FILL #215
+D6216	.FILL #216
+D6217	.FILL #217
+D6218	.FILL #218
+D6219	.FILL #219
+D6220	.FILL #220
+D6221	.FILL #221
+D6222	.FILL #222
+D6223	.FILL #223
+D6224	.FILL #224
+D6225	.FILL #225
+D6226	.FILL #226
+D6227	.FILL #227
+D6228	.FILL #228
+D6229	.FILL #229
+D6230	.FILL #230
+D6231	.FILL #231
+D6232	.FILL #232
+D6233	.FILL #233
+D6234	.FILL #234
+D6235	.FILL #235
+D6236	.FILL #236
+D6237	.FILL #237
+D6238	.FILL #238
+D6239	.FILL #239
+D6240	.FILL #240
+D6241	.FILL #241
+D6242	.FILL #242
+D6243	.FILL #243
+D6244	.FILL #244
+D6245	.FILL #245
+D6246	.FILL #246
+D6247	.FILL #247
+D6248	.FILL #248
+D6249	.FILL #249
+D6250	.FILL #250
+D6251	.FILL #251
+D6252	.FILL #252
+D6253	.FILL #253
+D6254	.FILL #254
+D6255	.FILL #255
+D6256	.FILL #256
+D6257	.FILL #257
+D6258	.FILL #258
+D6259	.FILL #259
+D6260	.FILL #260
+D6261	.FILL #261
+D6262	.FILL #262
+D6263	.FILL #263
+D6264	.FILL #264
+D6265	.FILL #265
+D6266	.FILL #266
+D6267	.FILL #267
+D6268	.FILL #268
+D6269	.FILL #269
+D6270	.FILL #270
+D6271	.FILL #271
+D6272	.FILL #272
+D6273	.FILL #273
+D6274	.FILL #274
+D6275	.FILL #275
+D6276	.FILL #276
+D6277	.FILL #277
+D6278	.FILL #278
+D6279	.FILL #279
+D6280	.FILL #280
+D6281	.FILL #281
+D6282	.FILL #282
+D6283	.FILL #283
+D6284	.FILL #284
+D6285	.FILL #285
+D6286	.FILL #286
+D6287	.FILL #287
+D6288	.FILL #288
+D6289	.FILL #289
+D6290	.FILL #290
+D6291	.FILL #291
+D6292	.FILL #292
+D6293	.FILL #293
+D6294	.FILL #294
+D6295	.FILL #295
+D6296	.FILL #296
+D6297	.FILL #297
+D6298	.FILL #298
+D6299	.FILL #299
+D6300	.FILL #300
+D6301	.FILL #301
+D6302	.FILL #302
+D6303	.FILL #303
+D6304	.FILL #304
+D6305	.FILL #305
+D6306	.FILL #306
+D6307	.FILL #307
+D6308	.FILL #308
+D6309	.FILL #309
+D6310	.FILL #310
+D6311	.FILL #311
+D6312	.FILL #312
+D6313	.FILL #313
+D6314	.FILL #314
+D6315	.FILL #315
+D6316	.FILL #316
+D6317	.FILL #317
+D6318	.FILL #318
+D6319	.FILL #319
+D6320	.FILL #320
+D6321	.FILL #321
+D6322	.FILL #322
+D6323	.FILL #323
+D6324	.FILL #324
+D6325	.FILL #325
+D6326	.FILL #326
+D6327	.FILL #327
+D6328	.FILL #328
+D6329	.FILL #329
+D6330	.FILL #330
+D6331	.FILL #331
+D6332	.FILL #332
+D6333	.FILL #333
+D6334	.FILL #334
+D6335	.FILL #335
+D6336	.FILL #336
+D6337	.FILL #337
+D6338	.FILL #338
+D6339	.FILL #339
+D6340	.FILL #340
+D6341	.FILL #341
+D6342	.FILL #342
+D6343	.FILL #343
+D6344	.FILL #344
+D6345	.FILL #345
+D6346	.FILL #346
+D6347	.FILL #347
+D6348	.FILL #348
+D6349	.FILL #349
+D6350	.FILL #350
+D6351	.FILL #351
+D6352	.FILL #352
+D6353	.FILL #353
+D6354	.FILL #354
+D6355	.FILL #355
+D6356	.FILL #356
+D6357	.FILL #357
+D6358	.FILL #358
+D6359	.FILL #359
+D6360	.FILL #360
+D6361	.FILL #361
+D6362	.FILL #362
+D6363	.FILL #363
+D6364	.FILL #364
+D6365	.FILL #365
+D6366	.FILL #366
+D6367	.FILL #367
+D6368	.FILL #368
+D6369	.FILL #369
+D6370	.FILL #370
+D6371	.FILL #371
+D6372	.FILL #372
+D6373	.FILL #373
+D6374	.FILL #374
+D6375	.FILL #375
+D6376	.FILL #376
+D6377	.FILL #377
+D6378	.FILL #378
+D6379	.FILL #379
+D6380	.FILL #380
+D6381	.FILL #381
+D6382	.FILL #382
+D6383	.FILL #383
+D6384	.FILL #384
+D6385	.FILL #385
+D6386	.FILL #386
+D6387	.FILL #387
+D6388	.FILL #388
+D6389	.FILL #389
+D6390	.FILL #390
+D6391	.FILL #391
+D6392	.FILL #392
+D6393	.FILL #393
+D6394	.FILL #394
+D6395	.FILL #395
+D6396	.FILL #396
+D6397	.FILL #397
+D6398	.FILL #398
+D6399	.FILL #399
+D6400	.FILL #400
+D6401	.FILL #401
+D6402	.FILL #402
+D6403	.FILL #403
+D6404	.FILL #404
+D6405	.FILL #405
+D6406	.FILL #406
+D6407	.FILL #407
+D6408	.FILL #408
+D6409	.FILL #409
+D6410	.FILL #410
+D6411	.FILL #411
+D6412	.FILL #412
+D6413	.FILL #413
+D6414	.FILL #414
+D6415	.FILL #415
+D6416	.FILL #416
+D6417	.FILL #417
+D6418	.FILL #418
+D6419	.FILL #419
+D6420	.FILL #420
+D6421	.FILL #421
+D6422	.FILL #422
+D6423	.FILL #423
+D6424	.FILL #424
+D6425	.FILL #425
+D6426	.FILL #426
+D6427	.FILL #427
+D6428	.FILL #428
+D6429	.FILL #429
+D6430	.FILL #430
+D6431	.FILL #431
+D6432	.FILL #432
+D6433	.FILL #433
+D6434	.FILL #434
+D6435	.FILL #435
+D6436	.FILL #436
+D6437	.FILL #437
+D6438	.FILL #438
+D6439	.FILL #439
+D6440	.FILL #440
+D6441	.FILL #441
+D6442	.FILL #442
+D6443	.FILL #443
+D6444	.FILL #444
+D6445	.FILL #445
+D6446	.FILL #446
+D6447	.FILL #447
+D6448	.FILL #448
+D6449	.FILL #449
+D6450	.FILL #450
+D6451	.FILL #451
+D6452	.FILL #452
+D6453	.FILL #453
+D6454	.FILL #454
+D6455	.FILL #455
+D6456	.FILL #456
+D6457	.FILL #457
+D6458	.FILL #458
+D6459	.FILL #459
+D6460	.FILL #460
+D6461	.FILL #461
+D6462	.FILL #462
+D6463	.FILL #463
+D6464	.FILL #464
+D6465	.FILL #465
+D6466	.FILL #466
+D6467	.FILL #467
+D6468	.FILL #468
+D6469	.FILL #469
+D6470	.FILL #470
+D6471	.FILL #471
+D6472	.FILL #472
+D6473	.FILL #473
+D6474	.FILL #474
+D6475	.FILL #475
+D6476	.FILL #476
+D6477	.FILL #477
+D6478	.FILL #478
+D6479	.FILL #479
+D6480	.FILL #480
+D6481	.FILL #481
+D6482	.FILL #482
+D6483	.FILL #483
+D6484	.FILL #484
+D6485	.FILL #485
+D6486	.FILL #486
+D6487	.FILL #487
+D6488	.FILL #488
+D6489	.FILL #489
+D6490	.FILL #490
+D6491	.FILL #491
+D6492	.FILL #492
+D6493	.FILL #493
+D6494	.FILL #494
+D6495	.FILL #495
+D6496	.FILL #496
+D6497	.FILL #497
+D6498	.FILL #498
+D6499	.FILL #499
+D6500	.FILL #500
+D6501	.FILL #501
+D6502	.FILL #502
+D6503	.FILL #503
+D6504	.FILL #504
+D6505	.FILL #505
+D6506	.FILL #506
+D6507	.FILL #507
+D6508	.FILL #508
+D6509	.FILL #509
+D6510	.FILL #510
+D6511	.FILL #511
+D6512	.FILL #512
+D6513	.FILL #513
+D6514	.FILL #514
+D6515	.FILL #515
+D6516	.FILL #516
+D6517	.FILL #517
+D6518	.FILL #518
+D6519	.FILL #519
+D6520	.FILL #520
+D6521	.FILL #521
+D6522	.FILL #522
+D6523	.FILL #523
+D6524	.FILL #524
+D6525	.FILL #525
+D6526	.FILL #526
+D6527	.FILL #527
+D6528	.FILL #528
+D6529	.FILL #529
+D6530	.FILL #530
+D6531	.FILL #531
+D6532	.FILL #532
+D6533	.FILL #533
+D6534	.FILL #534
+D6535	.FILL #535
+D6536	.FILL #536
+D6537	.FILL #537
+D6538	.FILL #538
+D6539	.FILL #539
+D6540	.FILL #540
+D6541	.FILL #541
+D6542	.FILL #542
+D6543	.FILL #543
+D6544	.FILL #544
+D6545	.FILL #545
+D6546	.FILL #546
+D6547	.FILL #547
+D6548	.FILL #548
+D6549	.FILL #549
+D6550	.FILL #550
+D6551	.FILL #551
+D6552	.FILL #552
+D6553	.FILL #553
+D6554	.FILL #554
+D6555	.FILL #555
+D6556	.FILL #556
+D6557	.FILL #557
+D6558	.FILL #558
+D6559	.FILL #559
+D6560	.FILL #560
+D6561	.FILL #561
+D6562	.FILL #562
+D6563	.FILL #563
+D6564	.FILL #564
+D6565	.FILL #565
+D6566	.FILL #566
+D6567	.FILL #567
+D6568	.FILL #568
+D6569	.FILL #569
+D6570	.FILL #570
+D6571	.FILL #571
+D6572	.FILL #572
+D6573	.FILL #573
+D6574	.FILL #574
+D6575	.FILL #575
+D6576	.FILL #576
+D6577	.FILL #577
+D6578	.FILL #578
+D6579	.FILL #579
+D6580	.FILL #580
+D6581	.FILL #581
+D6582	.FILL #582
+D6583	.FILL #583
+D6584	.FILL #584
+D6585	.FILL #585
+D6586	.FILL #586
+D6587	.FILL #587
+D6588	.FILL #588
+D6589	.FILL #589
+D6590	.FILL #590
+D6591	.FILL #591
+D6592	.FILL #592
+D6593	.FILL #593
+D6594	.FILL #594
+D6595	.FILL #595
+D6596	.FILL #596
+D6597	.FILL #597
+D6598	.FILL #598
+D6599	.FILL #599
+D6600	.FILL #600
+D6601	.FILL #601
+D6602	.FILL #602
+D6603	.FILL #603
+D6604	.FILL #604
+D6605	.FILL #605
+D6606	.FILL #606
+D6607	.FILL #607
+D6608	.FILL #608
+D6609	.FILL #609
+D6610	.FILL #610
+D6611	.FILL #611
+D6612	.FILL #612
+D6613	.FILL #613
+D6614	.FILL #614
+D6615	.FILL #615
+D6616	.FILL #616
+D6617	.FILL #617
+D6618	.FILL #618
+D6619	.FILL #619
+D6620	.FILL #620
+D6621	.FILL #621
+D6622	.FILL #622
+D6623	.FILL #623
+D6624	.FILL #624
+D6625	.FILL #625
+D6626	.FILL #626
+D6627	.FILL #627
+D6628	.FILL #628
+D6629	.FILL #629
+D6630	.FILL #630
+D6631	.FILL #631
+D6632	.FILL #632
+D6633	.FILL #633
+D6634	.FILL #634
+D6635	.FILL #635
+D6636	.FILL #636
+D6637	.FILL #637
+D6638	.FILL #638
+D6639	.FILL #639
+D6640	.FILL #640
+D6641	.FILL #641
+D6642	.FILL #642
+D6643	.FILL #643
+D6644	.FILL #644
+D6645	.FILL #645
+D6646	.FILL #646
+D6647	.FILL #647
+D6648	.FILL #648
+D6649	.FILL #649
+D6650	.FILL #650
+D6651	.FILL #651
+D6652	.FILL #652
+D6653	.FILL #653
+D6654	.FILL #654
+D6655	.FILL #655
+D6656	.FILL #656
+D6657	.FILL #657
+D6658	.FILL #658
+D6659	.FILL #659
+D6660	.FILL #660
+D6661	.FILL #661
+D6662	.FILL #662
+D6663	.FILL #663
+D6664	.FILL #664
+D6665	.FILL #665
+D6666	.FILL #666
+D6667	.FILL #667
+D6668	.FILL #668
+D6669	.FILL #669
+D6670	.FILL #670
+D6671	.FILL #671
+D6672	.FILL #672
+D6673	.FILL #673
+D6674	.FILL #674
+D6675	.FILL #675
+D6676	.FILL #676
+D6677	.FILL #677
+D6678	.FILL #678
+D6679	.FILL #679
+D6680	.FILL #680
+D6681	.FILL #681
+D6682	.FILL #682
+D6683	.FILL #683
+D6684	.FILL #684
+D6685	.FILL #685
+D6686	.FILL #686
+D6687	.FILL #687
+D6688	.FILL #688
+D6689	.FILL #689
+D6690	.FILL #690
+D6691	.FILL #691
+D6692	.FILL #692
+D6693	.FILL #693
+D6694	.FILL #694
+D6695	.FILL #695
+D6696	.FILL #696
+D6697	.FILL #697
+D6698	.FILL #698
+D6699	.FILL #699
+D6700	.FILL #700
+D6701	.FILL #701
+D6702	.FILL #702
+D6703	.FILL #703
+D6704	.FILL #704
+D6705	.FILL #705
+D6706	.FILL #706
+D6707	.FILL #707
+D6708	.FILL #708
+D6709	.FILL #709
+D6710	.FILL #710
+D6711	.FILL #711
+D6712	.FILL #712
+D6713	.FILL #713
+D6714	.FILL #714
+D6715	.FILL #715
+D6716	.FILL #716
+D6717	.FILL #717
+D6718	.FILL #718
+D6719	.FILL #719
+D6720	.FILL #720
+D6721	.FILL #721
+D6722	.FILL #722
+D6723	.FILL #723
+D6724	.FILL #724
+D6725	.FILL #725
+D6726	.FILL #726
+D6727	.FILL #727
+D6728	.FILL #728
+D6729	.FILL #729
+D6730	.FILL #730
+D6731	.FILL #731
+D6732	.FILL #732
+D6733	.FILL #733
+D6734	.FILL #734
+D6735	.FILL #735
+D6736	.FILL #736
+D6737	.FILL #737
+D6738	.FILL #738
+D6739	.FILL #739
+D6740	.FILL #740
+D6741	.FILL #741
+D6742	.FILL #742
+D6743	.FILL #743
+D6744	.FILL #744
+D6745	.FILL #745
+D6746	.FILL #746
+D6747	.FILL #747
+D6748	.FILL #748
+D6749	.FILL #749
+D6750	.FILL #750
+D6751	.FILL #751
+D6752	.FILL #752
+D6753	.FILL #753
+D6754	.FILL #754
+D6755	.FILL #755
+D6756	.FILL #756
+D6757	.FILL #757
+D6758	.FILL #758
+D6759	.FILL #759
+D6760	.FILL #760
+D6761	.FILL #761
+D6762	.FILL #762
+D6763	.FILL #763
+D6764	.FILL #764
+D6765	.FILL #765
+D6766	.FILL #766
+D6767	.FILL #767
+D6768	.FILL #768
+D6769	.FILL #769
+D6770	.FILL #770
+D6771	.FILL #771
+D6772	.FILL #772
+D6773	.FILL #773
+D6774	.FILL #774
+D6775	.FILL #775
+D6776	.FILL #776
+D6777	.FILL #777
+D6778	.FILL #778
+D6779	.FILL #779
+D6780	.FILL #780
+D6781	.FILL #781
+D6782	.FILL #782
+D6783	.FILL #783
+D6784	.FILL #784
+D6785	.FILL #785
+D6786	.FILL #786
+D6787	.FILL #787
+D6788	.FILL #788
+D6789	.FILL #789
+D6790	.FILL #790
+D6791	.FILL #791
+D6792	.FILL #792
+D6793	.FILL #793
+D6794	.FILL #794
+D6795	.FILL #795
+D6796	.FILL #796
+D6797	.FILL #797
+D6798	.FILL #798
+D6799	.FILL #799
+D6800	.FILL #800
+D6801	.FILL #801
+D6802	.FILL #802
+D6803	.FILL #803
+D6804	.FILL #804
+D6805	.FILL #805
+D6806	.FILL #806
+D6807	.FILL #807
+D6808	.FILL #808
+D6809	.FILL #809
+D6810	.FILL #810
+D6811	.FILL #811
+D6812	.FILL #812
+D6813	.FILL #813
+D6814	.FILL #814
+D6815	.FILL #815
+D6816	.FILL #816
+D6817	.FILL #817
+D6818	.FILL #818
+D6819	.FILL #819
+D6820	.FILL #820
+D6821	.FILL #821
+D6822	.FILL #822
+D6823	.FILL #823
+D6824	.FILL #824
+D6825	.FILL #825
+D6826	.FILL #826
+D6827	.FILL #827
+D6828	.FILL #828
+D6829	.FILL #829
+D6830	.FILL #830
+D6831	.FILL #831
+D6832	.FILL #832
+D6833	.FILL #833
+D6834	.FILL #834
+D6835	.FILL #835
+D6836	.FILL #836
+D6837	.FILL #837
+D6838	.FILL #838
+D6839	.FILL #839
+D6840	.FILL #840
+D6841	.FILL #841
+D6842	.FILL #842
+D6843	.FILL #843
+D6844	.FILL #844
+D6845	.FILL #845
+D6846	.FILL #846
+D6847	.FILL #847
+D6848	.FILL #848
+D6849	.FILL #849
+D6850	.FILL #850
+D6851	.FILL #851
+D6852	.FILL #852
+D6853	.FILL #853
+D6854	.FILL #854
+D6855	.FILL #855
+D6856	.FILL #856
+D6857	.FILL #857
+D6858	.FILL #858
+D6859	.FILL #859
+D6860	.FILL #860
+D6861	.FILL #861
+D6862	.FILL #862
+D6863	.FILL #863
+D6864	.FILL #864
+D6865	.FILL #865
+D6866	.FILL #866
+D6867	.FILL #867
+D6868	.FILL #868
+D6869	.FILL #869
+D6870	.FILL #870
+D6871	.FILL #871
+D6872	.FILL #872
+D6873	.FILL #873
+D6874	.FILL #874
+D6875	.FILL #875
+D6876	.FILL #876
+D6877	.FILL #877
+D6878	.FILL #878
+D6879	.FILL #879
+D6880	.FILL #880
+D6881	.FILL #881
+D6882	.FILL #882
+D6883	.FILL #883
+D6884	.FILL #884
+D6885	.FILL #885
+D6886	.FILL #886
+D6887	.FILL #887
+D6888	.FILL #888
+D6889	.FILL #889
+D6890	.FILL #890
+D6891	.FILL #891
+D6892	.FILL #892
+D6893	.FILL #893
+D6894	.FILL #894
+D6895	.FILL #895
+D6896	.FILL #896
+D6897	.FILL #897
+D6898	.FILL #898
+D6899	.FILL #899
+D6900	.FILL #900
+D6901	.FILL #901
+D6902	.FILL #902
+D6903	.FILL #903
+D6904	.FILL #904
+D6905	.FILL #905
+D6906	.FILL #906
+D6907	.FILL #907
+D6908	.FILL #908
+D6909	.FILL #909
+D6910	.FILL #910
+D6911	.FILL #911
+D6912	.FILL #912
+D6913	.FILL #913
+D6914	.FILL #914
+D6915	.FILL #915
+D6916	.FILL #916
+D6917	.FILL #917
+D6918	.FILL #918
+D6919	.FILL #919
+D6920	.FILL #920
+D6921	.FILL #921
+D6922	.FILL #922
+D6923	.FILL #923
+D6924	.FILL #924
+D6925	.FILL #925
+D6926	.FILL #926
+D6927	.FILL #927
+D6928	.FILL #928
+D6929	.FILL #929
+D6930	.FILL #930
+D6931	.FILL #931
+D6932	.FILL #932
+D6933	.FILL #933
+D6934	.FILL #934
+D6935	.FILL #935
+D6936	.FILL #936
+D6937	.FILL #937
+D6938	.FILL #938
+D6939	.FILL #939
+D6940	.FILL #940
+D6941	.FILL #941
+D6942	.FILL #942
+D6943	.FILL #943
+D6944	.FILL #944
+D6945	.FILL #945
+D6946	.FILL #946
+D6947	.FILL #947
+D6948	.FILL #948
+D6949	.FILL #949
+D6950	.FILL #950
+D6951	.FILL #951
+D6952	.FILL #952
+D6953	.FILL #953
+D6954	.FILL #954
+D6955	.FILL #955
+D6956	.FILL #956
+D6957	.FILL #957
+D6958	.FILL #958
+D6959	.FILL #959
+D6960	.FILL #960
+D6961	.FILL #961
+D6962	.FILL #962
+D6963	.FILL #963
+D6964	.FILL #964
+D6965	.FILL #965
+D6966	.FILL #966
+D6967	.FILL #967
+D6968	.FILL #968
+D6969	.FILL #969
+D6970	.FILL #970
+D6971	.FILL #971
+D6972	.FILL #972
+D6973	.FILL #973
+D6974	.FILL #974
+D6975	.FILL #975
+D6976	.FILL #976
+D6977	.FILL #977
+D6978	.FILL #978
+D6979	.FILL #979
+D6980	.FILL #980
+D6981	.FILL #981
+D6982	.FILL #982
+D6983	.FILL #983
+D6984	.FILL #984
+D6985	.FILL #985
+D6986	.FILL #986
+D6987	.FILL #987
+D6988	.FILL #988
+D6989	.FILL #989
+D6990	.FILL #990
+D6991	.FILL #991
+D6992	.FILL #992
+D6993	.FILL #993
+D6994	.FILL #994
+D6995	.FILL #995
+D6996	.FILL #996
+D6997	.FILL #997
+D6998	.FILL #998
+D6999	.FILL #999
+D7000	.FILL #0
+D7001	.FILL #1
+D7002	.FILL #2
+D7003	.FILL #3
+D7004	.FILL #4
+D7005	.FILL #5
+D7006	.FILL #6
+D7007	.FILL #7
+D7008	.FILL #8
+D7009	.FILL #9
+D7010	.FILL #10
+D7011	.FILL #11
+D7012	.FILL #12
+D7013	.FILL #13
+D7014	.FILL #14
+D7015	.FILL #15
+D7016	.FILL #16
+D7017	.FILL #17
+D7018	.FILL #18
+D7019	.FILL #19
+D7020	.FILL #20
+D7021	.FILL #21
+D7022	.FILL #22
+D7023	.FILL #23
+D7024	.FILL #24
+D7025	.FILL #25
+D7026	.FILL #26
+D7027	.FILL #27
+D7028	.FILL #28
+D7029	.FILL #29
+D7030	.FILL #30
+D7031	.FILL #31
+D7032	.FILL #32
+D7033	.FILL #33
+D7034	.FILL #34
+D7035	.FILL #35
+D7036	.FILL #36
+D7037	.FILL #37
+D7038	.FILL #38
+D7039	.FILL #39
+D7040	.FILL #40
+D7041	.FILL #41
+D7042	.FILL #42
+D7043	.FILL #43
+D7044	.FILL #44
+D7045	.FILL #45
+D7046	.FILL #46
+D7047	.FILL #47
+D7048	.FILL #48
+D7049	.FILL #49
+D7050	.FILL #50
+D7051	.FILL #51
+D7052	.FILL #52
+D7053	.FILL #53
+D7054	.FILL #54
+D7055	.FILL #55
+D7056	.FILL #56
+D7057	.FILL #57
+D7058	.FILL #58
+D7059	.FILL #59
+D7060	.FILL #60
+D7061	.FILL #61
+D7062	.FILL #62
+D7063	.FILL #63
+D7064	.FILL #64
+D7065	.FILL #65
+D7066	.FILL #66
+D7067	.FILL #67
+D7068	.FILL #68
+D7069	.FILL #69
+D7070	.FILL #70
+D7071	.FILL #71
+D7072	.FILL #72
+D7073	.FILL #73
+D7074	.FILL #74
+D7075	.FILL #75
+D7076	.FILL #76
+D7077	.FILL #77
+D7078	.FILL #78
+D7079	.FILL #79
+D7080	.FILL #80
+D7081	.FILL #81
+D7082	.FILL #82
+D7083	.FILL #83
+D7084	.FILL #84
+D7085	.FILL #85
+D7086	.FILL #86
+D7087	.FILL #87
+D7088	.FILL #88
+D7089	.FILL #89
+D7090	.FILL #90
+D7091	.FILL #91
+D7092	.FILL #92
+D7093	.FILL #93
+D7094	.FILL #94
+D7095	.FILL #95
+D7096	.FILL #96
+D7097	.FILL #97
+D7098	.FILL #98
+D7099	.FILL #99
+D7100	.FILL #100
+D7101	.FILL #101
+D7102	.FILL #102
+D7103	.FILL #103
+D7104	.FILL #104
+D7105	.FILL #105
+D7106	.FILL #106
+D7107	.FILL #107
+D7108	.FILL #108
+D7109	.FILL #109
+D7110	.FILL #110
+D7111	.FILL #111
+D7112	.FILL #112
+D7113	.FILL #113
+D7114	.FILL #114
+D7115	.FILL #115
+D7116	.FILL #116
+D7117	.FILL #117
+D7118	.FILL #118
+D7119	.FILL #119
+D7120	.FILL #120
+D7121	.FILL #121
+D7122	.FILL #122
+D7123	.FILL #123
+D7124	.FILL #124
+D7125	.FILL #125
+D7126	.FILL #126
+D7127	.FILL #127
+D7128	.FILL #128
+D7129	.FILL #129
+D7130	.FILL #130
+D7131	.FILL #131
+D7132	.FILL #132
+D7133	.FILL #133
+D7134	.FILL #134
+D7135	.FILL #135
+D7136	.FILL #136
+D7137	.FILL #137
+D7138	.FILL #138
+D7139	.FILL #139
+D7140	.FILL #140
+D7141	.FILL #141
+D7142	.FILL #142
+D7143	.FILL #143
+D7144	.FILL #144
+D7145	.FILL #145
+D7146	.FILL #146
+D7147	.FILL #147
+D7148	.FILL #148
+D7149	.FILL #149
+D7150	.FILL #150
+D7151	.FILL #151
+D7152	.FILL #152
+D7153	.FILL #153
+D7154	.FILL #154
+D7155	.FILL #155
+D7156	.FILL #156
+D7157	.FILL #157
+D7158	.FILL #158
+D7159	.FILL #159
+D7160	.FILL #160
+D7161	.FILL #161
+D7162	.FILL #162
+D7163	.FILL #163
+D7164	.FILL #164
+D7165	.FILL #165
+D7166	.FILL #166
+D7167	.FILL #167
+D7168	.FILL #168
+D7169	.FILL #169
+D7170	.FILL #170
+D7171	.FILL #171
+D7172	.FILL #172
+D7173	.FILL #173
+D7174	.FILL #174
+D7175	.FILL #175
+D7176	.FILL #176
+D7177	.FILL #177
+D7178	.FILL #178
+D7179	.FILL #179
+D7180	.FILL #180
+D7181	.FILL #181
+D7182	.FILL #182
+D7183	.FILL #183
+D7184	.FILL #184
+D7185	.FILL #185
+D7186	.FILL #186
+D7187	.FILL #187
+D7188	.FILL #188
+D7189	.FILL #189
+D7190	.FILL #190
+D7191	.FILL #191
+D7192	.FILL #192
+D7193	.FILL #193
+D7194	.FILL #194
+D7195	.FILL #195
+D7196	.FILL #196
+D7197	.FILL #197
+D7198	.FILL #198
+D7199	.FILL #199
+D7200	.FILL #200
+D7201	.FILL #201
+D7202	.FILL #202
+D7203	.FILL #203
+D7204	.FILL #204
+D7205	.FILL #205
+D7206	.FILL #206
+D7207	.FILL #207
+D7208	.FILL #208
+D7209	.FILL #209
+D7210	.FILL #210
+D7211	.FILL #211
+D7212	.FILL #212
+D7213	.FILL #213
+D7214	.FILL #214
+D7215	.FILL #215
+D7216	.FILL #216
+D7217	.FILL #217
+D7218	.FILL #218
+D7219	.FILL #219
+D7220	.FILL #220
+D7221	.FILL #221
+D7222	.FILL #222
+D7223	.FILL #223
+D7224	.FILL #224
+D7225	.FILL #225
+D7226	.FILL #226
+D7227	.FILL #227
+D7228	.FILL #228
+D7229	.FILL #229
+D7230	.FILL #230
+D7231	.FILL #231
+D7232	.FILL #232
+D7233	.FILL #233
+D7234	.FILL #234
+D7235	.FILL #235
+D7236	.FILL #236
+D7237	.FILL #237
+D7238	.FILL #238
+D7239	.FILL #239
+D7240	.FILL #240
+D7241	.FILL #241
+D7242	.FILL #242
+D7243	.FILL #243
+D7244	.FILL #244
+D7245	.FILL #245
+D7246	.FILL #246
+D7247	.FILL #247
+D7248	.FILL #248
+D7249	.FILL #249
+D7250	.FILL #250
+D7251	.FILL #251
+D7252	.FILL #252
+D7253	.FILL #253
+D7254	.FILL #254
+D7255	.FILL #255
+D7256	.FILL #256
+D7257	.FILL #257
+D7258	.FILL #258
+D7259	.FILL #259
+D7260	.FILL #260
+D7261	.FILL #261
+D7262	.FILL #262
+D7263	.FILL #263
+D7264	.FILL #264
+D7265	.FILL #265
+D7266	.FILL #266
+D7267	.FILL #267
+D7268	.FILL #268
+D7269	.FILL #269
+D7270	.FILL #270
+D7271	.FILL #271
+D7272	.FILL #272
+D7273	.FILL #273
+D7274	.FILL #274
+D7275	.FILL #275
+D7276	.FILL #276
+D7277	.FILL #277
+D7278	.FILL #278
+D7279	.FILL #279
+D7280	.FILL #280
+D7281	.FILL #281
+D7282	.FILL #282
+D7283	.FILL #283
+D7284	.FILL #284
+D7285	.FILL #285
+D7286	.FILL #286
+D7287	.FILL #287
+D7288	.FILL #288
+D7289	.FILL #289
+D7290	.FILL #290
+D7291	.FILL #291
+D7292	.FILL #292
+D7293	.FILL #293
+D7294	.FILL #294
+D7295	.FILL #295
+D7296	.FILL #296
+D7297	.FILL #297
+D7298	.FILL #298
+D7299	.FILL #299
+D7300	.FILL #300
+D7301	.FILL #301
+D7302	.FILL #302
+D7303	.FILL #303
+D7304	.FILL #304
+D7305	.FILL #305
+D7306	.FILL #306
+D7307	.FILL #307
+D7308	.FILL #308
+D7309	.FILL #309
+D7310	.FILL #310
+D7311	.FILL #311
+D7312	.FILL #312
+D7313	.FILL #313
+D7314	.FILL #314
+D7315	.FILL #315
+D7316	.FILL #316
+D7317	.FILL #317
+D7318	.FILL #318
+D7319	.FILL #319
+D7320	.FILL #320
+D7321	.FILL #321
+D7322	.FILL #322
+D7323	.FILL #323
+D7324	.FILL #324
+D7325	.FILL #325
+D7326	.FILL #326
+D7327	.FILL #327
+D7328	.FILL #328
+D7329	.FILL #329
+D7330	.FILL #330
+D7331	.FILL #331
+D7332	.FILL #332
+D7333	.FILL #333
+D7334	.FILL #334
+D7335	.FILL #335
+D7336	.FILL #336
+D7337	.FILL #337
+D7338	.FILL #338
+D7339	.FILL #339
+D7340	.FILL #340
+D7341	.FILL #341
+D7342	.FILL #342
+D7343	.FILL #343
+D7344	.FILL #344
+D7345	.FILL #345
+D7346	.FILL #346
+D7347	.FILL #347
+D7348	.FILL #348
+D7349	.FILL #349
+D7350	.FILL #350
+D7351	.FILL #351
+D7352	.FILL #352
+D7353	.FILL #353
+D7354	.FILL #354
+D7355	.FILL #355
+D7356	.FILL #356
+D7357	.FILL #357
+D7358	.FILL #358
+D7359	.FILL #359
+D7360	.FILL #360
+D7361	.FILL #361
+D7362	.FILL #362
+D7363	.FILL #363
+D7364	.FILL #364
+D7365	.FILL #365
+D7366	.FILL #366
+D7367	.FILL #367
+D7368	.FILL #368
+D7369	.FILL #369
+D7370	.FILL #370
+D7371	.FILL #371
+D7372	.FILL #372
+D7373	.FILL #373
+D7374	.FILL #374
+D7375	.FILL #375
+D7376	.FILL #376
+D7377	.FILL #377
+D7378	.FILL #378
+D7379	.FILL #379
+D7380	.FILL #380
+D7381	.FILL #381
+D7382	.FILL #382
+D7383	.FILL #383
+D7384	.FILL #384
+D7385	.FILL #385
+D7386	.FILL #386
+D7387	.FILL #387
+D7388	.FILL #388
+D7389	.FILL #389
+D7390	.FILL #390
+D7391	.FILL #391
+D7392	.FILL #392
+D7393	.FILL #393
+D7394	.FILL #394
+D7395	.FILL #395
+D7396	.FILL #396
+D7397	.FILL #397
+D7398	.FILL #398
+D7399	.FILL #399
+D7400	.FILL #400
+D7401	.FILL #401
+D7402	.FILL #402
+D7403	.FILL #403
+D7404	.FILL #404
+D7405	.FILL #405
+D7406	.FILL #406
+D7407	.FILL #407
+D7408	.FILL #408
+D7409	.FILL #409
+D7410	.FILL #410
+D7411	.FILL #411
+D7412	.FILL #412
+D7413	.FILL #413
+D7414	.FILL #414
+D7415	.FILL #415
+D7416	.FILL #416
+D7417	.FILL #417
+D7418	.FILL #418
+D7419	.FILL #419
+D7420	.FILL #420
+D7421	.FILL #421
+D7422	.FILL #422
+D7423	.FILL #423
+D7424	.FILL #424
+D7425	.FILL #425
+D7426	.FILL #426
+D7427	.FILL #427
+D7428	.FILL #428
+D7429	.FILL #429
+D7430	.FILL #430
+D7431	.FILL #431
+D7432	.FILL #432
+D7433	.FILL #433
+D7434	.FILL #434
+D7435	.FILL #435
+D7436	.FILL #436
+D7437	.FILL #437
+D7438	.FILL #438
+D7439	.FILL #439
+D7440	.FILL #440
+D7441	.FILL #441
+D7442	.FILL #442
+D7443	.FILL #443
+D7444	.FILL #444
+D7445	.FILL #445
+D7446	.FILL #446
+D7447	.FILL #447
+D7448	.FILL #448
+D7449	.FILL #449
+D7450	.FILL #450
+D7451	.FILL #451
+D7452	.FILL #452
+D7453	.FILL #453
+D7454	.FILL #454
+D7455	.FILL #455
+D7456	.FILL #456
+D7457	.FILL #457
+D7458	.FILL #458
+D7459	.FILL #459
+D7460	.FILL #460
+D7461	.FILL #461
+D7462	.FILL #462
+D7463	.FILL #463
+D7464	.FILL #464
+D7465	.FILL #465
+D7466	.FILL #466
+D7467	.FILL #467
+D7468	.FILL #468
+D7469	.FILL #469
+D7470	.FILL #470
+D7471	.FILL #471
+D7472	.FILL #472
+D7473	.FILL #473
+D7474	.FILL #474
+D7475	.FILL #475
+D7476	.FILL #476
+D7477	.FILL #477
+D7478	.FILL #478
+D7479	.FILL #479
+D7480	.FILL #480
+D7481	.FILL #481
+D7482	.FILL #482
+D7483	.FILL #483
+D7484	.FILL #484
+D7485	.FILL #485
+D7486	.FILL #486
+D7487	.FILL #487
+D7488	.FILL #488
+D7489	.FILL #489
+D7490	.FILL #490
+D7491	.FILL #491
+D7492	.FILL #492
+D7493	.FILL #493
+D7494	.FILL #494
+D7495	.FILL #495
+D7496	.FILL #496
+D7497	.FILL #497
+D7498	.FILL #498
+D7499	.FILL #499
+D7500	.FILL #500
+D7501	.FILL #501
+D7502	.FILL #502
+D7503	.FILL #503
+D7504	.FILL #504
+D7505	.FILL #505
+D7506	.FILL #506
+D7507	.FILL #507
+D7508	.FILL #508
+D7509	.FILL #509
+D7510	.FILL #510
+D7511	.FILL #511
+D7512	.FILL #512
+D7513	.FILL #513
+D7514	.FILL #514
+D7515	.FILL #515
+D7516	.FILL #516
+D7517	.FILL #517
+D7518	.FILL #518
+D7519	.FILL #519
+D7520	.FILL #520
+D7521	.FILL #521
+D7522	.FILL #522
+D7523	.FILL #523
+D7524	.FILL #524
+D7525	.FILL #525
+D7526	.FILL #526
+D7527	.FILL #527
+D7528	.FILL #528
+D7529	.FILL #529
+D7530	.FILL #530
+D7531	.FILL #531
+D7532	.FILL #532
+D7533	.FILL #533
+D7534	.FILL #534
+D7535	.FILL #535
+D7536	.FILL #536
+D7537	.FILL #537
+D7538	.FILL #538
+D7539	.FILL #539
+D7540	.FILL #540
+D7541	.FILL #541
+D7542	.FILL #542
+D7543	.FILL #543
+D7544	.FILL #544
+D7545	.FILL #545
+D7546	.FILL #546
+D7547	.FILL #547
+D7548	.FILL #548
+D7549	.FILL #549
+D7550	.FILL #550
+D7551	.FILL #551
+D7552	.FILL #552
+D7553	.FILL #553
+D7554	.FILL #554
+D7555	.FILL #555
+D7556	.FILL #556
+D7557	.FILL #557
+D7558	.FILL #558
+D7559	.FILL #559
+D7560	.FILL #560
+D7561	.FILL #561
+D7562	.FILL #562
+D7563	.FILL #563
+D7564	.FILL #564
+D7565	.FILL #565
+D7566	.FILL #566
+D7567	.FILL #567
+D7568	.FILL #568
+D7569	.FILL #569
+D7570	.FILL #570
+D7571	.FILL #571
+D7572	.FILL #572
+D7573	.FILL #573
+D7574	.FILL #574
+D7575	.FILL #575
+D7576	.FILL #576
+D7577	.FILL #577
+D7578	.FILL #578
+D7579	.FILL #579
+D7580	.FILL #580
+D7581	.FILL #581
+D7582	.FILL #582
+D7583	.FILL #583
+D7584	.FILL #584
+D7585	.FILL #585
+D7586	.FILL #586
+D7587	.FILL #587
+D7588	.FILL #588
+D7589	.FILL #589
+D7590	.FILL #590
+D7591	.FILL #591
+D7592	.FILL #592
+D7593	.FILL #593
+D7594	.FILL #594
+D7595	.FILL #595
+D7596	.FILL #596
+D7597	.FILL #597
+D7598	.FILL #598
+D7599	.FILL #599
+D7600	.FILL #600
+D7601	.FILL #601
+D7602	.FILL #602
+D7603	.FILL #603
+D7604	.FILL #604
+D7605	.FILL #605
+D7606	.FILL #606
+D7607	.FILL #607
+D7608	.FILL #608
+D7609	.FILL #609
+D7610	.FILL #610
+D7611	.FILL #611
+D7612	.FILL #612
+D7613	.FILL #613
+D7614	.FILL #614
+D7615	.FILL #615
+D7616	.FILL #616
+D7617	.FILL #617
+D7618	.FILL #618
+D7619	.FILL #619
+D7620	.FILL #620
+D7621	.FILL #621
+D7622	.FILL #622
+D7623	.FILL #623
+D7624	.FILL #624
+D7625	.FILL #625
+D7626	.FILL #626
+D7627	.FILL #627
+D7628	.FILL #628
+D7629	.FILL #629
+D7630	.FILL #630
+D7631	.FILL #631
+D7632	.FILL #632
+D7633	.FILL #633
+D7634	.FILL #634
+D7635	.FILL #635
+D7636	.FILL #636
+D7637	.FILL #637
+D7638	.FILL #638
+D7639	.FILL #639
+D7640	.FILL #640
+D7641	.FILL #641
+D7642	.FILL #642
+D7643	.FILL #643
+D7644	.FILL #644
+D7645	.FILL #645
+D7646	.FILL #646
+D7647	.FILL #647
+D7648	.FILL #648
+D7649	.FILL #649
+D7650	.FILL #650
+D7651	.FILL #651
+D7652	.FILL #652
+D7653	.FILL #653
+D7654	.FILL #654
+D7655	.FILL #655
+D7656	.FILL #656
+D7657	.FILL #657
+D7658	.FILL #658
+D7659	.FILL #659
+D7660	.FILL #660
+D7661	.FILL #661
+D7662	.FILL #662
+D7663	.FILL #663
+D7664	.FILL #664
+D7665	.FILL #665
+D7666	.FILL #666
+D7667	.FILL #667
+D7668	.FILL #668
+D7669	.FILL #669
+D7670	.FILL #670
+D7671	.FILL #671
+D7672	.FILL #672
+D7673	.FILL #673
+D7674	.FILL #674
+D7675	.FILL #675
+D7676	.FILL #676
+D7677	.FILL #677
+D7678	.FILL #678
+D7679	.FILL #679
+D7680	.FILL #680
+D7681	.FILL #681
+D7682	.FILL #682
+D7683	.FILL #683
+D7684	.FILL #684
+D7685	.FILL #685
+D7686	.FILL #686
+D7687	.FILL #687
+D7688	.FILL #688
+D7689	.FILL #689
+D7690	.FILL #690
+D7691	.FILL #691
+D7692	.FILL #692
+D7693	.FILL #693
+D7694	.FILL #694
+D7695	.FILL #695
+D7696	.FILL #696
+D7697	.FILL #697
+D7698	.FILL #698
+D7699	.FILL #699
+D7700	.FILL #700
+D7701	.FILL #701
+D7702	.FILL #702
+D7703	.FILL #703
+D7704	.FILL #704
+D7705	.FILL #705
+D7706	.FILL #706
+D7707	.FILL #707
+D7708	.FILL #708
+D7709	.FILL #709
+D7710	.FILL #710
+D7711	.FILL #711
+D7712	.FILL #712
+D7713	.FILL #713
+D7714	.FILL #714
+D7715	.FILL #715
+D7716	.FILL #716
+D7717	.FILL #717
+D7718	.FILL #718
+D7719	.FILL #719
+D7720	.FILL #720
+D7721	.FILL #721
+D7722	.FILL #722
+D7723	.FILL #723
+D7724	.FILL #724
+D7725	.FILL #725
+D7726	.FILL #726
+D7727	.FILL #727
+D7728	.FILL #728
+D7729	.FILL #729
+D7730	.FILL #730
+D7731	.FILL #731
+D7732	.FILL #732
+D7733	.FILL #733
+D7734	.FILL #734
+D7735	.FILL #735
+D7736	.FILL #736
+D7737	.FILL #737
+D7738	.FILL #738
+D7739	.FILL #739
+D7740	.FILL #740
+D7741	.FILL #741
+D7742	.FILL #742
+D7743	.FILL #743
+D7744	.FILL #744
+D7745	.FILL #745
+D7746	.FILL #746
+D7747	.FILL #747
+D7748	.FILL #748
+D7749	.FILL #749
+D7750	.FILL #750
+D7751	.FILL #751
+D7752	.FILL #752
+D7753	.FILL #753
+D7754	.FILL #754
+D7755	.FILL #755
+D7756	.FILL #756
+D7757	.FILL #757
+D7758	.FILL #758
+D7759	.FILL #759
+D7760	.FILL #760
+D7761	.FILL #761
+D7762	.FILL #762
+D7763	.FILL #763
+D7764	.FILL #764
+D7765	.FILL #765
+D7766	.FILL #766
+D7767	.FILL #767
+D7768	.FILL #768
+D7769	.FILL #769
+D7770	.FILL #770
+D7771	.FILL #771
+D7772	.FILL #772
+D7773	.FILL #773
+D7774	.FILL #774
+D7775	.FILL #775
+D7776	.FILL #776
+D7777	.FILL #777
+D7778	.FILL #778
+D7779	.FILL #779
+D7780	.FILL #780
+D7781	.FILL #781
+D7782	.FILL #782
+D7783	.FILL #783
+D7784	.FILL #784
+D7785	.FILL #785
+D7786	.FILL #786
+D7787	.FILL #787
+D7788	.FILL #788
+D7789	.FILL #789
+D7790	.FILL #790
+D7791	.FILL #791
+D7792	.FILL #792
+D7793	.FILL #793
+D7794	.FILL #794
+D7795	.FILL #795
+D7796	.FILL #796
+D7797	.FILL #797
+D7798	.FILL #798
+D7799	.FILL #799
+D7800	.FILL #800
+D7801	.FILL #801
+D7802	.FILL #802
+D7803	.FILL #803
+D7804	.FILL #804
+D7805	.FILL #805
+D7806	.FILL #806
+D7807	.FILL #807
+D7808	.FILL #808
+D7809	.FILL #809
+D7810	.FILL #810
+D7811	.FILL #811
+D7812	.FILL #812
+D7813	.FILL #813
+D7814	.FILL #814
+D7815	.FILL #815
+D7816	.FILL #816
+D7817	.FILL #817
+D7818	.FILL #818
+D7819	.FILL #819
+D7820	.FILL #820
+D7821	.FILL #821
+D7822	.FILL #822
+D7823	.FILL #823
+D7824	.FILL #824
+D7825	.FILL #825
+D7826	.FILL #826
+D7827	.FILL #827
+D7828	.FILL #828
+D7829	.FILL #829
+D7830	.FILL #830
+D7831	.FILL #831
+D7832	.FILL #832
+D7833	.FILL #833
+D7834	.FILL #834
+D7835	.FILL #835
+D7836	.FILL #836
+D7837	.FILL #837
+D7838	.FILL #838
+D7839	.FILL #839
+D7840	.FILL #840
+D7841	.FILL #841
+D7842	.FILL #842
+D7843	.FILL #843
+D7844	.FILL #844
+D7845	.FILL #845
+D7846	.FILL #846
+D7847	.FILL #847
+D7848	.FILL #848
+D7849	.FILL #849
+D7850	.FILL #850
+D7851	.FILL #851
+D7852	.FILL #852
+D7853	.FILL #853
+D7854	.FILL #854
+D7855	.FILL #855
+D7856	.FILL #856
+D7857	.FILL #857
+D7858	.FILL #858
+D7859	.FILL #859
+D7860	.FILL #860
+D7861	.FILL #861
+D7862	.FILL #862
+D7863	.FILL #863
+D7864	.FILL #864
+D7865	.FILL #865
+D7866	.FILL #866
+D7867	.FILL #867
+D7868	.FILL #868
+D7869	.FILL #869
+D7870	.FILL #870
+D7871	.FILL #871
+D7872	.FILL #872
+D7873	.FILL #873
+D7874	.FILL #874
+D7875	.FILL #875
+D7876	.FILL #876
+D7877	.FILL #877
+D7878	.FILL #878
+D7879	.FILL #879
+D7880	.FILL #880
+D7881	.FILL #881
+D7882	.FILL #882
+D7883	.FILL #883
+D7884	.FILL #884
+D7885	.FILL #885
+D7886	.FILL #886
+D7887	.FILL #887
+D7888	.FILL #888
+D7889	.FILL #889
+D7890	.FILL #890
+D7891	.FILL #891
+D7892	.FILL #892
+D7893	.FILL #893
+D7894	.FILL #894
+D7895	.FILL #895
+D7896	.FILL #896
+D7897	.FILL #897
+D7898	.FILL #898
+D7899	.FILL #899
+D7900	.FILL #900
+D7901	.FILL #901
+D7902	.FILL #902
+D7903	.FILL #903
+D7904	.FILL #904
+D7905	.FILL #905
+D7906	.FILL #906
+D7907	.FILL #907
+D7908	.FILL #908
+D7909	.FILL #909
+D7910	.FILL #910
+D7911	.FILL #911
+D7912	.FILL #912
+D7913	.FILL #913
+D7914	.FILL #914
+D7915	.FILL #915
+D7916	.FILL #916
+D7917	.FILL #917
+D7918	.FILL #918
+D7919	.FILL #919
+D7920	.FILL #920
+D7921	.FILL #921
+D7922	.FILL #922
+D7923	.FILL #923
+D7924	.FILL #924
+D7925	.FILL #925
+D7926	.FILL #926
+D7927	.FILL #927
+D7928	.FILL #928
+D7929	.FILL #929
+D7930	.FILL #930
+D7931	.FILL #931
+D7932	.FILL #932
+D7933	.FILL #933
+D7934	.FILL #934
+D7935	.FILL #935
+D7936	.FILL #936
+D7937	.FILL #937
+D7938	.FILL #938
+D7939	.FILL #939
+D7940	.FILL #940
+D7941	.FILL #941
+D7942	.FILL #942
+D7943	.FILL #943
+D7944	.FILL #944
+D7945	.FILL #945
+D7946	.FILL #946
+D7947	.FILL #947
+D7948	.FILL #948
+D7949	.FILL #949
+D7950	.FILL #950
+D7951	.FILL #951
+D7952	.FILL #952
+D7953	.FILL #953
+D7954	.FILL #954
+D7955	.FILL #955
+D7956	.FILL #956
+D7957	.FILL #957
+D7958	.FILL #958
+D7959	.FILL #959
+D7960	.FILL #960
+D7961	.FILL #961
+D7962	.FILL #962
+D7963	.FILL #963
+D7964	.FILL #964
+D7965	.FILL #965
+D7966	.FILL #966
+D7967	.FILL #967
+D7968	.FILL #968
+D7969	.FILL #969
+D7970	.FILL #970
+D7971	.FILL #971
+D7972	.FILL #972
+D7973	.FILL #973
+D7974	.FILL #974
+D7975	.FILL #975
+D7976	.FILL #976
+D7977	.FILL #977
+D7978	.FILL #978
+D7979	.FILL #979
+D7980	.FILL #980
+D7981	.FILL #981
+D7982	.FILL #982
+D7983	.FILL #983
+D7984	.FILL #984
+D7985	.FILL #985
+D7986	.FILL #986
+D7987	.FILL #987
+D7988	.FILL #988
+D7989	.FILL #989
+D7990	.FILL #990
+D7991	.FILL #991
+D7992	.FILL #992
+D7993	.FILL #993
+D7994	.FILL #994
+D7995	.FILL #995
+D7996	.FILL #996
+D7997	.FILL #997
+D7998	.FILL #998
+D7999	.FILL #999
+D8000	.FILL #0
+D8001	.FILL #1
+D8002	.FILL #2
+D8003	.FILL #3
+D8004	.FILL #4
+D8005	.FILL #5
+D8006	.FILL #6
+D8007	.FILL #7
+D8008	.FILL #8
+D8009	.FILL #9
+D8010	.FILL #10
+D8011	.FILL #11
+D8012	.FILL #12
+D8013	.FILL #13
+D8014	.FILL #14
+D8015	.FILL #15
+D8016	.FILL #16
+D8017	.FILL #17
+D8018	.FILL #18
+D8019	.FILL #19
+D8020	.FILL #20
+D8021	.FILL #21
+D8022	.FILL #22
+D8023	.FILL #23
+D8024	.FILL #24
+D8025	.FILL #25
+D8026	.FILL #26
+D8027	.FILL #27
+D8028	.FILL #28
+D8029	.FILL #29
+D8030	.FILL #30
+D8031	.FILL #31
+D8032	.FILL #32
+D8033	.FILL #33
+D8034	.FILL #34
+D8035	.FILL #35
+D8036	.FILL #36
+D8037	.FILL #37
+D8038	.FILL #38
+D8039	.FILL #39
+D8040	.FILL #40
+D8041	.FILL #41
+D8042	.FILL #42
+D8043	.FILL #43
+D8044	.FILL #44
+D8045	.FILL #45
+D8046	.FILL #46
+D8047	.FILL #47
+D8048	.FILL #48
+D8049	.FILL #49
+D8050	.FILL #50
+D8051	.FILL #51
+D8052	.FILL #52
+D8053	.FILL #53
+D8054	.FILL #54
+D8055	.FILL #55
+D8056	.FILL #56
+D8057	.FILL #57
+D8058	.FILL #58
+D8059	.FILL #59
+D8060	.FILL #60
+D8061	.FILL #61
+D8062	.FILL #62
+D8063	.FILL #63
+D8064	.FILL #64
+D8065	.FILL #65
+D8066	.FILL #66
+D8067	.FILL #67
+D8068	.FILL #68
+D8069	.FILL #69
+D8070	.FILL #70
+D8071	.FILL #71
+D8072	.FILL #72
+D8073	.FILL #73
+D8074	.FILL #74
+D8075	.FILL #75
+D8076	.FILL #76
+D8077	.FILL #77
+D8078	.FILL #78
+D8079	.FILL #79
+D8080	.FILL #80
+D8081	.FILL #81
+D8082	.FILL #82
+D8083	.FILL #83
+D8084	.FILL #84
+D8085	.FILL #85
+D8086	.FILL #86
+D8087	.FILL #87
+D8088	.FILL #88
+D8089	.FILL #89
+D8090	.FILL #90
+D8091	.FILL #91
+D8092	.FILL #92
+D8093	.FILL #93
+D8094	.FILL #94
+D8095	.FILL #95
+D8096	.FILL #96
+D8097	.FILL #97
+D8098	.FILL #98
+D8099	.FILL #99
+D8100	.FILL #100
+D8101	.FILL #101
+D8102	.FILL #102
+D8103	.FILL #103
+D8104	.FILL #104
+D8105	.FILL #105
+D8106	.FILL #106
+D8107	.FILL #107
+D8108	.FILL #108
+D8109	.FILL #109
+D8110	.FILL #110
+D8111	.FILL #111
+D8112	.FILL #112
+D8113	.FILL #113
+D8114	.FILL #114
+D8115	.FILL #115
+D8116	.FILL #116
+D8117	.FILL #117
+D8118	.FILL #118
+D8119	.FILL #119
+D8120	.FILL #120
+D8121	.FILL #121
+D8122	.FILL #122
+D8123	.FILL #123
+D8124	.FILL #124
+D8125	.FILL #125
+D8126	.FILL #126
+D8127	.FILL #127
+D8128	.FILL #128
+D8129	.FILL #129
+D8130	.FILL #130
+D8131	.FILL #131
+D8132	.FILL #132
+D8133	.FILL #133
+D8134	.FILL #134
+D8135	.FILL #135
+D8136	.FILL #136
+D8137	.FILL #137
+D8138	.FILL #138
+D8139	.FILL #139
+D8140	.FILL #140
+D8141	.FILL #141
+D8142	.FILL #142
+D8143	.FILL #143
+D8144	.FILL #144
+D8145	.FILL #145
+D8146	.FILL #146
+D8147	.FILL #147
+D8148	.FILL #148
+D8149	.FILL #149
+D8150	.FILL #150
+D8151	.FILL #151
+D8152	.FILL #152
+D8153	.FILL #153
+D8154	.FILL #154
+D8155	.FILL #155
+D8156	.FILL #156
+D8157	.FILL #157
+D8158	.FILL #158
+D8159	.FILL #159
+D8160	.FILL #160
+D8161	.FILL #161
+D8162	.FILL #162
+D8163	.FILL #163
+D8164	.FILL #164
+D8165	.FILL #165
+D8166	.FILL #166
+D8167	.FILL #167
+D8168	.FILL #168
+D8169	.FILL #169
+D8170	.FILL #170
+D8171	.FILL #171
+D8172	.FILL #172
+D8173	.FILL #173
+D8174	.FILL #174
+D8175	.FILL #175
+D8176	.FILL #176
+D8177	.FILL #177
+D8178	.FILL #178
+D8179	.FILL #179
+D8180	.FILL #180
+D8181	.FILL #181
+D8182	.FILL #182
+D8183	.FILL #183
+D8184	.FILL #184
+D8185	.FILL #185
+D8186	.FILL #186
+D8187	.FILL #187
+D8188	.FILL #188
+D8189	.FILL #189
+D8190	.FILL #190
+D8191	.FILL #191
+D8192	.FILL #192
+D8193	.FILL #193
+D8194	.FILL #194
+D8195	.FILL #195
+D8196	.FILL #196
+D8197	.FILL #197
+D8198	.FILL #198
+D8199	.FILL #199
+D8200	.FILL #200
+D8201	.FILL #201
+D8202	.FILL #202
+D8203	.FILL #203
+D8204	.FILL #204
+D8205	.FILL #205
+D8206	.FILL #206
+D8207	.FILL #207
+D8208	.FILL #208
+D8209	.FILL #209
+D8210	.FILL #210
+D8211	.FILL #211
+D8212	.FILL #212
+D8213	.FILL #213
+D8214	.FILL #214
+D8215	.FILL #215
+D8216	.FILL #216
+D8217	.FILL #217
+D8218	.FILL #218
+D8219	.FILL #219
+D8220	.FILL #220
+D8221	.FILL #221
+D8222	.FILL #222
+D8223	.FILL #223
+D8224	.FILL #224
+D8225	.FILL #225
+D8226	.FILL #226
+D8227	.FILL #227
+D8228	.FILL #228
+D8229	.FILL #229
+D8230	.FILL #230
+D8231	.FILL #231
+D8232	.FILL #232
+D8233	.FILL #233
+D8234	.FILL #234
+D8235	.FILL #235
+D8236	.FILL #236
+D8237	.FILL #237
+D8238	.FILL #238
+D8239	.FILL #239
+D8240	.FILL #240
+D8241	.FILL #241
+D8242	.FILL #242
+D8243	.FILL #243
+D8244	.FILL #244
+D8245	.FILL #245
+D8246	.FILL #246
+D8247	.FILL #247
+D8248	.FILL #248
+D8249	.FILL #249
+D8250	.FILL #250
+D8251	.FILL #251
+D8252	.FILL #252
+D8253	.FILL #253
+D8254	.FILL #254
+D8255	.FILL #255
+D8256	.FILL #256
+D8257	.FILL #257
+D8258	.FILL #258
+D8259	.FILL #259
+D8260	.FILL #260
+D8261	.FILL #261
+D8262	.FILL #262
+D8263	.FILL #263
+D8264	.FILL #264
+D8265	.FILL #265
+D8266	.FILL #266
+D8267	.FILL #267
+D8268	.FILL #268
+D8269	.FILL #269
+D8270	.FILL #270
+D8271	.FILL #271
+D8272	.FILL #272
+D8273	.FILL #273
+D8274	.FILL #274
+D8275	.FILL #275
+D8276	.FILL #276
+D8277	.FILL #277
+D8278	.FILL #278
+D8279	.FILL #279
+D8280	.FILL #280
+D8281	.FILL #281
+D8282	.FILL #282
+D8283	.FILL #283
+D8284	.FILL #284
+D8285	.FILL #285
+D8286	.FILL #286
+D8287	.FILL #287
+D8288	.FILL #288
+D8289	.FILL #289
+D8290	.FILL #290
+D8291	.FILL #291
+D8292	.FILL #292
+D8293	.FILL #293
+D8294	.FILL #294
+D8295	.FILL #295
+D8296	.FILL #296
+D8297	.FILL #297
+D8298	.FILL #298
+D8299	.FILL #299
+D8300	.FILL #300
+D8301	.FILL #301
+D8302	.FILL #302
+D8303	.FILL #303
+D8304	.FILL #304
+D8305	.FILL #305
+D8306	.FILL #306
+D8307	.FILL #307
+D8308	.FILL #308
+D8309	.FILL #309
+D8310	.FILL #310
+D8311	.FILL #311
+D8312	.FILL #312
+D8313	.FILL #313
+D8314	.FILL #314
+D8315	.FILL #315
+D8316	.FILL #316
+D8317	.FILL #317
+D8318	.FILL #318
+D8319	.FILL #319
+D8320	.FILL #320
+D8321	.FILL #321
+D8322	.FILL #322
+D8323	.FILL #323
+D8324	.FILL #324
+D8325	.FILL #325
+D8326	.FILL #326
+D8327	.FILL #327
+D8328	.FILL #328
+D8329	.FILL #329
+D8330	.FILL #330
+D8331	.FILL #331
+D8332	.FILL #332
+D8333	.FILL #333
+D8334	.FILL #334
+D8335	.FILL #335
+D8336	.FILL #336
+D8337	.FILL #337
+D8338	.FILL #338
+D8339	.FILL #339
+D8340	.FILL #340
+D8341	.FILL #341
+D8342	.FILL #342
+D8343	.FILL #343
+D8344	.FILL #344
+D8345	.FILL #345
+D8346	.FILL #346
+D8347	.FILL #347
+D8348	.FILL #348
+D8349	.FILL #349
+D8350	.FILL #350
+D8351	.FILL #351
+D8352	.FILL #352
+D8353	.FILL #353
+D8354	.FILL #354
+D8355	.FILL #355
+D8356	.FILL #356
+D8357	.FILL #357
+D8358	.FILL #358
+D8359	.FILL #359
+D8360	.FILL #360
+D8361	.FILL #361
+D8362	.FILL #362
+D8363	.FILL #363
+D8364	.FILL #364
+D8365	.FILL #365
+D8366	.FILL #366
+D8367	.FILL #367
+D8368	.FILL #368
+D8369	.FILL #369
+D8370	.FILL #370
+D8371	.FILL #371
+D8372	.FILL #372
+D8373	.FILL #373
+D8374	.FILL #374
+D8375	.FILL #375
+D8376	.FILL #376
+D8377	.FILL #377
+D8378	.FILL #378
+D8379	.FILL #379
+D8380	.FILL #380
+D8381	.FILL #381
+D8382	.FILL #382
+D8383	.FILL #383
+D8384	.FILL #384
+D8385	.FILL #385
+D8386	.FILL #386
+D8387	.FILL #387
+D8388	.FILL #388
+D8389	.FILL #389
+D8390	.FILL #390
+D8391	.FILL #391
+D8392	.FILL #392
+D8393	.FILL #393
+D8394	.FILL #394
+D8395	.FILL #395
+D8396	.FILL #396
+D8397	.FILL #397
+D8398	.FILL #398
+D8399	.FILL #399
+D8400	.FILL #400
+D8401	.FILL #401
+D8402	.FILL #402
+D8403	.FILL #403
+D8404	.FILL #404
+D8405	.FILL #405
+D8406	.FILL #406
+D8407	.FILL #407
+D8408	.FILL #408
+D8409	.FILL #409
+D8410	.FILL #410
+D8411	.FILL #411
+D8412	.FILL #412
+D8413	.FILL #413
+D8414	.FILL #414
+D8415	.FILL #415
+D8416	.FILL #416
+D8417	.FILL #417
+D8418	.FILL #418
+D8419	.FILL #419
+D8420	.FILL #420
+D8421	.FILL #421
+D8422	.FILL #422
+D8423	.FILL #423
+D8424	.FILL #424
+D8425	.FILL #425
+D8426	.FILL #426
+D8427	.FILL #427
+D8428	.FILL #428
+D8429	.FILL #429
+D8430	.FILL #430
+D8431	.FILL #431
+D8432	.FILL #432
+D8433	.FILL #433
+D8434	.FILL #434
+D8435	.FILL #435
+D8436	.FILL #436
+D8437	.FILL #437
+D8438	.FILL #438
+D8439	.FILL #439
+D8440	.FILL #440
+D8441	.FILL #441
+D8442	.FILL #442
+D8443	.FILL #443
+D8444	.FILL #444
+D8445	.FILL #445
+D8446	.FILL #446
+D8447	.FILL #447
+D8448	.FILL #448
+D8449	.FILL #449
+D8450	.FILL #450
+D8451	.FILL #451
+D8452	.FILL #452
+D8453	.FILL #453
+D8454	.FILL #454
+D8455	.FILL #455
+D8456	.FILL #456
+D8457	.FILL #457
+D8458	.FILL #458
+D8459	.FILL #459
+D8460	.FILL #460
+D8461	.FILL #461
+D8462	.FILL #462
+D8463	.FILL #463
+D8464	.FILL #464
+D8465	.FILL #465
+D8466	.FILL #466
+D8467	.FILL #467
+D8468	.FILL #468
+D8469	.FILL #469
+D8470	.FILL #470
+D8471	.FILL #471
+D8472	.FILL #472
+D8473	.FILL #473
+D8474	.FILL #474
+D8475	.FILL #475
+D8476	.FILL #476
+D8477	.FILL #477
+D8478	.FILL #478
+D8479	.FILL #479
+D8480	.FILL #480
+D8481	.FILL #481
+D8482	.FILL #482
+D8483	.FILL #483
+D8484	.FILL #484
+D8485	.FILL #485
+D8486	.FILL #486
+D8487	.FILL #487
+D8488	.FILL #488
+D8489	.FILL #489
+D8490	.FILL #490
+D8491	.FILL #491
+D8492	.FILL #492
+D8493	.FILL #493
+D8494	.FILL #494
+D8495	.FILL #495
+D8496	.FILL #496
+D8497	.FILL #497
+D8498	.FILL #498
+D8499	.FILL #499
+D8500	.FILL #500
+D8501	.FILL #501
+D8502	.FILL #502
+D8503	.FILL #503
+D8504	.FILL #504
+D8505	.FILL #505
+D8506	.FILL #506
+D8507	.FILL #507
+D8508	.FILL #508
+D8509	.FILL #509
+D8510	.FILL #510
+D8511	.FILL #511
+D8512	.FILL #512
+D8513	.FILL #513
+D8514	.FILL #514
+D8515	.FILL #515
+D8516	.FILL #516
+D8517	.FILL #517
+D8518	.FILL #518
+D8519	.FILL #519
+D8520	.FILL #520
+D8521	.FILL #521
+D8522	.FILL #522
+D8523	.FILL #523
+D8524	.FILL #524
+D8525	.FILL #525
+D8526	.FILL #526
+D8527	.FILL #527
+D8528	.FILL #528
+D8529	.FILL #529
+D8530	.FILL #530
+D8531	.FILL #531
+D8532	.FILL #532
+D8533	.FILL #533
+D8534	.FILL #534
+D8535	.FILL #535
+D8536	.FILL #536
+D8537	.FILL #537
+D8538	.FILL #538
+D8539	.FILL #539
+D8540	.FILL #540
+D8541	.FILL #541
+D8542	.FILL #542
+D8543	.FILL #543
+D8544	.FILL #544
+D8545	.FILL #545
+D8546	.FILL #546
+D8547	.FILL #547
+D8548	.FILL #548
+D8549	.FILL #549
+D8550	.FILL #550
+D8551	.FILL #551
+D8552	.FILL #552
+D8553	.FILL #553
+D8554	.FILL #554
+D8555	.FILL #555
+D8556	.FILL #556
+D8557	.FILL #557
+D8558	.FILL #558
+D8559	.FILL #559
+D8560	.FILL #560
+D8561	.FILL #561
+D8562	.FILL #562
+D8563	.FILL #563
+D8564	.FILL #564
+D8565	.FILL #565
+D8566	.FILL #566
+D8567	.FILL #567
+D8568	.FILL #568
+D8569	.FILL #569
+D8570	.FILL #570
+D8571	.FILL #571
+D8572	.FILL #572
+D8573	.FILL #573
+D8574	.FILL #574
+D8575	.FILL #575
+D8576	.FILL #576
+D8577	.FILL #577
+D8578	.FILL #578
+D8579	.FILL #579
+D8580	.FILL #580
+D8581	.FILL #581
+D8582	.FILL #582
+D8583	.FILL #583
+D8584	.FILL #584
+D8585	.FILL #585
+D8586	.FILL #586
+D8587	.FILL #587
+D8588	.FILL #588
+D8589	.FILL #589
+D8590	.FILL #590
+D8591	.FILL #591
+D8592	.FILL #592
+D8593	.FILL #593
+D8594	.FILL #594
+D8595	.FILL #595
+D8596	.FILL #596
+D8597	.FILL #597
+D8598	.FILL #598
+D8599	.FILL #599
+D8600	.FILL #600
+D8601	.FILL #601
+D8602	.FILL #602
+D8603	.FILL #603
+D8604	.FILL #604
+D8605	.FILL #605
+D8606	.FILL #606
+D8607	.FILL #607
+D8608	.FILL #608
+D8609	.FILL #609
+D8610	.FILL #610
+D8611	.FILL #611
+D8612	.FILL #612
+D8613	.FILL #613
+D8614	.FILL #614
+D8615	.FILL #615
+D8616	.FILL #616
+D8617	.FILL #617
+D8618	.FILL #618
+D8619	.FILL #619
+D8620	.FILL #620
+D8621	.FILL #621
+D8622	.FILL #622
+D8623	.FILL #623
+D8624	.FILL #624
+D8625	.FILL #625
+D8626	.FILL #626
+D8627	.FILL #627
+D8628	.FILL #628
+D8629	.FILL #629
+D8630	.FILL #630
+D8631	.FILL #631
+D8632	.FILL #632
+D8633	.FILL #633
+D8634	.FILL #634
+D8635	.FILL #635
+D8636	.FILL #636
+D8637	.FILL #637
+D8638	.FILL #638
+D8639	.FILL #639
+D8640	.FILL #640
+D8641	.FILL #641
+D8642	.FILL #642
+D8643	.FILL #643
+D8644	.FILL #644
+D8645	.FILL #645
+D8646	.FILL #646
+D8647	.FILL #647
+D8648	.FILL #648
+D8649	.FILL #649
+D8650	.FILL #650
+D8651	.FILL #651
+D8652	.FILL #652
+D8653	.FILL #653
+D8654	.FILL #654
+D8655	.FILL #655
+D8656	.FILL #656
+D8657	.FILL #657
+D8658	.FILL #658
+D8659	.FILL #659
+D8660	.FILL #660
+D8661	.FILL #661
+D8662	.FILL #662
+D8663	.FILL #663
+D8664	.FILL #664
+D8665	.FILL #665
+D8666	.FILL #666
+D8667	.FILL #667
+D8668	.FILL #668
+D8669	.FILL #669
+D8670	.FILL #670
+D8671	.FILL #671
+D8672	.FILL #672
+D8673	.FILL #673
+D8674	.FILL #674
+D8675	.FILL #675
+D8676	.FILL #676
+D8677	.FILL #677
+D8678	.FILL #678
+D8679	.FILL #679
+D8680	.FILL #680
+D8681	.FILL #681
+D8682	.FILL #682
+D8683	.FILL #683
+D8684	.FILL #684
+D8685	.FILL #685
+D8686	.FILL #686
+D8687	.FILL #687
+D8688	.FILL #688
+D8689	.FILL #689
+D8690	.FILL #690
+D8691	.FILL #691
+D8692	.FILL #692
+D8693	.FILL #693
+D8694	.FILL #694
+D8695	.FILL #695
+D8696	.FILL #696
+D8697	.FILL #697
+D8698	.FILL #698
+D8699	.FILL #699
+D8700	.FILL #700
+D8701	.FILL #701
+D8702	.FILL #702
+D8703	.FILL #703
+D8704	.FILL #704
+D8705	.FILL #705
+D8706	.FILL #706
+D8707	.FILL #707
+D8708	.FILL #708
+D8709	.FILL #709
+D8710	.FILL #710
+D8711	.FILL #711
+D8712	.FILL #712
+D8713	.FILL #713
+D8714	.FILL #714
+D8715	.FILL #715
+D8716	.FILL #716
+D8717	.FILL #717
+D8718	.FILL #718
+D8719	.FILL #719
+D8720	.FILL #720
+D8721	.FILL #721
+D8722	.FILL #722
+D8723	.FILL #723
+D8724	.FILL #724
+D8725	.FILL #725
+D8726	.FILL #726
+D8727	.FILL #727
+D8728	.FILL #728
+D8729	.FILL #729
+D8730	.FILL #730
+D8731	.FILL #731
+D8732	.FILL #732
+D8733	.FILL #733
+D8734	.FILL #734
+D8735	.FILL #735
+D8736	.FILL #736
+D8737	.FILL #737
+D8738	.FILL #738
+D8739	.FILL #739
+D8740	.FILL #740
+D8741	.FILL #741
+D8742	.FILL #742
+D8743	.FILL #743
+D8744	.FILL #744
+D8745	.FILL #745
+D8746	.FILL #746
+D8747	.FILL #747
+D8748	.FILL #748
+D8749	.FILL #749
+D8750	.FILL #750
+D8751	.FILL #751
+D8752	.FILL #752
+D8753	.FILL #753
+D8754	.FILL #754
+D8755	.FILL #755
+D8756	.FILL #756
+D8757	.FILL #757
+D8758	.FILL #758
+D8759	.FILL #759
+D8760	.FILL #760
+D8761	.FILL #761
+D8762	.FILL #762
+D8763	.FILL #763
+D8764	.FILL #764
+D8765	.FILL #765
+D8766	.FILL #766
+D8767	.FILL #767
+D8768	.FILL #768
+D8769	.FILL #769
+D8770	.FILL #770
+D8771	.FILL #771
+D8772	.FILL #772
+D8773	.FILL #773
+D8774	.FILL #774
+D8775	.FILL #775
+D8776	.FILL #776
+D8777	.FILL #777
+D8778	.FILL #778
+D8779	.FILL #779
+D8780	.FILL #780
+D8781	.FILL #781
+D8782	.FILL #782
+D8783	.FILL #783
+D8784	.FILL #784
+D8785	.FILL #785
+D8786	.FILL #786
+D8787	.FILL #787
+D8788	.FILL #788
+D8789	.FILL #789
+D8790	.FILL #790
+D8791	.FILL #791
+D8792	.FILL #792
+D8793	.FILL #793
+D8794	.FILL #794
+D8795	.FILL #795
+D8796	.FILL #796
+D8797	.FILL #797
+D8798	.FILL #798
+D8799	.FILL #799
+D8800	.FILL #800
+D8801	.FILL #801
+D8802	.FILL #802
+D8803	.FILL #803
+D8804	.FILL #804
+D8805	.FILL #805
+D8806	.FILL #806
+D8807	.FILL #807
+D8808	.FILL #808
+D8809	.FILL #809
+D8810	.FILL #810
+D8811	.FILL #811
+D8812	.FILL #812
+D8813	.FILL #813
+D8814	.FILL #814
+D8815	.FILL #815
+D8816	.FILL #816
+D8817	.FILL #817
+D8818	.FILL #818
+D8819	.FILL #819
+D8820	.FILL #820
+D8821	.FILL #821
+D8822	.FILL #822
+D8823	.FILL #823
+D8824	.FILL #824
+D8825	.FILL #825
+D8826	.FILL #826
+D8827	.FILL #827
+D8828	.FILL #828
+D8829	.FILL #829
+D8830	.FILL #830
+D8831	.FILL #831
+D8832	.FILL #832
+D8833	.FILL #833
+D8834	.FILL #834
+D8835	.FILL #835
+D8836	.FILL #836
+D8837	.FILL #837
+D8838	.FILL #838
+D8839	.FILL #839
+D8840	.FILL #840
+D8841	.FILL #841
+D8842	.FILL #842
+D8843	.FILL #843
+D8844	.FILL #844
+D8845	.FILL #845
+D8846	.FILL #846
+D8847	.FILL #847
+D8848	.FILL #848
+D8849	.FILL #849
+D8850	.FILL #850
+D8851	.FILL #851
+D8852	.FILL #852
+D8853	.FILL #853
+D8854	.FILL #854
+D8855	.FILL #855
+D8856	.FILL #856
+D8857	.FILL #857
+D8858	.FILL #858
+D8859	.FILL #859
+D8860	.FILL #860
+D8861	.FILL #861
+D8862	.FILL #862
+D8863	.FILL #863
+D8864	.FILL #864
+D8865	.FILL #865
+D8866	.FILL #866
+D8867	.FILL #867
+D8868	.FILL #868
+D8869	.FILL #869
+D8870	.FILL #870
+D8871	.FILL #871
+D8872	.FILL #872
+D8873	.FILL #873
+D8874	.FILL #874
+D8875	.FILL #875
+D8876	.FILL #876
+D8877	.FILL #877
+D8878	.FILL #878
+D8879	.FILL #879
+D8880	.FILL #880
+D8881	.FILL #881
+D8882	.FILL #882
+D8883	.FILL #883
+D8884	.FILL #884
+D8885	.FILL #885
+D8886	.FILL #886
+D8887	.FILL #887
+D8888	.FILL #888
+D8889	.FILL #889
+D8890	.FILL #890
+D8891	.FILL #891
+D8892	.FILL #892
+D8893	.FILL #893
+D8894	.FILL #894
+D8895	.FILL #895
+D8896	.FILL #896
+D8897	.FILL #897
+D8898	.FILL #898
+D8899	.FILL #899
+D8900	.FILL #900
+D8901	.FILL #901
+D8902	.FILL #902
+D8903	.FILL #903
+D8904	.FILL #904
+D8905	.FILL #905
+D8906	.FILL #906
+D8907	.FILL #907
+D8908	.FILL #908
+D8909	.FILL #909
+D8910	.FILL #910
+D8911	.FILL #911
+D8912	.FILL #912
+D8913	.FILL #913
+D8914	.FILL #914
+D8915	.FILL #915
+D8916	.FILL #916
+D8917	.FILL #917
+D8918	.FILL #918
+D8919	.FILL #919
+D8920	.FILL #920
+D8921	.FILL #921
+D8922	.FILL #922
+D8923	.FILL #923
+D8924	.FILL #924
+D8925	.FILL #925
+D8926	.FILL #926
+D8927	.FILL #927
+D8928	.FILL #928
+D8929	.FILL #929
+D8930	.FILL #930
+D8931	.FILL #931
+D8932	.FILL #932
+D8933	.FILL #933
+D8934	.FILL #934
+D8935	.FILL #935
+D8936	.FILL #936
+D8937	.FILL #937
+D8938	.FILL #938
+D8939	.FILL #939
+D8940	.FILL #940
+D8941	.FILL #941
+D8942	.FILL #942
+D8943	.FILL #943
+D8944	.FILL #944
+D8945	.FILL #945
+D8946	.FILL #946
+D8947	.FILL #947
+D8948	.FILL #948
+D8949	.FILL #949
+D8950	.FILL #950
+D8951	.FILL #951
+D8952	.FILL #952
+D8953	.FILL #953
+D8954	.FILL #954
+D8955	.FILL #955
+D8956	.FILL #956
+D8957	.FILL #957
+D8958	.FILL #958
+D8959	.FILL #959
+D8960	.FILL #960
+D8961	.FILL #961
+D8962	.FILL #962
+D8963	.FILL #963
+D8964	.FILL #964
+D8965	.FILL #965
+D8966	.FILL #966
+D8967	.FILL #967
+D8968	.FILL #968
+D8969	.FILL #969
+D8970	.FILL #970
+D8971	.FILL #971
+D8972	.FILL #972
+D8973	.FILL #973
+D8974	.FILL #974
+D8975	.FILL #975
+D8976	.FILL #976
+D8977	.FILL #977
+D8978	.FILL #978
+D8979	.FILL #979
+D8980	.FILL #980
+D8981	.FILL #981
+D8982	.FILL #982
+D8983	.FILL #983
+D8984	.FILL #984
+D8985	.FILL #985
+D8986	.FILL #986
+D8987	.FILL #987
+D8988	.FILL #988
+D8989	.FILL #989
+D8990	.FILL #990
+D8991	.FILL #991
+D8992	.FILL #992
+D8993	.FILL #993
+D8994	.FILL #994
+D8995	.FILL #995
+D8996	.FILL #996
+D8997	.FILL #997
+D8998	.FILL #998
+D8999	.FILL #999
+D9000	.FILL #0
+D9001	.FILL #1
+D9002	.FILL #2
+D9003	.FILL #3
+D9004	.FILL #4
+D9005	.FILL #5
+D9006	.FILL #6
+D9007	.FILL #7
+D9008	.FILL #8
+D9009	.FILL #9
+D9010	.FILL #10
+D9011	.FILL #11
+D9012	.FILL #12
+D9013	.FILL #13
+D9014	.FILL #14
+D9015	.FILL #15
+D9016	.FILL #16
+D9017	.FILL #17
+D9018	.FILL #18
+D9019	.FILL #19
+D9020	.FILL #20
+D9021	.FILL #21
+D9022	.FILL #22
+D9023	.FILL #23
+D9024	.FILL #24
+D9025	.FILL #25
+D9026	.FILL #26
+D9027	.FILL #27
+D9028	.FILL #28
+D9029	.FILL #29
+D9030	.FILL #30
+D9031	.FILL #31
+D9032	.FILL #32
+D9033	.FILL #33
+D9034	.FILL #34
+D9035	.FILL #35
+D9036	.FILL #36
+D9037	.FILL #37
+D9038	.FILL #38
+D9039	.FILL #39
+D9040	.FILL #40
+D9041	.FILL #41
+D9042	.FILL #42
+D9043	.FILL #43
+D9044	.FILL #44
+D9045	.FILL #45
+D9046	.FILL #46
+D9047	.FILL #47
+D9048	.FILL #48
+D9049	.FILL #49
+D9050	.FILL #50
+D9051	.FILL #51
+D9052	.FILL #52
+D9053	.FILL #53
+D9054	.FILL #54
+D9055	.FILL #55
+D9056	.FILL #56
+D9057	.FILL #57
+D9058	.FILL #58
+D9059	.FILL #59
+D9060	.FILL #60
+D9061	.FILL #61
+D9062	.FILL #62
+D9063	.FILL #63
+D9064	.FILL #64
+D9065	.FILL #65
+D9066	.FILL #66
+D9067	.FILL #67
+D9068	.FILL #68
+D9069	.FILL #69
+D9070	.FILL #70
+D9071	.FILL #71
+D9072	.FILL #72
+D9073	.FILL #73
+D9074	.FILL #74
+D9075	.FILL #75
+D9076	.FILL #76
+D9077	.FILL #77
+D9078	.FILL #78
+D9079	.FILL #79
+D9080	.FILL #80
+D9081	.FILL #81
+D9082	.FILL #82
+D9083	.FILL #83
+D9084	.FILL #84
+D9085	.FILL #85
+D9086	.FILL #86
+D9087	.FILL #87
+D9088	.FILL #88
+D9089	.FILL #89
+D9090	.FILL #90
+D9091	.FILL #91
+D9092	.FILL #92
+D9093	.FILL #93
+D9094	.FILL #94
+D9095	.FILL #95
+D9096	.FILL #96
+D9097	.FILL #97
+D9098	.FILL #98
+D9099	.FILL #99
+D9100	.FILL #100
+D9101	.FILL #101
+D9102	.FILL #102
+D9103	.FILL #103
+D9104	.FILL #104
+D9105	.FILL #105
+D9106	.FILL #106
+D9107	.FILL #107
+D9108	.FILL #108
+D9109	.FILL #109
+D9110	.FILL #110
+D9111	.FILL #111
+D9112	.FILL #112
+D9113	.FILL #113
+D9114	.FILL #114
+D9115	.FILL #115
+D9116	.FILL #116
+D9117	.FILL #117
+D9118	.FILL #118
+D9119	.FILL #119
+D9120	.FILL #120
+D9121	.FILL #121
+D9122	.FILL #122
+D9123	.FILL #123
+D9124	.FILL #124
+D9125	.FILL #125
+D9126	.FILL #126
+D9127	.FILL #127
+D9128	.FILL #128
+D9129	.FILL #129
+D9130	.FILL #130
+D9131	.FILL #131
+D9132	.FILL #132
+D9133	.FILL #133
+D9134	.FILL #134
+D9135	.FILL #135
+D9136	.FILL #136
+D9137	.FILL #137
+D9138	.FILL #138
+D9139	.FILL #139
+D9140	.FILL #140
+D9141	.FILL #141
+D9142	.FILL #142
+D9143	.FILL #143
+D9144	.FILL #144
+D9145	.FILL #145
+D9146	.FILL #146
+D9147	.FILL #147
+D9148	.FILL #148
+D9149	.FILL #149
+D9150	.FILL #150
+D9151	.FILL #151
+D9152	.FILL #152
+D9153	.FILL #153
+D9154	.FILL #154
+D9155	.FILL #155
+D9156	.FILL #156
+D9157	.FILL #157
+D9158	.FILL #158
+D9159	.FILL #159
+D9160	.FILL #160
+D9161	.FILL #161
+D9162	.FILL #162
+D9163	.FILL #163
+D9164	.FILL #164
+D9165	.FILL #165
+D9166	.FILL #166
+D9167	.FILL #167
+D9168	.FILL #168
+D9169	.FILL #169
+D9170	.FILL #170
+D9171	.FILL #171
+D9172	.FILL #172
+D9173	.FILL #173
+D9174	.FILL #174
+D9175	.FILL #175
+D9176	.FILL #176
+D9177	.FILL #177
+D9178	.FILL #178
+D9179	.FILL #179
+D9180	.FILL #180
+D9181	.FILL #181
+D9182	.FILL #182
+D9183	.FILL #183
+D9184	.FILL #184
+D9185	.FILL #185
+D9186	.FILL #186
+D9187	.FILL #187
+D9188	.FILL #188
+D9189	.FILL #189
+D9190	.FILL #190
+D9191	.FILL #191
+D9192	.FILL #192
+D9193	.FILL #193
+D9194	.FILL #194
+D9195	.FILL #195
+D9196	.FILL #196
+D9197	.FILL #197
+D9198	.FILL #198
+D9199	.FILL #199
+D9200	.FILL #200
+D9201	.FILL #201
+D9202	.FILL #202
+D9203	.FILL #203
+D9204	.FILL #204
+D9205	.FILL #205
+D9206	.FILL #206
+D9207	.FILL #207
+D9208	.FILL #208
+D9209	.FILL #209
+D9210	.FILL #210
+D9211	.FILL #211
+D9212	.FILL #212
+D9213	.FILL #213
+D9214	.FILL #214
+D9215	.FILL #215
+D9216	.FILL #216
+D9217	.FILL #217
+D9218	.FILL #218
+D9219	.FILL #219
+D9220	.FILL #220
+D9221	.FILL #221
+D9222	.FILL #222
+D9223	.FILL #223
+D9224	.FILL #224
+D9225	.FILL #225
+D9226	.FILL #226
+D9227	.FILL #227
+D9228	.FILL #228
+D9229	.FILL #229
+D9230	.FILL #230
+D9231	.FILL #231
+D9232	.FILL #232
+D9233	.FILL #233
+D9234	.FILL #234
+D9235	.FILL #235
+D9236	.FILL #236
+D9237	.FILL #237
+D9238	.FILL #238
+D9239	.FILL #239
+D9240	.FILL #240
+D9241	.FILL #241
+D9242	.FILL #242
+D9243	.FILL #243
+D9244	.FILL #244
+D9245	.FILL #245
+D9246	.FILL #246
+D9247	.FILL #247
+D9248	.FILL #248
+D9249	.FILL #249
+D9250	.FILL #250
+D9251	.FILL #251
+D9252	.FILL #252
+D9253	.FILL #253
+D9254	.FILL #254
+D9255	.FILL #255
+D9256	.FILL #256
+D9257	.FILL #257
+D9258	.FILL #258
+D9259	.FILL #259
+D9260	.FILL #260
+D9261	.FILL #261
+D9262	.FILL #262
+D9263	.FILL #263
+D9264	.FILL #264
+D9265	.FILL #265
+D9266	.FILL #266
+D9267	.FILL #267
+D9268	.FILL #268
+D9269	.FILL #269
+D9270	.FILL #270
+D9271	.FILL #271
+D9272	.FILL #272
+D9273	.FILL #273
+D9274	.FILL #274
+D9275	.FILL #275
+D9276	.FILL #276
+D9277	.FILL #277
+D9278	.FILL #278
+D9279	.FILL #279
+D9280	.FILL #280
+D9281	.FILL #281
+D9282	.FILL #282
+D9283	.FILL #283
+D9284	.FILL #284
+D9285	.FILL #285
+D9286	.FILL #286
+D9287	.FILL #287
+D9288	.FILL #288
+D9289	.FILL #289
+D9290	.FILL #290
+D9291	.FILL #291
+D9292	.FILL #292
+D9293	.FILL #293
+D9294	.FILL #294
+D9295	.FILL #295
+D9296	.FILL #296
+D9297	.FILL #297
+D9298	.FILL #298
+D9299	.FILL #299
+D9300	.FILL #300
+D9301	.FILL #301
+D9302	.FILL #302
+D9303	.FILL #303
+D9304	.FILL #304
+D9305	.FILL #305
+D9306	.FILL #306
+D9307	.FILL #307
+D9308	.FILL #308
+D9309	.FILL #309
+D9310	.FILL #310
+D9311	.FILL #311
+D9312	.FILL #312
+D9313	.FILL #313
+D9314	.FILL #314
+D9315	.FILL #315
+D9316	.FILL #316
+D9317	.FILL #317
+D9318	.FILL #318
+D9319	.FILL #319
+D9320	.FILL #320
+D9321	.FILL #321
+D9322	.FILL #322
+D9323	.FILL #323
+D9324	.FILL #324
+D9325	.FILL #325
+D9326	.FILL #326
+D9327	.FILL #327
+D9328	.FILL #328
+D9329	.FILL #329
+D9330	.FILL #330
+D9331	.FILL #331
+D9332	.FILL #332
+D9333	.FILL #333
+D9334	.FILL #334
+D9335	.FILL #335
+D9336	.FILL #336
+D9337	.FILL #337
+D9338	.FILL #338
+D9339	.FILL #339
+D9340	.FILL #340
+D9341	.FILL #341
+D9342	.FILL #342
+D9343	.FILL #343
+D9344	.FILL #344
+D9345	.FILL #345
+D9346	.FILL #346
+D9347	.FILL #347
+D9348	.FILL #348
+D9349	.FILL #349
+D9350	.FILL #350
+D9351	.FILL #351
+D9352	.FILL #352
+D9353	.FILL #353
+D9354	.FILL #354
+D9355	.FILL #355
+D9356	.FILL #356
+D9357	.FILL #357
+D9358	.FILL #358
+D9359	.FILL #359
+D9360	.FILL #360
+D9361	.FILL #361
+D9362	.FILL #362
+D9363	.FILL #363
+D9364	.FILL #364
+D9365	.FILL #365
+D9366	.FILL #366
+D9367	.FILL #367
+D9368	.FILL #368
+D9369	.FILL #369
+D9370	.FILL #370
+D9371	.FILL #371
+D9372	.FILL #372
+D9373	.FILL #373
+D9374	.FILL #374
+D9375	.FILL #375
+D9376	.FILL #376
+D9377	.FILL #377
+D9378	.FILL #378
+D9379	.FILL #379
+D9380	.FILL #380
+D9381	.FILL #381
+D9382	.FILL #382
+D9383	.FILL #383
+D9384	.FILL #384
+D9385	.FILL #385
+D9386	.FILL #386
+D9387	.FILL #387
+D9388	.FILL #388
+D9389	.FILL #389
+D9390	.FILL #390
+D9391	.FILL #391
+D9392	.FILL #392
+D9393	.FILL #393
+D9394	.FILL #394
+D9395	.FILL #395
+D9396	.FILL #396
+D9397	.FILL #397
+D9398	.FILL #398
+D9399	.FILL #399
+D9400	.FILL #400
+D9401	.FILL #401
+D9402	.FILL #402
+D9403	.FILL #403
+D9404	.FILL #404
+D9405	.FILL #405
+D9406	.FILL #406
+D9407	.FILL #407
+D9408	.FILL #408
+D9409	.FILL #409
+D9410	.FILL #410
+D9411	.FILL #411
+D9412	.FILL #412
+D9413	.FILL #413
+D9414	.FILL #414
+D9415	.FILL #415
+D9416	.FILL #416
+D9417	.FILL #417
+D9418	.FILL #418
+D9419	.FILL #419
+D9420	.FILL #420
+D9421	.FILL #421
+D9422	.FILL #422
+D9423	.FILL #423
+D9424	.FILL #424
+D9425	.FILL #425
+D9426	.FILL #426
+D9427	.FILL #427
+D9428	.FILL #428
+D9429	.FILL #429
+D9430	.FILL #430
+D9431	.FILL #431
+D9432	.FILL #432
+D9433	.FILL #433
+D9434	.FILL #434
+D9435	.FILL #435
+D9436	.FILL #436
+D9437	.FILL #437
+D9438	.FILL #438
+D9439	.FILL #439
+D9440	.FILL #440
+D9441	.FILL #441
+D9442	.FILL #442
+D9443	.FILL #443
+D9444	.FILL #444
+D9445	.FILL #445
+D9446	.FILL #446
+D9447	.FILL #447
+D9448	.FILL #448
+D9449	.FILL #449
+D9450	.FILL #450
+D9451	.FILL #451
+D9452	.FILL #452
+D9453	.FILL #453
+D9454	.FILL #454
+D9455	.FILL #455
+D9456	.FILL #456
+D9457	.FILL #457
+D9458	.FILL #458
+D9459	.FILL #459
+D9460	.FILL #460
+D9461	.FILL #461
+D9462	.FILL #462
+D9463	.FILL #463
+D9464	.FILL #464
+D9465	.FILL #465
+D9466	.FILL #466
+D9467	.FILL #467
+D9468	.FILL #468
+D9469	.FILL #469
+D9470	.FILL #470
+D9471	.FILL #471
+D9472	.FILL #472
+D9473	.FILL #473
+D9474	.FILL #474
+D9475	.FILL #475
+D9476	.FILL #476
+D9477	.FILL #477
+D9478	.FILL #478
+D9479	.FILL #479
+D9480	.FILL #480
+D9481	.FILL #481
+D9482	.FILL #482
+D9483	.FILL #483
+D9484	.FILL #484
+D9485	.FILL #485
+D9486	.FILL #486
+D9487	.FILL #487
+D9488	.FILL #488
+D9489	.FILL #489
+D9490	.FILL #490
+D9491	.FILL #491
+D9492	.FILL #492
+D9493	.FILL #493
+D9494	.FILL #494
+D9495	.FILL #495
+D9496	.FILL #496
+D9497	.FILL #497
+D9498	.FILL #498
+D9499	.FILL #499
+D9500	.FILL #500
+D9501	.FILL #501
+D9502	.FILL #502
+D9503	.FILL #503
+D9504	.FILL #504
+D9505	.FILL #505
+D9506	.FILL #506
+D9507	.FILL #507
+D9508	.FILL #508
+D9509	.FILL #509
+D9510	.FILL #510
+D9511	.FILL #511
+D9512	.FILL #512
+D9513	.FILL #513
+D9514	.FILL #514
+D9515	.FILL #515
+D9516	.FILL #516
+D9517	.FILL #517
+D9518	.FILL #518
+D9519	.FILL #519
+D9520	.FILL #520
+D9521	.FILL #521
+D9522	.FILL #522
+D9523	.FILL #523
+D9524	.FILL #524
+D9525	.FILL #525
+D9526	.FILL #526
+D9527	.FILL #527
+D9528	.FILL #528
+D9529	.FILL #529
+D9530	.FILL #530
+D9531	.FILL #531
+D9532	.FILL #532
+D9533	.FILL #533
+D9534	.FILL #534
+D9535	.FILL #535
+D9536	.FILL #536
+D9537	.FILL #537
+D9538	.FILL #538
+D9539	.FILL #539
+D9540	.FILL #540
+D9541	.FILL #541
+D9542	.FILL #542
+D9543	.FILL #543
+D9544	.FILL #544
+D9545	.FILL #545
+D9546	.FILL #546
+D9547	.FILL #547
+D9548	.FILL #548
+D9549	.FILL #549
+D9550	.FILL #550
+D9551	.FILL #551
+D9552	.FILL #552
+D9553	.FILL #553
+D9554	.FILL #554
+D9555	.FILL #555
+D9556	.FILL #556
+D9557	.FILL #557
+D9558	.FILL #558
+D9559	.FILL #559
+D9560	.FILL #560
+D9561	.FILL #561
+D9562	.FILL #562
+D9563	.FILL #563
+D9564	.FILL #564
+D9565	.FILL #565
+D9566	.FILL #566
+D9567	.FILL #567
+D9568	.FILL #568
+D9569	.FILL #569
+D9570	.FILL #570
+D9571	.FILL #571
+D9572	.FILL #572
+D9573	.FILL #573
+D9574	.FILL #574
+D9575	.FILL #575
+D9576	.FILL #576
+D9577	.FILL #577
+D9578	.FILL #578
+D9579	.FILL #579
+D9580	.FILL #580
+D9581	.FILL #581
+D9582	.FILL #582
+D9583	.FILL #583
+D9584	.FILL #584
+D9585	.FILL #585
+D9586	.FILL #586
+D9587	.FILL #587
+D9588	.FILL #588
+D9589	.FILL #589
+D9590	.FILL #590
+D9591	.FILL #591
+D9592	.FILL #592
+D9593	.FILL #593
+D9594	.FILL #594
+D9595	.FILL #595
+D9596	.FILL #596
+D9597	.FILL #597
+D9598	.FILL #598
+D9599	.FILL #599
+D9600	.FILL #600
+D9601	.FILL #601
+D9602	.FILL #602
+D9603	.FILL #603
+D9604	.FILL #604
+D9605	.FILL #605
+D9606	.FILL #606
+D9607	.FILL #607
+D9608	.FILL #608
+D9609	.FILL #609
+D9610	.FILL #610
+D9611	.FILL #611
+D9612	.FILL #612
+D9613	.FILL #613
+D9614	.FILL #614
+D9615	.FILL #615
+D9616	.FILL #616
+D9617	.FILL #617
+D9618	.FILL #618
+D9619	.FILL #619
+D9620	.FILL #620
+D9621	.FILL #621
+D9622	.FILL #622
+D9623	.FILL #623
+D9624	.FILL #624
+D9625	.FILL #625
+D9626	.FILL #626
+D9627	.FILL #627
+D9628	.FILL #628
+D9629	.FILL #629
+D9630	.FILL #630
+D9631	.FILL #631
+D9632	.FILL #632
+D9633	.FILL #633
+D9634	.FILL #634
+D9635	.FILL #635
+D9636	.FILL #636
+D9637	.FILL #637
+D9638	.FILL #638
+D9639	.FILL #639
+D9640	.FILL #640
+D9641	.FILL #641
+D9642	.FILL #642
+D9643	.FILL #643
+D9644	.FILL #644
+D9645	.FILL #645
+D9646	.FILL #646
+D9647	.FILL #647
+D9648	.FILL #648
+D9649	.FILL #649
+D9650	.FILL #650
+D9651	.FILL #651
+D9652	.FILL #652
+D9653	.FILL #653
+D9654	.FILL #654
+D9655	.FILL #655
+D9656	.FILL #656
+D9657	.FILL #657
+D9658	.FILL #658
+D9659	.FILL #659
+D9660	.FILL #660
+D9661	.FILL #661
+D9662	.FILL #662
+D9663	.FILL #663
+D9664	.FILL #664
+D9665	.FILL #665
+D9666	.FILL #666
+D9667	.FILL #667
+D9668	.FILL #668
+D9669	.FILL #669
+D9670	.FILL #670
+D9671	.FILL #671
+D9672	.FILL #672
+D9673	.FILL #673
+D9674	.FILL #674
+D9675	.FILL #675
+D9676	.FILL #676
+D9677	.FILL #677
+D9678	.FILL #678
+D9679	.FILL #679
+D9680	.FILL #680
+D9681	.FILL #681
+D9682	.FILL #682
+D9683	.FILL #683
+D9684	.FILL #684
+D9685	.FILL #685
+D9686	.FILL #686
+D9687	.FILL #687
+D9688	.FILL #688
+D9689	.FILL #689
+D9690	.FILL #690
+D9691	.FILL #691
+D9692	.FILL #692
+D9693	.FILL #693
+D9694	.FILL #694
+D9695	.FILL #695
+D9696	.FILL #696
+D9697	.FILL #697
+D9698	.FILL #698
+D9699	.FILL #699
+D9700	.FILL #700
+D9701	.FILL #701
+D9702	.FILL #702
+D9703	.FILL #703
+D9704	.FILL #704
+D9705	.FILL #705
+D9706	.FILL #706
+D9707	.FILL #707
+D9708	.FILL #708
+D9709	.FILL #709
+D9710	.FILL #710
+D9711	.FILL #711
+D9712	.FILL #712
+D9713	.FILL #713
+D9714	.FILL #714
+D9715	.FILL #715
+D9716	.FILL #716
+D9717	.FILL #717
+D9718	.FILL #718
+D9719	.FILL #719
+D9720	.FILL #720
+D9721	.FILL #721
+D9722	.FILL #722
+D9723	.FILL #723
+D9724	.FILL #724
+D9725	.FILL #725
+D9726	.FILL #726
+D9727	.FILL #727
+D9728	.FILL #728
+D9729	.FILL #729
+D9730	.FILL #730
+D9731	.FILL #731
+D9732	.FILL #732
+D9733	.FILL #733
+D9734	.FILL #734
+D9735	.FILL #735
+D9736	.FILL #736
+D9737	.FILL #737
+D9738	.FILL #738
+D9739	.FILL #739
+D9740	.FILL #740
+D9741	.FILL #741
+D9742	.FILL #742
+D9743	.FILL #743
+D9744	.FILL #744
+D9745	.FILL #745
+D9746	.FILL #746
+D9747	.FILL #747
+D9748	.FILL #748
+D9749	.FILL #749
+D9750	.FILL #750
+D9751	.FILL #751
+D9752	.FILL #752
+D9753	.FILL #753
+D9754	.FILL #754
+D9755	.FILL #755
+D9756	.FILL #756
+D9757	.FILL #757
+D9758	.FILL #758
+D9759	.FILL #759
+D9760	.FILL #760
+D9761	.FILL #761
+D9762	.FILL #762
+D9763	.FILL #763
+D9764	.FILL #764
+D9765	.FILL #765
+D9766	.FILL #766
+D9767	.FILL #767
+D9768	.FILL #768
+D9769	.FILL #769
+D9770	.FILL #770
+D9771	.FILL #771
+D9772	.FILL #772
+D9773	.FILL #773
+D9774	.FILL #774
+D9775	.FILL #775
+D9776	.FILL #776
+D9777	.FILL #777
+D9778	.FILL #778
+D9779	.FILL #779
+D9780	.FILL #780
+D9781	.FILL #781
+D9782	.FILL #782
+D9783	.FILL #783
+D9784	.FILL #784
+D9785	.FILL #785
+D9786	.FILL #786
+D9787	.FILL #787
+D9788	.FILL #788
+D9789	.FILL #789
+D9790	.FILL #790
+D9791	.FILL #791
+D9792	.FILL #792
+D9793	.FILL #793
+D9794	.FILL #794
+D9795	.FILL #795
+D9796	.FILL #796
+D9797	.FILL #797
+D9798	.FILL #798
+D9799	.FILL #799
+D9800	.FILL #800
+D9801	.FILL #801
+D9802	.FILL #802
+D9803	.FILL #803
+D9804	.FILL #804
+D9805	.FILL #805
+D9806	.FILL #806
+D9807	.FILL #807
+D9808	.FILL #808
+D9809	.FILL #809
+D9810	.FILL #810
+D9811	.FILL #811
+D9812	.FILL #812
+D9813	.FILL #813
+D9814	.FILL #814
+D9815	.FILL #815
+D9816	.FILL #816
+D9817	.FILL #817
+D9818	.FILL #818
+D9819	.FILL #819
+D9820	.FILL #820
+D9821	.FILL #821
+D9822	.FILL #822
+D9823	.FILL #823
+D9824	.FILL #824
+D9825	.FILL #825
+D9826	.FILL #826
+D9827	.FILL #827
+D9828	.FILL #828
+D9829	.FILL #829
+D9830	.FILL #830
+D9831	.FILL #831
+D9832	.FILL #832
+D9833	.FILL #833
+D9834	.FILL #834
+D9835	.FILL #835
+D9836	.FILL #836
+D9837	.FILL #837
+D9838	.FILL #838
+D9839	.FILL #839
+D9840	.FILL #840
+D9841	.FILL #841
+D9842	.FILL #842
+D9843	.FILL #843
+D9844	.FILL #844
+D9845	.FILL #845
+D9846	.FILL #846
+D9847	.FILL #847
+D9848	.FILL #848
+D9849	.FILL #849
+D9850	.FILL #850
+D9851	.FILL #851
+D9852	.FILL #852
+D9853	.FILL #853
+D9854	.FILL #854
+D9855	.FILL #855
+D9856	.FILL #856
+D9857	.FILL #857
+D9858	.FILL #858
+D9859	.FILL #859
+D9860	.FILL #860
+D9861	.FILL #861
+D9862	.FILL #862
+D9863	.FILL #863
+D9864	.FILL #864
+D9865	.FILL #865
+D9866	.FILL #866
+D9867	.FILL #867
+D9868	.FILL #868
+D9869	.FILL #869
+D9870	.FILL #870
+D9871	.FILL #871
+D9872	.FILL #872
+D9873	.FILL #873
+D9874	.FILL #874
+D9875	.FILL #875
+D9876	.FILL #876
+D9877	.FILL #877
+D9878	.FILL #878
+D9879	.FILL #879
+D9880	.FILL #880
+D9881	.FILL #881
+D9882	.FILL #882
+D9883	.FILL #883
+D9884	.FILL #884
+D9885	.FILL #885
+D9886	.FILL #886
+D9887	.FILL #887
+D9888	.FILL #888
+D9889	.FILL #889
+D9890	.FILL #890
+D9891	.FILL #891
+D9892	.FILL #892
+D9893	.FILL #893
+D9894	.FILL #894
+D9895	.FILL #895
+D9896	.FILL #896
+D9897	.FILL #897
+D9898	.FILL #898
+D9899	.FILL #899
+D9900	.FILL #900
+D9901	.FILL #901
+D9902	.FILL #902
+D9903	.FILL #903
+D9904	.FILL #904
+D9905	.FILL #905
+D9906	.FILL #906
+D9907	.FILL #907
+D9908	.FILL #908
+D9909	.FILL #909
+D9910	.FILL #910
+D9911	.FILL #911
+D9912	.FILL #912
+D9913	.FILL #913
+D9914	.FILL #914
+D9915	.FILL #915
+D9916	.FILL #916
+D9917	.FILL #917
+D9918	.FILL #918
+D9919	.FILL #919
+D9920	.FILL #920
+D9921	.FILL #921
+D9922	.FILL #922
+D9923	.FILL #923
+D9924	.FILL #924
+D9925	.FILL #925
+D9926	.FILL #926
+D9927	.FILL #927
+D9928	.FILL #928
+D9929	.FILL #929
+D9930	.FILL #930
+D9931	.FILL #931
+D9932	.FILL #932
+D9933	.FILL #933
+D9934	.FILL #934
+D9935	.FILL #935
+D9936	.FILL #936
+D9937	.FILL #937
+D9938	.FILL #938
+D9939	.FILL #939
+D9940	.FILL #940
+D9941	.FILL #941
+D9942	.FILL #942
+D9943	.FILL #943
+D9944	.FILL #944
+D9945	.FILL #945
+D9946	.FILL #946
+D9947	.FILL #947
+D9948	.FILL #948
+D9949	.FILL #949
+D9950	.FILL #950
+D9951	.FILL #951
+D9952	.FILL #952
+D9953	.FILL #953
+D9954	.FILL #954
+D9955	.FILL #955
+D9956	.FILL #956
+D9957	.FILL #957
+D9958	.FILL #958
+D9959	.FILL #959
+D9960	.FILL #960
+D9961	.FILL #961
+D9962	.FILL #962
+D9963	.FILL #963
+D9964	.FILL #964
+D9965	.FILL #965
+D9966	.FILL #966
+D9967	.FILL #967
+D9968	.FILL #968
+D9969	.FILL #969
+D9970	.FILL #970
+D9971	.FILL #971
+D9972	.FILL #972
+D9973	.FILL #973
+D9974	.FILL #974
+D9975	.FILL #975
+D9976	.FILL #976
+D9977	.FILL #977
+D9978	.FILL #978
+D9979	.FILL #979
+D9980	.FILL #980
+D9981	.FILL #981
+D9982	.FILL #982
+D9983	.FILL #983
+D9984	.FILL #984
+D9985	.FILL #985
+D9986	.FILL #986
+D9987	.FILL #987
+D9988	.FILL #988
+D9989	.FILL #989
+D9990	.FILL #990
+D9991	.FILL #991
+D9992	.FILL #992
+D9993	.FILL #993
+D9994	.FILL #994
+D9995	.FILL #995
+D9996	.FILL #996
+D9997	.FILL #997
+D9998	.FILL #998
+D9999	.FILL #999
+D10000	.FILL #0
+D10001	.FILL #1
+D10002	.FILL #2
+D10003	.FILL #3
+D10004	.FILL #4
+D10005	.FILL #5
+D10006	.FILL #6
+D10007	.FILL #7
+D10008	.FILL #8
+D10009	.FILL #9
+D10010	.FILL #10
+D10011	.FILL #11
+D10012	.FILL #12
+D10013	.FILL #13
+D10014	.FILL #14
+D10015	.FILL #15
+D10016	.FILL #16
+D10017	.FILL #17
+D10018	.FILL #18
+D10019	.FILL #19
+D10020	.FILL #20
+D10021	.FILL #21
+D10022	.FILL #22
+D10023	.FILL #23
+D10024	.FILL #24
+D10025	.FILL #25
+D10026	.FILL #26
+D10027	.FILL #27
+D10028	.FILL #28
+D10029	.FILL #29
+D10030	.FILL #30
+D10031	.FILL #31
+D10032	.FILL #32
+D10033	.FILL #33
+D10034	.FILL #34
+D10035	.FILL #35
+D10036	.FILL #36
+D10037	.FILL #37
+D10038	.FILL #38
+D10039	.FILL #39
+D10040	.FILL #40
+D10041	.FILL #41
+D10042	.FILL #42
+D10043	.FILL #43
+D10044	.FILL #44
+D10045	.FILL #45
+D10046	.FILL #46
+D10047	.FILL #47
+D10048	.FILL #48
+D10049	.FILL #49
+D10050	.FILL #50
+D10051	.FILL #51
+D10052	.FILL #52
+D10053	.FILL #53
+D10054	.FILL #54
+D10055	.FILL #55
+D10056	.FILL #56
+D10057	.FILL #57
+D10058	.FILL #58
+D10059	.FILL #59
+D10060	.FILL #60
+D10061	.FILL #61
+D10062	.FILL #62
+D10063	.FILL #63
+D10064	.FILL #64
+D10065	.FILL #65
+D10066	.FILL #66
+D10067	.FILL #67
+D10068	.FILL #68
+D10069	.FILL #69
+D10070	.FILL #70
+D10071	.FILL #71
+D10072	.FILL #72
+D10073	.FILL #73
+D10074	.FILL #74
+D10075	.FILL #75
+D10076	.FILL #76
+D10077	.FILL #77
+D10078	.FILL #78
+D10079	.FILL #79
+D10080	.FILL #80
+D10081	.FILL #81
+D10082	.FILL #82
+D10083	.FILL #83
+D10084	.FILL #84
+D10085	.FILL #85
+D10086	.FILL #86
+D10087	.FILL #87
+D10088	.FILL #88
+D10089	.FILL #89
+D10090	.FILL #90
+D10091	.FILL #91
+D10092	.FILL #92
+D10093	.FILL #93
+D10094	.FILL #94
+D10095	.FILL #95
+D10096	.FILL #96
+D10097	.FILL #97
+D10098	.FILL #98
+D10099	.FILL #99
+D10100	.FILL #100
+D10101	.FILL #101
+D10102	.FILL #102
+D10103	.FILL #103
+D10104	.FILL #104
+D10105	.FILL #105
+D10106	.FILL #106
+D10107	.FILL #107
+D10108	.FILL #108
+D10109	.FILL #109
+D10110	.FILL #110
+D10111	.FILL #111
+D10112	.FILL #112
+D10113	.FILL #113
+D10114	.FILL #114
+D10115	.FILL #115
+D10116	.FILL #116
+D10117	.FILL #117
+D10118	.FILL #118
+D10119	.FILL #119
+D10120	.FILL #120
+D10121	.FILL #121
+D10122	.FILL #122
+D10123	.FILL #123
+D10124	.FILL #124
+D10125	.FILL #125
+D10126	.FILL #126
+D10127	.FILL #127
+D10128	.FILL #128
+D10129	.FILL #129
+D10130	.FILL #130
+D10131	.FILL #131
+D10132	.FILL #132
+D10133	.FILL #133
+D10134	.FILL #134
+D10135	.FILL #135
+D10136	.FILL #136
+D10137	.FILL #137
+D10138	.FILL #138
+D10139	.FILL #139
+D10140	.FILL #140
+D10141	.FILL #141
+D10142	.FILL #142
+D10143	.FILL #143
+D10144	.FILL #144
+D10145	.FILL #145
+D10146	.FILL #146
+D10147	.FILL #147
+D10148	.FILL #148
+D10149	.FILL #149
+D10150	.FILL #150
+D10151	.FILL #151
+D10152	.FILL #152
+D10153	.FILL #153
+D10154	.FILL #154
+D10155	.FILL #155
+D10156	.FILL #156
+D10157	.FILL #157
+D10158	.FILL #158
+D10159	.FILL #159
+D10160	.FILL #160
+D10161	.FILL #161
+D10162	.FILL #162
+D10163	.FILL #163
+D10164	.FILL #164
+D10165	.FILL #165
+D10166	.FILL #166
+D10167	.FILL #167
+D10168	.FILL #168
+D10169	.FILL #169
+D10170	.FILL #170
+D10171	.FILL #171
+D10172	.FILL #172
+D10173	.FILL #173
+D10174	.FILL #174
+D10175	.FILL #175
+D10176	.FILL #176
+D10177	.FILL #177
+D10178	.FILL #178
+D10179	.FILL #179
+D10180	.FILL #180
+D10181	.FILL #181
+D10182	.FILL #182
+D10183	.FILL #183
+D10184	.FILL #184
+D10185	.FILL #185
+D10186	.FILL #186
+D10187	.FILL #187
+D10188	.FILL #188
+D10189	.FILL #189
+D10190	.FILL #190
+D10191	.FILL #191
+D10192	.FILL #192
+D10193	.FILL #193
+D10194	.FILL #194
+D10195	.FILL #195
+D10196	.FILL #196
+D10197	.FILL #197
+D10198	.FILL #198
+D10199	.FILL #199
+D10200	.FILL #200
+D10201	.FILL #201
+D10202	.FILL #202
+D10203	.FILL #203
+D10204	.FILL #204
+D10205	.FILL #205
+D10206	.FILL #206
+D10207	.FILL #207
+D10208	.FILL #208
+D10209	.FILL #209
+D10210	.FILL #210
+D10211	.FILL #211
+D10212	.FILL #212
+D10213	.FILL #213
+D10214	.FILL #214
+D10215	.FILL #215
+D10216	.FILL #216
+D10217	.FILL #217
+D10218	.FILL #218
+D10219	.FILL #219
+D10220	.FILL #220
+D10221	.FILL #221
+D10222	.FILL #222
+D10223	.FILL #223
+D10224	.FILL #224
+D10225	.FILL #225
+D10226	.FILL #226
+D10227	.FILL #227
+D10228	.FILL #228
+D10229	.FILL #229
+D10230	.FILL #230
+D10231	.FILL #231
+D10232	.FILL #232
+D10233	.FILL #233
+D10234	.FILL #234
+D10235	.FILL #235
+D10236	.FILL #236
+D10237	.FILL #237
+D10238	.FILL #238
+D10239	.FILL #239
+D10240	.FILL #240
+D10241	.FILL #241
+D10242	.FILL #242
+D10243	.FILL #243
+D10244	.FILL #244
+D10245	.FILL #245
+D10246	.FILL #246
+D10247	.FILL #247
+D10248	.FILL #248
+D10249	.FILL #249
+D10250	.FILL #250
+D10251	.FILL #251
+D10252	.FILL #252
+D10253	.FILL #253
+D10254	.FILL #254
+D10255	.FILL #255
+D10256	.FILL #256
+D10257	.FILL #257
+D10258	.FILL #258
+D10259	.FILL #259
+D10260	.FILL #260
+D10261	.FILL #261
+D10262	.FILL #262
+D10263	.FILL #263
+D10264	.FILL #264
+D10265	.FILL #265
+D10266	.FILL #266
+D10267	.FILL #267
+D10268	.FILL #268
+D10269	.FILL #269
+D10270	.FILL #270
+D10271	.FILL #271
+D10272	.FILL #272
+D10273	.FILL #273
+D10274	.FILL #274
+D10275	.FILL #275
+D10276	.FILL #276
+D10277	.FILL #277
+D10278	.FILL #278
+D10279	.FILL #279
+D10280	.FILL #280
+D10281	.FILL #281
+D10282	.FILL #282
+D10283	.FILL #283
+D10284	.FILL #284
+D10285	.FILL #285
+D10286	.FILL #286
+D10287	.FILL #287
+D10288	.FILL #288
+D10289	.FILL #289
+D10290	.FILL #290
+D10291	.FILL #291
+D10292	.FILL #292
+D10293	.FILL #293
+D10294	.FILL #294
+D10295	.FILL #295
+D10296	.FILL #296
+D10297	.FILL #297
+D10298	.FILL #298
+D10299	.FILL #299
+D10300	.FILL #300
+D10301	.FILL #301
+D10302	.FILL #302
+D10303	.FILL #303
+D10304	.FILL #304
+D10305	.FILL #305
+D10306	.FILL #306
+D10307	.FILL #307
+D10308	.FILL #308
+D10309	.FILL #309
+D10310	.FILL #310
+D10311	.FILL #311
+D10312	.FILL #312
+D10313	.FILL #313
+D10314	.FILL #314
+D10315	.FILL #315
+D10316	.FILL #316
+D10317	.FILL #317
+D10318	.FILL #318
+D10319	.FILL #319
+D10320	.FILL #320
+D10321	.FILL #321
+D10322	.FILL #322
+D10323	.FILL #323
+D10324	.FILL #324
+D10325	.FILL #325
+D10326	.FILL #326
+D10327	.FILL #327
+D10328	.FILL #328
+D10329	.FILL #329
+D10330	.FILL #330
+D10331	.FILL #331
+D10332	.FILL #332
+D10333	.FILL #333
+D10334	.FILL #334
+D10335	.FILL #335
+D10336	.FILL #336
+D10337	.FILL #337
+D10338	.FILL #338
+D10339	.FILL #339
+D10340	.FILL #340
+D10341	.FILL #341
+D10342	.FILL #342
+D10343	.FILL #343
+D10344	.FILL #344
+D10345	.FILL #345
+D10346	.FILL #346
+D10347	.FILL #347
+D10348	.FILL #348
+D10349	.FILL #349
+D10350	.FILL #350
+D10351	.FILL #351
+D10352	.FILL #352
+D10353	.FILL #353
+D10354	.FILL #354
+D10355	.FILL #355
+D10356	.FILL #356
+D10357	.FILL #357
+D10358	.FILL #358
+D10359	.FILL #359
+D10360	.FILL #360
+D10361	.FILL #361
+D10362	.FILL #362
+D10363	.FILL #363
+D10364	.FILL #364
+D10365	.FILL #365
+D10366	.FILL #366
+D10367	.FILL #367
+D10368	.FILL #368
+D10369	.FILL #369
+D10370	.FILL #370
+D10371	.FILL #371
+D10372	.FILL #372
+D10373	.FILL #373
+D10374	.FILL #374
+D10375	.FILL #375
+D10376	.FILL #376
+D10377	.FILL #377
+D10378	.FILL #378
+D10379	.FILL #379
+D10380	.FILL #380
+D10381	.FILL #381
+D10382	.FILL #382
+D10383	.FILL #383
+D10384	.FILL #384
+D10385	.FILL #385
+D10386	.FILL #386
+D10387	.FILL #387
+D10388	.FILL #388
+D10389	.FILL #389
+D10390	.FILL #390
+D10391	.FILL #391
+D10392	.FILL #392
+D10393	.FILL #393
+D10394	.FILL #394
+D10395	.FILL #395
+D10396	.FILL #396
+D10397	.FILL #397
+D10398	.FILL #398
+D10399	.FILL #399
+D10400	.FILL #400
+D10401	.FILL #401
+D10402	.FILL #402
+D10403	.FILL #403
+D10404	.FILL #404
+D10405	.FILL #405
+D10406	.FILL #406
+D10407	.FILL #407
+D10408	.FILL #408
+D10409	.FILL #409
+D10410	.FILL #410
+D10411	.FILL #411
+D10412	.FILL #412
+D10413	.FILL #413
+D10414	.FILL #414
+D10415	.FILL #415
+D10416	.FILL #416
+D10417	.FILL #417
+D10418	.FILL #418
+D10419	.FILL #419
+D10420	.FILL #420
+D10421	.FILL #421
+D10422	.FILL #422
+D10423	.FILL #423
+D10424	.FILL #424
+D10425	.FILL #425
+D10426	.FILL #426
+D10427	.FILL #427
+D10428	.FILL #428
+D10429	.FILL #429
+D10430	.FILL #430
+D10431	.FILL #431
+D10432	.FILL #432
+D10433	.FILL #433
+D10434	.FILL #434
+D10435	.FILL #435
+D10436	.FILL #436
+D10437	.FILL #437
+D10438	.FILL #438
+D10439	.FILL #439
+D10440	.FILL #440
+D10441	.FILL #441
+D10442	.FILL #442
+D10443	.FILL #443
+D10444	.FILL #444
+D10445	.FILL #445
+D10446	.FILL #446
+D10447	.FILL #447
+D10448	.FILL #448
+D10449	.FILL #449
+D10450	.FILL #450
+D10451	.FILL #451
+D10452	.FILL #452
+D10453	.FILL #453
+D10454	.FILL #454
+D10455	.FILL #455
+D10456	.FILL #456
+D10457	.FILL #457
+D10458	.FILL #458
+D10459	.FILL #459
+D10460	.FILL #460
+D10461	.FILL #461
+D10462	.FILL #462
+D10463	.FILL #463
+D10464	.FILL #464
+D10465	.FILL #465
+D10466	.FILL #466
+D10467	.FILL #467
+D10468	.FILL #468
+D10469	.FILL #469
+D10470	.FILL #470
+D10471	.FILL #471
+D10472	.FILL #472
+D10473	.FILL #473
+D10474	.FILL #474
+D10475	.FILL #475
+D10476	.FILL #476
+D10477	.FILL #477
+D10478	.FILL #478
+D10479	.FILL #479
+D10480	.FILL #480
+D10481	.FILL #481
+D10482	.FILL #482
+D10483	.FILL #483
+D10484	.FILL #484
+D10485	.FILL #485
+D10486	.FILL #486
+D10487	.FILL #487
+D10488	.FILL #488
+D10489	.FILL #489
+D10490	.FILL #490
+D10491	.FILL #491
+D10492	.FILL #492
+D10493	.FILL #493
+D10494	.FILL #494
+D10495	.FILL #495
+D10496	.FILL #496
+D10497	.FILL #497
+D10498	.FILL #498
+D10499	.FILL #499
+D10500	.FILL #500
+D10501	.FILL #501
+D10502	.FILL #502
+D10503	.FILL #503
+D10504	.FILL #504
+D10505	.FILL #505
+D10506	.FILL #506
+D10507	.FILL #507
+D10508	.FILL #508
+D10509	.FILL #509
+D10510	.FILL #510
+D10511	.FILL #511
+D10512	.FILL #512
+D10513	.FILL #513
+D10514	.FILL #514
+D10515	.FILL #515
+D10516	.FILL #516
+D10517	.FILL #517
+D10518	.FILL #518
+D10519	.FILL #519
+D10520	.FILL #520
+D10521	.FILL #521
+D10522	.FILL #522
+D10523	.FILL #523
+D10524	.FILL #524
+D10525	.FILL #525
+D10526	.FILL #526
+D10527	.FILL #527
+D10528	.FILL #528
+D10529	.FILL #529
+D10530	.FILL #530
+D10531	.FILL #531
+D10532	.FILL #532
+D10533	.FILL #533
+D10534	.FILL #534
+D10535	.FILL #535
+D10536	.FILL #536
+D10537	.FILL #537
+D10538	.FILL #538
+D10539	.FILL #539
+D10540	.FILL #540
+D10541	.FILL #541
+D10542	.FILL #542
+D10543	.FILL #543
+D10544	.FILL #544
+D10545	.FILL #545
+D10546	.FILL #546
+D10547	.FILL #547
+D10548	.FILL #548
+D10549	.FILL #549
+D10550	.FILL #550
+D10551	.FILL #551
+D10552	.FILL #552
+D10553	.FILL #553
+D10554	.FILL #554
+D10555	.FILL #555
+D10556	.FILL #556
+D10557	.FILL #557
+D10558	.FILL #558
+D10559	.FILL #559
+D10560	.FILL #560
+D10561	.FILL #561
+D10562	.FILL #562
+D10563	.FILL #563
+D10564	.FILL #564
+D10565	.FILL #565
+D10566	.FILL #566
+D10567	.FILL #567
+D10568	.FILL #568
+D10569	.FILL #569
+D10570	.FILL #570
+D10571	.FILL #571
+D10572	.FILL #572
+D10573	.FILL #573
+D10574	.FILL #574
+D10575	.FILL #575
+D10576	.FILL #576
+D10577	.FILL #577
+D10578	.FILL #578
+D10579	.FILL #579
+D10580	.FILL #580
+D10581	.FILL #581
+D10582	.FILL #582
+D10583	.FILL #583
+D10584	.FILL #584
+D10585	.FILL #585
+D10586	.FILL #586
+D10587	.FILL #587
+D10588	.FILL #588
+D10589	.FILL #589
+D10590	.FILL #590
+D10591	.FILL #591
+D10592	.FILL #592
+D10593	.FILL #593
+D10594	.FILL #594
+D10595	.FILL #595
+D10596	.FILL #596
+D10597	.FILL #597
+D10598	.FILL #598
+D10599	.FILL #599
+D10600	.FILL #600
+D10601	.FILL #601
+D10602	.FILL #602
+D10603	.FILL #603
+D10604	.FILL #604
+D10605	.FILL #605
+D10606	.FILL #606
+D10607	.FILL #607
+D10608	.FILL #608
+D10609	.FILL #609
+D10610	.FILL #610
+D10611	.FILL #611
+D10612	.FILL #612
+D10613	.FILL #613
+D10614	.FILL #614
+D10615	.FILL #615
+D10616	.FILL #616
+D10617	.FILL #617
+D10618	.FILL #618
+D10619	.FILL #619
+D10620	.FILL #620
+D10621	.FILL #621
+D10622	.FILL #622
+D10623	.FILL #623
+D10624	.FILL #624
+D10625	.FILL #625
+D10626	.FILL #626
+D10627	.FILL #627
+D10628	.FILL #628
+D10629	.FILL #629
+D10630	.FILL #630
+D10631	.FILL #631
+D10632	.FILL #632
+D10633	.FILL #633
+D10634	.FILL #634
+D10635	.FILL #635
+D10636	.FILL #636
+D10637	.FILL #637
+D10638	.FILL #638
+D10639	.FILL #639
+D10640	.FILL #640
+D10641	.FILL #641
+D10642	.FILL #642
+D10643	.FILL #643
+D10644	.FILL #644
+D10645	.FILL #645
+D10646	.FILL #646
+D10647	.FILL #647
+D10648	.FILL #648
+D10649	.FILL #649
+D10650	.FILL #650
+D10651	.FILL #651
+D10652	.FILL #652
+D10653	.FILL #653
+D10654	.FILL #654
+D10655	.FILL #655
+D10656	.FILL #656
+D10657	.FILL #657
+D10658	.FILL #658
+D10659	.FILL #659
+D10660	.FILL #660
+D10661	.FILL #661
+D10662	.FILL #662
+D10663	.FILL #663
+D10664	.FILL #664
+D10665	.FILL #665
+D10666	.FILL #666
+D10667	.FILL #667
+D10668	.FILL #668
+D10669	.FILL #669
+D10670	.FILL #670
+D10671	.FILL #671
+D10672	.FILL #672
+D10673	.FILL #673
+D10674	.FILL #674
+D10675	.FILL #675
+D10676	.FILL #676
+D10677	.FILL #677
+D10678	.FILL #678
+D10679	.FILL #679
+D10680	.FILL #680
+D10681	.FILL #681
+D10682	.FILL #682
+D10683	.FILL #683
+D10684	.FILL #684
+D10685	.FILL #685
+D10686	.FILL #686
+D10687	.FILL #687
+D10688	.FILL #688
+D10689	.FILL #689
+D10690	.FILL #690
+D10691	.FILL #691
+D10692	.FILL #692
+D10693	.FILL #693
+D10694	.FILL #694
+D10695	.FILL #695
+D10696	.FILL #696
+D10697	.FILL #697
+D10698	.FILL #698
+D10699	.FILL #699
+D10700	.FILL #700
+D10701	.FILL #701
+D10702	.FILL #702
+D10703	.FILL #703
+D10704	.FILL #704
+D10705	.FILL #705
+D10706	.FILL #706
+D10707	.FILL #707
+D10708	.FILL #708
+D10709	.FILL #709
+D10710	.FILL #710
+D10711	.FILL #711
+D10712	.FILL #712
+D10713	.FILL #713
+D10714	.FILL #714
+D10715	.FILL #715
+D10716	.FILL #716
+D10717	.FILL #717
+D10718	.FILL #718
+D10719	.FILL #719
+D10720	.FILL #720
+D10721	.FILL #721
+D10722	.FILL #722
+D10723	.FILL #723
+D10724	.FILL #724
+D10725	.FILL #725
+D10726	.FILL #726
+D10727	.FILL #727
+D10728	.FILL #728
+D10729	.FILL #729
+D10730	.FILL #730
+D10731	.FILL #731
+D10732	.FILL #732
+D10733	.FILL #733
+D10734	.FILL #734
+D10735	.FILL #735
+D10736	.FILL #736
+D10737	.FILL #737
+D10738	.FILL #738
+D10739	.FILL #739
+D10740	.FILL #740
+D10741	.FILL #741
+D10742	.FILL #742
+D10743	.FILL #743
+D10744	.FILL #744
+D10745	.FILL #745
+D10746	.FILL #746
+D10747	.FILL #747
+D10748	.FILL #748
+D10749	.FILL #749
+D10750	.FILL #750
+D10751	.FILL #751
+D10752	.FILL #752
+D10753	.FILL #753
+D10754	.FILL #754
+D10755	.FILL #755
+D10756	.FILL #756
+D10757	.FILL #757
+D10758	.FILL #758
+D10759	.FILL #759
+D10760	.FILL #760
+D10761	.FILL #761
+D10762	.FILL #762
+D10763	.FILL #763
+D10764	.FILL #764
+D10765	.FILL #765
+D10766	.FILL #766
+D10767	.FILL #767
+D10768	.FILL #768
+D10769	.FILL #769
+D10770	.FILL #770
+D10771	.FILL #771
+D10772	.FILL #772
+D10773	.FILL #773
+D10774	.FILL #774
+D10775	.FILL #775
+D10776	.FILL #776
+D10777	.FILL #777
+D10778	.FILL #778
+D10779	.FILL #779
+D10780	.FILL #780
+D10781	.FILL #781
+D10782	.FILL #782
+D10783	.FILL #783
+D10784	.FILL #784
+D10785	.FILL #785
+D10786	.FILL #786
+D10787	.FILL #787
+D10788	.FILL #788
+D10789	.FILL #789
+D10790	.FILL #790
+D10791	.FILL #791
+D10792	.FILL #792
+D10793	.FILL #793
+D10794	.FILL #794
+D10795	.FILL #795
+D10796	.FILL #796
+D10797	.FILL #797
+D10798	.FILL #798
+D10799	.FILL #799
+D10800	.FILL #800
+D10801	.FILL #801
+D10802	.FILL #802
+D10803	.FILL #803
+D10804	.FILL #804
+D10805	.FILL #805
+D10806	.FILL #806
+D10807	.FILL #807
+D10808	.FILL #808
+D10809	.FILL #809
+D10810	.FILL #810
+D10811	.FILL #811
+D10812	.FILL #812
+D10813	.FILL #813
+D10814	.FILL #814
+D10815	.FILL #815
+D10816	.FILL #816
+D10817	.FILL #817
+D10818	.FILL #818
+D10819	.FILL #819
+D10820	.FILL #820
+D10821	.FILL #821
+D10822	.FILL #822
+D10823	.FILL #823
+D10824	.FILL #824
+D10825	.FILL #825
+D10826	.FILL #826
+D10827	.FILL #827
+D10828	.FILL #828
+D10829	.FILL #829
+D10830	.FILL #830
+D10831	.FILL #831
+D10832	.FILL #832
+D10833	.FILL #833
+D10834	.FILL #834
+D10835	.FILL #835
+D10836	.FILL #836
+D10837	.FILL #837
+D10838	.FILL #838
+D10839	.FILL #839
+D10840	.FILL #840
+D10841	.FILL #841
+D10842	.FILL #842
+D10843	.FILL #843
+D10844	.FILL #844
+D10845	.FILL #845
+D10846	.FILL #846
+D10847	.FILL #847
+D10848	.FILL #848
+D10849	.FILL #849
+D10850	.FILL #850
+D10851	.FILL #851
+D10852	.FILL #852
+D10853	.FILL #853
+D10854	.FILL #854
+D10855	.FILL #855
+D10856	.FILL #856
+D10857	.FILL #857
+D10858	.FILL #858
+D10859	.FILL #859
+D10860	.FILL #860
+D10861	.FILL #861
+D10862	.FILL #862
+D10863	.FILL #863
+D10864	.FILL #864
+D10865	.FILL #865
+D10866	.FILL #866
+D10867	.FILL #867
+D10868	.FILL #868
+D10869	.FILL #869
+D10870	.FILL #870
+D10871	.FILL #871
+D10872	.FILL #872
+D10873	.FILL #873
+D10874	.FILL #874
+D10875	.FILL #875
+D10876	.FILL #876
+D10877	.FILL #877
+D10878	.FILL #878
+D10879	.FILL #879
+D10880	.FILL #880
+D10881	.FILL #881
+D10882	.FILL #882
+D10883	.FILL #883
+D10884	.FILL #884
+D10885	.FILL #885
+D10886	.FILL #886
+D10887	.FILL #887
+D10888	.FILL #888
+D10889	.FILL #889
+D10890	.FILL #890
+D10891	.FILL #891
+D10892	.FILL #892
+D10893	.FILL #893
+D10894	.FILL #894
+D10895	.FILL #895
+D10896	.FILL #896
+D10897	.FILL #897
+D10898	.FILL #898
+D10899	.FILL #899
+D10900	.FILL #900
+D10901	.FILL #901
+D10902	.FILL #902
+D10903	.FILL #903
+D10904	.FILL #904
+D10905	.FILL #905
+D10906	.FILL #906
+D10907	.FILL #907
+D10908	.FILL #908
+D10909	.FILL #909
+D10910	.FILL #910
+D10911	.FILL #911
+D10912	.FILL #912
+D10913	.FILL #913
+D10914	.FILL #914
+D10915	.FILL #915
+D10916	.FILL #916
+D10917	.FILL #917
+D10918	.FILL #918
+D10919	.FILL #919
+D10920	.FILL #920
+D10921	.FILL #921
+D10922	.FILL #922
+D10923	.FILL #923
+D10924	.FILL #924
+D10925	.FILL #925
+D10926	.FILL #926
+D10927	.FILL #927
+D10928	.FILL #928
+D10929	.FILL #929
+D10930	.FILL #930
+D10931	.FILL #931
+D10932	.FILL #932
+D10933	.FILL #933
+D10934	.FILL #934
+D10935	.FILL #935
+D10936	.FILL #936
+D10937	.FILL #937
+D10938	.FILL #938
+D10939	.FILL #939
+D10940	.FILL #940
+D10941	.FILL #941
+D10942	.FILL #942
+D10943	.FILL #943
+D10944	.FILL #944
+D10945	.FILL #945
+D10946	.FILL #946
+D10947	.FILL #947
+D10948	.FILL #948
+D10949	.FILL #949
+D10950	.FILL #950
+D10951	.FILL #951
+D10952	.FILL #952
+D10953	.FILL #953
+D10954	.FILL #954
+D10955	.FILL #955
+D10956	.FILL #956
+D10957	.FILL #957
+D10958	.FILL #958
+D10959	.FILL #959
+D10960	.FILL #960
+D10961	.FILL #961
+D10962	.FILL #962
+D10963	.FILL #963
+D10964	.FILL #964
+D10965	.FILL #965
+D10966	.FILL #966
+D10967	.FILL #967
+D10968	.FILL #968
+D10969	.FILL #969
+D10970	.FILL #970
+D10971	.FILL #971
+D10972	.FILL #972
+D10973	.FILL #973
+D10974	.FILL #974
+D10975	.FILL #975
+D10976	.FILL #976
+D10977	.FILL #977
+D10978	.FILL #978
+D10979	.FILL #979
+D10980	.FILL #980
+D10981	.FILL #981
+D10982	.FILL #982
+D10983	.FILL #983
+D10984	.FILL #984
+D10985	.FILL #985
+D10986	.FILL #986
+D10987	.FILL #987
+D10988	.FILL #988
+D10989	.FILL #989
+D10990	.FILL #990
+D10991	.FILL #991
+D10992	.FILL #992
+D10993	.FILL #993
+D10994	.FILL #994
+D10995	.FILL #995
+D10996	.FILL #996
+D10997	.FILL #997
+D10998	.FILL #998
+D10999	.FILL #999
+D11000	.FILL #0
+D11001	.FILL #1
+D11002	.FILL #2
+D11003	.FILL #3
+D11004	.FILL #4
+D11005	.FILL #5
+D11006	.FILL #6
+D11007	.FILL #7
+D11008	.FILL #8
+D11009	.FILL #9
+D11010	.FILL #10
+D11011	.FILL #11
+D11012	.FILL #12
+D11013	.FILL #13
+D11014	.FILL #14
+D11015	.FILL #15
+D11016	.FILL #16
+D11017	.FILL #17
+D11018	.FILL #18
+D11019	.FILL #19
+D11020	.FILL #20
+D11021	.FILL #21
+D11022	.FILL #22
+D11023	.FILL #23
+D11024	.FILL #24
+D11025	.FILL #25
+D11026	.FILL #26
+D11027	.FILL #27
+D11028	.FILL #28
+D11029	.FILL #29
+D11030	.FILL #30
+D11031	.FILL #31
+D11032	.FILL #32
+D11033	.FILL #33
+D11034	.FILL #34
+D11035	.FILL #35
+D11036	.FILL #36
+D11037	.FILL #37
+D11038	.FILL #38
+D11039	.FILL #39
+D11040	.FILL #40
+D11041	.FILL #41
+D11042	.FILL #42
+D11043	.FILL #43
+D11044	.FILL #44
+D11045	.FILL #45
+D11046	.FILL #46
+D11047	.FILL #47
+D11048	.FILL #48
+D11049	.FILL #49
+D11050	.FILL #50
+D11051	.FILL #51
+D11052	.FILL #52
+D11053	.FILL #53
+D11054	.FILL #54
+D11055	.FILL #55
+D11056	.FILL #56
+D11057	.FILL #57
+D11058	.FILL #58
+D11059	.FILL #59
+D11060	.FILL #60
+D11061	.FILL #61
+D11062	.FILL #62
+D11063	.FILL #63
+D11064	.FILL #64
+D11065	.FILL #65
+D11066	.FILL #66
+D11067	.FILL #67
+D11068	.FILL #68
+D11069	.FILL #69
+D11070	.FILL #70
+D11071	.FILL #71
+D11072	.FILL #72
+D11073	.FILL #73
+D11074	.FILL #74
+D11075	.FILL #75
+D11076	.FILL #76
+D11077	.FILL #77
+D11078	.FILL #78
+D11079	.FILL #79
+D11080	.FILL #80
+D11081	.FILL #81
+D11082	.FILL #82
+D11083	.FILL #83
+D11084	.FILL #84
+D11085	.FILL #85
+D11086	.FILL #86
+D11087	.FILL #87
+D11088	.FILL #88
+D11089	.FILL #89
+D11090	.FILL #90
+D11091	.FILL #91
+D11092	.FILL #92
+D11093	.FILL #93
+D11094	.FILL #94
+D11095	.FILL #95
+D11096	.FILL #96
+D11097	.FILL #97
+D11098	.FILL #98
+D11099	.FILL #99
+D11100	.FILL #100
+D11101	.FILL #101
+D11102	.FILL #102
+D11103	.FILL #103
+D11104	.FILL #104
+D11105	.FILL #105
+D11106	.FILL #106
+D11107	.FILL #107
+D11108	.FILL #108
+D11109	.FILL #109
+D11110	.FILL #110
+D11111	.FILL #111
+D11112	.FILL #112
+D11113	.FILL #113
+D11114	.FILL #114
+D11115	.FILL #115
+D11116	.FILL #116
+D11117	.FILL #117
+D11118	.FILL #118
+D11119	.FILL #119
+D11120	.FILL #120
+D11121	.FILL #121
+D11122	.FILL #122
+D11123	.FILL #123
+D11124	.FILL #124
+D11125	.FILL #125
+D11126	.FILL #126
+D11127	.FILL #127
+D11128	.FILL #128
+D11129	.FILL #129
+D11130	.FILL #130
+D11131	.FILL #131
+D11132	.FILL #132
+D11133	.FILL #133
+D11134	.FILL #134
+D11135	.FILL #135
+D11136	.FILL #136
+D11137	.FILL #137
+D11138	.FILL #138
+D11139	.FILL #139
+D11140	.FILL #140
+D11141	.FILL #141
+D11142	.FILL #142
+D11143	.FILL #143
+D11144	.FILL #144
+D11145	.FILL #145
+D11146	.FILL #146
+D11147	.FILL #147
+D11148	.FILL #148
+D11149	.FILL #149
+D11150	.FILL #150
+D11151	.FILL #151
+D11152	.FILL #152
+D11153	.FILL #153
+D11154	.FILL #154
+D11155	.FILL #155
+D11156	.FILL #156
+D11157	.FILL #157
+D11158	.FILL #158
+D11159	.FILL #159
+D11160	.FILL #160
+D11161	.FILL #161
+D11162	.FILL #162
+D11163	.FILL #163
+D11164	.FILL #164
+D11165	.FILL #165
+D11166	.FILL #166
+D11167	.FILL #167
+D11168	.FILL #168
+D11169	.FILL #169
+D11170	.FILL #170
+D11171	.FILL #171
+D11172	.FILL #172
+D11173	.FILL #173
+D11174	.FILL #174
+D11175	.FILL #175
+D11176	.FILL #176
+D11177	.FILL #177
+D11178	.FILL #178
+D11179	.FILL #179
+D11180	.FILL #180
+D11181	.FILL #181
+D11182	.FILL #182
+D11183	.FILL #183
+D11184	.FILL #184
+D11185	.FILL #185
+D11186	.FILL #186
+D11187	.FILL #187
+D11188	.FILL #188
+D11189	.FILL #189
+D11190	.FILL #190
+D11191	.FILL #191
+D11192	.FILL #192
+D11193	.FILL #193
+D11194	.FILL #194
+D11195	.FILL #195
+D11196	.FILL #196
+D11197	.FILL #197
+D11198	.FILL #198
+D11199	.FILL #199
+D11200	.FILL #200
+D11201	.FILL #201
+D11202	.FILL #202
+D11203	.FILL #203
+D11204	.FILL #204
+D11205	.FILL #205
+D11206	.FILL #206
+D11207	.FILL #207
+D11208	.FILL #208
+D11209	.FILL #209
+D11210	.FILL #210
+D11211	.FILL #211
+D11212	.FILL #212
+D11213	.FILL #213
+D11214	.FILL #214
+D11215	.FILL #215
+D11216	.FILL #216
+D11217	.FILL #217
+D11218	.FILL #218
+D11219	.FILL #219
+D11220	.FILL #220
+D11221	.FILL #221
+D11222	.FILL #222
+D11223	.FILL #223
+D11224	.FILL #224
+D11225	.FILL #225
+D11226	.FILL #226
+D11227	.FILL #227
+D11228	.FILL #228
+D11229	.FILL #229
+D11230	.FILL #230
+D11231	.FILL #231
+D11232	.FILL #232
+D11233	.FILL #233
+D11234	.FILL #234
+D11235	.FILL #235
+D11236	.FILL #236
+D11237	.FILL #237
+D11238	.FILL #238
+D11239	.FILL #239
+D11240	.FILL #240
+D11241	.FILL #241
+D11242	.FILL #242
+D11243	.FILL #243
+D11244	.FILL #244
+D11245	.FILL #245
+D11246	.FILL #246
+D11247	.FILL #247
+D11248	.FILL #248
+D11249	.FILL #249
+D11250	.FILL #250
+D11251	.FILL #251
+D11252	.FILL #252
+D11253	.FILL #253
+D11254	.FILL #254
+D11255	.FILL #255
+D11256	.FILL #256
+D11257	.FILL #257
+D11258	.FILL #258
+D11259	.FILL #259
+D11260	.FILL #260
+D11261	.FILL #261
+D11262	.FILL #262
+D11263	.FILL #263
+D11264	.FILL #264
+D11265	.FILL #265
+D11266	.FILL #266
+D11267	.FILL #267
+D11268	.FILL #268
+D11269	.FILL #269
+D11270	.FILL #270
+D11271	.FILL #271
+D11272	.FILL #272
+D11273	.FILL #273
+D11274	.FILL #274
+D11275	.FILL #275
+D11276	.FILL #276
+D11277	.FILL #277
+D11278	.FILL #278
+D11279	.FILL #279
+D11280	.FILL #280
+D11281	.FILL #281
+D11282	.FILL #282
+D11283	.FILL #283
+D11284	.FILL #284
+D11285	.FILL #285
+D11286	.FILL #286
+D11287	.FILL #287
+D11288	.FILL #288
+D11289	.FILL #289
+D11290	.FILL #290
+D11291	.FILL #291
+D11292	.FILL #292
+D11293	.FILL #293
+D11294	.FILL #294
+D11295	.FILL #295
+D11296	.FILL #296
+D11297	.FILL #297
+D11298	.FILL #298
+D11299	.FILL #299
+D11300	.FILL #300
+D11301	.FILL #301
+D11302	.FILL #302
+D11303	.FILL #303
+D11304	.FILL #304
+D11305	.FILL #305
+D11306	.FILL #306
+D11307	.FILL #307
+D11308	.FILL #308
+D11309	.FILL #309
+D11310	.FILL #310
+D11311	.FILL #311
+D11312	.FILL #312
+D11313	.FILL #313
+D11314	.FILL #314
+D11315	.FILL #315
+D11316	.FILL #316
+D11317	.FILL #317
+D11318	.FILL #318
+D11319	.FILL #319
+D11320	.FILL #320
+D11321	.FILL #321
+D11322	.FILL #322
+D11323	.FILL #323
+D11324	.FILL #324
+D11325	.FILL #325
+D11326	.FILL #326
+D11327	.FILL #327
+D11328	.FILL #328
+D11329	.FILL #329
+D11330	.FILL #330
+D11331	.FILL #331
+D11332	.FILL #332
+D11333	.FILL #333
+D11334	.FILL #334
+D11335	.FILL #335
+D11336	.FILL #336
+D11337	.FILL #337
+D11338	.FILL #338
+D11339	.FILL #339
+D11340	.FILL #340
+D11341	.FILL #341
+D11342	.FILL #342
+D11343	.FILL #343
+D11344	.FILL #344
+D11345	.FILL #345
+D11346	.FILL #346
+D11347	.FILL #347
+D11348	.FILL #348
+D11349	.FILL #349
+D11350	.FILL #350
+D11351	.FILL #351
+D11352	.FILL #352
+D11353	.FILL #353
+D11354	.FILL #354
+D11355	.FILL #355
+D11356	.FILL #356
+D11357	.FILL #357
+D11358	.FILL #358
+D11359	.FILL #359
+D11360	.FILL #360
+D11361	.FILL #361
+D11362	.FILL #362
+D11363	.FILL #363
+D11364	.FILL #364
+D11365	.FILL #365
+D11366	.FILL #366
+D11367	.FILL #367
+D11368	.FILL #368
+D11369	.FILL #369
+D11370	.FILL #370
+D11371	.FILL #371
+D11372	.FILL #372
+D11373	.FILL #373
+D11374	.FILL #374
+D11375	.FILL #375
+D11376	.FILL #376
+D11377	.FILL #377
+D11378	.FILL #378
+D11379	.FILL #379
+D11380	.FILL #380
+D11381	.FILL #381
+D11382	.FILL #382
+D11383	.FILL #383
+D11384	.FILL #384
+D11385	.FILL #385
+D11386	.FILL #386
+D11387	.FILL #387
+D11388	.FILL #388
+D11389	.FILL #389
+D11390	.FILL #390
+D11391	.FILL #391
+D11392	.FILL #392
+D11393	.FILL #393
+D11394	.FILL #394
+D11395	.FILL #395
+D11396	.FILL #396
+D11397	.FILL #397
+D11398	.FILL #398
+D11399	.FILL #399
+D11400	.FILL #400
+D11401	.FILL #401
+D11402	.FILL #402
+D11403	.FILL #403
+D11404	.FILL #404
+D11405	.FILL #405
+D11406	.FILL #406
+D11407	.FILL #407
+D11408	.FILL #408
+D11409	.FILL #409
+D11410	.FILL #410
+D11411	.FILL #411
+D11412	.FILL #412
+D11413	.FILL #413
+D11414	.FILL #414
+D11415	.FILL #415
+D11416	.FILL #416
+D11417	.FILL #417
+D11418	.FILL #418
+D11419	.FILL #419
+D11420	.FILL #420
+D11421	.FILL #421
+D11422	.FILL #422
+D11423	.FILL #423
+D11424	.FILL #424
+D11425	.FILL #425
+D11426	.FILL #426
+D11427	.FILL #427
+D11428	.FILL #428
+D11429	.FILL #429
+D11430	.FILL #430
+D11431	.FILL #431
+D11432	.FILL #432
+D11433	.FILL #433
+D11434	.FILL #434
+D11435	.FILL #435
+D11436	.FILL #436
+D11437	.FILL #437
+D11438	.FILL #438
+D11439	.FILL #439
+D11440	.FILL #440
+D11441	.FILL #441
+D11442	.FILL #442
+D11443	.FILL #443
+D11444	.FILL #444
+D11445	.FILL #445
+D11446	.FILL #446
+D11447	.FILL #447
+D11448	.FILL #448
+D11449	.FILL #449
+D11450	.FILL #450
+D11451	.FILL #451
+D11452	.FILL #452
+D11453	.FILL #453
+D11454	.FILL #454
+D11455	.FILL #455
+D11456	.FILL #456
+D11457	.FILL #457
+D11458	.FILL #458
+D11459	.FILL #459
+D11460	.FILL #460
+D11461	.FILL #461
+D11462	.FILL #462
+D11463	.FILL #463
+D11464	.FILL #464
+D11465	.FILL #465
+D11466	.FILL #466
+D11467	.FILL #467
+D11468	.FILL #468
+D11469	.FILL #469
+D11470	.FILL #470
+D11471	.FILL #471
+D11472	.FILL #472
+D11473	.FILL #473
+D11474	.FILL #474
+D11475	.FILL #475
+D11476	.FILL #476
+D11477	.FILL #477
+D11478	.FILL #478
+D11479	.FILL #479
+D11480	.FILL #480
+D11481	.FILL #481
+D11482	.FILL #482
+D11483	.FILL #483
+D11484	.FILL #484
+D11485	.FILL #485
+D11486	.FILL #486
+D11487	.FILL #487
+D11488	.FILL #488
+D11489	.FILL #489
+D11490	.FILL #490
+D11491	.FILL #491
+D11492	.FILL #492
+D11493	.FILL #493
+D11494	.FILL #494
+D11495	.FILL #495
+D11496	.FILL #496
+D11497	.FILL #497
+D11498	.FILL #498
+D11499	.FILL #499
+D11500	.FILL #500
+D11501	.FILL #501
+D11502	.FILL #502
+D11503	.FILL #503
+D11504	.FILL #504
+D11505	.FILL #505
+D11506	.FILL #506
+D11507	.FILL #507
+D11508	.FILL #508
+D11509	.FILL #509
+D11510	.FILL #510
+D11511	.FILL #511
+D11512	.FILL #512
+D11513	.FILL #513
+D11514	.FILL #514
+D11515	.FILL #515
+D11516	.FILL #516
+D11517	.FILL #517
+D11518	.FILL #518
+D11519	.FILL #519
+D11520	.FILL #520
+D11521	.FILL #521
+D11522	.FILL #522
+D11523	.FILL #523
+D11524	.FILL #524
+D11525	.FILL #525
+D11526	.FILL #526
+D11527	.FILL #527
+D11528	.FILL #528
+D11529	.FILL #529
+D11530	.FILL #530
+D11531	.FILL #531
+D11532	.FILL #532
+D11533	.FILL #533
+D11534	.FILL #534
+D11535	.FILL #535
+D11536	.FILL #536
+D11537	.FILL #537
+D11538	.FILL #538
+D11539	.FILL #539
+D11540	.FILL #540
+D11541	.FILL #541
+D11542	.FILL #542
+D11543	.FILL #543
+D11544	.FILL #544
+D11545	.FILL #545
+D11546	.FILL #546
+D11547	.FILL #547
+D11548	.FILL #548
+D11549	.FILL #549
+D11550	.FILL #550
+D11551	.FILL #551
+D11552	.FILL #552
+D11553	.FILL #553
+D11554	.FILL #554
+D11555	.FILL #555
+D11556	.FILL #556
+D11557	.FILL #557
+D11558	.FILL #558
+D11559	.FILL #559
+D11560	.FILL #560
+D11561	.FILL #561
+D11562	.FILL #562
+D11563	.FILL #563
+D11564	.FILL #564
+D11565	.FILL #565
+D11566	.FILL #566
+D11567	.FILL #567
+D11568	.FILL #568
+D11569	.FILL #569
+D11570	.FILL #570
+D11571	.FILL #571
+D11572	.FILL #572
+D11573	.FILL #573
+D11574	.FILL #574
+D11575	.FILL #575
+D11576	.FILL #576
+D11577	.FILL #577
+D11578	.FILL #578
+D11579	.FILL #579
+D11580	.FILL #580
+D11581	.FILL #581
+D11582	.FILL #582
+D11583	.FILL #583
+D11584	.FILL #584
+D11585	.FILL #585
+D11586	.FILL #586
+D11587	.FILL #587
+D11588	.FILL #588
+D11589	.FILL #589
+D11590	.FILL #590
+D11591	.FILL #591
+D11592	.FILL #592
+D11593	.FILL #593
+D11594	.FILL #594
+D11595	.FILL #595
+D11596	.FILL #596
+D11597	.FILL #597
+D11598	.FILL #598
+D11599	.FILL #599
+D11600	.FILL #600
+D11601	.FILL #601
+D11602	.FILL #602
+D11603	.FILL #603
+D11604	.FILL #604
+D11605	.FILL #605
+D11606	.FILL #606
+D11607	.FILL #607
+D11608	.FILL #608
+D11609	.FILL #609
+D11610	.FILL #610
+D11611	.FILL #611
+D11612	.FILL #612
+D11613	.FILL #613
+D11614	.FILL #614
+D11615	.FILL #615
+D11616	.FILL #616
+D11617	.FILL #617
+D11618	.FILL #618
+D11619	.FILL #619
+D11620	.FILL #620
+D11621	.FILL #621
+D11622	.FILL #622
+D11623	.FILL #623
+D11624	.FILL #624
+D11625	.FILL #625
+D11626	.FILL #626
+D11627	.FILL #627
+D11628	.FILL #628
+D11629	.FILL #629
+D11630	.FILL #630
+D11631	.FILL #631
+D11632	.FILL #632
+D11633	.FILL #633
+D11634	.FILL #634
+D11635	.FILL #635
+D11636	.FILL #636
+D11637	.FILL #637
+D11638	.FILL #638
+D11639	.FILL #639
+D11640	.FILL #640
+D11641	.FILL #641
+D11642	.FILL #642
+D11643	.FILL #643
+D11644	.FILL #644
+D11645	.FILL #645
+D11646	.FILL #646
+D11647	.FILL #647
+D11648	.FILL #648
+D11649	.FILL #649
+D11650	.FILL #650
+D11651	.FILL #651
+D11652	.FILL #652
+D11653	.FILL #653
+D11654	.FILL #654
+D11655	.FILL #655
+D11656	.FILL #656
+D11657	.FILL #657
+D11658	.FILL #658
+D11659	.FILL #659
+D11660	.FILL #660
+D11661	.FILL #661
+D11662	.FILL #662
+D11663	.FILL #663
+D11664	.FILL #664
+D11665	.FILL #665
+D11666	.FILL #666
+D11667	.FILL #667
+D11668	.FILL #668
+D11669	.FILL #669
+D11670	.FILL #670
+D11671	.FILL #671
+D11672	.FILL #672
+D11673	.FILL #673
+D11674	.FILL #674
+D11675	.FILL #675
+D11676	.FILL #676
+D11677	.FILL #677
+D11678	.FILL #678
+D11679	.FILL #679
+D11680	.FILL #680
+D11681	.FILL #681
+D11682	.FILL #682
+D11683	.FILL #683
+D11684	.FILL #684
+D11685	.FILL #685
+D11686	.FILL #686
+D11687	.FILL #687
+D11688	.FILL #688
+D11689	.FILL #689
+D11690	.FILL #690
+D11691	.FILL #691
+D11692	.FILL #692
+D11693	.FILL #693
+D11694	.FILL #694
+D11695	.FILL #695
+D11696	.FILL #696
+D11697	.FILL #697
+D11698	.FILL #698
+D11699	.FILL #699
+D11700	.FILL #700
+D11701	.FILL #701
+D11702	.FILL #702
+D11703	.FILL #703
+D11704	.FILL #704
+D11705	.FILL #705
+D11706	.FILL #706
+D11707	.FILL #707
+D11708	.FILL #708
+D11709	.FILL #709
+D11710	.FILL #710
+D11711	.FILL #711
+D11712	.FILL #712
+D11713	.FILL #713
+D11714	.FILL #714
+D11715	.FILL #715
+D11716	.FILL #716
+D11717	.FILL #717
+D11718	.FILL #718
+D11719	.FILL #719
+D11720	.FILL #720
+D11721	.FILL #721
+D11722	.FILL #722
+D11723	.FILL #723
+D11724	.FILL #724
+D11725	.FILL #725
+D11726	.FILL #726
+D11727	.FILL #727
+D11728	.FILL #728
+D11729	.FILL #729
+D11730	.FILL #730
+D11731	.FILL #731
+D11732	.FILL #732
+D11733	.FILL #733
+D11734	.FILL #734
+D11735	.FILL #735
+D11736	.FILL #736
+D11737	.FILL #737
+D11738	.FILL #738
+D11739	.FILL #739
+D11740	.FILL #740
+D11741	.FILL #741
+D11742	.FILL #742
+D11743	.FILL #743
+D11744	.FILL #744
+D11745	.FILL #745
+D11746	.FILL #746
+D11747	.FILL #747
+D11748	.FILL #748
+D11749	.FILL #749
+D11750	.FILL #750
+D11751	.FILL #751
+D11752	.FILL #752
+D11753	.FILL #753
+D11754	.FILL #754
+D11755	.FILL #755
+D11756	.FILL #756
+D11757	.FILL #757
+D11758	.FILL #758
+D11759	.FILL #759
+D11760	.FILL #760
+D11761	.FILL #761
+D11762	.FILL #762
+D11763	.FILL #763
+D11764	.FILL #764
+D11765	.FILL #765
+D11766	.FILL #766
+D11767	.FILL #767
+D11768	.FILL #768
+D11769	.FILL #769
+D11770	.FILL #770
+D11771	.FILL #771
+D11772	.FILL #772
+D11773	.FILL #773
+D11774	.FILL #774
+D11775	.FILL #775
+D11776	.FILL #776
+D11777	.FILL #777
+D11778	.FILL #778
+D11779	.FILL #779
+D11780	.FILL #780
+D11781	.FILL #781
+D11782	.FILL #782
+D11783	.FILL #783
+D11784	.FILL #784
+D11785	.FILL #785
+D11786	.FILL #786
+D11787	.FILL #787
+D11788	.FILL #788
+D11789	.FILL #789
+D11790	.FILL #790
+D11791	.FILL #791
+D11792	.FILL #792
+D11793	.FILL #793
+D11794	.FILL #794
+D11795	.FILL #795
+D11796	.FILL #796
+D11797	.FILL #797
+D11798	.FILL #798
+D11799	.FILL #799
+D11800	.FILL #800
+D11801	.FILL #801
+D11802	.FILL #802
+D11803	.FILL #803
+D11804	.FILL #804
+D11805	.FILL #805
+D11806	.FILL #806
+D11807	.FILL #807
+D11808	.FILL #808
+D11809	.FILL #809
+D11810	.FILL #810
+D11811	.FILL #811
+D11812	.FILL #812
+D11813	.FILL #813
+D11814	.FILL #814
+D11815	.FILL #815
+D11816	.FILL #816
+D11817	.FILL #817
+D11818	.FILL #818
+D11819	.FILL #819
+D11820	.FILL #820
+D11821	.FILL #821
+D11822	.FILL #822
+D11823	.FILL #823
+D11824	.FILL #824
+D11825	.FILL #825
+D11826	.FILL #826
+D11827	.FILL #827
+D11828	.FILL #828
+D11829	.FILL #829
+D11830	.FILL #830
+D11831	.FILL #831
+D11832	.FILL #832
+D11833	.FILL #833
+D11834	.FILL #834
+D11835	.FILL #835
+D11836	.FILL #836
+D11837	.FILL #837
+D11838	.FILL #838
+D11839	.FILL #839
+D11840	.FILL #840
+D11841	.FILL #841
+D11842	.FILL #842
+D11843	.FILL #843
+D11844	.FILL #844
+D11845	.FILL #845
+D11846	.FILL #846
+D11847	.FILL #847
+D11848	.FILL #848
+D11849	.FILL #849
+D11850	.FILL #850
+D11851	.FILL #851
+D11852	.FILL #852
+D11853	.FILL #853
+D11854	.FILL #854
+D11855	.FILL #855
+D11856	.FILL #856
+D11857	.FILL #857
+D11858	.FILL #858
+D11859	.FILL #859
+D11860	.FILL #860
+D11861	.FILL #861
+D11862	.FILL #862
+D11863	.FILL #863
+D11864	.FILL #864
+D11865	.FILL #865
+D11866	.FILL #866
+D11867	.FILL #867
+D11868	.FILL #868
+D11869	.FILL #869
+D11870	.FILL #870
+D11871	.FILL #871
+D11872	.FILL #872
+D11873	.FILL #873
+D11874	.FILL #874
+D11875	.FILL #875
+D11876	.FILL #876
+D11877	.FILL #877
+D11878	.FILL #878
+D11879	.FILL #879
+D11880	.FILL #880
+D11881	.FILL #881
+D11882	.FILL #882
+D11883	.FILL #883
+D11884	.FILL #884
+D11885	.FILL #885
+D11886	.FILL #886
+D11887	.FILL #887
+D11888	.FILL #888
+D11889	.FILL #889
+D11890	.FILL #890
+D11891	.FILL #891
+D11892	.FILL #892
+D11893	.FILL #893
+D11894	.FILL #894
+D11895	.FILL #895
+D11896	.FILL #896
+D11897	.FILL #897
+D11898	.FILL #898
+D11899	.FILL #899
+D11900	.FILL #900
+D11901	.FILL #901
+D11902	.FILL #902
+D11903	.FILL #903
+D11904	.FILL #904
+D11905	.FILL #905
+D11906	.FILL #906
+D11907	.FILL #907
+D11908	.FILL #908
+D11909	.FILL #909
+D11910	.FILL #910
+D11911	.FILL #911
+D11912	.FILL #912
+D11913	.FILL #913
+D11914	.FILL #914
+D11915	.FILL #915
+D11916	.FILL #916
+D11917	.FILL #917
+D11918	.FILL #918
+D11919	.FILL #919
+D11920	.FILL #920
+D11921	.FILL #921
+D11922	.FILL #922
+D11923	.FILL #923
+D11924	.FILL #924
+D11925	.FILL #925
+D11926	.FILL #926
+D11927	.FILL #927
+D11928	.FILL #928
+D11929	.FILL #929
+D11930	.FILL #930
+D11931	.FILL #931
+D11932	.FILL #932
+D11933	.FILL #933
+D11934	.FILL #934
+D11935	.FILL #935
+D11936	.FILL #936
+D11937	.FILL #937
+D11938	.FILL #938
+D11939	.FILL #939
+D11940	.FILL #940
+D11941	.FILL #941
+D11942	.FILL #942
+D11943	.FILL #943
+D11944	.FILL #944
+D11945	.FILL #945
+D11946	.FILL #946
+D11947	.FILL #947
+D11948	.FILL #948
+D11949	.FILL #949
+D11950	.FILL #950
+D11951	.FILL #951
+D11952	.FILL #952
+D11953	.FILL #953
+D11954	.FILL #954
+D11955	.FILL #955
+D11956	.FILL #956
+D11957	.FILL #957
+D11958	.FILL #958
+D11959	.FILL #959
+D11960	.FILL #960
+D11961	.FILL #961
+D11962	.FILL #962
+D11963	.FILL #963
+D11964	.FILL #964
+D11965	.FILL #965
+D11966	.FILL #966
+D11967	.FILL #967
+D11968	.FILL #968
+D11969	.FILL #969
+D11970	.FILL #970
+D11971	.FILL #971
+D11972	.FILL #972
+D11973	.FILL #973
+D11974	.FILL #974
+D11975	.FILL #975
+D11976	.FILL #976
+D11977	.FILL #977
+D11978	.FILL #978
+D11979	.FILL #979
+D11980	.FILL #980
+D11981	.FILL #981
+D11982	.FILL #982
+D11983	.FILL #983
+D11984	.FILL #984
+D11985	.FILL #985
+D11986	.FILL #986
+D11987	.FILL #987
+D11988	.FILL #988
+D11989	.FILL #989
+D11990	.FILL #990
+D11991	.FILL #991
+D11992	.FILL #992
+D11993	.FILL #993
+D11994	.FILL #994
+D11995	.FILL #995
+D11996	.FILL #996
+D11997	.FILL #997
+D11998	.FILL #998
+D11999	.FILL #999
+D12000	.FILL #0
+D12001	.FILL #1
+D12002	.FILL #2
+D12003	.FILL #3
+D12004	.FILL #4
+D12005	.FILL #5
+D12006	.FILL #6
+D12007	.FILL #7
+D12008	.FILL #8
+D12009	.FILL #9
+D12010	.FILL #10
+D12011	.FILL #11
+D12012	.FILL #12
+D12013	.FILL #13
+D12014	.FILL #14
+D12015	.FILL #15
+D12016	.FILL #16
+D12017	.FILL #17
+D12018	.FILL #18
+D12019	.FILL #19
+D12020	.FILL #20
+D12021	.FILL #21
+D12022	.FILL #22
+D12023	.FILL #23
+D12024	.FILL #24
+D12025	.FILL #25
+D12026	.FILL #26
+D12027	.FILL #27
+D12028	.FILL #28
+D12029	.FILL #29
+D12030	.FILL #30
+D12031	.FILL #31
+D12032	.FILL #32
+D12033	.FILL #33
+D12034	.FILL #34
+D12035	.FILL #35
+D12036	.FILL #36
+D12037	.FILL #37
+D12038	.FILL #38
+D12039	.FILL #39
+D12040	.FILL #40
+D12041	.FILL #41
+D12042	.FILL #42
+D12043	.FILL #43
+D12044	.FILL #44
+D12045	.FILL #45
+D12046	.FILL #46
+D12047	.FILL #47
+D12048	.FILL #48
+D12049	.FILL #49
+D12050	.FILL #50
+D12051	.FILL #51
+D12052	.FILL #52
+D12053	.FILL #53
+D12054	.FILL #54
+D12055	.FILL #55
+D12056	.FILL #56
+D12057	.FILL #57
+D12058	.FILL #58
+D12059	.FILL #59
+D12060	.FILL #60
+D12061	.FILL #61
+D12062	.FILL #62
+D12063	.FILL #63
+D12064	.FILL #64
+D12065	.FILL #65
+D12066	.FILL #66
+D12067	.FILL #67
+D12068	.FILL #68
+D12069	.FILL #69
+D12070	.FILL #70
+D12071	.FILL #71
+D12072	.FILL #72
+D12073	.FILL #73
+D12074	.FILL #74
+D12075	.FILL #75
+D12076	.FILL #76
+D12077	.FILL #77
+D12078	.FILL #78
+D12079	.FILL #79
+D12080	.FILL #80
+D12081	.FILL #81
+D12082	.FILL #82
+D12083	.FILL #83
+D12084	.FILL #84
+D12085	.FILL #85
+D12086	.FILL #86
+D12087	.FILL #87
+D12088	.FILL #88
+D12089	.FILL #89
+D12090	.FILL #90
+D12091	.FILL #91
+D12092	.FILL #92
+D12093	.FILL #93
+D12094	.FILL #94
+D12095	.FILL #95
+D12096	.FILL #96
+D12097	.FILL #97
+D12098	.FILL #98
+D12099	.FILL #99
+D12100	.FILL #100
+D12101	.FILL #101
+D12102	.FILL #102
+D12103	.FILL #103
+D12104	.FILL #104
+D12105	.FILL #105
+D12106	.FILL #106
+D12107	.FILL #107
+D12108	.FILL #108
+D12109	.FILL #109
+D12110	.FILL #110
+D12111	.FILL #111
+D12112	.FILL #112
+D12113	.FILL #113
+D12114	.FILL #114
+D12115	.FILL #115
+D12116	.FILL #116
+D12117	.FILL #117
+D12118	.FILL #118
+D12119	.FILL #119
+D12120	.FILL #120
+D12121	.FILL #121
+D12122	.FILL #122
+D12123	.FILL #123
+D12124	.FILL #124
+D12125	.FILL #125
+D12126	.FILL #126
+D12127	.FILL #127
+D12128	.FILL #128
+D12129	.FILL #129
+D12130	.FILL #130
+D12131	.FILL #131
+D12132	.FILL #132
+D12133	.FILL #133
+D12134	.FILL #134
+D12135	.FILL #135
+D12136	.FILL #136
+D12137	.FILL #137
+D12138	.FILL #138
+D12139	.FILL #139
+D12140	.FILL #140
+D12141	.FILL #141
+D12142	.FILL #142
+D12143	.FILL #143
+D12144	.FILL #144
+D12145	.FILL #145
+D12146	.FILL #146
+D12147	.FILL #147
+D12148	.FILL #148
+D12149	.FILL #149
+D12150	.FILL #150
+D12151	.FILL #151
+D12152	.FILL #152
+D12153	.FILL #153
+D12154	.FILL #154
+D12155	.FILL #155
+D12156	.FILL #156
+D12157	.FILL #157
+D12158	.FILL #158
+D12159	.FILL #159
+D12160	.FILL #160
+D12161	.FILL #161
+D12162	.FILL #162
+D12163	.FILL #163
+D12164	.FILL #164
+D12165	.FILL #165
+D12166	.FILL #166
+D12167	.FILL #167
+D12168	.FILL #168
+D12169	.FILL #169
+D12170	.FILL #170
+D12171	.FILL #171
+D12172	.FILL #172
+D12173	.FILL #173
+D12174	.FILL #174
+D12175	.FILL #175
+D12176	.FILL #176
+D12177	.FILL #177
+D12178	.FILL #178
+D12179	.FILL #179
+D12180	.FILL #180
+D12181	.FILL #181
+D12182	.FILL #182
+D12183	.FILL #183
+D12184	.FILL #184
+D12185	.FILL #185
+D12186	.FILL #186
+D12187	.FILL #187
+D12188	.FILL #188
+D12189	.FILL #189
+D12190	.FILL #190
+D12191	.FILL #191
+D12192	.FILL #192
+D12193	.FILL #193
+D12194	.FILL #194
+D12195	.FILL #195
+D12196	.FILL #196
+D12197	.FILL #197
+D12198	.FILL #198
+D12199	.FILL #199
+D12200	.FILL #200
+D12201	.FILL #201
+D12202	.FILL #202
+D12203	.FILL #203
+D12204	.FILL #204
+D12205	.FILL #205
+D12206	.FILL #206
+D12207	.FILL #207
+D12208	.FILL #208
+D12209	.FILL #209
+D12210	.FILL #210
+D12211	.FILL #211
+D12212	.FILL #212
+D12213	.FILL #213
+D12214	.FILL #214
+D12215	.FILL #215
+D12216	.FILL #216
+D12217	.FILL #217
+D12218	.FILL #218
+D12219	.FILL #219
+D12220	.FILL #220
+D12221	.FILL #221
+D12222	.FILL #222
+D12223	.FILL #223
+D12224	.FILL #224
+D12225	.FILL #225
+D12226	.FILL #226
+D12227	.FILL #227
+D12228	.FILL #228
+D12229	.FILL #229
+D12230	.FILL #230
+D12231	.FILL #231
+D12232	.FILL #232
+D12233	.FILL #233
+D12234	.FILL #234
+D12235	.FILL #235
+D12236	.FILL #236
+D12237	.FILL #237
+D12238	.FILL #238
+D12239	.FILL #239
+D12240	.FILL #240
+D12241	.FILL #241
+D12242	.FILL #242
+D12243	.FILL #243
+D12244	.FILL #244
+D12245	.FILL #245
+D12246	.FILL #246
+D12247	.FILL #247
+D12248	.FILL #248
+D12249	.FILL #249
+D12250	.FILL #250
+D12251	.FILL #251
+D12252	.FILL #252
+D12253	.FILL #253
+D12254	.FILL #254
+D12255	.FILL #255
+D12256	.FILL #256
+D12257	.FILL #257
+D12258	.FILL #258
+D12259	.FILL #259
+D12260	.FILL #260
+D12261	.FILL #261
+D12262	.FILL #262
+D12263	.FILL #263
+D12264	.FILL #264
+D12265	.FILL #265
+D12266	.FILL #266
+D12267	.FILL #267
+D12268	.FILL #268
+D12269	.FILL #269
+D12270	.FILL #270
+D12271	.FILL #271
+D12272	.FILL #272
+D12273	.FILL #273
+D12274	.FILL #274
+D12275	.FILL #275
+D12276	.FILL #276
+D12277	.FILL #277
+D12278	.FILL #278
+D12279	.FILL #279
+D12280	.FILL #280
+D12281	.FILL #281
+D12282	.FILL #282
+D12283	.FILL #283
+D12284	.FILL #284
+D12285	.FILL #285
+D12286	.FILL #286
+D12287	.FILL #287
+D12288	.FILL #288
+D12289	.FILL #289
+D12290	.FILL #290
+D12291	.FILL #291
+D12292	.FILL #292
+D12293	.FILL #293
+D12294	.FILL #294
+D12295	.FILL #295
+D12296	.FILL #296
+D12297	.FILL #297
+D12298	.FILL #298
+D12299	.FILL #299
+D12300	.FILL #300
+D12301	.FILL #301
+D12302	.FILL #302
+D12303	.FILL #303
+D12304	.FILL #304
+D12305	.FILL #305
+D12306	.FILL #306
+D12307	.FILL #307
+D12308	.FILL #308
+D12309	.FILL #309
+D12310	.FILL #310
+D12311	.FILL #311
+D12312	.FILL #312
+D12313	.FILL #313
+D12314	.FILL #314
+D12315	.FILL #315
+D12316	.FILL #316
+D12317	.FILL #317
+D12318	.FILL #318
+D12319	.FILL #319
+D12320	.FILL #320
+D12321	.FILL #321
+D12322	.FILL #322
+D12323	.FILL #323
+D12324	.FILL #324
+D12325	.FILL #325
+D12326	.FILL #326
+D12327	.FILL #327
+D12328	.FILL #328
+D12329	.FILL #329
+D12330	.FILL #330
+D12331	.FILL #331
+D12332	.FILL #332
+D12333	.FILL #333
+D12334	.FILL #334
+D12335	.FILL #335
+D12336	.FILL #336
+D12337	.FILL #337
+D12338	.FILL #338
+D12339	.FILL #339
+D12340	.FILL #340
+D12341	.FILL #341
+D12342	.FILL #342
+D12343	.FILL #343
+D12344	.FILL #344
+D12345	.FILL #345
+D12346	.FILL #346
+D12347	.FILL #347
+D12348	.FILL #348
+D12349	.FILL #349
+D12350	.FILL #350
+D12351	.FILL #351
+D12352	.FILL #352
+D12353	.FILL #353
+D12354	.FILL #354
+D12355	.FILL #355
+D12356	.FILL #356
+D12357	.FILL #357
+D12358	.FILL #358
+D12359	.FILL #359
+D12360	.FILL #360
+D12361	.FILL #361
+D12362	.FILL #362
+D12363	.FILL #363
+D12364	.FILL #364
+D12365	.FILL #365
+D12366	.FILL #366
+D12367	.FILL #367
+D12368	.FILL #368
+D12369	.FILL #369
+D12370	.FILL #370
+D12371	.FILL #371
+D12372	.FILL #372
+D12373	.FILL #373
+D12374	.FILL #374
+D12375	.FILL #375
+D12376	.FILL #376
+D12377	.FILL #377
+D12378	.FILL #378
+D12379	.FILL #379
+D12380	.FILL #380
+D12381	.FILL #381
+D12382	.FILL #382
+D12383	.FILL #383
+D12384	.FILL #384
+D12385	.FILL #385
+D12386	.FILL #386
+D12387	.FILL #387
+D12388	.FILL #388
+D12389	.FILL #389
+D12390	.FILL #390
+D12391	.FILL #391
+D12392	.FILL #392
+D12393	.FILL #393
+D12394	.FILL #394
+D12395	.FILL #395
+D12396	.FILL #396
+D12397	.FILL #397
+D12398	.FILL #398
+D12399	.FILL #399
+D12400	.FILL #400
+D12401	.FILL #401
+D12402	.FILL #402
+D12403	.FILL #403
+D12404	.FILL #404
+D12405	.FILL #405
+D12406	.FILL #406
+D12407	.FILL #407
+D12408	.FILL #408
+D12409	.FILL #409
+D12410	.FILL #410
+D12411	.FILL #411
+D12412	.FILL #412
+D12413	.FILL #413
+D12414	.FILL #414
+D12415	.FILL #415
+D12416	.FILL #416
+D12417	.FILL #417
+D12418	.FILL #418
+D12419	.FILL #419
+D12420	.FILL #420
+D12421	.FILL #421
+D12422	.FILL #422
+D12423	.FILL #423
+D12424	.FILL #424
+D12425	.FILL #425
+D12426	.FILL #426
+D12427	.FILL #427
+D12428	.FILL #428
+D12429	.FILL #429
+D12430	.FILL #430
+D12431	.FILL #431
+D12432	.FILL #432
+D12433	.FILL #433
+D12434	.FILL #434
+D12435	.FILL #435
+D12436	.FILL #436
+D12437	.FILL #437
+D12438	.FILL #438
+D12439	.FILL #439
+D12440	.FILL #440
+D12441	.FILL #441
+D12442	.FILL #442
+D12443	.FILL #443
+D12444	.FILL #444
+D12445	.FILL #445
+D12446	.FILL #446
+D12447	.FILL #447
+D12448	.FILL #448
+D12449	.FILL #449
+D12450	.FILL #450
+D12451	.FILL #451
+D12452	.FILL #452
+D12453	.FILL #453
+D12454	.FILL #454
+D12455	.FILL #455
+D12456	.FILL #456
+D12457	.FILL #457
+D12458	.FILL #458
+D12459	.FILL #459
+D12460	.FILL #460
+D12461	.FILL #461
+D12462	.FILL #462
+D12463	.FILL #463
+D12464	.FILL #464
+D12465	.FILL #465
+D12466	.FILL #466
+D12467	.FILL #467
+D12468	.FILL #468
+D12469	.FILL #469
+D12470	.FILL #470
+D12471	.FILL #471
+D12472	.FILL #472
+D12473	.FILL #473
+D12474	.FILL #474
+D12475	.FILL #475
+D12476	.FILL #476
+D12477	.FILL #477
+D12478	.FILL #478
+D12479	.FILL #479
+D12480	.FILL #480
+D12481	.FILL #481
+D12482	.FILL #482
+D12483	.FILL #483
+D12484	.FILL #484
+D12485	.FILL #485
+D12486	.FILL #486
+D12487	.FILL #487
+D12488	.FILL #488
+D12489	.FILL #489
+D12490	.FILL #490
+D12491	.FILL #491
+D12492	.FILL #492
+D12493	.FILL #493
+D12494	.FILL #494
+D12495	.FILL #495
+D12496	.FILL #496
+D12497	.FILL #497
+D12498	.FILL #498
+D12499	.FILL #499
+D12500	.FILL #500
+D12501	.FILL #501
+D12502	.FILL #502
+D12503	.FILL #503
+D12504	.FILL #504
+D12505	.FILL #505
+D12506	.FILL #506
+D12507	.FILL #507
+D12508	.FILL #508
+D12509	.FILL #509
+D12510	.FILL #510
+D12511	.FILL #511
+D12512	.FILL #512
+D12513	.FILL #513
+D12514	.FILL #514
+D12515	.FILL #515
+D12516	.FILL #516
+D12517	.FILL #517
+D12518	.FILL #518
+D12519	.FILL #519
+D12520	.FILL #520
+D12521	.FILL #521
+D12522	.FILL #522
+D12523	.FILL #523
+D12524	.FILL #524
+D12525	.FILL #525
+D12526	.FILL #526
+D12527	.FILL #527
+D12528	.FILL #528
+D12529	.FILL #529
+D12530	.FILL #530
+D12531	.FILL #531
+D12532	.FILL #532
+D12533	.FILL #533
+D12534	.FILL #534
+D12535	.FILL #535
+D12536	.FILL #536
+D12537	.FILL #537
+D12538	.FILL #538
+D12539	.FILL #539
+D12540	.FILL #540
+D12541	.FILL #541
+D12542	.FILL #542
+D12543	.FILL #543
+D12544	.FILL #544
+D12545	.FILL #545
+D12546	.FILL #546
+D12547	.FILL #547
+D12548	.FILL #548
+D12549	.FILL #549
+D12550	.FILL #550
+D12551	.FILL #551
+D12552	.FILL #552
+D12553	.FILL #553
+D12554	.FILL #554
+D12555	.FILL #555
+D12556	.FILL #556
+D12557	.FILL #557
+D12558	.FILL #558
+D12559	.FILL #559
+D12560	.FILL #560
+D12561	.FILL #561
+D12562	.FILL #562
+D12563	.FILL #563
+D12564	.FILL #564
+D12565	.FILL #565
+D12566	.FILL #566
+D12567	.FILL #567
+D12568	.FILL #568
+D12569	.FILL #569
+D12570	.FILL #570
+D12571	.FILL #571
+D12572	.FILL #572
+D12573	.FILL #573
+D12574	.FILL #574
+D12575	.FILL #575
+D12576	.FILL #576
+D12577	.FILL #577
+D12578	.FILL #578
+D12579	.FILL #579
+D12580	.FILL #580
+D12581	.FILL #581
+D12582	.FILL #582
+D12583	.FILL #583
+D12584	.FILL #584
+D12585	.FILL #585
+D12586	.FILL #586
+D12587	.FILL #587
+D12588	.FILL #588
+D12589	.FILL #589
+D12590	.FILL #590
+D12591	.FILL #591
+D12592	.FILL #592
+D12593	.FILL #593
+D12594	.FILL #594
+D12595	.FILL #595
+D12596	.FILL #596
+D12597	.FILL #597
+D12598	.FILL #598
+D12599	.FILL #599
+D12600	.FILL #600
+D12601	.FILL #601
+D12602	.FILL #602
+D12603	.FILL #603
+D12604	.FILL #604
+D12605	.FILL #605
+D12606	.FILL #606
+D12607	.FILL #607
+D12608	.FILL #608
+D12609	.FILL #609
+D12610	.FILL #610
+D12611	.FILL #611
+D12612	.FILL #612
+D12613	.FILL #613
+D12614	.FILL #614
+D12615	.FILL #615
+D12616	.FILL #616
+D12617	.FILL #617
+D12618	.FILL #618
+D12619	.FILL #619
+D12620	.FILL #620
+D12621	.FILL #621
+D12622	.FILL #622
+D12623	.FILL #623
+D12624	.FILL #624
+D12625	.FILL #625
+D12626	.FILL #626
+D12627	.FILL #627
+D12628	.FILL #628
+D12629	.FILL #629
+D12630	.FILL #630
+D12631	.FILL #631
+D12632	.FILL #632
+D12633	.FILL #633
+D12634	.FILL #634
+D12635	.FILL #635
+D12636	.FILL #636
+D12637	.FILL #637
+D12638	.FILL #638
+D12639	.FILL #639
+D12640	.FILL #640
+D12641	.FILL #641
+D12642	.FILL #642
+D12643	.FILL #643
+D12644	.FILL #644
+D12645	.FILL #645
+D12646	.FILL #646
+D12647	.FILL #647
+D12648	.FILL #648
+D12649	.FILL #649
+D12650	.FILL #650
+D12651	.FILL #651
+D12652	.FILL #652
+D12653	.FILL #653
+D12654	.FILL #654
+D12655	.FILL #655
+D12656	.FILL #656
+D12657	.FILL #657
+D12658	.FILL #658
+D12659	.FILL #659
+D12660	.FILL #660
+D12661	.FILL #661
+D12662	.FILL #662
+D12663	.FILL #663
+D12664	.FILL #664
+D12665	.FILL #665
+D12666	.FILL #666
+D12667	.FILL #667
+D12668	.FILL #668
+D12669	.FILL #669
+D12670	.FILL #670
+D12671	.FILL #671
+D12672	.FILL #672
+D12673	.FILL #673
+D12674	.FILL #674
+D12675	.FILL #675
+D12676	.FILL #676
+D12677	.FILL #677
+D12678	.FILL #678
+D12679	.FILL #679
+D12680	.FILL #680
+D12681	.FILL #681
+D12682	.FILL #682
+D12683	.FILL #683
+D12684	.FILL #684
+D12685	.FILL #685
+D12686	.FILL #686
+D12687	.FILL #687
+D12688	.FILL #688
+D12689	.FILL #689
+D12690	.FILL #690
+D12691	.FILL #691
+D12692	.FILL #692
+D12693	.FILL #693
+D12694	.FILL #694
+D12695	.FILL #695
+D12696	.FILL #696
+D12697	.FILL #697
+D12698	.FILL #698
+D12699	.FILL #699
+D12700	.FILL #700
+D12701	.FILL #701
+D12702	.FILL #702
+D12703	.FILL #703
+D12704	.FILL #704
+D12705	.FILL #705
+D12706	.FILL #706
+D12707	.FILL #707
+D12708	.FILL #708
+D12709	.FILL #709
+D12710	.FILL #710
+D12711	.FILL #711
+D12712	.FILL #712
+D12713	.FILL #713
+D12714	.FILL #714
+D12715	.FILL #715
+D12716	.FILL #716
+D12717	.FILL #717
+D12718	.FILL #718
+D12719	.FILL #719
+D12720	.FILL #720
+D12721	.FILL #721
+D12722	.FILL #722
+D12723	.FILL #723
+D12724	.FILL #724
+D12725	.FILL #725
+D12726	.FILL #726
+D12727	.FILL #727
+D12728	.FILL #728
+D12729	.FILL #729
+D12730	.FILL #730
+D12731	.FILL #731
+D12732	.FILL #732
+D12733	.FILL #733
+D12734	.FILL #734
+D12735	.FILL #735
+D12736	.FILL #736
+D12737	.FILL #737
+D12738	.FILL #738
+D12739	.FILL #739
+D12740	.FILL #740
+D12741	.FILL #741
+D12742	.FILL #742
+D12743	.FILL #743
+D12744	.FILL #744
+D12745	.FILL #745
+D12746	.FILL #746
+D12747	.FILL #747
+D12748	.FILL #748
+D12749	.FILL #749
+D12750	.FILL #750
+D12751	.FILL #751
+D12752	.FILL #752
+D12753	.FILL #753
+D12754	.FILL #754
+D12755	.FILL #755
+D12756	.FILL #756
+D12757	.FILL #757
+D12758	.FILL #758
+D12759	.FILL #759
+D12760	.FILL #760
+D12761	.FILL #761
+D12762	.FILL #762
+D12763	.FILL #763
+D12764	.FILL #764
+D12765	.FILL #765
+D12766	.FILL #766
+D12767	.FILL #767
+D12768	.FILL #768
+D12769	.FILL #769
+D12770	.FILL #770
+D12771	.FILL #771
+D12772	.FILL #772
+D12773	.FILL #773
+D12774	.FILL #774
+D12775	.FILL #775
+D12776	.FILL #776
+D12777	.FILL #777
+D12778	.FILL #778
+D12779	.FILL #779
+D12780	.FILL #780
+D12781	.FILL #781
+D12782	.FILL #782
+D12783	.FILL #783
+D12784	.FILL #784
+D12785	.FILL #785
+D12786	.FILL #786
+D12787	.FILL #787
+D12788	.FILL #788
+D12789	.FILL #789
+D12790	.FILL #790
+D12791	.FILL #791
+D12792	.FILL #792
+D12793	.FILL #793
+D12794	.FILL #794
+D12795	.FILL #795
+D12796	.FILL #796
+D12797	.FILL #797
+D12798	.FILL #798
+D12799	.FILL #799
+D12800	.FILL #800
+D12801	.FILL #801
+D12802	.FILL #802
+D12803	.FILL #803
+D12804	.FILL #804
+D12805	.FILL #805
+D12806	.FILL #806
+D12807	.FILL #807
+D12808	.FILL #808
+D12809	.FILL #809
+D12810	.FILL #810
+D12811	.FILL #811
+D12812	.FILL #812
+D12813	.FILL #813
+D12814	.FILL #814
+D12815	.FILL #815
+D12816	.FILL #816
+D12817	.FILL #817
+D12818	.FILL #818
+D12819	.FILL #819
+D12820	.FILL #820
+D12821	.FILL #821
+D12822	.FILL #822
+D12823	.FILL #823
+D12824	.FILL #824
+D12825	.FILL #825
+D12826	.FILL #826
+D12827	.FILL #827
+D12828	.FILL #828
+D12829	.FILL #829
+D12830	.FILL #830
+D12831	.FILL #831
+D12832	.FILL #832
+D12833	.FILL #833
+D12834	.FILL #834
+D12835	.FILL #835
+D12836	.FILL #836
+D12837	.FILL #837
+D12838	.FILL #838
+D12839	.FILL #839
+D12840	.FILL #840
+D12841	.FILL #841
+D12842	.FILL #842
+D12843	.FILL #843
+D12844	.FILL #844
+D12845	.FILL #845
+D12846	.FILL #846
+D12847	.FILL #847
+D12848	.FILL #848
+D12849	.FILL #849
+D12850	.FILL #850
+D12851	.FILL #851
+D12852	.FILL #852
+D12853	.FILL #853
+D12854	.FILL #854
+D12855	.FILL #855
+D12856	.FILL #856
+D12857	.FILL #857
+D12858	.FILL #858
+D12859	.FILL #859
+D12860	.FILL #860
+D12861	.FILL #861
+D12862	.FILL #862
+D12863	.FILL #863
+D12864	.FILL #864
+D12865	.FILL #865
+D12866	.FILL #866
+D12867	.FILL #867
+D12868	.FILL #868
+D12869	.FILL #869
+D12870	.FILL #870
+D12871	.FILL #871
+D12872	.FILL #872
+D12873	.FILL #873
+D12874	.FILL #874
+D12875	.FILL #875
+D12876	.FILL #876
+D12877	.FILL #877
+D12878	.FILL #878
+D12879	.FILL #879
+D12880	.FILL #880
+D12881	.FILL #881
+D12882	.FILL #882
+D12883	.FILL #883
+D12884	.FILL #884
+D12885	.FILL #885
+D12886	.FILL #886
+D12887	.FILL #887
+D12888	.FILL #888
+D12889	.FILL #889
+D12890	.FILL #890
+D12891	.FILL #891
+D12892	.FILL #892
+D12893	.FILL #893
+D12894	.FILL #894
+D12895	.FILL #895
+D12896	.FILL #896
+D12897	.FILL #897
+D12898	.FILL #898
+D12899	.FILL #899
+D12900	.FILL #900
+D12901	.FILL #901
+D12902	.FILL #902
+D12903	.FILL #903
+D12904	.FILL #904
+D12905	.FILL #905
+D12906	.FILL #906
+D12907	.FILL #907
+D12908	.FILL #908
+D12909	.FILL #909
+D12910	.FILL #910
+D12911	.FILL #911
+D12912	.FILL #912
+D12913	.FILL #913
+D12914	.FILL #914
+D12915	.FILL #915
+D12916	.FILL #916
+D12917	.FILL #917
+D12918	.FILL #918
+D12919	.FILL #919
+D12920	.FILL #920
+D12921	.FILL #921
+D12922	.FILL #922
+D12923	.FILL #923
+D12924	.FILL #924
+D12925	.FILL #925
+D12926	.FILL #926
+D12927	.FILL #927
+D12928	.FILL #928
+D12929	.FILL #929
+D12930	.FILL #930
+D12931	.FILL #931
+D12932	.FILL #932
+D12933	.FILL #933
+D12934	.FILL #934
+D12935	.FILL #935
+D12936	.FILL #936
+D12937	.FILL #937
+D12938	.FILL #938
+D12939	.FILL #939
+D12940	.FILL #940
+D12941	.FILL #941
+D12942	.FILL #942
+D12943	.FILL #943
+D12944	.FILL #944
+D12945	.FILL #945
+D12946	.FILL #946
+D12947	.FILL #947
+D12948	.FILL #948
+D12949	.FILL #949
+D12950	.FILL #950
+D12951	.FILL #951
+D12952	.FILL #952
+D12953	.FILL #953
+D12954	.FILL #954
+D12955	.FILL #955
+D12956	.FILL #956
+D12957	.FILL #957
+D12958	.FILL #958
+D12959	.FILL #959
+D12960	.FILL #960
+D12961	.FILL #961
+D12962	.FILL #962
+D12963	.FILL #963
+D12964	.FILL #964
+D12965	.FILL #965
+D12966	.FILL #966
+D12967	.FILL #967
+D12968	.FILL #968
+D12969	.FILL #969
+D12970	.FILL #970
+D12971	.FILL #971
+D12972	.FILL #972
+D12973	.FILL #973
+D12974	.FILL #974
+D12975	.FILL #975
+D12976	.FILL #976
+D12977	.FILL #977
+D12978	.FILL #978
+D12979	.FILL #979
+D12980	.FILL #980
+D12981	.FILL #981
+D12982	.FILL #982
+D12983	.FILL #983
+D12984	.FILL #984
+D12985	.FILL #985
+D12986	.FILL #986
+D12987	.FILL #987
+D12988	.FILL #988
+D12989	.FILL #989
+D12990	.FILL #990
+D12991	.FILL #991
+D12992	.FILL #992
+D12993	.FILL #993
+D12994	.FILL #994
+D12995	.FILL #995
+D12996	.FILL #996
+D12997	.FILL #997
+D12998	.FILL #998
+D12999	.FILL #999
+D13000	.FILL #0
+D13001	.FILL #1
+D13002	.FILL #2
+D13003	.FILL #3
+D13004	.FILL #4
+D13005	.FILL #5
+D13006	.FILL #6
+D13007	.FILL #7
+D13008	.FILL #8
+D13009	.FILL #9
+D13010	.FILL #10
+D13011	.FILL #11
+D13012	.FILL #12
+D13013	.FILL #13
+D13014	.FILL #14
+D13015	.FILL #15
+D13016	.FILL #16
+D13017	.FILL #17
+D13018	.FILL #18
+D13019	.FILL #19
+D13020	.FILL #20
+D13021	.FILL #21
+D13022	.FILL #22
+D13023	.FILL #23
+D13024	.FILL #24
+D13025	.FILL #25
+D13026	.FILL #26
+D13027	.FILL #27
+D13028	.FILL #28
+D13029	.FILL #29
+D13030	.FILL #30
+D13031	.FILL #31
+D13032	.FILL #32
+D13033	.FILL #33
+D13034	.FILL #34
+D13035	.FILL #35
+D13036	.FILL #36
+D13037	.FILL #37
+D13038	.FILL #38
+D13039	.FILL #39
+D13040	.FILL #40
+D13041	.FILL #41
+D13042	.FILL #42
+D13043	.FILL #43
+D13044	.FILL #44
+D13045	.FILL #45
+D13046	.FILL #46
+D13047	.FILL #47
+D13048	.FILL #48
+D13049	.FILL #49
+D13050	.FILL #50
+D13051	.FILL #51
+D13052	.FILL #52
+D13053	.FILL #53
+D13054	.FILL #54
+D13055	.FILL #55
+D13056	.FILL #56
+D13057	.FILL #57
+D13058	.FILL #58
+D13059	.FILL #59
+D13060	.FILL #60
+D13061	.FILL #61
+D13062	.FILL #62
+D13063	.FILL #63
+D13064	.FILL #64
+D13065	.FILL #65
+D13066	.FILL #66
+D13067	.FILL #67
+D13068	.FILL #68
+D13069	.FILL #69
+D13070	.FILL #70
+D13071	.FILL #71
+D13072	.FILL #72
+D13073	.FILL #73
+D13074	.FILL #74
+D13075	.FILL #75
+D13076	.FILL #76
+D13077	.FILL #77
+D13078	.FILL #78
+D13079	.FILL #79
+D13080	.FILL #80
+D13081	.FILL #81
+D13082	.FILL #82
+D13083	.FILL #83
+D13084	.FILL #84
+D13085	.FILL #85
+D13086	.FILL #86
+D13087	.FILL #87
+D13088	.FILL #88
+D13089	.FILL #89
+D13090	.FILL #90
+D13091	.FILL #91
+D13092	.FILL #92
+D13093	.FILL #93
+D13094	.FILL #94
+D13095	.FILL #95
+D13096	.FILL #96
+D13097	.FILL #97
+D13098	.FILL #98
+D13099	.FILL #99
+D13100	.FILL #100
+D13101	.FILL #101
+D13102	.FILL #102
+D13103	.FILL #103
+D13104	.FILL #104
+D13105	.FILL #105
+D13106	.FILL #106
+D13107	.FILL #107
+D13108	.FILL #108
+D13109	.FILL #109
+D13110	.FILL #110
+D13111	.FILL #111
+D13112	.FILL #112
+D13113	.FILL #113
+D13114	.FILL #114
+D13115	.FILL #115
+D13116	.FILL #116
+D13117	.FILL #117
+D13118	.FILL #118
+D13119	.FILL #119
+D13120	.FILL #120
+D13121	.FILL #121
+D13122	.FILL #122
+D13123	.FILL #123
+D13124	.FILL #124
+D13125	.FILL #125
+D13126	.FILL #126
+D13127	.FILL #127
+D13128	.FILL #128
+D13129	.FILL #129
+D13130	.FILL #130
+D13131	.FILL #131
+D13132	.FILL #132
+D13133	.FILL #133
+D13134	.FILL #134
+D13135	.FILL #135
+D13136	.FILL #136
+D13137	.FILL #137
+D13138	.FILL #138
+D13139	.FILL #139
+D13140	.FILL #140
+D13141	.FILL #141
+D13142	.FILL #142
+D13143	.FILL #143
+D13144	.FILL #144
+D13145	.FILL #145
+D13146	.FILL #146
+D13147	.FILL #147
+D13148	.FILL #148
+D13149	.FILL #149
+D13150	.FILL #150
+D13151	.FILL #151
+D13152	.FILL #152
+D13153	.FILL #153
+D13154	.FILL #154
+D13155	.FILL #155
+D13156	.FILL #156
+D13157	.FILL #157
+D13158	.FILL #158
+D13159	.FILL #159
+D13160	.FILL #160
+D13161	.FILL #161
+D13162	.FILL #162
+D13163	.FILL #163
+D13164	.FILL #164
+D13165	.FILL #165
+D13166	.FILL #166
+D13167	.FILL #167
+D13168	.FILL #168
+D13169	.FILL #169
+D13170	.FILL #170
+D13171	.FILL #171
+D13172	.FILL #172
+D13173	.FILL #173
+D13174	.FILL #174
+D13175	.FILL #175
+D13176	.FILL #176
+D13177	.FILL #177
+D13178	.FILL #178
+D13179	.FILL #179
+D13180	.FILL #180
+D13181	.FILL #181
+D13182	.FILL #182
+D13183	.FILL #183
+D13184	.FILL #184
+D13185	.FILL #185
+D13186	.FILL #186
+D13187	.FILL #187
+D13188	.FILL #188
+D13189	.FILL #189
+D13190	.FILL #190
+D13191	.FILL #191
+D13192	.FILL #192
+D13193	.FILL #193
+D13194	.FILL #194
+D13195	.FILL #195
+D13196	.FILL #196
+D13197	.FILL #197
+D13198	.FILL #198
+D13199	.FILL #199
+D13200	.FILL #200
+D13201	.FILL #201
+D13202	.FILL #202
+D13203	.FILL #203
+D13204	.FILL #204
+D13205	.FILL #205
+D13206	.FILL #206
+D13207	.FILL #207
+D13208	.FILL #208
+D13209	.FILL #209
+D13210	.FILL #210
+D13211	.FILL #211
+D13212	.FILL #212
+D13213	.FILL #213
+D13214	.FILL #214
+D13215	.FILL #215
+D13216	.FILL #216
+D13217	.FILL #217
+D13218	.FILL #218
+D13219	.FILL #219
+D13220	.FILL #220
+D13221	.FILL #221
+D13222	.FILL #222
+D13223	.FILL #223
+D13224	.FILL #224
+D13225	.FILL #225
+D13226	.FILL #226
+D13227	.FILL #227
+D13228	.FILL #228
+D13229	.FILL #229
+D13230	.FILL #230
+D13231	.FILL #231
+D13232	.FILL #232
+D13233	.FILL #233
+D13234	.FILL #234
+D13235	.FILL #235
+D13236	.FILL #236
+D13237	.FILL #237
+D13238	.FILL #238
+D13239	.FILL #239
+D13240	.FILL #240
+D13241	.FILL #241
+D13242	.FILL #242
+D13243	.FILL #243
+D13244	.FILL #244
+D13245	.FILL #245
+D13246	.FILL #246
+D13247	.FILL #247
+D13248	.FILL #248
+D13249	.FILL #249
+D13250	.FILL #250
+D13251	.FILL #251
+D13252	.FILL #252
+D13253	.FILL #253
+D13254	.FILL #254
+D13255	.FILL #255
+D13256	.FILL #256
+D13257	.FILL #257
+D13258	.FILL #258
+D13259	.FILL #259
+D13260	.FILL #260
+D13261	.FILL #261
+D13262	.FILL #262
+D13263	.FILL #263
+D13264	.FILL #264
+D13265	.FILL #265
+D13266	.FILL #266
+D13267	.FILL #267
+D13268	.FILL #268
+D13269	.FILL #269
+D13270	.FILL #270
+D13271	.FILL #271
+D13272	.FILL #272
+D13273	.FILL #273
+D13274	.FILL #274
+D13275	.FILL #275
+D13276	.FILL #276
+D13277	.FILL #277
+D13278	.FILL #278
+D13279	.FILL #279
+D13280	.FILL #280
+D13281	.FILL #281
+D13282	.FILL #282
+D13283	.FILL #283
+D13284	.FILL #284
+D13285	.FILL #285
+D13286	.FILL #286
+D13287	.FILL #287
+D13288	.FILL #288
+D13289	.FILL #289
+D13290	.FILL #290
+D13291	.FILL #291
+D13292	.FILL #292
+D13293	.FILL #293
+D13294	.FILL #294
+D13295	.FILL #295
+D13296	.FILL #296
+D13297	.FILL #297
+D13298	.FILL #298
+D13299	.FILL #299
+D13300	.FILL #300
+D13301	.FILL #301
+D13302	.FILL #302
+D13303	.FILL #303
+D13304	.FILL #304
+D13305	.FILL #305
+D13306	.FILL #306
+D13307	.FILL #307
+D13308	.FILL #308
+D13309	.FILL #309
+D13310	.FILL #310
+D13311	.FILL #311
+D13312	.FILL #312
+D13313	.FILL #313
+D13314	.FILL #314
+D13315	.FILL #315
+D13316	.FILL #316
+D13317	.FILL #317
+D13318	.FILL #318
+D13319	.FILL #319
+D13320	.FILL #320
+D13321	.FILL #321
+D13322	.FILL #322
+D13323	.FILL #323
+D13324	.FILL #324
+D13325	.FILL #325
+D13326	.FILL #326
+D13327	.FILL #327
+D13328	.FILL #328
+D13329	.FILL #329
+D13330	.FILL #330
+D13331	.FILL #331
+D13332	.FILL #332
+D13333	.FILL #333
+D13334	.FILL #334
+D13335	.FILL #335
+D13336	.FILL #336
+D13337	.FILL #337
+D13338	.FILL #338
+D13339	.FILL #339
+D13340	.FILL #340
+D13341	.FILL #341
+D13342	.FILL #342
+D13343	.FILL #343
+D13344	.FILL #344
+D13345	.FILL #345
+D13346	.FILL #346
+D13347	.FILL #347
+D13348	.FILL #348
+D13349	.FILL #349
+D13350	.FILL #350
+D13351	.FILL #351
+D13352	.FILL #352
+D13353	.FILL #353
+D13354	.FILL #354
+D13355	.FILL #355
+D13356	.FILL #356
+D13357	.FILL #357
+D13358	.FILL #358
+D13359	.FILL #359
+D13360	.FILL #360
+D13361	.FILL #361
+D13362	.FILL #362
+D13363	.FILL #363
+D13364	.FILL #364
+D13365	.FILL #365
+D13366	.FILL #366
+D13367	.FILL #367
+D13368	.FILL #368
+D13369	.FILL #369
+D13370	.FILL #370
+D13371	.FILL #371
+D13372	.FILL #372
+D13373	.FILL #373
+D13374	.FILL #374
+D13375	.FILL #375
+D13376	.FILL #376
+D13377	.FILL #377
+D13378	.FILL #378
+D13379	.FILL #379
+D13380	.FILL #380
+D13381	.FILL #381
+D13382	.FILL #382
+D13383	.FILL #383
+D13384	.FILL #384
+D13385	.FILL #385
+D13386	.FILL #386
+D13387	.FILL #387
+D13388	.FILL #388
+D13389	.FILL #389
+D13390	.FILL #390
+D13391	.FILL #391
+D13392	.FILL #392
+D13393	.FILL #393
+D13394	.FILL #394
+D13395	.FILL #395
+D13396	.FILL #396
+D13397	.FILL #397
+D13398	.FILL #398
+D13399	.FILL #399
+D13400	.FILL #400
+D13401	.FILL #401
+D13402	.FILL #402
+D13403	.FILL #403
+D13404	.FILL #404
+D13405	.FILL #405
+D13406	.FILL #406
+D13407	.FILL #407
+D13408	.FILL #408
+D13409	.FILL #409
+D13410	.FILL #410
+D13411	.FILL #411
+D13412	.FILL #412
+D13413	.FILL #413
+D13414	.FILL #414
+D13415	.FILL #415
+D13416	.FILL #416
+D13417	.FILL #417
+D13418	.FILL #418
+D13419	.FILL #419
+D13420	.FILL #420
+D13421	.FILL #421
+D13422	.FILL #422
+D13423	.FILL #423
+D13424	.FILL #424
+D13425	.FILL #425
+D13426	.FILL #426
+D13427	.FILL #427
+D13428	.FILL #428
+D13429	.FILL #429
+D13430	.FILL #430
+D13431	.FILL #431
+D13432	.FILL #432
+D13433	.FILL #433
+D13434	.FILL #434
+D13435	.FILL #435
+D13436	.FILL #436
+D13437	.FILL #437
+D13438	.FILL #438
+D13439	.FILL #439
+D13440	.FILL #440
+D13441	.FILL #441
+D13442	.FILL #442
+D13443	.FILL #443
+D13444	.FILL #444
+D13445	.FILL #445
+D13446	.FILL #446
+D13447	.FILL #447
+D13448	.FILL #448
+D13449	.FILL #449
+D13450	.FILL #450
+D13451	.FILL #451
+D13452	.FILL #452
+D13453	.FILL #453
+D13454	.FILL #454
+D13455	.FILL #455
+D13456	.FILL #456
+D13457	.FILL #457
+D13458	.FILL #458
+D13459	.FILL #459
+D13460	.FILL #460
+D13461	.FILL #461
+D13462	.FILL #462
+D13463	.FILL #463
+D13464	.FILL #464
+D13465	.FILL #465
+D13466	.FILL #466
+D13467	.FILL #467
+D13468	.FILL #468
+D13469	.FILL #469
+D13470	.FILL #470
+D13471	.FILL #471
+D13472	.FILL #472
+D13473	.FILL #473
+D13474	.FILL #474
+D13475	.FILL #475
+D13476	.FILL #476
+D13477	.FILL #477
+D13478	.FILL #478
+D13479	.FILL #479
+D13480	.FILL #480
+D13481	.FILL #481
+D13482	.FILL #482
+D13483	.FILL #483
+D13484	.FILL #484
+D13485	.FILL #485
+D13486	.FILL #486
+D13487	.FILL #487
+D13488	.FILL #488
+D13489	.FILL #489
+D13490	.FILL #490
+D13491	.FILL #491
+D13492	.FILL #492
+D13493	.FILL #493
+D13494	.FILL #494
+D13495	.FILL #495
+D13496	.FILL #496
+D13497	.FILL #497
+D13498	.FILL #498
+D13499	.FILL #499
+D13500	.FILL #500
+D13501	.FILL #501
+D13502	.FILL #502
+D13503	.FILL #503
+D13504	.FILL #504
+D13505	.FILL #505
+D13506	.FILL #506
+D13507	.FILL #507
+D13508	.FILL #508
+D13509	.FILL #509
+D13510	.FILL #510
+D13511	.FILL #511
+D13512	.FILL #512
+D13513	.FILL #513
+D13514	.FILL #514
+D13515	.FILL #515
+D13516	.FILL #516
+D13517	.FILL #517
+D13518	.FILL #518
+D13519	.FILL #519
+D13520	.FILL #520
+D13521	.FILL #521
+D13522	.FILL #522
+D13523	.FILL #523
+D13524	.FILL #524
+D13525	.FILL #525
+D13526	.FILL #526
+D13527	.FILL #527
+D13528	.FILL #528
+D13529	.FILL #529
+D13530	.FILL #530
+D13531	.FILL #531
+D13532	.FILL #532
+D13533	.FILL #533
+D13534	.FILL #534
+D13535	.FILL #535
+D13536	.FILL #536
+D13537	.FILL #537
+D13538	.FILL #538
+D13539	.FILL #539
+D13540	.FILL #540
+D13541	.FILL #541
+D13542	.FILL #542
+D13543	.FILL #543
+D13544	.FILL #544
+D13545	.FILL #545
+D13546	.FILL #546
+D13547	.FILL #547
+D13548	.FILL #548
+D13549	.FILL #549
+D13550	.FILL #550
+D13551	.FILL #551
+D13552	.FILL #552
+D13553	.FILL #553
+D13554	.FILL #554
+D13555	.FILL #555
+D13556	.FILL #556
+D13557	.FILL #557
+D13558	.FILL #558
+D13559	.FILL #559
+D13560	.FILL #560
+D13561	.FILL #561
+D13562	.FILL #562
+D13563	.FILL #563
+D13564	.FILL #564
+D13565	.FILL #565
+D13566	.FILL #566
+D13567	.FILL #567
+D13568	.FILL #568
+D13569	.FILL #569
+D13570	.FILL #570
+D13571	.FILL #571
+D13572	.FILL #572
+D13573	.FILL #573
+D13574	.FILL #574
+D13575	.FILL #575
+D13576	.FILL #576
+D13577	.FILL #577
+D13578	.FILL #578
+D13579	.FILL #579
+D13580	.FILL #580
+D13581	.FILL #581
+D13582	.FILL #582
+D13583	.FILL #583
+D13584	.FILL #584
+D13585	.FILL #585
+D13586	.FILL #586
+D13587	.FILL #587
+D13588	.FILL #588
+D13589	.FILL #589
+D13590	.FILL #590
+D13591	.FILL #591
+D13592	.FILL #592
+D13593	.FILL #593
+D13594	.FILL #594
+D13595	.FILL #595
+D13596	.FILL #596
+D13597	.FILL #597
+D13598	.FILL #598
+D13599	.FILL #599
+D13600	.FILL #600
+D13601	.FILL #601
+D13602	.FILL #602
+D13603	.FILL #603
+D13604	.FILL #604
+D13605	.FILL #605
+D13606	.FILL #606
+D13607	.FILL #607
+D13608	.FILL #608
+D13609	.FILL #609
+D13610	.FILL #610
+D13611	.FILL #611
+D13612	.FILL #612
+D13613	.FILL #613
+D13614	.FILL #614
+D13615	.FILL #615
+D13616	.FILL #616
+D13617	.FILL #617
+D13618	.FILL #618
+D13619	.FILL #619
+D13620	.FILL #620
+D13621	.FILL #621
+D13622	.FILL #622
+D13623	.FILL #623
+D13624	.FILL #624
+D13625	.FILL #625
+D13626	.FILL #626
+D13627	.FILL #627
+D13628	.FILL #628
+D13629	.FILL #629
+D13630	.FILL #630
+D13631	.FILL #631
+D13632	.FILL #632
+D13633	.FILL #633
+D13634	.FILL #634
+D13635	.FILL #635
+D13636	.FILL #636
+D13637	.FILL #637
+D13638	.FILL #638
+D13639	.FILL #639
+D13640	.FILL #640
+D13641	.FILL #641
+D13642	.FILL #642
+D13643	.FILL #643
+D13644	.FILL #644
+D13645	.FILL #645
+D13646	.FILL #646
+D13647	.FILL #647
+D13648	.FILL #648
+D13649	.FILL #649
+D13650	.FILL #650
+D13651	.FILL #651
+D13652	.FILL #652
+D13653	.FILL #653
+D13654	.FILL #654
+D13655	.FILL #655
+D13656	.FILL #656
+D13657	.FILL #657
+D13658	.FILL #658
+D13659	.FILL #659
+D13660	.FILL #660
+D13661	.FILL #661
+D13662	.FILL #662
+D13663	.FILL #663
+D13664	.FILL #664
+D13665	.FILL #665
+D13666	.FILL #666
+D13667	.FILL #667
+D13668	.FILL #668
+D13669	.FILL #669
+D13670	.FILL #670
+D13671	.FILL #671
+D13672	.FILL #672
+D13673	.FILL #673
+D13674	.FILL #674
+D13675	.FILL #675
+D13676	.FILL #676
+D13677	.FILL #677
+D13678	.FILL #678
+D13679	.FILL #679
+D13680	.FILL #680
+D13681	.FILL #681
+D13682	.FILL #682
+D13683	.FILL #683
+D13684	.FILL #684
+D13685	.FILL #685
+D13686	.FILL #686
+D13687	.FILL #687
+D13688	.FILL #688
+D13689	.FILL #689
+D13690	.FILL #690
+D13691	.FILL #691
+D13692	.FILL #692
+D13693	.FILL #693
+D13694	.FILL #694
+D13695	.FILL #695
+D13696	.FILL #696
+D13697	.FILL #697
+D13698	.FILL #698
+D13699	.FILL #699
+D13700	.FILL #700
+D13701	.FILL #701
+D13702	.FILL #702
+D13703	.FILL #703
+D13704	.FILL #704
+D13705	.FILL #705
+D13706	.FILL #706
+D13707	.FILL #707
+D13708	.FILL #708
+D13709	.FILL #709
+D13710	.FILL #710
+D13711	.FILL #711
+D13712	.FILL #712
+D13713	.FILL #713
+D13714	.FILL #714
+D13715	.FILL #715
+D13716	.FILL #716
+D13717	.FILL #717
+D13718	.FILL #718
+D13719	.FILL #719
+D13720	.FILL #720
+D13721	.FILL #721
+D13722	.FILL #722
+D13723	.FILL #723
+D13724	.FILL #724
+D13725	.FILL #725
+D13726	.FILL #726
+D13727	.FILL #727
+D13728	.FILL #728
+D13729	.FILL #729
+D13730	.FILL #730
+D13731	.FILL #731
+D13732	.FILL #732
+D13733	.FILL #733
+D13734	.FILL #734
+D13735	.FILL #735
+D13736	.FILL #736
+D13737	.FILL #737
+D13738	.FILL #738
+D13739	.FILL #739
+D13740	.FILL #740
+D13741	.FILL #741
+D13742	.FILL #742
+D13743	.FILL #743
+D13744	.FILL #744
+D13745	.FILL #745
+D13746	.FILL #746
+D13747	.FILL #747
+D13748	.FILL #748
+D13749	.FILL #749
+D13750	.FILL #750
+D13751	.FILL #751
+D13752	.FILL #752
+D13753	.FILL #753
+D13754	.FILL #754
+D13755	.FILL #755
+D13756	.FILL #756
+D13757	.FILL #757
+D13758	.FILL #758
+D13759	.FILL #759
+D13760	.FILL #760
+D13761	.FILL #761
+D13762	.FILL #762
+D13763	.FILL #763
+D13764	.FILL #764
+D13765	.FILL #765
+D13766	.FILL #766
+D13767	.FILL #767
+D13768	.FILL #768
+D13769	.FILL #769
+D13770	.FILL #770
+D13771	.FILL #771
+D13772	.FILL #772
+D13773	.FILL #773
+D13774	.FILL #774
+D13775	.FILL #775
+D13776	.FILL #776
+D13777	.FILL #777
+D13778	.FILL #778
+D13779	.FILL #779
+D13780	.FILL #780
+D13781	.FILL #781
+D13782	.FILL #782
+D13783	.FILL #783
+D13784	.FILL #784
+D13785	.FILL #785
+D13786	.FILL #786
+D13787	.FILL #787
+D13788	.FILL #788
+D13789	.FILL #789
+D13790	.FILL #790
+D13791	.FILL #791
+D13792	.FILL #792
+D13793	.FILL #793
+D13794	.FILL #794
+D13795	.FILL #795
+D13796	.FILL #796
+D13797	.FILL #797
+D13798	.FILL #798
+D13799	.FILL #799
+D13800	.FILL #800
+D13801	.FILL #801
+D13802	.FILL #802
+D13803	.FILL #803
+D13804	.FILL #804
+D13805	.FILL #805
+D13806	.FILL #806
+D13807	.FILL #807
+D13808	.FILL #808
+D13809	.FILL #809
+D13810	.FILL #810
+D13811	.FILL #811
+D13812	.FILL #812
+D13813	.FILL #813
+D13814	.FILL #814
+D13815	.FILL #815
+D13816	.FILL #816
+D13817	.FILL #817
+D13818	.FILL #818
+D13819	.FILL #819
+D13820	.FILL #820
+D13821	.FILL #821
+D13822	.FILL #822
+D13823	.FILL #823
+D13824	.FILL #824
+D13825	.FILL #825
+D13826	.FILL #826
+D13827	.FILL #827
+D13828	.FILL #828
+D13829	.FILL #829
+D13830	.FILL #830
+D13831	.FILL #831
+D13832	.FILL #832
+D13833	.FILL #833
+D13834	.FILL #834
+D13835	.FILL #835
+D13836	.FILL #836
+D13837	.FILL #837
+D13838	.FILL #838
+D13839	.FILL #839
+D13840	.FILL #840
+D13841	.FILL #841
+D13842	.FILL #842
+D13843	.FILL #843
+D13844	.FILL #844
+D13845	.FILL #845
+D13846	.FILL #846
+D13847	.FILL #847
+D13848	.FILL #848
+D13849	.FILL #849
+D13850	.FILL #850
+D13851	.FILL #851
+D13852	.FILL #852
+D13853	.FILL #853
+D13854	.FILL #854
+D13855	.FILL #855
+D13856	.FILL #856
+D13857	.FILL #857
+D13858	.FILL #858
+D13859	.FILL #859
+D13860	.FILL #860
+D13861	.FILL #861
+D13862	.FILL #862
+D13863	.FILL #863
+D13864	.FILL #864
+D13865	.FILL #865
+D13866	.FILL #866
+D13867	.FILL #867
+D13868	.FILL #868
+D13869	.FILL #869
+D13870	.FILL #870
+D13871	.FILL #871
+D13872	.FILL #872
+D13873	.FILL #873
+D13874	.FILL #874
+D13875	.FILL #875
+D13876	.FILL #876
+D13877	.FILL #877
+D13878	.FILL #878
+D13879	.FILL #879
+D13880	.FILL #880
+D13881	.FILL #881
+D13882	.FILL #882
+D13883	.FILL #883
+D13884	.FILL #884
+D13885	.FILL #885
+D13886	.FILL #886
+D13887	.FILL #887
+D13888	.FILL #888
+D13889	.FILL #889
+D13890	.FILL #890
+D13891	.FILL #891
+D13892	.FILL #892
+D13893	.FILL #893
+D13894	.FILL #894
+D13895	.FILL #895
+D13896	.FILL #896
+D13897	.FILL #897
+D13898	.FILL #898
+D13899	.FILL #899
+D13900	.FILL #900
+D13901	.FILL #901
+D13902	.FILL #902
+D13903	.FILL #903
+D13904	.FILL #904
+D13905	.FILL #905
+D13906	.FILL #906
+D13907	.FILL #907
+D13908	.FILL #908
+D13909	.FILL #909
+D13910	.FILL #910
+D13911	.FILL #911
+D13912	.FILL #912
+D13913	.FILL #913
+D13914	.FILL #914
+D13915	.FILL #915
+D13916	.FILL #916
+D13917	.FILL #917
+D13918	.FILL #918
+D13919	.FILL #919
+D13920	.FILL #920
+D13921	.FILL #921
+D13922	.FILL #922
+D13923	.FILL #923
+D13924	.FILL #924
+D13925	.FILL #925
+D13926	.FILL #926
+D13927	.FILL #927
+D13928	.FILL #928
+D13929	.FILL #929
+D13930	.FILL #930
+D13931	.FILL #931
+D13932	.FILL #932
+D13933	.FILL #933
+D13934	.FILL #934
+D13935	.FILL #935
+D13936	.FILL #936
+D13937	.FILL #937
+D13938	.FILL #938
+D13939	.FILL #939
+D13940	.FILL #940
+D13941	.FILL #941
+D13942	.FILL #942
+D13943	.FILL #943
+D13944	.FILL #944
+D13945	.FILL #945
+D13946	.FILL #946
+D13947	.FILL #947
+D13948	.FILL #948
+D13949	.FILL #949
+D13950	.FILL #950
+D13951	.FILL #951
+D13952	.FILL #952
+D13953	.FILL #953
+D13954	.FILL #954
+D13955	.FILL #955
+D13956	.FILL #956
+D13957	.FILL #957
+D13958	.FILL #958
+D13959	.FILL #959
+D13960	.FILL #960
+D13961	.FILL #961
+D13962	.FILL #962
+D13963	.FILL #963
+D13964	.FILL #964
+D13965	.FILL #965
+D13966	.FILL #966
+D13967	.FILL #967
+D13968	.FILL #968
+D13969	.FILL #969
+D13970	.FILL #970
+D13971	.FILL #971
+D13972	.FILL #972
+D13973	.FILL #973
+D13974	.FILL #974
+D13975	.FILL #975
+D13976	.FILL #976
+D13977	.FILL #977
+D13978	.FILL #978
+D13979	.FILL #979
+D13980	.FILL #980
+D13981	.FILL #981
+D13982	.FILL #982
+D13983	.FILL #983
+D13984	.FILL #984
+D13985	.FILL #985
+D13986	.FILL #986
+D13987	.FILL #987
+D13988	.FILL #988
+D13989	.FILL #989
+D13990	.FILL #990
+D13991	.FILL #991
+D13992	.FILL #992
+D13993	.FILL #993
+D13994	.FILL #994
+D13995	.FILL #995
+D13996	.FILL #996
+D13997	.FILL #997
+D13998	.FILL #998
+D13999	.FILL #999
+D14000	.FILL #0
+D14001	.FILL #1
+D14002	.FILL #2
+D14003	.FILL #3
+D14004	.FILL #4
+D14005	.FILL #5
+D14006	.FILL #6
+D14007	.FILL #7
+D14008	.FILL #8
+D14009	.FILL #9
+D14010	.FILL #10
+D14011	.FILL #11
+D14012	.FILL #12
+D14013	.FILL #13
+D14014	.FILL #14
+D14015	.FILL #15
+D14016	.FILL #16
+D14017	.FILL #17
+D14018	.FILL #18
+D14019	.FILL #19
+D14020	.FILL #20
+D14021	.FILL #21
+D14022	.FILL #22
+D14023	.FILL #23
+D14024	.FILL #24
+D14025	.FILL #25
+D14026	.FILL #26
+D14027	.FILL #27
+D14028	.FILL #28
+D14029	.FILL #29
+D14030	.FILL #30
+D14031	.FILL #31
+D14032	.FILL #32
+D14033	.FILL #33
+D14034	.FILL #34
+D14035	.FILL #35
+D14036	.FILL #36
+D14037	.FILL #37
+D14038	.FILL #38
+D14039	.FILL #39
+D14040	.FILL #40
+D14041	.FILL #41
+D14042	.FILL #42
+D14043	.FILL #43
+D14044	.FILL #44
+D14045	.FILL #45
+D14046	.FILL #46
+D14047	.FILL #47
+D14048	.FILL #48
+D14049	.FILL #49
+D14050	.FILL #50
+D14051	.FILL #51
+D14052	.FILL #52
+D14053	.FILL #53
+D14054	.FILL #54
+D14055	.FILL #55
+D14056	.FILL #56
+D14057	.FILL #57
+D14058	.FILL #58
+D14059	.FILL #59
+D14060	.FILL #60
+D14061	.FILL #61
+D14062	.FILL #62
+D14063	.FILL #63
+D14064	.FILL #64
+D14065	.FILL #65
+D14066	.FILL #66
+D14067	.FILL #67
+D14068	.FILL #68
+D14069	.FILL #69
+D14070	.FILL #70
+D14071	.FILL #71
+D14072	.FILL #72
+D14073	.FILL #73
+D14074	.FILL #74
+D14075	.FILL #75
+D14076	.FILL #76
+D14077	.FILL #77
+D14078	.FILL #78
+D14079	.FILL #79
+D14080	.FILL #80
+D14081	.FILL #81
+D14082	.FILL #82
+D14083	.FILL #83
+D14084	.FILL #84
+D14085	.FILL #85
+D14086	.FILL #86
+D14087	.FILL #87
+D14088	.FILL #88
+D14089	.FILL #89
+D14090	.FILL #90
+D14091	.FILL #91
+D14092	.FILL #92
+D14093	.FILL #93
+D14094	.FILL #94
+D14095	.FILL #95
+D14096	.FILL #96
+D14097	.FILL #97
+D14098	.FILL #98
+D14099	.FILL #99
+D14100	.FILL #100
+D14101	.FILL #101
+D14102	.FILL #102
+D14103	.FILL #103
+D14104	.FILL #104
+D14105	.FILL #105
+D14106	.FILL #106
+D14107	.FILL #107
+D14108	.FILL #108
+D14109	.FILL #109
+D14110	.FILL #110
+D14111	.FILL #111
+D14112	.FILL #112
+D14113	.FILL #113
+D14114	.FILL #114
+D14115	.FILL #115
+D14116	.FILL #116
+D14117	.FILL #117
+D14118	.FILL #118
+D14119	.FILL #119
+D14120	.FILL #120
+D14121	.FILL #121
+D14122	.FILL #122
+D14123	.FILL #123
+D14124	.FILL #124
+D14125	.FILL #125
+D14126	.FILL #126
+D14127	.FILL #127
+D14128	.FILL #128
+D14129	.FILL #129
+D14130	.FILL #130
+D14131	.FILL #131
+D14132	.FILL #132
+D14133	.FILL #133
+D14134	.FILL #134
+D14135	.FILL #135
+D14136	.FILL #136
+D14137	.FILL #137
+D14138	.FILL #138
+D14139	.FILL #139
+D14140	.FILL #140
+D14141	.FILL #141
+D14142	.FILL #142
+D14143	.FILL #143
+D14144	.FILL #144
+D14145	.FILL #145
+D14146	.FILL #146
+D14147	.FILL #147
+D14148	.FILL #148
+D14149	.FILL #149
+D14150	.FILL #150
+D14151	.FILL #151
+D14152	.FILL #152
+D14153	.FILL #153
+D14154	.FILL #154
+D14155	.FILL #155
+D14156	.FILL #156
+D14157	.FILL #157
+D14158	.FILL #158
+D14159	.FILL #159
+D14160	.FILL #160
+D14161	.FILL #161
+D14162	.FILL #162
+D14163	.FILL #163
+D14164	.FILL #164
+D14165	.FILL #165
+D14166	.FILL #166
+D14167	.FILL #167
+D14168	.FILL #168
+D14169	.FILL #169
+D14170	.FILL #170
+D14171	.FILL #171
+D14172	.FILL #172
+D14173	.FILL #173
+D14174	.FILL #174
+D14175	.FILL #175
+D14176	.FILL #176
+D14177	.FILL #177
+D14178	.FILL #178
+D14179	.FILL #179
+D14180	.FILL #180
+D14181	.FILL #181
+D14182	.FILL #182
+D14183	.FILL #183
+D14184	.FILL #184
+D14185	.FILL #185
+D14186	.FILL #186
+D14187	.FILL #187
+D14188	.FILL #188
+D14189	.FILL #189
+D14190	.FILL #190
+D14191	.FILL #191
+D14192	.FILL #192
+D14193	.FILL #193
+D14194	.FILL #194
+D14195	.FILL #195
+D14196	.FILL #196
+D14197	.FILL #197
+D14198	.FILL #198
+D14199	.FILL #199
+D14200	.FILL #200
+D14201	.FILL #201
+D14202	.FILL #202
+D14203	.FILL #203
+D14204	.FILL #204
+D14205	.FILL #205
+D14206	.FILL #206
+D14207	.FILL #207
+D14208	.FILL #208
+D14209	.FILL #209
+D14210	.FILL #210
+D14211	.FILL #211
+D14212	.FILL #212
+D14213	.FILL #213
+D14214	.FILL #214
+D14215	.FILL #215
+D14216	.FILL #216
+D14217	.FILL #217
+D14218	.FILL #218
+D14219	.FILL #219
+D14220	.FILL #220
+D14221	.FILL #221
+D14222	.FILL #222
+D14223	.FILL #223
+D14224	.FILL #224
+D14225	.FILL #225
+D14226	.FILL #226
+D14227	.FILL #227
+D14228	.FILL #228
+D14229	.FILL #229
+D14230	.FILL #230
+D14231	.FILL #231
+D14232	.FILL #232
+D14233	.FILL #233
+D14234	.FILL #234
+D14235	.FILL #235
+D14236	.FILL #236
+D14237	.FILL #237
+D14238	.FILL #238
+D14239	.FILL #239
+D14240	.FILL #240
+D14241	.FILL #241
+D14242	.FILL #242
+D14243	.FILL #243
+D14244	.FILL #244
+D14245	.FILL #245
+D14246	.FILL #246
+D14247	.FILL #247
+D14248	.FILL #248
+D14249	.FILL #249
+D14250	.FILL #250
+D14251	.FILL #251
+D14252	.FILL #252
+D14253	.FILL #253
+D14254	.FILL #254
+D14255	.FILL #255
+D14256	.FILL #256
+D14257	.FILL #257
+D14258	.FILL #258
+D14259	.FILL #259
+D14260	.FILL #260
+D14261	.FILL #261
+D14262	.FILL #262
+D14263	.FILL #263
+D14264	.FILL #264
+D14265	.FILL #265
+D14266	.FILL #266
+D14267	.FILL #267
+D14268	.FILL #268
+D14269	.FILL #269
+D14270	.FILL #270
+D14271	.FILL #271
+D14272	.FILL #272
+D14273	.FILL #273
+D14274	.FILL #274
+D14275	.FILL #275
+D14276	.FILL #276
+D14277	.FILL #277
+D14278	.FILL #278
+D14279	.FILL #279
+D14280	.FILL #280
+D14281	.FILL #281
+D14282	.FILL #282
+D14283	.FILL #283
+D14284	.FILL #284
+D14285	.FILL #285
+D14286	.FILL #286
+D14287	.FILL #287
+D14288	.FILL #288
+D14289	.FILL #289
+D14290	.FILL #290
+D14291	.FILL #291
+D14292	.FILL #292
+D14293	.FILL #293
+D14294	.FILL #294
+D14295	.FILL #295
+D14296	.FILL #296
+D14297	.FILL #297
+D14298	.FILL #298
+D14299	.FILL #299
+D14300	.FILL #300
+D14301	.FILL #301
+D14302	.FILL #302
+D14303	.FILL #303
+D14304	.FILL #304
+D14305	.FILL #305
+D14306	.FILL #306
+D14307	.FILL #307
+D14308	.FILL #308
+D14309	.FILL #309
+D14310	.FILL #310
+D14311	.FILL #311
+D14312	.FILL #312
+D14313	.FILL #313
+D14314	.FILL #314
+D14315	.FILL #315
+D14316	.FILL #316
+D14317	.FILL #317
+D14318	.FILL #318
+D14319	.FILL #319
+D14320	.FILL #320
+D14321	.FILL #321
+D14322	.FILL #322
+D14323	.FILL #323
+D14324	.FILL #324
+D14325	.FILL #325
+D14326	.FILL #326
+D14327	.FILL #327
+D14328	.FILL #328
+D14329	.FILL #329
+D14330	.FILL #330
+D14331	.FILL #331
+D14332	.FILL #332
+D14333	.FILL #333
+D14334	.FILL #334
+D14335	.FILL #335
+D14336	.FILL #336
+D14337	.FILL #337
+D14338	.FILL #338
+D14339	.FILL #339
+D14340	.FILL #340
+D14341	.FILL #341
+D14342	.FILL #342
+D14343	.FILL #343
+D14344	.FILL #344
+D14345	.FILL #345
+D14346	.FILL #346
+D14347	.FILL #347
+D14348	.FILL #348
+D14349	.FILL #349
+D14350	.FILL #350
+D14351	.FILL #351
+D14352	.FILL #352
+D14353	.FILL #353
+D14354	.FILL #354
+D14355	.FILL #355
+D14356	.FILL #356
+D14357	.FILL #357
+D14358	.FILL #358
+D14359	.FILL #359
+D14360	.FILL #360
+D14361	.FILL #361
+D14362	.FILL #362
+D14363	.FILL #363
+D14364	.FILL #364
+D14365	.FILL #365
+D14366	.FILL #366
+D14367	.FILL #367
+D14368	.FILL #368
+D14369	.FILL #369
+D14370	.FILL #370
+D14371	.FILL #371
+D14372	.FILL #372
+D14373	.FILL #373
+D14374	.FILL #374
+D14375	.FILL #375
+D14376	.FILL #376
+D14377	.FILL #377
+D14378	.FILL #378
+D14379	.FILL #379
+D14380	.FILL #380
+D14381	.FILL #381
+D14382	.FILL #382
+D14383	.FILL #383
+D14384	.FILL #384
+D14385	.FILL #385
+D14386	.FILL #386
+D14387	.FILL #387
+D14388	.FILL #388
+D14389	.FILL #389
+D14390	.FILL #390
+D14391	.FILL #391
+D14392	.FILL #392
+D14393	.FILL #393
+D14394	.FILL #394
+D14395	.FILL #395
+D14396	.FILL #396
+D14397	.FILL #397
+D14398	.FILL #398
+D14399	.FILL #399
+D14400	.FILL #400
+D14401	.FILL #401
+D14402	.FILL #402
+D14403	.FILL #403
+D14404	.FILL #404
+D14405	.FILL #405
+D14406	.FILL #406
+D14407	.FILL #407
+D14408	.FILL #408
+D14409	.FILL #409
+D14410	.FILL #410
+D14411	.FILL #411
+D14412	.FILL #412
+D14413	.FILL #413
+D14414	.FILL #414
+D14415	.FILL #415
+D14416	.FILL #416
+D14417	.FILL #417
+D14418	.FILL #418
+D14419	.FILL #419
+D14420	.FILL #420
+D14421	.FILL #421
+D14422	.FILL #422
+D14423	.FILL #423
+D14424	.FILL #424
+D14425	.FILL #425
+D14426	.FILL #426
+D14427	.FILL #427
+D14428	.FILL #428
+D14429	.FILL #429
+D14430	.FILL #430
+D14431	.FILL #431
+D14432	.FILL #432
+D14433	.FILL #433
+D14434	.FILL #434
+D14435	.FILL #435
+D14436	.FILL #436
+D14437	.FILL #437
+D14438	.FILL #438
+D14439	.FILL #439
+D14440	.FILL #440
+D14441	.FILL #441
+D14442	.FILL #442
+D14443	.FILL #443
+D14444	.FILL #444
+D14445	.FILL #445
+D14446	.FILL #446
+D14447	.FILL #447
+D14448	.FILL #448
+D14449	.FILL #449
+D14450	.FILL #450
+D14451	.FILL #451
+D14452	.FILL #452
+D14453	.FILL #453
+D14454	.FILL #454
+D14455	.FILL #455
+D14456	.FILL #456
+D14457	.FILL #457
+D14458	.FILL #458
+D14459	.FILL #459
+D14460	.FILL #460
+D14461	.FILL #461
+D14462	.FILL #462
+D14463	.FILL #463
+D14464	.FILL #464
+D14465	.FILL #465
+D14466	.FILL #466
+D14467	.FILL #467
+D14468	.FILL #468
+D14469	.FILL #469
+D14470	.FILL #470
+D14471	.FILL #471
+D14472	.FILL #472
+D14473	.FILL #473
+D14474	.FILL #474
+D14475	.FILL #475
+D14476	.FILL #476
+D14477	.FILL #477
+D14478	.FILL #478
+D14479	.FILL #479
+D14480	.FILL #480
+D14481	.FILL #481
+D14482	.FILL #482
+D14483	.FILL #483
+D14484	.FILL #484
+D14485	.FILL #485
+D14486	.FILL #486
+D14487	.FILL #487
+D14488	.FILL #488
+D14489	.FILL #489
+D14490	.FILL #490
+D14491	.FILL #491
+D14492	.FILL #492
+D14493	.FILL #493
+D14494	.FILL #494
+D14495	.FILL #495
+D14496	.FILL #496
+D14497	.FILL #497
+D14498	.FILL #498
+D14499	.FILL #499
+D14500	.FILL #500
+D14501	.FILL #501
+D14502	.FILL #502
+D14503	.FILL #503
+D14504	.FILL #504
+D14505	.FILL #505
+D14506	.FILL #506
+D14507	.FILL #507
+D14508	.FILL #508
+D14509	.FILL #509
+D14510	.FILL #510
+D14511	.FILL #511
+D14512	.FILL #512
+D14513	.FILL #513
+D14514	.FILL #514
+D14515	.FILL #515
+D14516	.FILL #516
+D14517	.FILL #517
+D14518	.FILL #518
+D14519	.FILL #519
+D14520	.FILL #520
+D14521	.FILL #521
+D14522	.FILL #522
+D14523	.FILL #523
+D14524	.FILL #524
+D14525	.FILL #525
+D14526	.FILL #526
+D14527	.FILL #527
+D14528	.FILL #528
+D14529	.FILL #529
+D14530	.FILL #530
+D14531	.FILL #531
+D14532	.FILL #532
+D14533	.FILL #533
+D14534	.FILL #534
+D14535	.FILL #535
+D14536	.FILL #536
+D14537	.FILL #537
+D14538	.FILL #538
+D14539	.FILL #539
+D14540	.FILL #540
+D14541	.FILL #541
+D14542	.FILL #542
+D14543	.FILL #543
+D14544	.FILL #544
+D14545	.FILL #545
+D14546	.FILL #546
+D14547	.FILL #547
+D14548	.FILL #548
+D14549	.FILL #549
+D14550	.FILL #550
+D14551	.FILL #551
+D14552	.FILL #552
+D14553	.FILL #553
+D14554	.FILL #554
+D14555	.FILL #555
+D14556	.FILL #556
+D14557	.FILL #557
+D14558	.FILL #558
+D14559	.FILL #559
+D14560	.FILL #560
+D14561	.FILL #561
+D14562	.FILL #562
+D14563	.FILL #563
+D14564	.FILL #564
+D14565	.FILL #565
+D14566	.FILL #566
+D14567	.FILL #567
+D14568	.FILL #568
+D14569	.FILL #569
+D14570	.FILL #570
+D14571	.FILL #571
+D14572	.FILL #572
+D14573	.FILL #573
+D14574	.FILL #574
+D14575	.FILL #575
+D14576	.FILL #576
+D14577	.FILL #577
+D14578	.FILL #578
+D14579	.FILL #579
+D14580	.FILL #580
+D14581	.FILL #581
+D14582	.FILL #582
+D14583	.FILL #583
+D14584	.FILL #584
+D14585	.FILL #585
+D14586	.FILL #586
+D14587	.FILL #587
+D14588	.FILL #588
+D14589	.FILL #589
+D14590	.FILL #590
+D14591	.FILL #591
+D14592	.FILL #592
+D14593	.FILL #593
+D14594	.FILL #594
+D14595	.FILL #595
+D14596	.FILL #596
+D14597	.FILL #597
+D14598	.FILL #598
+D14599	.FILL #599
+D14600	.FILL #600
+D14601	.FILL #601
+D14602	.FILL #602
+D14603	.FILL #603
+D14604	.FILL #604
+D14605	.FILL #605
+D14606	.FILL #606
+D14607	.FILL #607
+D14608	.FILL #608
+D14609	.FILL #609
+D14610	.FILL #610
+D14611	.FILL #611
+D14612	.FILL #612
+D14613	.FILL #613
+D14614	.FILL #614
+D14615	.FILL #615
+D14616	.FILL #616
+D14617	.FILL #617
+D14618	.FILL #618
+D14619	.FILL #619
+D14620	.FILL #620
+D14621	.FILL #621
+D14622	.FILL #622
+D14623	.FILL #623
+D14624	.FILL #624
+D14625	.FILL #625
+D14626	.FILL #626
+D14627	.FILL #627
+D14628	.FILL #628
+D14629	.FILL #629
+D14630	.FILL #630
+D14631	.FILL #631
+D14632	.FILL #632
+D14633	.FILL #633
+D14634	.FILL #634
+D14635	.FILL #635
+D14636	.FILL #636
+D14637	.FILL #637
+D14638	.FILL #638
+D14639	.FILL #639
+D14640	.FILL #640
+D14641	.FILL #641
+D14642	.FILL #642
+D14643	.FILL #643
+D14644	.FILL #644
+D14645	.FILL #645
+D14646	.FILL #646
+D14647	.FILL #647
+D14648	.FILL #648
+D14649	.FILL #649
+D14650	.FILL #650
+D14651	.FILL #651
+D14652	.FILL #652
+D14653	.FILL #653
+D14654	.FILL #654
+D14655	.FILL #655
+D14656	.FILL #656
+D14657	.FILL #657
+D14658	.FILL #658
+D14659	.FILL #659
+D14660	.FILL #660
+D14661	.FILL #661
+D14662	.FILL #662
+D14663	.FILL #663
+D14664	.FILL #664
+D14665	.FILL #665
+D14666	.FILL #666
+D14667	.FILL #667
+D14668	.FILL #668
+D14669	.FILL #669
+D14670	.FILL #670
+D14671	.FILL #671
+D14672	.FILL #672
+D14673	.FILL #673
+D14674	.FILL #674
+D14675	.FILL #675
+D14676	.FILL #676
+D14677	.FILL #677
+D14678	.FILL #678
+D14679	.FILL #679
+D14680	.FILL #680
+D14681	.FILL #681
+D14682	.FILL #682
+D14683	.FILL #683
+D14684	.FILL #684
+D14685	.FILL #685
+D14686	.FILL #686
+D14687	.FILL #687
+D14688	.FILL #688
+D14689	.FILL #689
+D14690	.FILL #690
+D14691	.FILL #691
+D14692	.FILL #692
+D14693	.FILL #693
+D14694	.FILL #694
+D14695	.FILL #695
+D14696	.FILL #696
+D14697	.FILL #697
+D14698	.FILL #698
+D14699	.FILL #699
+D14700	.FILL #700
+D14701	.FILL #701
+D14702	.FILL #702
+D14703	.FILL #703
+D14704	.FILL #704
+D14705	.FILL #705
+D14706	.FILL #706
+D14707	.FILL #707
+D14708	.FILL #708
+D14709	.FILL #709
+D14710	.FILL #710
+D14711	.FILL #711
+D14712	.FILL #712
+D14713	.FILL #713
+D14714	.FILL #714
+D14715	.FILL #715
+D14716	.FILL #716
+D14717	.FILL #717
+D14718	.FILL #718
+D14719	.FILL #719
+D14720	.FILL #720
+D14721	.FILL #721
+D14722	.FILL #722
+D14723	.FILL #723
+D14724	.FILL #724
+D14725	.FILL #725
+D14726	.FILL #726
+D14727	.FILL #727
+D14728	.FILL #728
+D14729	.FILL #729
+D14730	.FILL #730
+D14731	.FILL #731
+D14732	.FILL #732
+D14733	.FILL #733
+D14734	.FILL #734
+D14735	.FILL #735
+D14736	.FILL #736
+D14737	.FILL #737
+D14738	.FILL #738
+D14739	.FILL #739
+D14740	.FILL #740
+D14741	.FILL #741
+D14742	.FILL #742
+D14743	.FILL #743
+D14744	.FILL #744
+D14745	.FILL #745
+D14746	.FILL #746
+D14747	.FILL #747
+D14748	.FILL #748
+D14749	.FILL #749
+D14750	.FILL #750
+D14751	.FILL #751
+D14752	.FILL #752
+D14753	.FILL #753
+D14754	.FILL #754
+D14755	.FILL #755
+D14756	.FILL #756
+D14757	.FILL #757
+D14758	.FILL #758
+D14759	.FILL #759
+D14760	.FILL #760
+D14761	.FILL #761
+D14762	.FILL #762
+D14763	.FILL #763
+D14764	.FILL #764
+D14765	.FILL #765
+D14766	.FILL #766
+D14767	.FILL #767
+D14768	.FILL #768
+D14769	.FILL #769
+D14770	.FILL #770
+D14771	.FILL #771
+D14772	.FILL #772
+D14773	.FILL #773
+D14774	.FILL #774
+D14775	.FILL #775
+D14776	.FILL #776
+D14777	.FILL #777
+D14778	.FILL #778
+D14779	.FILL #779
+D14780	.FILL #780
+D14781	.FILL #781
+D14782	.FILL #782
+D14783	.FILL #783
+D14784	.FILL #784
+D14785	.FILL #785
+D14786	.FILL #786
+D14787	.FILL #787
+D14788	.FILL #788
+D14789	.FILL #789
+D14790	.FILL #790
+D14791	.FILL #791
+D14792	.FILL #792
+D14793	.FILL #793
+D14794	.FILL #794
+D14795	.FILL #795
+D14796	.FILL #796
+D14797	.FILL #797
+D14798	.FILL #798
+D14799	.FILL #799
+D14800	.FILL #800
+D14801	.FILL #801
+D14802	.FILL #802
+D14803	.FILL #803
+D14804	.FILL #804
+D14805	.FILL #805
+D14806	.FILL #806
+D14807	.FILL #807
+D14808	.FILL #808
+D14809	.FILL #809
+D14810	.FILL #810
+D14811	.FILL #811
+D14812	.FILL #812
+D14813	.FILL #813
+D14814	.FILL #814
+D14815	.FILL #815
+D14816	.FILL #816
+D14817	.FILL #817
+D14818	.FILL #818
+D14819	.FILL #819
+D14820	.FILL #820
+D14821	.FILL #821
+D14822	.FILL #822
+D14823	.FILL #823
+D14824	.FILL #824
+D14825	.FILL #825
+D14826	.FILL #826
+D14827	.FILL #827
+D14828	.FILL #828
+D14829	.FILL #829
+D14830	.FILL #830
+D14831	.FILL #831
+D14832	.FILL #832
+D14833	.FILL #833
+D14834	.FILL #834
+D14835	.FILL #835
+D14836	.FILL #836
+D14837	.FILL #837
+D14838	.FILL #838
+D14839	.FILL #839
+D14840	.FILL #840
+D14841	.FILL #841
+D14842	.FILL #842
+D14843	.FILL #843
+D14844	.FILL #844
+D14845	.FILL #845
+D14846	.FILL #846
+D14847	.FILL #847
+D14848	.FILL #848
+D14849	.FILL #849
+D14850	.FILL #850
+D14851	.FILL #851
+D14852	.FILL #852
+D14853	.FILL #853
+D14854	.FILL #854
+D14855	.FILL #855
+D14856	.FILL #856
+D14857	.FILL #857
+D14858	.FILL #858
+D14859	.FILL #859
+D14860	.FILL #860
+D14861	.FILL #861
+D14862	.FILL #862
+D14863	.FILL #863
+D14864	.FILL #864
+D14865	.FILL #865
+D14866	.FILL #866
+D14867	.FILL #867
+D14868	.FILL #868
+D14869	.FILL #869
+D14870	.FILL #870
+D14871	.FILL #871
+D14872	.FILL #872
+D14873	.FILL #873
+D14874	.FILL #874
+D14875	.FILL #875
+D14876	.FILL #876
+D14877	.FILL #877
+D14878	.FILL #878
+D14879	.FILL #879
+D14880	.FILL #880
+D14881	.FILL #881
+D14882	.FILL #882
+D14883	.FILL #883
+D14884	.FILL #884
+D14885	.FILL #885
+D14886	.FILL #886
+D14887	.FILL #887
+D14888	.FILL #888
+D14889	.FILL #889
+D14890	.FILL #890
+D14891	.FILL #891
+D14892	.FILL #892
+D14893	.FILL #893
+D14894	.FILL #894
+D14895	.FILL #895
+D14896	.FILL #896
+D14897	.FILL #897
+D14898	.FILL #898
+D14899	.FILL #899
+D14900	.FILL #900
+D14901	.FILL #901
+D14902	.FILL #902
+D14903	.FILL #903
+D14904	.FILL #904
+D14905	.FILL #905
+D14906	.FILL #906
+D14907	.FILL #907
+D14908	.FILL #908
+D14909	.FILL #909
+D14910	.FILL #910
+D14911	.FILL #911
+D14912	.FILL #912
+D14913	.FILL #913
+D14914	.FILL #914
+D14915	.FILL #915
+D14916	.FILL #916
+D14917	.FILL #917
+D14918	.FILL #918
+D14919	.FILL #919
+D14920	.FILL #920
+D14921	.FILL #921
+D14922	.FILL #922
+D14923	.FILL #923
+D14924	.FILL #924
+D14925	.FILL #925
+D14926	.FILL #926
+D14927	.FILL #927
+D14928	.FILL #928
+D14929	.FILL #929
+D14930	.FILL #930
+D14931	.FILL #931
+D14932	.FILL #932
+D14933	.FILL #933
+D14934	.FILL #934
+D14935	.FILL #935
+D14936	.FILL #936
+D14937	.FILL #937
+D14938	.FILL #938
+D14939	.FILL #939
+D14940	.FILL #940
+D14941	.FILL #941
+D14942	.FILL #942
+D14943	.FILL #943
+D14944	.FILL #944
+D14945	.FILL #945
+D14946	.FILL #946
+D14947	.FILL #947
+D14948	.FILL #948
+D14949	.FILL #949
+D14950	.FILL #950
+D14951	.FILL #951
+D14952	.FILL #952
+D14953	.FILL #953
+D14954	.FILL #954
+D14955	.FILL #955
+D14956	.FILL #956
+D14957	.FILL #957
+D14958	.FILL #958
+D14959	.FILL #959
+D14960	.FILL #960
+D14961	.FILL #961
+D14962	.FILL #962
+D14963	.FILL #963
+D14964	.FILL #964
+D14965	.FILL #965
+D14966	.FILL #966
+D14967	.FILL #967
+D14968	.FILL #968
+D14969	.FILL #969
+D14970	.FILL #970
+D14971	.FILL #971
+D14972	.FILL #972
+D14973	.FILL #973
+D14974	.FILL #974
+D14975	.FILL #975
+D14976	.FILL #976
+D14977	.FILL #977
+D14978	.FILL #978
+D14979	.FILL #979
+D14980	.FILL #980
+D14981	.FILL #981
+D14982	.FILL #982
+D14983	.FILL #983
+D14984	.FILL #984
+D14985	.FILL #985
+D14986	.FILL #986
+D14987	.FILL #987
+D14988	.FILL #988
+D14989	.FILL #989
+D14990	.FILL #990
+D14991	.FILL #991
+D14992	.FILL #992
+D14993	.FILL #993
+D14994	.FILL #994
+D14995	.FILL #995
+D14996	.FILL #996
+D14997	.FILL #997
+D14998	.FILL #998
+D14999	.FILL #999
+D15000	.FILL #0
+D15001	.FILL #1
+D15002	.FILL #2
+D15003	.FILL #3
+D15004	.FILL #4
+D15005	.FILL #5
+D15006	.FILL #6
+D15007	.FILL #7
+D15008	.FILL #8
+D15009	.FILL #9
+D15010	.FILL #10
+D15011	.FILL #11
+D15012	.FILL #12
+D15013	.FILL #13
+D15014	.FILL #14
+D15015	.FILL #15
+D15016	.FILL #16
+D15017	.FILL #17
+D15018	.FILL #18
+D15019	.FILL #19
+D15020	.FILL #20
+D15021	.FILL #21
+D15022	.FILL #22
+D15023	.FILL #23
+D15024	.FILL #24
+D15025	.FILL #25
+D15026	.FILL #26
+D15027	.FILL #27
+D15028	.FILL #28
+D15029	.FILL #29
+D15030	.FILL #30
+D15031	.FILL #31
+D15032	.FILL #32
+D15033	.FILL #33
+D15034	.FILL #34
+D15035	.FILL #35
+D15036	.FILL #36
+D15037	.FILL #37
+D15038	.FILL #38
+D15039	.FILL #39
+D15040	.FILL #40
+D15041	.FILL #41
+D15042	.FILL #42
+D15043	.FILL #43
+D15044	.FILL #44
+D15045	.FILL #45
+D15046	.FILL #46
+D15047	.FILL #47
+D15048	.FILL #48
+D15049	.FILL #49
+D15050	.FILL #50
+D15051	.FILL #51
+D15052	.FILL #52
+D15053	.FILL #53
+D15054	.FILL #54
+D15055	.FILL #55
+D15056	.FILL #56
+D15057	.FILL #57
+D15058	.FILL #58
+D15059	.FILL #59
+D15060	.FILL #60
+D15061	.FILL #61
+D15062	.FILL #62
+D15063	.FILL #63
+D15064	.FILL #64
+D15065	.FILL #65
+D15066	.FILL #66
+D15067	.FILL #67
+D15068	.FILL #68
+D15069	.FILL #69
+D15070	.FILL #70
+D15071	.FILL #71
+D15072	.FILL #72
+D15073	.FILL #73
+D15074	.FILL #74
+D15075	.FILL #75
+D15076	.FILL #76
+D15077	.FILL #77
+D15078	.FILL #78
+D15079	.FILL #79
+D15080	.FILL #80
+D15081	.FILL #81
+D15082	.FILL #82
+D15083	.FILL #83
+D15084	.FILL #84
+D15085	.FILL #85
+D15086	.FILL #86
+D15087	.FILL #87
+D15088	.FILL #88
+D15089	.FILL #89
+D15090	.FILL #90
+D15091	.FILL #91
+D15092	.FILL #92
+D15093	.FILL #93
+D15094	.FILL #94
+D15095	.FILL #95
+D15096	.FILL #96
+D15097	.FILL #97
+D15098	.FILL #98
+D15099	.FILL #99
+D15100	.FILL #100
+D15101	.FILL #101
+D15102	.FILL #102
+D15103	.FILL #103
+D15104	.FILL #104
+D15105	.FILL #105
+D15106	.FILL #106
+D15107	.FILL #107
+D15108	.FILL #108
+D15109	.FILL #109
+D15110	.FILL #110
+D15111	.FILL #111
+D15112	.FILL #112
+D15113	.FILL #113
+D15114	.FILL #114
+D15115	.FILL #115
+D15116	.FILL #116
+D15117	.FILL #117
+D15118	.FILL #118
+D15119	.FILL #119
+D15120	.FILL #120
+D15121	.FILL #121
+D15122	.FILL #122
+D15123	.FILL #123
+D15124	.FILL #124
+D15125	.FILL #125
+D15126	.FILL #126
+D15127	.FILL #127
+D15128	.FILL #128
+D15129	.FILL #129
+D15130	.FILL #130
+D15131	.FILL #131
+D15132	.FILL #132
+D15133	.FILL #133
+D15134	.FILL #134
+D15135	.FILL #135
+D15136	.FILL #136
+D15137	.FILL #137
+D15138	.FILL #138
+D15139	.FILL #139
+D15140	.FILL #140
+D15141	.FILL #141
+D15142	.FILL #142
+D15143	.FILL #143
+D15144	.FILL #144
+D15145	.FILL #145
+D15146	.FILL #146
+D15147	.FILL #147
+D15148	.FILL #148
+D15149	.FILL #149
+D15150	.FILL #150
+D15151	.FILL #151
+D15152	.FILL #152
+D15153	.FILL #153
+D15154	.FILL #154
+D15155	.FILL #155
+D15156	.FILL #156
+D15157	.FILL #157
+D15158	.FILL #158
+D15159	.FILL #159
+D15160	.FILL #160
+D15161	.FILL #161
+D15162	.FILL #162
+D15163	.FILL #163
+D15164	.FILL #164
+D15165	.FILL #165
+D15166	.FILL #166
+D15167	.FILL #167
+D15168	.FILL #168
+D15169	.FILL #169
+D15170	.FILL #170
+D15171	.FILL #171
+D15172	.FILL #172
+D15173	.FILL #173
+D15174	.FILL #174
+D15175	.FILL #175
+D15176	.FILL #176
+D15177	.FILL #177
+D15178	.FILL #178
+D15179	.FILL #179
+D15180	.FILL #180
+D15181	.FILL #181
+D15182	.FILL #182
+D15183	.FILL #183
+D15184	.FILL #184
+D15185	.FILL #185
+D15186	.FILL #186
+D15187	.FILL #187
+D15188	.FILL #188
+D15189	.FILL #189
+D15190	.FILL #190
+D15191	.FILL #191
+D15192	.FILL #192
+D15193	.FILL #193
+D15194	.FILL #194
+D15195	.FILL #195
+D15196	.FILL #196
+D15197	.FILL #197
+D15198	.FILL #198
+D15199	.FILL #199
+D15200	.FILL #200
+D15201	.FILL #201
+D15202	.FILL #202
+D15203	.FILL #203
+D15204	.FILL #204
+D15205	.FILL #205
+D15206	.FILL #206
+D15207	.FILL #207
+D15208	.FILL #208
+D15209	.FILL #209
+D15210	.FILL #210
+D15211	.FILL #211
+D15212	.FILL #212
+D15213	.FILL #213
+D15214	.FILL #214
+D15215	.FILL #215
+D15216	.FILL #216
+D15217	.FILL #217
+D15218	.FILL #218
+D15219	.FILL #219
+D15220	.FILL #220
+D15221	.FILL #221
+D15222	.FILL #222
+D15223	.FILL #223
+D15224	.FILL #224
+D15225	.FILL #225
+D15226	.FILL #226
+D15227	.FILL #227
+D15228	.FILL #228
+D15229	.FILL #229
+D15230	.FILL #230
+D15231	.FILL #231
+D15232	.FILL #232
+D15233	.FILL #233
+D15234	.FILL #234
+D15235	.FILL #235
+D15236	.FILL #236
+D15237	.FILL #237
+D15238	.FILL #238
+D15239	.FILL #239
+D15240	.FILL #240
+D15241	.FILL #241
+D15242	.FILL #242
+D15243	.FILL #243
+D15244	.FILL #244
+D15245	.FILL #245
+D15246	.FILL #246
+D15247	.FILL #247
+D15248	.FILL #248
+D15249	.FILL #249
+D15250	.FILL #250
+D15251	.FILL #251
+D15252	.FILL #252
+D15253	.FILL #253
+D15254	.FILL #254
+D15255	.FILL #255
+D15256	.FILL #256
+D15257	.FILL #257
+D15258	.FILL #258
+D15259	.FILL #259
+D15260	.FILL #260
+D15261	.FILL #261
+D15262	.FILL #262
+D15263	.FILL #263
+D15264	.FILL #264
+D15265	.FILL #265
+D15266	.FILL #266
+D15267	.FILL #267
+D15268	.FILL #268
+D15269	.FILL #269
+D15270	.FILL #270
+D15271	.FILL #271
+D15272	.FILL #272
+D15273	.FILL #273
+D15274	.FILL #274
+D15275	.FILL #275
+D15276	.FILL #276
+D15277	.FILL #277
+D15278	.FILL #278
+D15279	.FILL #279
+D15280	.FILL #280
+D15281	.FILL #281
+D15282	.FILL #282
+D15283	.FILL #283
+D15284	.FILL #284
+D15285	.FILL #285
+D15286	.FILL #286
+D15287	.FILL #287
+D15288	.FILL #288
+D15289	.FILL #289
+D15290	.FILL #290
+D15291	.FILL #291
+D15292	.FILL #292
+D15293	.FILL #293
+D15294	.FILL #294
+D15295	.FILL #295
+D15296	.FILL #296
+D15297	.FILL #297
+D15298	.FILL #298
+D15299	.FILL #299
+D15300	.FILL #300
+D15301	.FILL #301
+D15302	.FILL #302
+D15303	.FILL #303
+D15304	.FILL #304
+D15305	.FILL #305
+D15306	.FILL #306
+D15307	.FILL #307
+D15308	.FILL #308
+D15309	.FILL #309
+D15310	.FILL #310
+D15311	.FILL #311
+D15312	.FILL #312
+D15313	.FILL #313
+D15314	.FILL #314
+D15315	.FILL #315
+D15316	.FILL #316
+D15317	.FILL #317
+D15318	.FILL #318
+D15319	.FILL #319
+D15320	.FILL #320
+D15321	.FILL #321
+D15322	.FILL #322
+D15323	.FILL #323
+D15324	.FILL #324
+D15325	.FILL #325
+D15326	.FILL #326
+D15327	.FILL #327
+D15328	.FILL #328
+D15329	.FILL #329
+D15330	.FILL #330
+D15331	.FILL #331
+D15332	.FILL #332
+D15333	.FILL #333
+D15334	.FILL #334
+D15335	.FILL #335
+D15336	.FILL #336
+D15337	.FILL #337
+D15338	.FILL #338
+D15339	.FILL #339
+D15340	.FILL #340
+D15341	.FILL #341
+D15342	.FILL #342
+D15343	.FILL #343
+D15344	.FILL #344
+D15345	.FILL #345
+D15346	.FILL #346
+D15347	.FILL #347
+D15348	.FILL #348
+D15349	.FILL #349
+D15350	.FILL #350
+D15351	.FILL #351
+D15352	.FILL #352
+D15353	.FILL #353
+D15354	.FILL #354
+D15355	.FILL #355
+D15356	.FILL #356
+D15357	.FILL #357
+D15358	.FILL #358
+D15359	.FILL #359
+D15360	.FILL #360
+D15361	.FILL #361
+D15362	.FILL #362
+D15363	.FILL #363
+D15364	.FILL #364
+D15365	.FILL #365
+D15366	.FILL #366
+D15367	.FILL #367
+D15368	.FILL #368
+D15369	.FILL #369
+D15370	.FILL #370
+D15371	.FILL #371
+D15372	.FILL #372
+D15373	.FILL #373
+D15374	.FILL #374
+D15375	.FILL #375
+D15376	.FILL #376
+D15377	.FILL #377
+D15378	.FILL #378
+D15379	.FILL #379
+D15380	.FILL #380
+D15381	.FILL #381
+D15382	.FILL #382
+D15383	.FILL #383
+D15384	.FILL #384
+D15385	.FILL #385
+D15386	.FILL #386
+D15387	.FILL #387
+D15388	.FILL #388
+D15389	.FILL #389
+D15390	.FILL #390
+D15391	.FILL #391
+D15392	.FILL #392
+D15393	.FILL #393
+D15394	.FILL #394
+D15395	.FILL #395
+D15396	.FILL #396
+D15397	.FILL #397
+D15398	.FILL #398
+D15399	.FILL #399
+D15400	.FILL #400
+D15401	.FILL #401
+D15402	.FILL #402
+D15403	.FILL #403
+D15404	.FILL #404
+D15405	.FILL #405
+D15406	.FILL #406
+D15407	.FILL #407
+D15408	.FILL #408
+D15409	.FILL #409
+D15410	.FILL #410
+D15411	.FILL #411
+D15412	.FILL #412
+D15413	.FILL #413
+D15414	.FILL #414
+D15415	.FILL #415
+D15416	.FILL #416
+D15417	.FILL #417
+D15418	.FILL #418
+D15419	.FILL #419
+D15420	.FILL #420
+D15421	.FILL #421
+D15422	.FILL #422
+D15423	.FILL #423
+D15424	.FILL #424
+D15425	.FILL #425
+D15426	.FILL #426
+D15427	.FILL #427
+D15428	.FILL #428
+D15429	.FILL #429
+D15430	.FILL #430
+D15431	.FILL #431
+D15432	.FILL #432
+D15433	.FILL #433
+D15434	.FILL #434
+D15435	.FILL #435
+D15436	.FILL #436
+D15437	.FILL #437
+D15438	.FILL #438
+D15439	.FILL #439
+D15440	.FILL #440
+D15441	.FILL #441
+D15442	.FILL #442
+D15443	.FILL #443
+D15444	.FILL #444
+D15445	.FILL #445
+D15446	.FILL #446
+D15447	.FILL #447
+D15448	.FILL #448
+D15449	.FILL #449
+D15450	.FILL #450
+D15451	.FILL #451
+D15452	.FILL #452
+D15453	.FILL #453
+D15454	.FILL #454
+D15455	.FILL #455
+D15456	.FILL #456
+D15457	.FILL #457
+D15458	.FILL #458
+D15459	.FILL #459
+D15460	.FILL #460
+D15461	.FILL #461
+D15462	.FILL #462
+D15463	.FILL #463
+D15464	.FILL #464
+D15465	.FILL #465
+D15466	.FILL #466
+D15467	.FILL #467
+D15468	.FILL #468
+D15469	.FILL #469
+D15470	.FILL #470
+D15471	.FILL #471
+D15472	.FILL #472
+D15473	.FILL #473
+D15474	.FILL #474
+D15475	.FILL #475
+D15476	.FILL #476
+D15477	.FILL #477
+D15478	.FILL #478
+D15479	.FILL #479
+D15480	.FILL #480
+D15481	.FILL #481
+D15482	.FILL #482
+D15483	.FILL #483
+D15484	.FILL #484
+D15485	.FILL #485
+D15486	.FILL #486
+D15487	.FILL #487
+D15488	.FILL #488
+D15489	.FILL #489
+D15490	.FILL #490
+D15491	.FILL #491
+D15492	.FILL #492
+D15493	.FILL #493
+D15494	.FILL #494
+D15495	.FILL #495
+D15496	.FILL #496
+D15497	.FILL #497
+D15498	.FILL #498
+D15499	.FILL #499
+D15500	.FILL #500
+D15501	.FILL #501
+D15502	.FILL #502
+D15503	.FILL #503
+D15504	.FILL #504
+D15505	.FILL #505
+D15506	.FILL #506
+D15507	.FILL #507
+D15508	.FILL #508
+D15509	.FILL #509
+D15510	.FILL #510
+D15511	.FILL #511
+D15512	.FILL #512
+D15513	.FILL #513
+D15514	.FILL #514
+D15515	.FILL #515
+D15516	.FILL #516
+D15517	.FILL #517
+D15518	.FILL #518
+D15519	.FILL #519
+D15520	.FILL #520
+D15521	.FILL #521
+D15522	.FILL #522
+D15523	.FILL #523
+D15524	.FILL #524
+D15525	.FILL #525
+D15526	.FILL #526
+D15527	.FILL #527
+D15528	.FILL #528
+D15529	.FILL #529
+D15530	.FILL #530
+D15531	.FILL #531
+D15532	.FILL #532
+D15533	.FILL #533
+D15534	.FILL #534
+D15535	.FILL #535
+D15536	.FILL #536
+D15537	.FILL #537
+D15538	.FILL #538
+D15539	.FILL #539
+D15540	.FILL #540
+D15541	.FILL #541
+D15542	.FILL #542
+D15543	.FILL #543
+D15544	.FILL #544
+D15545	.FILL #545
+D15546	.FILL #546
+D15547	.FILL #547
+D15548	.FILL #548
+D15549	.FILL #549
+D15550	.FILL #550
+D15551	.FILL #551
+D15552	.FILL #552
+D15553	.FILL #553
+D15554	.FILL #554
+D15555	.FILL #555
+D15556	.FILL #556
+D15557	.FILL #557
+D15558	.FILL #558
+D15559	.FILL #559
+D15560	.FILL #560
+D15561	.FILL #561
+D15562	.FILL #562
+D15563	.FILL #563
+D15564	.FILL #564
+D15565	.FILL #565
+D15566	.FILL #566
+D15567	.FILL #567
+D15568	.FILL #568
+D15569	.FILL #569
+D15570	.FILL #570
+D15571	.FILL #571
+D15572	.FILL #572
+D15573	.FILL #573
+D15574	.FILL #574
+D15575	.FILL #575
+D15576	.FILL #576
+D15577	.FILL #577
+D15578	.FILL #578
+D15579	.FILL #579
+D15580	.FILL #580
+D15581	.FILL #581
+D15582	.FILL #582
+D15583	.FILL #583
+D15584	.FILL #584
+D15585	.FILL #585
+D15586	.FILL #586
+D15587	.FILL #587
+D15588	.FILL #588
+D15589	.FILL #589
+D15590	.FILL #590
+D15591	.FILL #591
+D15592	.FILL #592
+D15593	.FILL #593
+D15594	.FILL #594
+D15595	.FILL #595
+D15596	.FILL #596
+D15597	.FILL #597
+D15598	.FILL #598
+D15599	.FILL #599
+D15600	.FILL #600
+D15601	.FILL #601
+D15602	.FILL #602
+D15603	.FILL #603
+D15604	.FILL #604
+D15605	.FILL #605
+D15606	.FILL #606
+D15607	.FILL #607
+D15608	.FILL #608
+D15609	.FILL #609
+D15610	.FILL #610
+D15611	.FILL #611
+D15612	.FILL #612
+D15613	.FILL #613
+D15614	.FILL #614
+D15615	.FILL #615
+D15616	.FILL #616
+D15617	.FILL #617
+D15618	.FILL #618
+D15619	.FILL #619
+D15620	.FILL #620
+D15621	.FILL #621
+D15622	.FILL #622
+D15623	.FILL #623
+D15624	.FILL #624
+D15625	.FILL #625
+D15626	.FILL #626
+D15627	.FILL #627
+D15628	.FILL #628
+D15629	.FILL #629
+D15630	.FILL #630
+D15631	.FILL #631
+D15632	.FILL #632
+D15633	.FILL #633
+D15634	.FILL #634
+D15635	.FILL #635
+D15636	.FILL #636
+D15637	.FILL #637
+D15638	.FILL #638
+D15639	.FILL #639
+D15640	.FILL #640
+D15641	.FILL #641
+D15642	.FILL #642
+D15643	.FILL #643
+D15644	.FILL #644
+D15645	.FILL #645
+D15646	.FILL #646
+D15647	.FILL #647
+D15648	.FILL #648
+D15649	.FILL #649
+D15650	.FILL #650
+D15651	.FILL #651
+D15652	.FILL #652
+D15653	.FILL #653
+D15654	.FILL #654
+D15655	.FILL #655
+D15656	.FILL #656
+D15657	.FILL #657
+D15658	.FILL #658
+D15659	.FILL #659
+D15660	.FILL #660
+D15661	.FILL #661
+D15662	.FILL #662
+D15663	.FILL #663
+D15664	.FILL #664
+D15665	.FILL #665
+D15666	.FILL #666
+D15667	.FILL #667
+D15668	.FILL #668
+D15669	.FILL #669
+D15670	.FILL #670
+D15671	.FILL #671
+D15672	.FILL #672
+D15673	.FILL #673
+D15674	.FILL #674
+D15675	.FILL #675
+D15676	.FILL #676
+D15677	.FILL #677
+D15678	.FILL #678
+D15679	.FILL #679
+D15680	.FILL #680
+D15681	.FILL #681
+D15682	.FILL #682
+D15683	.FILL #683
+D15684	.FILL #684
+D15685	.FILL #685
+D15686	.FILL #686
+D15687	.FILL #687
+D15688	.FILL #688
+D15689	.FILL #689
+D15690	.FILL #690
+D15691	.FILL #691
+D15692	.FILL #692
+D15693	.FILL #693
+D15694	.FILL #694
+D15695	.FILL #695
+D15696	.FILL #696
+D15697	.FILL #697
+D15698	.FILL #698
+D15699	.FILL #699
+D15700	.FILL #700
+D15701	.FILL #701
+D15702	.FILL #702
+D15703	.FILL #703
+D15704	.FILL #704
+D15705	.FILL #705
+D15706	.FILL #706
+D15707	.FILL #707
+D15708	.FILL #708
+D15709	.FILL #709
+D15710	.FILL #710
+D15711	.FILL #711
+D15712	.FILL #712
+D15713	.FILL #713
+D15714	.FILL #714
+D15715	.FILL #715
+D15716	.FILL #716
+D15717	.FILL #717
+D15718	.FILL #718
+D15719	.FILL #719
+D15720	.FILL #720
+D15721	.FILL #721
+D15722	.FILL #722
+D15723	.FILL #723
+D15724	.FILL #724
+D15725	.FILL #725
+D15726	.FILL #726
+D15727	.FILL #727
+D15728	.FILL #728
+D15729	.FILL #729
+D15730	.FILL #730
+D15731	.FILL #731
+D15732	.FILL #732
+D15733	.FILL #733
+D15734	.FILL #734
+D15735	.FILL #735
+D15736	.FILL #736
+D15737	.FILL #737
+D15738	.FILL #738
+D15739	.FILL #739
+D15740	.FILL #740
+D15741	.FILL #741
+D15742	.FILL #742
+D15743	.FILL #743
+D15744	.FILL #744
+D15745	.FILL #745
+D15746	.FILL #746
+D15747	.FILL #747
+D15748	.FILL #748
+D15749	.FILL #749
+D15750	.FILL #750
+D15751	.FILL #751
+D15752	.FILL #752
+D15753	.FILL #753
+D15754	.FILL #754
+D15755	.FILL #755
+D15756	.FILL #756
+D15757	.FILL #757
+D15758	.FILL #758
+D15759	.FILL #759
+D15760	.FILL #760
+D15761	.FILL #761
+D15762	.FILL #762
+D15763	.FILL #763
+D15764	.FILL #764
+D15765	.FILL #765
+D15766	.FILL #766
+D15767	.FILL #767
+D15768	.FILL #768
+D15769	.FILL #769
+D15770	.FILL #770
+D15771	.FILL #771
+D15772	.FILL #772
+D15773	.FILL #773
+D15774	.FILL #774
+D15775	.FILL #775
+D15776	.FILL #776
+D15777	.FILL #777
+D15778	.FILL #778
+D15779	.FILL #779
+D15780	.FILL #780
+D15781	.FILL #781
+D15782	.FILL #782
+D15783	.FILL #783
+D15784	.FILL #784
+D15785	.FILL #785
+D15786	.FILL #786
+D15787	.FILL #787
+D15788	.FILL #788
+D15789	.FILL #789
+D15790	.FILL #790
+D15791	.FILL #791
+D15792	.FILL #792
+D15793	.FILL #793
+D15794	.FILL #794
+D15795	.FILL #795
+D15796	.FILL #796
+D15797	.FILL #797
+D15798	.FILL #798
+D15799	.FILL #799
+D15800	.FILL #800
+D15801	.FILL #801
+D15802	.FILL #802
+D15803	.FILL #803
+D15804	.FILL #804
+D15805	.FILL #805
+D15806	.FILL #806
+D15807	.FILL #807
+D15808	.FILL #808
+D15809	.FILL #809
+D15810	.FILL #810
+D15811	.FILL #811
+D15812	.FILL #812
+D15813	.FILL #813
+D15814	.FILL #814
+D15815	.FILL #815
+D15816	.FILL #816
+D15817	.FILL #817
+D15818	.FILL #818
+D15819	.FILL #819
+D15820	.FILL #820
+D15821	.FILL #821
+D15822	.FILL #822
+D15823	.FILL #823
+D15824	.FILL #824
+D15825	.FILL #825
+D15826	.FILL #826
+D15827	.FILL #827
+D15828	.FILL #828
+D15829	.FILL #829
+D15830	.FILL #830
+D15831	.FILL #831
+D15832	.FILL #832
+D15833	.FILL #833
+D15834	.FILL #834
+D15835	.FILL #835
+D15836	.FILL #836
+D15837	.FILL #837
+D15838	.FILL #838
+D15839	.FILL #839
+D15840	.FILL #840
+D15841	.FILL #841
+D15842	.FILL #842
+D15843	.FILL #843
+D15844	.FILL #844
+D15845	.FILL #845
+D15846	.FILL #846
+D15847	.FILL #847
+D15848	.FILL #848
+D15849	.FILL #849
+D15850	.FILL #850
+D15851	.FILL #851
+D15852	.FILL #852
+D15853	.FILL #853
+D15854	.FILL #854
+D15855	.FILL #855
+D15856	.FILL #856
+D15857	.FILL #857
+D15858	.FILL #858
+D15859	.FILL #859
+D15860	.FILL #860
+D15861	.FILL #861
+D15862	.FILL #862
+D15863	.FILL #863
+D15864	.FILL #864
+D15865	.FILL #865
+D15866	.FILL #866
+D15867	.FILL #867
+D15868	.FILL #868
+D15869	.FILL #869
+D15870	.FILL #870
+D15871	.FILL #871
+D15872	.FILL #872
+D15873	.FILL #873
+D15874	.FILL #874
+D15875	.FILL #875
+D15876	.FILL #876
+D15877	.FILL #877
+D15878	.FILL #878
+D15879	.FILL #879
+D15880	.FILL #880
+D15881	.FILL #881
+D15882	.FILL #882
+D15883	.FILL #883
+D15884	.FILL #884
+D15885	.FILL #885
+D15886	.FILL #886
+D15887	.FILL #887
+D15888	.FILL #888
+D15889	.FILL #889
+D15890	.FILL #890
+D15891	.FILL #891
+D15892	.FILL #892
+D15893	.FILL #893
+D15894	.FILL #894
+D15895	.FILL #895
+D15896	.FILL #896
+D15897	.FILL #897
+D15898	.FILL #898
+D15899	.FILL #899
+D15900	.FILL #900
+D15901	.FILL #901
+D15902	.FILL #902
+D15903	.FILL #903
+D15904	.FILL #904
+D15905	.FILL #905
+D15906	.FILL #906
+D15907	.FILL #907
+D15908	.FILL #908
+D15909	.FILL #909
+D15910	.FILL #910
+D15911	.FILL #911
+D15912	.FILL #912
+D15913	.FILL #913
+D15914	.FILL #914
+D15915	.FILL #915
+D15916	.FILL #916
+D15917	.FILL #917
+D15918	.FILL #918
+D15919	.FILL #919
+D15920	.FILL #920
+D15921	.FILL #921
+D15922	.FILL #922
+D15923	.FILL #923
+D15924	.FILL #924
+D15925	.FILL #925
+D15926	.FILL #926
+D15927	.FILL #927
+D15928	.FILL #928
+D15929	.FILL #929
+D15930	.FILL #930
+D15931	.FILL #931
+D15932	.FILL #932
+D15933	.FILL #933
+D15934	.FILL #934
+D15935	.FILL #935
+D15936	.FILL #936
+D15937	.FILL #937
+D15938	.FILL #938
+D15939	.FILL #939
+D15940	.FILL #940
+D15941	.FILL #941
+D15942	.FILL #942
+D15943	.FILL #943
+D15944	.FILL #944
+D15945	.FILL #945
+D15946	.FILL #946
+D15947	.FILL #947
+D15948	.FILL #948
+D15949	.FILL #949
+D15950	.FILL #950
+D15951	.FILL #951
+D15952	.FILL #952
+D15953	.FILL #953
+D15954	.FILL #954
+D15955	.FILL #955
+D15956	.FILL #956
+D15957	.FILL #957
+D15958	.FILL #958
+D15959	.FILL #959
+D15960	.FILL #960
+D15961	.FILL #961
+D15962	.FILL #962
+D15963	.FILL #963
+D15964	.FILL #964
+D15965	.FILL #965
+D15966	.FILL #966
+D15967	.FILL #967
+D15968	.FILL #968
+D15969	.FILL #969
+D15970	.FILL #970
+D15971	.FILL #971
+D15972	.FILL #972
+D15973	.FILL #973
+D15974	.FILL #974
+D15975	.FILL #975
+D15976	.FILL #976
+D15977	.FILL #977
+D15978	.FILL #978
+D15979	.FILL #979
+D15980	.FILL #980
+D15981	.FILL #981
+D15982	.FILL #982
+D15983	.FILL #983
+D15984	.FILL #984
+D15985	.FILL #985
+D15986	.FILL #986
+D15987	.FILL #987
+D15988	.FILL #988
+D15989	.FILL #989
+D15990	.FILL #990
+D15991	.FILL #991
+D15992	.FILL #992
+D15993	.FILL #993
+D15994	.FILL #994
+D15995	.FILL #995
+D15996	.FILL #996
+D15997	.FILL #997
+D15998	.FILL #998
+D15999	.FILL #999
+D16000	.FILL #0
+D16001	.FILL #1
+D16002	.FILL #2
+D16003	.FILL #3
+D16004	.FILL #4
+D16005	.FILL #5
+D16006	.FILL #6
+D16007	.FILL #7
+D16008	.FILL #8
+D16009	.FILL #9
+D16010	.FILL #10
+D16011	.FILL #11
+D16012	.FILL #12
+D16013	.FILL #13
+D16014	.FILL #14
+D16015	.FILL #15
+D16016	.FILL #16
+D16017	.FILL #17
+D16018	.FILL #18
+D16019	.FILL #19
+D16020	.FILL #20
+D16021	.FILL #21
+D16022	.FILL #22
+D16023	.FILL #23
+D16024	.FILL #24
+D16025	.FILL #25
+D16026	.FILL #26
+D16027	.FILL #27
+D16028	.FILL #28
+D16029	.FILL #29
+D16030	.FILL #30
+D16031	.FILL #31
+D16032	.FILL #32
+D16033	.FILL #33
+D16034	.FILL #34
+D16035	.FILL #35
+D16036	.FILL #36
+D16037	.FILL #37
+D16038	.FILL #38
+D16039	.FILL #39
+D16040	.FILL #40
+D16041	.FILL #41
+D16042	.FILL #42
+D16043	.FILL #43
+D16044	.FILL #44
+D16045	.FILL #45
+D16046	.FILL #46
+D16047	.FILL #47
+D16048	.FILL #48
+D16049	.FILL #49
+D16050	.FILL #50
+D16051	.FILL #51
+D16052	.FILL #52
+D16053	.FILL #53
+D16054	.FILL #54
+D16055	.FILL #55
+D16056	.FILL #56
+D16057	.FILL #57
+D16058	.FILL #58
+D16059	.FILL #59
+D16060	.FILL #60
+D16061	.FILL #61
+D16062	.FILL #62
+D16063	.FILL #63
+D16064	.FILL #64
+D16065	.FILL #65
+D16066	.FILL #66
+D16067	.FILL #67
+D16068	.FILL #68
+D16069	.FILL #69
+D16070	.FILL #70
+D16071	.FILL #71
+D16072	.FILL #72
+D16073	.FILL #73
+D16074	.FILL #74
+D16075	.FILL #75
+D16076	.FILL #76
+D16077	.FILL #77
+D16078	.FILL #78
+D16079	.FILL #79
+D16080	.FILL #80
+D16081	.FILL #81
+D16082	.FILL #82
+D16083	.FILL #83
+D16084	.FILL #84
+D16085	.FILL #85
+D16086	.FILL #86
+D16087	.FILL #87
+D16088	.FILL #88
+D16089	.FILL #89
+D16090	.FILL #90
+D16091	.FILL #91
+D16092	.FILL #92
+D16093	.FILL #93
+D16094	.FILL #94
+D16095	.FILL #95
+D16096	.FILL #96
+D16097	.FILL #97
+D16098	.FILL #98
+D16099	.FILL #99
+D16100	.FILL #100
+D16101	.FILL #101
+D16102	.FILL #102
+D16103	.FILL #103
+D16104	.FILL #104
+D16105	.FILL #105
+D16106	.FILL #106
+D16107	.FILL #107
+D16108	.FILL #108
+D16109	.FILL #109
+D16110	.FILL #110
+D16111	.FILL #111
+D16112	.FILL #112
+D16113	.FILL #113
+D16114	.FILL #114
+D16115	.FILL #115
+D16116	.FILL #116
+D16117	.FILL #117
+D16118	.FILL #118
+D16119	.FILL #119
+D16120	.FILL #120
+D16121	.FILL #121
+D16122	.FILL #122
+D16123	.FILL #123
+D16124	.FILL #124
+D16125	.FILL #125
+D16126	.FILL #126
+D16127	.FILL #127
+D16128	.FILL #128
+D16129	.FILL #129
+D16130	.FILL #130
+D16131	.FILL #131
+D16132	.FILL #132
+D16133	.FILL #133
+D16134	.FILL #134
+D16135	.FILL #135
+D16136	.FILL #136
+D16137	.FILL #137
+D16138	.FILL #138
+D16139	.FILL #139
+D16140	.FILL #140
+D16141	.FILL #141
+D16142	.FILL #142
+D16143	.FILL #143
+D16144	.FILL #144
+D16145	.FILL #145
+D16146	.FILL #146
+D16147	.FILL #147
+D16148	.FILL #148
+D16149	.FILL #149
+D16150	.FILL #150
+D16151	.FILL #151
+D16152	.FILL #152
+D16153	.FILL #153
+D16154	.FILL #154
+D16155	.FILL #155
+D16156	.FILL #156
+D16157	.FILL #157
+D16158	.FILL #158
+D16159	.FILL #159
+D16160	.FILL #160
+D16161	.FILL #161
+D16162	.FILL #162
+D16163	.FILL #163
+D16164	.FILL #164
+D16165	.FILL #165
+D16166	.FILL #166
+D16167	.FILL #167
+D16168	.FILL #168
+D16169	.FILL #169
+D16170	.FILL #170
+D16171	.FILL #171
+D16172	.FILL #172
+D16173	.FILL #173
+D16174	.FILL #174
+D16175	.FILL #175
+D16176	.FILL #176
+D16177	.FILL #177
+D16178	.FILL #178
+D16179	.FILL #179
+D16180	.FILL #180
+D16181	.FILL #181
+D16182	.FILL #182
+D16183	.FILL #183
+D16184	.FILL #184
+D16185	.FILL #185
+D16186	.FILL #186
+D16187	.FILL #187
+D16188	.FILL #188
+D16189	.FILL #189
+D16190	.FILL #190
+D16191	.FILL #191
+D16192	.FILL #192
+D16193	.FILL #193
+D16194	.FILL #194
+D16195	.FILL #195
+D16196	.FILL #196
+D16197	.FILL #197
+D16198	.FILL #198
+D16199	.FILL #199
+D16200	.FILL #200
+D16201	.FILL #201
+D16202	.FILL #202
+D16203	.FILL #203
+D16204	.FILL #204
+D16205	.FILL #205
+D16206	.FILL #206
+D16207	.FILL #207
+D16208	.FILL #208
+D16209	.FILL #209
+D16210	.FILL #210
+D16211	.FILL #211
+D16212	.FILL #212
+D16213	.FILL #213
+D16214	.FILL #214
+D16215	.FILL #215
+D16216	.FILL #216
+D16217	.FILL #217
+D16218	.FILL #218
+D16219	.FILL #219
+D16220	.FILL #220
+D16221	.FILL #221
+D16222	.FILL #222
+D16223	.FILL #223
+D16224	.FILL #224
+D16225	.FILL #225
+D16226	.FILL #226
+D16227	.FILL #227
+D16228	.FILL #228
+D16229	.FILL #229
+D16230	.FILL #230
+D16231	.FILL #231
+D16232	.FILL #232
+D16233	.FILL #233
+D16234	.FILL #234
+D16235	.FILL #235
+D16236	.FILL #236
+D16237	.FILL #237
+D16238	.FILL #238
+D16239	.FILL #239
+D16240	.FILL #240
+D16241	.FILL #241
+D16242	.FILL #242
+D16243	.FILL #243
+D16244	.FILL #244
+D16245	.FILL #245
+D16246	.FILL #246
+D16247	.FILL #247
+D16248	.FILL #248
+D16249	.FILL #249
+D16250	.FILL #250
+D16251	.FILL #251
+D16252	.FILL #252
+D16253	.FILL #253
+D16254	.FILL #254
+D16255	.FILL #255
+D16256	.FILL #256
+D16257	.FILL #257
+D16258	.FILL #258
+D16259	.FILL #259
+D16260	.FILL #260
+D16261	.FILL #261
+D16262	.FILL #262
+D16263	.FILL #263
+D16264	.FILL #264
+D16265	.FILL #265
+D16266	.FILL #266
+D16267	.FILL #267
+D16268	.FILL #268
+D16269	.FILL #269
+D16270	.FILL #270
+D16271	.FILL #271
+D16272	.FILL #272
+D16273	.FILL #273
+D16274	.FILL #274
+D16275	.FILL #275
+D16276	.FILL #276
+D16277	.FILL #277
+D16278	.FILL #278
+D16279	.FILL #279
+D16280	.FILL #280
+D16281	.FILL #281
+D16282	.FILL #282
+D16283	.FILL #283
+D16284	.FILL #284
+D16285	.FILL #285
+D16286	.FILL #286
+D16287	.FILL #287
+D16288	.FILL #288
+D16289	.FILL #289
+D16290	.FILL #290
+D16291	.FILL #291
+D16292	.FILL #292
+D16293	.FILL #293
+D16294	.FILL #294
+D16295	.FILL #295
+D16296	.FILL #296
+D16297	.FILL #297
+D16298	.FILL #298
+D16299	.FILL #299
+D16300	.FILL #300
+D16301	.FILL #301
+D16302	.FILL #302
+D16303	.FILL #303
+D16304	.FILL #304
+D16305	.FILL #305
+D16306	.FILL #306
+D16307	.FILL #307
+D16308	.FILL #308
+D16309	.FILL #309
+D16310	.FILL #310
+D16311	.FILL #311
+D16312	.FILL #312
+D16313	.FILL #313
+D16314	.FILL #314
+D16315	.FILL #315
+D16316	.FILL #316
+D16317	.FILL #317
+D16318	.FILL #318
+D16319	.FILL #319
+D16320	.FILL #320
+D16321	.FILL #321
+D16322	.FILL #322
+D16323	.FILL #323
+D16324	.FILL #324
+D16325	.FILL #325
+D16326	.FILL #326
+D16327	.FILL #327
+D16328	.FILL #328
+D16329	.FILL #329
+D16330	.FILL #330
+D16331	.FILL #331
+D16332	.FILL #332
+D16333	.FILL #333
+D16334	.FILL #334
+D16335	.FILL #335
+D16336	.FILL #336
+D16337	.FILL #337
+D16338	.FILL #338
+D16339	.FILL #339
+D16340	.FILL #340
+D16341	.FILL #341
+D16342	.FILL #342
+D16343	.FILL #343
+D16344	.FILL #344
+D16345	.FILL #345
+D16346	.FILL #346
+D16347	.FILL #347
+D16348	.FILL #348
+D16349	.FILL #349
+D16350	.FILL #350
+D16351	.FILL #351
+D16352	.FILL #352
+D16353	.FILL #353
+D16354	.FILL #354
+D16355	.FILL #355
+D16356	.FILL #356
+D16357	.FILL #357
+D16358	.FILL #358
+D16359	.FILL #359
+D16360	.FILL #360
+D16361	.FILL #361
+D16362	.FILL #362
+D16363	.FILL #363
+D16364	.FILL #364
+D16365	.FILL #365
+D16366	.FILL #366
+D16367	.FILL #367
+D16368	.FILL #368
+D16369	.FILL #369
+D16370	.FILL #370
+D16371	.FILL #371
+D16372	.FILL #372
+D16373	.FILL #373
+D16374	.FILL #374
+D16375	.FILL #375
+D16376	.FILL #376
+D16377	.FILL #377
+D16378	.FILL #378
+D16379	.FILL #379
+D16380	.FILL #380
+D16381	.FILL #381
+D16382	.FILL #382
+D16383	.FILL #383
+D16384	.FILL #384
+D16385	.FILL #385
+D16386	.FILL #386
+D16387	.FILL #387
+D16388	.FILL #388
+D16389	.FILL #389
+D16390	.FILL #390
+D16391	.FILL #391
+D16392	.FILL #392
+D16393	.FILL #393
+D16394	.FILL #394
+D16395	.FILL #395
+D16396	.FILL #396
+D16397	.FILL #397
+D16398	.FILL #398
+D16399	.FILL #399
+D16400	.FILL #400
+D16401	.FILL #401
+D16402	.FILL #402
+D16403	.FILL #403
+D16404	.FILL #404
+D16405	.FILL #405
+D16406	.FILL #406
+D16407	.FILL #407
+D16408	.FILL #408
+D16409	.FILL #409
+D16410	.FILL #410
+D16411	.FILL #411
+D16412	.FILL #412
+D16413	.FILL #413
+D16414	.FILL #414
+D16415	.FILL #415
+D16416	.FILL #416
+D16417	.FILL #417
+D16418	.FILL #418
+D16419	.FILL #419
+D16420	.FILL #420
+D16421	.FILL #421
+D16422	.FILL #422
+D16423	.FILL #423
+D16424	.FILL #424
+D16425	.FILL #425
+D16426	.FILL #426
+D16427	.FILL #427
+D16428	.FILL #428
+D16429	.FILL #429
+D16430	.FILL #430
+D16431	.FILL #431
+D16432	.FILL #432
+D16433	.FILL #433
+D16434	.FILL #434
+D16435	.FILL #435
+D16436	.FILL #436
+D16437	.FILL #437
+D16438	.FILL #438
+D16439	.FILL #439
+D16440	.FILL #440
+D16441	.FILL #441
+D16442	.FILL #442
+D16443	.FILL #443
+D16444	.FILL #444
+D16445	.FILL #445
+D16446	.FILL #446
+D16447	.FILL #447
+D16448	.FILL #448
+D16449	.FILL #449
+D16450	.FILL #450
+D16451	.FILL #451
+D16452	.FILL #452
+D16453	.FILL #453
+D16454	.FILL #454
+D16455	.FILL #455
+D16456	.FILL #456
+D16457	.FILL #457
+D16458	.FILL #458
+D16459	.FILL #459
+D16460	.FILL #460
+D16461	.FILL #461
+D16462	.FILL #462
+D16463	.FILL #463
+D16464	.FILL #464
+D16465	.FILL #465
+D16466	.FILL #466
+D16467	.FILL #467
+D16468	.FILL #468
+D16469	.FILL #469
+D16470	.FILL #470
+D16471	.FILL #471
+D16472	.FILL #472
+D16473	.FILL #473
+D16474	.FILL #474
+D16475	.FILL #475
+D16476	.FILL #476
+D16477	.FILL #477
+D16478	.FILL #478
+D16479	.FILL #479
+D16480	.FILL #480
+D16481	.FILL #481
+D16482	.FILL #482
+D16483	.FILL #483
+D16484	.FILL #484
+D16485	.FILL #485
+D16486	.FILL #486
+D16487	.FILL #487
+D16488	.FILL #488
+D16489	.FILL #489
+D16490	.FILL #490
+D16491	.FILL #491
+D16492	.FILL #492
+D16493	.FILL #493
+D16494	.FILL #494
+D16495	.FILL #495
+D16496	.FILL #496
+D16497	.FILL #497
+D16498	.FILL #498
+D16499	.FILL #499
+D16500	.FILL #500
+D16501	.FILL #501
+D16502	.FILL #502
+D16503	.FILL #503
+D16504	.FILL #504
+D16505	.FILL #505
+D16506	.FILL #506
+D16507	.FILL #507
+D16508	.FILL #508
+D16509	.FILL #509
+D16510	.FILL #510
+D16511	.FILL #511
+D16512	.FILL #512
+D16513	.FILL #513
+D16514	.FILL #514
+D16515	.FILL #515
+D16516	.FILL #516
+D16517	.FILL #517
+D16518	.FILL #518
+D16519	.FILL #519
+D16520	.FILL #520
+D16521	.FILL #521
+D16522	.FILL #522
+D16523	.FILL #523
+D16524	.FILL #524
+D16525	.FILL #525
+D16526	.FILL #526
+D16527	.FILL #527
+D16528	.FILL #528
+D16529	.FILL #529
+D16530	.FILL #530
+D16531	.FILL #531
+D16532	.FILL #532
+D16533	.FILL #533
+D16534	.FILL #534
+D16535	.FILL #535
+D16536	.FILL #536
+D16537	.FILL #537
+D16538	.FILL #538
+D16539	.FILL #539
+D16540	.FILL #540
+D16541	.FILL #541
+D16542	.FILL #542
+D16543	.FILL #543
+D16544	.FILL #544
+D16545	.FILL #545
+D16546	.FILL #546
+D16547	.FILL #547
+D16548	.FILL #548
+D16549	.FILL #549
+D16550	.FILL #550
+D16551	.FILL #551
+D16552	.FILL #552
+D16553	.FILL #553
+D16554	.FILL #554
+D16555	.FILL #555
+D16556	.FILL #556
+D16557	.FILL #557
+D16558	.FILL #558
+D16559	.FILL #559
+D16560	.FILL #560
+D16561	.FILL #561
+D16562	.FILL #562
+D16563	.FILL #563
+D16564	.FILL #564
+D16565	.FILL #565
+D16566	.FILL #566
+D16567	.FILL #567
+D16568	.FILL #568
+D16569	.FILL #569
+D16570	.FILL #570
+D16571	.FILL #571
+D16572	.FILL #572
+D16573	.FILL #573
+D16574	.FILL #574
+D16575	.FILL #575
+D16576	.FILL #576
+D16577	.FILL #577
+D16578	.FILL #578
+D16579	.FILL #579
+D16580	.FILL #580
+D16581	.FILL #581
+D16582	.FILL #582
+D16583	.FILL #583
+D16584	.FILL #584
+D16585	.FILL #585
+D16586	.FILL #586
+D16587	.FILL #587
+D16588	.FILL #588
+D16589	.FILL #589
+D16590	.FILL #590
+D16591	.FILL #591
+D16592	.FILL #592
+D16593	.FILL #593
+D16594	.FILL #594
+D16595	.FILL #595
+D16596	.FILL #596
+D16597	.FILL #597
+D16598	.FILL #598
+D16599	.FILL #599
+D16600	.FILL #600
+D16601	.FILL #601
+D16602	.FILL #602
+D16603	.FILL #603
+D16604	.FILL #604
+D16605	.FILL #605
+D16606	.FILL #606
+D16607	.FILL #607
+D16608	.FILL #608
+D16609	.FILL #609
+D16610	.FILL #610
+D16611	.FILL #611
+D16612	.FILL #612
+D16613	.FILL #613
+D16614	.FILL #614
+D16615	.FILL #615
+D16616	.FILL #616
+D16617	.FILL #617
+D16618	.FILL #618
+D16619	.FILL #619
+D16620	.FILL #620
+D16621	.FILL #621
+D16622	.FILL #622
+D16623	.FILL #623
+D16624	.FILL #624
+D16625	.FILL #625
+D16626	.FILL #626
+D16627	.FILL #627
+D16628	.FILL #628
+D16629	.FILL #629
+D16630	.FILL #630
+D16631	.FILL #631
+D16632	.FILL #632
+D16633	.FILL #633
+D16634	.FILL #634
+D16635	.FILL #635
+D16636	.FILL #636
+D16637	.FILL #637
+D16638	.FILL #638
+D16639	.FILL #639
+D16640	.FILL #640
+D16641	.FILL #641
+D16642	.FILL #642
+D16643	.FILL #643
+D16644	.FILL #644
+D16645	.FILL #645
+D16646	.FILL #646
+D16647	.FILL #647
+D16648	.FILL #648
+D16649	.FILL #649
+D16650	.FILL #650
+D16651	.FILL #651
+D16652	.FILL #652
+D16653	.FILL #653
+D16654	.FILL #654
+D16655	.FILL #655
+D16656	.FILL #656
+D16657	.FILL #657
+D16658	.FILL #658
+D16659	.FILL #659
+D16660	.FILL #660
+D16661	.FILL #661
+D16662	.FILL #662
+D16663	.FILL #663
+D16664	.FILL #664
+D16665	.FILL #665
+D16666	.FILL #666
+D16667	.FILL #667
+D16668	.FILL #668
+D16669	.FILL #669
+D16670	.FILL #670
+D16671	.FILL #671
+D16672	.FILL #672
+D16673	.FILL #673
+D16674	.FILL #674
+D16675	.FILL #675
+D16676	.FILL #676
+D16677	.FILL #677
+D16678	.FILL #678
+D16679	.FILL #679
+D16680	.FILL #680
+D16681	.FILL #681
+D16682	.FILL #682
+D16683	.FILL #683
+D16684	.FILL #684
+D16685	.FILL #685
+D16686	.FILL #686
+D16687	.FILL #687
+D16688	.FILL #688
+D16689	.FILL #689
+D16690	.FILL #690
+D16691	.FILL #691
+D16692	.FILL #692
+D16693	.FILL #693
+D16694	.FILL #694
+D16695	.FILL #695
+D16696	.FILL #696
+D16697	.FILL #697
+D16698	.FILL #698
+D16699	.FILL #699
+D16700	.FILL #700
+D16701	.FILL #701
+D16702	.FILL #702
+D16703	.FILL #703
+D16704	.FILL #704
+D16705	.FILL #705
+D16706	.FILL #706
+D16707	.FILL #707
+D16708	.FILL #708
+D16709	.FILL #709
+D16710	.FILL #710
+D16711	.FILL #711
+D16712	.FILL #712
+D16713	.FILL #713
+D16714	.FILL #714
+D16715	.FILL #715
+D16716	.FILL #716
+D16717	.FILL #717
+D16718	.FILL #718
+D16719	.FILL #719
+D16720	.FILL #720
+D16721	.FILL #721
+D16722	.FILL #722
+D16723	.FILL #723
+D16724	.FILL #724
+D16725	.FILL #725
+D16726	.FILL #726
+D16727	.FILL #727
+D16728	.FILL #728
+D16729	.FILL #729
+D16730	.FILL #730
+D16731	.FILL #731
+D16732	.FILL #732
+D16733	.FILL #733
+D16734	.FILL #734
+D16735	.FILL #735
+D16736	.FILL #736
+D16737	.FILL #737
+D16738	.FILL #738
+D16739	.FILL #739
+D16740	.FILL #740
+D16741	.FILL #741
+D16742	.FILL #742
+D16743	.FILL #743
+D16744	.FILL #744
+D16745	.FILL #745
+D16746	.FILL #746
+D16747	.FILL #747
+D16748	.FILL #748
+D16749	.FILL #749
+D16750	.FILL #750
+D16751	.FILL #751
+D16752	.FILL #752
+D16753	.FILL #753
+D16754	.FILL #754
+D16755	.FILL #755
+D16756	.FILL #756
+D16757	.FILL #757
+D16758	.FILL #758
+D16759	.FILL #759
+D16760	.FILL #760
+D16761	.FILL #761
+D16762	.FILL #762
+D16763	.FILL #763
+D16764	.FILL #764
+D16765	.FILL #765
+D16766	.FILL #766
+D16767	.FILL #767
+D16768	.FILL #768
+D16769	.FILL #769
+D16770	.FILL #770
+D16771	.FILL #771
+D16772	.FILL #772
+D16773	.FILL #773
+D16774	.FILL #774
+D16775	.FILL #775
+D16776	.FILL #776
+D16777	.FILL #777
+D16778	.FILL #778
+D16779	.FILL #779
+D16780	.FILL #780
+D16781	.FILL #781
+D16782	.FILL #782
+D16783	.FILL #783
+D16784	.FILL #784
+D16785	.FILL #785
+D16786	.FILL #786
+D16787	.FILL #787
+D16788	.FILL #788
+D16789	.FILL #789
+D16790	.FILL #790
+D16791	.FILL #791
+D16792	.FILL #792
+D16793	.FILL #793
+D16794	.FILL #794
+D16795	.FILL #795
+D16796	.FILL #796
+D16797	.FILL #797
+D16798	.FILL #798
+D16799	.FILL #799
+D16800	.FILL #800
+D16801	.FILL #801
+D16802	.FILL #802
+D16803	.FILL #803
+D16804	.FILL #804
+D16805	.FILL #805
+D16806	.FILL #806
+D16807	.FILL #807
+D16808	.FILL #808
+D16809	.FILL #809
+D16810	.FILL #810
+D16811	.FILL #811
+D16812	.FILL #812
+D16813	.FILL #813
+D16814	.FILL #814
+D16815	.FILL #815
+D16816	.FILL #816
+D16817	.FILL #817
+D16818	.FILL #818
+D16819	.FILL #819
+D16820	.FILL #820
+D16821	.FILL #821
+D16822	.FILL #822
+D16823	.FILL #823
+D16824	.FILL #824
+D16825	.FILL #825
+D16826	.FILL #826
+D16827	.FILL #827
+D16828	.FILL #828
+D16829	.FILL #829
+D16830	.FILL #830
+D16831	.FILL #831
+D16832	.FILL #832
+D16833	.FILL #833
+D16834	.FILL #834
+D16835	.FILL #835
+D16836	.FILL #836
+D16837	.FILL #837
+D16838	.FILL #838
+D16839	.FILL #839
+D16840	.FILL #840
+D16841	.FILL #841
+D16842	.FILL #842
+D16843	.FILL #843
+D16844	.FILL #844
+D16845	.FILL #845
+D16846	.FILL #846
+D16847	.FILL #847
+D16848	.FILL #848
+D16849	.FILL #849
+D16850	.FILL #850
+D16851	.FILL #851
+D16852	.FILL #852
+D16853	.FILL #853
+D16854	.FILL #854
+D16855	.FILL #855
+D16856	.FILL #856
+D16857	.FILL #857
+D16858	.FILL #858
+D16859	.FILL #859
+D16860	.FILL #860
+D16861	.FILL #861
+D16862	.FILL #862
+D16863	.FILL #863
+D16864	.FILL #864
+D16865	.FILL #865
+D16866	.FILL #866
+D16867	.FILL #867
+D16868	.FILL #868
+D16869	.FILL #869
+D16870	.FILL #870
+D16871	.FILL #871
+D16872	.FILL #872
+D16873	.FILL #873
+D16874	.FILL #874
+D16875	.FILL #875
+D16876	.FILL #876
+D16877	.FILL #877
+D16878	.FILL #878
+D16879	.FILL #879
+D16880	.FILL #880
+D16881	.FILL #881
+D16882	.FILL #882
+D16883	.FILL #883
+D16884	.FILL #884
+D16885	.FILL #885
+D16886	.FILL #886
+D16887	.FILL #887
+D16888	.FILL #888
+D16889	.FILL #889
+D16890	.FILL #890
+D16891	.FILL #891
+D16892	.FILL #892
+D16893	.FILL #893
+D16894	.FILL #894
+D16895	.FILL #895
+D16896	.FILL #896
+D16897	.FILL #897
+D16898	.FILL #898
+D16899	.FILL #899
+D16900	.FILL #900
+D16901	.FILL #901
+D16902	.FILL #902
+D16903	.FILL #903
+D16904	.FILL #904
+D16905	.FILL #905
+D16906	.FILL #906
+D16907	.FILL #907
+D16908	.FILL #908
+D16909	.FILL #909
+D16910	.FILL #910
+D16911	.FILL #911
+D16912	.FILL #912
+D16913	.FILL #913
+D16914	.FILL #914
+D16915	.FILL #915
+D16916	.FILL #916
+D16917	.FILL #917
+D16918	.FILL #918
+D16919	.FILL #919
+D16920	.FILL #920
+D16921	.FILL #921
+D16922	.FILL #922
+D16923	.FILL #923
+D16924	.FILL #924
+D16925	.FILL #925
+D16926	.FILL #926
+D16927	.FILL #927
+D16928	.FILL #928
+D16929	.FILL #929
+D16930	.FILL #930
+D16931	.FILL #931
+D16932	.FILL #932
+D16933	.FILL #933
+D16934	.FILL #934
+D16935	.FILL #935
+D16936	.FILL #936
+D16937	.FILL #937
+D16938	.FILL #938
+D16939	.FILL #939
+D16940	.FILL #940
+D16941	.FILL #941
+D16942	.FILL #942
+D16943	.FILL #943
+D16944	.FILL #944
+D16945	.FILL #945
+D16946	.FILL #946
+D16947	.FILL #947
+D16948	.FILL #948
+D16949	.FILL #949
+D16950	.FILL #950
+D16951	.FILL #951
+D16952	.FILL #952
+D16953	.FILL #953
+D16954	.FILL #954
+D16955	.FILL #955
+D16956	.FILL #956
+D16957	.FILL #957
+D16958	.FILL #958
+D16959	.FILL #959
+D16960	.FILL #960
+D16961	.FILL #961
+D16962	.FILL #962
+D16963	.FILL #963
+D16964	.FILL #964
+D16965	.FILL #965
+D16966	.FILL #966
+D16967	.FILL #967
+D16968	.FILL #968
+D16969	.FILL #969
+D16970	.FILL #970
+D16971	.FILL #971
+D16972	.FILL #972
+D16973	.FILL #973
+D16974	.FILL #974
+D16975	.FILL #975
+D16976	.FILL #976
+D16977	.FILL #977
+D16978	.FILL #978
+D16979	.FILL #979
+D16980	.FILL #980
+D16981	.FILL #981
+D16982	.FILL #982
+D16983	.FILL #983
+D16984	.FILL #984
+D16985	.FILL #985
+D16986	.FILL #986
+D16987	.FILL #987
+D16988	.FILL #988
+D16989	.FILL #989
+D16990	.FILL #990
+D16991	.FILL #991
+D16992	.FILL #992
+D16993	.FILL #993
+D16994	.FILL #994
+D16995	.FILL #995
+D16996	.FILL #996
+D16997	.FILL #997
+D16998	.FILL #998
+D16999	.FILL #999
+D17000	.FILL #0
+D17001	.FILL #1
+D17002	.FILL #2
+D17003	.FILL #3
+D17004	.FILL #4
+D17005	.FILL #5
+D17006	.FILL #6
+D17007	.FILL #7
+D17008	.FILL #8
+D17009	.FILL #9
+D17010	.FILL #10
+D17011	.FILL #11
+D17012	.FILL #12
+D17013	.FILL #13
+D17014	.FILL #14
+D17015	.FILL #15
+D17016	.FILL #16
+D17017	.FILL #17
+D17018	.FILL #18
+D17019	.FILL #19
+D17020	.FILL #20
+D17021	.FILL #21
+D17022	.FILL #22
+D17023	.FILL #23
+D17024	.FILL #24
+D17025	.FILL #25
+D17026	.FILL #26
+D17027	.FILL #27
+D17028	.FILL #28
+D17029	.FILL #29
+D17030	.FILL #30
+D17031	.FILL #31
+D17032	.FILL #32
+D17033	.FILL #33
+D17034	.FILL #34
+D17035	.FILL #35
+D17036	.FILL #36
+D17037	.FILL #37
+D17038	.FILL #38
+D17039	.FILL #39
+D17040	.FILL #40
+D17041	.FILL #41
+D17042	.FILL #42
+D17043	.FILL #43
+D17044	.FILL #44
+D17045	.FILL #45
+D17046	.FILL #46
+D17047	.FILL #47
+D17048	.FILL #48
+D17049	.FILL #49
+D17050	.FILL #50
+D17051	.FILL #51
+D17052	.FILL #52
+D17053	.FILL #53
+D17054	.FILL #54
+D17055	.FILL #55
+D17056	.FILL #56
+D17057	.FILL #57
+D17058	.FILL #58
+D17059	.FILL #59
+D17060	.FILL #60
+D17061	.FILL #61
+D17062	.FILL #62
+D17063	.FILL #63
+D17064	.FILL #64
+D17065	.FILL #65
+D17066	.FILL #66
+D17067	.FILL #67
+D17068	.FILL #68
+D17069	.FILL #69
+D17070	.FILL #70
+D17071	.FILL #71
+D17072	.FILL #72
+D17073	.FILL #73
+D17074	.FILL #74
+D17075	.FILL #75
+D17076	.FILL #76
+D17077	.FILL #77
+D17078	.FILL #78
+D17079	.FILL #79
+D17080	.FILL #80
+D17081	.FILL #81
+D17082	.FILL #82
+D17083	.FILL #83
+D17084	.FILL #84
+D17085	.FILL #85
+D17086	.FILL #86
+D17087	.FILL #87
+D17088	.FILL #88
+D17089	.FILL #89
+D17090	.FILL #90
+D17091	.FILL #91
+D17092	.FILL #92
+D17093	.FILL #93
+D17094	.FILL #94
+D17095	.FILL #95
+D17096	.FILL #96
+D17097	.FILL #97
+D17098	.FILL #98
+D17099	.FILL #99
+D17100	.FILL #100
+D17101	.FILL #101
+D17102	.FILL #102
+D17103	.FILL #103
+D17104	.FILL #104
+D17105	.FILL #105
+D17106	.FILL #106
+D17107	.FILL #107
+D17108	.FILL #108
+D17109	.FILL #109
+D17110	.FILL #110
+D17111	.FILL #111
+D17112	.FILL #112
+D17113	.FILL #113
+D17114	.FILL #114
+D17115	.FILL #115
+D17116	.FILL #116
+D17117	.FILL #117
+D17118	.FILL #118
+D17119	.FILL #119
+D17120	.FILL #120
+D17121	.FILL #121
+D17122	.FILL #122
+D17123	.FILL #123
+D17124	.FILL #124
+D17125	.FILL #125
+D17126	.FILL #126
+D17127	.FILL #127
+D17128	.FILL #128
+D17129	.FILL #129
+D17130	.FILL #130
+D17131	.FILL #131
+D17132	.FILL #132
+D17133	.FILL #133
+D17134	.FILL #134
+D17135	.FILL #135
+D17136	.FILL #136
+D17137	.FILL #137
+D17138	.FILL #138
+D17139	.FILL #139
+D17140	.FILL #140
+D17141	.FILL #141
+D17142	.FILL #142
+D17143	.FILL #143
+D17144	.FILL #144
+D17145	.FILL #145
+D17146	.FILL #146
+D17147	.FILL #147
+D17148	.FILL #148
+D17149	.FILL #149
+D17150	.FILL #150
+D17151	.FILL #151
+D17152	.FILL #152
+D17153	.FILL #153
+D17154	.FILL #154
+D17155	.FILL #155
+D17156	.FILL #156
+D17157	.FILL #157
+D17158	.FILL #158
+D17159	.FILL #159
+D17160	.FILL #160
+D17161	.FILL #161
+D17162	.FILL #162
+D17163	.FILL #163
+D17164	.FILL #164
+D17165	.FILL #165
+D17166	.FILL #166
+D17167	.FILL #167
+D17168	.FILL #168
+D17169	.FILL #169
+D17170	.FILL #170
+D17171	.FILL #171
+D17172	.FILL #172
+D17173	.FILL #173
+D17174	.FILL #174
+D17175	.FILL #175
+D17176	.FILL #176
+D17177	.FILL #177
+D17178	.FILL #178
+D17179	.FILL #179
+D17180	.FILL #180
+D17181	.FILL #181
+D17182	.FILL #182
+D17183	.FILL #183
+D17184	.FILL #184
+D17185	.FILL #185
+D17186	.FILL #186
+D17187	.FILL #187
+D17188	.FILL #188
+D17189	.FILL #189
+D17190	.FILL #190
+D17191	.FILL #191
+D17192	.FILL #192
+D17193	.FILL #193
+D17194	.FILL #194
+D17195	.FILL #195
+D17196	.FILL #196
+D17197	.FILL #197
+D17198	.FILL #198
+D17199	.FILL #199
+D17200	.FILL #200
+D17201	.FILL #201
+D17202	.FILL #202
+D17203	.FILL #203
+D17204	.FILL #204
+D17205	.FILL #205
+D17206	.FILL #206
+D17207	.FILL #207
+D17208	.FILL #208
+D17209	.FILL #209
+D17210	.FILL #210
+D17211	.FILL #211
+D17212	.FILL #212
+D17213	.FILL #213
+D17214	.FILL #214
+D17215	.FILL #215
+D17216	.FILL #216
+D17217	.FILL #217
+D17218	.FILL #218
+D17219	.FILL #219
+D17220	.FILL #220
+D17221	.FILL #221
+D17222	.FILL #222
+D17223	.FILL #223
+D17224	.FILL #224
+D17225	.FILL #225
+D17226	.FILL #226
+D17227	.FILL #227
+D17228	.FILL #228
+D17229	.FILL #229
+D17230	.FILL #230
+D17231	.FILL #231
+D17232	.FILL #232
+D17233	.FILL #233
+D17234	.FILL #234
+D17235	.FILL #235
+D17236	.FILL #236
+D17237	.FILL #237
+D17238	.FILL #238
+D17239	.FILL #239
+D17240	.FILL #240
+D17241	.FILL #241
+D17242	.FILL #242
+D17243	.FILL #243
+D17244	.FILL #244
+D17245	.FILL #245
+D17246	.FILL #246
+D17247	.FILL #247
+D17248	.FILL #248
+D17249	.FILL #249
+D17250	.FILL #250
+D17251	.FILL #251
+D17252	.FILL #252
+D17253	.FILL #253
+D17254	.FILL #254
+D17255	.FILL #255
+D17256	.FILL #256
+D17257	.FILL #257
+D17258	.FILL #258
+D17259	.FILL #259
+D17260	.FILL #260
+D17261	.FILL #261
+D17262	.FILL #262
+D17263	.FILL #263
+D17264	.FILL #264
+D17265	.FILL #265
+D17266	.FILL #266
+D17267	.FILL #267
+D17268	.FILL #268
+D17269	.FILL #269
+D17270	.FILL #270
+D17271	.FILL #271
+D17272	.FILL #272
+D17273	.FILL #273
+D17274	.FILL #274
+D17275	.FILL #275
+D17276	.FILL #276
+D17277	.FILL #277
+D17278	.FILL #278
+D17279	.FILL #279
+D17280	.FILL #280
+D17281	.FILL #281
+D17282	.FILL #282
+D17283	.FILL #283
+D17284	.FILL #284
+D17285	.FILL #285
+D17286	.FILL #286
+D17287	.FILL #287
+D17288	.FILL #288
+D17289	.FILL #289
+D17290	.FILL #290
+D17291	.FILL #291
+D17292	.FILL #292
+D17293	.FILL #293
+D17294	.FILL #294
+D17295	.FILL #295
+D17296	.FILL #296
+D17297	.FILL #297
+D17298	.FILL #298
+D17299	.FILL #299
+D17300	.FILL #300
+D17301	.FILL #301
+D17302	.FILL #302
+D17303	.FILL #303
+D17304	.FILL #304
+D17305	.FILL #305
+D17306	.FILL #306
+D17307	.FILL #307
+D17308	.FILL #308
+D17309	.FILL #309
+D17310	.FILL #310
+D17311	.FILL #311
+D17312	.FILL #312
+D17313	.FILL #313
+D17314	.FILL #314
+D17315	.FILL #315
+D17316	.FILL #316
+D17317	.FILL #317
+D17318	.FILL #318
+D17319	.FILL #319
+D17320	.FILL #320
+D17321	.FILL #321
+D17322	.FILL #322
+D17323	.FILL #323
+D17324	.FILL #324
+D17325	.FILL #325
+D17326	.FILL #326
+D17327	.FILL #327
+D17328	.FILL #328
+D17329	.FILL #329
+D17330	.FILL #330
+D17331	.FILL #331
+D17332	.FILL #332
+D17333	.FILL #333
+D17334	.FILL #334
+D17335	.FILL #335
+D17336	.FILL #336
+D17337	.FILL #337
+D17338	.FILL #338
+D17339	.FILL #339
+D17340	.FILL #340
+D17341	.FILL #341
+D17342	.FILL #342
+D17343	.FILL #343
+D17344	.FILL #344
+D17345	.FILL #345
+D17346	.FILL #346
+D17347	.FILL #347
+D17348	.FILL #348
+D17349	.FILL #349
+D17350	.FILL #350
+D17351	.FILL #351
+D17352	.FILL #352
+D17353	.FILL #353
+D17354	.FILL #354
+D17355	.FILL #355
+D17356	.FILL #356
+D17357	.FILL #357
+D17358	.FILL #358
+D17359	.FILL #359
+D17360	.FILL #360
+D17361	.FILL #361
+D17362	.FILL #362
+D17363	.FILL #363
+D17364	.FILL #364
+D17365	.FILL #365
+D17366	.FILL #366
+D17367	.FILL #367
+D17368	.FILL #368
+D17369	.FILL #369
+D17370	.FILL #370
+D17371	.FILL #371
+D17372	.FILL #372
+D17373	.FILL #373
+D17374	.FILL #374
+D17375	.FILL #375
+D17376	.FILL #376
+D17377	.FILL #377
+D17378	.FILL #378
+D17379	.FILL #379
+D17380	.FILL #380
+D17381	.FILL #381
+D17382	.FILL #382
+D17383	.FILL #383
+D17384	.FILL #384
+D17385	.FILL #385
+D17386	.FILL #386
+D17387	.FILL #387
+D17388	.FILL #388
+D17389	.FILL #389
+D17390	.FILL #390
+D17391	.FILL #391
+D17392	.FILL #392
+D17393	.FILL #393
+D17394	.FILL #394
+D17395	.FILL #395
+D17396	.FILL #396
+D17397	.FILL #397
+D17398	.FILL #398
+D17399	.FILL #399
+D17400	.FILL #400
+D17401	.FILL #401
+D17402	.FILL #402
+D17403	.FILL #403
+D17404	.FILL #404
+D17405	.FILL #405
+D17406	.FILL #406
+D17407	.FILL #407
+D17408	.FILL #408
+D17409	.FILL #409
+D17410	.FILL #410
+D17411	.FILL #411
+D17412	.FILL #412
+D17413	.FILL #413
+D17414	.FILL #414
+D17415	.FILL #415
+D17416	.FILL #416
+D17417	.FILL #417
+D17418	.FILL #418
+D17419	.FILL #419
+D17420	.FILL #420
+D17421	.FILL #421
+D17422	.FILL #422
+D17423	.FILL #423
+D17424	.FILL #424
+D17425	.FILL #425
+D17426	.FILL #426
+D17427	.FILL #427
+D17428	.FILL #428
+D17429	.FILL #429
+D17430	.FILL #430
+D17431	.FILL #431
+D17432	.FILL #432
+D17433	.FILL #433
+D17434	.FILL #434
+D17435	.FILL #435
+D17436	.FILL #436
+D17437	.FILL #437
+D17438	.FILL #438
+D17439	.FILL #439
+D17440	.FILL #440
+D17441	.FILL #441
+D17442	.FILL #442
+D17443	.FILL #443
+D17444	.FILL #444
+D17445	.FILL #445
+D17446	.FILL #446
+D17447	.FILL #447
+D17448	.FILL #448
+D17449	.FILL #449
+D17450	.FILL #450
+D17451	.FILL #451
+D17452	.FILL #452
+D17453	.FILL #453
+D17454	.FILL #454
+D17455	.FILL #455
+D17456	.FILL #456
+D17457	.FILL #457
+D17458	.FILL #458
+D17459	.FILL #459
+D17460	.FILL #460
+D17461	.FILL #461
+D17462	.FILL #462
+D17463	.FILL #463
+D17464	.FILL #464
+D17465	.FILL #465
+D17466	.FILL #466
+D17467	.FILL #467
+D17468	.FILL #468
+D17469	.FILL #469
+D17470	.FILL #470
+D17471	.FILL #471
+D17472	.FILL #472
+D17473	.FILL #473
+D17474	.FILL #474
+D17475	.FILL #475
+D17476	.FILL #476
+D17477	.FILL #477
+D17478	.FILL #478
+D17479	.FILL #479
+D17480	.FILL #480
+D17481	.FILL #481
+D17482	.FILL #482
+D17483	.FILL #483
+D17484	.FILL #484
+D17485	.FILL #485
+D17486	.FILL #486
+D17487	.FILL #487
+D17488	.FILL #488
+D17489	.FILL #489
+D17490	.FILL #490
+D17491	.FILL #491
+D17492	.FILL #492
+D17493	.FILL #493
+D17494	.FILL #494
+D17495	.FILL #495
+D17496	.FILL #496
+D17497	.FILL #497
+D17498	.FILL #498
+D17499	.FILL #499
+D17500	.FILL #500
+D17501	.FILL #501
+D17502	.FILL #502
+D17503	.FILL #503
+D17504	.FILL #504
+D17505	.FILL #505
+D17506	.FILL #506
+D17507	.FILL #507
+D17508	.FILL #508
+D17509	.FILL #509
+D17510	.FILL #510
+D17511	.FILL #511
+D17512	.FILL #512
+D17513	.FILL #513
+D17514	.FILL #514
+D17515	.FILL #515
+D17516	.FILL #516
+D17517	.FILL #517
+D17518	.FILL #518
+D17519	.FILL #519
+D17520	.FILL #520
+D17521	.FILL #521
+D17522	.FILL #522
+D17523	.FILL #523
+D17524	.FILL #524
+D17525	.FILL #525
+D17526	.FILL #526
+D17527	.FILL #527
+D17528	.FILL #528
+D17529	.FILL #529
+D17530	.FILL #530
+D17531	.FILL #531
+D17532	.FILL #532
+D17533	.FILL #533
+D17534	.FILL #534
+D17535	.FILL #535
+D17536	.FILL #536
+D17537	.FILL #537
+D17538	.FILL #538
+D17539	.FILL #539
+D17540	.FILL #540
+D17541	.FILL #541
+D17542	.FILL #542
+D17543	.FILL #543
+D17544	.FILL #544
+D17545	.FILL #545
+D17546	.FILL #546
+D17547	.FILL #547
+D17548	.FILL #548
+D17549	.FILL #549
+D17550	.FILL #550
+D17551	.FILL #551
+D17552	.FILL #552
+D17553	.FILL #553
+D17554	.FILL #554
+D17555	.FILL #555
+D17556	.FILL #556
+D17557	.FILL #557
+D17558	.FILL #558
+D17559	.FILL #559
+D17560	.FILL #560
+D17561	.FILL #561
+D17562	.FILL #562
+D17563	.FILL #563
+D17564	.FILL #564
+D17565	.FILL #565
+D17566	.FILL #566
+D17567	.FILL #567
+D17568	.FILL #568
+D17569	.FILL #569
+D17570	.FILL #570
+D17571	.FILL #571
+D17572	.FILL #572
+D17573	.FILL #573
+D17574	.FILL #574
+D17575	.FILL #575
+D17576	.FILL #576
+D17577	.FILL #577
+D17578	.FILL #578
+D17579	.FILL #579
+D17580	.FILL #580
+D17581	.FILL #581
+D17582	.FILL #582
+D17583	.FILL #583
+D17584	.FILL #584
+D17585	.FILL #585
+D17586	.FILL #586
+D17587	.FILL #587
+D17588	.FILL #588
+D17589	.FILL #589
+D17590	.FILL #590
+D17591	.FILL #591
+D17592	.FILL #592
+D17593	.FILL #593
+D17594	.FILL #594
+D17595	.FILL #595
+D17596	.FILL #596
+D17597	.FILL #597
+D17598	.FILL #598
+D17599	.FILL #599
+D17600	.FILL #600
+D17601	.FILL #601
+D17602	.FILL #602
+D17603	.FILL #603
+D17604	.FILL #604
+D17605	.FILL #605
+D17606	.FILL #606
+D17607	.FILL #607
+D17608	.FILL #608
+D17609	.FILL #609
+D17610	.FILL #610
+D17611	.FILL #611
+D17612	.FILL #612
+D17613	.FILL #613
+D17614	.FILL #614
+D17615	.FILL #615
+D17616	.FILL #616
+D17617	.FILL #617
+D17618	.FILL #618
+D17619	.FILL #619
+D17620	.FILL #620
+D17621	.FILL #621
+D17622	.FILL #622
+D17623	.FILL #623
+D17624	.FILL #624
+D17625	.FILL #625
+D17626	.FILL #626
+D17627	.FILL #627
+D17628	.FILL #628
+D17629	.FILL #629
+D17630	.FILL #630
+D17631	.FILL #631
+D17632	.FILL #632
+D17633	.FILL #633
+D17634	.FILL #634
+D17635	.FILL #635
+D17636	.FILL #636
+D17637	.FILL #637
+D17638	.FILL #638
+D17639	.FILL #639
+D17640	.FILL #640
+D17641	.FILL #641
+D17642	.FILL #642
+D17643	.FILL #643
+D17644	.FILL #644
+D17645	.FILL #645
+D17646	.FILL #646
+D17647	.FILL #647
+D17648	.FILL #648
+D17649	.FILL #649
+D17650	.FILL #650
+D17651	.FILL #651
+D17652	.FILL #652
+D17653	.FILL #653
+D17654	.FILL #654
+D17655	.FILL #655
+D17656	.FILL #656
+D17657	.FILL #657
+D17658	.FILL #658
+D17659	.FILL #659
+D17660	.FILL #660
+D17661	.FILL #661
+D17662	.FILL #662
+D17663	.FILL #663
+D17664	.FILL #664
+D17665	.FILL #665
+D17666	.FILL #666
+D17667	.FILL #667
+D17668	.FILL #668
+D17669	.FILL #669
+D17670	.FILL #670
+D17671	.FILL #671
+D17672	.FILL #672
+D17673	.FILL #673
+D17674	.FILL #674
+D17675	.FILL #675
+D17676	.FILL #676
+D17677	.FILL #677
+D17678	.FILL #678
+D17679	.FILL #679
+D17680	.FILL #680
+D17681	.FILL #681
+D17682	.FILL #682
+D17683	.FILL #683
+D17684	.FILL #684
+D17685	.FILL #685
+D17686	.FILL #686
+D17687	.FILL #687
+D17688	.FILL #688
+D17689	.FILL #689
+D17690	.FILL #690
+D17691	.FILL #691
+D17692	.FILL #692
+D17693	.FILL #693
+D17694	.FILL #694
+D17695	.FILL #695
+D17696	.FILL #696
+D17697	.FILL #697
+D17698	.FILL #698
+D17699	.FILL #699
+D17700	.FILL #700
+D17701	.FILL #701
+D17702	.FILL #702
+D17703	.FILL #703
+D17704	.FILL #704
+D17705	.FILL #705
+D17706	.FILL #706
+D17707	.FILL #707
+D17708	.FILL #708
+D17709	.FILL #709
+D17710	.FILL #710
+D17711	.FILL #711
+D17712	.FILL #712
+D17713	.FILL #713
+D17714	.FILL #714
+D17715	.FILL #715
+D17716	.FILL #716
+D17717	.FILL #717
+D17718	.FILL #718
+D17719	.FILL #719
+D17720	.FILL #720
+D17721	.FILL #721
+D17722	.FILL #722
+D17723	.FILL #723
+D17724	.FILL #724
+D17725	.FILL #725
+D17726	.FILL #726
+D17727	.FILL #727
+D17728	.FILL #728
+D17729	.FILL #729
+D17730	.FILL #730
+D17731	.FILL #731
+D17732	.FILL #732
+D17733	.FILL #733
+D17734	.FILL #734
+D17735	.FILL #735
+D17736	.FILL #736
+D17737	.FILL #737
+D17738	.FILL #738
+D17739	.FILL #739
+D17740	.FILL #740
+D17741	.FILL #741
+D17742	.FILL #742
+D17743	.FILL #743
+D17744	.FILL #744
+D17745	.FILL #745
+D17746	.FILL #746
+D17747	.FILL #747
+D17748	.FILL #748
+D17749	.FILL #749
+D17750	.FILL #750
+D17751	.FILL #751
+D17752	.FILL #752
+D17753	.FILL #753
+D17754	.FILL #754
+D17755	.FILL #755
+D17756	.FILL #756
+D17757	.FILL #757
+D17758	.FILL #758
+D17759	.FILL #759
+D17760	.FILL #760
+D17761	.FILL #761
+D17762	.FILL #762
+D17763	.FILL #763
+D17764	.FILL #764
+D17765	.FILL #765
+D17766	.FILL #766
+D17767	.FILL #767
+D17768	.FILL #768
+D17769	.FILL #769
+D17770	.FILL #770
+D17771	.FILL #771
+D17772	.FILL #772
+D17773	.FILL #773
+D17774	.FILL #774
+D17775	.FILL #775
+D17776	.FILL #776
+D17777	.FILL #777
+D17778	.FILL #778
+D17779	.FILL #779
+D17780	.FILL #780
+D17781	.FILL #781
+D17782	.FILL #782
+D17783	.FILL #783
+D17784	.FILL #784
+D17785	.FILL #785
+D17786	.FILL #786
+D17787	.FILL #787
+D17788	.FILL #788
+D17789	.FILL #789
+D17790	.FILL #790
+D17791	.FILL #791
+D17792	.FILL #792
+D17793	.FILL #793
+D17794	.FILL #794
+D17795	.FILL #795
+D17796	.FILL #796
+D17797	.FILL #797
+D17798	.FILL #798
+D17799	.FILL #799
+D17800	.FILL #800
+D17801	.FILL #801
+D17802	.FILL #802
+D17803	.FILL #803
+D17804	.FILL #804
+D17805	.FILL #805
+D17806	.FILL #806
+D17807	.FILL #807
+D17808	.FILL #808
+D17809	.FILL #809
+D17810	.FILL #810
+D17811	.FILL #811
+D17812	.FILL #812
+D17813	.FILL #813
+D17814	.FILL #814
+D17815	.FILL #815
+D17816	.FILL #816
+D17817	.FILL #817
+D17818	.FILL #818
+D17819	.FILL #819
+D17820	.FILL #820
+D17821	.FILL #821
+D17822	.FILL #822
+D17823	.FILL #823
+D17824	.FILL #824
+D17825	.FILL #825
+D17826	.FILL #826
+D17827	.FILL #827
+D17828	.FILL #828
+D17829	.FILL #829
+D17830	.FILL #830
+D17831	.FILL #831
+D17832	.FILL #832
+D17833	.FILL #833
+D17834	.FILL #834
+D17835	.FILL #835
+D17836	.FILL #836
+D17837	.FILL #837
+D17838	.FILL #838
+D17839	.FILL #839
+D17840	.FILL #840
+D17841	.FILL #841
+D17842	.FILL #842
+D17843	.FILL #843
+D17844	.FILL #844
+D17845	.FILL #845
+D17846	.FILL #846
+D17847	.FILL #847
+D17848	.FILL #848
+D17849	.FILL #849
+D17850	.FILL #850
+D17851	.FILL #851
+D17852	.FILL #852
+D17853	.FILL #853
+D17854	.FILL #854
+D17855	.FILL #855
+D17856	.FILL #856
+D17857	.FILL #857
+D17858	.FILL #858
+D17859	.FILL #859
+D17860	.FILL #860
+D17861	.FILL #861
+D17862	.FILL #862
+D17863	.FILL #863
+D17864	.FILL #864
+D17865	.FILL #865
+D17866	.FILL #866
+D17867	.FILL #867
+D17868	.FILL #868
+D17869	.FILL #869
+D17870	.FILL #870
+D17871	.FILL #871
+D17872	.FILL #872
+D17873	.FILL #873
+D17874	.FILL #874
+D17875	.FILL #875
+D17876	.FILL #876
+D17877	.FILL #877
+D17878	.FILL #878
+D17879	.FILL #879
+D17880	.FILL #880
+D17881	.FILL #881
+D17882	.FILL #882
+D17883	.FILL #883
+D17884	.FILL #884
+D17885	.FILL #885
+D17886	.FILL #886
+D17887	.FILL #887
+D17888	.FILL #888
+D17889	.FILL #889
+D17890	.FILL #890
+D17891	.FILL #891
+D17892	.FILL #892
+D17893	.FILL #893
+D17894	.FILL #894
+D17895	.FILL #895
+D17896	.FILL #896
+D17897	.FILL #897
+D17898	.FILL #898
+D17899	.FILL #899
+D17900	.FILL #900
+D17901	.FILL #901
+D17902	.FILL #902
+D17903	.FILL #903
+D17904	.FILL #904
+D17905	.FILL #905
+D17906	.FILL #906
+D17907	.FILL #907
+D17908	.FILL #908
+D17909	.FILL #909
+D17910	.FILL #910
+D17911	.FILL #911
+D17912	.FILL #912
+D17913	.FILL #913
+D17914	.FILL #914
+D17915	.FILL #915
+D17916	.FILL #916
+D17917	.FILL #917
+D17918	.FILL #918
+D17919	.FILL #919
+D17920	.FILL #920
+D17921	.FILL #921
+D17922	.FILL #922
+D17923	.FILL #923
+D17924	.FILL #924
+D17925	.FILL #925
+D17926	.FILL #926
+D17927	.FILL #927
+D17928	.FILL #928
+D17929	.FILL #929
+D17930	.FILL #930
+D17931	.FILL #931
+D17932	.FILL #932
+D17933	.FILL #933
+D17934	.FILL #934
+D17935	.FILL #935
+D17936	.FILL #936
+D17937	.FILL #937
+D17938	.FILL #938
+D17939	.FILL #939
+D17940	.FILL #940
+D17941	.FILL #941
+D17942	.FILL #942
+D17943	.FILL #943
+D17944	.FILL #944
+D17945	.FILL #945
+D17946	.FILL #946
+D17947	.FILL #947
+D17948	.FILL #948
+D17949	.FILL #949
+D17950	.FILL #950
+D17951	.FILL #951
+D17952	.FILL #952
+D17953	.FILL #953
+D17954	.FILL #954
+D17955	.FILL #955
+D17956	.FILL #956
+D17957	.FILL #957
+D17958	.FILL #958
+D17959	.FILL #959
+D17960	.FILL #960
+D17961	.FILL #961
+D17962	.FILL #962
+D17963	.FILL #963
+D17964	.FILL #964
+D17965	.FILL #965
+D17966	.FILL #966
+D17967	.FILL #967
+D17968	.FILL #968
+D17969	.FILL #969
+D17970	.FILL #970
+D17971	.FILL #971
+D17972	.FILL #972
+D17973	.FILL #973
+D17974	.FILL #974
+D17975	.FILL #975
+D17976	.FILL #976
+D17977	.FILL #977
+D17978	.FILL #978
+D17979	.FILL #979
+D17980	.FILL #980
+D17981	.FILL #981
+D17982	.FILL #982
+D17983	.FILL #983
+D17984	.FILL #984
+D17985	.FILL #985
+D17986	.FILL #986
+D17987	.FILL #987
+D17988	.FILL #988
+D17989	.FILL #989
+D17990	.FILL #990
+D17991	.FILL #991
+D17992	.FILL #992
+D17993	.FILL #993
+D17994	.FILL #994
+D17995	.FILL #995
+D17996	.FILL #996
+D17997	.FILL #997
+D17998	.FILL #998
+D17999	.FILL #999
+D18000	.FILL #0
+D18001	.FILL #1
+D18002	.FILL #2
+D18003	.FILL #3
+D18004	.FILL #4
+D18005	.FILL #5
+D18006	.FILL #6
+D18007	.FILL #7
+D18008	.FILL #8
+D18009	.FILL #9
+D18010	.FILL #10
+D18011	.FILL #11
+D18012	.FILL #12
+D18013	.FILL #13
+D18014	.FILL #14
+D18015	.FILL #15
+D18016	.FILL #16
+D18017	.FILL #17
+D18018	.FILL #18
+D18019	.FILL #19
+D18020	.FILL #20
+D18021	.FILL #21
+D18022	.FILL #22
+D18023	.FILL #23
+D18024	.FILL #24
+D18025	.FILL #25
+D18026	.FILL #26
+D18027	.FILL #27
+D18028	.FILL #28
+D18029	.FILL #29
+D18030	.FILL #30
+D18031	.FILL #31
+D18032	.FILL #32
+D18033	.FILL #33
+D18034	.FILL #34
+D18035	.FILL #35
+D18036	.FILL #36
+D18037	.FILL #37
+D18038	.FILL #38
+D18039	.FILL #39
+D18040	.FILL #40
+D18041	.FILL #41
+D18042	.FILL #42
+D18043	.FILL #43
+D18044	.FILL #44
+D18045	.FILL #45
+D18046	.FILL #46
+D18047	.FILL #47
+D18048	.FILL #48
+D18049	.FILL #49
+D18050	.FILL #50
+D18051	.FILL #51
+D18052	.FILL #52
+D18053	.FILL #53
+D18054	.FILL #54
+D18055	.FILL #55
+D18056	.FILL #56
+D18057	.FILL #57
+D18058	.FILL #58
+D18059	.FILL #59
+D18060	.FILL #60
+D18061	.FILL #61
+D18062	.FILL #62
+D18063	.FILL #63
+D18064	.FILL #64
+D18065	.FILL #65
+D18066	.FILL #66
+D18067	.FILL #67
+D18068	.FILL #68
+D18069	.FILL #69
+D18070	.FILL #70
+D18071	.FILL #71
+D18072	.FILL #72
+D18073	.FILL #73
+D18074	.FILL #74
+D18075	.FILL #75
+D18076	.FILL #76
+D18077	.FILL #77
+D18078	.FILL #78
+D18079	.FILL #79
+D18080	.FILL #80
+D18081	.FILL #81
+D18082	.FILL #82
+D18083	.FILL #83
+D18084	.FILL #84
+D18085	.FILL #85
+D18086	.FILL #86
+D18087	.FILL #87
+D18088	.FILL #88
+D18089	.FILL #89
+D18090	.FILL #90
+D18091	.FILL #91
+D18092	.FILL #92
+D18093	.FILL #93
+D18094	.FILL #94
+D18095	.FILL #95
+D18096	.FILL #96
+D18097	.FILL #97
+D18098	.FILL #98
+D18099	.FILL #99
+D18100	.FILL #100
+D18101	.FILL #101
+D18102	.FILL #102
+D18103	.FILL #103
+D18104	.FILL #104
+D18105	.FILL #105
+D18106	.FILL #106
+D18107	.FILL #107
+D18108	.FILL #108
+D18109	.FILL #109
+D18110	.FILL #110
+D18111	.FILL #111
+D18112	.FILL #112
+D18113	.FILL #113
+D18114	.FILL #114
+D18115	.FILL #115
+D18116	.FILL #116
+D18117	.FILL #117
+D18118	.FILL #118
+D18119	.FILL #119
+D18120	.FILL #120
+D18121	.FILL #121
+D18122	.FILL #122
+D18123	.FILL #123
+D18124	.FILL #124
+D18125	.FILL #125
+D18126	.FILL #126
+D18127	.FILL #127
+D18128	.FILL #128
+D18129	.FILL #129
+D18130	.FILL #130
+D18131	.FILL #131
+D18132	.FILL #132
+D18133	.FILL #133
+D18134	.FILL #134
+D18135	.FILL #135
+D18136	.FILL #136
+D18137	.FILL #137
+D18138	.FILL #138
+D18139	.FILL #139
+D18140	.FILL #140
+D18141	.FILL #141
+D18142	.FILL #142
+D18143	.FILL #143
+D18144	.FILL #144
+D18145	.FILL #145
+D18146	.FILL #146
+D18147	.FILL #147
+D18148	.FILL #148
+D18149	.FILL #149
+D18150	.FILL #150
+D18151	.FILL #151
+D18152	.FILL #152
+D18153	.FILL #153
+D18154	.FILL #154
+D18155	.FILL #155
+D18156	.FILL #156
+D18157	.FILL #157
+D18158	.FILL #158
+D18159	.FILL #159
+D18160	.FILL #160
+D18161	.FILL #161
+D18162	.FILL #162
+D18163	.FILL #163
+D18164	.FILL #164
+D18165	.FILL #165
+D18166	.FILL #166
+D18167	.FILL #167
+D18168	.FILL #168
+D18169	.FILL #169
+D18170	.FILL #170
+D18171	.FILL #171
+D18172	.FILL #172
+D18173	.FILL #173
+D18174	.FILL #174
+D18175	.FILL #175
+D18176	.FILL #176
+D18177	.FILL #177
+D18178	.FILL #178
+D18179	.FILL #179
+D18180	.FILL #180
+D18181	.FILL #181
+D18182	.FILL #182
+D18183	.FILL #183
+D18184	.FILL #184
+D18185	.FILL #185
+D18186	.FILL #186
+D18187	.FILL #187
+D18188	.FILL #188
+D18189	.FILL #189
+D18190	.FILL #190
+D18191	.FILL #191
+D18192	.FILL #192
+D18193	.FILL #193
+D18194	.FILL #194
+D18195	.FILL #195
+D18196	.FILL #196
+D18197	.FILL #197
+D18198	.FILL #198
+D18199	.FILL #199
+D18200	.FILL #200
+D18201	.FILL #201
+D18202	.FILL #202
+D18203	.FILL #203
+D18204	.FILL #204
+D18205	.FILL #205
+D18206	.FILL #206
+D18207	.FILL #207
+D18208	.FILL #208
+D18209	.FILL #209
+D18210	.FILL #210
+D18211	.FILL #211
+D18212	.FILL #212
+D18213	.FILL #213
+D18214	.FILL #214
+D18215	.FILL #215
+D18216	.FILL #216
+D18217	.FILL #217
+D18218	.FILL #218
+D18219	.FILL #219
+D18220	.FILL #220
+D18221	.FILL #221
+D18222	.FILL #222
+D18223	.FILL #223
+D18224	.FILL #224
+D18225	.FILL #225
+D18226	.FILL #226
+D18227	.FILL #227
+D18228	.FILL #228
+D18229	.FILL #229
+D18230	.FILL #230
+D18231	.FILL #231
+D18232	.FILL #232
+D18233	.FILL #233
+D18234	.FILL #234
+D18235	.FILL #235
+D18236	.FILL #236
+D18237	.FILL #237
+D18238	.FILL #238
+D18239	.FILL #239
+D18240	.FILL #240
+D18241	.FILL #241
+D18242	.FILL #242
+D18243	.FILL #243
+D18244	.FILL #244
+D18245	.FILL #245
+D18246	.FILL #246
+D18247	.FILL #247
+D18248	.FILL #248
+D18249	.FILL #249
+D18250	.FILL #250
+D18251	.FILL #251
+D18252	.FILL #252
+D18253	.FILL #253
+D18254	.FILL #254
+D18255	.FILL #255
+D18256	.FILL #256
+D18257	.FILL #257
+D18258	.FILL #258
+D18259	.FILL #259
+D18260	.FILL #260
+D18261	.FILL #261
+D18262	.FILL #262
+D18263	.FILL #263
+D18264	.FILL #264
+D18265	.FILL #265
+D18266	.FILL #266
+D18267	.FILL #267
+D18268	.FILL #268
+D18269	.FILL #269
+D18270	.FILL #270
+D18271	.FILL #271
+D18272	.FILL #272
+D18273	.FILL #273
+D18274	.FILL #274
+D18275	.FILL #275
+D18276	.FILL #276
+D18277	.FILL #277
+D18278	.FILL #278
+D18279	.FILL #279
+D18280	.FILL #280
+D18281	.FILL #281
+D18282	.FILL #282
+D18283	.FILL #283
+D18284	.FILL #284
+D18285	.FILL #285
+D18286	.FILL #286
+D18287	.FILL #287
+D18288	.FILL #288
+D18289	.FILL #289
+D18290	.FILL #290
+D18291	.FILL #291
+D18292	.FILL #292
+D18293	.FILL #293
+D18294	.FILL #294
+D18295	.FILL #295
+D18296	.FILL #296
+D18297	.FILL #297
+D18298	.FILL #298
+D18299	.FILL #299
+D18300	.FILL #300
+D18301	.FILL #301
+D18302	.FILL #302
+D18303	.FILL #303
+D18304	.FILL #304
+D18305	.FILL #305
+D18306	.FILL #306
+D18307	.FILL #307
+D18308	.FILL #308
+D18309	.FILL #309
+D18310	.FILL #310
+D18311	.FILL #311
+D18312	.FILL #312
+D18313	.FILL #313
+D18314	.FILL #314
+D18315	.FILL #315
+D18316	.FILL #316
+D18317	.FILL #317
+D18318	.FILL #318
+D18319	.FILL #319
+D18320	.FILL #320
+D18321	.FILL #321
+D18322	.FILL #322
+D18323	.FILL #323
+D18324	.FILL #324
+D18325	.FILL #325
+D18326	.FILL #326
+D18327	.FILL #327
+D18328	.FILL #328
+D18329	.FILL #329
+D18330	.FILL #330
+D18331	.FILL #331
+D18332	.FILL #332
+D18333	.FILL #333
+D18334	.FILL #334
+D18335	.FILL #335
+D18336	.FILL #336
+D18337	.FILL #337
+D18338	.FILL #338
+D18339	.FILL #339
+D18340	.FILL #340
+D18341	.FILL #341
+D18342	.FILL #342
+D18343	.FILL #343
+D18344	.FILL #344
+D18345	.FILL #345
+D18346	.FILL #346
+D18347	.FILL #347
+D18348	.FILL #348
+D18349	.FILL #349
+D18350	.FILL #350
+D18351	.FILL #351
+D18352	.FILL #352
+D18353	.FILL #353
+D18354	.FILL #354
+D18355	.FILL #355
+D18356	.FILL #356
+D18357	.FILL #357
+D18358	.FILL #358
+D18359	.FILL #359
+D18360	.FILL #360
+D18361	.FILL #361
+D18362	.FILL #362
+D18363	.FILL #363
+D18364	.FILL #364
+D18365	.FILL #365
+D18366	.FILL #366
+D18367	.FILL #367
+D18368	.FILL #368
+D18369	.FILL #369
+D18370	.FILL #370
+D18371	.FILL #371
+D18372	.FILL #372
+D18373	.FILL #373
+D18374	.FILL #374
+D18375	.FILL #375
+D18376	.FILL #376
+D18377	.FILL #377
+D18378	.FILL #378
+D18379	.FILL #379
+D18380	.FILL #380
+D18381	.FILL #381
+D18382	.FILL #382
+D18383	.FILL #383
+D18384	.FILL #384
+D18385	.FILL #385
+D18386	.FILL #386
+D18387	.FILL #387
+D18388	.FILL #388
+D18389	.FILL #389
+D18390	.FILL #390
+D18391	.FILL #391
+D18392	.FILL #392
+D18393	.FILL #393
+D18394	.FILL #394
+D18395	.FILL #395
+D18396	.FILL #396
+D18397	.FILL #397
+D18398	.FILL #398
+D18399	.FILL #399
+D18400	.FILL #400
+D18401	.FILL #401
+D18402	.FILL #402
+D18403	.FILL #403
+D18404	.FILL #404
+D18405	.FILL #405
+D18406	.FILL #406
+D18407	.FILL #407
+D18408	.FILL #408
+D18409	.FILL #409
+D18410	.FILL #410
+D18411	.FILL #411
+D18412	.FILL #412
+D18413	.FILL #413
+D18414	.FILL #414
+D18415	.FILL #415
+D18416	.FILL #416
+D18417	.FILL #417
+D18418	.FILL #418
+D18419	.FILL #419
+D18420	.FILL #420
+D18421	.FILL #421
+D18422	.FILL #422
+D18423	.FILL #423
+D18424	.FILL #424
+D18425	.FILL #425
+D18426	.FILL #426
+D18427	.FILL #427
+D18428	.FILL #428
+D18429	.FILL #429
+D18430	.FILL #430
+D18431	.FILL #431
+D18432	.FILL #432
+D18433	.FILL #433
+D18434	.FILL #434
+D18435	.FILL #435
+D18436	.FILL #436
+D18437	.FILL #437
+D18438	.FILL #438
+D18439	.FILL #439
+D18440	.FILL #440
+D18441	.FILL #441
+D18442	.FILL #442
+D18443	.FILL #443
+D18444	.FILL #444
+D18445	.FILL #445
+D18446	.FILL #446
+D18447	.FILL #447
+D18448	.FILL #448
+D18449	.FILL #449
+D18450	.FILL #450
+D18451	.FILL #451
+D18452	.FILL #452
+D18453	.FILL #453
+D18454	.FILL #454
+D18455	.FILL #455
+D18456	.FILL #456
+D18457	.FILL #457
+D18458	.FILL #458
+D18459	.FILL #459
+D18460	.FILL #460
+D18461	.FILL #461
+D18462	.FILL #462
+D18463	.FILL #463
+D18464	.FILL #464
+D18465	.FILL #465
+D18466	.FILL #466
+D18467	.FILL #467
+D18468	.FILL #468
+D18469	.FILL #469
+D18470	.FILL #470
+D18471	.FILL #471
+D18472	.FILL #472
+D18473	.FILL #473
+D18474	.FILL #474
+D18475	.FILL #475
+D18476	.FILL #476
+D18477	.FILL #477
+D18478	.FILL #478
+D18479	.FILL #479
+D18480	.FILL #480
+D18481	.FILL #481
+D18482	.FILL #482
+D18483	.FILL #483
+D18484	.FILL #484
+D18485	.FILL #485
+D18486	.FILL #486
+D18487	.FILL #487
+D18488	.FILL #488
+D18489	.FILL #489
+D18490	.FILL #490
+D18491	.FILL #491
+D18492	.FILL #492
+D18493	.FILL #493
+D18494	.FILL #494
+D18495	.FILL #495
+D18496	.FILL #496
+D18497	.FILL #497
+D18498	.FILL #498
+D18499	.FILL #499
+D18500	.FILL #500
+D18501	.FILL #501
+D18502	.FILL #502
+D18503	.FILL #503
+D18504	.FILL #504
+D18505	.FILL #505
+D18506	.FILL #506
+D18507	.FILL #507
+D18508	.FILL #508
+D18509	.FILL #509
+D18510	.FILL #510
+D18511	.FILL #511
+D18512	.FILL #512
+D18513	.FILL #513
+D18514	.FILL #514
+D18515	.FILL #515
+D18516	.FILL #516
+D18517	.FILL #517
+D18518	.FILL #518
+D18519	.FILL #519
+D18520	.FILL #520
+D18521	.FILL #521
+D18522	.FILL #522
+D18523	.FILL #523
+D18524	.FILL #524
+D18525	.FILL #525
+D18526	.FILL #526
+D18527	.FILL #527
+D18528	.FILL #528
+D18529	.FILL #529
+D18530	.FILL #530
+D18531	.FILL #531
+D18532	.FILL #532
+D18533	.FILL #533
+D18534	.FILL #534
+D18535	.FILL #535
+D18536	.FILL #536
+D18537	.FILL #537
+D18538	.FILL #538
+D18539	.FILL #539
+D18540	.FILL #540
+D18541	.FILL #541
+D18542	.FILL #542
+D18543	.FILL #543
+D18544	.FILL #544
+D18545	.FILL #545
+D18546	.FILL #546
+D18547	.FILL #547
+D18548	.FILL #548
+D18549	.FILL #549
+D18550	.FILL #550
+D18551	.FILL #551
+D18552	.FILL #552
+D18553	.FILL #553
+D18554	.FILL #554
+D18555	.FILL #555
+D18556	.FILL #556
+D18557	.FILL #557
+D18558	.FILL #558
+D18559	.FILL #559
+D18560	.FILL #560
+D18561	.FILL #561
+D18562	.FILL #562
+D18563	.FILL #563
+D18564	.FILL #564
+D18565	.FILL #565
+D18566	.FILL #566
+D18567	.FILL #567
+D18568	.FILL #568
+D18569	.FILL #569
+D18570	.FILL #570
+D18571	.FILL #571
+D18572	.FILL #572
+D18573	.FILL #573
+D18574	.FILL #574
+D18575	.FILL #575
+D18576	.FILL #576
+D18577	.FILL #577
+D18578	.FILL #578
+D18579	.FILL #579
+D18580	.FILL #580
+D18581	.FILL #581
+D18582	.FILL #582
+D18583	.FILL #583
+D18584	.FILL #584
+D18585	.FILL #585
+D18586	.FILL #586
+D18587	.FILL #587
+D18588	.FILL #588
+D18589	.FILL #589
+D18590	.FILL #590
+D18591	.FILL #591
+D18592	.FILL #592
+D18593	.FILL #593
+D18594	.FILL #594
+D18595	.FILL #595
+D18596	.FILL #596
+D18597	.FILL #597
+D18598	.FILL #598
+D18599	.FILL #599
+D18600	.FILL #600
+D18601	.FILL #601
+D18602	.FILL #602
+D18603	.FILL #603
+D18604	.FILL #604
+D18605	.FILL #605
+D18606	.FILL #606
+D18607	.FILL #607
+D18608	.FILL #608
+D18609	.FILL #609
+D18610	.FILL #610
+D18611	.FILL #611
+D18612	.FILL #612
+D18613	.FILL #613
+D18614	.FILL #614
+D18615	.FILL #615
+D18616	.FILL #616
+D18617	.FILL #617
+D18618	.FILL #618
+D18619	.FILL #619
+D18620	.FILL #620
+D18621	.FILL #621
+D18622	.FILL #622
+D18623	.FILL #623
+D18624	.FILL #624
+D18625	.FILL #625
+D18626	.FILL #626
+D18627	.FILL #627
+D18628	.FILL #628
+D18629	.FILL #629
+D18630	.FILL #630
+D18631	.FILL #631
+D18632	.FILL #632
+D18633	.FILL #633
+D18634	.FILL #634
+D18635	.FILL #635
+D18636	.FILL #636
+D18637	.FILL #637
+D18638	.FILL #638
+D18639	.FILL #639
+D18640	.FILL #640
+D18641	.FILL #641
+D18642	.FILL #642
+D18643	.FILL #643
+D18644	.FILL #644
+D18645	.FILL #645
+D18646	.FILL #646
+D18647	.FILL #647
+D18648	.FILL #648
+D18649	.FILL #649
+D18650	.FILL #650
+D18651	.FILL #651
+D18652	.FILL #652
+D18653	.FILL #653
+D18654	.FILL #654
+D18655	.FILL #655
+D18656	.FILL #656
+D18657	.FILL #657
+D18658	.FILL #658
+D18659	.FILL #659
+D18660	.FILL #660
+D18661	.FILL #661
+D18662	.FILL #662
+D18663	.FILL #663
+D18664	.FILL #664
+D18665	.FILL #665
+D18666	.FILL #666
+D18667	.FILL #667
+D18668	.FILL #668
+D18669	.FILL #669
+D18670	.FILL #670
+D18671	.FILL #671
+D18672	.FILL #672
+D18673	.FILL #673
+D18674	.FILL #674
+D18675	.FILL #675
+D18676	.FILL #676
+D18677	.FILL #677
+D18678	.FILL #678
+D18679	.FILL #679
+D18680	.FILL #680
+D18681	.FILL #681
+D18682	.FILL #682
+D18683	.FILL #683
+D18684	.FILL #684
+D18685	.FILL #685
+D18686	.FILL #686
+D18687	.FILL #687
+D18688	.FILL #688
+D18689	.FILL #689
+D18690	.FILL #690
+D18691	.FILL #691
+D18692	.FILL #692
+D18693	.FILL #693
+D18694	.FILL #694
+D18695	.FILL #695
+D18696	.FILL #696
+D18697	.FILL #697
+D18698	.FILL #698
+D18699	.FILL #699
+D18700	.FILL #700
+D18701	.FILL #701
+D18702	.FILL #702
+D18703	.FILL #703
+D18704	.FILL #704
+D18705	.FILL #705
+D18706	.FILL #706
+D18707	.FILL #707
+D18708	.FILL #708
+D18709	.FILL #709
+D18710	.FILL #710
+D18711	.FILL #711
+D18712	.FILL #712
+D18713	.FILL #713
+D18714	.FILL #714
+D18715	.FILL #715
+D18716	.FILL #716
+D18717	.FILL #717
+D18718	.FILL #718
+D18719	.FILL #719
+D18720	.FILL #720
+D18721	.FILL #721
+D18722	.FILL #722
+D18723	.FILL #723
+D18724	.FILL #724
+D18725	.FILL #725
+D18726	.FILL #726
+D18727	.FILL #727
+D18728	.FILL #728
+D18729	.FILL #729
+D18730	.FILL #730
+D18731	.FILL #731
+D18732	.FILL #732
+D18733	.FILL #733
+D18734	.FILL #734
+D18735	.FILL #735
+D18736	.FILL #736
+D18737	.FILL #737
+D18738	.FILL #738
+D18739	.FILL #739
+D18740	.FILL #740
+D18741	.FILL #741
+D18742	.FILL #742
+D18743	.FILL #743
+D18744	.FILL #744
+D18745	.FILL #745
+D18746	.FILL #746
+D18747	.FILL #747
+D18748	.FILL #748
+D18749	.FILL #749
+D18750	.FILL #750
+D18751	.FILL #751
+D18752	.FILL #752
+D18753	.FILL #753
+D18754	.FILL #754
+D18755	.FILL #755
+D18756	.FILL #756
+D18757	.FILL #757
+D18758	.FILL #758
+D18759	.FILL #759
+D18760	.FILL #760
+D18761	.FILL #761
+D18762	.FILL #762
+D18763	.FILL #763
+D18764	.FILL #764
+D18765	.FILL #765
+D18766	.FILL #766
+D18767	.FILL #767
+D18768	.FILL #768
+D18769	.FILL #769
+D18770	.FILL #770
+D18771	.FILL #771
+D18772	.FILL #772
+D18773	.FILL #773
+D18774	.FILL #774
+D18775	.FILL #775
+D18776	.FILL #776
+D18777	.FILL #777
+D18778	.FILL #778
+D18779	.FILL #779
+D18780	.FILL #780
+D18781	.FILL #781
+D18782	.FILL #782
+D18783	.FILL #783
+D18784	.FILL #784
+D18785	.FILL #785
+D18786	.FILL #786
+D18787	.FILL #787
+D18788	.FILL #788
+D18789	.FILL #789
+D18790	.FILL #790
+D18791	.FILL #791
+D18792	.FILL #792
+D18793	.FILL #793
+D18794	.FILL #794
+D18795	.FILL #795
+D18796	.FILL #796
+D18797	.FILL #797
+D18798	.FILL #798
+D18799	.FILL #799
+D18800	.FILL #800
+D18801	.FILL #801
+D18802	.FILL #802
+D18803	.FILL #803
+D18804	.FILL #804
+D18805	.FILL #805
+D18806	.FILL #806
+D18807	.FILL #807
+D18808	.FILL #808
+D18809	.FILL #809
+D18810	.FILL #810
+D18811	.FILL #811
+D18812	.FILL #812
+D18813	.FILL #813
+D18814	.FILL #814
+D18815	.FILL #815
+D18816	.FILL #816
+D18817	.FILL #817
+D18818	.FILL #818
+D18819	.FILL #819
+D18820	.FILL #820
+D18821	.FILL #821
+D18822	.FILL #822
+D18823	.FILL #823
+D18824	.FILL #824
+D18825	.FILL #825
+D18826	.FILL #826
+D18827	.FILL #827
+D18828	.FILL #828
+D18829	.FILL #829
+D18830	.FILL #830
+D18831	.FILL #831
+D18832	.FILL #832
+D18833	.FILL #833
+D18834	.FILL #834
+D18835	.FILL #835
+D18836	.FILL #836
+D18837	.FILL #837
+D18838	.FILL #838
+D18839	.FILL #839
+D18840	.FILL #840
+D18841	.FILL #841
+D18842	.FILL #842
+D18843	.FILL #843
+D18844	.FILL #844
+D18845	.FILL #845
+D18846	.FILL #846
+D18847	.FILL #847
+D18848	.FILL #848
+D18849	.FILL #849
+D18850	.FILL #850
+D18851	.FILL #851
+D18852	.FILL #852
+D18853	.FILL #853
+D18854	.FILL #854
+D18855	.FILL #855
+D18856	.FILL #856
+D18857	.FILL #857
+D18858	.FILL #858
+D18859	.FILL #859
+D18860	.FILL #860
+D18861	.FILL #861
+D18862	.FILL #862
+D18863	.FILL #863
+D18864	.FILL #864
+D18865	.FILL #865
+D18866	.FILL #866
+D18867	.FILL #867
+D18868	.FILL #868
+D18869	.FILL #869
+D18870	.FILL #870
+D18871	.FILL #871
+D18872	.FILL #872
+D18873	.FILL #873
+D18874	.FILL #874
+D18875	.FILL #875
+D18876	.FILL #876
+D18877	.FILL #877
+D18878	.FILL #878
+D18879	.FILL #879
+D18880	.FILL #880
+D18881	.FILL #881
+D18882	.FILL #882
+D18883	.FILL #883
+D18884	.FILL #884
+D18885	.FILL #885
+D18886	.FILL #886
+D18887	.FILL #887
+D18888	.FILL #888
+D18889	.FILL #889
+D18890	.FILL #890
+D18891	.FILL #891
+D18892	.FILL #892
+D18893	.FILL #893
+D18894	.FILL #894
+D18895	.FILL #895
+D18896	.FILL #896
+D18897	.FILL #897
+D18898	.FILL #898
+D18899	.FILL #899
+D18900	.FILL #900
+D18901	.FILL #901
+D18902	.FILL #902
+D18903	.FILL #903
+D18904	.FILL #904
+D18905	.FILL #905
+D18906	.FILL #906
+D18907	.FILL #907
+D18908	.FILL #908
+D18909	.FILL #909
+D18910	.FILL #910
+D18911	.FILL #911
+D18912	.FILL #912
+D18913	.FILL #913
+D18914	.FILL #914
+D18915	.FILL #915
+D18916	.FILL #916
+D18917	.FILL #917
+D18918	.FILL #918
+D18919	.FILL #919
+D18920	.FILL #920
+D18921	.FILL #921
+D18922	.FILL #922
+D18923	.FILL #923
+D18924	.FILL #924
+D18925	.FILL #925
+D18926	.FILL #926
+D18927	.FILL #927
+D18928	.FILL #928
+D18929	.FILL #929
+D18930	.FILL #930
+D18931	.FILL #931
+D18932	.FILL #932
+D18933	.FILL #933
+D18934	.FILL #934
+D18935	.FILL #935
+D18936	.FILL #936
+D18937	.FILL #937
+D18938	.FILL #938
+D18939	.FILL #939
+D18940	.FILL #940
+D18941	.FILL #941
+D18942	.FILL #942
+D18943	.FILL #943
+D18944	.FILL #944
+D18945	.FILL #945
+D18946	.FILL #946
+D18947	.FILL #947
+D18948	.FILL #948
+D18949	.FILL #949
+D18950	.FILL #950
+D18951	.FILL #951
+D18952	.FILL #952
+D18953	.FILL #953
+D18954	.FILL #954
+D18955	.FILL #955
+D18956	.FILL #956
+D18957	.FILL #957
+D18958	.FILL #958
+D18959	.FILL #959
+D18960	.FILL #960
+D18961	.FILL #961
+D18962	.FILL #962
+D18963	.FILL #963
+D18964	.FILL #964
+D18965	.FILL #965
+D18966	.FILL #966
+D18967	.FILL #967
+D18968	.FILL #968
+D18969	.FILL #969
+D18970	.FILL #970
+D18971	.FILL #971
+D18972	.FILL #972
+D18973	.FILL #973
+D18974	.FILL #974
+D18975	.FILL #975
+D18976	.FILL #976
+D18977	.FILL #977
+D18978	.FILL #978
+D18979	.FILL #979
+D18980	.FILL #980
+D18981	.FILL #981
+D18982	.FILL #982
+D18983	.FILL #983
+D18984	.FILL #984
+D18985	.FILL #985
+D18986	.FILL #986
+D18987	.FILL #987
+D18988	.FILL #988
+D18989	.FILL #989
+D18990	.FILL #990
+D18991	.FILL #991
+D18992	.FILL #992
+D18993	.FILL #993
+D18994	.FILL #994
+D18995	.FILL #995
+D18996	.FILL #996
+D18997	.FILL #997
+D18998	.FILL #998
+D18999	.FILL #999
+D19000	.FILL #0
+D19001	.FILL #1
+D19002	.FILL #2
+D19003	.FILL #3
+D19004	.FILL #4
+D19005	.FILL #5
+D19006	.FILL #6
+D19007	.FILL #7
+D19008	.FILL #8
+D19009	.FILL #9
+D19010	.FILL #10
+D19011	.FILL #11
+D19012	.FILL #12
+D19013	.FILL #13
+D19014	.FILL #14
+D19015	.FILL #15
+D19016	.FILL #16
+D19017	.FILL #17
+D19018	.FILL #18
+D19019	.FILL #19
+D19020	.FILL #20
+D19021	.FILL #21
+D19022	.FILL #22
+D19023	.FILL #23
+D19024	.FILL #24
+D19025	.FILL #25
+D19026	.FILL #26
+D19027	.FILL #27
+D19028	.FILL #28
+D19029	.FILL #29
+D19030	.FILL #30
+D19031	.FILL #31
+D19032	.FILL #32
+D19033	.FILL #33
+D19034	.FILL #34
+D19035	.FILL #35
+D19036	.FILL #36
+D19037	.FILL #37
+D19038	.FILL #38
+D19039	.FILL #39
+D19040	.FILL #40
+D19041	.FILL #41
+D19042	.FILL #42
+D19043	.FILL #43
+D19044	.FILL #44
+D19045	.FILL #45
+D19046	.FILL #46
+D19047	.FILL #47
+D19048	.FILL #48
+D19049	.FILL #49
+D19050	.FILL #50
+D19051	.FILL #51
+D19052	.FILL #52
+D19053	.FILL #53
+D19054	.FILL #54
+D19055	.FILL #55
+D19056	.FILL #56
+D19057	.FILL #57
+D19058	.FILL #58
+D19059	.FILL #59
+D19060	.FILL #60
+D19061	.FILL #61
+D19062	.FILL #62
+D19063	.FILL #63
+D19064	.FILL #64
+D19065	.FILL #65
+D19066	.FILL #66
+D19067	.FILL #67
+D19068	.FILL #68
+D19069	.FILL #69
+D19070	.FILL #70
+D19071	.FILL #71
+D19072	.FILL #72
+D19073	.FILL #73
+D19074	.FILL #74
+D19075	.FILL #75
+D19076	.FILL #76
+D19077	.FILL #77
+D19078	.FILL #78
+D19079	.FILL #79
+D19080	.FILL #80
+D19081	.FILL #81
+D19082	.FILL #82
+D19083	.FILL #83
+D19084	.FILL #84
+D19085	.FILL #85
+D19086	.FILL #86
+D19087	.FILL #87
+D19088	.FILL #88
+D19089	.FILL #89
+D19090	.FILL #90
+D19091	.FILL #91
+D19092	.FILL #92
+D19093	.FILL #93
+D19094	.FILL #94
+D19095	.FILL #95
+D19096	.FILL #96
+D19097	.FILL #97
+D19098	.FILL #98
+D19099	.FILL #99
+D19100	.FILL #100
+D19101	.FILL #101
+D19102	.FILL #102
+D19103	.FILL #103
+D19104	.FILL #104
+D19105	.FILL #105
+D19106	.FILL #106
+D19107	.FILL #107
+D19108	.FILL #108
+D19109	.FILL #109
+D19110	.FILL #110
+D19111	.FILL #111
+D19112	.FILL #112
+D19113	.FILL #113
+D19114	.FILL #114
+D19115	.FILL #115
+D19116	.FILL #116
+D19117	.FILL #117
+D19118	.FILL #118
+D19119	.FILL #119
+D19120	.FILL #120
+D19121	.FILL #121
+D19122	.FILL #122
+D19123	.FILL #123
+D19124	.FILL #124
+D19125	.FILL #125
+D19126	.FILL #126
+D19127	.FILL #127
+D19128	.FILL #128
+D19129	.FILL #129
+D19130	.FILL #130
+D19131	.FILL #131
+D19132	.FILL #132
+D19133	.FILL #133
+D19134	.FILL #134
+D19135	.FILL #135
+D19136	.FILL #136
+D19137	.FILL #137
+D19138	.FILL #138
+D19139	.FILL #139
+D19140	.FILL #140
+D19141	.FILL #141
+D19142	.FILL #142
+D19143	.FILL #143
+D19144	.FILL #144
+D19145	.FILL #145
+D19146	.FILL #146
+D19147	.FILL #147
+D19148	.FILL #148
+D19149	.FILL #149
+D19150	.FILL #150
+D19151	.FILL #151
+D19152	.FILL #152
+D19153	.FILL #153
+D19154	.FILL #154
+D19155	.FILL #155
+D19156	.FILL #156
+D19157	.FILL #157
+D19158	.FILL #158
+D19159	.FILL #159
+D19160	.FILL #160
+D19161	.FILL #161
+D19162	.FILL #162
+D19163	.FILL #163
+D19164	.FILL #164
+D19165	.FILL #165
+D19166	.FILL #166
+D19167	.FILL #167
+D19168	.FILL #168
+D19169	.FILL #169
+D19170	.FILL #170
+D19171	.FILL #171
+D19172	.FILL #172
+D19173	.FILL #173
+D19174	.FILL #174
+D19175	.FILL #175
+D19176	.FILL #176
+D19177	.FILL #177
+D19178	.FILL #178
+D19179	.FILL #179
+D19180	.FILL #180
+D19181	.FILL #181
+D19182	.FILL #182
+D19183	.FILL #183
+D19184	.FILL #184
+D19185	.FILL #185
+D19186	.FILL #186
+D19187	.FILL #187
+D19188	.FILL #188
+D19189	.FILL #189
+D19190	.FILL #190
+D19191	.FILL #191
+D19192	.FILL #192
+D19193	.FILL #193
+D19194	.FILL #194
+D19195	.FILL #195
+D19196	.FILL #196
+D19197	.FILL #197
+D19198	.FILL #198
+D19199	.FILL #199
+D19200	.FILL #200
+D19201	.FILL #201
+D19202	.FILL #202
+D19203	.FILL #203
+D19204	.FILL #204
+D19205	.FILL #205
+D19206	.FILL #206
+D19207	.FILL #207
+D19208	.FILL #208
+D19209	.FILL #209
+D19210	.FILL #210
+D19211	.FILL #211
+D19212	.FILL #212
+D19213	.FILL #213
+D19214	.FILL #214
+D19215	.FILL #215
+D19216	.FILL #216
+D19217	.FILL #217
+D19218	.FILL #218
+D19219	.FILL #219
+D19220	.FILL #220
+D19221	.FILL #221
+D19222	.FILL #222
+D19223	.FILL #223
+D19224	.FILL #224
+D19225	.FILL #225
+D19226	.FILL #226
+D19227	.FILL #227
+D19228	.FILL #228
+D19229	.FILL #229
+D19230	.FILL #230
+D19231	.FILL #231
+D19232	.FILL #232
+D19233	.FILL #233
+D19234	.FILL #234
+D19235	.FILL #235
+D19236	.FILL #236
+D19237	.FILL #237
+D19238	.FILL #238
+D19239	.FILL #239
+D19240	.FILL #240
+D19241	.FILL #241
+D19242	.FILL #242
+D19243	.FILL #243
+D19244	.FILL #244
+D19245	.FILL #245
+D19246	.FILL #246
+D19247	.FILL #247
+D19248	.FILL #248
+D19249	.FILL #249
+D19250	.FILL #250
+D19251	.FILL #251
+D19252	.FILL #252
+D19253	.FILL #253
+D19254	.FILL #254
+D19255	.FILL #255
+D19256	.FILL #256
+D19257	.FILL #257
+D19258	.FILL #258
+D19259	.FILL #259
+D19260	.FILL #260
+D19261	.FILL #261
+D19262	.FILL #262
+D19263	.FILL #263
+D19264	.FILL #264
+D19265	.FILL #265
+D19266	.FILL #266
+D19267	.FILL #267
+D19268	.FILL #268
+D19269	.FILL #269
+D19270	.FILL #270
+D19271	.FILL #271
+D19272	.FILL #272
+D19273	.FILL #273
+D19274	.FILL #274
+D19275	.FILL #275
+D19276	.FILL #276
+D19277	.FILL #277
+D19278	.FILL #278
+D19279	.FILL #279
+D19280	.FILL #280
+D19281	.FILL #281
+D19282	.FILL #282
+D19283	.FILL #283
+D19284	.FILL #284
+D19285	.FILL #285
+D19286	.FILL #286
+D19287	.FILL #287
+D19288	.FILL #288
+D19289	.FILL #289
+D19290	.FILL #290
+D19291	.FILL #291
+D19292	.FILL #292
+D19293	.FILL #293
+D19294	.FILL #294
+D19295	.FILL #295
+D19296	.FILL #296
+D19297	.FILL #297
+D19298	.FILL #298
+D19299	.FILL #299
+D19300	.FILL #300
+D19301	.FILL #301
+D19302	.FILL #302
+D19303	.FILL #303
+D19304	.FILL #304
+D19305	.FILL #305
+D19306	.FILL #306
+D19307	.FILL #307
+D19308	.FILL #308
+D19309	.FILL #309
+D19310	.FILL #310
+D19311	.FILL #311
+D19312	.FILL #312
+D19313	.FILL #313
+D19314	.FILL #314
+D19315	.FILL #315
+D19316	.FILL #316
+D19317	.FILL #317
+D19318	.FILL #318
+D19319	.FILL #319
+D19320	.FILL #320
+D19321	.FILL #321
+D19322	.FILL #322
+D19323	.FILL #323
+D19324	.FILL #324
+D19325	.FILL #325
+D19326	.FILL #326
+D19327	.FILL #327
+D19328	.FILL #328
+D19329	.FILL #329
+D19330	.FILL #330
+D19331	.FILL #331
+D19332	.FILL #332
+D19333	.FILL #333
+D19334	.FILL #334
+D19335	.FILL #335
+D19336	.FILL #336
+D19337	.FILL #337
+D19338	.FILL #338
+D19339	.FILL #339
+D19340	.FILL #340
+D19341	.FILL #341
+D19342	.FILL #342
+D19343	.FILL #343
+D19344	.FILL #344
+D19345	.FILL #345
+D19346	.FILL #346
+D19347	.FILL #347
+D19348	.FILL #348
+D19349	.FILL #349
+D19350	.FILL #350
+D19351	.FILL #351
+D19352	.FILL #352
+D19353	.FILL #353
+D19354	.FILL #354
+D19355	.FILL #355
+D19356	.FILL #356
+D19357	.FILL #357
+D19358	.FILL #358
+D19359	.FILL #359
+D19360	.FILL #360
+D19361	.FILL #361
+D19362	.FILL #362
+D19363	.FILL #363
+D19364	.FILL #364
+D19365	.FILL #365
+D19366	.FILL #366
+D19367	.FILL #367
+D19368	.FILL #368
+D19369	.FILL #369
+D19370	.FILL #370
+D19371	.FILL #371
+D19372	.FILL #372
+D19373	.FILL #373
+D19374	.FILL #374
+D19375	.FILL #375
+D19376	.FILL #376
+D19377	.FILL #377
+D19378	.FILL #378
+D19379	.FILL #379
+D19380	.FILL #380
+D19381	.FILL #381
+D19382	.FILL #382
+D19383	.FILL #383
+D19384	.FILL #384
+D19385	.FILL #385
+D19386	.FILL #386
+D19387	.FILL #387
+D19388	.FILL #388
+D19389	.FILL #389
+D19390	.FILL #390
+D19391	.FILL #391
+D19392	.FILL #392
+D19393	.FILL #393
+D19394	.FILL #394
+D19395	.FILL #395
+D19396	.FILL #396
+D19397	.FILL #397
+D19398	.FILL #398
+D19399	.FILL #399
+D19400	.FILL #400
+D19401	.FILL #401
+D19402	.FILL #402
+D19403	.FILL #403
+D19404	.FILL #404
+D19405	.FILL #405
+D19406	.FILL #406
+D19407	.FILL #407
+D19408	.FILL #408
+D19409	.FILL #409
+D19410	.FILL #410
+D19411	.FILL #411
+D19412	.FILL #412
+D19413	.FILL #413
+D19414	.FILL #414
+D19415	.FILL #415
+D19416	.FILL #416
+D19417	.FILL #417
+D19418	.FILL #418
+D19419	.FILL #419
+D19420	.FILL #420
+D19421	.FILL #421
+D19422	.FILL #422
+D19423	.FILL #423
+D19424	.FILL #424
+D19425	.FILL #425
+D19426	.FILL #426
+D19427	.FILL #427
+D19428	.FILL #428
+D19429	.FILL #429
+D19430	.FILL #430
+D19431	.FILL #431
+D19432	.FILL #432
+D19433	.FILL #433
+D19434	.FILL #434
+D19435	.FILL #435
+D19436	.FILL #436
+D19437	.FILL #437
+D19438	.FILL #438
+D19439	.FILL #439
+D19440	.FILL #440
+D19441	.FILL #441
+D19442	.FILL #442
+D19443	.FILL #443
+D19444	.FILL #444
+D19445	.FILL #445
+D19446	.FILL #446
+D19447	.FILL #447
+D19448	.FILL #448
+D19449	.FILL #449
+D19450	.FILL #450
+D19451	.FILL #451
+D19452	.FILL #452
+D19453	.FILL #453
+D19454	.FILL #454
+D19455	.FILL #455
+D19456	.FILL #456
+D19457	.FILL #457
+D19458	.FILL #458
+D19459	.FILL #459
+D19460	.FILL #460
+D19461	.FILL #461
+D19462	.FILL #462
+D19463	.FILL #463
+D19464	.FILL #464
+D19465	.FILL #465
+D19466	.FILL #466
+D19467	.FILL #467
+D19468	.FILL #468
+D19469	.FILL #469
+D19470	.FILL #470
+D19471	.FILL #471
+D19472	.FILL #472
+D19473	.FILL #473
+D19474	.FILL #474
+D19475	.FILL #475
+D19476	.FILL #476
+D19477	.FILL #477
+D19478	.FILL #478
+D19479	.FILL #479
+D19480	.FILL #480
+D19481	.FILL #481
+D19482	.FILL #482
+D19483	.FILL #483
+D19484	.FILL #484
+D19485	.FILL #485
+D19486	.FILL #486
+D19487	.FILL #487
+D19488	.FILL #488
+D19489	.FILL #489
+D19490	.FILL #490
+D19491	.FILL #491
+D19492	.FILL #492
+D19493	.FILL #493
+D19494	.FILL #494
+D19495	.FILL #495
+D19496	.FILL #496
+D19497	.FILL #497
+D19498	.FILL #498
+D19499	.FILL #499
+D19500	.FILL #500
+D19501	.FILL #501
+D19502	.FILL #502
+D19503	.FILL #503
+D19504	.FILL #504
+D19505	.FILL #505
+D19506	.FILL #506
+D19507	.FILL #507
+D19508	.FILL #508
+D19509	.FILL #509
+D19510	.FILL #510
+D19511	.FILL #511
+D19512	.FILL #512
+D19513	.FILL #513
+D19514	.FILL #514
+D19515	.FILL #515
+D19516	.FILL #516
+D19517	.FILL #517
+D19518	.FILL #518
+D19519	.FILL #519
+D19520	.FILL #520
+D19521	.FILL #521
+D19522	.FILL #522
+D19523	.FILL #523
+D19524	.FILL #524
+D19525	.FILL #525
+D19526	.FILL #526
+D19527	.FILL #527
+D19528	.FILL #528
+D19529	.FILL #529
+D19530	.FILL #530
+D19531	.FILL #531
+D19532	.FILL #532
+D19533	.FILL #533
+D19534	.FILL #534
+D19535	.FILL #535
+D19536	.FILL #536
+D19537	.FILL #537
+D19538	.FILL #538
+D19539	.FILL #539
+D19540	.FILL #540
+D19541	.FILL #541
+D19542	.FILL #542
+D19543	.FILL #543
+D19544	.FILL #544
+D19545	.FILL #545
+D19546	.FILL #546
+D19547	.FILL #547
+D19548	.FILL #548
+D19549	.FILL #549
+D19550	.FILL #550
+D19551	.FILL #551
+D19552	.FILL #552
+D19553	.FILL #553
+D19554	.FILL #554
+D19555	.FILL #555
+D19556	.FILL #556
+D19557	.FILL #557
+D19558	.FILL #558
+D19559	.FILL #559
+D19560	.FILL #560
+D19561	.FILL #561
+D19562	.FILL #562
+D19563	.FILL #563
+D19564	.FILL #564
+D19565	.FILL #565
+D19566	.FILL #566
+D19567	.FILL #567
+D19568	.FILL #568
+D19569	.FILL #569
+D19570	.FILL #570
+D19571	.FILL #571
+D19572	.FILL #572
+D19573	.FILL #573
+D19574	.FILL #574
+D19575	.FILL #575
+D19576	.FILL #576
+D19577	.FILL #577
+D19578	.FILL #578
+D19579	.FILL #579
+D19580	.FILL #580
+D19581	.FILL #581
+D19582	.FILL #582
+D19583	.FILL #583
+D19584	.FILL #584
+D19585	.FILL #585
+D19586	.FILL #586
+D19587	.FILL #587
+D19588	.FILL #588
+D19589	.FILL #589
+D19590	.FILL #590
+D19591	.FILL #591
+D19592	.FILL #592
+D19593	.FILL #593
+D19594	.FILL #594
+D19595	.FILL #595
+D19596	.FILL #596
+D19597	.FILL #597
+D19598	.FILL #598
+D19599	.FILL #599
+D19600	.FILL #600
+D19601	.FILL #601
+D19602	.FILL #602
+D19603	.FILL #603
+D19604	.FILL #604
+D19605	.FILL #605
+D19606	.FILL #606
+D19607	.FILL #607
+D19608	.FILL #608
+D19609	.FILL #609
+D19610	.FILL #610
+D19611	.FILL #611
+D19612	.FILL #612
+D19613	.FILL #613
+D19614	.FILL #614
+D19615	.FILL #615
+D19616	.FILL #616
+D19617	.FILL #617
+D19618	.FILL #618
+D19619	.FILL #619
+D19620	.FILL #620
+D19621	.FILL #621
+D19622	.FILL #622
+D19623	.FILL #623
+D19624	.FILL #624
+D19625	.FILL #625
+D19626	.FILL #626
+D19627	.FILL #627
+D19628	.FILL #628
+D19629	.FILL #629
+D19630	.FILL #630
+D19631	.FILL #631
+D19632	.FILL #632
+D19633	.FILL #633
+D19634	.FILL #634
+D19635	.FILL #635
+D19636	.FILL #636
+D19637	.FILL #637
+D19638	.FILL #638
+D19639	.FILL #639
+D19640	.FILL #640
+D19641	.FILL #641
+D19642	.FILL #642
+D19643	.FILL #643
+D19644	.FILL #644
+D19645	.FILL #645
+D19646	.FILL #646
+D19647	.FILL #647
+D19648	.FILL #648
+D19649	.FILL #649
+D19650	.FILL #650
+D19651	.FILL #651
+D19652	.FILL #652
+D19653	.FILL #653
+D19654	.FILL #654
+D19655	.FILL #655
+D19656	.FILL #656
+D19657	.FILL #657
+D19658	.FILL #658
+D19659	.FILL #659
+D19660	.FILL #660
+D19661	.FILL #661
+D19662	.FILL #662
+D19663	.FILL #663
+D19664	.FILL #664
+D19665	.FILL #665
+D19666	.FILL #666
+D19667	.FILL #667
+D19668	.FILL #668
+D19669	.FILL #669
+D19670	.FILL #670
+D19671	.FILL #671
+D19672	.FILL #672
+D19673	.FILL #673
+D19674	.FILL #674
+D19675	.FILL #675
+D19676	.FILL #676
+D19677	.FILL #677
+D19678	.FILL #678
+D19679	.FILL #679
+D19680	.FILL #680
+D19681	.FILL #681
+D19682	.FILL #682
+D19683	.FILL #683
+D19684	.FILL #684
+D19685	.FILL #685
+D19686	.FILL #686
+D19687	.FILL #687
+D19688	.FILL #688
+D19689	.FILL #689
+D19690	.FILL #690
+D19691	.FILL #691
+D19692	.FILL #692
+D19693	.FILL #693
+D19694	.FILL #694
+D19695	.FILL #695
+D19696	.FILL #696
+D19697	.FILL #697
+D19698	.FILL #698
+D19699	.FILL #699
+D19700	.FILL #700
+D19701	.FILL #701
+D19702	.FILL #702
+D19703	.FILL #703
+D19704	.FILL #704
+D19705	.FILL #705
+D19706	.FILL #706
+D19707	.FILL #707
+D19708	.FILL #708
+D19709	.FILL #709
+D19710	.FILL #710
+D19711	.FILL #711
+D19712	.FILL #712
+D19713	.FILL #713
+D19714	.FILL #714
+D19715	.FILL #715
+D19716	.FILL #716
+D19717	.FILL #717
+D19718	.FILL #718
+D19719	.FILL #719
+D19720	.FILL #720
+D19721	.FILL #721
+D19722	.FILL #722
+D19723	.FILL #723
+D19724	.FILL #724
+D19725	.FILL #725
+D19726	.FILL #726
+D19727	.FILL #727
+D19728	.FILL #728
+D19729	.FILL #729
+D19730	.FILL #730
+D19731	.FILL #731
+D19732	.FILL #732
+D19733	.FILL #733
+D19734	.FILL #734
+D19735	.FILL #735
+D19736	.FILL #736
+D19737	.FILL #737
+D19738	.FILL #738
+D19739	.FILL #739
+D19740	.FILL #740
+D19741	.FILL #741
+D19742	.FILL #742
+D19743	.FILL #743
+D19744	.FILL #744
+D19745	.FILL #745
+D19746	.FILL #746
+D19747	.FILL #747
+D19748	.FILL #748
+D19749	.FILL #749
+D19750	.FILL #750
+D19751	.FILL #751
+D19752	.FILL #752
+D19753	.FILL #753
+D19754	.FILL #754
+D19755	.FILL #755
+D19756	.FILL #756
+D19757	.FILL #757
+D19758	.FILL #758
+D19759	.FILL #759
+D19760	.FILL #760
+D19761	.FILL #761
+D19762	.FILL #762
+D19763	.FILL #763
+D19764	.FILL #764
+D19765	.FILL #765
+D19766	.FILL #766
+D19767	.FILL #767
+D19768	.FILL #768
+D19769	.FILL #769
+D19770	.FILL #770
+D19771	.FILL #771
+D19772	.FILL #772
+D19773	.FILL #773
+D19774	.FILL #774
+D19775	.FILL #775
+D19776	.FILL #776
+D19777	.FILL #777
+D19778	.FILL #778
+D19779	.FILL #779
+D19780	.FILL #780
+D19781	.FILL #781
+D19782	.FILL #782
+D19783	.FILL #783
+D19784	.FILL #784
+D19785	.FILL #785
+D19786	.FILL #786
+D19787	.FILL #787
+D19788	.FILL #788
+D19789	.FILL #789
+D19790	.FILL #790
+D19791	.FILL #791
+D19792	.FILL #792
+D19793	.FILL #793
+D19794	.FILL #794
+D19795	.FILL #795
+D19796	.FILL #796
+D19797	.FILL #797
+D19798	.FILL #798
+D19799	.FILL #799
+D19800	.FILL #800
+D19801	.FILL #801
+D19802	.FILL #802
+D19803	.FILL #803
+D19804	.FILL #804
+D19805	.FILL #805
+D19806	.FILL #806
+D19807	.FILL #807
+D19808	.FILL #808
+D19809	.FILL #809
+D19810	.FILL #810
+D19811	.FILL #811
+D19812	.FILL #812
+D19813	.FILL #813
+D19814	.FILL #814
+D19815	.FILL #815
+D19816	.FILL #816
+D19817	.FILL #817
+D19818	.FILL #818
+D19819	.FILL #819
+D19820	.FILL #820
+D19821	.FILL #821
+D19822	.FILL #822
+D19823	.FILL #823
+D19824	.FILL #824
+D19825	.FILL #825
+D19826	.FILL #826
+D19827	.FILL #827
+D19828	.FILL #828
+D19829	.FILL #829
+D19830	.FILL #830
+D19831	.FILL #831
+D19832	.FILL #832
+D19833	.FILL #833
+D19834	.FILL #834
+D19835	.FILL #835
+D19836	.FILL #836
+D19837	.FILL #837
+D19838	.FILL #838
+D19839	.FILL #839
+D19840	.FILL #840
+D19841	.FILL #841
+D19842	.FILL #842
+D19843	.FILL #843
+D19844	.FILL #844
+D19845	.FILL #845
+D19846	.FILL #846
+D19847	.FILL #847
+D19848	.FILL #848
+D19849	.FILL #849
+D19850	.FILL #850
+D19851	.FILL #851
+D19852	.FILL #852
+D19853	.FILL #853
+D19854	.FILL #854
+D19855	.FILL #855
+D19856	.FILL #856
+D19857	.FILL #857
+D19858	.FILL #858
+D19859	.FILL #859
+D19860	.FILL #860
+D19861	.FILL #861
+D19862	.FILL #862
+D19863	.FILL #863
+D19864	.FILL #864
+D19865	.FILL #865
+D19866	.FILL #866
+D19867	.FILL #867
+D19868	.FILL #868
+D19869	.FILL #869
+D19870	.FILL #870
+D19871	.FILL #871
+D19872	.FILL #872
+D19873	.FILL #873
+D19874	.FILL #874
+D19875	.FILL #875
+D19876	.FILL #876
+D19877	.FILL #877
+D19878	.FILL #878
+D19879	.FILL #879
+D19880	.FILL #880
+D19881	.FILL #881
+D19882	.FILL #882
+D19883	.FILL #883
+D19884	.FILL #884
+D19885	.FILL #885
+D19886	.FILL #886
+D19887	.FILL #887
+D19888	.FILL #888
+D19889	.FILL #889
+D19890	.FILL #890
+D19891	.FILL #891
+D19892	.FILL #892
+D19893	.FILL #893
+D19894	.FILL #894
+D19895	.FILL #895
+D19896	.FILL #896
+D19897	.FILL #897
+D19898	.FILL #898
+D19899	.FILL #899
+D19900	.FILL #900
+D19901	.FILL #901
+D19902	.FILL #902
+D19903	.FILL #903
+D19904	.FILL #904
+D19905	.FILL #905
+D19906	.FILL #906
+D19907	.FILL #907
+D19908	.FILL #908
+D19909	.FILL #909
+D19910	.FILL #910
+D19911	.FILL #911
+D19912	.FILL #912
+D19913	.FILL #913
+D19914	.FILL #914
+D19915	.FILL #915
+D19916	.FILL #916
+D19917	.FILL #917
+D19918	.FILL #918
+D19919	.FILL #919
+D19920	.FILL #920
+D19921	.FILL #921
+D19922	.FILL #922
+D19923	.FILL #923
+D19924	.FILL #924
+D19925	.FILL #925
+D19926	.FILL #926
+D19927	.FILL #927
+D19928	.FILL #928
+D19929	.FILL #929
+D19930	.FILL #930
+D19931	.FILL #931
+D19932	.FILL #932
+D19933	.FILL #933
+D19934	.FILL #934
+D19935	.FILL #935
+D19936	.FILL #936
+D19937	.FILL #937
+D19938	.FILL #938
+D19939	.FILL #939
+D19940	.FILL #940
+D19941	.FILL #941
+D19942	.FILL #942
+D19943	.FILL #943
+D19944	.FILL #944
+D19945	.FILL #945
+D19946	.FILL #946
+D19947	.FILL #947
+D19948	.FILL #948
+D19949	.FILL #949
+D19950	.FILL #950
+D19951	.FILL #951
+D19952	.FILL #952
+D19953	.FILL #953
+D19954	.FILL #954
+D19955	.FILL #955
+D19956	.FILL #956
+D19957	.FILL #957
+D19958	.FILL #958
+D19959	.FILL #959
+D19960	.FILL #960
+D19961	.FILL #961
+D19962	.FILL #962
+D19963	.FILL #963
+D19964	.FILL #964
+D19965	.FILL #965
+D19966	.FILL #966
+D19967	.FILL #967
+D19968	.FILL #968
+D19969	.FILL #969
+D19970	.FILL #970
+D19971	.FILL #971
+D19972	.FILL #972
+D19973	.FILL #973
+D19974	.FILL #974
+D19975	.FILL #975
+D19976	.FILL #976
+D19977	.FILL #977
+D19978	.FILL #978
+D19979	.FILL #979
+D19980	.FILL #980
+D19981	.FILL #981
+D19982	.FILL #982
+D19983	.FILL #983
+D19984	.FILL #984
+D19985	.FILL #985
+D19986	.FILL #986
+D19987	.FILL #987
+D19988	.FILL #988
+D19989	.FILL #989
+D19990	.FILL #990
+D19991	.FILL #991
+D19992	.FILL #992
+D19993	.FILL #993
+D19994	.FILL #994
+D19995	.FILL #995
+D19996	.FILL #996
+D19997	.FILL #997
+D19998	.FILL #998
+D19999	.FILL #999
+START	ADD R1, R1, #1
+	BRnzp START
+D20000	.FILL #0
+D20001	.FILL #1
+D20002	.FILL #2
+D20003	.FILL #3
+D20004	.FILL #4
+D20005	.FILL #5
+D20006	.FILL #6
+D20007	.FILL #7
+D20008	.FILL #8
+D20009	.FILL #9
+D20010	.FILL #10
+D20011	.FILL #11
+D20012	.FILL #12
+D20013	.FILL #13
+D20014	.FILL #14
+D20015	.FILL #15
+D20016	.FILL #16
+D20017	.FILL #17
+D20018	.FILL #18
+D20019	.FILL #19
+D20020	.FILL #20
+D20021	.FILL #21
+D20022	.FILL #22
+D20023	.FILL #23
+D20024	.FILL #24
+D20025	.FILL #25
+D20026	.FILL #26
+D20027	.FILL #27
+D20028	.FILL #28
+D20029	.FILL #29
+D20030	.FILL #30
+D20031	.FILL #31
+D20032	.FILL #32
+D20033	.FILL #33
+D20034	.FILL #34
+D20035	.FILL #35
+D20036	.FILL #36
+D20037	.FILL #37
+D20038	.FILL #38
+D20039	.FILL #39
+D20040	.FILL #40
+D20041	.FILL #41
+D20042	.FILL #42
+D20043	.FILL #43
+D20044	.FILL #44
+D20045	.FILL #45
+D20046	.FILL #46
+D20047	.FILL #47
+D20048	.FILL #48
+D20049	.FILL #49
+D20050	.FILL #50
+D20051	.FILL #51
+D20052	.FILL #52
+D20053	.FILL #53
+D20054	.FILL #54
+D20055	.FILL #55
+D20056	.FILL #56
+D20057	.FILL #57
+D20058	.FILL #58
+D20059	.FILL #59
+D20060	.FILL #60
+D20061	.FILL #61
+D20062	.FILL #62
+D20063	.FILL #63
+D20064	.FILL #64
+D20065	.FILL #65
+D20066	.FILL #66
+D20067	.FILL #67
+D20068	.FILL #68
+D20069	.FILL #69
+D20070	.FILL #70
+D20071	.FILL #71
+D20072	.FILL #72
+D20073	.FILL #73
+D20074	.FILL #74
+D20075	.FILL #75
+D20076	.FILL #76
+D20077	.FILL #77
+D20078	.FILL #78
+D20079	.FILL #79
+D20080	.FILL #80
+D20081	.FILL #81
+D20082	.FILL #82
+D20083	.FILL #83
+D20084	.FILL #84
+D20085	.FILL #85
+D20086	.FILL #86
+D20087	.FILL #87
+D20088	.FILL #88
+D20089	.FILL #89
+D20090	.FILL #90
+D20091	.FILL #91
+D20092	.FILL #92
+D20093	.FILL #93
+D20094	.FILL #94
+D20095	.FILL #95
+D20096	.FILL #96
+D20097	.FILL #97
+D20098	.FILL #98
+D20099	.FILL #99
+D20100	.FILL #100
+D20101	.FILL #101
+D20102	.FILL #102
+D20103	.FILL #103
+D20104	.FILL #104
+D20105	.FILL #105
+D20106	.FILL #106
+D20107	.FILL #107
+D20108	.FILL #108
+D20109	.FILL #109
+D20110	.FILL #110
+D20111	.FILL #111
+D20112	.FILL #112
+D20113	.FILL #113
+D20114	.FILL #114
+D20115	.FILL #115
+D20116	.FILL #116
+D20117	.FILL #117
+D20118	.FILL #118
+D20119	.FILL #119
+D20120	.FILL #120
+D20121	.FILL #121
+D20122	.FILL #122
+D20123	.FILL #123
+D20124	.FILL #124
+D20125	.FILL #125
+D20126	.FILL #126
+D20127	.FILL #127
+D20128	.FILL #128
+D20129	.FILL #129
+D20130	.FILL #130
+D20131	.FILL #131
+D20132	.FILL #132
+D20133	.FILL #133
+D20134	.FILL #134
+D20135	.FILL #135
+D20136	.FILL #136
+D20137	.FILL #137
+D20138	.FILL #138
+D20139	.FILL #139
+D20140	.FILL #140
+D20141	.FILL #141
+D20142	.FILL #142
+D20143	.FILL #143
+D20144	.FILL #144
+D20145	.FILL #145
+D20146	.FILL #146
+D20147	.FILL #147
+D20148	.FILL #148
+D20149	.FILL #149
+D20150	.FILL #150
+D20151	.FILL #151
+D20152	.FILL #152
+D20153	.FILL #153
+D20154	.FILL #154
+D20155	.FILL #155
+D20156	.FILL #156
+D20157	.FILL #157
+D20158	.FILL #158
+D20159	.FILL #159
+D20160	.FILL #160
+D20161	.FILL #161
+D20162	.FILL #162
+D20163	.FILL #163
+D20164	.FILL #164
+D20165	.FILL #165
+D20166	.FILL #166
+D20167	.FILL #167
+D20168	.FILL #168
+D20169	.FILL #169
+D20170	.FILL #170
+D20171	.FILL #171
+D20172	.FILL #172
+D20173	.FILL #173
+D20174	.FILL #174
+D20175	.FILL #175
+D20176	.FILL #176
+D20177	.FILL #177
+D20178	.FILL #178
+D20179	.FILL #179
+D20180	.FILL #180
+D20181	.FILL #181
+D20182	.FILL #182
+D20183	.FILL #183
+D20184	.FILL #184
+D20185	.FILL #185
+D20186	.FILL #186
+D20187	.FILL #187
+D20188	.FILL #188
+D20189	.FILL #189
+D20190	.FILL #190
+D20191	.FILL #191
+D20192	.FILL #192
+D20193	.FILL #193
+D20194	.FILL #194
+D20195	.FILL #195
+D20196	.FILL #196
+D20197	.FILL #197
+D20198	.FILL #198
+D20199	.FILL #199
+D20200	.FILL #200
+D20201	.FILL #201
+D20202	.FILL #202
+D20203	.FILL #203
+D20204	.FILL #204
+D20205	.FILL #205
+D20206	.FILL #206
+D20207	.FILL #207
+D20208	.FILL #208
+D20209	.FILL #209
+D20210	.FILL #210
+D20211	.FILL #211
+D20212	.FILL #212
+D20213	.FILL #213
+D20214	.FILL #214
+D20215	.FILL #215
+D20216	.FILL #216
+D20217	.FILL #217
+D20218	.FILL #218
+D20219	.FILL #219
+D20220	.FILL #220
+D20221	.FILL #221
+D20222	.FILL #222
+D20223	.FILL #223
+D20224	.FILL #224
+D20225	.FILL #225
+D20226	.FILL #226
+D20227	.FILL #227
+D20228	.FILL #228
+D20229	.FILL #229
+D20230	.FILL #230
+D20231	.FILL #231
+D20232	.FILL #232
+D20233	.FILL #233
+D20234	.FILL #234
+D20235	.FILL #235
+D20236	.FILL #236
+D20237	.FILL #237
+D20238	.FILL #238
+D20239	.FILL #239
+D20240	.FILL #240
+D20241	.FILL #241
+D20242	.FILL #242
+D20243	.FILL #243
+D20244	.FILL #244
+D20245	.FILL #245
+D20246	.FILL #246
+D20247	.FILL #247
+D20248	.FILL #248
+D20249	.FILL #249
+D20250	.FILL #250
+D20251	.FILL #251
+D20252	.FILL #252
+D20253	.FILL #253
+D20254	.FILL #254
+D20255	.FILL #255
+D20256	.FILL #256
+D20257	.FILL #257
+D20258	.FILL #258
+D20259	.FILL #259
+D20260	.FILL #260
+D20261	.FILL #261
+D20262	.FILL #262
+D20263	.FILL #263
+D20264	.FILL #264
+D20265	.FILL #265
+D20266	.FILL #266
+D20267	.FILL #267
+D20268	.FILL #268
+D20269	.FILL #269
+D20270	.FILL #270
+D20271	.FILL #271
+D20272	.FILL #272
+D20273	.FILL #273
+D20274	.FILL #274
+D20275	.FILL #275
+D20276	.FILL #276
+D20277	.FILL #277
+D20278	.FILL #278
+D20279	.FILL #279
+D20280	.FILL #280
+D20281	.FILL #281
+D20282	.FILL #282
+D20283	.FILL #283
+D20284	.FILL #284
+D20285	.FILL #285
+D20286	.FILL #286
+D20287	.FILL #287
+D20288	.FILL #288
+D20289	.FILL #289
+D20290	.FILL #290
+D20291	.FILL #291
+D20292	.FILL #292
+D20293	.FILL #293
+D20294	.FILL #294
+D20295	.FILL #295
+D20296	.FILL #296
+D20297	.FILL #297
+D20298	.FILL #298
+D20299	.FILL #299
+D20300	.FILL #300
+D20301	.FILL #301
+D20302	.FILL #302
+D20303	.FILL #303
+D20304	.FILL #304
+D20305	.FILL #305
+D20306	.FILL #306
+D20307	.FILL #307
+D20308	.FILL #308
+D20309	.FILL #309
+D20310	.FILL #310
+D20311	.FILL #311
+D20312	.FILL #312
+D20313	.FILL #313
+D20314	.FILL #314
+D20315	.FILL #315
+D20316	.FILL #316
+D20317	.FILL #317
+D20318	.FILL #318
+D20319	.FILL #319
+D20320	.FILL #320
+D20321	.FILL #321
+D20322	.FILL #322
+D20323	.FILL #323
+D20324	.FILL #324
+D20325	.FILL #325
+D20326	.FILL #326
+D20327	.FILL #327
+D20328	.FILL #328
+D20329	.FILL #329
+D20330	.FILL #330
+D20331	.FILL #331
+D20332	.FILL #332
+D20333	.FILL #333
+D20334	.FILL #334
+D20335	.FILL #335
+D20336	.FILL #336
+D20337	.FILL #337
+D20338	.FILL #338
+D20339	.FILL #339
+D20340	.FILL #340
+D20341	.FILL #341
+D20342	.FILL #342
+D20343	.FILL #343
+D20344	.FILL #344
+D20345	.FILL #345
+D20346	.FILL #346
+D20347	.FILL #347
+D20348	.FILL #348
+D20349	.FILL #349
+D20350	.FILL #350
+D20351	.FILL #351
+D20352	.FILL #352
+D20353	.FILL #353
+D20354	.FILL #354
+D20355	.FILL #355
+D20356	.FILL #356
+D20357	.FILL #357
+D20358	.FILL #358
+D20359	.FILL #359
+D20360	.FILL #360
+D20361	.FILL #361
+D20362	.FILL #362
+D20363	.FILL #363
+D20364	.FILL #364
+D20365	.FILL #365
+D20366	.FILL #366
+D20367	.FILL #367
+D20368	.FILL #368
+D20369	.FILL #369
+D20370	.FILL #370
+D20371	.FILL #371
+D20372	.FILL #372
+D20373	.FILL #373
+D20374	.FILL #374
+D20375	.FILL #375
+D20376	.FILL #376
+D20377	.FILL #377
+D20378	.FILL #378
+D20379	.FILL #379
+D20380	.FILL #380
+D20381	.FILL #381
+D20382	.FILL #382
+D20383	.FILL #383
+D20384	.FILL #384
+D20385	.FILL #385
+D20386	.FILL #386
+D20387	.FILL #387
+D20388	.FILL #388
+D20389	.FILL #389
+D20390	.FILL #390
+D20391	.FILL #391
+D20392	.FILL #392
+D20393	.FILL #393
+D20394	.FILL #394
+D20395	.FILL #395
+D20396	.FILL #396
+D20397	.FILL #397
+D20398	.FILL #398
+D20399	.FILL #399
+D20400	.FILL #400
+D20401	.FILL #401
+D20402	.FILL #402
+D20403	.FILL #403
+D20404	.FILL #404
+D20405	.FILL #405
+D20406	.FILL #406
+D20407	.FILL #407
+D20408	.FILL #408
+D20409	.FILL #409
+D20410	.FILL #410
+D20411	.FILL #411
+D20412	.FILL #412
+D20413	.FILL #413
+D20414	.FILL #414
+D20415	.FILL #415
+D20416	.FILL #416
+D20417	.FILL #417
+D20418	.FILL #418
+D20419	.FILL #419
+D20420	.FILL #420
+D20421	.FILL #421
+D20422	.FILL #422
+D20423	.FILL #423
+D20424	.FILL #424
+D20425	.FILL #425
+D20426	.FILL #426
+D20427	.FILL #427
+D20428	.FILL #428
+D20429	.FILL #429
+D20430	.FILL #430
+D20431	.FILL #431
+D20432	.FILL #432
+D20433	.FILL #433
+D20434	.FILL #434
+D20435	.FILL #435
+D20436	.FILL #436
+D20437	.FILL #437
+D20438	.FILL #438
+D20439	.FILL #439
+D20440	.FILL #440
+D20441	.FILL #441
+D20442	.FILL #442
+D20443	.FILL #443
+D20444	.FILL #444
+D20445	.FILL #445
+D20446	.FILL #446
+D20447	.FILL #447
+D20448	.FILL #448
+D20449	.FILL #449
+D20450	.FILL #450
+D20451	.FILL #451
+D20452	.FILL #452
+D20453	.FILL #453
+D20454	.FILL #454
+D20455	.FILL #455
+D20456	.FILL #456
+D20457	.FILL #457
+D20458	.FILL #458
+D20459	.FILL #459
+D20460	.FILL #460
+D20461	.FILL #461
+D20462	.FILL #462
+D20463	.FILL #463
+D20464	.FILL #464
+D20465	.FILL #465
+D20466	.FILL #466
+D20467	.FILL #467
+D20468	.FILL #468
+D20469	.FILL #469
+D20470	.FILL #470
+D20471	.FILL #471
+D20472	.FILL #472
+D20473	.FILL #473
+D20474	.FILL #474
+D20475	.FILL #475
+D20476	.FILL #476
+D20477	.FILL #477
+D20478	.FILL #478
+D20479	.FILL #479
+D20480	.FILL #480
+D20481	.FILL #481
+D20482	.FILL #482
+D20483	.FILL #483
+D20484	.FILL #484
+D20485	.FILL #485
+D20486	.FILL #486
+D20487	.FILL #487
+D20488	.FILL #488
+D20489	.FILL #489
+D20490	.FILL #490
+D20491	.FILL #491
+D20492	.FILL #492
+D20493	.FILL #493
+D20494	.FILL #494
+D20495	.FILL #495
+D20496	.FILL #496
+D20497	.FILL #497
+D20498	.FILL #498
+D20499	.FILL #499
+D20500	.FILL #500
+D20501	.FILL #501
+D20502	.FILL #502
+D20503	.FILL #503
+D20504	.FILL #504
+D20505	.FILL #505
+D20506	.FILL #506
+D20507	.FILL #507
+D20508	.FILL #508
+D20509	.FILL #509
+D20510	.FILL #510
+D20511	.FILL #511
+D20512	.FILL #512
+D20513	.FILL #513
+D20514	.FILL #514
+D20515	.FILL #515
+D20516	.FILL #516
+D20517	.FILL #517
+D20518	.FILL #518
+D20519	.FILL #519
+D20520	.FILL #520
+D20521	.FILL #521
+D20522	.FILL #522
+D20523	.FILL #523
+D20524	.FILL #524
+D20525	.FILL #525
+D20526	.FILL #526
+D20527	.FILL #527
+D20528	.FILL #528
+D20529	.FILL #529
+D20530	.FILL #530
+D20531	.FILL #531
+D20532	.FILL #532
+D20533	.FILL #533
+D20534	.FILL #534
+D20535	.FILL #535
+D20536	.FILL #536
+D20537	.FILL #537
+D20538	.FILL #538
+D20539	.FILL #539
+D20540	.FILL #540
+D20541	.FILL #541
+D20542	.FILL #542
+D20543	.FILL #543
+D20544	.FILL #544
+D20545	.FILL #545
+D20546	.FILL #546
+D20547	.FILL #547
+D20548	.FILL #548
+D20549	.FILL #549
+D20550	.FILL #550
+D20551	.FILL #551
+D20552	.FILL #552
+D20553	.FILL #553
+D20554	.FILL #554
+D20555	.FILL #555
+D20556	.FILL #556
+D20557	.FILL #557
+D20558	.FILL #558
+D20559	.FILL #559
+D20560	.FILL #560
+D20561	.FILL #561
+D20562	.FILL #562
+D20563	.FILL #563
+D20564	.FILL #564
+D20565	.FILL #565
+D20566	.FILL #566
+D20567	.FILL #567
+D20568	.FILL #568
+D20569	.FILL #569
+D20570	.FILL #570
+D20571	.FILL #571
+D20572	.FILL #572
+D20573	.FILL #573
+D20574	.FILL #574
+D20575	.FILL #575
+D20576	.FILL #576
+D20577	.FILL #577
+D20578	.FILL #578
+D20579	.FILL #579
+D20580	.FILL #580
+D20581	.FILL #581
+D20582	.FILL #582
+D20583	.FILL #583
+D20584	.FILL #584
+D20585	.FILL #585
+D20586	.FILL #586
+D20587	.FILL #587
+D20588	.FILL #588
+D20589	.FILL #589
+D20590	.FILL #590
+D20591	.FILL #591
+D20592	.FILL #592
+D20593	.FILL #593
+D20594	.FILL #594
+D20595	.FILL #595
+D20596	.FILL #596
+D20597	.FILL #597
+D20598	.FILL #598
+D20599	.FILL #599
+D20600	.FILL #600
+D20601	.FILL #601
+D20602	.FILL #602
+D20603	.FILL #603
+D20604	.FILL #604
+D20605	.FILL #605
+D20606	.FILL #606
+D20607	.FILL #607
+D20608	.FILL #608
+D20609	.FILL #609
+D20610	.FILL #610
+D20611	.FILL #611
+D20612	.FILL #612
+D20613	.FILL #613
+D20614	.FILL #614
+D20615	.FILL #615
+D20616	.FILL #616
+D20617	.FILL #617
+D20618	.FILL #618
+D20619	.FILL #619
+D20620	.FILL #620
+D20621	.FILL #621
+D20622	.FILL #622
+D20623	.FILL #623
+D20624	.FILL #624
+D20625	.FILL #625
+D20626	.FILL #626
+D20627	.FILL #627
+D20628	.FILL #628
+D20629	.FILL #629
+D20630	.FILL #630
+D20631	.FILL #631
+D20632	.FILL #632
+D20633	.FILL #633
+D20634	.FILL #634
+D20635	.FILL #635
+D20636	.FILL #636
+D20637	.FILL #637
+D20638	.FILL #638
+D20639	.FILL #639
+D20640	.FILL #640
+D20641	.FILL #641
+D20642	.FILL #642
+D20643	.FILL #643
+D20644	.FILL #644
+D20645	.FILL #645
+D20646	.FILL #646
+D20647	.FILL #647
+D20648	.FILL #648
+D20649	.FILL #649
+D20650	.FILL #650
+D20651	.FILL #651
+D20652	.FILL #652
+D20653	.FILL #653
+D20654	.FILL #654
+D20655	.FILL #655
+D20656	.FILL #656
+D20657	.FILL #657
+D20658	.FILL #658
+D20659	.FILL #659
+D20660	.FILL #660
+D20661	.FILL #661
+D20662	.FILL #662
+D20663	.FILL #663
+D20664	.FILL #664
+D20665	.FILL #665
+D20666	.FILL #666
+D20667	.FILL #667
+D20668	.FILL #668
+D20669	.FILL #669
+D20670	.FILL #670
+D20671	.FILL #671
+D20672	.FILL #672
+D20673	.FILL #673
+D20674	.FILL #674
+D20675	.FILL #675
+D20676	.FILL #676
+D20677	.FILL #677
+D20678	.FILL #678
+D20679	.FILL #679
+D20680	.FILL #680
+D20681	.FILL #681
+D20682	.FILL #682
+D20683	.FILL #683
+D20684	.FILL #684
+D20685	.FILL #685
+D20686	.FILL #686
+D20687	.FILL #687
+D20688	.FILL #688
+D20689	.FILL #689
+D20690	.FILL #690
+D20691	.FILL #691
+D20692	.FILL #692
+D20693	.FILL #693
+D20694	.FILL #694
+D20695	.FILL #695
+D20696	.FILL #696
+D20697	.FILL #697
+D20698	.FILL #698
+D20699	.FILL #699
+D20700	.FILL #700
+D20701	.FILL #701
+D20702	.FILL #702
+D20703	.FILL #703
+D20704	.FILL #704
+D20705	.FILL #705
+D20706	.FILL #706
+D20707	.FILL #707
+D20708	.FILL #708
+D20709	.FILL #709
+D20710	.FILL #710
+D20711	.FILL #711
+D20712	.FILL #712
+D20713	.FILL #713
+D20714	.FILL #714
+D20715	.FILL #715
+D20716	.FILL #716
+D20717	.FILL #717
+D20718	.FILL #718
+D20719	.FILL #719
+D20720	.FILL #720
+D20721	.FILL #721
+D20722	.FILL #722
+D20723	.FILL #723
+D20724	.FILL #724
+D20725	.FILL #725
+D20726	.FILL #726
+D20727	.FILL #727
+D20728	.FILL #728
+D20729	.FILL #729
+D20730	.FILL #730
+D20731	.FILL #731
+D20732	.FILL #732
+D20733	.FILL #733
+D20734	.FILL #734
+D20735	.FILL #735
+D20736	.FILL #736
+D20737	.FILL #737
+D20738	.FILL #738
+D20739	.FILL #739
+D20740	.FILL #740
+D20741	.FILL #741
+D20742	.FILL #742
+D20743	.FILL #743
+D20744	.FILL #744
+D20745	.FILL #745
+D20746	.FILL #746
+D20747	.FILL #747
+D20748	.FILL #748
+D20749	.FILL #749
+D20750	.FILL #750
+D20751	.FILL #751
+D20752	.FILL #752
+D20753	.FILL #753
+D20754	.FILL #754
+D20755	.FILL #755
+D20756	.FILL #756
+D20757	.FILL #757
+D20758	.FILL #758
+D20759	.FILL #759
+D20760	.FILL #760
+D20761	.FILL #761
+D20762	.FILL #762
+D20763	.FILL #763
+D20764	.FILL #764
+D20765	.FILL #765
+D20766	.FILL #766
+D20767	.FILL #767
+D20768	.FILL #768
+D20769	.FILL #769
+D20770	.FILL #770
+D20771	.FILL #771
+D20772	.FILL #772
+D20773	.FILL #773
+D20774	.FILL #774
+D20775	.FILL #775
+D20776	.FILL #776
+D20777	.FILL #777
+D20778	.FILL #778
+D20779	.FILL #779
+D20780	.FILL #780
+D20781	.FILL #781
+D20782	.FILL #782
+D20783	.FILL #783
+D20784	.FILL #784
+D20785	.FILL #785
+D20786	.FILL #786
+D20787	.FILL #787
+D20788	.FILL #788
+D20789	.FILL #789
+D20790	.FILL #790
+D20791	.FILL #791
+D20792	.FILL #792
+D20793	.FILL #793
+D20794	.FILL #794
+D20795	.FILL #795
+D20796	.FILL #796
+D20797	.FILL #797
+D20798	.FILL #798
+D20799	.FILL #799
+D20800	.FILL #800
+D20801	.FILL #801
+D20802	.FILL #802
+D20803	.FILL #803
+D20804	.FILL #804
+D20805	.FILL #805
+D20806	.FILL #806
+D20807	.FILL #807
+D20808	.FILL #808
+D20809	.FILL #809
+D20810	.FILL #810
+D20811	.FILL #811
+D20812	.FILL #812
+D20813	.FILL #813
+D20814	.FILL #814
+D20815	.FILL #815
+D20816	.FILL #816
+D20817	.FILL #817
+D20818	.FILL #818
+D20819	.FILL #819
+D20820	.FILL #820
+D20821	.FILL #821
+D20822	.FILL #822
+D20823	.FILL #823
+D20824	.FILL #824
+D20825	.FILL #825
+D20826	.FILL #826
+D20827	.FILL #827
+D20828	.FILL #828
+D20829	.FILL #829
+D20830	.FILL #830
+D20831	.FILL #831
+D20832	.FILL #832
+D20833	.FILL #833
+D20834	.FILL #834
+D20835	.FILL #835
+D20836	.FILL #836
+D20837	.FILL #837
+D20838	.FILL #838
+D20839	.FILL #839
+D20840	.FILL #840
+D20841	.FILL #841
+D20842	.FILL #842
+D20843	.FILL #843
+D20844	.FILL #844
+D20845	.FILL #845
+D20846	.FILL #846
+D20847	.FILL #847
+D20848	.FILL #848
+D20849	.FILL #849
+D20850	.FILL #850
+D20851	.FILL #851
+D20852	.FILL #852
+D20853	.FILL #853
+D20854	.FILL #854
+D20855	.FILL #855
+D20856	.FILL #856
+D20857	.FILL #857
+D20858	.FILL #858
+D20859	.FILL #859
+D20860	.FILL #860
+D20861	.FILL #861
+D20862	.FILL #862
+D20863	.FILL #863
+D20864	.FILL #864
+D20865	.FILL #865
+D20866	.FILL #866
+D20867	.FILL #867
+D20868	.FILL #868
+D20869	.FILL #869
+D20870	.FILL #870
+D20871	.FILL #871
+D20872	.FILL #872
+D20873	.FILL #873
+D20874	.FILL #874
+D20875	.FILL #875
+D20876	.FILL #876
+D20877	.FILL #877
+D20878	.FILL #878
+D20879	.FILL #879
+D20880	.FILL #880
+D20881	.FILL #881
+D20882	.FILL #882
+D20883	.FILL #883
+D20884	.FILL #884
+D20885	.FILL #885
+D20886	.FILL #886
+D20887	.FILL #887
+D20888	.FILL #888
+D20889	.FILL #889
+D20890	.FILL #890
+D20891	.FILL #891
+D20892	.FILL #892
+D20893	.FILL #893
+D20894	.FILL #894
+D20895	.FILL #895
+D20896	.FILL #896
+D20897	.FILL #897
+D20898	.FILL #898
+D20899	.FILL #899
+D20900	.FILL #900
+D20901	.FILL #901
+D20902	.FILL #902
+D20903	.FILL #903
+D20904	.FILL #904
+D20905	.FILL #905
+D20906	.FILL #906
+D20907	.FILL #907
+D20908	.FILL #908
+D20909	.FILL #909
+D20910	.FILL #910
+D20911	.FILL #911
+D20912	.FILL #912
+D20913	.FILL #913
+D20914	.FILL #914
+D20915	.FILL #915
+D20916	.FILL #916
+D20917	.FILL #917
+D20918	.FILL #918
+D20919	.FILL #919
+D20920	.FILL #920
+D20921	.FILL #921
+D20922	.FILL #922
+D20923	.FILL #923
+D20924	.FILL #924
+D20925	.FILL #925
+D20926	.FILL #926
+D20927	.FILL #927
+D20928	.FILL #928
+D20929	.FILL #929
+D20930	.FILL #930
+D20931	.FILL #931
+D20932	.FILL #932
+D20933	.FILL #933
+D20934	.FILL #934
+D20935	.FILL #935
+D20936	.FILL #936
+D20937	.FILL #937
+D20938	.FILL #938
+D20939	.FILL #939
+D20940	.FILL #940
+D20941	.FILL #941
+D20942	.FILL #942
+D20943	.FILL #943
+D20944	.FILL #944
+D20945	.FILL #945
+D20946	.FILL #946
+D20947	.FILL #947
+D20948	.FILL #948
+D20949	.FILL #949
+D20950	.FILL #950
+D20951	.FILL #951
+D20952	.FILL #952
+D20953	.FILL #953
+D20954	.FILL #954
+D20955	.FILL #955
+D20956	.FILL #956
+D20957	.FILL #957
+D20958	.FILL #958
+D20959	.FILL #959
+D20960	.FILL #960
+D20961	.FILL #961
+D20962	.FILL #962
+D20963	.FILL #963
+D20964	.FILL #964
+D20965	.FILL #965
+D20966	.FILL #966
+D20967	.FILL #967
+D20968	.FILL #968
+D20969	.FILL #969
+D20970	.FILL #970
+D20971	.FILL #971
+D20972	.FILL #972
+D20973	.FILL #973
+D20974	.FILL #974
+D20975	.FILL #975
+D20976	.FILL #976
+D20977	.FILL #977
+D20978	.FILL #978
+D20979	.FILL #979
+D20980	.FILL #980
+D20981	.FILL #981
+D20982	.FILL #982
+D20983	.FILL #983
+D20984	.FILL #984
+D20985	.FILL #985
+D20986	.FILL #986
+D20987	.FILL #987
+D20988	.FILL #988
+D20989	.FILL #989
+D20990	.FILL #990
+D20991	.FILL #991
+D20992	.FILL #992
+D20993	.FILL #993
+D20994	.FILL #994
+D20995	.FILL #995
+D20996	.FILL #996
+D20997	.FILL #997
+D20998	.FILL #998
+D20999	.FILL #999
+D21000	.FILL #0
+D21001	.FILL #1
+D21002	.FILL #2
+D21003	.FILL #3
+D21004	.FILL #4
+D21005	.FILL #5
+D21006	.FILL #6
+D21007	.FILL #7
+D21008	.FILL #8
+D21009	.FILL #9
+D21010	.FILL #10
+D21011	.FILL #11
+D21012	.FILL #12
+D21013	.FILL #13
+D21014	.FILL #14
+D21015	.FILL #15
+D21016	.FILL #16
+D21017	.FILL #17
+D21018	.FILL #18
+D21019	.FILL #19
+D21020	.FILL #20
+D21021	.FILL #21
+D21022	.FILL #22
+D21023	.FILL #23
+D21024	.FILL #24
+D21025	.FILL #25
+D21026	.FILL #26
+D21027	.FILL #27
+D21028	.FILL #28
+D21029	.FILL #29
+D21030	.FILL #30
+D21031	.FILL #31
+D21032	.FILL #32
+D21033	.FILL #33
+D21034	.FILL #34
+D21035	.FILL #35
+D21036	.FILL #36
+D21037	.FILL #37
+D21038	.FILL #38
+D21039	.FILL #39
+D21040	.FILL #40
+D21041	.FILL #41
+D21042	.FILL #42
+D21043	.FILL #43
+D21044	.FILL #44
+D21045	.FILL #45
+D21046	.FILL #46
+D21047	.FILL #47
+D21048	.FILL #48
+D21049	.FILL #49
+D21050	.FILL #50
+D21051	.FILL #51
+D21052	.FILL #52
+D21053	.FILL #53
+D21054	.FILL #54
+D21055	.FILL #55
+D21056	.FILL #56
+D21057	.FILL #57
+D21058	.FILL #58
+D21059	.FILL #59
+D21060	.FILL #60
+D21061	.FILL #61
+D21062	.FILL #62
+D21063	.FILL #63
+D21064	.FILL #64
+D21065	.FILL #65
+D21066	.FILL #66
+D21067	.FILL #67
+D21068	.FILL #68
+D21069	.FILL #69
+D21070	.FILL #70
+D21071	.FILL #71
+D21072	.FILL #72
+D21073	.FILL #73
+D21074	.FILL #74
+D21075	.FILL #75
+D21076	.FILL #76
+D21077	.FILL #77
+D21078	.FILL #78
+D21079	.FILL #79
+D21080	.FILL #80
+D21081	.FILL #81
+D21082	.FILL #82
+D21083	.FILL #83
+D21084	.FILL #84
+D21085	.FILL #85
+D21086	.FILL #86
+D21087	.FILL #87
+D21088	.FILL #88
+D21089	.FILL #89
+D21090	.FILL #90
+D21091	.FILL #91
+D21092	.FILL #92
+D21093	.FILL #93
+D21094	.FILL #94
+D21095	.FILL #95
+D21096	.FILL #96
+D21097	.FILL #97
+D21098	.FILL #98
+D21099	.FILL #99
+D21100	.FILL #100
+D21101	.FILL #101
+D21102	.FILL #102
+D21103	.FILL #103
+D21104	.FILL #104
+D21105	.FILL #105
+D21106	.FILL #106
+D21107	.FILL #107
+D21108	.FILL #108
+D21109	.FILL #109
+D21110	.FILL #110
+D21111	.FILL #111
+D21112	.FILL #112
+D21113	.FILL #113
+D21114	.FILL #114
+D21115	.FILL #115
+D21116	.FILL #116
+D21117	.FILL #117
+D21118	.FILL #118
+D21119	.FILL #119
+D21120	.FILL #120
+D21121	.FILL #121
+D21122	.FILL #122
+D21123	.FILL #123
+D21124	.FILL #124
+D21125	.FILL #125
+D21126	.FILL #126
+D21127	.FILL #127
+D21128	.FILL #128
+D21129	.FILL #129
+D21130	.FILL #130
+D21131	.FILL #131
+D21132	.FILL #132
+D21133	.FILL #133
+D21134	.FILL #134
+D21135	.FILL #135
+D21136	.FILL #136
+D21137	.FILL #137
+D21138	.FILL #138
+D21139	.FILL #139
+D21140	.FILL #140
+D21141	.FILL #141
+D21142	.FILL #142
+D21143	.FILL #143
+D21144	.FILL #144
+D21145	.FILL #145
+D21146	.FILL #146
+D21147	.FILL #147
+D21148	.FILL #148
+D21149	.FILL #149
+D21150	.FILL #150
+D21151	.FILL #151
+D21152	.FILL #152
+D21153	.FILL #153
+D21154	.FILL #154
+D21155	.FILL #155
+D21156	.FILL #156
+D21157	.FILL #157
+D21158	.FILL #158
+D21159	.FILL #159
+D21160	.FILL #160
+D21161	.FILL #161
+D21162	.FILL #162
+D21163	.FILL #163
+D21164	.FILL #164
+D21165	.FILL #165
+D21166	.FILL #166
+D21167	.FILL #167
+D21168	.FILL #168
+D21169	.FILL #169
+D21170	.FILL #170
+D21171	.FILL #171
+D21172	.FILL #172
+D21173	.FILL #173
+D21174	.FILL #174
+D21175	.FILL #175
+D21176	.FILL #176
+D21177	.FILL #177
+D21178	.FILL #178
+D21179	.FILL #179
+D21180	.FILL #180
+D21181	.FILL #181
+D21182	.FILL #182
+D21183	.FILL #183
+D21184	.FILL #184
+D21185	.FILL #185
+D21186	.FILL #186
+D21187	.FILL #187
+D21188	.FILL #188
+D21189	.FILL #189
+D21190	.FILL #190
+D21191	.FILL #191
+D21192	.FILL #192
+D21193	.FILL #193
+D21194	.FILL #194
+D21195	.FILL #195
+D21196	.FILL #196
+D21197	.FILL #197
+D21198	.FILL #198
+D21199	.FILL #199
+D21200	.FILL #200
+D21201	.FILL #201
+D21202	.FILL #202
+D21203	.FILL #203
+D21204	.FILL #204
+D21205	.FILL #205
+D21206	.FILL #206
+D21207	.FILL #207
+D21208	.FILL #208
+D21209	.FILL #209
+D21210	.FILL #210
+D21211	.FILL #211
+D21212	.FILL #212
+D21213	.FILL #213
+D21214	.FILL #214
+D21215	.FILL #215
+D21216	.FILL #216
+D21217	.FILL #217
+D21218	.FILL #218
+D21219	.FILL #219
+D21220	.FILL #220
+D21221	.FILL #221
+D21222	.FILL #222
+D21223	.FILL #223
+D21224	.FILL #224
+D21225	.FILL #225
+D21226	.FILL #226
+D21227	.FILL #227
+D21228	.FILL #228
+D21229	.FILL #229
+D21230	.FILL #230
+D21231	.FILL #231
+D21232	.FILL #232
+D21233	.FILL #233
+D21234	.FILL #234
+D21235	.FILL #235
+D21236	.FILL #236
+D21237	.FILL #237
+D21238	.FILL #238
+D21239	.FILL #239
+D21240	.FILL #240
+D21241	.FILL #241
+D21242	.FILL #242
+D21243	.FILL #243
+D21244	.FILL #244
+D21245	.FILL #245
+D21246	.FILL #246
+D21247	.FILL #247
+D21248	.FILL #248
+D21249	.FILL #249
+D21250	.FILL #250
+D21251	.FILL #251
+D21252	.FILL #252
+D21253	.FILL #253
+D21254	.FILL #254
+D21255	.FILL #255
+D21256	.FILL #256
+D21257	.FILL #257
+D21258	.FILL #258
+D21259	.FILL #259
+D21260	.FILL #260
+D21261	.FILL #261
+D21262	.FILL #262
+D21263	.FILL #263
+D21264	.FILL #264
+D21265	.FILL #265
+D21266	.FILL #266
+D21267	.FILL #267
+D21268	.FILL #268
+D21269	.FILL #269
+D21270	.FILL #270
+D21271	.FILL #271
+D21272	.FILL #272
+D21273	.FILL #273
+D21274	.FILL #274
+D21275	.FILL #275
+D21276	.FILL #276
+D21277	.FILL #277
+D21278	.FILL #278
+D21279	.FILL #279
+D21280	.FILL #280
+D21281	.FILL #281
+D21282	.FILL #282
+D21283	.FILL #283
+D21284	.FILL #284
+D21285	.FILL #285
+D21286	.FILL #286
+D21287	.FILL #287
+D21288	.FILL #288
+D21289	.FILL #289
+D21290	.FILL #290
+D21291	.FILL #291
+D21292	.FILL #292
+D21293	.FILL #293
+D21294	.FILL #294
+D21295	.FILL #295
+D21296	.FILL #296
+D21297	.FILL #297
+D21298	.FILL #298
+D21299	.FILL #299
+D21300	.FILL #300
+D21301	.FILL #301
+D21302	.FILL #302
+D21303	.FILL #303
+D21304	.FILL #304
+D21305	.FILL #305
+D21306	.FILL #306
+D21307	.FILL #307
+D21308	.FILL #308
+D21309	.FILL #309
+D21310	.FILL #310
+D21311	.FILL #311
+D21312	.FILL #312
+D21313	.FILL #313
+D21314	.FILL #314
+D21315	.FILL #315
+D21316	.FILL #316
+D21317	.FILL #317
+D21318	.FILL #318
+D21319	.FILL #319
+D21320	.FILL #320
+D21321	.FILL #321
+D21322	.FILL #322
+D21323	.FILL #323
+D21324	.FILL #324
+D21325	.FILL #325
+D21326	.FILL #326
+D21327	.FILL #327
+D21328	.FILL #328
+D21329	.FILL #329
+D21330	.FILL #330
+D21331	.FILL #331
+D21332	.FILL #332
+D21333	.FILL #333
+D21334	.FILL #334
+D21335	.FILL #335
+D21336	.FILL #336
+D21337	.FILL #337
+D21338	.FILL #338
+D21339	.FILL #339
+D21340	.FILL #340
+D21341	.FILL #341
+D21342	.FILL #342
+D21343	.FILL #343
+D21344	.FILL #344
+D21345	.FILL #345
+D21346	.FILL #346
+D21347	.FILL #347
+D21348	.FILL #348
+D21349	.FILL #349
+D21350	.FILL #350
+D21351	.FILL #351
+D21352	.FILL #352
+D21353	.FILL #353
+D21354	.FILL #354
+D21355	.FILL #355
+D21356	.FILL #356
+D21357	.FILL #357
+D21358	.FILL #358
+D21359	.FILL #359
+D21360	.FILL #360
+D21361	.FILL #361
+D21362	.FILL #362
+D21363	.FILL #363
+D21364	.FILL #364
+D21365	.FILL #365
+D21366	.FILL #366
+D21367	.FILL #367
+D21368	.FILL #368
+D21369	.FILL #369
+D21370	.FILL #370
+D21371	.FILL #371
+D21372	.FILL #372
+D21373	.FILL #373
+D21374	.FILL #374
+D21375	.FILL #375
+D21376	.FILL #376
+D21377	.FILL #377
+D21378	.FILL #378
+D21379	.FILL #379
+D21380	.FILL #380
+D21381	.FILL #381
+D21382	.FILL #382
+D21383	.FILL #383
+D21384	.FILL #384
+D21385	.FILL #385
+D21386	.FILL #386
+D21387	.FILL #387
+D21388	.FILL #388
+D21389	.FILL #389
+D21390	.FILL #390
+D21391	.FILL #391
+D21392	.FILL #392
+D21393	.FILL #393
+D21394	.FILL #394
+D21395	.FILL #395
+D21396	.FILL #396
+D21397	.FILL #397
+D21398	.FILL #398
+D21399	.FILL #399
+D21400	.FILL #400
+D21401	.FILL #401
+D21402	.FILL #402
+D21403	.FILL #403
+D21404	.FILL #404
+D21405	.FILL #405
+D21406	.FILL #406
+D21407	.FILL #407
+D21408	.FILL #408
+D21409	.FILL #409
+D21410	.FILL #410
+D21411	.FILL #411
+D21412	.FILL #412
+D21413	.FILL #413
+D21414	.FILL #414
+D21415	.FILL #415
+D21416	.FILL #416
+D21417	.FILL #417
+D21418	.FILL #418
+D21419	.FILL #419
+D21420	.FILL #420
+D21421	.FILL #421
+D21422	.FILL #422
+D21423	.FILL #423
+D21424	.FILL #424
+D21425	.FILL #425
+D21426	.FILL #426
+D21427	.FILL #427
+D21428	.FILL #428
+D21429	.FILL #429
+D21430	.FILL #430
+D21431	.FILL #431
+D21432	.FILL #432
+D21433	.FILL #433
+D21434	.FILL #434
+D21435	.FILL #435
+D21436	.FILL #436
+D21437	.FILL #437
+D21438	.FILL #438
+D21439	.FILL #439
+D21440	.FILL #440
+D21441	.FILL #441
+D21442	.FILL #442
+D21443	.FILL #443
+D21444	.FILL #444
+D21445	.FILL #445
+D21446	.FILL #446
+D21447	.FILL #447
+D21448	.FILL #448
+D21449	.FILL #449
+D21450	.FILL #450
+D21451	.FILL #451
+D21452	.FILL #452
+D21453	.FILL #453
+D21454	.FILL #454
+D21455	.FILL #455
+D21456	.FILL #456
+D21457	.FILL #457
+D21458	.FILL #458
+D21459	.FILL #459
+D21460	.FILL #460
+D21461	.FILL #461
+D21462	.FILL #462
+D21463	.FILL #463
+D21464	.FILL #464
+D21465	.FILL #465
+D21466	.FILL #466
+D21467	.FILL #467
+D21468	.FILL #468
+D21469	.FILL #469
+D21470	.FILL #470
+D21471	.FILL #471
+D21472	.FILL #472
+D21473	.FILL #473
+D21474	.FILL #474
+D21475	.FILL #475
+D21476	.FILL #476
+D21477	.FILL #477
+D21478	.FILL #478
+D21479	.FILL #479
+D21480	.FILL #480
+D21481	.FILL #481
+D21482	.FILL #482
+D21483	.FILL #483
+D21484	.FILL #484
+D21485	.FILL #485
+D21486	.FILL #486
+D21487	.FILL #487
+D21488	.FILL #488
+D21489	.FILL #489
+D21490	.FILL #490
+D21491	.FILL #491
+D21492	.FILL #492
+D21493	.FILL #493
+D21494	.FILL #494
+D21495	.FILL #495
+D21496	.FILL #496
+D21497	.FILL #497
+D21498	.FILL #498
+D21499	.FILL #499
+D21500	.FILL #500
+D21501	.FILL #501
+D21502	.FILL #502
+D21503	.FILL #503
+D21504	.FILL #504
+D21505	.FILL #505
+D21506	.FILL #506
+D21507	.FILL #507
+D21508	.FILL #508
+D21509	.FILL #509
+D21510	.FILL #510
+D21511	.FILL #511
+D21512	.FILL #512
+D21513	.FILL #513
+D21514	.FILL #514
+D21515	.FILL #515
+D21516	.FILL #516
+D21517	.FILL #517
+D21518	.FILL #518
+D21519	.FILL #519
+D21520	.FILL #520
+D21521	.FILL #521
+D21522	.FILL #522
+D21523	.FILL #523
+D21524	.FILL #524
+D21525	.FILL #525
+D21526	.FILL #526
+D21527	.FILL #527
+D21528	.FILL #528
+D21529	.FILL #529
+D21530	.FILL #530
+D21531	.FILL #531
+D21532	.FILL #532
+D21533	.FILL #533
+D21534	.FILL #534
+D21535	.FILL #535
+D21536	.FILL #536
+D21537	.FILL #537
+D21538	.FILL #538
+D21539	.FILL #539
+D21540	.FILL #540
+D21541	.FILL #541
+D21542	.FILL #542
+D21543	.FILL #543
+D21544	.FILL #544
+D21545	.FILL #545
+D21546	.FILL #546
+D21547	.FILL #547
+D21548	.FILL #548
+D21549	.FILL #549
+D21550	.FILL #550
+D21551	.FILL #551
+D21552	.FILL #552
+D21553	.FILL #553
+D21554	.FILL #554
+D21555	.FILL #555
+D21556	.FILL #556
+D21557	.FILL #557
+D21558	.FILL #558
+D21559	.FILL #559
+D21560	.FILL #560
+D21561	.FILL #561
+D21562	.FILL #562
+D21563	.FILL #563
+D21564	.FILL #564
+D21565	.FILL #565
+D21566	.FILL #566
+D21567	.FILL #567
+D21568	.FILL #568
+D21569	.FILL #569
+D21570	.FILL #570
+D21571	.FILL #571
+D21572	.FILL #572
+D21573	.FILL #573
+D21574	.FILL #574
+D21575	.FILL #575
+D21576	.FILL #576
+D21577	.FILL #577
+D21578	.FILL #578
+D21579	.FILL #579
+D21580	.FILL #580
+D21581	.FILL #581
+D21582	.FILL #582
+D21583	.FILL #583
+D21584	.FILL #584
+D21585	.FILL #585
+D21586	.FILL #586
+D21587	.FILL #587
+D21588	.FILL #588
+D21589	.FILL #589
+D21590	.FILL #590
+D21591	.FILL #591
+D21592	.FILL #592
+D21593	.FILL #593
+D21594	.FILL #594
+D21595	.FILL #595
+D21596	.FILL #596
+D21597	.FILL #597
+D21598	.FILL #598
+D21599	.FILL #599
+D21600	.FILL #600
+D21601	.FILL #601
+D21602	.FILL #602
+D21603	.FILL #603
+D21604	.FILL #604
+D21605	.FILL #605
+D21606	.FILL #606
+D21607	.FILL #607
+D21608	.FILL #608
+D21609	.FILL #609
+D21610	.FILL #610
+D21611	.FILL #611
+D21612	.FILL #612
+D21613	.FILL #613
+D21614	.FILL #614
+D21615	.FILL #615
+D21616	.FILL #616
+D21617	.FILL #617
+D21618	.FILL #618
+D21619	.FILL #619
+D21620	.FILL #620
+D21621	.FILL #621
+D21622	.FILL #622
+D21623	.FILL #623
+D21624	.FILL #624
+D21625	.FILL #625
+D21626	.FILL #626
+D21627	.FILL #627
+D21628	.FILL #628
+D21629	.FILL #629
+D21630	.FILL #630
+D21631	.FILL #631
+D21632	.FILL #632
+D21633	.FILL #633
+D21634	.FILL #634
+D21635	.FILL #635
+D21636	.FILL #636
+D21637	.FILL #637
+D21638	.FILL #638
+D21639	.FILL #639
+D21640	.FILL #640
+D21641	.FILL #641
+D21642	.FILL #642
+D21643	.FILL #643
+D21644	.FILL #644
+D21645	.FILL #645
+D21646	.FILL #646
+D21647	.FILL #647
+D21648	.FILL #648
+D21649	.FILL #649
+D21650	.FILL #650
+D21651	.FILL #651
+D21652	.FILL #652
+D21653	.FILL #653
+D21654	.FILL #654
+D21655	.FILL #655
+D21656	.FILL #656
+D21657	.FILL #657
+D21658	.FILL #658
+D21659	.FILL #659
+D21660	.FILL #660
+D21661	.FILL #661
+D21662	.FILL #662
+D21663	.FILL #663
+D21664	.FILL #664
+D21665	.FILL #665
+D21666	.FILL #666
+D21667	.FILL #667
+D21668	.FILL #668
+D21669	.FILL #669
+D21670	.FILL #670
+D21671	.FILL #671
+D21672	.FILL #672
+D21673	.FILL #673
+D21674	.FILL #674
+D21675	.FILL #675
+D21676	.FILL #676
+D21677	.FILL #677
+D21678	.FILL #678
+D21679	.FILL #679
+D21680	.FILL #680
+D21681	.FILL #681
+D21682	.FILL #682
+D21683	.FILL #683
+D21684	.FILL #684
+D21685	.FILL #685
+D21686	.FILL #686
+D21687	.FILL #687
+D21688	.FILL #688
+D21689	.FILL #689
+D21690	.FILL #690
+D21691	.FILL #691
+D21692	.FILL #692
+D21693	.FILL #693
+D21694	.FILL #694
+D21695	.FILL #695
+D21696	.FILL #696
+D21697	.FILL #697
+D21698	.FILL #698
+D21699	.FILL #699
+D21700	.FILL #700
+D21701	.FILL #701
+D21702	.FILL #702
+D21703	.FILL #703
+D21704	.FILL #704
+D21705	.FILL #705
+D21706	.FILL #706
+D21707	.FILL #707
+D21708	.FILL #708
+D21709	.FILL #709
+D21710	.FILL #710
+D21711	.FILL #711
+D21712	.FILL #712
+D21713	.FILL #713
+D21714	.FILL #714
+D21715	.FILL #715
+D21716	.FILL #716
+D21717	.FILL #717
+D21718	.FILL #718
+D21719	.FILL #719
+D21720	.FILL #720
+D21721	.FILL #721
+D21722	.FILL #722
+D21723	.FILL #723
+D21724	.FILL #724
+D21725	.FILL #725
+D21726	.FILL #726
+D21727	.FILL #727
+D21728	.FILL #728
+D21729	.FILL #729
+D21730	.FILL #730
+D21731	.FILL #731
+D21732	.FILL #732
+D21733	.FILL #733
+D21734	.FILL #734
+D21735	.FILL #735
+D21736	.FILL #736
+D21737	.FILL #737
+D21738	.FILL #738
+D21739	.FILL #739
+D21740	.FILL #740
+D21741	.FILL #741
+D21742	.FILL #742
+D21743	.FILL #743
+D21744	.FILL #744
+D21745	.FILL #745
+D21746	.FILL #746
+D21747	.FILL #747
+D21748	.FILL #748
+D21749	.FILL #749
+D21750	.FILL #750
+D21751	.FILL #751
+D21752	.FILL #752
+D21753	.FILL #753
+D21754	.FILL #754
+D21755	.FILL #755
+D21756	.FILL #756
+D21757	.FILL #757
+D21758	.FILL #758
+D21759	.FILL #759
+D21760	.FILL #760
+D21761	.FILL #761
+D21762	.FILL #762
+D21763	.FILL #763
+D21764	.FILL #764
+D21765	.FILL #765
+D21766	.FILL #766
+D21767	.FILL #767
+D21768	.FILL #768
+D21769	.FILL #769
+D21770	.FILL #770
+D21771	.FILL #771
+D21772	.FILL #772
+D21773	.FILL #773
+D21774	.FILL #774
+D21775	.FILL #775
+D21776	.FILL #776
+D21777	.FILL #777
+D21778	.FILL #778
+D21779	.FILL #779
+D21780	.FILL #780
+D21781	.FILL #781
+D21782	.FILL #782
+D21783	.FILL #783
+D21784	.FILL #784
+D21785	.FILL #785
+D21786	.FILL #786
+D21787	.FILL #787
+D21788	.FILL #788
+D21789	.FILL #789
+D21790	.FILL #790
+D21791	.FILL #791
+D21792	.FILL #792
+D21793	.FILL #793
+D21794	.FILL #794
+D21795	.FILL #795
+D21796	.FILL #796
+D21797	.FILL #797
+D21798	.FILL #798
+D21799	.FILL #799
+D21800	.FILL #800
+D21801	.FILL #801
+D21802	.FILL #802
+D21803	.FILL #803
+D21804	.FILL #804
+D21805	.FILL #805
+D21806	.FILL #806
+D21807	.FILL #807
+D21808	.FILL #808
+D21809	.FILL #809
+D21810	.FILL #810
+D21811	.FILL #811
+D21812	.FILL #812
+D21813	.FILL #813
+D21814	.FILL #814
+D21815	.FILL #815
+D21816	.FILL #816
+D21817	.FILL #817
+D21818	.FILL #818
+D21819	.FILL #819
+D21820	.FILL #820
+D21821	.FILL #821
+D21822	.FILL #822
+D21823	.FILL #823
+D21824	.FILL #824
+D21825	.FILL #825
+D21826	.FILL #826
+D21827	.FILL #827
+D21828	.FILL #828
+D21829	.FILL #829
+D21830	.FILL #830
+D21831	.FILL #831
+D21832	.FILL #832
+D21833	.FILL #833
+D21834	.FILL #834
+D21835	.FILL #835
+D21836	.FILL #836
+D21837	.FILL #837
+D21838	.FILL #838
+D21839	.FILL #839
+D21840	.FILL #840
+D21841	.FILL #841
+D21842	.FILL #842
+D21843	.FILL #843
+D21844	.FILL #844
+D21845	.FILL #845
+D21846	.FILL #846
+D21847	.FILL #847
+D21848	.FILL #848
+D21849	.FILL #849
+D21850	.FILL #850
+D21851	.FILL #851
+D21852	.FILL #852
+D21853	.FILL #853
+D21854	.FILL #854
+D21855	.FILL #855
+D21856	.FILL #856
+D21857	.FILL #857
+D21858	.FILL #858
+D21859	.FILL #859
+D21860	.FILL #860
+D21861	.FILL #861
+D21862	.FILL #862
+D21863	.FILL #863
+D21864	.FILL #864
+D21865	.FILL #865
+D21866	.FILL #866
+D21867	.FILL #867
+D21868	.FILL #868
+D21869	.FILL #869
+D21870	.FILL #870
+D21871	.FILL #871
+D21872	.FILL #872
+D21873	.FILL #873
+D21874	.FILL #874
+D21875	.FILL #875
+D21876	.FILL #876
+D21877	.FILL #877
+D21878	.FILL #878
+D21879	.FILL #879
+D21880	.FILL #880
+D21881	.FILL #881
+D21882	.FILL #882
+D21883	.FILL #883
+D21884	.FILL #884
+D21885	.FILL #885
+D21886	.FILL #886
+D21887	.FILL #887
+D21888	.FILL #888
+D21889	.FILL #889
+D21890	.FILL #890
+D21891	.FILL #891
+D21892	.FILL #892
+D21893	.FILL #893
+D21894	.FILL #894
+D21895	.FILL #895
+D21896	.FILL #896
+D21897	.FILL #897
+D21898	.FILL #898
+D21899	.FILL #899
+D21900	.FILL #900
+D21901	.FILL #901
+D21902	.FILL #902
+D21903	.FILL #903
+D21904	.FILL #904
+D21905	.FILL #905
+D21906	.FILL #906
+D21907	.FILL #907
+D21908	.FILL #908
+D21909	.FILL #909
+D21910	.FILL #910
+D21911	.FILL #911
+D21912	.FILL #912
+D21913	.FILL #913
+D21914	.FILL #914
+D21915	.FILL #915
+D21916	.FILL #916
+D21917	.FILL #917
+D21918	.FILL #918
+D21919	.FILL #919
+D21920	.FILL #920
+D21921	.FILL #921
+D21922	.FILL #922
+D21923	.FILL #923
+D21924	.FILL #924
+D21925	.FILL #925
+D21926	.FILL #926
+D21927	.FILL #927
+D21928	.FILL #928
+D21929	.FILL #929
+D21930	.FILL #930
+D21931	.FILL #931
+D21932	.FILL #932
+D21933	.FILL #933
+D21934	.FILL #934
+D21935	.FILL #935
+D21936	.FILL #936
+D21937	.FILL #937
+D21938	.FILL #938
+D21939	.FILL #939
+D21940	.FILL #940
+D21941	.FILL #941
+D21942	.FILL #942
+D21943	.FILL #943
+D21944	.FILL #944
+D21945	.FILL #945
+D21946	.FILL #946
+D21947	.FILL #947
+D21948	.FILL #948
+D21949	.FILL #949
+D21950	.FILL #950
+D21951	.FILL #951
+D21952	.FILL #952
+D21953	.FILL #953
+D21954	.FILL #954
+D21955	.FILL #955
+D21956	.FILL #956
+D21957	.FILL #957
+D21958	.FILL #958
+D21959	.FILL #959
+D21960	.FILL #960
+D21961	.FILL #961
+D21962	.FILL #962
+D21963	.FILL #963
+D21964	.FILL #964
+D21965	.FILL #965
+D21966	.FILL #966
+D21967	.FILL #967
+D21968	.FILL #968
+D21969	.FILL #969
+D21970	.FILL #970
+D21971	.FILL #971
+D21972	.FILL #972
+D21973	.FILL #973
+D21974	.FILL #974
+D21975	.FILL #975
+D21976	.FILL #976
+D21977	.FILL #977
+D21978	.FILL #978
+D21979	.FILL #979
+D21980	.FILL #980
+D21981	.FILL #981
+D21982	.FILL #982
+D21983	.FILL #983
+D21984	.FILL #984
+D21985	.FILL #985
+D21986	.FILL #986
+D21987	.FILL #987
+D21988	.FILL #988
+D21989	.FILL #989
+D21990	.FILL #990
+D21991	.FILL #991
+D21992	.FILL #992
+D21993	.FILL #993
+D21994	.FILL #994
+D21995	.FILL #995
+D21996	.FILL #996
+D21997	.FILL #997
+D21998	.FILL #998
+D21999	.FILL #999
+D22000	.FILL #0
+D22001	.FILL #1
+D22002	.FILL #2
+D22003	.FILL #3
+D22004	.FILL #4
+D22005	.FILL #5
+D22006	.FILL #6
+D22007	.FILL #7
+D22008	.FILL #8
+D22009	.FILL #9
+D22010	.FILL #10
+D22011	.FILL #11
+D22012	.FILL #12
+D22013	.FILL #13
+D22014	.FILL #14
+D22015	.FILL #15
+D22016	.FILL #16
+D22017	.FILL #17
+D22018	.FILL #18
+D22019	.FILL #19
+D22020	.FILL #20
+D22021	.FILL #21
+D22022	.FILL #22
+D22023	.FILL #23
+D22024	.FILL #24
+D22025	.FILL #25
+D22026	.FILL #26
+D22027	.FILL #27
+D22028	.FILL #28
+D22029	.FILL #29
+D22030	.FILL #30
+D22031	.FILL #31
+D22032	.FILL #32
+D22033	.FILL #33
+D22034	.FILL #34
+D22035	.FILL #35
+D22036	.FILL #36
+D22037	.FILL #37
+D22038	.FILL #38
+D22039	.FILL #39
+D22040	.FILL #40
+D22041	.FILL #41
+D22042	.FILL #42
+D22043	.FILL #43
+D22044	.FILL #44
+D22045	.FILL #45
+D22046	.FILL #46
+D22047	.FILL #47
+D22048	.FILL #48
+D22049	.FILL #49
+D22050	.FILL #50
+D22051	.FILL #51
+D22052	.FILL #52
+D22053	.FILL #53
+D22054	.FILL #54
+D22055	.FILL #55
+D22056	.FILL #56
+D22057	.FILL #57
+D22058	.FILL #58
+D22059	.FILL #59
+D22060	.FILL #60
+D22061	.FILL #61
+D22062	.FILL #62
+D22063	.FILL #63
+D22064	.FILL #64
+D22065	.FILL #65
+D22066	.FILL #66
+D22067	.FILL #67
+D22068	.FILL #68
+D22069	.FILL #69
+D22070	.FILL #70
+D22071	.FILL #71
+D22072	.FILL #72
+D22073	.FILL #73
+D22074	.FILL #74
+D22075	.FILL #75
+D22076	.FILL #76
+D22077	.FILL #77
+D22078	.FILL #78
+D22079	.FILL #79
+D22080	.FILL #80
+D22081	.FILL #81
+D22082	.FILL #82
+D22083	.FILL #83
+D22084	.FILL #84
+D22085	.FILL #85
+D22086	.FILL #86
+D22087	.FILL #87
+D22088	.FILL #88
+D22089	.FILL #89
+D22090	.FILL #90
+D22091	.FILL #91
+D22092	.FILL #92
+D22093	.FILL #93
+D22094	.FILL #94
+D22095	.FILL #95
+D22096	.FILL #96
+D22097	.FILL #97
+D22098	.FILL #98
+D22099	.FILL #99
+D22100	.FILL #100
+D22101	.FILL #101
+D22102	.FILL #102
+D22103	.FILL #103
+D22104	.FILL #104
+D22105	.FILL #105
+D22106	.FILL #106
+D22107	.FILL #107
+D22108	.FILL #108
+D22109	.FILL #109
+D22110	.FILL #110
+D22111	.FILL #111
+D22112	.FILL #112
+D22113	.FILL #113
+D22114	.FILL #114
+D22115	.FILL #115
+D22116	.FILL #116
+D22117	.FILL #117
+D22118	.FILL #118
+D22119	.FILL #119
+D22120	.FILL #120
+D22121	.FILL #121
+D22122	.FILL #122
+D22123	.FILL #123
+D22124	.FILL #124
+D22125	.FILL #125
+D22126	.FILL #126
+D22127	.FILL #127
+D22128	.FILL #128
+D22129	.FILL #129
+D22130	.FILL #130
+D22131	.FILL #131
+D22132	.FILL #132
+D22133	.FILL #133
+D22134	.FILL #134
+D22135	.FILL #135
+D22136	.FILL #136
+D22137	.FILL #137
+D22138	.FILL #138
+D22139	.FILL #139
+D22140	.FILL #140
+D22141	.FILL #141
+D22142	.FILL #142
+D22143	.FILL #143
+D22144	.FILL #144
+D22145	.FILL #145
+D22146	.FILL #146
+D22147	.FILL #147
+D22148	.FILL #148
+D22149	.FILL #149
+D22150	.FILL #150
+D22151	.FILL #151
+D22152	.FILL #152
+D22153	.FILL #153
+D22154	.FILL #154
+D22155	.FILL #155
+D22156	.FILL #156
+D22157	.FILL #157
+D22158	.FILL #158
+D22159	.FILL #159
+D22160	.FILL #160
+D22161	.FILL #161
+D22162	.FILL #162
+D22163	.FILL #163
+D22164	.FILL #164
+D22165	.FILL #165
+D22166	.FILL #166
+D22167	.FILL #167
+D22168	.FILL #168
+D22169	.FILL #169
+D22170	.FILL #170
+D22171	.FILL #171
+D22172	.FILL #172
+D22173	.FILL #173
+D22174	.FILL #174
+D22175	.FILL #175
+D22176	.FILL #176
+D22177	.FILL #177
+D22178	.FILL #178
+D22179	.FILL #179
+D22180	.FILL #180
+D22181	.FILL #181
+D22182	.FILL #182
+D22183	.FILL #183
+D22184	.FILL #184
+D22185	.FILL #185
+D22186	.FILL #186
+D22187	.FILL #187
+D22188	.FILL #188
+D22189	.FILL #189
+D22190	.FILL #190
+D22191	.FILL #191
+D22192	.FILL #192
+D22193	.FILL #193
+D22194	.FILL #194
+D22195	.FILL #195
+D22196	.FILL #196
+D22197	.FILL #197
+D22198	.FILL #198
+D22199	.FILL #199
+D22200	.FILL #200
+D22201	.FILL #201
+D22202	.FILL #202
+D22203	.FILL #203
+D22204	.FILL #204
+D22205	.FILL #205
+D22206	.FILL #206
+D22207	.FILL #207
+D22208	.FILL #208
+D22209	.FILL #209
+D22210	.FILL #210
+D22211	.FILL #211
+D22212	.FILL #212
+D22213	.FILL #213
+D22214	.FILL #214
+D22215	.FILL #215
+D22216	.FILL #216
+D22217	.FILL #217
+D22218	.FILL #218
+D22219	.FILL #219
+D22220	.FILL #220
+D22221	.FILL #221
+D22222	.FILL #222
+D22223	.FILL #223
+D22224	.FILL #224
+D22225	.FILL #225
+D22226	.FILL #226
+D22227	.FILL #227
+D22228	.FILL #228
+D22229	.FILL #229
+D22230	.FILL #230
+D22231	.FILL #231
+D22232	.FILL #232
+D22233	.FILL #233
+D22234	.FILL #234
+D22235	.FILL #235
+D22236	.FILL #236
+D22237	.FILL #237
+D22238	.FILL #238
+D22239	.FILL #239
+D22240	.FILL #240
+D22241	.FILL #241
+D22242	.FILL #242
+D22243	.FILL #243
+D22244	.FILL #244
+D22245	.FILL #245
+D22246	.FILL #246
+D22247	.FILL #247
+D22248	.FILL #248
+D22249	.FILL #249
+D22250	.FILL #250
+D22251	.FILL #251
+D22252	.FILL #252
+D22253	.FILL #253
+D22254	.FILL #254
+D22255	.FILL #255
+D22256	.FILL #256
+D22257	.FILL #257
+D22258	.FILL #258
+D22259	.FILL #259
+D22260	.FILL #260
+D22261	.FILL #261
+D22262	.FILL #262
+D22263	.FILL #263
+D22264	.FILL #264
+D22265	.FILL #265
+D22266	.FILL #266
+D22267	.FILL #267
+D22268	.FILL #268
+D22269	.FILL #269
+D22270	.FILL #270
+D22271	.FILL #271
+D22272	.FILL #272
+D22273	.FILL #273
+D22274	.FILL #274
+D22275	.FILL #275
+D22276	.FILL #276
+D22277	.FILL #277
+D22278	.FILL #278
+D22279	.FILL #279
+D22280	.FILL #280
+D22281	.FILL #281
+D22282	.FILL #282
+D22283	.FILL #283
+D22284	.FILL #284
+D22285	.FILL #285
+D22286	.FILL #286
+D22287	.FILL #287
+D22288	.FILL #288
+D22289	.FILL #289
+D22290	.FILL #290
+D22291	.FILL #291
+D22292	.FILL #292
+D22293	.FILL #293
+D22294	.FILL #294
+D22295	.FILL #295
+D22296	.FILL #296
+D22297	.FILL #297
+D22298	.FILL #298
+D22299	.FILL #299
+D22300	.FILL #300
+D22301	.FILL #301
+D22302	.FILL #302
+D22303	.FILL #303
+D22304	.FILL #304
+D22305	.FILL #305
+D22306	.FILL #306
+D22307	.FILL #307
+D22308	.FILL #308
+D22309	.FILL #309
+D22310	.FILL #310
+D22311	.FILL #311
+D22312	.FILL #312
+D22313	.FILL #313
+D22314	.FILL #314
+D22315	.FILL #315
+D22316	.FILL #316
+D22317	.FILL #317
+D22318	.FILL #318
+D22319	.FILL #319
+D22320	.FILL #320
+D22321	.FILL #321
+D22322	.FILL #322
+D22323	.FILL #323
+D22324	.FILL #324
+D22325	.FILL #325
+D22326	.FILL #326
+D22327	.FILL #327
+D22328	.FILL #328
+D22329	.FILL #329
+D22330	.FILL #330
+D22331	.FILL #331
+D22332	.FILL #332
+D22333	.FILL #333
+D22334	.FILL #334
+D22335	.FILL #335
+D22336	.FILL #336
+D22337	.FILL #337
+D22338	.FILL #338
+D22339	.FILL #339
+D22340	.FILL #340
+D22341	.FILL #341
+D22342	.FILL #342
+D22343	.FILL #343
+D22344	.FILL #344
+D22345	.FILL #345
+D22346	.FILL #346
+D22347	.FILL #347
+D22348	.FILL #348
+D22349	.FILL #349
+D22350	.FILL #350
+D22351	.FILL #351
+D22352	.FILL #352
+D22353	.FILL #353
+D22354	.FILL #354
+D22355	.FILL #355
+D22356	.FILL #356
+D22357	.FILL #357
+D22358	.FILL #358
+D22359	.FILL #359
+D22360	.FILL #360
+D22361	.FILL #361
+D22362	.FILL #362
+D22363	.FILL #363
+D22364	.FILL #364
+D22365	.FILL #365
+D22366	.FILL #366
+D22367	.FILL #367
+D22368	.FILL #368
+D22369	.FILL #369
+D22370	.FILL #370
+D22371	.FILL #371
+D22372	.FILL #372
+D22373	.FILL #373
+D22374	.FILL #374
+D22375	.FILL #375
+D22376	.FILL #376
+D22377	.FILL #377
+D22378	.FILL #378
+D22379	.FILL #379
+D22380	.FILL #380
+D22381	.FILL #381
+D22382	.FILL #382
+D22383	.FILL #383
+D22384	.FILL #384
+D22385	.FILL #385
+D22386	.FILL #386
+D22387	.FILL #387
+D22388	.FILL #388
+D22389	.FILL #389
+D22390	.FILL #390
+D22391	.FILL #391
+D22392	.FILL #392
+D22393	.FILL #393
+D22394	.FILL #394
+D22395	.FILL #395
+D22396	.FILL #396
+D22397	.FILL #397
+D22398	.FILL #398
+D22399	.FILL #399
+D22400	.FILL #400
+D22401	.FILL #401
+D22402	.FILL #402
+D22403	.FILL #403
+D22404	.FILL #404
+D22405	.FILL #405
+D22406	.FILL #406
+D22407	.FILL #407
+D22408	.FILL #408
+D22409	.FILL #409
+D22410	.FILL #410
+D22411	.FILL #411
+D22412	.FILL #412
+D22413	.FILL #413
+D22414	.FILL #414
+D22415	.FILL #415
+D22416	.FILL #416
+D22417	.FILL #417
+D22418	.FILL #418
+D22419	.FILL #419
+D22420	.FILL #420
+D22421	.FILL #421
+D22422	.FILL #422
+D22423	.FILL #423
+D22424	.FILL #424
+D22425	.FILL #425
+D22426	.FILL #426
+D22427	.FILL #427
+D22428	.FILL #428
+D22429	.FILL #429
+D22430	.FILL #430
+D22431	.FILL #431
+D22432	.FILL #432
+D22433	.FILL #433
+D22434	.FILL #434
+D22435	.FILL #435
+D22436	.FILL #436
+D22437	.FILL #437
+D22438	.FILL #438
+D22439	.FILL #439
+D22440	.FILL #440
+D22441	.FILL #441
+D22442	.FILL #442
+D22443	.FILL #443
+D22444	.FILL #444
+D22445	.FILL #445
+D22446	.FILL #446
+D22447	.FILL #447
+D22448	.FILL #448
+D22449	.FILL #449
+D22450	.FILL #450
+D22451	.FILL #451
+D22452	.FILL #452
+D22453	.FILL #453
+D22454	.FILL #454
+D22455	.FILL #455
+D22456	.FILL #456
+D22457	.FILL #457
+D22458	.FILL #458
+D22459	.FILL #459
+D22460	.FILL #460
+D22461	.FILL #461
+D22462	.FILL #462
+D22463	.FILL #463
+D22464	.FILL #464
+D22465	.FILL #465
+D22466	.FILL #466
+D22467	.FILL #467
+D22468	.FILL #468
+D22469	.FILL #469
+D22470	.FILL #470
+D22471	.FILL #471
+D22472	.FILL #472
+D22473	.FILL #473
+D22474	.FILL #474
+D22475	.FILL #475
+D22476	.FILL #476
+D22477	.FILL #477
+D22478	.FILL #478
+D22479	.FILL #479
+D22480	.FILL #480
+D22481	.FILL #481
+D22482	.FILL #482
+D22483	.FILL #483
+D22484	.FILL #484
+D22485	.FILL #485
+D22486	.FILL #486
+D22487	.FILL #487
+D22488	.FILL #488
+D22489	.FILL #489
+D22490	.FILL #490
+D22491	.FILL #491
+D22492	.FILL #492
+D22493	.FILL #493
+D22494	.FILL #494
+D22495	.FILL #495
+D22496	.FILL #496
+D22497	.FILL #497
+D22498	.FILL #498
+D22499	.FILL #499
+D22500	.FILL #500
+D22501	.FILL #501
+D22502	.FILL #502
+D22503	.FILL #503
+D22504	.FILL #504
+D22505	.FILL #505
+D22506	.FILL #506
+D22507	.FILL #507
+D22508	.FILL #508
+D22509	.FILL #509
+D22510	.FILL #510
+D22511	.FILL #511
+D22512	.FILL #512
+D22513	.FILL #513
+D22514	.FILL #514
+D22515	.FILL #515
+D22516	.FILL #516
+D22517	.FILL #517
+D22518	.FILL #518
+D22519	.FILL #519
+D22520	.FILL #520
+D22521	.FILL #521
+D22522	.FILL #522
+D22523	.FILL #523
+D22524	.FILL #524
+D22525	.FILL #525
+D22526	.FILL #526
+D22527	.FILL #527
+D22528	.FILL #528
+D22529	.FILL #529
+D22530	.FILL #530
+D22531	.FILL #531
+D22532	.FILL #532
+D22533	.FILL #533
+D22534	.FILL #534
+D22535	.FILL #535
+D22536	.FILL #536
+D22537	.FILL #537
+D22538	.FILL #538
+D22539	.FILL #539
+D22540	.FILL #540
+D22541	.FILL #541
+D22542	.FILL #542
+D22543	.FILL #543
+D22544	.FILL #544
+D22545	.FILL #545
+D22546	.FILL #546
+D22547	.FILL #547
+D22548	.FILL #548
+D22549	.FILL #549
+D22550	.FILL #550
+D22551	.FILL #551
+D22552	.FILL #552
+D22553	.FILL #553
+D22554	.FILL #554
+D22555	.FILL #555
+D22556	.FILL #556
+D22557	.FILL #557
+D22558	.FILL #558
+D22559	.FILL #559
+D22560	.FILL #560
+D22561	.FILL #561
+D22562	.FILL #562
+D22563	.FILL #563
+D22564	.FILL #564
+D22565	.FILL #565
+D22566	.FILL #566
+D22567	.FILL #567
+D22568	.FILL #568
+D22569	.FILL #569
+D22570	.FILL #570
+D22571	.FILL #571
+D22572	.FILL #572
+D22573	.FILL #573
+D22574	.FILL #574
+D22575	.FILL #575
+D22576	.FILL #576
+D22577	.FILL #577
+D22578	.FILL #578
+D22579	.FILL #579
+D22580	.FILL #580
+D22581	.FILL #581
+D22582	.FILL #582
+D22583	.FILL #583
+D22584	.FILL #584
+D22585	.FILL #585
+D22586	.FILL #586
+D22587	.FILL #587
+D22588	.FILL #588
+D22589	.FILL #589
+D22590	.FILL #590
+D22591	.FILL #591
+D22592	.FILL #592
+D22593	.FILL #593
+D22594	.FILL #594
+D22595	.FILL #595
+D22596	.FILL #596
+D22597	.FILL #597
+D22598	.FILL #598
+D22599	.FILL #599
+D22600	.FILL #600
+D22601	.FILL #601
+D22602	.FILL #602
+D22603	.FILL #603
+D22604	.FILL #604
+D22605	.FILL #605
+D22606	.FILL #606
+D22607	.FILL #607
+D22608	.FILL #608
+D22609	.FILL #609
+D22610	.FILL #610
+D22611	.FILL #611
+D22612	.FILL #612
+D22613	.FILL #613
+D22614	.FILL #614
+D22615	.FILL #615
+D22616	.FILL #616
+D22617	.FILL #617
+D22618	.FILL #618
+D22619	.FILL #619
+D22620	.FILL #620
+D22621	.FILL #621
+D22622	.FILL #622
+D22623	.FILL #623
+D22624	.FILL #624
+D22625	.FILL #625
+D22626	.FILL #626
+D22627	.FILL #627
+D22628	.FILL #628
+D22629	.FILL #629
+D22630	.FILL #630
+D22631	.FILL #631
+D22632	.FILL #632
+D22633	.FILL #633
+D22634	.FILL #634
+D22635	.FILL #635
+D22636	.FILL #636
+D22637	.FILL #637
+D22638	.FILL #638
+D22639	.FILL #639
+D22640	.FILL #640
+D22641	.FILL #641
+D22642	.FILL #642
+D22643	.FILL #643
+D22644	.FILL #644
+D22645	.FILL #645
+D22646	.FILL #646
+D22647	.FILL #647
+D22648	.FILL #648
+D22649	.FILL #649
+D22650	.FILL #650
+D22651	.FILL #651
+D22652	.FILL #652
+D22653	.FILL #653
+D22654	.FILL #654
+D22655	.FILL #655
+D22656	.FILL #656
+D22657	.FILL #657
+D22658	.FILL #658
+D22659	.FILL #659
+D22660	.FILL #660
+D22661	.FILL #661
+D22662	.FILL #662
+D22663	.FILL #663
+D22664	.FILL #664
+D22665	.FILL #665
+D22666	.FILL #666
+D22667	.FILL #667
+D22668	.FILL #668
+D22669	.FILL #669
+D22670	.FILL #670
+D22671	.FILL #671
+D22672	.FILL #672
+D22673	.FILL #673
+D22674	.FILL #674
+D22675	.FILL #675
+D22676	.FILL #676
+D22677	.FILL #677
+D22678	.FILL #678
+D22679	.FILL #679
+D22680	.FILL #680
+D22681	.FILL #681
+D22682	.FILL #682
+D22683	.FILL #683
+D22684	.FILL #684
+D22685	.FILL #685
+D22686	.FILL #686
+D22687	.FILL #687
+D22688	.FILL #688
+D22689	.FILL #689
+D22690	.FILL #690
+D22691	.FILL #691
+D22692	.FILL #692
+D22693	.FILL #693
+D22694	.FILL #694
+D22695	.FILL #695
+D22696	.FILL #696
+D22697	.FILL #697
+D22698	.FILL #698
+D22699	.FILL #699
+D22700	.FILL #700
+D22701	.FILL #701
+D22702	.FILL #702
+D22703	.FILL #703
+D22704	.FILL #704
+D22705	.FILL #705
+D22706	.FILL #706
+D22707	.FILL #707
+D22708	.FILL #708
+D22709	.FILL #709
+D22710	.FILL #710
+D22711	.FILL #711
+D22712	.FILL #712
+D22713	.FILL #713
+D22714	.FILL #714
+D22715	.FILL #715
+D22716	.FILL #716
+D22717	.FILL #717
+D22718	.FILL #718
+D22719	.FILL #719
+D22720	.FILL #720
+D22721	.FILL #721
+D22722	.FILL #722
+D22723	.FILL #723
+D22724	.FILL #724
+D22725	.FILL #725
+D22726	.FILL #726
+D22727	.FILL #727
+D22728	.FILL #728
+D22729	.FILL #729
+D22730	.FILL #730
+D22731	.FILL #731
+D22732	.FILL #732
+D22733	.FILL #733
+D22734	.FILL #734
+D22735	.FILL #735
+D22736	.FILL #736
+D22737	.FILL #737
+D22738	.FILL #738
+D22739	.FILL #739
+D22740	.FILL #740
+D22741	.FILL #741
+D22742	.FILL #742
+D22743	.FILL #743
+D22744	.FILL #744
+D22745	.FILL #745
+D22746	.FILL #746
+D22747	.FILL #747
+D22748	.FILL #748
+D22749	.FILL #749
+D22750	.FILL #750
+D22751	.FILL #751
+D22752	.FILL #752
+D22753	.FILL #753
+D22754	.FILL #754
+D22755	.FILL #755
+D22756	.FILL #756
+D22757	.FILL #757
+D22758	.FILL #758
+D22759	.FILL #759
+D22760	.FILL #760
+D22761	.FILL #761
+D22762	.FILL #762
+D22763	.FILL #763
+D22764	.FILL #764
+D22765	.FILL #765
+D22766	.FILL #766
+D22767	.FILL #767
+D22768	.FILL #768
+D22769	.FILL #769
+D22770	.FILL #770
+D22771	.FILL #771
+D22772	.FILL #772
+D22773	.FILL #773
+D22774	.FILL #774
+D22775	.FILL #775
+D22776	.FILL #776
+D22777	.FILL #777
+D22778	.FILL #778
+D22779	.FILL #779
+D22780	.FILL #780
+D22781	.FILL #781
+D22782	.FILL #782
+D22783	.FILL #783
+D22784	.FILL #784
+D22785	.FILL #785
+D22786	.FILL #786
+D22787	.FILL #787
+D22788	.FILL #788
+D22789	.FILL #789
+D22790	.FILL #790
+D22791	.FILL #791
+D22792	.FILL #792
+D22793	.FILL #793
+D22794	.FILL #794
+D22795	.FILL #795
+D22796	.FILL #796
+D22797	.FILL #797
+D22798	.FILL #798
+D22799	.FILL #799
+D22800	.FILL #800
+D22801	.FILL #801
+D22802	.FILL #802
+D22803	.FILL #803
+D22804	.FILL #804
+D22805	.FILL #805
+D22806	.FILL #806
+D22807	.FILL #807
+D22808	.FILL #808
+D22809	.FILL #809
+D22810	.FILL #810
+D22811	.FILL #811
+D22812	.FILL #812
+D22813	.FILL #813
+D22814	.FILL #814
+D22815	.FILL #815
+D22816	.FILL #816
+D22817	.FILL #817
+D22818	.FILL #818
+D22819	.FILL #819
+D22820	.FILL #820
+D22821	.FILL #821
+D22822	.FILL #822
+D22823	.FILL #823
+D22824	.FILL #824
+D22825	.FILL #825
+D22826	.FILL #826
+D22827	.FILL #827
+D22828	.FILL #828
+D22829	.FILL #829
+D22830	.FILL #830
+D22831	.FILL #831
+D22832	.FILL #832
+D22833	.FILL #833
+D22834	.FILL #834
+D22835	.FILL #835
+D22836	.FILL #836
+D22837	.FILL #837
+D22838	.FILL #838
+D22839	.FILL #839
+D22840	.FILL #840
+D22841	.FILL #841
+D22842	.FILL #842
+D22843	.FILL #843
+D22844	.FILL #844
+D22845	.FILL #845
+D22846	.FILL #846
+D22847	.FILL #847
+D22848	.FILL #848
+D22849	.FILL #849
+D22850	.FILL #850
+D22851	.FILL #851
+D22852	.FILL #852
+D22853	.FILL #853
+D22854	.FILL #854
+D22855	.FILL #855
+D22856	.FILL #856
+D22857	.FILL #857
+D22858	.FILL #858
+D22859	.FILL #859
+D22860	.FILL #860
+D22861	.FILL #861
+D22862	.FILL #862
+D22863	.FILL #863
+D22864	.FILL #864
+D22865	.FILL #865
+D22866	.FILL #866
+D22867	.FILL #867
+D22868	.FILL #868
+D22869	.FILL #869
+D22870	.FILL #870
+D22871	.FILL #871
+D22872	.FILL #872
+D22873	.FILL #873
+D22874	.FILL #874
+D22875	.FILL #875
+D22876	.FILL #876
+D22877	.FILL #877
+D22878	.FILL #878
+D22879	.FILL #879
+D22880	.FILL #880
+D22881	.FILL #881
+D22882	.FILL #882
+D22883	.FILL #883
+D22884	.FILL #884
+D22885	.FILL #885
+D22886	.FILL #886
+D22887	.FILL #887
+D22888	.FILL #888
+D22889	.FILL #889
+D22890	.FILL #890
+D22891	.FILL #891
+D22892	.FILL #892
+D22893	.FILL #893
+D22894	.FILL #894
+D22895	.FILL #895
+D22896	.FILL #896
+D22897	.FILL #897
+D22898	.FILL #898
+D22899	.FILL #899
+D22900	.FILL #900
+D22901	.FILL #901
+D22902	.FILL #902
+D22903	.FILL #903
+D22904	.FILL #904
+D22905	.FILL #905
+D22906	.FILL #906
+D22907	.FILL #907
+D22908	.FILL #908
+D22909	.FILL #909
+D22910	.FILL #910
+D22911	.FILL #911
+D22912	.FILL #912
+D22913	.FILL #913
+D22914	.FILL #914
+D22915	.FILL #915
+D22916	.FILL #916
+D22917	.FILL #917
+D22918	.FILL #918
+D22919	.FILL #919
+D22920	.FILL #920
+D22921	.FILL #921
+D22922	.FILL #922
+D22923	.FILL #923
+D22924	.FILL #924
+D22925	.FILL #925
+D22926	.FILL #926
+D22927	.FILL #927
+D22928	.FILL #928
+D22929	.FILL #929
+D22930	.FILL #930
+D22931	.FILL #931
+D22932	.FILL #932
+D22933	.FILL #933
+D22934	.FILL #934
+D22935	.FILL #935
+D22936	.FILL #936
+D22937	.FILL #937
+D22938	.FILL #938
+D22939	.FILL #939
+D22940	.FILL #940
+D22941	.FILL #941
+D22942	.FILL #942
+D22943	.FILL #943
+D22944	.FILL #944
+D22945	.FILL #945
+D22946	.FILL #946
+D22947	.FILL #947
+D22948	.FILL #948
+D22949	.FILL #949
+D22950	.FILL #950
+D22951	.FILL #951
+D22952	.FILL #952
+D22953	.FILL #953
+D22954	.FILL #954
+D22955	.FILL #955
+D22956	.FILL #956
+D22957	.FILL #957
+D22958	.FILL #958
+D22959	.FILL #959
+D22960	.FILL #960
+D22961	.FILL #961
+D22962	.FILL #962
+D22963	.FILL #963
+D22964	.FILL #964
+D22965	.FILL #965
+D22966	.FILL #966
+D22967	.FILL #967
+D22968	.FILL #968
+D22969	.FILL #969
+D22970	.FILL #970
+D22971	.FILL #971
+D22972	.FILL #972
+D22973	.FILL #973
+D22974	.FILL #974
+D22975	.FILL #975
+D22976	.FILL #976
+D22977	.FILL #977
+D22978	.FILL #978
+D22979	.FILL #979
+D22980	.FILL #980
+D22981	.FILL #981
+D22982	.FILL #982
+D22983	.FILL #983
+D22984	.FILL #984
+D22985	.FILL #985
+D22986	.FILL #986
+D22987	.FILL #987
+D22988	.FILL #988
+D22989	.FILL #989
+D22990	.FILL #990
+D22991	.FILL #991
+D22992	.FILL #992
+D22993	.FILL #993
+D22994	.FILL #994
+D22995	.FILL #995
+D22996	.FILL #996
+D22997	.FILL #997
+D22998	.FILL #998
+D22999	.FILL #999
+D23000	.FILL #0
+D23001	.FILL #1
+D23002	.FILL #2
+D23003	.FILL #3
+D23004	.FILL #4
+D23005	.FILL #5
+D23006	.FILL #6
+D23007	.FILL #7
+D23008	.FILL #8
+D23009	.FILL #9
+D23010	.FILL #10
+D23011	.FILL #11
+D23012	.FILL #12
+D23013	.FILL #13
+D23014	.FILL #14
+D23015	.FILL #15
+D23016	.FILL #16
+D23017	.FILL #17
+D23018	.FILL #18
+D23019	.FILL #19
+D23020	.FILL #20
+D23021	.FILL #21
+D23022	.FILL #22
+D23023	.FILL #23
+D23024	.FILL #24
+D23025	.FILL #25
+D23026	.FILL #26
+D23027	.FILL #27
+D23028	.FILL #28
+D23029	.FILL #29
+D23030	.FILL #30
+D23031	.FILL #31
+D23032	.FILL #32
+D23033	.FILL #33
+D23034	.FILL #34
+D23035	.FILL #35
+D23036	.FILL #36
+D23037	.FILL #37
+D23038	.FILL #38
+D23039	.FILL #39
+D23040	.FILL #40
+D23041	.FILL #41
+D23042	.FILL #42
+D23043	.FILL #43
+D23044	.FILL #44
+D23045	.FILL #45
+D23046	.FILL #46
+D23047	.FILL #47
+D23048	.FILL #48
+D23049	.FILL #49
+D23050	.FILL #50
+D23051	.FILL #51
+D23052	.FILL #52
+D23053	.FILL #53
+D23054	.FILL #54
+D23055	.FILL #55
+D23056	.FILL #56
+D23057	.FILL #57
+D23058	.FILL #58
+D23059	.FILL #59
+D23060	.FILL #60
+D23061	.FILL #61
+D23062	.FILL #62
+D23063	.FILL #63
+D23064	.FILL #64
+D23065	.FILL #65
+D23066	.FILL #66
+D23067	.FILL #67
+D23068	.FILL #68
+D23069	.FILL #69
+D23070	.FILL #70
+D23071	.FILL #71
+D23072	.FILL #72
+D23073	.FILL #73
+D23074	.FILL #74
+D23075	.FILL #75
+D23076	.FILL #76
+D23077	.FILL #77
+D23078	.FILL #78
+D23079	.FILL #79
+D23080	.FILL #80
+D23081	.FILL #81
+D23082	.FILL #82
+D23083	.FILL #83
+D23084	.FILL #84
+D23085	.FILL #85
+D23086	.FILL #86
+D23087	.FILL #87
+D23088	.FILL #88
+D23089	.FILL #89
+D23090	.FILL #90
+D23091	.FILL #91
+D23092	.FILL #92
+D23093	.FILL #93
+D23094	.FILL #94
+D23095	.FILL #95
+D23096	.FILL #96
+D23097	.FILL #97
+D23098	.FILL #98
+D23099	.FILL #99
+D23100	.FILL #100
+D23101	.FILL #101
+D23102	.FILL #102
+D23103	.FILL #103
+D23104	.FILL #104
+D23105	.FILL #105
+D23106	.FILL #106
+D23107	.FILL #107
+D23108	.FILL #108
+D23109	.FILL #109
+D23110	.FILL #110
+D23111	.FILL #111
+D23112	.FILL #112
+D23113	.FILL #113
+D23114	.FILL #114
+D23115	.FILL #115
+D23116	.FILL #116
+D23117	.FILL #117
+D23118	.FILL #118
+D23119	.FILL #119
+D23120	.FILL #120
+D23121	.FILL #121
+D23122	.FILL #122
+D23123	.FILL #123
+D23124	.FILL #124
+D23125	.FILL #125
+D23126	.FILL #126
+D23127	.FILL #127
+D23128	.FILL #128
+D23129	.FILL #129
+D23130	.FILL #130
+D23131	.FILL #131
+D23132	.FILL #132
+D23133	.FILL #133
+D23134	.FILL #134
+D23135	.FILL #135
+D23136	.FILL #136
+D23137	.FILL #137
+D23138	.FILL #138
+D23139	.FILL #139
+D23140	.FILL #140
+D23141	.FILL #141
+D23142	.FILL #142
+D23143	.FILL #143
+D23144	.FILL #144
+D23145	.FILL #145
+D23146	.FILL #146
+D23147	.FILL #147
+D23148	.FILL #148
+D23149	.FILL #149
+D23150	.FILL #150
+D23151	.FILL #151
+D23152	.FILL #152
+D23153	.FILL #153
+D23154	.FILL #154
+D23155	.FILL #155
+D23156	.FILL #156
+D23157	.FILL #157
+D23158	.FILL #158
+D23159	.FILL #159
+D23160	.FILL #160
+D23161	.FILL #161
+D23162	.FILL #162
+D23163	.FILL #163
+D23164	.FILL #164
+D23165	.FILL #165
+D23166	.FILL #166
+D23167	.FILL #167
+D23168	.FILL #168
+D23169	.FILL #169
+D23170	.FILL #170
+D23171	.FILL #171
+D23172	.FILL #172
+D23173	.FILL #173
+D23174	.FILL #174
+D23175	.FILL #175
+D23176	.FILL #176
+D23177	.FILL #177
+D23178	.FILL #178
+D23179	.FILL #179
+D23180	.FILL #180
+D23181	.FILL #181
+D23182	.FILL #182
+D23183	.FILL #183
+D23184	.FILL #184
+D23185	.FILL #185
+D23186	.FILL #186
+D23187	.FILL #187
+D23188	.FILL #188
+D23189	.FILL #189
+D23190	.FILL #190
+D23191	.FILL #191
+D23192	.FILL #192
+D23193	.FILL #193
+D23194	.FILL #194
+D23195	.FILL #195
+D23196	.FILL #196
+D23197	.FILL #197
+D23198	.FILL #198
+D23199	.FILL #199
+D23200	.FILL #200
+D23201	.FILL #201
+D23202	.FILL #202
+D23203	.FILL #203
+D23204	.FILL #204
+D23205	.FILL #205
+D23206	.FILL #206
+D23207	.FILL #207
+D23208	.FILL #208
+D23209	.FILL #209
+D23210	.FILL #210
+D23211	.FILL #211
+D23212	.FILL #212
+D23213	.FILL #213
+D23214	.FILL #214
+D23215	.FILL #215
+D23216	.FILL #216
+D23217	.FILL #217
+D23218	.FILL #218
+D23219	.FILL #219
+D23220	.FILL #220
+D23221	.FILL #221
+D23222	.FILL #222
+D23223	.FILL #223
+D23224	.FILL #224
+D23225	.FILL #225
+D23226	.FILL #226
+D23227	.FILL #227
+D23228	.FILL #228
+D23229	.FILL #229
+D23230	.FILL #230
+D23231	.FILL #231
+D23232	.FILL #232
+D23233	.FILL #233
+D23234	.FILL #234
+D23235	.FILL #235
+D23236	.FILL #236
+D23237	.FILL #237
+D23238	.FILL #238
+D23239	.FILL #239
+D23240	.FILL #240
+D23241	.FILL #241
+D23242	.FILL #242
+D23243	.FILL #243
+D23244	.FILL #244
+D23245	.FILL #245
+D23246	.FILL #246
+D23247	.FILL #247
+D23248	.FILL #248
+D23249	.FILL #249
+D23250	.FILL #250
+D23251	.FILL #251
+D23252	.FILL #252
+D23253	.FILL #253
+D23254	.FILL #254
+D23255	.FILL #255
+D23256	.FILL #256
+D23257	.FILL #257
+D23258	.FILL #258
+D23259	.FILL #259
+D23260	.FILL #260
+D23261	.FILL #261
+D23262	.FILL #262
+D23263	.FILL #263
+D23264	.FILL #264
+D23265	.FILL #265
+D23266	.FILL #266
+D23267	.FILL #267
+D23268	.FILL #268
+D23269	.FILL #269
+D23270	.FILL #270
+D23271	.FILL #271
+D23272	.FILL #272
+D23273	.FILL #273
+D23274	.FILL #274
+D23275	.FILL #275
+D23276	.FILL #276
+D23277	.FILL #277
+D23278	.FILL #278
+D23279	.FILL #279
+D23280	.FILL #280
+D23281	.FILL #281
+D23282	.FILL #282
+D23283	.FILL #283
+D23284	.FILL #284
+D23285	.FILL #285
+D23286	.FILL #286
+D23287	.FILL #287
+D23288	.FILL #288
+D23289	.FILL #289
+D23290	.FILL #290
+D23291	.FILL #291
+D23292	.FILL #292
+D23293	.FILL #293
+D23294	.FILL #294
+D23295	.FILL #295
+D23296	.FILL #296
+D23297	.FILL #297
+D23298	.FILL #298
+D23299	.FILL #299
+D23300	.FILL #300
+D23301	.FILL #301
+D23302	.FILL #302
+D23303	.FILL #303
+D23304	.FILL #304
+D23305	.FILL #305
+D23306	.FILL #306
+D23307	.FILL #307
+D23308	.FILL #308
+D23309	.FILL #309
+D23310	.FILL #310
+D23311	.FILL #311
+D23312	.FILL #312
+D23313	.FILL #313
+D23314	.FILL #314
+D23315	.FILL #315
+D23316	.FILL #316
+D23317	.FILL #317
+D23318	.FILL #318
+D23319	.FILL #319
+D23320	.FILL #320
+D23321	.FILL #321
+D23322	.FILL #322
+D23323	.FILL #323
+D23324	.FILL #324
+D23325	.FILL #325
+D23326	.FILL #326
+D23327	.FILL #327
+D23328	.FILL #328
+D23329	.FILL #329
+D23330	.FILL #330
+D23331	.FILL #331
+D23332	.FILL #332
+D23333	.FILL #333
+D23334	.FILL #334
+D23335	.FILL #335
+D23336	.FILL #336
+D23337	.FILL #337
+D23338	.FILL #338
+D23339	.FILL #339
+D23340	.FILL #340
+D23341	.FILL #341
+D23342	.FILL #342
+D23343	.FILL #343
+D23344	.FILL #344
+D23345	.FILL #345
+D23346	.FILL #346
+D23347	.FILL #347
+D23348	.FILL #348
+D23349	.FILL #349
+D23350	.FILL #350
+D23351	.FILL #351
+D23352	.FILL #352
+D23353	.FILL #353
+D23354	.FILL #354
+D23355	.FILL #355
+D23356	.FILL #356
+D23357	.FILL #357
+D23358	.FILL #358
+D23359	.FILL #359
+D23360	.FILL #360
+D23361	.FILL #361
+D23362	.FILL #362
+D23363	.FILL #363
+D23364	.FILL #364
+D23365	.FILL #365
+D23366	.FILL #366
+D23367	.FILL #367
+D23368	.FILL #368
+D23369	.FILL #369
+D23370	.FILL #370
+D23371	.FILL #371
+D23372	.FILL #372
+D23373	.FILL #373
+D23374	.FILL #374
+D23375	.FILL #375
+D23376	.FILL #376
+D23377	.FILL #377
+D23378	.FILL #378
+D23379	.FILL #379
+D23380	.FILL #380
+D23381	.FILL #381
+D23382	.FILL #382
+D23383	.FILL #383
+D23384	.FILL #384
+D23385	.FILL #385
+D23386	.FILL #386
+D23387	.FILL #387
+D23388	.FILL #388
+D23389	.FILL #389
+D23390	.FILL #390
+D23391	.FILL #391
+D23392	.FILL #392
+D23393	.FILL #393
+D23394	.FILL #394
+D23395	.FILL #395
+D23396	.FILL #396
+D23397	.FILL #397
+D23398	.FILL #398
+D23399	.FILL #399
+D23400	.FILL #400
+D23401	.FILL #401
+D23402	.FILL #402
+D23403	.FILL #403
+D23404	.FILL #404
+D23405	.FILL #405
+D23406	.FILL #406
+D23407	.FILL #407
+D23408	.FILL #408
+D23409	.FILL #409
+D23410	.FILL #410
+D23411	.FILL #411
+D23412	.FILL #412
+D23413	.FILL #413
+D23414	.FILL #414
+D23415	.FILL #415
+D23416	.FILL #416
+D23417	.FILL #417
+D23418	.FILL #418
+D23419	.FILL #419
+D23420	.FILL #420
+D23421	.FILL #421
+D23422	.FILL #422
+D23423	.FILL #423
+D23424	.FILL #424
+D23425	.FILL #425
+D23426	.FILL #426
+D23427	.FILL #427
+D23428	.FILL #428
+D23429	.FILL #429
+D23430	.FILL #430
+D23431	.FILL #431
+D23432	.FILL #432
+D23433	.FILL #433
+D23434	.FILL #434
+D23435	.FILL #435
+D23436	.FILL #436
+D23437	.FILL #437
+D23438	.FILL #438
+D23439	.FILL #439
+D23440	.FILL #440
+D23441	.FILL #441
+D23442	.FILL #442
+D23443	.FILL #443
+D23444	.FILL #444
+D23445	.FILL #445
+D23446	.FILL #446
+D23447	.FILL #447
+D23448	.FILL #448
+D23449	.FILL #449
+D23450	.FILL #450
+D23451	.FILL #451
+D23452	.FILL #452
+D23453	.FILL #453
+D23454	.FILL #454
+D23455	.FILL #455
+D23456	.FILL #456
+D23457	.FILL #457
+D23458	.FILL #458
+D23459	.FILL #459
+D23460	.FILL #460
+D23461	.FILL #461
+D23462	.FILL #462
+D23463	.FILL #463
+D23464	.FILL #464
+D23465	.FILL #465
+D23466	.FILL #466
+D23467	.FILL #467
+D23468	.FILL #468
+D23469	.FILL #469
+D23470	.FILL #470
+D23471	.FILL #471
+D23472	.FILL #472
+D23473	.FILL #473
+D23474	.FILL #474
+D23475	.FILL #475
+D23476	.FILL #476
+D23477	.FILL #477
+D23478	.FILL #478
+D23479	.FILL #479
+D23480	.FILL #480
+D23481	.FILL #481
+D23482	.FILL #482
+D23483	.FILL #483
+D23484	.FILL #484
+D23485	.FILL #485
+D23486	.FILL #486
+D23487	.FILL #487
+D23488	.FILL #488
+D23489	.FILL #489
+D23490	.FILL #490
+D23491	.FILL #491
+D23492	.FILL #492
+D23493	.FILL #493
+D23494	.FILL #494
+D23495	.FILL #495
+D23496	.FILL #496
+D23497	.FILL #497
+D23498	.FILL #498
+D23499	.FILL #499
+D23500	.FILL #500
+D23501	.FILL #501
+D23502	.FILL #502
+D23503	.FILL #503
+D23504	.FILL #504
+D23505	.FILL #505
+D23506	.FILL #506
+D23507	.FILL #507
+D23508	.FILL #508
+D23509	.FILL #509
+D23510	.FILL #510
+D23511	.FILL #511
+D23512	.FILL #512
+D23513	.FILL #513
+D23514	.FILL #514
+D23515	.FILL #515
+D23516	.FILL #516
+D23517	.FILL #517
+D23518	.FILL #518
+D23519	.FILL #519
+D23520	.FILL #520
+D23521	.FILL #521
+D23522	.FILL #522
+D23523	.FILL #523
+D23524	.FILL #524
+D23525	.FILL #525
+D23526	.FILL #526
+D23527	.FILL #527
+D23528	.FILL #528
+D23529	.FILL #529
+D23530	.FILL #530
+D23531	.FILL #531
+D23532	.FILL #532
+D23533	.FILL #533
+D23534	.FILL #534
+D23535	.FILL #535
+D23536	.FILL #536
+D23537	.FILL #537
+D23538	.FILL #538
+D23539	.FILL #539
+D23540	.FILL #540
+D23541	.FILL #541
+D23542	.FILL #542
+D23543	.FILL #543
+D23544	.FILL #544
+D23545	.FILL #545
+D23546	.FILL #546
+D23547	.FILL #547
+D23548	.FILL #548
+D23549	.FILL #549
+D23550	.FILL #550
+D23551	.FILL #551
+D23552	.FILL #552
+D23553	.FILL #553
+D23554	.FILL #554
+D23555	.FILL #555
+D23556	.FILL #556
+D23557	.FILL #557
+D23558	.FILL #558
+D23559	.FILL #559
+D23560	.FILL #560
+D23561	.FILL #561
+D23562	.FILL #562
+D23563	.FILL #563
+D23564	.FILL #564
+D23565	.FILL #565
+D23566	.FILL #566
+D23567	.FILL #567
+D23568	.FILL #568
+D23569	.FILL #569
+D23570	.FILL #570
+D23571	.FILL #571
+D23572	.FILL #572
+D23573	.FILL #573
+D23574	.FILL #574
+D23575	.FILL #575
+D23576	.FILL #576
+D23577	.FILL #577
+D23578	.FILL #578
+D23579	.FILL #579
+D23580	.FILL #580
+D23581	.FILL #581
+D23582	.FILL #582
+D23583	.FILL #583
+D23584	.FILL #584
+D23585	.FILL #585
+D23586	.FILL #586
+D23587	.FILL #587
+D23588	.FILL #588
+D23589	.FILL #589
+D23590	.FILL #590
+D23591	.FILL #591
+D23592	.FILL #592
+D23593	.FILL #593
+D23594	.FILL #594
+D23595	.FILL #595
+D23596	.FILL #596
+D23597	.FILL #597
+D23598	.FILL #598
+D23599	.FILL #599
+D23600	.FILL #600
+D23601	.FILL #601
+D23602	.FILL #602
+D23603	.FILL #603
+D23604	.FILL #604
+D23605	.FILL #605
+D23606	.FILL #606
+D23607	.FILL #607
+D23608	.FILL #608
+D23609	.FILL #609
+D23610	.FILL #610
+D23611	.FILL #611
+D23612	.FILL #612
+D23613	.FILL #613
+D23614	.FILL #614
+D23615	.FILL #615
+D23616	.FILL #616
+D23617	.FILL #617
+D23618	.FILL #618
+D23619	.FILL #619
+D23620	.FILL #620
+D23621	.FILL #621
+D23622	.FILL #622
+D23623	.FILL #623
+D23624	.FILL #624
+D23625	.FILL #625
+D23626	.FILL #626
+D23627	.FILL #627
+D23628	.FILL #628
+D23629	.FILL #629
+D23630	.FILL #630
+D23631	.FILL #631
+D23632	.FILL #632
+D23633	.FILL #633
+D23634	.FILL #634
+D23635	.FILL #635
+D23636	.FILL #636
+D23637	.FILL #637
+D23638	.FILL #638
+D23639	.FILL #639
+D23640	.FILL #640
+D23641	.FILL #641
+D23642	.FILL #642
+D23643	.FILL #643
+D23644	.FILL #644
+D23645	.FILL #645
+D23646	.FILL #646
+D23647	.FILL #647
+D23648	.FILL #648
+D23649	.FILL #649
+D23650	.FILL #650
+D23651	.FILL #651
+D23652	.FILL #652
+D23653	.FILL #653
+D23654	.FILL #654
+D23655	.FILL #655
+D23656	.FILL #656
+D23657	.FILL #657
+D23658	.FILL #658
+D23659	.FILL #659
+D23660	.FILL #660
+D23661	.FILL #661
+D23662	.FILL #662
+D23663	.FILL #663
+D23664	.FILL #664
+D23665	.FILL #665
+D23666	.FILL #666
+D23667	.FILL #667
+D23668	.FILL #668
+D23669	.FILL #669
+D23670	.FILL #670
+D23671	.FILL #671
+D23672	.FILL #672
+D23673	.FILL #673
+D23674	.FILL #674
+D23675	.FILL #675
+D23676	.FILL #676
+D23677	.FILL #677
+D23678	.FILL #678
+D23679	.FILL #679
+D23680	.FILL #680
+D23681	.FILL #681
+D23682	.FILL #682
+D23683	.FILL #683
+D23684	.FILL #684
+D23685	.FILL #685
+D23686	.FILL #686
+D23687	.FILL #687
+D23688	.FILL #688
+D23689	.FILL #689
+D23690	.FILL #690
+D23691	.FILL #691
+D23692	.FILL #692
+D23693	.FILL #693
+D23694	.FILL #694
+D23695	.FILL #695
+D23696	.FILL #696
+D23697	.FILL #697
+D23698	.FILL #698
+D23699	.FILL #699
+D23700	.FILL #700
+D23701	.FILL #701
+D23702	.FILL #702
+D23703	.FILL #703
+D23704	.FILL #704
+D23705	.FILL #705
+D23706	.FILL #706
+D23707	.FILL #707
+D23708	.FILL #708
+D23709	.FILL #709
+D23710	.FILL #710
+D23711	.FILL #711
+D23712	.FILL #712
+D23713	.FILL #713
+D23714	.FILL #714
+D23715	.FILL #715
+D23716	.FILL #716
+D23717	.FILL #717
+D23718	.FILL #718
+D23719	.FILL #719
+D23720	.FILL #720
+D23721	.FILL #721
+D23722	.FILL #722
+D23723	.FILL #723
+D23724	.FILL #724
+D23725	.FILL #725
+D23726	.FILL #726
+D23727	.FILL #727
+D23728	.FILL #728
+D23729	.FILL #729
+D23730	.FILL #730
+D23731	.FILL #731
+D23732	.FILL #732
+D23733	.FILL #733
+D23734	.FILL #734
+D23735	.FILL #735
+D23736	.FILL #736
+D23737	.FILL #737
+D23738	.FILL #738
+D23739	.FILL #739
+D23740	.FILL #740
+D23741	.FILL #741
+D23742	.FILL #742
+D23743	.FILL #743
+D23744	.FILL #744
+D23745	.FILL #745
+D23746	.FILL #746
+D23747	.FILL #747
+D23748	.FILL #748
+D23749	.FILL #749
+D23750	.FILL #750
+D23751	.FILL #751
+D23752	.FILL #752
+D23753	.FILL #753
+D23754	.FILL #754
+D23755	.FILL #755
+D23756	.FILL #756
+D23757	.FILL #757
+D23758	.FILL #758
+D23759	.FILL #759
+D23760	.FILL #760
+D23761	.FILL #761
+D23762	.FILL #762
+D23763	.FILL #763
+D23764	.FILL #764
+D23765	.FILL #765
+D23766	.FILL #766
+D23767	.FILL #767
+D23768	.FILL #768
+D23769	.FILL #769
+D23770	.FILL #770
+D23771	.FILL #771
+D23772	.FILL #772
+D23773	.FILL #773
+D23774	.FILL #774
+D23775	.FILL #775
+D23776	.FILL #776
+D23777	.FILL #777
+D23778	.FILL #778
+D23779	.FILL #779
+D23780	.FILL #780
+D23781	.FILL #781
+D23782	.FILL #782
+D23783	.FILL #783
+D23784	.FILL #784
+D23785	.FILL #785
+D23786	.FILL #786
+D23787	.FILL #787
+D23788	.FILL #788
+D23789	.FILL #789
+D23790	.FILL #790
+D23791	.FILL #791
+D23792	.FILL #792
+D23793	.FILL #793
+D23794	.FILL #794
+D23795	.FILL #795
+D23796	.FILL #796
+D23797	.FILL #797
+D23798	.FILL #798
+D23799	.FILL #799
+D23800	.FILL #800
+D23801	.FILL #801
+D23802	.FILL #802
+D23803	.FILL #803
+D23804	.FILL #804
+D23805	.FILL #805
+D23806	.FILL #806
+D23807	.FILL #807
+D23808	.FILL #808
+D23809	.FILL #809
+D23810	.FILL #810
+D23811	.FILL #811
+D23812	.FILL #812
+D23813	.FILL #813
+D23814	.FILL #814
+D23815	.FILL #815
+D23816	.FILL #816
+D23817	.FILL #817
+D23818	.FILL #818
+D23819	.FILL #819
+D23820	.FILL #820
+D23821	.FILL #821
+D23822	.FILL #822
+D23823	.FILL #823
+D23824	.FILL #824
+D23825	.FILL #825
+D23826	.FILL #826
+D23827	.FILL #827
+D23828	.FILL #828
+D23829	.FILL #829
+D23830	.FILL #830
+D23831	.FILL #831
+D23832	.FILL #832
+D23833	.FILL #833
+D23834	.FILL #834
+D23835	.FILL #835
+D23836	.FILL #836
+D23837	.FILL #837
+D23838	.FILL #838
+D23839	.FILL #839
+D23840	.FILL #840
+D23841	.FILL #841
+D23842	.FILL #842
+D23843	.FILL #843
+D23844	.FILL #844
+D23845	.FILL #845
+D23846	.FILL #846
+D23847	.FILL #847
+D23848	.FILL #848
+D23849	.FILL #849
+D23850	.FILL #850
+D23851	.FILL #851
+D23852	.FILL #852
+D23853	.FILL #853
+D23854	.FILL #854
+D23855	.FILL #855
+D23856	.FILL #856
+D23857	.FILL #857
+D23858	.FILL #858
+D23859	.FILL #859
+D23860	.FILL #860
+D23861	.FILL #861
+D23862	.FILL #862
+D23863	.FILL #863
+D23864	.FILL #864
+D23865	.FILL #865
+D23866	.FILL #866
+D23867	.FILL #867
+D23868	.FILL #868
+D23869	.FILL #869
+D23870	.FILL #870
+D23871	.FILL #871
+D23872	.FILL #872
+D23873	.FILL #873
+D23874	.FILL #874
+D23875	.FILL #875
+D23876	.FILL #876
+D23877	.FILL #877
+D23878	.FILL #878
+D23879	.FILL #879
+D23880	.FILL #880
+D23881	.FILL #881
+D23882	.FILL #882
+D23883	.FILL #883
+D23884	.FILL #884
+D23885	.FILL #885
+D23886	.FILL #886
+D23887	.FILL #887
+D23888	.FILL #888
+D23889	.FILL #889
+D23890	.FILL #890
+D23891	.FILL #891
+D23892	.FILL #892
+D23893	.FILL #893
+D23894	.FILL #894
+D23895	.FILL #895
+D23896	.FILL #896
+D23897	.FILL #897
+D23898	.FILL #898
+D23899	.FILL #899
+D23900	.FILL #900
+D23901	.FILL #901
+D23902	.FILL #902
+D23903	.FILL #903
+D23904	.FILL #904
+D23905	.FILL #905
+D23906	.FILL #906
+D23907	.FILL #907
+D23908	.FILL #908
+D23909	.FILL #909
+D23910	.FILL #910
+D23911	.FILL #911
+D23912	.FILL #912
+D23913	.FILL #913
+D23914	.FILL #914
+D23915	.FILL #915
+D23916	.FILL #916
+D23917	.FILL #917
+D23918	.FILL #918
+D23919	.FILL #919
+D23920	.FILL #920
+D23921	.FILL #921
+D23922	.FILL #922
+D23923	.FILL #923
+D23924	.FILL #924
+D23925	.FILL #925
+D23926	.FILL #926
+D23927	.FILL #927
+D23928	.FILL #928
+D23929	.FILL #929
+D23930	.FILL #930
+D23931	.FILL #931
+D23932	.FILL #932
+D23933	.FILL #933
+D23934	.FILL #934
+D23935	.FILL #935
+D23936	.FILL #936
+D23937	.FILL #937
+D23938	.FILL #938
+D23939	.FILL #939
+D23940	.FILL #940
+D23941	.FILL #941
+D23942	.FILL #942
+D23943	.FILL #943
+D23944	.FILL #944
+D23945	.FILL #945
+D23946	.FILL #946
+D23947	.FILL #947
+D23948	.FILL #948
+D23949	.FILL #949
+D23950	.FILL #950
+D23951	.FILL #951
+D23952	.FILL #952
+D23953	.FILL #953
+D23954	.FILL #954
+D23955	.FILL #955
+D23956	.FILL #956
+D23957	.FILL #957
+D23958	.FILL #958
+D23959	.FILL #959
+D23960	.FILL #960
+D23961	.FILL #961
+D23962	.FILL #962
+D23963	.FILL #963
+D23964	.FILL #964
+D23965	.FILL #965
+D23966	.FILL #966
+D23967	.FILL #967
+D23968	.FILL #968
+D23969	.FILL #969
+D23970	.FILL #970
+D23971	.FILL #971
+D23972	.FILL #972
+D23973	.FILL #973
+D23974	.FILL #974
+D23975	.FILL #975
+D23976	.FILL #976
+D23977	.FILL #977
+D23978	.FILL #978
+D23979	.FILL #979
+D23980	.FILL #980
+D23981	.FILL #981
+D23982	.FILL #982
+D23983	.FILL #983
+D23984	.FILL #984
+D23985	.FILL #985
+D23986	.FILL #986
+D23987	.FILL #987
+D23988	.FILL #988
+D23989	.FILL #989
+D23990	.FILL #990
+D23991	.FILL #991
+D23992	.FILL #992
+D23993	.FILL #993
+D23994	.FILL #994
+D23995	.FILL #995
+D23996	.FILL #996
+D23997	.FILL #997
+D23998	.FILL #998
+D23999	.FILL #999
+D24000	.FILL #0
+D24001	.FILL #1
+D24002	.FILL #2
+D24003	.FILL #3
+D24004	.FILL #4
+D24005	.FILL #5
+D24006	.FILL #6
+D24007	.FILL #7
+D24008	.FILL #8
+D24009	.FILL #9
+D24010	.FILL #10
+D24011	.FILL #11
+D24012	.FILL #12
+D24013	.FILL #13
+D24014	.FILL #14
+D24015	.FILL #15
+D24016	.FILL #16
+D24017	.FILL #17
+D24018	.FILL #18
+D24019	.FILL #19
+D24020	.FILL #20
+D24021	.FILL #21
+D24022	.FILL #22
+D24023	.FILL #23
+D24024	.FILL #24
+D24025	.FILL #25
+D24026	.FILL #26
+D24027	.FILL #27
+D24028	.FILL #28
+D24029	.FILL #29
+D24030	.FILL #30
+D24031	.FILL #31
+D24032	.FILL #32
+D24033	.FILL #33
+D24034	.FILL #34
+D24035	.FILL #35
+D24036	.FILL #36
+D24037	.FILL #37
+D24038	.FILL #38
+D24039	.FILL #39
+D24040	.FILL #40
+D24041	.FILL #41
+D24042	.FILL #42
+D24043	.FILL #43
+D24044	.FILL #44
+D24045	.FILL #45
+D24046	.FILL #46
+D24047	.FILL #47
+D24048	.FILL #48
+D24049	.FILL #49
+D24050	.FILL #50
+D24051	.FILL #51
+D24052	.FILL #52
+D24053	.FILL #53
+D24054	.FILL #54
+D24055	.FILL #55
+D24056	.FILL #56
+D24057	.FILL #57
+D24058	.FILL #58
+D24059	.FILL #59
+D24060	.FILL #60
+D24061	.FILL #61
+D24062	.FILL #62
+D24063	.FILL #63
+D24064	.FILL #64
+D24065	.FILL #65
+D24066	.FILL #66
+D24067	.FILL #67
+D24068	.FILL #68
+D24069	.FILL #69
+D24070	.FILL #70
+D24071	.FILL #71
+D24072	.FILL #72
+D24073	.FILL #73
+D24074	.FILL #74
+D24075	.FILL #75
+D24076	.FILL #76
+D24077	.FILL #77
+D24078	.FILL #78
+D24079	.FILL #79
+D24080	.FILL #80
+D24081	.FILL #81
+D24082	.FILL #82
+D24083	.FILL #83
+D24084	.FILL #84
+D24085	.FILL #85
+D24086	.FILL #86
+D24087	.FILL #87
+D24088	.FILL #88
+D24089	.FILL #89
+D24090	.FILL #90
+D24091	.FILL #91
+D24092	.FILL #92
+D24093	.FILL #93
+D24094	.FILL #94
+D24095	.FILL #95
+D24096	.FILL #96
+D24097	.FILL #97
+D24098	.FILL #98
+D24099	.FILL #99
+D24100	.FILL #100
+D24101	.FILL #101
+D24102	.FILL #102
+D24103	.FILL #103
+D24104	.FILL #104
+D24105	.FILL #105
+D24106	.FILL #106
+D24107	.FILL #107
+D24108	.FILL #108
+D24109	.FILL #109
+D24110	.FILL #110
+D24111	.FILL #111
+D24112	.FILL #112
+D24113	.FILL #113
+D24114	.FILL #114
+D24115	.FILL #115
+D24116	.FILL #116
+D24117	.FILL #117
+D24118	.FILL #118
+D24119	.FILL #119
+D24120	.FILL #120
+D24121	.FILL #121
+D24122	.FILL #122
+D24123	.FILL #123
+D24124	.FILL #124
+D24125	.FILL #125
+D24126	.FILL #126
+D24127	.FILL #127
+D24128	.FILL #128
+D24129	.FILL #129
+D24130	.FILL #130
+D24131	.FILL #131
+D24132	.FILL #132
+D24133	.FILL #133
+D24134	.FILL #134
+D24135	.FILL #135
+D24136	.FILL #136
+D24137	.FILL #137
+D24138	.FILL #138
+D24139	.FILL #139
+D24140	.FILL #140
+D24141	.FILL #141
+D24142	.FILL #142
+D24143	.FILL #143
+D24144	.FILL #144
+D24145	.FILL #145
+D24146	.FILL #146
+D24147	.FILL #147
+D24148	.FILL #148
+D24149	.FILL #149
+D24150	.FILL #150
+D24151	.FILL #151
+D24152	.FILL #152
+D24153	.FILL #153
+D24154	.FILL #154
+D24155	.FILL #155
+D24156	.FILL #156
+D24157	.FILL #157
+D24158	.FILL #158
+D24159	.FILL #159
+D24160	.FILL #160
+D24161	.FILL #161
+D24162	.FILL #162
+D24163	.FILL #163
+D24164	.FILL #164
+D24165	.FILL #165
+D24166	.FILL #166
+D24167	.FILL #167
+D24168	.FILL #168
+D24169	.FILL #169
+D24170	.FILL #170
+D24171	.FILL #171
+D24172	.FILL #172
+D24173	.FILL #173
+D24174	.FILL #174
+D24175	.FILL #175
+D24176	.FILL #176
+D24177	.FILL #177
+D24178	.FILL #178
+D24179	.FILL #179
+D24180	.FILL #180
+D24181	.FILL #181
+D24182	.FILL #182
+D24183	.FILL #183
+D24184	.FILL #184
+D24185	.FILL #185
+D24186	.FILL #186
+D24187	.FILL #187
+D24188	.FILL #188
+D24189	.FILL #189
+D24190	.FILL #190
+D24191	.FILL #191
+D24192	.FILL #192
+D24193	.FILL #193
+D24194	.FILL #194
+D24195	.FILL #195
+D24196	.FILL #196
+D24197	.FILL #197
+D24198	.FILL #198
+D24199	.FILL #199
+D24200	.FILL #200
+D24201	.FILL #201
+D24202	.FILL #202
+D24203	.FILL #203
+D24204	.FILL #204
+D24205	.FILL #205
+D24206	.FILL #206
+D24207	.FILL #207
+D24208	.FILL #208
+D24209	.FILL #209
+D24210	.FILL #210
+D24211	.FILL #211
+D24212	.FILL #212
+D24213	.FILL #213
+D24214	.FILL #214
+D24215	.FILL #215
+D24216	.FILL #216
+D24217	.FILL #217
+D24218	.FILL #218
+D24219	.FILL #219
+D24220	.FILL #220
+D24221	.FILL #221
+D24222	.FILL #222
+D24223	.FILL #223
+D24224	.FILL #224
+D24225	.FILL #225
+D24226	.FILL #226
+D24227	.FILL #227
+D24228	.FILL #228
+D24229	.FILL #229
+D24230	.FILL #230
+D24231	.FILL #231
+D24232	.FILL #232
+D24233	.FILL #233
+D24234	.FILL #234
+D24235	.FILL #235
+D24236	.FILL #236
+D24237	.FILL #237
+D24238	.FILL #238
+D24239	.FILL #239
+D24240	.FILL #240
+D24241	.FILL #241
+D24242	.FILL #242
+D24243	.FILL #243
+D24244	.FILL #244
+D24245	.FILL #245
+D24246	.FILL #246
+D24247	.FILL #247
+D24248	.FILL #248
+D24249	.FILL #249
+D24250	.FILL #250
+D24251	.FILL #251
+D24252	.FILL #252
+D24253	.FILL #253
+D24254	.FILL #254
+D24255	.FILL #255
+D24256	.FILL #256
+D24257	.FILL #257
+D24258	.FILL #258
+D24259	.FILL #259
+D24260	.FILL #260
+D24261	.FILL #261
+D24262	.FILL #262
+D24263	.FILL #263
+D24264	.FILL #264
+D24265	.FILL #265
+D24266	.FILL #266
+D24267	.FILL #267
+D24268	.FILL #268
+D24269	.FILL #269
+D24270	.FILL #270
+D24271	.FILL #271
+D24272	.FILL #272
+D24273	.FILL #273
+D24274	.FILL #274
+D24275	.FILL #275
+D24276	.FILL #276
+D24277	.FILL #277
+D24278	.FILL #278
+D24279	.FILL #279
+D24280	.FILL #280
+D24281	.FILL #281
+D24282	.FILL #282
+D24283	.FILL #283
+D24284	.FILL #284
+D24285	.FILL #285
+D24286	.FILL #286
+D24287	.FILL #287
+D24288	.FILL #288
+D24289	.FILL #289
+D24290	.FILL #290
+D24291	.FILL #291
+D24292	.FILL #292
+D24293	.FILL #293
+D24294	.FILL #294
+D24295	.FILL #295
+D24296	.FILL #296
+D24297	.FILL #297
+D24298	.FILL #298
+D24299	.FILL #299
+D24300	.FILL #300
+D24301	.FILL #301
+D24302	.FILL #302
+D24303	.FILL #303
+D24304	.FILL #304
+D24305	.FILL #305
+D24306	.FILL #306
+D24307	.FILL #307
+D24308	.FILL #308
+D24309	.FILL #309
+D24310	.FILL #310
+D24311	.FILL #311
+D24312	.FILL #312
+D24313	.FILL #313
+D24314	.FILL #314
+D24315	.FILL #315
+D24316	.FILL #316
+D24317	.FILL #317
+D24318	.FILL #318
+D24319	.FILL #319
+D24320	.FILL #320
+D24321	.FILL #321
+D24322	.FILL #322
+D24323	.FILL #323
+D24324	.FILL #324
+D24325	.FILL #325
+D24326	.FILL #326
+D24327	.FILL #327
+D24328	.FILL #328
+D24329	.FILL #329
+D24330	.FILL #330
+D24331	.FILL #331
+D24332	.FILL #332
+D24333	.FILL #333
+D24334	.FILL #334
+D24335	.FILL #335
+D24336	.FILL #336
+D24337	.FILL #337
+D24338	.FILL #338
+D24339	.FILL #339
+D24340	.FILL #340
+D24341	.FILL #341
+D24342	.FILL #342
+D24343	.FILL #343
+D24344	.FILL #344
+D24345	.FILL #345
+D24346	.FILL #346
+D24347	.FILL #347
+D24348	.FILL #348
+D24349	.FILL #349
+D24350	.FILL #350
+D24351	.FILL #351
+D24352	.FILL #352
+D24353	.FILL #353
+D24354	.FILL #354
+D24355	.FILL #355
+D24356	.FILL #356
+D24357	.FILL #357
+D24358	.FILL #358
+D24359	.FILL #359
+D24360	.FILL #360
+D24361	.FILL #361
+D24362	.FILL #362
+D24363	.FILL #363
+D24364	.FILL #364
+D24365	.FILL #365
+D24366	.FILL #366
+D24367	.FILL #367
+D24368	.FILL #368
+D24369	.FILL #369
+D24370	.FILL #370
+D24371	.FILL #371
+D24372	.FILL #372
+D24373	.FILL #373
+D24374	.FILL #374
+D24375	.FILL #375
+D24376	.FILL #376
+D24377	.FILL #377
+D24378	.FILL #378
+D24379	.FILL #379
+D24380	.FILL #380
+D24381	.FILL #381
+D24382	.FILL #382
+D24383	.FILL #383
+D24384	.FILL #384
+D24385	.FILL #385
+D24386	.FILL #386
+D24387	.FILL #387
+D24388	.FILL #388
+D24389	.FILL #389
+D24390	.FILL #390
+D24391	.FILL #391
+D24392	.FILL #392
+D24393	.FILL #393
+D24394	.FILL #394
+D24395	.FILL #395
+D24396	.FILL #396
+D24397	.FILL #397
+D24398	.FILL #398
+D24399	.FILL #399
+D24400	.FILL #400
+D24401	.FILL #401
+D24402	.FILL #402
+D24403	.FILL #403
+D24404	.FILL #404
+D24405	.FILL #405
+D24406	.FILL #406
+D24407	.FILL #407
+D24408	.FILL #408
+D24409	.FILL #409
+D24410	.FILL #410
+D24411	.FILL #411
+D24412	.FILL #412
+D24413	.FILL #413
+D24414	.FILL #414
+D24415	.FILL #415
+D24416	.FILL #416
+D24417	.FILL #417
+D24418	.FILL #418
+D24419	.FILL #419
+D24420	.FILL #420
+D24421	.FILL #421
+D24422	.FILL #422
+D24423	.FILL #423
+D24424	.FILL #424
+D24425	.FILL #425
+D24426	.FILL #426
+D24427	.FILL #427
+D24428	.FILL #428
+D24429	.FILL #429
+D24430	.FILL #430
+D24431	.FILL #431
+D24432	.FILL #432
+D24433	.FILL #433
+D24434	.FILL #434
+D24435	.FILL #435
+D24436	.FILL #436
+D24437	.FILL #437
+D24438	.FILL #438
+D24439	.FILL #439
+D24440	.FILL #440
+D24441	.FILL #441
+D24442	.FILL #442
+D24443	.FILL #443
+D24444	.FILL #444
+D24445	.FILL #445
+D24446	.FILL #446
+D24447	.FILL #447
+D24448	.FILL #448
+D24449	.FILL #449
+D24450	.FILL #450
+D24451	.FILL #451
+D24452	.FILL #452
+D24453	.FILL #453
+D24454	.FILL #454
+D24455	.FILL #455
+D24456	.FILL #456
+D24457	.FILL #457
+D24458	.FILL #458
+D24459	.FILL #459
+D24460	.FILL #460
+D24461	.FILL #461
+D24462	.FILL #462
+D24463	.FILL #463
+D24464	.FILL #464
+D24465	.FILL #465
+D24466	.FILL #466
+D24467	.FILL #467
+D24468	.FILL #468
+D24469	.FILL #469
+D24470	.FILL #470
+D24471	.FILL #471
+D24472	.FILL #472
+D24473	.FILL #473
+D24474	.FILL #474
+D24475	.FILL #475
+D24476	.FILL #476
+D24477	.FILL #477
+D24478	.FILL #478
+D24479	.FILL #479
+D24480	.FILL #480
+D24481	.FILL #481
+D24482	.FILL #482
+D24483	.FILL #483
+D24484	.FILL #484
+D24485	.FILL #485
+D24486	.FILL #486
+D24487	.FILL #487
+D24488	.FILL #488
+D24489	.FILL #489
+D24490	.FILL #490
+D24491	.FILL #491
+D24492	.FILL #492
+D24493	.FILL #493
+D24494	.FILL #494
+D24495	.FILL #495
+D24496	.FILL #496
+D24497	.FILL #497
+D24498	.FILL #498
+D24499	.FILL #499
+D24500	.FILL #500
+D24501	.FILL #501
+D24502	.FILL #502
+D24503	.FILL #503
+D24504	.FILL #504
+D24505	.FILL #505
+D24506	.FILL #506
+D24507	.FILL #507
+D24508	.FILL #508
+D24509	.FILL #509
+D24510	.FILL #510
+D24511	.FILL #511
+D24512	.FILL #512
+D24513	.FILL #513
+D24514	.FILL #514
+D24515	.FILL #515
+D24516	.FILL #516
+D24517	.FILL #517
+D24518	.FILL #518
+D24519	.FILL #519
+D24520	.FILL #520
+D24521	.FILL #521
+D24522	.FILL #522
+D24523	.FILL #523
+D24524	.FILL #524
+D24525	.FILL #525
+D24526	.FILL #526
+D24527	.FILL #527
+D24528	.FILL #528
+D24529	.FILL #529
+D24530	.FILL #530
+D24531	.FILL #531
+D24532	.FILL #532
+D24533	.FILL #533
+D24534	.FILL #534
+D24535	.FILL #535
+D24536	.FILL #536
+D24537	.FILL #537
+D24538	.FILL #538
+D24539	.FILL #539
+D24540	.FILL #540
+D24541	.FILL #541
+D24542	.FILL #542
+D24543	.FILL #543
+D24544	.FILL #544
+D24545	.FILL #545
+D24546	.FILL #546
+D24547	.FILL #547
+D24548	.FILL #548
+D24549	.FILL #549
+D24550	.FILL #550
+D24551	.FILL #551
+D24552	.FILL #552
+D24553	.FILL #553
+D24554	.FILL #554
+D24555	.FILL #555
+D24556	.FILL #556
+D24557	.FILL #557
+D24558	.FILL #558
+D24559	.FILL #559
+D24560	.FILL #560
+D24561	.FILL #561
+D24562	.FILL #562
+D24563	.FILL #563
+D24564	.FILL #564
+D24565	.FILL #565
+D24566	.FILL #566
+D24567	.FILL #567
+D24568	.FILL #568
+D24569	.FILL #569
+D24570	.FILL #570
+D24571	.FILL #571
+D24572	.FILL #572
+D24573	.FILL #573
+D24574	.FILL #574
+D24575	.FILL #575
+D24576	.FILL #576
+D24577	.FILL #577
+D24578	.FILL #578
+D24579	.FILL #579
+D24580	.FILL #580
+D24581	.FILL #581
+D24582	.FILL #582
+D24583	.FILL #583
+D24584	.FILL #584
+D24585	.FILL #585
+D24586	.FILL #586
+D24587	.FILL #587
+D24588	.FILL #588
+D24589	.FILL #589
+D24590	.FILL #590
+D24591	.FILL #591
+D24592	.FILL #592
+D24593	.FILL #593
+D24594	.FILL #594
+D24595	.FILL #595
+D24596	.FILL #596
+D24597	.FILL #597
+D24598	.FILL #598
+D24599	.FILL #599
+D24600	.FILL #600
+D24601	.FILL #601
+D24602	.FILL #602
+D24603	.FILL #603
+D24604	.FILL #604
+D24605	.FILL #605
+D24606	.FILL #606
+D24607	.FILL #607
+D24608	.FILL #608
+D24609	.FILL #609
+D24610	.FILL #610
+D24611	.FILL #611
+D24612	.FILL #612
+D24613	.FILL #613
+D24614	.FILL #614
+D24615	.FILL #615
+D24616	.FILL #616
+D24617	.FILL #617
+D24618	.FILL #618
+D24619	.FILL #619
+D24620	.FILL #620
+D24621	.FILL #621
+D24622	.FILL #622
+D24623	.FILL #623
+D24624	.FILL #624
+D24625	.FILL #625
+D24626	.FILL #626
+D24627	.FILL #627
+D24628	.FILL #628
+D24629	.FILL #629
+D24630	.FILL #630
+D24631	.FILL #631
+D24632	.FILL #632
+D24633	.FILL #633
+D24634	.FILL #634
+D24635	.FILL #635
+D24636	.FILL #636
+D24637	.FILL #637
+D24638	.FILL #638
+D24639	.FILL #639
+D24640	.FILL #640
+D24641	.FILL #641
+D24642	.FILL #642
+D24643	.FILL #643
+D24644	.FILL #644
+D24645	.FILL #645
+D24646	.FILL #646
+D24647	.FILL #647
+D24648	.FILL #648
+D24649	.FILL #649
+D24650	.FILL #650
+D24651	.FILL #651
+D24652	.FILL #652
+D24653	.FILL #653
+D24654	.FILL #654
+D24655	.FILL #655
+D24656	.FILL #656
+D24657	.FILL #657
+D24658	.FILL #658
+D24659	.FILL #659
+D24660	.FILL #660
+D24661	.FILL #661
+D24662	.FILL #662
+D24663	.FILL #663
+D24664	.FILL #664
+D24665	.FILL #665
+D24666	.FILL #666
+D24667	.FILL #667
+D24668	.FILL #668
+D24669	.FILL #669
+D24670	.FILL #670
+D24671	.FILL #671
+D24672	.FILL #672
+D24673	.FILL #673
+D24674	.FILL #674
+D24675	.FILL #675
+D24676	.FILL #676
+D24677	.FILL #677
+D24678	.FILL #678
+D24679	.FILL #679
+D24680	.FILL #680
+D24681	.FILL #681
+D24682	.FILL #682
+D24683	.FILL #683
+D24684	.FILL #684
+D24685	.FILL #685
+D24686	.FILL #686
+D24687	.FILL #687
+D24688	.FILL #688
+D24689	.FILL #689
+D24690	.FILL #690
+D24691	.FILL #691
+D24692	.FILL #692
+D24693	.FILL #693
+D24694	.FILL #694
+D24695	.FILL #695
+D24696	.FILL #696
+D24697	.FILL #697
+D24698	.FILL #698
+D24699	.FILL #699
+D24700	.FILL #700
+D24701	.FILL #701
+D24702	.FILL #702
+D24703	.FILL #703
+D24704	.FILL #704
+D24705	.FILL #705
+D24706	.FILL #706
+D24707	.FILL #707
+D24708	.FILL #708
+D24709	.FILL #709
+D24710	.FILL #710
+D24711	.FILL #711
+D24712	.FILL #712
+D24713	.FILL #713
+D24714	.FILL #714
+D24715	.FILL #715
+D24716	.FILL #716
+D24717	.FILL #717
+D24718	.FILL #718
+D24719	.FILL #719
+D24720	.FILL #720
+D24721	.FILL #721
+D24722	.FILL #722
+D24723	.FILL #723
+D24724	.FILL #724
+D24725	.FILL #725
+D24726	.FILL #726
+D24727	.FILL #727
+D24728	.FILL #728
+D24729	.FILL #729
+D24730	.FILL #730
+D24731	.FILL #731
+D24732	.FILL #732
+D24733	.FILL #733
+D24734	.FILL #734
+D24735	.FILL #735
+D24736	.FILL #736
+D24737	.FILL #737
+D24738	.FILL #738
+D24739	.FILL #739
+D24740	.FILL #740
+D24741	.FILL #741
+D24742	.FILL #742
+D24743	.FILL #743
+D24744	.FILL #744
+D24745	.FILL #745
+D24746	.FILL #746
+D24747	.FILL #747
+D24748	.FILL #748
+D24749	.FILL #749
+D24750	.FILL #750
+D24751	.FILL #751
+D24752	.FILL #752
+D24753	.FILL #753
+D24754	.FILL #754
+D24755	.FILL #755
+D24756	.FILL #756
+D24757	.FILL #757
+D24758	.FILL #758
+D24759	.FILL #759
+D24760	.FILL #760
+D24761	.FILL #761
+D24762	.FILL #762
+D24763	.FILL #763
+D24764	.FILL #764
+D24765	.FILL #765
+D24766	.FILL #766
+D24767	.FILL #767
+D24768	.FILL #768
+D24769	.FILL #769
+D24770	.FILL #770
+D24771	.FILL #771
+D24772	.FILL #772
+D24773	.FILL #773
+D24774	.FILL #774
+D24775	.FILL #775
+D24776	.FILL #776
+D24777	.FILL #777
+D24778	.FILL #778
+D24779	.FILL #779
+D24780	.FILL #780
+D24781	.FILL #781
+D24782	.FILL #782
+D24783	.FILL #783
+D24784	.FILL #784
+D24785	.FILL #785
+D24786	.FILL #786
+D24787	.FILL #787
+D24788	.FILL #788
+D24789	.FILL #789
+D24790	.FILL #790
+D24791	.FILL #791
+D24792	.FILL #792
+D24793	.FILL #793
+D24794	.FILL #794
+D24795	.FILL #795
+D24796	.FILL #796
+D24797	.FILL #797
+D24798	.FILL #798
+D24799	.FILL #799
+D24800	.FILL #800
+D24801	.FILL #801
+D24802	.FILL #802
+D24803	.FILL #803
+D24804	.FILL #804
+D24805	.FILL #805
+D24806	.FILL #806
+D24807	.FILL #807
+D24808	.FILL #808
+D24809	.FILL #809
+D24810	.FILL #810
+D24811	.FILL #811
+D24812	.FILL #812
+D24813	.FILL #813
+D24814	.FILL #814
+D24815	.FILL #815
+D24816	.FILL #816
+D24817	.FILL #817
+D24818	.FILL #818
+D24819	.FILL #819
+D24820	.FILL #820
+D24821	.FILL #821
+D24822	.FILL #822
+D24823	.FILL #823
+D24824	.FILL #824
+D24825	.FILL #825
+D24826	.FILL #826
+D24827	.FILL #827
+D24828	.FILL #828
+D24829	.FILL #829
+D24830	.FILL #830
+D24831	.FILL #831
+D24832	.FILL #832
+D24833	.FILL #833
+D24834	.FILL #834
+D24835	.FILL #835
+D24836	.FILL #836
+D24837	.FILL #837
+D24838	.FILL #838
+D24839	.FILL #839
+D24840	.FILL #840
+D24841	.FILL #841
+D24842	.FILL #842
+D24843	.FILL #843
+D24844	.FILL #844
+D24845	.FILL #845
+D24846	.FILL #846
+D24847	.FILL #847
+D24848	.FILL #848
+D24849	.FILL #849
+D24850	.FILL #850
+D24851	.FILL #851
+D24852	.FILL #852
+D24853	.FILL #853
+D24854	.FILL #854
+D24855	.FILL #855
+D24856	.FILL #856
+D24857	.FILL #857
+D24858	.FILL #858
+D24859	.FILL #859
+D24860	.FILL #860
+D24861	.FILL #861
+D24862	.FILL #862
+D24863	.FILL #863
+D24864	.FILL #864
+D24865	.FILL #865
+D24866	.FILL #866
+D24867	.FILL #867
+D24868	.FILL #868
+D24869	.FILL #869
+D24870	.FILL #870
+D24871	.FILL #871
+D24872	.FILL #872
+D24873	.FILL #873
+D24874	.FILL #874
+D24875	.FILL #875
+D24876	.FILL #876
+D24877	.FILL #877
+D24878	.FILL #878
+D24879	.FILL #879
+D24880	.FILL #880
+D24881	.FILL #881
+D24882	.FILL #882
+D24883	.FILL #883
+D24884	.FILL #884
+D24885	.FILL #885
+D24886	.FILL #886
+D24887	.FILL #887
+D24888	.FILL #888
+D24889	.FILL #889
+D24890	.FILL #890
+D24891	.FILL #891
+D24892	.FILL #892
+D24893	.FILL #893
+D24894	.FILL #894
+D24895	.FILL #895
+D24896	.FILL #896
+D24897	.FILL #897
+D24898	.FILL #898
+D24899	.FILL #899
+D24900	.FILL #900
+D24901	.FILL #901
+D24902	.FILL #902
+D24903	.FILL #903
+D24904	.FILL #904
+D24905	.FILL #905
+D24906	.FILL #906
+D24907	.FILL #907
+D24908	.FILL #908
+D24909	.FILL #909
+D24910	.FILL #910
+D24911	.FILL #911
+D24912	.FILL #912
+D24913	.FILL #913
+D24914	.FILL #914
+D24915	.FILL #915
+D24916	.FILL #916
+D24917	.FILL #917
+D24918	.FILL #918
+D24919	.FILL #919
+D24920	.FILL #920
+D24921	.FILL #921
+D24922	.FILL #922
+D24923	.FILL #923
+D24924	.FILL #924
+D24925	.FILL #925
+D24926	.FILL #926
+D24927	.FILL #927
+D24928	.FILL #928
+D24929	.FILL #929
+D24930	.FILL #930
+D24931	.FILL #931
+D24932	.FILL #932
+D24933	.FILL #933
+D24934	.FILL #934
+D24935	.FILL #935
+D24936	.FILL #936
+D24937	.FILL #937
+D24938	.FILL #938
+D24939	.FILL #939
+D24940	.FILL #940
+D24941	.FILL #941
+D24942	.FILL #942
+D24943	.FILL #943
+D24944	.FILL #944
+D24945	.FILL #945
+D24946	.FILL #946
+D24947	.FILL #947
+D24948	.FILL #948
+D24949	.FILL #949
+D24950	.FILL #950
+D24951	.FILL #951
+D24952	.FILL #952
+D24953	.FILL #953
+D24954	.FILL #954
+D24955	.FILL #955
+D24956	.FILL #956
+D24957	.FILL #957
+D24958	.FILL #958
+D24959	.FILL #959
+D24960	.FILL #960
+D24961	.FILL #961
+D24962	.FILL #962
+D24963	.FILL #963
+D24964	.FILL #964
+D24965	.FILL #965
+D24966	.FILL #966
+D24967	.FILL #967
+D24968	.FILL #968
+D24969	.FILL #969
+D24970	.FILL #970
+D24971	.FILL #971
+D24972	.FILL #972
+D24973	.FILL #973
+D24974	.FILL #974
+D24975	.FILL #975
+D24976	.FILL #976
+D24977	.FILL #977
+D24978	.FILL #978
+D24979	.FILL #979
+D24980	.FILL #980
+D24981	.FILL #981
+D24982	.FILL #982
+D24983	.FILL #983
+D24984	.FILL #984
+D24985	.FILL #985
+D24986	.FILL #986
+D24987	.FILL #987
+D24988	.FILL #988
+D24989	.FILL #989
+D24990	.FILL #990
+D24991	.FILL #991
+D24992	.FILL #992
+D24993	.FILL #993
+D24994	.FILL #994
+D24995	.FILL #995
+D24996	.FILL #996
+D24997	.FILL #997
+D24998	.FILL #998
+D24999	.FILL #999
+	.END
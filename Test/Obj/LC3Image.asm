@@ -0,0 +1,503 @@
+	.ORIG x0200
+LOOP	BRnzp LOOP
+D0	DATA8[] 4x00123456789AB, 4x10123456789AB, 4x20123456789AB, 4x30123456789AB, 4x40123456789AB, 4x50123456789AB, 4x60123456789AB, 4x70123456789AB, 4x80123456789AB, 4x90123456789AB, 4xa0123456789AB, 4xb0123456789AB, 4xc0123456789AB, 4xd0123456789AB, 4xe0123456789AB, 4xf0123456789AB, 4x100123456789AB, 4x110123456789AB, 4x120123456789AB, 4x130123456789AB, 4x140123456789AB, 4x150123456789AB, 4x160123456789AB, 4x170123456789AB, 4x180123456789AB, 4x190123456789AB, 4x1a0123456789AB, 4x1b0123456789AB, 4x1c0123456789AB, 4x1d0123456789AB, 4x1e0123456789AB, 4x1f0123456789AB
+D1	DATA8[] 4x200123456789AB, 4x210123456789AB, 4x220123456789AB, 4x230123456789AB, 4x240123456789AB, 4x250123456789AB, 4x260123456789AB, 4x270123456789AB, 4x280123456789AB, 4x290123456789AB, 4x2a0123456789AB, 4x2b0123456789AB, 4x2c0123456789AB, 4x2d0123456789AB, 4x2e0123456789AB, 4x2f0123456789AB, 4x300123456789AB, 4x310123456789AB, 4x320123456789AB, 4x330123456789AB, 4x340123456789AB, 4x350123456789AB, 4x360123456789AB, 4x370123456789AB, 4x380123456789AB, 4x390123456789AB, 4x3a0123456789AB, 4x3b0123456789AB, 4x3c0123456789AB, 4x3d0123456789AB, 4x3e0123456789AB, 4x3f0123456789AB
+D2	DATA8[] 4x400123456789AB, 4x410123456789AB, 4x420123456789AB, 4x430123456789AB, 4x440123456789AB, 4x450123456789AB, 4x460123456789AB, 4x470123456789AB, 4x480123456789AB, 4x490123456789AB, 4x4a0123456789AB, 4x4b0123456789AB, 4x4c0123456789AB, 4x4d0123456789AB, 4x4e0123456789AB, 4x4f0123456789AB, 4x500123456789AB, 4x510123456789AB, 4x520123456789AB, 4x530123456789AB, 4x540123456789AB, 4x550123456789AB, 4x560123456789AB, 4x570123456789AB, 4x580123456789AB, 4x590123456789AB, 4x5a0123456789AB, 4x5b0123456789AB, 4x5c0123456789AB, 4x5d0123456789AB, 4x5e0123456789AB, 4x5f0123456789AB
+D3	DATA8[] 4x600123456789AB, 4x610123456789AB, 4x620123456789AB, 4x630123456789AB, 4x640123456789AB, 4x650123456789AB, 4x660123456789AB, 4x670123456789AB, 4x680123456789AB, 4x690123456789AB, 4x6a0123456789AB, 4x6b0123456789AB, 4x6c0123456789AB, 4x6d0123456789AB, 4x6e0123456789AB, 4x6f0123456789AB, 4x700123456789AB, 4x710123456789AB, 4x720123456789AB, 4x730123456789AB, 4x740123456789AB, 4x750123456789AB, 4x760123456789AB, 4x770123456789AB, 4x780123456789AB, 4x790123456789AB, 4x7a0123456789AB, 4x7b0123456789AB, 4x7c0123456789AB, 4x7d0123456789AB, 4x7e0123456789AB, 4x7f0123456789AB
+D4	DATA8[] 4x800123456789AB, 4x810123456789AB, 4x820123456789AB, 4x830123456789AB, 4x840123456789AB, 4x850123456789AB, 4x860123456789AB, 4x870123456789AB, 4x880123456789AB, 4x890123456789AB, 4x8a0123456789AB, 4x8b0123456789AB, 4x8c0123456789AB, 4x8d0123456789AB, 4x8e0123456789AB, 4x8f0123456789AB, 4x900123456789AB, 4x910123456789AB, 4x920123456789AB, 4x930123456789AB, 4x940123456789AB, 4x950123456789AB, 4x960123456789AB, 4x970123456789AB, 4x980123456789AB, 4x990123456789AB, 4x9a0123456789AB, 4x9b0123456789AB, 4x9c0123456789AB, 4x9d0123456789AB, 4x9e0123456789AB, 4x9f0123456789AB
+D5	DATA8[] 4xa00123456789AB, 4xa10123456789AB, 4xa20123456789AB, 4xa30123456789AB, 4xa40123456789AB, 4xa50123456789AB, 4xa60123456789AB, 4xa70123456789AB, 4xa80123456789AB, 4xa90123456789AB, 4xaa0123456789AB, 4xab0123456789AB, 4xac0123456789AB, 4xad0123456789AB, 4xae0123456789AB, 4xaf0123456789AB, 4xb00123456789AB, 4xb10123456789AB, 4xb20123456789AB, 4xb30123456789AB, 4xb40123456789AB, 4xb50123456789AB, 4xb60123456789AB, 4xb70123456789AB, 4xb80123456789AB, 4xb90123456789AB, 4xba0123456789AB, 4xbb0123456789AB, 4xbc0123456789AB, 4xbd0123456789AB, 4xbe0123456789AB, 4xbf0123456789AB
+D6	DATA8[] 4xc00123456789AB, 4xc10123456789AB, 4xc20123456789AB, 4xc30123456789AB, 4xc40123456789AB, 4xc50123456789AB, 4xc60123456789AB, 4xc70123456789AB, 4xc80123456789AB, 4xc90123456789AB, 4xca0123456789AB, 4xcb0123456789AB, 4xcc0123456789AB, 4xcd0123456789AB, 4xce0123456789AB, 4xcf0123456789AB, 4xd00123456789AB, 4xd10123456789AB, 4xd20123456789AB, 4xd30123456789AB, 4xd40123456789AB, 4xd50123456789AB, 4xd60123456789AB, 4xd70123456789AB, 4xd80123456789AB, 4xd90123456789AB, 4xda0123456789AB, 4xdb0123456789AB, 4xdc0123456789AB, 4xdd0123456789AB, 4xde0123456789AB, 4xdf0123456789AB
+D7	DATA8[] 4xe00123456789AB, 4xe10123456789AB, 4xe20123456789AB, 4xe30123456789AB, 4xe40123456789AB, 4xe50123456789AB, 4xe60123456789AB, 4xe70123456789AB, 4xe80123456789AB, 4xe90123456789AB, 4xea0123456789AB, 4xeb0123456789AB, 4xec0123456789AB, 4xed0123456789AB, 4xee0123456789AB, 4xef0123456789AB, 4xf00123456789AB, 4xf10123456789AB, 4xf20123456789AB, 4xf30123456789AB, 4xf40123456789AB, 4xf50123456789AB, 4xf60123456789AB, 4xf70123456789AB, 4xf80123456789AB, 4xf90123456789AB, 4xfa0123456789AB, 4xfb0123456789AB, 4xfc0123456789AB, 4xfd0123456789AB, 4xfe0123456789AB, 4xff0123456789AB
+D8	DATA8[] 4x1000123456789AB, 4x1010123456789AB, 4x1020123456789AB, 4x1030123456789AB, 4x1040123456789AB, 4x1050123456789AB, 4x1060123456789AB, 4x1070123456789AB, 4x1080123456789AB, 4x1090123456789AB, 4x10a0123456789AB, 4x10b0123456789AB, 4x10c0123456789AB, 4x10d0123456789AB, 4x10e0123456789AB, 4x10f0123456789AB, 4x1100123456789AB, 4x1110123456789AB, 4x1120123456789AB, 4x1130123456789AB, 4x1140123456789AB, 4x1150123456789AB, 4x1160123456789AB, 4x1170123456789AB, 4x1180123456789AB, 4x1190123456789AB, 4x11a0123456789AB, 4x11b0123456789AB, 4x11c0123456789AB, 4x11d0123456789AB, 4x11e0123456789AB, 4x11f0123456789AB
+D9	DATA8[] 4x1200123456789AB, 4x1210123456789AB, 4x1220123456789AB, 4x1230123456789AB, 4x1240123456789AB, 4x1250123456789AB, 4x1260123456789AB, 4x1270123456789AB, 4x1280123456789AB, 4x1290123456789AB, 4x12a0123456789AB, 4x12b0123456789AB, 4x12c0123456789AB, 4x12d0123456789AB, 4x12e0123456789AB, 4x12f0123456789AB, 4x1300123456789AB, 4x1310123456789AB, 4x1320123456789AB, 4x1330123456789AB, 4x1340123456789AB, 4x1350123456789AB, 4x1360123456789AB, 4x1370123456789AB, 4x1380123456789AB, 4x1390123456789AB, 4x13a0123456789AB, 4x13b0123456789AB, 4x13c0123456789AB, 4x13d0123456789AB, 4x13e0123456789AB, 4x13f0123456789AB
+D10	DATA8[] 4x1400123456789AB, 4x1410123456789AB, 4x1420123456789AB, 4x1430123456789AB, 4x1440123456789AB, 4x1450123456789AB, 4x1460123456789AB, 4x1470123456789AB, 4x1480123456789AB, 4x1490123456789AB, 4x14a0123456789AB, 4x14b0123456789AB, 4x14c0123456789AB, 4x14d0123456789AB, 4x14e0123456789AB, 4x14f0123456789AB, 4x1500123456789AB, 4x1510123456789AB, 4x1520123456789AB, 4x1530123456789AB, 4x1540123456789AB, 4x1550123456789AB, 4x1560123456789AB, 4x1570123456789AB, 4x1580123456789AB, 4x1590123456789AB, 4x15a0123456789AB, 4x15b0123456789AB, 4x15c0123456789AB, 4x15d0123456789AB, 4x15e0123456789AB, 4x15f0123456789AB
+D11	DATA8[] 4x1600123456789AB, 4x1610123456789AB, 4x1620123456789AB, 4x1630123456789AB, 4x1640123456789AB, 4x1650123456789AB, 4x1660123456789AB, 4x1670123456789AB, 4x1680123456789AB, 4x1690123456789AB, 4x16a0123456789AB, 4x16b0123456789AB, 4x16c0123456789AB, 4x16d0123456789AB, 4x16e0123456789AB, 4x16f0123456789AB, 4x1700123456789AB, 4x1710123456789AB, 4x1720123456789AB, 4x1730123456789AB, 4x1740123456789AB, 4x1750123456789AB, 4x1760123456789AB, 4x1770123456789AB, 4x1780123456789AB, 4x1790123456789AB, 4x17a0123456789AB, 4x17b0123456789AB, 4x17c0123456789AB, 4x17d0123456789AB, 4x17e0123456789AB, 4x17f0123456789AB
+D12	DATA8[] 4x1800123456789AB, 4x1810123456789AB, 4x1820123456789AB, 4x1830123456789AB, 4x1840123456789AB, 4x1850123456789AB, 4x1860123456789AB, 4x1870123456789AB, 4x1880123456789AB, 4x1890123456789AB, 4x18a0123456789AB, 4x18b0123456789AB, 4x18c0123456789AB, 4x18d0123456789AB, 4x18e0123456789AB, 4x18f0123456789AB, 4x1900123456789AB, 4x1910123456789AB, 4x1920123456789AB, 4x1930123456789AB, 4x1940123456789AB, 4x1950123456789AB, 4x1960123456789AB, 4x1970123456789AB, 4x1980123456789AB, 4x1990123456789AB, 4x19a0123456789AB, 4x19b0123456789AB, 4x19c0123456789AB, 4x19d0123456789AB, 4x19e0123456789AB, 4x19f0123456789AB
+D13	DATA8[] 4x1a00123456789AB, 4x1a10123456789AB, 4x1a20123456789AB, 4x1a30123456789AB, 4x1a40123456789AB, 4x1a50123456789AB, 4x1a60123456789AB, 4x1a70123456789AB, 4x1a80123456789AB, 4x1a90123456789AB, 4x1aa0123456789AB, 4x1ab0123456789AB, 4x1ac0123456789AB, 4x1ad0123456789AB, 4x1ae0123456789AB, 4x1af0123456789AB, 4x1b00123456789AB, 4x1b10123456789AB, 4x1b20123456789AB, 4x1b30123456789AB, 4x1b40123456789AB, 4x1b50123456789AB, 4x1b60123456789AB, 4x1b70123456789AB, 4x1b80123456789AB, 4x1b90123456789AB, 4x1ba0123456789AB, 4x1bb0123456789AB, 4x1bc0123456789AB, 4x1bd0123456789AB, 4x1be0123456789AB, 4x1bf0123456789AB
+D14	DATA8[] 4x1c00123456789AB, 4x1c10123456789AB, 4x1c20123456789AB, 4x1c30123456789AB, 4x1c40123456789AB, 4x1c50123456789AB, 4x1c60123456789AB, 4x1c70123456789AB, 4x1c80123456789AB, 4x1c90123456789AB, 4x1ca0123456789AB, 4x1cb0123456789AB, 4x1cc0123456789AB, 4x1cd0123456789AB, 4x1ce0123456789AB, 4x1cf0123456789AB, 4x1d00123456789AB, 4x1d10123456789AB, 4x1d20123456789AB, 4x1d30123456789AB, 4x1d40123456789AB, 4x1d50123456789AB, 4x1d60123456789AB, 4x1d70123456789AB, 4x1d80123456789AB, 4x1d90123456789AB, 4x1da0123456789AB, 4x1db0123456789AB, 4x1dc0123456789AB, 4x1dd0123456789AB, 4x1de0123456789AB, 4x1df0123456789AB
+D15	DATA8[] 4x1e00123456789AB, 4x1e10123456789AB, 4x1e20123456789AB, 4x1e30123456789AB, 4x1e40123456789AB, 4x1e50123456789AB, 4x1e60123456789AB, 4x1e70123456789AB, 4x1e80123456789AB, 4x1e90123456789AB, 4x1ea0123456789AB, 4x1eb0123456789AB, 4x1ec0123456789AB, 4x1ed0123456789AB, 4x1ee0123456789AB, 4x1ef0123456789AB, 4x1f00123456789AB, 4x1f10123456789AB, 4x1f20123456789AB, 4x1f30123456789AB, 4x1f40123456789AB, 4x1f50123456789AB, 4x1f60123456789AB, 4x1f70123456789AB, 4x1f80123456789AB, 4x1f90123456789AB, 4x1fa0123456789AB, 4x1fb0123456789AB, 4x1fc0123456789AB, 4x1fd0123456789AB, 4x1fe0123456789AB, 4x1ff0123456789AB
+D16	DATA8[] 4x2000123456789AB, 4x2010123456789AB, 4x2020123456789AB, 4x2030123456789AB, 4x2040123456789AB, 4x2050123456789AB, 4x2060123456789AB, 4x2070123456789AB, 4x2080123456789AB, 4x2090123456789AB, 4x20a0123456789AB, 4x20b0123456789AB, 4x20c0123456789AB, 4x20d0123456789AB, 4x20e0123456789AB, 4x20f0123456789AB, 4x2100123456789AB, 4x2110123456789AB, 4x2120123456789AB, 4x2130123456789AB, 4x2140123456789AB, 4x2150123456789AB, 4x2160123456789AB, 4x2170123456789AB, 4x2180123456789AB, 4x2190123456789AB, 4x21a0123456789AB, 4x21b0123456789AB, 4x21c0123456789AB, 4x21d0123456789AB, 4x21e0123456789AB, 4x21f0123456789AB
+D17	DATA8[] 4x2200123456789AB, 4x2210123456789AB, 4x2220123456789AB, 4x2230123456789AB, 4x2240123456789AB, 4x2250123456789AB, 4x2260123456789AB, 4x2270123456789AB, 4x2280123456789AB, 4x2290123456789AB, 4x22a0123456789AB, 4x22b0123456789AB, 4x22c0123456789AB, 4x22d0123456789AB, 4x22e0123456789AB, 4x22f0123456789AB, 4x2300123456789AB, 4x2310123456789AB, 4x2320123456789AB, 4x2330123456789AB, 4x2340123456789AB, 4x2350123456789AB, 4x2360123456789AB, 4x2370123456789AB, 4x2380123456789AB, 4x2390123456789AB, 4x23a0123456789AB, 4x23b0123456789AB, 4x23c0123456789AB, 4x23d0123456789AB, 4x23e0123456789AB, 4x23f0123456789AB
+D18	DATA8[] 4x2400123456789AB, 4x2410123456789AB, 4x2420123456789AB, 4x2430123456789AB, 4x2440123456789AB, 4x2450123456789AB, 4x2460123456789AB, 4x2470123456789AB, 4x2480123456789AB, 4x2490123456789AB, 4x24a0123456789AB, 4x24b0123456789AB, 4x24c0123456789AB, 4x24d0123456789AB, 4x24e0123456789AB, 4x24f0123456789AB, 4x2500123456789AB, 4x2510123456789AB, 4x2520123456789AB, 4x2530123456789AB, 4x2540123456789AB, 4x2550123456789AB, 4x2560123456789AB, 4x2570123456789AB, 4x2580123456789AB, 4x2590123456789AB, 4x25a0123456789AB, 4x25b0123456789AB, 4x25c0123456789AB, 4x25d0123456789AB, 4x25e0123456789AB, 4x25f0123456789AB
+D19	DATA8[] 4x2600123456789AB, 4x2610123456789AB, 4x2620123456789AB, 4x2630123456789AB, 4x2640123456789AB, 4x2650123456789AB, 4x2660123456789AB, 4x2670123456789AB, 4x2680123456789AB, 4x2690123456789AB, 4x26a0123456789AB, 4x26b0123456789AB, 4x26c0123456789AB, 4x26d0123456789AB, 4x26e0123456789AB, 4x26f0123456789AB, 4x2700123456789AB, 4x2710123456789AB, 4x2720123456789AB, 4x2730123456789AB, 4x2740123456789AB, 4x2750123456789AB, 4x2760123456789AB, 4x2770123456789AB, 4x2780123456789AB, 4x2790123456789AB, 4x27a0123456789AB, 4x27b0123456789AB, 4x27c0123456789AB, 4x27d0123456789AB, 4x27e0123456789AB, 4x27f0123456789AB
+D20	DATA8[] 4x2800123456789AB, 4x2810123456789AB, 4x2820123456789AB, 4x2830123456789AB, 4x2840123456789AB, 4x2850123456789AB, 4x2860123456789AB, 4x2870123456789AB, 4x2880123456789AB, 4x2890123456789AB, 4x28a0123456789AB, 4x28b0123456789AB, 4x28c0123456789AB, 4x28d0123456789AB, 4x28e0123456789AB, 4x28f0123456789AB, 4x2900123456789AB, 4x2910123456789AB, 4x2920123456789AB, 4x2930123456789AB, 4x2940123456789AB, 4x2950123456789AB, 4x2960123456789AB, 4x2970123456789AB, 4x2980123456789AB, 4x2990123456789AB, 4x29a0123456789AB, 4x29b0123456789AB, 4x29c0123456789AB, 4x29d0123456789AB, 4x29e0123456789AB, 4x29f0123456789AB
+D21	DATA8[] 4x2a00123456789AB, 4x2a10123456789AB, 4x2a20123456789AB, 4x2a30123456789AB, 4x2a40123456789AB, 4x2a50123456789AB, 4x2a60123456789AB, 4x2a70123456789AB, 4x2a80123456789AB, 4x2a90123456789AB, 4x2aa0123456789AB, 4x2ab0123456789AB, 4x2ac0123456789AB, 4x2ad0123456789AB, 4x2ae0123456789AB, 4x2af0123456789AB, 4x2b00123456789AB, 4x2b10123456789AB, 4x2b20123456789AB, 4x2b30123456789AB, 4x2b40123456789AB, 4x2b50123456789AB, 4x2b60123456789AB, 4x2b70123456789AB, 4x2b80123456789AB, 4x2b90123456789AB, 4x2ba0123456789AB, 4x2bb0123456789AB, 4x2bc0123456789AB, 4x2bd0123456789AB, 4x2be0123456789AB, 4x2bf0123456789AB
+D22	DATA8[] 4x2c00123456789AB, 4x2c10123456789AB, 4x2c20123456789AB, 4x2c30123456789AB, 4x2c40123456789AB, 4x2c50123456789AB, 4x2c60123456789AB, 4x2c70123456789AB, 4x2c80123456789AB, 4x2c90123456789AB, 4x2ca0123456789AB, 4x2cb0123456789AB, 4x2cc0123456789AB, 4x2cd0123456789AB, 4x2ce0123456789AB, 4x2cf0123456789AB, 4x2d00123456789AB, 4x2d10123456789AB, 4x2d20123456789AB, 4x2d30123456789AB, 4x2d40123456789AB, 4x2d50123456789AB, 4x2d60123456789AB, 4x2d70123456789AB, 4x2d80123456789AB, 4x2d90123456789AB, 4x2da0123456789AB, 4x2db0123456789AB, 4x2dc0123456789AB, 4x2dd0123456789AB, 4x2de0123456789AB, 4x2df0123456789AB
+D23	DATA8[] 4x2e00123456789AB, 4x2e10123456789AB, 4x2e20123456789AB, 4x2e30123456789AB, 4x2e40123456789AB, 4x2e50123456789AB, 4x2e60123456789AB, 4x2e70123456789AB, 4x2e80123456789AB, 4x2e90123456789AB, 4x2ea0123456789AB, 4x2eb0123456789AB, 4x2ec0123456789AB, 4x2ed0123456789AB, 4x2ee0123456789AB, 4x2ef0123456789AB, 4x2f00123456789AB, 4x2f10123456789AB, 4x2f20123456789AB, 4x2f30123456789AB, 4x2f40123456789AB, 4x2f50123456789AB, 4x2f60123456789AB, 4x2f70123456789AB, 4x2f80123456789AB, 4x2f90123456789AB, 4x2fa0123456789AB, 4x2fb0123456789AB, 4x2fc0123456789AB, 4x2fd0123456789AB, 4x2fe0123456789AB, 4x2ff0123456789AB
+D24	DATA8[] 4x3000123456789AB, 4x3010123456789AB, 4x3020123456789AB, 4x3030123456789AB, 4x3040123456789AB, 4x3050123456789AB, 4x3060123456789AB, 4x3070123456789AB, 4x3080123456789AB, 4x3090123456789AB, 4x30a0123456789AB, 4x30b0123456789AB, 4x30c0123456789AB, 4x30d0123456789AB, 4x30e0123456789AB, 4x30f0123456789AB, 4x3100123456789AB, 4x3110123456789AB, 4x3120123456789AB, 4x3130123456789AB, 4x3140123456789AB, 4x3150123456789AB, 4x3160123456789AB, 4x3170123456789AB, 4x3180123456789AB, 4x3190123456789AB, 4x31a0123456789AB, 4x31b0123456789AB, 4x31c0123456789AB, 4x31d0123456789AB, 4x31e0123456789AB, 4x31f0123456789AB
+D25	DATA8[] 4x3200123456789AB, 4x3210123456789AB, 4x3220123456789AB, 4x3230123456789AB, 4x3240123456789AB, 4x3250123456789AB, 4x3260123456789AB, 4x3270123456789AB, 4x3280123456789AB, 4x3290123456789AB, 4x32a0123456789AB, 4x32b0123456789AB, 4x32c0123456789AB, 4x32d0123456789AB, 4x32e0123456789AB, 4x32f0123456789AB, 4x3300123456789AB, 4x3310123456789AB, 4x3320123456789AB, 4x3330123456789AB, 4x3340123456789AB, 4x3350123456789AB, 4x3360123456789AB, 4x3370123456789AB, 4x3380123456789AB, 4x3390123456789AB, 4x33a0123456789AB, 4x33b0123456789AB, 4x33c0123456789AB, 4x33d0123456789AB, 4x33e0123456789AB, 4x33f0123456789AB
+D26	DATA8[] 4x3400123456789AB, 4x3410123456789AB, 4x3420123456789AB, 4x3430123456789AB, 4x3440123456789AB, 4x3450123456789AB, 4x3460123456789AB, 4x3470123456789AB, 4x3480123456789AB, 4x3490123456789AB, 4x34a0123456789AB, 4x34b0123456789AB, 4x34c0123456789AB, 4x34d0123456789AB, 4x34e0123456789AB, 4x34f0123456789AB, 4x3500123456789AB, 4x3510123456789AB, 4x3520123456789AB, 4x3530123456789AB, 4x3540123456789AB, 4x3550123456789AB, 4x3560123456789AB, 4x3570123456789AB, 4x3580123456789AB, 4x3590123456789AB, 4x35a0123456789AB, 4x35b0123456789AB, 4x35c0123456789AB, 4x35d0123456789AB, 4x35e0123456789AB, 4x35f0123456789AB
+D27	DATA8[] 4x3600123456789AB, 4x3610123456789AB, 4x3620123456789AB, 4x3630123456789AB, 4x3640123456789AB, 4x3650123456789AB, 4x3660123456789AB, 4x3670123456789AB, 4x3680123456789AB, 4x3690123456789AB, 4x36a0123456789AB, 4x36b0123456789AB, 4x36c0123456789AB, 4x36d0123456789AB, 4x36e0123456789AB, 4x36f0123456789AB, 4x3700123456789AB, 4x3710123456789AB, 4x3720123456789AB, 4x3730123456789AB, 4x3740123456789AB, 4x3750123456789AB, 4x3760123456789AB, 4x3770123456789AB, 4x3780123456789AB, 4x3790123456789AB, 4x37a0123456789AB, 4x37b0123456789AB, 4x37c0123456789AB, 4x37d0123456789AB, 4x37e0123456789AB, 4x37f0123456789AB
+D28	DATA8[] 4x3800123456789AB, 4x3810123456789AB, 4x3820123456789AB, 4x3830123456789AB, 4x3840123456789AB, 4x3850123456789AB, 4x3860123456789AB, 4x3870123456789AB, 4x3880123456789AB, 4x3890123456789AB, 4x38a0123456789AB, 4x38b0123456789AB, 4x38c0123456789AB, 4x38d0123456789AB, 4x38e0123456789AB, 4x38f0123456789AB, 4x3900123456789AB, 4x3910123456789AB, 4x3920123456789AB, 4x3930123456789AB, 4x3940123456789AB, 4x3950123456789AB, 4x3960123456789AB, 4x3970123456789AB, 4x3980123456789AB, 4x3990123456789AB, 4x39a0123456789AB, 4x39b0123456789AB, 4x39c0123456789AB, 4x39d0123456789AB, 4x39e0123456789AB, 4x39f0123456789AB
+D29	DATA8[] 4x3a00123456789AB, 4x3a10123456789AB, 4x3a20123456789AB, 4x3a30123456789AB, 4x3a40123456789AB, 4x3a50123456789AB, 4x3a60123456789AB, 4x3a70123456789AB, 4x3a80123456789AB, 4x3a90123456789AB, 4x3aa0123456789AB, 4x3ab0123456789AB, 4x3ac0123456789AB, 4x3ad0123456789AB, 4x3ae0123456789AB, 4x3af0123456789AB, 4x3b00123456789AB, 4x3b10123456789AB, 4x3b20123456789AB, 4x3b30123456789AB, 4x3b40123456789AB, 4x3b50123456789AB, 4x3b60123456789AB, 4x3b70123456789AB, 4x3b80123456789AB, 4x3b90123456789AB, 4x3ba0123456789AB, 4x3bb0123456789AB, 4x3bc0123456789AB, 4x3bd0123456789AB, 4x3be0123456789AB, 4x3bf0123456789AB
+D30	DATA8[] 4x3c00123456789AB, 4x3c10123456789AB, 4x3c20123456789AB, 4x3c30123456789AB, 4x3c40123456789AB, 4x3c50123456789AB, 4x3c60123456789AB, 4x3c70123456789AB, 4x3c80123456789AB, 4x3c90123456789AB, 4x3ca0123456789AB, 4x3cb0123456789AB, 4x3cc0123456789AB, 4x3cd0123456789AB, 4x3ce0123456789AB, 4x3cf0123456789AB, 4x3d00123456789AB, 4x3d10123456789AB, 4x3d20123456789AB, 4x3d30123456789AB, 4x3d40123456789AB, 4x3d50123456789AB, 4x3d60123456789AB, 4x3d70123456789AB, 4x3d80123456789AB, 4x3d90123456789AB, 4x3da0123456789AB, 4x3db0123456789AB, 4x3dc0123456789AB, 4x3dd0123456789AB, 4x3de0123456789AB, 4x3df0123456789AB
+D31	DATA8[] 4x3e00123456789AB, 4x3e10123456789AB, 4x3e20123456789AB, 4x3e30123456789AB, 4x3e40123456789AB, 4x3e50123456789AB, 4x3e60123456789AB, 4x3e70123456789AB, 4x3e80123456789AB, 4x3e90123456789AB, 4x3ea0123456789AB, 4x3eb0123456789AB, 4x3ec0123456789AB, 4x3ed0123456789AB, 4x3ee0123456789AB, 4x3ef0123456789AB, 4x3f00123456789AB, 4x3f10123456789AB, 4x3f20123456789AB, 4x3f30123456789AB, 4x3f40123456789AB, 4x3f50123456789AB, 4x3f60123456789AB, 4x3f70123456789AB, 4x3f80123456789AB, 4x3f90123456789AB, 4x3fa0123456789AB, 4x3fb0123456789AB, 4x3fc0123456789AB, 4x3fd0123456789AB, 4x3fe0123456789AB, 4x3ff0123456789AB
+D32	DATA8[] 4x4000123456789AB, 4x4010123456789AB, 4x4020123456789AB, 4x4030123456789AB, 4x4040123456789AB, 4x4050123456789AB, 4x4060123456789AB, 4x4070123456789AB, 4x4080123456789AB, 4x4090123456789AB, 4x40a0123456789AB, 4x40b0123456789AB, 4x40c0123456789AB, 4x40d0123456789AB, 4x40e0123456789AB, 4x40f0123456789AB, 4x4100123456789AB, 4x4110123456789AB, 4x4120123456789AB, 4x4130123456789AB, 4x4140123456789AB, 4x4150123456789AB, 4x4160123456789AB, 4x4170123456789AB, 4x4180123456789AB, 4x4190123456789AB, 4x41a0123456789AB, 4x41b0123456789AB, 4x41c0123456789AB, 4x41d0123456789AB, 4x41e0123456789AB, 4x41f0123456789AB
+D33	DATA8[] 4x4200123456789AB, 4x4210123456789AB, 4x4220123456789AB, 4x4230123456789AB, 4x4240123456789AB, 4x4250123456789AB, 4x4260123456789AB, 4x4270123456789AB, 4x4280123456789AB, 4x4290123456789AB, 4x42a0123456789AB, 4x42b0123456789AB, 4x42c0123456789AB, 4x42d0123456789AB, 4x42e0123456789AB, 4x42f0123456789AB, 4x4300123456789AB, 4x4310123456789AB, 4x4320123456789AB, 4x4330123456789AB, 4x4340123456789AB, 4x4350123456789AB, 4x4360123456789AB, 4x4370123456789AB, 4x4380123456789AB, 4x4390123456789AB, 4x43a0123456789AB, 4x43b0123456789AB, 4x43c0123456789AB, 4x43d0123456789AB, 4x43e0123456789AB, 4x43f0123456789AB
+D34	DATA8[] 4x4400123456789AB, 4x4410123456789AB, 4x4420123456789AB, 4x4430123456789AB, 4x4440123456789AB, 4x4450123456789AB, 4x4460123456789AB, 4x4470123456789AB, 4x4480123456789AB, 4x4490123456789AB, 4x44a0123456789AB, 4x44b0123456789AB, 4x44c0123456789AB, 4x44d0123456789AB, 4x44e0123456789AB, 4x44f0123456789AB, 4x4500123456789AB, 4x4510123456789AB, 4x4520123456789AB, 4x4530123456789AB, 4x4540123456789AB, 4x4550123456789AB, 4x4560123456789AB, 4x4570123456789AB, 4x4580123456789AB, 4x4590123456789AB, 4x45a0123456789AB, 4x45b0123456789AB, 4x45c0123456789AB, 4x45d0123456789AB, 4x45e0123456789AB, 4x45f0123456789AB
+D35	DATA8[] 4x4600123456789AB, 4x4610123456789AB, 4x4620123456789AB, 4x4630123456789AB, 4x4640123456789AB, 4x4650123456789AB, 4x4660123456789AB, 4x4670123456789AB, 4x4680123456789AB, 4x4690123456789AB, 4x46a0123456789AB, 4x46b0123456789AB, 4x46c0123456789AB, 4x46d0123456789AB, 4x46e0123456789AB, 4x46f0123456789AB, 4x4700123456789AB, 4x4710123456789AB, 4x4720123456789AB, 4x4730123456789AB, 4x4740123456789AB, 4x4750123456789AB, 4x4760123456789AB, 4x4770123456789AB, 4x4780123456789AB, 4x4790123456789AB, 4x47a0123456789AB, 4x47b0123456789AB, 4x47c0123456789AB, 4x47d0123456789AB, 4x47e0123456789AB, 4x47f0123456789AB
+D36	DATA8[] 4x4800123456789AB, 4x4810123456789AB, 4x4820123456789AB, 4x4830123456789AB, 4x4840123456789AB, 4x4850123456789AB, 4x4860123456789AB, 4x4870123456789AB, 4x4880123456789AB, 4x4890123456789AB, 4x48a0123456789AB, 4x48b0123456789AB, 4x48c0123456789AB, 4x48d0123456789AB, 4x48e0123456789AB, 4x48f0123456789AB, 4x4900123456789AB, 4x4910123456789AB, 4x4920123456789AB, 4x4930123456789AB, 4x4940123456789AB, 4x4950123456789AB, 4x4960123456789AB, 4x4970123456789AB, 4x4980123456789AB, 4x4990123456789AB, 4x49a0123456789AB, 4x49b0123456789AB, 4x49c0123456789AB, 4x49d0123456789AB, 4x49e0123456789AB, 4x49f0123456789AB
+D37	DATA8[] 4x4a00123456789AB, 4x4a10123456789AB, 4x4a20123456789AB, 4x4a30123456789AB, 4x4a40123456789AB, 4x4a50123456789AB, 4x4a60123456789AB, 4x4a70123456789AB, 4x4a80123456789AB, 4x4a90123456789AB, 4x4aa0123456789AB, 4x4ab0123456789AB, 4x4ac0123456789AB, 4x4ad0123456789AB, 4x4ae0123456789AB, 4x4af0123456789AB, 4x4b00123456789AB, 4x4b10123456789AB, 4x4b20123456789AB, 4x4b30123456789AB, 4x4b40123456789AB, 4x4b50123456789AB, 4x4b60123456789AB, 4x4b70123456789AB, 4x4b80123456789AB, 4x4b90123456789AB, 4x4ba0123456789AB, 4x4bb0123456789AB, 4x4bc0123456789AB, 4x4bd0123456789AB, 4x4be0123456789AB, 4x4bf0123456789AB
+D38	DATA8[] 4x4c00123456789AB, 4x4c10123456789AB, 4x4c20123456789AB, 4x4c30123456789AB, 4x4c40123456789AB, 4x4c50123456789AB, 4x4c60123456789AB, 4x4c70123456789AB, 4x4c80123456789AB, 4x4c90123456789AB, 4x4ca0123456789AB, 4x4cb0123456789AB, 4x4cc0123456789AB, 4x4cd0123456789AB, 4x4ce0123456789AB, 4x4cf0123456789AB, 4x4d00123456789AB, 4x4d10123456789AB, 4x4d20123456789AB, 4x4d30123456789AB, 4x4d40123456789AB, 4x4d50123456789AB, 4x4d60123456789AB, 4x4d70123456789AB, 4x4d80123456789AB, 4x4d90123456789AB, 4x4da0123456789AB, 4x4db0123456789AB, 4x4dc0123456789AB, 4x4dd0123456789AB, 4x4de0123456789AB, 4x4df0123456789AB
+D39	DATA8[] 4x4e00123456789AB, 4x4e10123456789AB, 4x4e20123456789AB, 4x4e30123456789AB, 4x4e40123456789AB, 4x4e50123456789AB, 4x4e60123456789AB, 4x4e70123456789AB, 4x4e80123456789AB, 4x4e90123456789AB, 4x4ea0123456789AB, 4x4eb0123456789AB, 4x4ec0123456789AB, 4x4ed0123456789AB, 4x4ee0123456789AB, 4x4ef0123456789AB, 4x4f00123456789AB, 4x4f10123456789AB, 4x4f20123456789AB, 4x4f30123456789AB, 4x4f40123456789AB, 4x4f50123456789AB, 4x4f60123456789AB, 4x4f70123456789AB, 4x4f80123456789AB, 4x4f90123456789AB, 4x4fa0123456789AB, 4x4fb0123456789AB, 4x4fc0123456789AB, 4x4fd0123456789AB, 4x4fe0123456789AB, 4x4ff0123456789AB
+D40	DATA8[] 4x5000123456789AB, 4x5010123456789AB, 4x5020123456789AB, 4x5030123456789AB, 4x5040123456789AB, 4x5050123456789AB, 4x5060123456789AB, 4x5070123456789AB, 4x5080123456789AB, 4x5090123456789AB, 4x50a0123456789AB, 4x50b0123456789AB, 4x50c0123456789AB, 4x50d0123456789AB, 4x50e0123456789AB, 4x50f0123456789AB, 4x5100123456789AB, 4x5110123456789AB, 4x5120123456789AB, 4x5130123456789AB, 4x5140123456789AB, 4x5150123456789AB, 4x5160123456789AB, 4x5170123456789AB, 4x5180123456789AB, 4x5190123456789AB, 4x51a0123456789AB, 4x51b0123456789AB, 4x51c0123456789AB, 4x51d0123456789AB, 4x51e0123456789AB, 4x51f0123456789AB
+D41	DATA8[] 4x5200123456789AB, 4x5210123456789AB, 4x5220123456789AB, 4x5230123456789AB, 4x5240123456789AB, 4x5250123456789AB, 4x5260123456789AB, 4x5270123456789AB, 4x5280123456789AB, 4x5290123456789AB, 4x52a0123456789AB, 4x52b0123456789AB, 4x52c0123456789AB, 4x52d0123456789AB, 4x52e0123456789AB, 4x52f0123456789AB, 4x5300123456789AB, 4x5310123456789AB, 4x5320123456789AB, 4x5330123456789AB, 4x5340123456789AB, 4x5350123456789AB, 4x5360123456789AB, 4x5370123456789AB, 4x5380123456789AB, 4x5390123456789AB, 4x53a0123456789AB, 4x53b0123456789AB, 4x53c0123456789AB, 4x53d0123456789AB, 4x53e0123456789AB, 4x53f0123456789AB
+D42	DATA8[] 4x5400123456789AB, 4x5410123456789AB, 4x5420123456789AB, 4x5430123456789AB, 4x5440123456789AB, 4x5450123456789AB, 4x5460123456789AB, 4x5470123456789AB, 4x5480123456789AB, 4x5490123456789AB, 4x54a0123456789AB, 4x54b0123456789AB, 4x54c0123456789AB, 4x54d0123456789AB, 4x54e0123456789AB, 4x54f0123456789AB, 4x5500123456789AB, 4x5510123456789AB, 4x5520123456789AB, 4x5530123456789AB, 4x5540123456789AB, 4x5550123456789AB, 4x5560123456789AB, 4x5570123456789AB, 4x5580123456789AB, 4x5590123456789AB, 4x55a0123456789AB, 4x55b0123456789AB, 4x55c0123456789AB, 4x55d0123456789AB, 4x55e0123456789AB, 4x55f0123456789AB
+D43	DATA8[] 4x5600123456789AB, 4x5610123456789AB, 4x5620123456789AB, 4x5630123456789AB, 4x5640123456789AB, 4x5650123456789AB, 4x5660123456789AB, 4x5670123456789AB, 4x5680123456789AB, 4x5690123456789AB, 4x56a0123456789AB, 4x56b0123456789AB, 4x56c0123456789AB, 4x56d0123456789AB, 4x56e0123456789AB, 4x56f0123456789AB, 4x5700123456789AB, 4x5710123456789AB, 4x5720123456789AB, 4x5730123456789AB, 4x5740123456789AB, 4x5750123456789AB, 4x5760123456789AB, 4x5770123456789AB, 4x5780123456789AB, 4x5790123456789AB, 4x57a0123456789AB, 4x57b0123456789AB, 4x57c0123456789AB, 4x57d0123456789AB, 4x57e0123456789AB, 4x57f0123456789AB
+D44	DATA8[] 4x5800123456789AB, 4x5810123456789AB, 4x5820123456789AB, 4x5830123456789AB, 4x5840123456789AB, 4x5850123456789AB, 4x5860123456789AB, 4x5870123456789AB, 4x5880123456789AB, 4x5890123456789AB, 4x58a0123456789AB, 4x58b0123456789AB, 4x58c0123456789AB, 4x58d0123456789AB, 4x58e0123456789AB, 4x58f0123456789AB, 4x5900123456789AB, 4x5910123456789AB, 4x5920123456789AB, 4x5930123456789AB, 4x5940123456789AB, 4x5950123456789AB, 4x5960123456789AB, 4x5970123456789AB, 4x5980123456789AB, 4x5990123456789AB, 4x59a0123456789AB, 4x59b0123456789AB, 4x59c0123456789AB, 4x59d0123456789AB, 4x59e0123456789AB, 4x59f0123456789AB
+D45	DATA8[] 4x5a00123456789AB, 4x5a10123456789AB, 4x5a20123456789AB, 4x5a30123456789AB, 4x5a40123456789AB, 4x5a50123456789AB, 4x5a60123456789AB, 4x5a70123456789AB, 4x5a80123456789AB, 4x5a90123456789AB, 4x5aa0123456789AB, 4x5ab0123456789AB, 4x5ac0123456789AB, 4x5ad0123456789AB, 4x5ae0123456789AB, 4x5af0123456789AB, 4x5b00123456789AB, 4x5b10123456789AB, 4x5b20123456789AB, 4x5b30123456789AB, 4x5b40123456789AB, 4x5b50123456789AB, 4x5b60123456789AB, 4x5b70123456789AB, 4x5b80123456789AB, 4x5b90123456789AB, 4x5ba0123456789AB, 4x5bb0123456789AB, 4x5bc0123456789AB, 4x5bd0123456789AB, 4x5be0123456789AB, 4x5bf0123456789AB
+D46	DATA8[] 4x5c00123456789AB, 4x5c10123456789AB, 4x5c20123456789AB, 4x5c30123456789AB, 4x5c40123456789AB, 4x5c50123456789AB, 4x5c60123456789AB, 4x5c70123456789AB, 4x5c80123456789AB, 4x5c90123456789AB, 4x5ca0123456789AB, 4x5cb0123456789AB, 4x5cc0123456789AB, 4x5cd0123456789AB, 4x5ce0123456789AB, 4x5cf0123456789AB, 4x5d00123456789AB, 4x5d10123456789AB, 4x5d20123456789AB, 4x5d30123456789AB, 4x5d40123456789AB, 4x5d50123456789AB, 4x5d60123456789AB, 4x5d70123456789AB, 4x5d80123456789AB, 4x5d90123456789AB, 4x5da0123456789AB, 4x5db0123456789AB, 4x5dc0123456789AB, 4x5dd0123456789AB, 4x5de0123456789AB, 4x5df0123456789AB
+D47	DATA8[] 4x5e00123456789AB, 4x5e10123456789AB, 4x5e20123456789AB, 4x5e30123456789AB, 4x5e40123456789AB, 4x5e50123456789AB, 4x5e60123456789AB, 4x5e70123456789AB, 4x5e80123456789AB, 4x5e90123456789AB, 4x5ea0123456789AB, 4x5eb0123456789AB, 4x5ec0123456789AB, 4x5ed0123456789AB, 4x5ee0123456789AB, 4x5ef0123456789AB, 4x5f00123456789AB, 4x5f10123456789AB, 4x5f20123456789AB, 4x5f30123456789AB, 4x5f40123456789AB, 4x5f50123456789AB, 4x5f60123456789AB, 4x5f70123456789AB, 4x5f80123456789AB, 4x5f90123456789AB, 4x5fa0123456789AB, 4x5fb0123456789AB, 4x5fc0123456789AB, 4x5fd0123456789AB, 4x5fe0123456789AB, 4x5ff0123456789AB
+D48	DATA8[] 4x6000123456789AB, 4x6010123456789AB, 4x6020123456789AB, 4x6030123456789AB, 4x6040123456789AB, 4x6050123456789AB, 4x6060123456789AB, 4x6070123456789AB, 4x6080123456789AB, 4x6090123456789AB, 4x60a0123456789AB, 4x60b0123456789AB, 4x60c0123456789AB, 4x60d0123456789AB, 4x60e0123456789AB, 4x60f0123456789AB, 4x6100123456789AB, 4x6110123456789AB, 4x6120123456789AB, 4x6130123456789AB, 4x6140123456789AB, 4x6150123456789AB, 4x6160123456789AB, 4x6170123456789AB, 4x6180123456789AB, 4x6190123456789AB, 4x61a0123456789AB, 4x61b0123456789AB, 4x61c0123456789AB, 4x61d0123456789AB, 4x61e0123456789AB, 4x61f0123456789AB
+D49	DATA8[] 4x6200123456789AB, 4x6210123456789AB, 4x6220123456789AB, 4x6230123456789AB, 4x6240123456789AB, 4x6250123456789AB, 4x6260123456789AB, 4x6270123456789AB, 4x6280123456789AB, 4x6290123456789AB, 4x62a0123456789AB, 4x62b0123456789AB, 4x62c0123456789AB, 4x62d0123456789AB, 4x62e0123456789AB, 4x62f0123456789AB, 4x6300123456789AB, 4x6310123456789AB, 4x6320123456789AB, 4x6330123456789AB, 4x6340123456789AB, 4x6350123456789AB, 4x6360123456789AB, 4x6370123456789AB, 4x6380123456789AB, 4x6390123456789AB, 4x63a0123456789AB, 4x63b0123456789AB, 4x63c0123456789AB, 4x63d0123456789AB, 4x63e0123456789AB, 4x63f0123456789AB
+D50	DATA8[] 4x6400123456789AB, 4x6410123456789AB, 4x6420123456789AB, 4x6430123456789AB, 4x6440123456789AB, 4x6450123456789AB, 4x6460123456789AB, 4x6470123456789AB, 4x6480123456789AB, 4x6490123456789AB, 4x64a0123456789AB, 4x64b0123456789AB, 4x64c0123456789AB, 4x64d0123456789AB, 4x64e0123456789AB, 4x64f0123456789AB, 4x6500123456789AB, 4x6510123456789AB, 4x6520123456789AB, 4x6530123456789AB, 4x6540123456789AB, 4x6550123456789AB, 4x6560123456789AB, 4x6570123456789AB, 4x6580123456789AB, 4x6590123456789AB, 4x65a0123456789AB, 4x65b0123456789AB, 4x65c0123456789AB, 4x65d0123456789AB, 4x65e0123456789AB, 4x65f0123456789AB
+D51	DATA8[] 4x6600123456789AB, 4x6610123456789AB, 4x6620123456789AB, 4x6630123456789AB, 4x6640123456789AB, 4x6650123456789AB, 4x6660123456789AB, 4x6670123456789AB, 4x6680123456789AB, 4x6690123456789AB, 4x66a0123456789AB, 4x66b0123456789AB, 4x66c0123456789AB, 4x66d0123456789AB, 4x66e0123456789AB, 4x66f0123456789AB, 4x6700123456789AB, 4x6710123456789AB, 4x6720123456789AB, 4x6730123456789AB, 4x6740123456789AB, 4x6750123456789AB, 4x6760123456789AB, 4x6770123456789AB, 4x6780123456789AB, 4x6790123456789AB, 4x67a0123456789AB, 4x67b0123456789AB, 4x67c0123456789AB, 4x67d0123456789AB, 4x67e0123456789AB, 4x67f0123456789AB
+D52	DATA8[] 4x6800123456789AB, 4x6810123456789AB, 4x6820123456789AB, 4x6830123456789AB, 4x6840123456789AB, 4x6850123456789AB, 4x6860123456789AB, 4x6870123456789AB, 4x6880123456789AB, 4x6890123456789AB, 4x68a0123456789AB, 4x68b0123456789AB, 4x68c0123456789AB, 4x68d0123456789AB, 4x68e0123456789AB, 4x68f0123456789AB, 4x6900123456789AB, 4x6910123456789AB, 4x6920123456789AB, 4x6930123456789AB, 4x6940123456789AB, 4x6950123456789AB, 4x6960123456789AB, 4x6970123456789AB, 4x6980123456789AB, 4x6990123456789AB, 4x69a0123456789AB, 4x69b0123456789AB, 4x69c0123456789AB, 4x69d0123456789AB, 4x69e0123456789AB, 4x69f0123456789AB
+D53	DATA8[] 4x6a00123456789AB, 4x6a10123456789AB, 4x6a20123456789AB, 4x6a30123456789AB, 4x6a40123456789AB, 4x6a50123456789AB, 4x6a60123456789AB, 4x6a70123456789AB, 4x6a80123456789AB, 4x6a90123456789AB, 4x6aa0123456789AB, 4x6ab0123456789AB, 4x6ac0123456789AB, 4x6ad0123456789AB, 4x6ae0123456789AB, 4x6af0123456789AB, 4x6b00123456789AB, 4x6b10123456789AB, 4x6b20123456789AB, 4x6b30123456789AB, 4x6b40123456789AB, 4x6b50123456789AB, 4x6b60123456789AB, 4x6b70123456789AB, 4x6b80123456789AB, 4x6b90123456789AB, 4x6ba0123456789AB, 4x6bb0123456789AB, 4x6bc0123456789AB, 4x6bd0123456789AB, 4x6be0123456789AB, 4x6bf0123456789AB
+D54	DATA8[] 4x6c00123456789AB, 4x6c10123456789AB, 4x6c20123456789AB, 4x6c30123456789AB, 4x6c40123456789AB, 4x6c50123456789AB, 4x6c60123456789AB, 4x6c70123456789AB, 4x6c80123456789AB, 4x6c90123456789AB, 4x6ca0123456789AB, 4x6cb0123456789AB, 4x6cc0123456789AB, 4x6cd0123456789AB, 4x6ce0123456789AB, 4x6cf0123456789AB, 4x6d00123456789AB, 4x6d10123456789AB, 4x6d20123456789AB, 4x6d30123456789AB, 4x6d40123456789AB, 4x6d50123456789AB, 4x6d60123456789AB, 4x6d70123456789AB, 4x6d80123456789AB, 4x6d90123456789AB, 4x6da0123456789AB, 4x6db0123456789AB, 4x6dc0123456789AB, 4x6dd0123456789AB, 4x6de0123456789AB, 4x6df0123456789AB
+D55	DATA8[] 4x6e00123456789AB, 4x6e10123456789AB, 4x6e20123456789AB, 4x6e30123456789AB, 4x6e40123456789AB, 4x6e50123456789AB, 4x6e60123456789AB, 4x6e70123456789AB, 4x6e80123456789AB, 4x6e90123456789AB, 4x6ea0123456789AB, 4x6eb0123456789AB, 4x6ec0123456789AB, 4x6ed0123456789AB, 4x6ee0123456789AB, 4x6ef0123456789AB, 4x6f00123456789AB, 4x6f10123456789AB, 4x6f20123456789AB, 4x6f30123456789AB, 4x6f40123456789AB, 4x6f50123456789AB, 4x6f60123456789AB, 4x6f70123456789AB, 4x6f80123456789AB, 4x6f90123456789AB, 4x6fa0123456789AB, 4x6fb0123456789AB, 4x6fc0123456789AB, 4x6fd0123456789AB, 4x6fe0123456789AB, 4x6ff0123456789AB
+D56	DATA8[] 4x7000123456789AB, 4x7010123456789AB, 4x7020123456789AB, 4x7030123456789AB, 4x7040123456789AB, 4x7050123456789AB, 4x7060123456789AB, 4x7070123456789AB, 4x7080123456789AB, 4x7090123456789AB, 4x70a0123456789AB, 4x70b0123456789AB, 4x70c0123456789AB, 4x70d0123456789AB, 4x70e0123456789AB, 4x70f0123456789AB, 4x7100123456789AB, 4x7110123456789AB, 4x7120123456789AB, 4x7130123456789AB, 4x7140123456789AB, 4x7150123456789AB, 4x7160123456789AB, 4x7170123456789AB, 4x7180123456789AB, 4x7190123456789AB, 4x71a0123456789AB, 4x71b0123456789AB, 4x71c0123456789AB, 4x71d0123456789AB, 4x71e0123456789AB, 4x71f0123456789AB
+D57	DATA8[] 4x7200123456789AB, 4x7210123456789AB, 4x7220123456789AB, 4x7230123456789AB, 4x7240123456789AB, 4x7250123456789AB, 4x7260123456789AB, 4x7270123456789AB, 4x7280123456789AB, 4x7290123456789AB, 4x72a0123456789AB, 4x72b0123456789AB, 4x72c0123456789AB, 4x72d0123456789AB, 4x72e0123456789AB, 4x72f0123456789AB, 4x7300123456789AB, 4x7310123456789AB, 4x7320123456789AB, 4x7330123456789AB, 4x7340123456789AB, 4x7350123456789AB, 4x7360123456789AB, 4x7370123456789AB, 4x7380123456789AB, 4x7390123456789AB, 4x73a0123456789AB, 4x73b0123456789AB, 4x73c0123456789AB, 4x73d0123456789AB, 4x73e0123456789AB, 4x73f0123456789AB
+D58	DATA8[] 4x7400123456789AB, 4x7410123456789AB, 4x7420123456789AB, 4x7430123456789AB, 4x7440123456789AB, 4x7450123456789AB, 4x7460123456789AB, 4x7470123456789AB, 4x7480123456789AB, 4x7490123456789AB, 4x74a0123456789AB, 4x74b0123456789AB, 4x74c0123456789AB, 4x74d0123456789AB, 4x74e0123456789AB, 4x74f0123456789AB, 4x7500123456789AB, 4x7510123456789AB, 4x7520123456789AB, 4x7530123456789AB, 4x7540123456789AB, 4x7550123456789AB, 4x7560123456789AB, 4x7570123456789AB, 4x7580123456789AB, 4x7590123456789AB, 4x75a0123456789AB, 4x75b0123456789AB, 4x75c0123456789AB, 4x75d0123456789AB, 4x75e0123456789AB, 4x75f0123456789AB
+D59	DATA8[] 4x7600123456789AB, 4x7610123456789AB, 4x7620123456789AB, 4x7630123456789AB, 4x7640123456789AB, 4x7650123456789AB, 4x7660123456789AB, 4x7670123456789AB, 4x7680123456789AB, 4x7690123456789AB, 4x76a0123456789AB, 4x76b0123456789AB, 4x76c0123456789AB, 4x76d0123456789AB, 4x76e0123456789AB, 4x76f0123456789AB, 4x7700123456789AB, 4x7710123456789AB, 4x7720123456789AB, 4x7730123456789AB, 4x7740123456789AB, 4x7750123456789AB, 4x7760123456789AB, 4x7770123456789AB, 4x7780123456789AB, 4x7790123456789AB, 4x77a0123456789AB, 4x77b0123456789AB, 4x77c0123456789AB, 4x77d0123456789AB, 4x77e0123456789AB, 4x77f0123456789AB
+D60	DATA8[] 4x7800123456789AB, 4x7810123456789AB, 4x7820123456789AB, 4x7830123456789AB, 4x7840123456789AB, 4x7850123456789AB, 4x7860123456789AB, 4x7870123456789AB, 4x7880123456789AB, 4x7890123456789AB, 4x78a0123456789AB, 4x78b0123456789AB, 4x78c0123456789AB, 4x78d0123456789AB, 4x78e0123456789AB, 4x78f0123456789AB, 4x7900123456789AB, 4x7910123456789AB, 4x7920123456789AB, 4x7930123456789AB, 4x7940123456789AB, 4x7950123456789AB, 4x7960123456789AB, 4x7970123456789AB, 4x7980123456789AB, 4x7990123456789AB, 4x79a0123456789AB, 4x79b0123456789AB, 4x79c0123456789AB, 4x79d0123456789AB, 4x79e0123456789AB, 4x79f0123456789AB
+D61	DATA8[] 4x7a00123456789AB, 4x7a10123456789AB, 4x7a20123456789AB, 4x7a30123456789AB, 4x7a40123456789AB, 4x7a50123456789AB, 4x7a60123456789AB, 4x7a70123456789AB, 4x7a80123456789AB, 4x7a90123456789AB, 4x7aa0123456789AB, 4x7ab0123456789AB, 4x7ac0123456789AB, 4x7ad0123456789AB, 4x7ae0123456789AB, 4x7af0123456789AB, 4x7b00123456789AB, 4x7b10123456789AB, 4x7b20123456789AB, 4x7b30123456789AB, 4x7b40123456789AB, 4x7b50123456789AB, 4x7b60123456789AB, 4x7b70123456789AB, 4x7b80123456789AB, 4x7b90123456789AB, 4x7ba0123456789AB, 4x7bb0123456789AB, 4x7bc0123456789AB, 4x7bd0123456789AB, 4x7be0123456789AB, 4x7bf0123456789AB
+D62	DATA8[] 4x7c00123456789AB, 4x7c10123456789AB, 4x7c20123456789AB, 4x7c30123456789AB, 4x7c40123456789AB, 4x7c50123456789AB, 4x7c60123456789AB, 4x7c70123456789AB, 4x7c80123456789AB, 4x7c90123456789AB, 4x7ca0123456789AB, 4x7cb0123456789AB, 4x7cc0123456789AB, 4x7cd0123456789AB, 4x7ce0123456789AB, 4x7cf0123456789AB, 4x7d00123456789AB, 4x7d10123456789AB, 4x7d20123456789AB, 4x7d30123456789AB, 4x7d40123456789AB, 4x7d50123456789AB, 4x7d60123456789AB, 4x7d70123456789AB, 4x7d80123456789AB, 4x7d90123456789AB, 4x7da0123456789AB, 4x7db0123456789AB, 4x7dc0123456789AB, 4x7dd0123456789AB, 4x7de0123456789AB, 4x7df0123456789AB
+D63	DATA8[] 4x7e00123456789AB, 4x7e10123456789AB, 4x7e20123456789AB, 4x7e30123456789AB, 4x7e40123456789AB, 4x7e50123456789AB, 4x7e60123456789AB, 4x7e70123456789AB, 4x7e80123456789AB, 4x7e90123456789AB, 4x7ea0123456789AB, 4x7eb0123456789AB, 4x7ec0123456789AB, 4x7ed0123456789AB, 4x7ee0123456789AB, 4x7ef0123456789AB, 4x7f00123456789AB, 4x7f10123456789AB, 4x7f20123456789AB, 4x7f30123456789AB, 4x7f40123456789AB, 4x7f50123456789AB, 4x7f60123456789AB, 4x7f70123456789AB, 4x7f80123456789AB, 4x7f90123456789AB, 4x7fa0123456789AB, 4x7fb0123456789AB, 4x7fc0123456789AB, 4x7fd0123456789AB, 4x7fe0123456789AB, 4x7ff0123456789AB
+D64	DATA8[] 4x8000123456789AB, 4x8010123456789AB, 4x8020123456789AB, 4x8030123456789AB, 4x8040123456789AB, 4x8050123456789AB, 4x8060123456789AB, 4x8070123456789AB, 4x8080123456789AB, 4x8090123456789AB, 4x80a0123456789AB, 4x80b0123456789AB, 4x80c0123456789AB, 4x80d0123456789AB, 4x80e0123456789AB, 4x80f0123456789AB, 4x8100123456789AB, 4x8110123456789AB, 4x8120123456789AB, 4x8130123456789AB, 4x8140123456789AB, 4x8150123456789AB, 4x8160123456789AB, 4x8170123456789AB, 4x8180123456789AB, 4x8190123456789AB, 4x81a0123456789AB, 4x81b0123456789AB, 4x81c0123456789AB, 4x81d0123456789AB, 4x81e0123456789AB, 4x81f0123456789AB
+D65	DATA8[] 4x8200123456789AB, 4x8210123456789AB, 4x8220123456789AB, 4x8230123456789AB, 4x8240123456789AB, 4x8250123456789AB, 4x8260123456789AB, 4x8270123456789AB, 4x8280123456789AB, 4x8290123456789AB, 4x82a0123456789AB, 4x82b0123456789AB, 4x82c0123456789AB, 4x82d0123456789AB, 4x82e0123456789AB, 4x82f0123456789AB, 4x8300123456789AB, 4x8310123456789AB, 4x8320123456789AB, 4x8330123456789AB, 4x8340123456789AB, 4x8350123456789AB, 4x8360123456789AB, 4x8370123456789AB, 4x8380123456789AB, 4x8390123456789AB, 4x83a0123456789AB, 4x83b0123456789AB, 4x83c0123456789AB, 4x83d0123456789AB, 4x83e0123456789AB, 4x83f0123456789AB
+D66	DATA8[] 4x8400123456789AB, 4x8410123456789AB, 4x8420123456789AB, 4x8430123456789AB, 4x8440123456789AB, 4x8450123456789AB, 4x8460123456789AB, 4x8470123456789AB, 4x8480123456789AB, 4x8490123456789AB, 4x84a0123456789AB, 4x84b0123456789AB, 4x84c0123456789AB, 4x84d0123456789AB, 4x84e0123456789AB, 4x84f0123456789AB, 4x8500123456789AB, 4x8510123456789AB, 4x8520123456789AB, 4x8530123456789AB, 4x8540123456789AB, 4x8550123456789AB, 4x8560123456789AB, 4x8570123456789AB, 4x8580123456789AB, 4x8590123456789AB, 4x85a0123456789AB, 4x85b0123456789AB, 4x85c0123456789AB, 4x85d0123456789AB, 4x85e0123456789AB, 4x85f0123456789AB
+D67	DATA8[] 4x8600123456789AB, 4x8610123456789AB, 4x8620123456789AB, 4x8630123456789AB, 4x8640123456789AB, 4x8650123456789AB, 4x8660123456789AB, 4x8670123456789AB, 4x8680123456789AB, 4x8690123456789AB, 4x86a0123456789AB, 4x86b0123456789AB, 4x86c0123456789AB, 4x86d0123456789AB, 4x86e0123456789AB, 4x86f0123456789AB, 4x8700123456789AB, 4x8710123456789AB, 4x8720123456789AB, 4x8730123456789AB, 4x8740123456789AB, 4x8750123456789AB, 4x8760123456789AB, 4x8770123456789AB, 4x8780123456789AB, 4x8790123456789AB, 4x87a0123456789AB, 4x87b0123456789AB, 4x87c0123456789AB, 4x87d0123456789AB, 4x87e0123456789AB, 4x87f0123456789AB
+D68	DATA8[] 4x8800123456789AB, 4x8810123456789AB, 4x8820123456789AB, 4x8830123456789AB, 4x8840123456789AB, 4x8850123456789AB, 4x8860123456789AB, 4x8870123456789AB, 4x8880123456789AB, 4x8890123456789AB, 4x88a0123456789AB, 4x88b0123456789AB, 4x88c0123456789AB, 4x88d0123456789AB, 4x88e0123456789AB, 4x88f0123456789AB, 4x8900123456789AB, 4x8910123456789AB, 4x8920123456789AB, 4x8930123456789AB, 4x8940123456789AB, 4x8950123456789AB, 4x8960123456789AB, 4x8970123456789AB, 4x8980123456789AB, 4x8990123456789AB, 4x89a0123456789AB, 4x89b0123456789AB, 4x89c0123456789AB, 4x89d0123456789AB, 4x89e0123456789AB, 4x89f0123456789AB
+D69	DATA8[] 4x8a00123456789AB, 4x8a10123456789AB, 4x8a20123456789AB, 4x8a30123456789AB, 4x8a40123456789AB, 4x8a50123456789AB, 4x8a60123456789AB, 4x8a70123456789AB, 4x8a80123456789AB, 4x8a90123456789AB, 4x8aa0123456789AB, 4x8ab0123456789AB, 4x8ac0123456789AB, 4x8ad0123456789AB, 4x8ae0123456789AB, 4x8af0123456789AB, 4x8b00123456789AB, 4x8b10123456789AB, 4x8b20123456789AB, 4x8b30123456789AB, 4x8b40123456789AB, 4x8b50123456789AB, 4x8b60123456789AB, 4x8b70123456789AB, 4x8b80123456789AB, 4x8b90123456789AB, 4x8ba0123456789AB, 4x8bb0123456789AB, 4x8bc0123456789AB, 4x8bd0123456789AB, 4x8be0123456789AB, 4x8bf0123456789AB
+D70	DATA8[] 4x8c00123456789AB, 4x8c10123456789AB, 4x8c20123456789AB, 4x8c30123456789AB, 4x8c40123456789AB, 4x8c50123456789AB, 4x8c60123456789AB, 4x8c70123456789AB, 4x8c80123456789AB, 4x8c90123456789AB, 4x8ca0123456789AB, 4x8cb0123456789AB, 4x8cc0123456789AB, 4x8cd0123456789AB, 4x8ce0123456789AB, 4x8cf0123456789AB, 4x8d00123456789AB, 4x8d10123456789AB, 4x8d20123456789AB, 4x8d30123456789AB, 4x8d40123456789AB, 4x8d50123456789AB, 4x8d60123456789AB, 4x8d70123456789AB, 4x8d80123456789AB, 4x8d90123456789AB, 4x8da0123456789AB, 4x8db0123456789AB, 4x8dc0123456789AB, 4x8dd0123456789AB, 4x8de0123456789AB, 4x8df0123456789AB
+D71	DATA8[] 4x8e00123456789AB, 4x8e10123456789AB, 4x8e20123456789AB, 4x8e30123456789AB, 4x8e40123456789AB, 4x8e50123456789AB, 4x8e60123456789AB, 4x8e70123456789AB, 4x8e80123456789AB, 4x8e90123456789AB, 4x8ea0123456789AB, 4x8eb0123456789AB, 4x8ec0123456789AB, 4x8ed0123456789AB, 4x8ee0123456789AB, 4x8ef0123456789AB, 4x8f00123456789AB, 4x8f10123456789AB, 4x8f20123456789AB, 4x8f30123456789AB, 4x8f40123456789AB, 4x8f50123456789AB, 4x8f60123456789AB, 4x8f70123456789AB, 4x8f80123456789AB, 4x8f90123456789AB, 4x8fa0123456789AB, 4x8fb0123456789AB, 4x8fc0123456789AB, 4x8fd0123456789AB, 4x8fe0123456789AB, 4x8ff0123456789AB
+D72	DATA8[] 4x9000123456789AB, 4x9010123456789AB, 4x9020123456789AB, 4x9030123456789AB, 4x9040123456789AB, 4x9050123456789AB, 4x9060123456789AB, 4x9070123456789AB, 4x9080123456789AB, 4x9090123456789AB, 4x90a0123456789AB, 4x90b0123456789AB, 4x90c0123456789AB, 4x90d0123456789AB, 4x90e0123456789AB, 4x90f0123456789AB, 4x9100123456789AB, 4x9110123456789AB, 4x9120123456789AB, 4x9130123456789AB, 4x9140123456789AB, 4x9150123456789AB, 4x9160123456789AB, 4x9170123456789AB, 4x9180123456789AB, 4x9190123456789AB, 4x91a0123456789AB, 4x91b0123456789AB, 4x91c0123456789AB, 4x91d0123456789AB, 4x91e0123456789AB, 4x91f0123456789AB
+D73	DATA8[] 4x9200123456789AB, 4x9210123456789AB, 4x9220123456789AB, 4x9230123456789AB, 4x9240123456789AB, 4x9250123456789AB, 4x9260123456789AB, 4x9270123456789AB, 4x9280123456789AB, 4x9290123456789AB, 4x92a0123456789AB, 4x92b0123456789AB, 4x92c0123456789AB, 4x92d0123456789AB, 4x92e0123456789AB, 4x92f0123456789AB, 4x9300123456789AB, 4x9310123456789AB, 4x9320123456789AB, 4x9330123456789AB, 4x9340123456789AB, 4x9350123456789AB, 4x9360123456789AB, 4x9370123456789AB, 4x9380123456789AB, 4x9390123456789AB, 4x93a0123456789AB, 4x93b0123456789AB, 4x93c0123456789AB, 4x93d0123456789AB, 4x93e0123456789AB, 4x93f0123456789AB
+D74	DATA8[] 4x9400123456789AB, 4x9410123456789AB, 4x9420123456789AB, 4x9430123456789AB, 4x9440123456789AB, 4x9450123456789AB, 4x9460123456789AB, 4x9470123456789AB, 4x9480123456789AB, 4x9490123456789AB, 4x94a0123456789AB, 4x94b0123456789AB, 4x94c0123456789AB, 4x94d0123456789AB, 4x94e0123456789AB, 4x94f0123456789AB, 4x9500123456789AB, 4x9510123456789AB, 4x9520123456789AB, 4x9530123456789AB, 4x9540123456789AB, 4x9550123456789AB, 4x9560123456789AB, 4x9570123456789AB, 4x9580123456789AB, 4x9590123456789AB, 4x95a0123456789AB, 4x95b0123456789AB, 4x95c0123456789AB, 4x95d0123456789AB, 4x95e0123456789AB, 4x95f0123456789AB
+D75	DATA8[] 4x9600123456789AB, 4x9610123456789AB, 4x9620123456789AB, 4x9630123456789AB, 4x9640123456789AB, 4x9650123456789AB, 4x9660123456789AB, 4x9670123456789AB, 4x9680123456789AB, 4x9690123456789AB, 4x96a0123456789AB, 4x96b0123456789AB, 4x96c0123456789AB, 4x96d0123456789AB, 4x96e0123456789AB, 4x96f0123456789AB, 4x9700123456789AB, 4x9710123456789AB, 4x9720123456789AB, 4x9730123456789AB, 4x9740123456789AB, 4x9750123456789AB, 4x9760123456789AB, 4x9770123456789AB, 4x9780123456789AB, 4x9790123456789AB, 4x97a0123456789AB, 4x97b0123456789AB, 4x97c0123456789AB, 4x97d0123456789AB, 4x97e0123456789AB, 4x97f0123456789AB
+D76	DATA8[] 4x9800123456789AB, 4x9810123456789AB, 4x9820123456789AB, 4x9830123456789AB, 4x9840123456789AB, 4x9850123456789AB, 4x9860123456789AB, 4x9870123456789AB, 4x9880123456789AB, 4x9890123456789AB, 4x98a0123456789AB, 4x98b0123456789AB, 4x98c0123456789AB, 4x98d0123456789AB, 4x98e0123456789AB, 4x98f0123456789AB, 4x9900123456789AB, 4x9910123456789AB, 4x9920123456789AB, 4x9930123456789AB, 4x9940123456789AB, 4x9950123456789AB, 4x9960123456789AB, 4x9970123456789AB, 4x9980123456789AB, 4x9990123456789AB, 4x99a0123456789AB, 4x99b0123456789AB, 4x99c0123456789AB, 4x99d0123456789AB, 4x99e0123456789AB, 4x99f0123456789AB
+D77	DATA8[] 4x9a00123456789AB, 4x9a10123456789AB, 4x9a20123456789AB, 4x9a30123456789AB, 4x9a40123456789AB, 4x9a50123456789AB, 4x9a60123456789AB, 4x9a70123456789AB, 4x9a80123456789AB, 4x9a90123456789AB, 4x9aa0123456789AB, 4x9ab0123456789AB, 4x9ac0123456789AB, 4x9ad0123456789AB, 4x9ae0123456789AB, 4x9af0123456789AB, 4x9b00123456789AB, 4x9b10123456789AB, 4x9b20123456789AB, 4x9b30123456789AB, 4x9b40123456789AB, 4x9b50123456789AB, 4x9b60123456789AB, 4x9b70123456789AB, 4x9b80123456789AB, 4x9b90123456789AB, 4x9ba0123456789AB, 4x9bb0123456789AB, 4x9bc0123456789AB, 4x9bd0123456789AB, 4x9be0123456789AB, 4x9bf0123456789AB
+D78	DATA8[] 4x9c00123456789AB, 4x9c10123456789AB, 4x9c20123456789AB, 4x9c30123456789AB, 4x9c40123456789AB, 4x9c50123456789AB, 4x9c60123456789AB, 4x9c70123456789AB, 4x9c80123456789AB, 4x9c90123456789AB, 4x9ca0123456789AB, 4x9cb0123456789AB, 4x9cc0123456789AB, 4x9cd0123456789AB, 4x9ce0123456789AB, 4x9cf0123456789AB, 4x9d00123456789AB, 4x9d10123456789AB, 4x9d20123456789AB, 4x9d30123456789AB, 4x9d40123456789AB, 4x9d50123456789AB, 4x9d60123456789AB, 4x9d70123456789AB, 4x9d80123456789AB, 4x9d90123456789AB, 4x9da0123456789AB, 4x9db0123456789AB, 4x9dc0123456789AB, 4x9dd0123456789AB, 4x9de0123456789AB, 4x9df0123456789AB
+D79	DATA8[] 4x9e00123456789AB, 4x9e10123456789AB, 4x9e20123456789AB, 4x9e30123456789AB, 4x9e40123456789AB, 4x9e50123456789AB, 4x9e60123456789AB, 4x9e70123456789AB, 4x9e80123456789AB, 4x9e90123456789AB, 4x9ea0123456789AB, 4x9eb0123456789AB, 4x9ec0123456789AB, 4x9ed0123456789AB, 4x9ee0123456789AB, 4x9ef0123456789AB, 4x9f00123456789AB, 4x9f10123456789AB, 4x9f20123456789AB, 4x9f30123456789AB, 4x9f40123456789AB, 4x9f50123456789AB, 4x9f60123456789AB, 4x9f70123456789AB, 4x9f80123456789AB, 4x9f90123456789AB, 4x9fa0123456789AB, 4x9fb0123456789AB, 4x9fc0123456789AB, 4x9fd0123456789AB, 4x9fe0123456789AB, 4x9ff0123456789AB
+D80	DATA8[] 4xa000123456789AB, 4xa010123456789AB, 4xa020123456789AB, 4xa030123456789AB, 4xa040123456789AB, 4xa050123456789AB, 4xa060123456789AB, 4xa070123456789AB, 4xa080123456789AB, 4xa090123456789AB, 4xa0a0123456789AB, 4xa0b0123456789AB, 4xa0c0123456789AB, 4xa0d0123456789AB, 4xa0e0123456789AB, 4xa0f0123456789AB, 4xa100123456789AB, 4xa110123456789AB, 4xa120123456789AB, 4xa130123456789AB, 4xa140123456789AB, 4xa150123456789AB, 4xa160123456789AB, 4xa170123456789AB, 4xa180123456789AB, 4xa190123456789AB, 4xa1a0123456789AB, 4xa1b0123456789AB, 4xa1c0123456789AB, 4xa1d0123456789AB, 4xa1e0123456789AB, 4xa1f0123456789AB
+D81	DATA8[] 4xa200123456789AB, 4xa210123456789AB, 4xa220123456789AB, 4xa230123456789AB, 4xa240123456789AB, 4xa250123456789AB, 4xa260123456789AB, 4xa270123456789AB, 4xa280123456789AB, 4xa290123456789AB, 4xa2a0123456789AB, 4xa2b0123456789AB, 4xa2c0123456789AB, 4xa2d0123456789AB, 4xa2e0123456789AB, 4xa2f0123456789AB, 4xa300123456789AB, 4xa310123456789AB, 4xa320123456789AB, 4xa330123456789AB, 4xa340123456789AB, 4xa350123456789AB, 4xa360123456789AB, 4xa370123456789AB, 4xa380123456789AB, 4xa390123456789AB, 4xa3a0123456789AB, 4xa3b0123456789AB, 4xa3c0123456789AB, 4xa3d0123456789AB, 4xa3e0123456789AB, 4xa3f0123456789AB
+D82	DATA8[] 4xa400123456789AB, 4xa410123456789AB, 4xa420123456789AB, 4xa430123456789AB, 4xa440123456789AB, 4xa450123456789AB, 4xa460123456789AB, 4xa470123456789AB, 4xa480123456789AB, 4xa490123456789AB, 4xa4a0123456789AB, 4xa4b0123456789AB, 4xa4c0123456789AB, 4xa4d0123456789AB, 4xa4e0123456789AB, 4xa4f0123456789AB, 4xa500123456789AB, 4xa510123456789AB, 4xa520123456789AB, 4xa530123456789AB, 4xa540123456789AB, 4xa550123456789AB, 4xa560123456789AB, 4xa570123456789AB, 4xa580123456789AB, 4xa590123456789AB, 4xa5a0123456789AB, 4xa5b0123456789AB, 4xa5c0123456789AB, 4xa5d0123456789AB, 4xa5e0123456789AB, 4xa5f0123456789AB
+D83	DATA8[] 4xa600123456789AB, 4xa610123456789AB, 4xa620123456789AB, 4xa630123456789AB, 4xa640123456789AB, 4xa650123456789AB, 4xa660123456789AB, 4xa670123456789AB, 4xa680123456789AB, 4xa690123456789AB, 4xa6a0123456789AB, 4xa6b0123456789AB, 4xa6c0123456789AB, 4xa6d0123456789AB, 4xa6e0123456789AB, 4xa6f0123456789AB, 4xa700123456789AB, 4xa710123456789AB, 4xa720123456789AB, 4xa730123456789AB, 4xa740123456789AB, 4xa750123456789AB, 4xa760123456789AB, 4xa770123456789AB, 4xa780123456789AB, 4xa790123456789AB, 4xa7a0123456789AB, 4xa7b0123456789AB, 4xa7c0123456789AB, 4xa7d0123456789AB, 4xa7e0123456789AB, 4xa7f0123456789AB
+D84	DATA8[] 4xa800123456789AB, 4xa810123456789AB, 4xa820123456789AB, 4xa830123456789AB, 4xa840123456789AB, 4xa850123456789AB, 4xa860123456789AB, 4xa870123456789AB, 4xa880123456789AB, 4xa890123456789AB, 4xa8a0123456789AB, 4xa8b0123456789AB, 4xa8c0123456789AB, 4xa8d0123456789AB, 4xa8e0123456789AB, 4xa8f0123456789AB, 4xa900123456789AB, 4xa910123456789AB, 4xa920123456789AB, 4xa930123456789AB, 4xa940123456789AB, 4xa950123456789AB, 4xa960123456789AB, 4xa970123456789AB, 4xa980123456789AB, 4xa990123456789AB, 4xa9a0123456789AB, 4xa9b0123456789AB, 4xa9c0123456789AB, 4xa9d0123456789AB, 4xa9e0123456789AB, 4xa9f0123456789AB
+D85	DATA8[] 4xaa00123456789AB, 4xaa10123456789AB, 4xaa20123456789AB, 4xaa30123456789AB, 4xaa40123456789AB, 4xaa50123456789AB, 4xaa60123456789AB, 4xaa70123456789AB, 4xaa80123456789AB, 4xaa90123456789AB, 4xaaa0123456789AB, 4xaab0123456789AB, 4xaac0123456789AB, 4xaad0123456789AB, 4xaae0123456789AB, 4xaaf0123456789AB, 4xab00123456789AB, 4xab10123456789AB, 4xab20123456789AB, 4xab30123456789AB, 4xab40123456789AB, 4xab50123456789AB, 4xab60123456789AB, 4xab70123456789AB, 4xab80123456789AB, 4xab90123456789AB, 4xaba0123456789AB, 4xabb0123456789AB, 4xabc0123456789AB, 4xabd0123456789AB, 4xabe0123456789AB, 4xabf0123456789AB
+D86	DATA8[] 4xac00123456789AB, 4xac10123456789AB, 4xac20123456789AB, 4xac30123456789AB, 4xac40123456789AB, 4xac50123456789AB, 4xac60123456789AB, 4xac70123456789AB, 4xac80123456789AB, 4xac90123456789AB, 4xaca0123456789AB, 4xacb0123456789AB, 4xacc0123456789AB, 4xacd0123456789AB, 4xace0123456789AB, 4xacf0123456789AB, 4xad00123456789AB, 4xad10123456789AB, 4xad20123456789AB, 4xad30123456789AB, 4xad40123456789AB, 4xad50123456789AB, 4xad60123456789AB, 4xad70123456789AB, 4xad80123456789AB, 4xad90123456789AB, 4xada0123456789AB, 4xadb0123456789AB, 4xadc0123456789AB, 4xadd0123456789AB, 4xade0123456789AB, 4xadf0123456789AB
+D87	DATA8[] 4xae00123456789AB, 4xae10123456789AB, 4xae20123456789AB, 4xae30123456789AB, 4xae40123456789AB, 4xae50123456789AB, 4xae60123456789AB, 4xae70123456789AB, 4xae80123456789AB, 4xae90123456789AB, 4xaea0123456789AB, 4xaeb0123456789AB, 4xaec0123456789AB, 4xaed0123456789AB, 4xaee0123456789AB, 4xaef0123456789AB, 4xaf00123456789AB, 4xaf10123456789AB, 4xaf20123456789AB, 4xaf30123456789AB, 4xaf40123456789AB, 4xaf50123456789AB, 4xaf60123456789AB, 4xaf70123456789AB, 4xaf80123456789AB, 4xaf90123456789AB, 4xafa0123456789AB, 4xafb0123456789AB, 4xafc0123456789AB, 4xafd0123456789AB, 4xafe0123456789AB, 4xaff0123456789AB
+D88	DATA8[] 4xb000123456789AB, 4xb010123456789AB, 4xb020123456789AB, 4xb030123456789AB, 4xb040123456789AB, 4xb050123456789AB, 4xb060123456789AB, 4xb070123456789AB, 4xb080123456789AB, 4xb090123456789AB, 4xb0a0123456789AB, 4xb0b0123456789AB, 4xb0c0123456789AB, 4xb0d0123456789AB, 4xb0e0123456789AB, 4xb0f0123456789AB, 4xb100123456789AB, 4xb110123456789AB, 4xb120123456789AB, 4xb130123456789AB, 4xb140123456789AB, 4xb150123456789AB, 4xb160123456789AB, 4xb170123456789AB, 4xb180123456789AB, 4xb190123456789AB, 4xb1a0123456789AB, 4xb1b0123456789AB, 4xb1c0123456789AB, 4xb1d0123456789AB, 4xb1e0123456789AB, 4xb1f0123456789AB
+D89	DATA8[] 4xb200123456789AB, 4xb210123456789AB, 4xb220123456789AB, 4xb230123456789AB, 4xb240123456789AB, 4xb250123456789AB, 4xb260123456789AB, 4xb270123456789AB, 4xb280123456789AB, 4xb290123456789AB, 4xb2a0123456789AB, 4xb2b0123456789AB, 4xb2c0123456789AB, 4xb2d0123456789AB, 4xb2e0123456789AB, 4xb2f0123456789AB, 4xb300123456789AB, 4xb310123456789AB, 4xb320123456789AB, 4xb330123456789AB, 4xb340123456789AB, 4xb350123456789AB, 4xb360123456789AB, 4xb370123456789AB, 4xb380123456789AB, 4xb390123456789AB, 4xb3a0123456789AB, 4xb3b0123456789AB, 4xb3c0123456789AB, 4xb3d0123456789AB, 4xb3e0123456789AB, 4xb3f0123456789AB
+D90	DATA8[] 4xb400123456789AB, 4xb410123456789AB, 4xb420123456789AB, 4xb430123456789AB, 4xb440123456789AB, 4xb450123456789AB, 4xb460123456789AB, 4xb470123456789AB, 4xb480123456789AB, 4xb490123456789AB, 4xb4a0123456789AB, 4xb4b0123456789AB, 4xb4c0123456789AB, 4xb4d0123456789AB, 4xb4e0123456789AB, 4xb4f0123456789AB, 4xb500123456789AB, 4xb510123456789AB, 4xb520123456789AB, 4xb530123456789AB, 4xb540123456789AB, 4xb550123456789AB, 4xb560123456789AB, 4xb570123456789AB, 4xb580123456789AB, 4xb590123456789AB, 4xb5a0123456789AB, 4xb5b0123456789AB, 4xb5c0123456789AB, 4xb5d0123456789AB, 4xb5e0123456789AB, 4xb5f0123456789AB
+D91	DATA8[] 4xb600123456789AB, 4xb610123456789AB, 4xb620123456789AB, 4xb630123456789AB, 4xb640123456789AB, 4xb650123456789AB, 4xb660123456789AB, 4xb670123456789AB, 4xb680123456789AB, 4xb690123456789AB, 4xb6a0123456789AB, 4xb6b0123456789AB, 4xb6c0123456789AB, 4xb6d0123456789AB, 4xb6e0123456789AB, 4xb6f0123456789AB, 4xb700123456789AB, 4xb710123456789AB, 4xb720123456789AB, 4xb730123456789AB, 4xb740123456789AB, 4xb750123456789AB, 4xb760123456789AB, 4xb770123456789AB, 4xb780123456789AB, 4xb790123456789AB, 4xb7a0123456789AB, 4xb7b0123456789AB, 4xb7c0123456789AB, 4xb7d0123456789AB, 4xb7e0123456789AB, 4xb7f0123456789AB
+D92	DATA8[] 4xb800123456789AB, 4xb810123456789AB, 4xb820123456789AB, 4xb830123456789AB, 4xb840123456789AB, 4xb850123456789AB, 4xb860123456789AB, 4xb870123456789AB, 4xb880123456789AB, 4xb890123456789AB, 4xb8a0123456789AB, 4xb8b0123456789AB, 4xb8c0123456789AB, 4xb8d0123456789AB, 4xb8e0123456789AB, 4xb8f0123456789AB, 4xb900123456789AB, 4xb910123456789AB, 4xb920123456789AB, 4xb930123456789AB, 4xb940123456789AB, 4xb950123456789AB, 4xb960123456789AB, 4xb970123456789AB, 4xb980123456789AB, 4xb990123456789AB, 4xb9a0123456789AB, 4xb9b0123456789AB, 4xb9c0123456789AB, 4xb9d0123456789AB, 4xb9e0123456789AB, 4xb9f0123456789AB
+D93	DATA8[] 4xba00123456789AB, 4xba10123456789AB, 4xba20123456789AB, 4xba30123456789AB, 4xba40123456789AB, 4xba50123456789AB, 4xba60123456789AB, 4xba70123456789AB, 4xba80123456789AB, 4xba90123456789AB, 4xbaa0123456789AB, 4xbab0123456789AB, 4xbac0123456789AB, 4xbad0123456789AB, 4xbae0123456789AB, 4xbaf0123456789AB, 4xbb00123456789AB, 4xbb10123456789AB, 4xbb20123456789AB, 4xbb30123456789AB, 4xbb40123456789AB, 4xbb50123456789AB, 4xbb60123456789AB, 4xbb70123456789AB, 4xbb80123456789AB, 4xbb90123456789AB, 4xbba0123456789AB, 4xbbb0123456789AB, 4xbbc0123456789AB, 4xbbd0123456789AB, 4xbbe0123456789AB, 4xbbf0123456789AB
+D94	DATA8[] 4xbc00123456789AB, 4xbc10123456789AB, 4xbc20123456789AB, 4xbc30123456789AB, 4xbc40123456789AB, 4xbc50123456789AB, 4xbc60123456789AB, 4xbc70123456789AB, 4xbc80123456789AB, 4xbc90123456789AB, 4xbca0123456789AB, 4xbcb0123456789AB, 4xbcc0123456789AB, 4xbcd0123456789AB, 4xbce0123456789AB, 4xbcf0123456789AB, 4xbd00123456789AB, 4xbd10123456789AB, 4xbd20123456789AB, 4xbd30123456789AB, 4xbd40123456789AB, 4xbd50123456789AB, 4xbd60123456789AB, 4xbd70123456789AB, 4xbd80123456789AB, 4xbd90123456789AB, 4xbda0123456789AB, 4xbdb0123456789AB, 4xbdc0123456789AB, 4xbdd0123456789AB, 4xbde0123456789AB, 4xbdf0123456789AB
+D95	DATA8[] 4xbe00123456789AB, 4xbe10123456789AB, 4xbe20123456789AB, 4xbe30123456789AB, 4xbe40123456789AB, 4xbe50123456789AB, 4xbe60123456789AB, 4xbe70123456789AB, 4xbe80123456789AB, 4xbe90123456789AB, 4xbea0123456789AB, 4xbeb0123456789AB, 4xbec0123456789AB, 4xbed0123456789AB, 4xbee0123456789AB, 4xbef0123456789AB, 4xbf00123456789AB, 4xbf10123456789AB, 4xbf20123456789AB, 4xbf30123456789AB, 4xbf40123456789AB, 4xbf50123456789AB, 4xbf60123456789AB, 4xbf70123456789AB, 4xbf80123456789AB, 4xbf90123456789AB, 4xbfa0123456789AB, 4xbfb0123456789AB, 4xbfc0123456789AB, 4xbfd0123456789AB, 4xbfe0123456789AB, 4xbff0123456789AB
+D96	DATA8[] 4xc000123456789AB, 4xc010123456789AB, 4xc020123456789AB, 4xc030123456789AB, 4xc040123456789AB, 4xc050123456789AB, 4xc060123456789AB, 4xc070123456789AB, 4xc080123456789AB, 4xc090123456789AB, 4xc0a0123456789AB, 4xc0b0123456789AB, 4xc0c0123456789AB, 4xc0d0123456789AB, 4xc0e0123456789AB, 4xc0f0123456789AB, 4xc100123456789AB, 4xc110123456789AB, 4xc120123456789AB, 4xc130123456789AB, 4xc140123456789AB, 4xc150123456789AB, 4xc160123456789AB, 4xc170123456789AB, 4xc180123456789AB, 4xc190123456789AB, 4xc1a0123456789AB, 4xc1b0123456789AB, 4xc1c0123456789AB, 4xc1d0123456789AB, 4xc1e0123456789AB, 4xc1f0123456789AB
+D97	DATA8[] 4xc200123456789AB, 4xc210123456789AB, 4xc220123456789AB, 4xc230123456789AB, 4xc240123456789AB, 4xc250123456789AB, 4xc260123456789AB, 4xc270123456789AB, 4xc280123456789AB, 4xc290123456789AB, 4xc2a0123456789AB, 4xc2b0123456789AB, 4xc2c0123456789AB, 4xc2d0123456789AB, 4xc2e0123456789AB, 4xc2f0123456789AB, 4xc300123456789AB, 4xc310123456789AB, 4xc320123456789AB, 4xc330123456789AB, 4xc340123456789AB, 4xc350123456789AB, 4xc360123456789AB, 4xc370123456789AB, 4xc380123456789AB, 4xc390123456789AB, 4xc3a0123456789AB, 4xc3b0123456789AB, 4xc3c0123456789AB, 4xc3d0123456789AB, 4xc3e0123456789AB, 4xc3f0123456789AB
+D98	DATA8[] 4xc400123456789AB, 4xc410123456789AB, 4xc420123456789AB, 4xc430123456789AB, 4xc440123456789AB, 4xc450123456789AB, 4xc460123456789AB, 4xc470123456789AB, 4xc480123456789AB, 4xc490123456789AB, 4xc4a0123456789AB, 4xc4b0123456789AB, 4xc4c0123456789AB, 4xc4d0123456789AB, 4xc4e0123456789AB, 4xc4f0123456789AB, 4xc500123456789AB, 4xc510123456789AB, 4xc520123456789AB, 4xc530123456789AB, 4xc540123456789AB, 4xc550123456789AB, 4xc560123456789AB, 4xc570123456789AB, 4xc580123456789AB, 4xc590123456789AB, 4xc5a0123456789AB, 4xc5b0123456789AB, 4xc5c0123456789AB, 4xc5d0123456789AB, 4xc5e0123456789AB, 4xc5f0123456789AB
+D99	DATA8[] 4xc600123456789AB, 4xc610123456789AB, 4xc620123456789AB, 4xc630123456789AB, 4xc640123456789AB, 4xc650123456789AB, 4xc660123456789AB, 4xc670123456789AB, 4xc680123456789AB, 4xc690123456789AB, 4xc6a0123456789AB, 4xc6b0123456789AB, 4xc6c0123456789AB, 4xc6d0123456789AB, 4xc6e0123456789AB, 4xc6f0123456789AB, 4xc700123456789AB, 4xc710123456789AB, 4xc720123456789AB, 4xc730123456789AB, 4xc740123456789AB, 4xc750123456789AB, 4xc760123456789AB, 4xc770123456789AB, 4xc780123456789AB, 4xc790123456789AB, 4xc7a0123456789AB, 4xc7b0123456789AB, 4xc7c0123456789AB, 4xc7d0123456789AB, 4xc7e0123456789AB, 4xc7f0123456789AB
+D100	DATA8[] 4xc800123456789AB, 4xc810123456789AB, 4xc820123456789AB, 4xc830123456789AB, 4xc840123456789AB, 4xc850123456789AB, 4xc860123456789AB, 4xc870123456789AB, 4xc880123456789AB, 4xc890123456789AB, 4xc8a0123456789AB, 4xc8b0123456789AB, 4xc8c0123456789AB, 4xc8d0123456789AB, 4xc8e0123456789AB, 4xc8f0123456789AB, 4xc900123456789AB, 4xc910123456789AB, 4xc920123456789AB, 4xc930123456789AB, 4xc940123456789AB, 4xc950123456789AB, 4xc960123456789AB, 4xc970123456789AB, 4xc980123456789AB, 4xc990123456789AB, 4xc9a0123456789AB, 4xc9b0123456789AB, 4xc9c0123456789AB, 4xc9d0123456789AB, 4xc9e0123456789AB, 4xc9f0123456789AB
+D101	DATA8[] 4xca00123456789AB, 4xca10123456789AB, 4xca20123456789AB, 4xca30123456789AB, 4xca40123456789AB, 4xca50123456789AB, 4xca60123456789AB, 4xca70123456789AB, 4xca80123456789AB, 4xca90123456789AB, 4xcaa0123456789AB, 4xcab0123456789AB, 4xcac0123456789AB, 4xcad0123456789AB, 4xcae0123456789AB, 4xcaf0123456789AB, 4xcb00123456789AB, 4xcb10123456789AB, 4xcb20123456789AB, 4xcb30123456789AB, 4xcb40123456789AB, 4xcb50123456789AB, 4xcb60123456789AB, 4xcb70123456789AB, 4xcb80123456789AB, 4xcb90123456789AB, 4xcba0123456789AB, 4xcbb0123456789AB, 4xcbc0123456789AB, 4xcbd0123456789AB, 4xcbe0123456789AB, 4xcbf0123456789AB
+D102	DATA8[] 4xcc00123456789AB, 4xcc10123456789AB, 4xcc20123456789AB, 4xcc30123456789AB, 4xcc40123456789AB, 4xcc50123456789AB, 4xcc60123456789AB, 4xcc70123456789AB, 4xcc80123456789AB, 4xcc90123456789AB, 4xcca0123456789AB, 4xccb0123456789AB, 4xccc0123456789AB, 4xccd0123456789AB, 4xcce0123456789AB, 4xccf0123456789AB, 4xcd00123456789AB, 4xcd10123456789AB, 4xcd20123456789AB, 4xcd30123456789AB, 4xcd40123456789AB, 4xcd50123456789AB, 4xcd60123456789AB, 4xcd70123456789AB, 4xcd80123456789AB, 4xcd90123456789AB, 4xcda0123456789AB, 4xcdb0123456789AB, 4xcdc0123456789AB, 4xcdd0123456789AB, 4xcde0123456789AB, 4xcdf0123456789AB
+D103	DATA8[] 4xce00123456789AB, 4xce10123456789AB, 4xce20123456789AB, 4xce30123456789AB, 4xce40123456789AB, 4xce50123456789AB, 4xce60123456789AB, 4xce70123456789AB, 4xce80123456789AB, 4xce90123456789AB, 4xcea0123456789AB, 4xceb0123456789AB, 4xcec0123456789AB, 4xced0123456789AB, 4xcee0123456789AB, 4xcef0123456789AB, 4xcf00123456789AB, 4xcf10123456789AB, 4xcf20123456789AB, 4xcf30123456789AB, 4xcf40123456789AB, 4xcf50123456789AB, 4xcf60123456789AB, 4xcf70123456789AB, 4xcf80123456789AB, 4xcf90123456789AB, 4xcfa0123456789AB, 4xcfb0123456789AB, 4xcfc0123456789AB, 4xcfd0123456789AB, 4xcfe0123456789AB, 4xcff0123456789AB
+D104	DATA8[] 4xd000123456789AB, 4xd010123456789AB, 4xd020123456789AB, 4xd030123456789AB, 4xd040123456789AB, 4xd050123456789AB, 4xd060123456789AB, 4xd070123456789AB, 4xd080123456789AB, 4xd090123456789AB, 4xd0a0123456789AB, 4xd0b0123456789AB, 4xd0c0123456789AB, 4xd0d0123456789AB, 4xd0e0123456789AB, 4xd0f0123456789AB, 4xd100123456789AB, 4xd110123456789AB, 4xd120123456789AB, 4xd130123456789AB, 4xd140123456789AB, 4xd150123456789AB, 4xd160123456789AB, 4xd170123456789AB, 4xd180123456789AB, 4xd190123456789AB, 4xd1a0123456789AB, 4xd1b0123456789AB, 4xd1c0123456789AB, 4xd1d0123456789AB, 4xd1e0123456789AB, 4xd1f0123456789AB
+D105	DATA8[] 4xd200123456789AB, 4xd210123456789AB, 4xd220123456789AB, 4xd230123456789AB, 4xd240123456789AB, 4xd250123456789AB, 4xd260123456789AB, 4xd270123456789AB, 4xd280123456789AB, 4xd290123456789AB, 4xd2a0123456789AB, 4xd2b0123456789AB, 4xd2c0123456789AB, 4xd2d0123456789AB, 4xd2e0123456789AB, 4xd2f0123456789AB, 4xd300123456789AB, 4xd310123456789AB, 4xd320123456789AB, 4xd330123456789AB, 4xd340123456789AB, 4xd350123456789AB, 4xd360123456789AB, 4xd370123456789AB, 4xd380123456789AB, 4xd390123456789AB, 4xd3a0123456789AB, 4xd3b0123456789AB, 4xd3c0123456789AB, 4xd3d0123456789AB, 4xd3e0123456789AB, 4xd3f0123456789AB
+D106	DATA8[] 4xd400123456789AB, 4xd410123456789AB, 4xd420123456789AB, 4xd430123456789AB, 4xd440123456789AB, 4xd450123456789AB, 4xd460123456789AB, 4xd470123456789AB, 4xd480123456789AB, 4xd490123456789AB, 4xd4a0123456789AB, 4xd4b0123456789AB, 4xd4c0123456789AB, 4xd4d0123456789AB, 4xd4e0123456789AB, 4xd4f0123456789AB, 4xd500123456789AB, 4xd510123456789AB, 4xd520123456789AB, 4xd530123456789AB, 4xd540123456789AB, 4xd550123456789AB, 4xd560123456789AB, 4xd570123456789AB, 4xd580123456789AB, 4xd590123456789AB, 4xd5a0123456789AB, 4xd5b0123456789AB, 4xd5c0123456789AB, 4xd5d0123456789AB, 4xd5e0123456789AB, 4xd5f0123456789AB
+D107	DATA8[] 4xd600123456789AB, 4xd610123456789AB, 4xd620123456789AB, 4xd630123456789AB, 4xd640123456789AB, 4xd650123456789AB, 4xd660123456789AB, 4xd670123456789AB, 4xd680123456789AB, 4xd690123456789AB, 4xd6a0123456789AB, 4xd6b0123456789AB, 4xd6c0123456789AB, 4xd6d0123456789AB, 4xd6e0123456789AB, 4xd6f0123456789AB, 4xd700123456789AB, 4xd710123456789AB, 4xd720123456789AB, 4xd730123456789AB, 4xd740123456789AB, 4xd750123456789AB, 4xd760123456789AB, 4xd770123456789AB, 4xd780123456789AB, 4xd790123456789AB, 4xd7a0123456789AB, 4xd7b0123456789AB, 4xd7c0123456789AB, 4xd7d0123456789AB, 4xd7e0123456789AB, 4xd7f0123456789AB
+D108	DATA8[] 4xd800123456789AB, 4xd810123456789AB, 4xd820123456789AB, 4xd830123456789AB, 4xd840123456789AB, 4xd850123456789AB, 4xd860123456789AB, 4xd870123456789AB, 4xd880123456789AB, 4xd890123456789AB, 4xd8a0123456789AB, 4xd8b0123456789AB, 4xd8c0123456789AB, 4xd8d0123456789AB, 4xd8e0123456789AB, 4xd8f0123456789AB, 4xd900123456789AB, 4xd910123456789AB, 4xd920123456789AB, 4xd930123456789AB, 4xd940123456789AB, 4xd950123456789AB, 4xd960123456789AB, 4xd970123456789AB, 4xd980123456789AB, 4xd990123456789AB, 4xd9a0123456789AB, 4xd9b0123456789AB, 4xd9c0123456789AB, 4xd9d0123456789AB, 4xd9e0123456789AB, 4xd9f0123456789AB
+D109	DATA8[] 4xda00123456789AB, 4xda10123456789AB, 4xda20123456789AB, 4xda30123456789AB, 4xda40123456789AB, 4xda50123456789AB, 4xda60123456789AB, 4xda70123456789AB, 4xda80123456789AB, 4xda90123456789AB, 4xdaa0123456789AB, 4xdab0123456789AB, 4xdac0123456789AB, 4xdad0123456789AB, 4xdae0123456789AB, 4xdaf0123456789AB, 4xdb00123456789AB, 4xdb10123456789AB, 4xdb20123456789AB, 4xdb30123456789AB, 4xdb40123456789AB, 4xdb50123456789AB, 4xdb60123456789AB, 4xdb70123456789AB, 4xdb80123456789AB, 4xdb90123456789AB, 4xdba0123456789AB, 4xdbb0123456789AB, 4xdbc0123456789AB, 4xdbd0123456789AB, 4xdbe0123456789AB, 4xdbf0123456789AB
+D110	DATA8[] 4xdc00123456789AB, 4xdc10123456789AB, 4xdc20123456789AB, 4xdc30123456789AB, 4xdc40123456789AB, 4xdc50123456789AB, 4xdc60123456789AB, 4xdc70123456789AB, 4xdc80123456789AB, 4xdc90123456789AB, 4xdca0123456789AB, 4xdcb0123456789AB, 4xdcc0123456789AB, 4xdcd0123456789AB, 4xdce0123456789AB, 4xdcf0123456789AB, 4xdd00123456789AB, 4xdd10123456789AB, 4xdd20123456789AB, 4xdd30123456789AB, 4xdd40123456789AB, 4xdd50123456789AB, 4xdd60123456789AB, 4xdd70123456789AB, 4xdd80123456789AB, 4xdd90123456789AB, 4xdda0123456789AB, 4xddb0123456789AB, 4xddc0123456789AB, 4xddd0123456789AB, 4xdde0123456789AB, 4xddf0123456789AB
+D111	DATA8[] 4xde00123456789AB, 4xde10123456789AB, 4xde20123456789AB, 4xde30123456789AB, 4xde40123456789AB, 4xde50123456789AB, 4xde60123456789AB, 4xde70123456789AB, 4xde80123456789AB, 4xde90123456789AB, 4xdea0123456789AB, 4xdeb0123456789AB, 4xdec0123456789AB, 4xded0123456789AB, 4xdee0123456789AB, 4xdef0123456789AB, 4xdf00123456789AB, 4xdf10123456789AB, 4xdf20123456789AB, 4xdf30123456789AB, 4xdf40123456789AB, 4xdf50123456789AB, 4xdf60123456789AB, 4xdf70123456789AB, 4xdf80123456789AB, 4xdf90123456789AB, 4xdfa0123456789AB, 4xdfb0123456789AB, 4xdfc0123456789AB, 4xdfd0123456789AB, 4xdfe0123456789AB, 4xdff0123456789AB
+D112	DATA8[] 4xe000123456789AB, 4xe010123456789AB, 4xe020123456789AB, 4xe030123456789AB, 4xe040123456789AB, 4xe050123456789AB, 4xe060123456789AB, 4xe070123456789AB, 4xe080123456789AB, 4xe090123456789AB, 4xe0a0123456789AB, 4xe0b0123456789AB, 4xe0c0123456789AB, 4xe0d0123456789AB, 4xe0e0123456789AB, 4xe0f0123456789AB, 4xe100123456789AB, 4xe110123456789AB, 4xe120123456789AB, 4xe130123456789AB, 4xe140123456789AB, 4xe150123456789AB, 4xe160123456789AB, 4xe170123456789AB, 4xe180123456789AB, 4xe190123456789AB, 4xe1a0123456789AB, 4xe1b0123456789AB, 4xe1c0123456789AB, 4xe1d0123456789AB, 4xe1e0123456789AB, 4xe1f0123456789AB
+D113	DATA8[] 4xe200123456789AB, 4xe210123456789AB, 4xe220123456789AB, 4xe230123456789AB, 4xe240123456789AB, 4xe250123456789AB, 4xe260123456789AB, 4xe270123456789AB, 4xe280123456789AB, 4xe290123456789AB, 4xe2a0123456789AB, 4xe2b0123456789AB, 4xe2c0123456789AB, 4xe2d0123456789AB, 4xe2e0123456789AB, 4xe2f0123456789AB, 4xe300123456789AB, 4xe310123456789AB, 4xe320123456789AB, 4xe330123456789AB, 4xe340123456789AB, 4xe350123456789AB, 4xe360123456789AB, 4xe370123456789AB, 4xe380123456789AB, 4xe390123456789AB, 4xe3a0123456789AB, 4xe3b0123456789AB, 4xe3c0123456789AB, 4xe3d0123456789AB, 4xe3e0123456789AB, 4xe3f0123456789AB
+D114	DATA8[] 4xe400123456789AB, 4xe410123456789AB, 4xe420123456789AB, 4xe430123456789AB, 4xe440123456789AB, 4xe450123456789AB, 4xe460123456789AB, 4xe470123456789AB, 4xe480123456789AB, 4xe490123456789AB, 4xe4a0123456789AB, 4xe4b0123456789AB, 4xe4c0123456789AB, 4xe4d0123456789AB, 4xe4e0123456789AB, 4xe4f0123456789AB, 4xe500123456789AB, 4xe510123456789AB, 4xe520123456789AB, 4xe530123456789AB, 4xe540123456789AB, 4xe550123456789AB, 4xe560123456789AB, 4xe570123456789AB, 4xe580123456789AB, 4xe590123456789AB, 4xe5a0123456789AB, 4xe5b0123456789AB, 4xe5c0123456789AB, 4xe5d0123456789AB, 4xe5e0123456789AB, 4xe5f0123456789AB
+D115	DATA8[] 4xe600123456789AB, 4xe610123456789AB, 4xe620123456789AB, 4xe630123456789AB, 4xe640123456789AB, 4xe650123456789AB, 4xe660123456789AB, 4xe670123456789AB, 4xe680123456789AB, 4xe690123456789AB, 4xe6a0123456789AB, 4xe6b0123456789AB, 4xe6c0123456789AB, 4xe6d0123456789AB, 4xe6e0123456789AB, 4xe6f0123456789AB, 4xe700123456789AB, 4xe710123456789AB, 4xe720123456789AB, 4xe730123456789AB, 4xe740123456789AB, 4xe750123456789AB, 4xe760123456789AB, 4xe770123456789AB, 4xe780123456789AB, 4xe790123456789AB, 4xe7a0123456789AB, 4xe7b0123456789AB, 4xe7c0123456789AB, 4xe7d0123456789AB, 4xe7e0123456789AB, 4xe7f0123456789AB
+D116	DATA8[] 4xe800123456789AB, 4xe810123456789AB, 4xe820123456789AB, 4xe830123456789AB, 4xe840123456789AB, 4xe850123456789AB, 4xe860123456789AB, 4xe870123456789AB, 4xe880123456789AB, 4xe890123456789AB, 4xe8a0123456789AB, 4xe8b0123456789AB, 4xe8c0123456789AB, 4xe8d0123456789AB, 4xe8e0123456789AB, 4xe8f0123456789AB, 4xe900123456789AB, 4xe910123456789AB, 4xe920123456789AB, 4xe930123456789AB, 4xe940123456789AB, 4xe950123456789AB, 4xe960123456789AB, 4xe970123456789AB, 4xe980123456789AB, 4xe990123456789AB, 4xe9a0123456789AB, 4xe9b0123456789AB, 4xe9c0123456789AB, 4xe9d0123456789AB, 4xe9e0123456789AB, 4xe9f0123456789AB
+D117	DATA8[] 4xea00123456789AB, 4xea10123456789AB, 4xea20123456789AB, 4xea30123456789AB, 4xea40123456789AB, 4xea50123456789AB, 4xea60123456789AB, 4xea70123456789AB, 4xea80123456789AB, 4xea90123456789AB, 4xeaa0123456789AB, 4xeab0123456789AB, 4xeac0123456789AB, 4xead0123456789AB, 4xeae0123456789AB, 4xeaf0123456789AB, 4xeb00123456789AB, 4xeb10123456789AB, 4xeb20123456789AB, 4xeb30123456789AB, 4xeb40123456789AB, 4xeb50123456789AB, 4xeb60123456789AB, 4xeb70123456789AB, 4xeb80123456789AB, 4xeb90123456789AB, 4xeba0123456789AB, 4xebb0123456789AB, 4xebc0123456789AB, 4xebd0123456789AB, 4xebe0123456789AB, 4xebf0123456789AB
+D118	DATA8[] 4xec00123456789AB, 4xec10123456789AB, 4xec20123456789AB, 4xec30123456789AB, 4xec40123456789AB, 4xec50123456789AB, 4xec60123456789AB, 4xec70123456789AB, 4xec80123456789AB, 4xec90123456789AB, 4xeca0123456789AB, 4xecb0123456789AB, 4xecc0123456789AB, 4xecd0123456789AB, 4xece0123456789AB, 4xecf0123456789AB, 4xed00123456789AB, 4xed10123456789AB, 4xed20123456789AB, 4xed30123456789AB, 4xed40123456789AB, 4xed50123456789AB, 4xed60123456789AB, 4xed70123456789AB, 4xed80123456789AB, 4xed90123456789AB, 4xeda0123456789AB, 4xedb0123456789AB, 4xedc0123456789AB, 4xedd0123456789AB, 4xede0123456789AB, 4xedf0123456789AB
+D119	DATA8[] 4xee00123456789AB, 4xee10123456789AB, 4xee20123456789AB, 4xee30123456789AB, 4xee40123456789AB, 4xee50123456789AB, 4xee60123456789AB, 4xee70123456789AB, 4xee80123456789AB, 4xee90123456789AB, 4xeea0123456789AB, 4xeeb0123456789AB, 4xeec0123456789AB, 4xeed0123456789AB, 4xeee0123456789AB, 4xeef0123456789AB, 4xef00123456789AB, 4xef10123456789AB, 4xef20123456789AB, 4xef30123456789AB, 4xef40123456789AB, 4xef50123456789AB, 4xef60123456789AB, 4xef70123456789AB, 4xef80123456789AB, 4xef90123456789AB, 4xefa0123456789AB, 4xefb0123456789AB, 4xefc0123456789AB, 4xefd0123456789AB, 4xefe0123456789AB, 4xeff0123456789AB
+D120	DATA8[] 4xf000123456789AB, 4xf010123456789AB, 4xf020123456789AB, 4xf030123456789AB, 4xf040123456789AB, 4xf050123456789AB, 4xf060123456789AB, 4xf070123456789AB, 4xf080123456789AB, 4xf090123456789AB, 4xf0a0123456789AB, 4xf0b0123456789AB, 4xf0c0123456789AB, 4xf0d0123456789AB, 4xf0e0123456789AB, 4xf0f0123456789AB, 4xf100123456789AB, 4xf110123456789AB, 4xf120123456789AB, 4xf130123456789AB, 4xf140123456789AB, 4xf150123456789AB, 4xf160123456789AB, 4xf170123456789AB, 4xf180123456789AB, 4xf190123456789AB, 4xf1a0123456789AB, 4xf1b0123456789AB, 4xf1c0123456789AB, 4xf1d0123456789AB, 4xf1e0123456789AB, 4xf1f0123456789AB
+D121	DATA8[] 4xf200123456789AB, 4xf210123456789AB, 4xf220123456789AB, 4xf230123456789AB, 4xf240123456789AB, 4xf250123456789AB, 4xf260123456789AB, 4xf270123456789AB, 4xf280123456789AB, 4xf290123456789AB, 4xf2a0123456789AB, 4xf2b0123456789AB, 4xf2c0123456789AB, 4xf2d0123456789AB, 4xf2e0123456789AB, 4xf2f0123456789AB, 4xf300123456789AB, 4xf310123456789AB, 4xf320123456789AB, 4xf330123456789AB, 4xf340123456789AB, 4xf350123456789AB, 4xf360123456789AB, 4xf370123456789AB, 4xf380123456789AB, 4xf390123456789AB, 4xf3a0123456789AB, 4xf3b0123456789AB, 4xf3c0123456789AB, 4xf3d0123456789AB, 4xf3e0123456789AB, 4xf3f0123456789AB
+D122	DATA8[] 4xf400123456789AB, 4xf410123456789AB, 4xf420123456789AB, 4xf430123456789AB, 4xf440123456789AB, 4xf450123456789AB, 4xf460123456789AB, 4xf470123456789AB, 4xf480123456789AB, 4xf490123456789AB, 4xf4a0123456789AB, 4xf4b0123456789AB, 4xf4c0123456789AB, 4xf4d0123456789AB, 4xf4e0123456789AB, 4xf4f0123456789AB, 4xf500123456789AB, 4xf510123456789AB, 4xf520123456789AB, 4xf530123456789AB, 4xf540123456789AB, 4xf550123456789AB, 4xf560123456789AB, 4xf570123456789AB, 4xf580123456789AB, 4xf590123456789AB, 4xf5a0123456789AB, 4xf5b0123456789AB, 4xf5c0123456789AB, 4xf5d0123456789AB, 4xf5e0123456789AB, 4xf5f0123456789AB
+D123	DATA8[] 4xf600123456789AB, 4xf610123456789AB, 4xf620123456789AB, 4xf630123456789AB, 4xf640123456789AB, 4xf650123456789AB, 4xf660123456789AB, 4xf670123456789AB, 4xf680123456789AB, 4xf690123456789AB, 4xf6a0123456789AB, 4xf6b0123456789AB, 4xf6c0123456789AB, 4xf6d0123456789AB, 4xf6e0123456789AB, 4xf6f0123456789AB, 4xf700123456789AB, 4xf710123456789AB, 4xf720123456789AB, 4xf730123456789AB, 4xf740123456789AB, 4xf750123456789AB, 4xf760123456789AB, 4xf770123456789AB, 4xf780123456789AB, 4xf790123456789AB, 4xf7a0123456789AB, 4xf7b0123456789AB, 4xf7c0123456789AB, 4xf7d0123456789AB, 4xf7e0123456789AB, 4xf7f0123456789AB
+D124	DATA8[] 4xf800123456789AB, 4xf810123456789AB, 4xf820123456789AB, 4xf830123456789AB, 4xf840123456789AB, 4xf850123456789AB, 4xf860123456789AB, 4xf870123456789AB, 4xf880123456789AB, 4xf890123456789AB, 4xf8a0123456789AB, 4xf8b0123456789AB, 4xf8c0123456789AB, 4xf8d0123456789AB, 4xf8e0123456789AB, 4xf8f0123456789AB, 4xf900123456789AB, 4xf910123456789AB, 4xf920123456789AB, 4xf930123456789AB, 4xf940123456789AB, 4xf950123456789AB, 4xf960123456789AB, 4xf970123456789AB, 4xf980123456789AB, 4xf990123456789AB, 4xf9a0123456789AB, 4xf9b0123456789AB, 4xf9c0123456789AB, 4xf9d0123456789AB, 4xf9e0123456789AB, 4xf9f0123456789AB
+D125	DATA8[] 4xfa00123456789AB, 4xfa10123456789AB, 4xfa20123456789AB, 4xfa30123456789AB, 4xfa40123456789AB, 4xfa50123456789AB, 4xfa60123456789AB, 4xfa70123456789AB, 4xfa80123456789AB, 4xfa90123456789AB, 4xfaa0123456789AB, 4xfab0123456789AB, 4xfac0123456789AB, 4xfad0123456789AB, 4xfae0123456789AB, 4xfaf0123456789AB, 4xfb00123456789AB, 4xfb10123456789AB, 4xfb20123456789AB, 4xfb30123456789AB, 4xfb40123456789AB, 4xfb50123456789AB, 4xfb60123456789AB, 4xfb70123456789AB, 4xfb80123456789AB, 4xfb90123456789AB, 4xfba0123456789AB, 4xfbb0123456789AB, 4xfbc0123456789AB, 4xfbd0123456789AB, 4xfbe0123456789AB, 4xfbf0123456789AB
+D126	DATA8[] 4xfc00123456789AB, 4xfc10123456789AB, 4xfc20123456789AB, 4xfc30123456789AB, 4xfc40123456789AB, 4xfc50123456789AB, 4xfc60123456789AB, 4xfc70123456789AB, 4xfc80123456789AB, 4xfc90123456789AB, 4xfca0123456789AB, 4xfcb0123456789AB, 4xfcc0123456789AB, 4xfcd0123456789AB, 4xfce0123456789AB, 4xfcf0123456789AB, 4xfd00123456789AB, 4xfd10123456789AB, 4xfd20123456789AB, 4xfd30123456789AB, 4xfd40123456789AB, 4xfd50123456789AB, 4xfd60123456789AB, 4xfd70123456789AB, 4xfd80123456789AB, 4xfd90123456789AB, 4xfda0123456789AB, 4xfdb0123456789AB, 4xfdc0123456789AB, 4xfdd0123456789AB, 4xfde0123456789AB, 4xfdf0123456789AB
+D127	DATA8[] 4xfe00123456789AB, 4xfe10123456789AB, 4xfe20123456789AB, 4xfe30123456789AB, 4xfe40123456789AB, 4xfe50123456789AB, 4xfe60123456789AB, 4xfe70123456789AB, 4xfe80123456789AB, 4xfe90123456789AB, 4xfea0123456789AB, 4xfeb0123456789AB, 4xfec0123456789AB, 4xfed0123456789AB, 4xfee0123456789AB, 4xfef0123456789AB, 4xff00123456789AB, 4xff10123456789AB, 4xff20123456789AB, 4xff30123456789AB, 4xff40123456789AB, 4xff50123456789AB, 4xff60123456789AB, 4xff70123456789AB, 4xff80123456789AB, 4xff90123456789AB, 4xffa0123456789AB, 4xffb0123456789AB, 4xffc0123456789AB, 4xffd0123456789AB, 4xffe0123456789AB, 4xfff0123456789AB
+D128	DATA8[] 4x10000123456789AB, 4x10010123456789AB, 4x10020123456789AB, 4x10030123456789AB, 4x10040123456789AB, 4x10050123456789AB, 4x10060123456789AB, 4x10070123456789AB, 4x10080123456789AB, 4x10090123456789AB, 4x100a0123456789AB, 4x100b0123456789AB, 4x100c0123456789AB, 4x100d0123456789AB, 4x100e0123456789AB, 4x100f0123456789AB, 4x10100123456789AB, 4x10110123456789AB, 4x10120123456789AB, 4x10130123456789AB, 4x10140123456789AB, 4x10150123456789AB, 4x10160123456789AB, 4x10170123456789AB, 4x10180123456789AB, 4x10190123456789AB, 4x101a0123456789AB, 4x101b0123456789AB, 4x101c0123456789AB, 4x101d0123456789AB, 4x101e0123456789AB, 4x101f0123456789AB
+D129	DATA8[] 4x10200123456789AB, 4x10210123456789AB, 4x10220123456789AB, 4x10230123456789AB, 4x10240123456789AB, 4x10250123456789AB, 4x10260123456789AB, 4x10270123456789AB, 4x10280123456789AB, 4x10290123456789AB, 4x102a0123456789AB, 4x102b0123456789AB, 4x102c0123456789AB, 4x102d0123456789AB, 4x102e0123456789AB, 4x102f0123456789AB, 4x10300123456789AB, 4x10310123456789AB, 4x10320123456789AB, 4x10330123456789AB, 4x10340123456789AB, 4x10350123456789AB, 4x10360123456789AB, 4x10370123456789AB, 4x10380123456789AB, 4x10390123456789AB, 4x103a0123456789AB, 4x103b0123456789AB, 4x103c0123456789AB, 4x103d0123456789AB, 4x103e0123456789AB, 4x103f0123456789AB
+D130	DATA8[] 4x10400123456789AB, 4x10410123456789AB, 4x10420123456789AB, 4x10430123456789AB, 4x10440123456789AB, 4x10450123456789AB, 4x10460123456789AB, 4x10470123456789AB, 4x10480123456789AB, 4x10490123456789AB, 4x104a0123456789AB, 4x104b0123456789AB, 4x104c0123456789AB, 4x104d0123456789AB, 4x104e0123456789AB, 4x104f0123456789AB, 4x10500123456789AB, 4x10510123456789AB, 4x10520123456789AB, 4x10530123456789AB, 4x10540123456789AB, 4x10550123456789AB, 4x10560123456789AB, 4x10570123456789AB, 4x10580123456789AB, 4x10590123456789AB, 4x105a0123456789AB, 4x105b0123456789AB, 4x105c0123456789AB, 4x105d0123456789AB, 4x105e0123456789AB, 4x105f0123456789AB
+D131	DATA8[] 4x10600123456789AB, 4x10610123456789AB, 4x10620123456789AB, 4x10630123456789AB, 4x10640123456789AB, 4x10650123456789AB, 4x10660123456789AB, 4x10670123456789AB, 4x10680123456789AB, 4x10690123456789AB, 4x106a0123456789AB, 4x106b0123456789AB, 4x106c0123456789AB, 4x106d0123456789AB, 4x106e0123456789AB, 4x106f0123456789AB, 4x10700123456789AB, 4x10710123456789AB, 4x10720123456789AB, 4x10730123456789AB, 4x10740123456789AB, 4x10750123456789AB, 4x10760123456789AB, 4x10770123456789AB, 4x10780123456789AB, 4x10790123456789AB, 4x107a0123456789AB, 4x107b0123456789AB, 4x107c0123456789AB, 4x107d0123456789AB, 4x107e0123456789AB, 4x107f0123456789AB
+D132	DATA8[] 4x10800123456789AB, 4x10810123456789AB, 4x10820123456789AB, 4x10830123456789AB, 4x10840123456789AB, 4x10850123456789AB, 4x10860123456789AB, 4x10870123456789AB, 4x10880123456789AB, 4x10890123456789AB, 4x108a0123456789AB, 4x108b0123456789AB, 4x108c0123456789AB, 4x108d0123456789AB, 4x108e0123456789AB, 4x108f0123456789AB, 4x10900123456789AB, 4x10910123456789AB, 4x10920123456789AB, 4x10930123456789AB, 4x10940123456789AB, 4x10950123456789AB, 4x10960123456789AB, 4x10970123456789AB, 4x10980123456789AB, 4x10990123456789AB, 4x109a0123456789AB, 4x109b0123456789AB, 4x109c0123456789AB, 4x109d0123456789AB, 4x109e0123456789AB, 4x109f0123456789AB
+D133	DATA8[] 4x10a00123456789AB, 4x10a10123456789AB, 4x10a20123456789AB, 4x10a30123456789AB, 4x10a40123456789AB, 4x10a50123456789AB, 4x10a60123456789AB, 4x10a70123456789AB, 4x10a80123456789AB, 4x10a90123456789AB, 4x10aa0123456789AB, 4x10ab0123456789AB, 4x10ac0123456789AB, 4x10ad0123456789AB, 4x10ae0123456789AB, 4x10af0123456789AB, 4x10b00123456789AB, 4x10b10123456789AB, 4x10b20123456789AB, 4x10b30123456789AB, 4x10b40123456789AB, 4x10b50123456789AB, 4x10b60123456789AB, 4x10b70123456789AB, 4x10b80123456789AB, 4x10b90123456789AB, 4x10ba0123456789AB, 4x10bb0123456789AB, 4x10bc0123456789AB, 4x10bd0123456789AB, 4x10be0123456789AB, 4x10bf0123456789AB
+D134	DATA8[] 4x10c00123456789AB, 4x10c10123456789AB, 4x10c20123456789AB, 4x10c30123456789AB, 4x10c40123456789AB, 4x10c50123456789AB, 4x10c60123456789AB, 4x10c70123456789AB, 4x10c80123456789AB, 4x10c90123456789AB, 4x10ca0123456789AB, 4x10cb0123456789AB, 4x10cc0123456789AB, 4x10cd0123456789AB, 4x10ce0123456789AB, 4x10cf0123456789AB, 4x10d00123456789AB, 4x10d10123456789AB, 4x10d20123456789AB, 4x10d30123456789AB, 4x10d40123456789AB, 4x10d50123456789AB, 4x10d60123456789AB, 4x10d70123456789AB, 4x10d80123456789AB, 4x10d90123456789AB, 4x10da0123456789AB, 4x10db0123456789AB, 4x10dc0123456789AB, 4x10dd0123456789AB, 4x10de0123456789AB, 4x10df0123456789AB
+D135	DATA8[] 4x10e00123456789AB, 4x10e10123456789AB, 4x10e20123456789AB, 4x10e30123456789AB, 4x10e40123456789AB, 4x10e50123456789AB, 4x10e60123456789AB, 4x10e70123456789AB, 4x10e80123456789AB, 4x10e90123456789AB, 4x10ea0123456789AB, 4x10eb0123456789AB, 4x10ec0123456789AB, 4x10ed0123456789AB, 4x10ee0123456789AB, 4x10ef0123456789AB, 4x10f00123456789AB, 4x10f10123456789AB, 4x10f20123456789AB, 4x10f30123456789AB, 4x10f40123456789AB, 4x10f50123456789AB, 4x10f60123456789AB, 4x10f70123456789AB, 4x10f80123456789AB, 4x10f90123456789AB, 4x10fa0123456789AB, 4x10fb0123456789AB, 4x10fc0123456789AB, 4x10fd0123456789AB, 4x10fe0123456789AB, 4x10ff0123456789AB
+D136	DATA8[] 4x11000123456789AB, 4x11010123456789AB, 4x11020123456789AB, 4x11030123456789AB, 4x11040123456789AB, 4x11050123456789AB, 4x11060123456789AB, 4x11070123456789AB, 4x11080123456789AB, 4x11090123456789AB, 4x110a0123456789AB, 4x110b0123456789AB, 4x110c0123456789AB, 4x110d0123456789AB, 4x110e0123456789AB, 4x110f0123456789AB, 4x11100123456789AB, 4x11110123456789AB, 4x11120123456789AB, 4x11130123456789AB, 4x11140123456789AB, 4x11150123456789AB, 4x11160123456789AB, 4x11170123456789AB, 4x11180123456789AB, 4x11190123456789AB, 4x111a0123456789AB, 4x111b0123456789AB, 4x111c0123456789AB, 4x111d0123456789AB, 4x111e0123456789AB, 4x111f0123456789AB
+D137	DATA8[] 4x11200123456789AB, 4x11210123456789AB, 4x11220123456789AB, 4x11230123456789AB, 4x11240123456789AB, 4x11250123456789AB, 4x11260123456789AB, 4x11270123456789AB, 4x11280123456789AB, 4x11290123456789AB, 4x112a0123456789AB, 4x112b0123456789AB, 4x112c0123456789AB, 4x112d0123456789AB, 4x112e0123456789AB, 4x112f0123456789AB, 4x11300123456789AB, 4x11310123456789AB, 4x11320123456789AB, 4x11330123456789AB, 4x11340123456789AB, 4x11350123456789AB, 4x11360123456789AB, 4x11370123456789AB, 4x11380123456789AB, 4x11390123456789AB, 4x113a0123456789AB, 4x113b0123456789AB, 4x113c0123456789AB, 4x113d0123456789AB, 4x113e0123456789AB, 4x113f0123456789AB
+D138	DATA8[] 4x11400123456789AB, 4x11410123456789AB, 4x11420123456789AB, 4x11430123456789AB, 4x11440123456789AB, 4x11450123456789AB, 4x11460123456789AB, 4x11470123456789AB, 4x11480123456789AB, 4x11490123456789AB, 4x114a0123456789AB, 4x114b0123456789AB, 4x114c0123456789AB, 4x114d0123456789AB, 4x114e0123456789AB, 4x114f0123456789AB, 4x11500123456789AB, 4x11510123456789AB, 4x11520123456789AB, 4x11530123456789AB, 4x11540123456789AB, 4x11550123456789AB, 4x11560123456789AB, 4x11570123456789AB, 4x11580123456789AB, 4x11590123456789AB, 4x115a0123456789AB, 4x115b0123456789AB, 4x115c0123456789AB, 4x115d0123456789AB, 4x115e0123456789AB, 4x115f0123456789AB
+D139	DATA8[] 4x11600123456789AB, 4x11610123456789AB, 4x11620123456789AB, 4x11630123456789AB, 4x11640123456789AB, 4x11650123456789AB, 4x11660123456789AB, 4x11670123456789AB, 4x11680123456789AB, 4x11690123456789AB, 4x116a0123456789AB, 4x116b0123456789AB, 4x116c0123456789AB, 4x116d0123456789AB, 4x116e0123456789AB, 4x116f0123456789AB, 4x11700123456789AB, 4x11710123456789AB, 4x11720123456789AB, 4x11730123456789AB, 4x11740123456789AB, 4x11750123456789AB, 4x11760123456789AB, 4x11770123456789AB, 4x11780123456789AB, 4x11790123456789AB, 4x117a0123456789AB, 4x117b0123456789AB, 4x117c0123456789AB, 4x117d0123456789AB, 4x117e0123456789AB, 4x117f0123456789AB
+D140	DATA8[] 4x11800123456789AB, 4x11810123456789AB, 4x11820123456789AB, 4x11830123456789AB, 4x11840123456789AB, 4x11850123456789AB, 4x11860123456789AB, 4x11870123456789AB, 4x11880123456789AB, 4x11890123456789AB, 4x118a0123456789AB, 4x118b0123456789AB, 4x118c0123456789AB, 4x118d0123456789AB, 4x118e0123456789AB, 4x118f0123456789AB, 4x11900123456789AB, 4x11910123456789AB, 4x11920123456789AB, 4x11930123456789AB, 4x11940123456789AB, 4x11950123456789AB, 4x11960123456789AB, 4x11970123456789AB, 4x11980123456789AB, 4x11990123456789AB, 4x119a0123456789AB, 4x119b0123456789AB, 4x119c0123456789AB, 4x119d0123456789AB, 4x119e0123456789AB, 4x119f0123456789AB
+D141	DATA8[] 4x11a00123456789AB, 4x11a10123456789AB, 4x11a20123456789AB, 4x11a30123456789AB, 4x11a40123456789AB, 4x11a50123456789AB, 4x11a60123456789AB, 4x11a70123456789AB, 4x11a80123456789AB, 4x11a90123456789AB, 4x11aa0123456789AB, 4x11ab0123456789AB, 4x11ac0123456789AB, 4x11ad0123456789AB, 4x11ae0123456789AB, 4x11af0123456789AB, 4x11b00123456789AB, 4x11b10123456789AB, 4x11b20123456789AB, 4x11b30123456789AB, 4x11b40123456789AB, 4x11b50123456789AB, 4x11b60123456789AB, 4x11b70123456789AB, 4x11b80123456789AB, 4x11b90123456789AB, 4x11ba0123456789AB, 4x11bb0123456789AB, 4x11bc0123456789AB, 4x11bd0123456789AB, 4x11be0123456789AB, 4x11bf0123456789AB
+D142	DATA8[] 4x11c00123456789AB, 4x11c10123456789AB, 4x11c20123456789AB, 4x11c30123456789AB, 4x11c40123456789AB, 4x11c50123456789AB, 4x11c60123456789AB, 4x11c70123456789AB, 4x11c80123456789AB, 4x11c90123456789AB, 4x11ca0123456789AB, 4x11cb0123456789AB, 4x11cc0123456789AB, 4x11cd0123456789AB, 4x11ce0123456789AB, 4x11cf0123456789AB, 4x11d00123456789AB, 4x11d10123456789AB, 4x11d20123456789AB, 4x11d30123456789AB, 4x11d40123456789AB, 4x11d50123456789AB, 4x11d60123456789AB, 4x11d70123456789AB, 4x11d80123456789AB, 4x11d90123456789AB, 4x11da0123456789AB, 4x11db0123456789AB, 4x11dc0123456789AB, 4x11dd0123456789AB, 4x11de0123456789AB, 4x11df0123456789AB
+D143	DATA8[] 4x11e00123456789AB, 4x11e10123456789AB, 4x11e20123456789AB, 4x11e30123456789AB, 4x11e40123456789AB, 4x11e50123456789AB, 4x11e60123456789AB, 4x11e70123456789AB, 4x11e80123456789AB, 4x11e90123456789AB, 4x11ea0123456789AB, 4x11eb0123456789AB, 4x11ec0123456789AB, 4x11ed0123456789AB, 4x11ee0123456789AB, 4x11ef0123456789AB, 4x11f00123456789AB, 4x11f10123456789AB, 4x11f20123456789AB, 4x11f30123456789AB, 4x11f40123456789AB, 4x11f50123456789AB, 4x11f60123456789AB, 4x11f70123456789AB, 4x11f80123456789AB, 4x11f90123456789AB, 4x11fa0123456789AB, 4x11fb0123456789AB, 4x11fc0123456789AB, 4x11fd0123456789AB, 4x11fe0123456789AB, 4x11ff0123456789AB
+D144	DATA8[] 4x12000123456789AB, 4x12010123456789AB, 4x12020123456789AB, 4x12030123456789AB, 4x12040123456789AB, 4x12050123456789AB, 4x12060123456789AB, 4x12070123456789AB, 4x12080123456789AB, 4x12090123456789AB, 4x120a0123456789AB, 4x120b0123456789AB, 4x120c0123456789AB, 4x120d0123456789AB, 4x120e0123456789AB, 4x120f0123456789AB, 4x12100123456789AB, 4x12110123456789AB, 4x12120123456789AB, 4x12130123456789AB, 4x12140123456789AB, 4x12150123456789AB, 4x12160123456789AB, 4x12170123456789AB, 4x12180123456789AB, 4x12190123456789AB, 4x121a0123456789AB, 4x121b0123456789AB, 4x121c0123456789AB, 4x121d0123456789AB, 4x121e0123456789AB, 4x121f0123456789AB
+D145	DATA8[] 4x12200123456789AB, 4x12210123456789AB, 4x12220123456789AB, 4x12230123456789AB, 4x12240123456789AB, 4x12250123456789AB, 4x12260123456789AB, 4x12270123456789AB, 4x12280123456789AB, 4x12290123456789AB, 4x122a0123456789AB, 4x122b0123456789AB, 4x122c0123456789AB, 4x122d0123456789AB, 4x122e0123456789AB, 4x122f0123456789AB, 4x12300123456789AB, 4x12310123456789AB, 4x12320123456789AB, 4x12330123456789AB, 4x12340123456789AB, 4x12350123456789AB, 4x12360123456789AB, 4x12370123456789AB, 4x12380123456789AB, 4x12390123456789AB, 4x123a0123456789AB, 4x123b0123456789AB, 4x123c0123456789AB, 4x123d0123456789AB, 4x123e0123456789AB, 4x123f0123456789AB
+D146	DATA8[] 4x12400123456789AB, 4x12410123456789AB, 4x12420123456789AB, 4x12430123456789AB, 4x12440123456789AB, 4x12450123456789AB, 4x12460123456789AB, 4x12470123456789AB, 4x12480123456789AB, 4x12490123456789AB, 4x124a0123456789AB, 4x124b0123456789AB, 4x124c0123456789AB, 4x124d0123456789AB, 4x124e0123456789AB, 4x124f0123456789AB, 4x12500123456789AB, 4x12510123456789AB, 4x12520123456789AB, 4x12530123456789AB, 4x12540123456789AB, 4x12550123456789AB, 4x12560123456789AB, 4x12570123456789AB, 4x12580123456789AB, 4x12590123456789AB, 4x125a0123456789AB, 4x125b0123456789AB, 4x125c0123456789AB, 4x125d0123456789AB, 4x125e0123456789AB, 4x125f0123456789AB
+D147	DATA8[] 4x12600123456789AB, 4x12610123456789AB, 4x12620123456789AB, 4x12630123456789AB, 4x12640123456789AB, 4x12650123456789AB, 4x12660123456789AB, 4x12670123456789AB, 4x12680123456789AB, 4x12690123456789AB, 4x126a0123456789AB, 4x126b0123456789AB, 4x126c0123456789AB, 4x126d0123456789AB, 4x126e0123456789AB, 4x126f0123456789AB, 4x12700123456789AB, 4x12710123456789AB, 4x12720123456789AB, 4x12730123456789AB, 4x12740123456789AB, 4x12750123456789AB, 4x12760123456789AB, 4x12770123456789AB, 4x12780123456789AB, 4x12790123456789AB, 4x127a0123456789AB, 4x127b0123456789AB, 4x127c0123456789AB, 4x127d0123456789AB, 4x127e0123456789AB, 4x127f0123456789AB
+D148	DATA8[] 4x12800123456789AB, 4x12810123456789AB, 4x12820123456789AB, 4x12830123456789AB, 4x12840123456789AB, 4x12850123456789AB, 4x12860123456789AB, 4x12870123456789AB, 4x12880123456789AB, 4x12890123456789AB, 4x128a0123456789AB, 4x128b0123456789AB, 4x128c0123456789AB, 4x128d0123456789AB, 4x128e0123456789AB, 4x128f0123456789AB, 4x12900123456789AB, 4x12910123456789AB, 4x12920123456789AB, 4x12930123456789AB, 4x12940123456789AB, 4x12950123456789AB, 4x12960123456789AB, 4x12970123456789AB, 4x12980123456789AB, 4x12990123456789AB, 4x129a0123456789AB, 4x129b0123456789AB, 4x129c0123456789AB, 4x129d0123456789AB, 4x129e0123456789AB, 4x129f0123456789AB
+D149	DATA8[] 4x12a00123456789AB, 4x12a10123456789AB, 4x12a20123456789AB, 4x12a30123456789AB, 4x12a40123456789AB, 4x12a50123456789AB, 4x12a60123456789AB, 4x12a70123456789AB, 4x12a80123456789AB, 4x12a90123456789AB, 4x12aa0123456789AB, 4x12ab0123456789AB, 4x12ac0123456789AB, 4x12ad0123456789AB, 4x12ae0123456789AB, 4x12af0123456789AB, 4x12b00123456789AB, 4x12b10123456789AB, 4x12b20123456789AB, 4x12b30123456789AB, 4x12b40123456789AB, 4x12b50123456789AB, 4x12b60123456789AB, 4x12b70123456789AB, 4x12b80123456789AB, 4x12b90123456789AB, 4x12ba0123456789AB, 4x12bb0123456789AB, 4x12bc0123456789AB, 4x12bd0123456789AB, 4x12be0123456789AB, 4x12bf0123456789AB
+D150	DATA8[] 4x12c00123456789AB, 4x12c10123456789AB, 4x12c20123456789AB, 4x12c30123456789AB, 4x12c40123456789AB, 4x12c50123456789AB, 4x12c60123456789AB, 4x12c70123456789AB, 4x12c80123456789AB, 4x12c90123456789AB, 4x12ca0123456789AB, 4x12cb0123456789AB, 4x12cc0123456789AB, 4x12cd0123456789AB, 4x12ce0123456789AB, 4x12cf0123456789AB, 4x12d00123456789AB, 4x12d10123456789AB, 4x12d20123456789AB, 4x12d30123456789AB, 4x12d40123456789AB, 4x12d50123456789AB, 4x12d60123456789AB, 4x12d70123456789AB, 4x12d80123456789AB, 4x12d90123456789AB, 4x12da0123456789AB, 4x12db0123456789AB, 4x12dc0123456789AB, 4x12dd0123456789AB, 4x12de0123456789AB, 4x12df0123456789AB
+D151	DATA8[] 4x12e00123456789AB, 4x12e10123456789AB, 4x12e20123456789AB, 4x12e30123456789AB, 4x12e40123456789AB, 4x12e50123456789AB, 4x12e60123456789AB, 4x12e70123456789AB, 4x12e80123456789AB, 4x12e90123456789AB, 4x12ea0123456789AB, 4x12eb0123456789AB, 4x12ec0123456789AB, 4x12ed0123456789AB, 4x12ee0123456789AB, 4x12ef0123456789AB, 4x12f00123456789AB, 4x12f10123456789AB, 4x12f20123456789AB, 4x12f30123456789AB, 4x12f40123456789AB, 4x12f50123456789AB, 4x12f60123456789AB, 4x12f70123456789AB, 4x12f80123456789AB, 4x12f90123456789AB, 4x12fa0123456789AB, 4x12fb0123456789AB, 4x12fc0123456789AB, 4x12fd0123456789AB, 4x12fe0123456789AB, 4x12ff0123456789AB
+D152	DATA8[] 4x13000123456789AB, 4x13010123456789AB, 4x13020123456789AB, 4x13030123456789AB, 4x13040123456789AB, 4x13050123456789AB, 4x13060123456789AB, 4x13070123456789AB, 4x13080123456789AB, 4x13090123456789AB, 4x130a0123456789AB, 4x130b0123456789AB, 4x130c0123456789AB, 4x130d0123456789AB, 4x130e0123456789AB, 4x130f0123456789AB, 4x13100123456789AB, 4x13110123456789AB, 4x13120123456789AB, 4x13130123456789AB, 4x13140123456789AB, 4x13150123456789AB, 4x13160123456789AB, 4x13170123456789AB, 4x13180123456789AB, 4x13190123456789AB, 4x131a0123456789AB, 4x131b0123456789AB, 4x131c0123456789AB, 4x131d0123456789AB, 4x131e0123456789AB, 4x131f0123456789AB
+D153	DATA8[] 4x13200123456789AB, 4x13210123456789AB, 4x13220123456789AB, 4x13230123456789AB, 4x13240123456789AB, 4x13250123456789AB, 4x13260123456789AB, 4x13270123456789AB, 4x13280123456789AB, 4x13290123456789AB, 4x132a0123456789AB, 4x132b0123456789AB, 4x132c0123456789AB, 4x132d0123456789AB, 4x132e0123456789AB, 4x132f0123456789AB, 4x13300123456789AB, 4x13310123456789AB, 4x13320123456789AB, 4x13330123456789AB, 4x13340123456789AB, 4x13350123456789AB, 4x13360123456789AB, 4x13370123456789AB, 4x13380123456789AB, 4x13390123456789AB, 4x133a0123456789AB, 4x133b0123456789AB, 4x133c0123456789AB, 4x133d0123456789AB, 4x133e0123456789AB, 4x133f0123456789AB
+D154	DATA8[] 4x13400123456789AB, 4x13410123456789AB, 4x13420123456789AB, 4x13430123456789AB, 4x13440123456789AB, 4x13450123456789AB, 4x13460123456789AB, 4x13470123456789AB, 4x13480123456789AB, 4x13490123456789AB, 4x134a0123456789AB, 4x134b0123456789AB, 4x134c0123456789AB, 4x134d0123456789AB, 4x134e0123456789AB, 4x134f0123456789AB, 4x13500123456789AB, 4x13510123456789AB, 4x13520123456789AB, 4x13530123456789AB, 4x13540123456789AB, 4x13550123456789AB, 4x13560123456789AB, 4x13570123456789AB, 4x13580123456789AB, 4x13590123456789AB, 4x135a0123456789AB, 4x135b0123456789AB, 4x135c0123456789AB, 4x135d0123456789AB, 4x135e0123456789AB, 4x135f0123456789AB
+D155	DATA8[] 4x13600123456789AB, 4x13610123456789AB, 4x13620123456789AB, 4x13630123456789AB, 4x13640123456789AB, 4x13650123456789AB, 4x13660123456789AB, 4x13670123456789AB, 4x13680123456789AB, 4x13690123456789AB, 4x136a0123456789AB, 4x136b0123456789AB, 4x136c0123456789AB, 4x136d0123456789AB, 4x136e0123456789AB, 4x136f0123456789AB, 4x13700123456789AB, 4x13710123456789AB, 4x13720123456789AB, 4x13730123456789AB, 4x13740123456789AB, 4x13750123456789AB, 4x13760123456789AB, 4x13770123456789AB, 4x13780123456789AB, 4x13790123456789AB, 4x137a0123456789AB, 4x137b0123456789AB, 4x137c0123456789AB, 4x137d0123456789AB, 4x137e0123456789AB, 4x137f0123456789AB
+D156	DATA8[] 4x13800123456789AB, 4x13810123456789AB, 4x13820123456789AB, 4x13830123456789AB, 4x13840123456789AB, 4x13850123456789AB, 4x13860123456789AB, 4x13870123456789AB, 4x13880123456789AB, 4x13890123456789AB, 4x138a0123456789AB, 4x138b0123456789AB, 4x138c0123456789AB, 4x138d0123456789AB, 4x138e0123456789AB, 4x138f0123456789AB, 4x13900123456789AB, 4x13910123456789AB, 4x13920123456789AB, 4x13930123456789AB, 4x13940123456789AB, 4x13950123456789AB, 4x13960123456789AB, 4x13970123456789AB, 4x13980123456789AB, 4x13990123456789AB, 4x139a0123456789AB, 4x139b0123456789AB, 4x139c0123456789AB, 4x139d0123456789AB, 4x139e0123456789AB, 4x139f0123456789AB
+D157	DATA8[] 4x13a00123456789AB, 4x13a10123456789AB, 4x13a20123456789AB, 4x13a30123456789AB, 4x13a40123456789AB, 4x13a50123456789AB, 4x13a60123456789AB, 4x13a70123456789AB, 4x13a80123456789AB, 4x13a90123456789AB, 4x13aa0123456789AB, 4x13ab0123456789AB, 4x13ac0123456789AB, 4x13ad0123456789AB, 4x13ae0123456789AB, 4x13af0123456789AB, 4x13b00123456789AB, 4x13b10123456789AB, 4x13b20123456789AB, 4x13b30123456789AB, 4x13b40123456789AB, 4x13b50123456789AB, 4x13b60123456789AB, 4x13b70123456789AB, 4x13b80123456789AB, 4x13b90123456789AB, 4x13ba0123456789AB, 4x13bb0123456789AB, 4x13bc0123456789AB, 4x13bd0123456789AB, 4x13be0123456789AB, 4x13bf0123456789AB
+D158	DATA8[] 4x13c00123456789AB, 4x13c10123456789AB, 4x13c20123456789AB, 4x13c30123456789AB, 4x13c40123456789AB, 4x13c50123456789AB, 4x13c60123456789AB, 4x13c70123456789AB, 4x13c80123456789AB, 4x13c90123456789AB, 4x13ca0123456789AB, 4x13cb0123456789AB, 4x13cc0123456789AB, 4x13cd0123456789AB, 4x13ce0123456789AB, 4x13cf0123456789AB, 4x13d00123456789AB, 4x13d10123456789AB, 4x13d20123456789AB, 4x13d30123456789AB, 4x13d40123456789AB, 4x13d50123456789AB, 4x13d60123456789AB, 4x13d70123456789AB, 4x13d80123456789AB, 4x13d90123456789AB, 4x13da0123456789AB, 4x13db0123456789AB, 4x13dc0123456789AB, 4x13dd0123456789AB, 4x13de0123456789AB, 4x13df0123456789AB
+D159	DATA8[] 4x13e00123456789AB, 4x13e10123456789AB, 4x13e20123456789AB, 4x13e30123456789AB, 4x13e40123456789AB, 4x13e50123456789AB, 4x13e60123456789AB, 4x13e70123456789AB, 4x13e80123456789AB, 4x13e90123456789AB, 4x13ea0123456789AB, 4x13eb0123456789AB, 4x13ec0123456789AB, 4x13ed0123456789AB, 4x13ee0123456789AB, 4x13ef0123456789AB, 4x13f00123456789AB, 4x13f10123456789AB, 4x13f20123456789AB, 4x13f30123456789AB, 4x13f40123456789AB, 4x13f50123456789AB, 4x13f60123456789AB, 4x13f70123456789AB, 4x13f80123456789AB, 4x13f90123456789AB, 4x13fa0123456789AB, 4x13fb0123456789AB, 4x13fc0123456789AB, 4x13fd0123456789AB, 4x13fe0123456789AB, 4x13ff0123456789AB
+D160	DATA8[] 4x14000123456789AB, 4x14010123456789AB, 4x14020123456789AB, 4x14030123456789AB, 4x14040123456789AB, 4x14050123456789AB, 4x14060123456789AB, 4x14070123456789AB, 4x14080123456789AB, 4x14090123456789AB, 4x140a0123456789AB, 4x140b0123456789AB, 4x140c0123456789AB, 4x140d0123456789AB, 4x140e0123456789AB, 4x140f0123456789AB, 4x14100123456789AB, 4x14110123456789AB, 4x14120123456789AB, 4x14130123456789AB, 4x14140123456789AB, 4x14150123456789AB, 4x14160123456789AB, 4x14170123456789AB, 4x14180123456789AB, 4x14190123456789AB, 4x141a0123456789AB, 4x141b0123456789AB, 4x141c0123456789AB, 4x141d0123456789AB, 4x141e0123456789AB, 4x141f0123456789AB
+D161	DATA8[] 4x14200123456789AB, 4x14210123456789AB, 4x14220123456789AB, 4x14230123456789AB, 4x14240123456789AB, 4x14250123456789AB, 4x14260123456789AB, 4x14270123456789AB, 4x14280123456789AB, 4x14290123456789AB, 4x142a0123456789AB, 4x142b0123456789AB, 4x142c0123456789AB, 4x142d0123456789AB, 4x142e0123456789AB, 4x142f0123456789AB, 4x14300123456789AB, 4x14310123456789AB, 4x14320123456789AB, 4x14330123456789AB, 4x14340123456789AB, 4x14350123456789AB, 4x14360123456789AB, 4x14370123456789AB, 4x14380123456789AB, 4x14390123456789AB, 4x143a0123456789AB, 4x143b0123456789AB, 4x143c0123456789AB, 4x143d0123456789AB, 4x143e0123456789AB, 4x143f0123456789AB
+D162	DATA8[] 4x14400123456789AB, 4x14410123456789AB, 4x14420123456789AB, 4x14430123456789AB, 4x14440123456789AB, 4x14450123456789AB, 4x14460123456789AB, 4x14470123456789AB, 4x14480123456789AB, 4x14490123456789AB, 4x144a0123456789AB, 4x144b0123456789AB, 4x144c0123456789AB, 4x144d0123456789AB, 4x144e0123456789AB, 4x144f0123456789AB, 4x14500123456789AB, 4x14510123456789AB, 4x14520123456789AB, 4x14530123456789AB, 4x14540123456789AB, 4x14550123456789AB, 4x14560123456789AB, 4x14570123456789AB, 4x14580123456789AB, 4x14590123456789AB, 4x145a0123456789AB, 4x145b0123456789AB, 4x145c0123456789AB, 4x145d0123456789AB, 4x145e0123456789AB, 4x145f0123456789AB
+D163	DATA8[] 4x14600123456789AB, 4x14610123456789AB, 4x14620123456789AB, 4x14630123456789AB, 4x14640123456789AB, 4x14650123456789AB, 4x14660123456789AB, 4x14670123456789AB, 4x14680123456789AB, 4x14690123456789AB, 4x146a0123456789AB, 4x146b0123456789AB, 4x146c0123456789AB, 4x146d0123456789AB, 4x146e0123456789AB, 4x146f0123456789AB, 4x14700123456789AB, 4x14710123456789AB, 4x14720123456789AB, 4x14730123456789AB, 4x14740123456789AB, 4x14750123456789AB, 4x14760123456789AB, 4x14770123456789AB, 4x14780123456789AB, 4x14790123456789AB, 4x147a0123456789AB, 4x147b0123456789AB, 4x147c0123456789AB, 4x147d0123456789AB, 4x147e0123456789AB, 4x147f0123456789AB
+D164	DATA8[] 4x14800123456789AB, 4x14810123456789AB, 4x14820123456789AB, 4x14830123456789AB, 4x14840123456789AB, 4x14850123456789AB, 4x14860123456789AB, 4x14870123456789AB, 4x14880123456789AB, 4x14890123456789AB, 4x148a0123456789AB, 4x148b0123456789AB, 4x148c0123456789AB, 4x148d0123456789AB, 4x148e0123456789AB, 4x148f0123456789AB, 4x14900123456789AB, 4x14910123456789AB, 4x14920123456789AB, 4x14930123456789AB, 4x14940123456789AB, 4x14950123456789AB, 4x14960123456789AB, 4x14970123456789AB, 4x14980123456789AB, 4x14990123456789AB, 4x149a0123456789AB, 4x149b0123456789AB, 4x149c0123456789AB, 4x149d0123456789AB, 4x149e0123456789AB, 4x149f0123456789AB
+D165	DATA8[] 4x14a00123456789AB, 4x14a10123456789AB, 4x14a20123456789AB, 4x14a30123456789AB, 4x14a40123456789AB, 4x14a50123456789AB, 4x14a60123456789AB, 4x14a70123456789AB, 4x14a80123456789AB, 4x14a90123456789AB, 4x14aa0123456789AB, 4x14ab0123456789AB, 4x14ac0123456789AB, 4x14ad0123456789AB, 4x14ae0123456789AB, 4x14af0123456789AB, 4x14b00123456789AB, 4x14b10123456789AB, 4x14b20123456789AB, 4x14b30123456789AB, 4x14b40123456789AB, 4x14b50123456789AB, 4x14b60123456789AB, 4x14b70123456789AB, 4x14b80123456789AB, 4x14b90123456789AB, 4x14ba0123456789AB, 4x14bb0123456789AB, 4x14bc0123456789AB, 4x14bd0123456789AB, 4x14be0123456789AB, 4x14bf0123456789AB
+D166	DATA8[] 4x14c00123456789AB, 4x14c10123456789AB, 4x14c20123456789AB, 4x14c30123456789AB, 4x14c40123456789AB, 4x14c50123456789AB, 4x14c60123456789AB, 4x14c70123456789AB, 4x14c80123456789AB, 4x14c90123456789AB, 4x14ca0123456789AB, 4x14cb0123456789AB, 4x14cc0123456789AB, 4x14cd0123456789AB, 4x14ce0123456789AB, 4x14cf0123456789AB, 4x14d00123456789AB, 4x14d10123456789AB, 4x14d20123456789AB, 4x14d30123456789AB, 4x14d40123456789AB, 4x14d50123456789AB, 4x14d60123456789AB, 4x14d70123456789AB, 4x14d80123456789AB, 4x14d90123456789AB, 4x14da0123456789AB, 4x14db0123456789AB, 4x14dc0123456789AB, 4x14dd0123456789AB, 4x14de0123456789AB, 4x14df0123456789AB
+D167	DATA8[] 4x14e00123456789AB, 4x14e10123456789AB, 4x14e20123456789AB, 4x14e30123456789AB, 4x14e40123456789AB, 4x14e50123456789AB, 4x14e60123456789AB, 4x14e70123456789AB, 4x14e80123456789AB, 4x14e90123456789AB, 4x14ea0123456789AB, 4x14eb0123456789AB, 4x14ec0123456789AB, 4x14ed0123456789AB, 4x14ee0123456789AB, 4x14ef0123456789AB, 4x14f00123456789AB, 4x14f10123456789AB, 4x14f20123456789AB, 4x14f30123456789AB, 4x14f40123456789AB, 4x14f50123456789AB, 4x14f60123456789AB, 4x14f70123456789AB, 4x14f80123456789AB, 4x14f90123456789AB, 4x14fa0123456789AB, 4x14fb0123456789AB, 4x14fc0123456789AB, 4x14fd0123456789AB, 4x14fe0123456789AB, 4x14ff0123456789AB
+D168	DATA8[] 4x15000123456789AB, 4x15010123456789AB, 4x15020123456789AB, 4x15030123456789AB, 4x15040123456789AB, 4x15050123456789AB, 4x15060123456789AB, 4x15070123456789AB, 4x15080123456789AB, 4x15090123456789AB, 4x150a0123456789AB, 4x150b0123456789AB, 4x150c0123456789AB, 4x150d0123456789AB, 4x150e0123456789AB, 4x150f0123456789AB, 4x15100123456789AB, 4x15110123456789AB, 4x15120123456789AB, 4x15130123456789AB, 4x15140123456789AB, 4x15150123456789AB, 4x15160123456789AB, 4x15170123456789AB, 4x15180123456789AB, 4x15190123456789AB, 4x151a0123456789AB, 4x151b0123456789AB, 4x151c0123456789AB, 4x151d0123456789AB, 4x151e0123456789AB, 4x151f0123456789AB
+D169	DATA8[] 4x15200123456789AB, 4x15210123456789AB, 4x15220123456789AB, 4x15230123456789AB, 4x15240123456789AB, 4x15250123456789AB, 4x15260123456789AB, 4x15270123456789AB, 4x15280123456789AB, 4x15290123456789AB, 4x152a0123456789AB, 4x152b0123456789AB, 4x152c0123456789AB, 4x152d0123456789AB, 4x152e0123456789AB, 4x152f0123456789AB, 4x15300123456789AB, 4x15310123456789AB, 4x15320123456789AB, 4x15330123456789AB, 4x15340123456789AB, 4x15350123456789AB, 4x15360123456789AB, 4x15370123456789AB, 4x15380123456789AB, 4x15390123456789AB, 4x153a0123456789AB, 4x153b0123456789AB, 4x153c0123456789AB, 4x153d0123456789AB, 4x153e0123456789AB, 4x153f0123456789AB
+D170	DATA8[] 4x15400123456789AB, 4x15410123456789AB, 4x15420123456789AB, 4x15430123456789AB, 4x15440123456789AB, 4x15450123456789AB, 4x15460123456789AB, 4x15470123456789AB, 4x15480123456789AB, 4x15490123456789AB, 4x154a0123456789AB, 4x154b0123456789AB, 4x154c0123456789AB, 4x154d0123456789AB, 4x154e0123456789AB, 4x154f0123456789AB, 4x15500123456789AB, 4x15510123456789AB, 4x15520123456789AB, 4x15530123456789AB, 4x15540123456789AB, 4x15550123456789AB, 4x15560123456789AB, 4x15570123456789AB, 4x15580123456789AB, 4x15590123456789AB, 4x155a0123456789AB, 4x155b0123456789AB, 4x155c0123456789AB, 4x155d0123456789AB, 4x155e0123456789AB, 4x155f0123456789AB
+D171	DATA8[] 4x15600123456789AB, 4x15610123456789AB, 4x15620123456789AB, 4x15630123456789AB, 4x15640123456789AB, 4x15650123456789AB, 4x15660123456789AB, 4x15670123456789AB, 4x15680123456789AB, 4x15690123456789AB, 4x156a0123456789AB, 4x156b0123456789AB, 4x156c0123456789AB, 4x156d0123456789AB, 4x156e0123456789AB, 4x156f0123456789AB, 4x15700123456789AB, 4x15710123456789AB, 4x15720123456789AB, 4x15730123456789AB, 4x15740123456789AB, 4x15750123456789AB, 4x15760123456789AB, 4x15770123456789AB, 4x15780123456789AB, 4x15790123456789AB, 4x157a0123456789AB, 4x157b0123456789AB, 4x157c0123456789AB, 4x157d0123456789AB, 4x157e0123456789AB, 4x157f0123456789AB
+D172	DATA8[] 4x15800123456789AB, 4x15810123456789AB, 4x15820123456789AB, 4x15830123456789AB, 4x15840123456789AB, 4x15850123456789AB, 4x15860123456789AB, 4x15870123456789AB, 4x15880123456789AB, 4x15890123456789AB, 4x158a0123456789AB, 4x158b0123456789AB, 4x158c0123456789AB, 4x158d0123456789AB, 4x158e0123456789AB, 4x158f0123456789AB, 4x15900123456789AB, 4x15910123456789AB, 4x15920123456789AB, 4x15930123456789AB, 4x15940123456789AB, 4x15950123456789AB, 4x15960123456789AB, 4x15970123456789AB, 4x15980123456789AB, 4x15990123456789AB, 4x159a0123456789AB, 4x159b0123456789AB, 4x159c0123456789AB, 4x159d0123456789AB, 4x159e0123456789AB, 4x159f0123456789AB
+D173	DATA8[] 4x15a00123456789AB, 4x15a10123456789AB, 4x15a20123456789AB, 4x15a30123456789AB, 4x15a40123456789AB, 4x15a50123456789AB, 4x15a60123456789AB, 4x15a70123456789AB, 4x15a80123456789AB, 4x15a90123456789AB, 4x15aa0123456789AB, 4x15ab0123456789AB, 4x15ac0123456789AB, 4x15ad0123456789AB, 4x15ae0123456789AB, 4x15af0123456789AB, 4x15b00123456789AB, 4x15b10123456789AB, 4x15b20123456789AB, 4x15b30123456789AB, 4x15b40123456789AB, 4x15b50123456789AB, 4x15b60123456789AB, 4x15b70123456789AB, 4x15b80123456789AB, 4x15b90123456789AB, 4x15ba0123456789AB, 4x15bb0123456789AB, 4x15bc0123456789AB, 4x15bd0123456789AB, 4x15be0123456789AB, 4x15bf0123456789AB
+D174	DATA8[] 4x15c00123456789AB, 4x15c10123456789AB, 4x15c20123456789AB, 4x15c30123456789AB, 4x15c40123456789AB, 4x15c50123456789AB, 4x15c60123456789AB, 4x15c70123456789AB, 4x15c80123456789AB, 4x15c90123456789AB, 4x15ca0123456789AB, 4x15cb0123456789AB, 4x15cc0123456789AB, 4x15cd0123456789AB, 4x15ce0123456789AB, 4x15cf0123456789AB, 4x15d00123456789AB, 4x15d10123456789AB, 4x15d20123456789AB, 4x15d30123456789AB, 4x15d40123456789AB, 4x15d50123456789AB, 4x15d60123456789AB, 4x15d70123456789AB, 4x15d80123456789AB, 4x15d90123456789AB, 4x15da0123456789AB, 4x15db0123456789AB, 4x15dc0123456789AB, 4x15dd0123456789AB, 4x15de0123456789AB, 4x15df0123456789AB
+D175	DATA8[] 4x15e00123456789AB, 4x15e10123456789AB, 4x15e20123456789AB, 4x15e30123456789AB, 4x15e40123456789AB, 4x15e50123456789AB, 4x15e60123456789AB, 4x15e70123456789AB, 4x15e80123456789AB, 4x15e90123456789AB, 4x15ea0123456789AB, 4x15eb0123456789AB, 4x15ec0123456789AB, 4x15ed0123456789AB, 4x15ee0123456789AB, 4x15ef0123456789AB, 4x15f00123456789AB, 4x15f10123456789AB, 4x15f20123456789AB, 4x15f30123456789AB, 4x15f40123456789AB, 4x15f50123456789AB, 4x15f60123456789AB, 4x15f70123456789AB, 4x15f80123456789AB, 4x15f90123456789AB, 4x15fa0123456789AB, 4x15fb0123456789AB, 4x15fc0123456789AB, 4x15fd0123456789AB, 4x15fe0123456789AB, 4x15ff0123456789AB
+D176	DATA8[] 4x16000123456789AB, 4x16010123456789AB, 4x16020123456789AB, 4x16030123456789AB, 4x16040123456789AB, 4x16050123456789AB, 4x16060123456789AB, 4x16070123456789AB, 4x16080123456789AB, 4x16090123456789AB, 4x160a0123456789AB, 4x160b0123456789AB, 4x160c0123456789AB, 4x160d0123456789AB, 4x160e0123456789AB, 4x160f0123456789AB, 4x16100123456789AB, 4x16110123456789AB, 4x16120123456789AB, 4x16130123456789AB, 4x16140123456789AB, 4x16150123456789AB, 4x16160123456789AB, 4x16170123456789AB, 4x16180123456789AB, 4x16190123456789AB, 4x161a0123456789AB, 4x161b0123456789AB, 4x161c0123456789AB, 4x161d0123456789AB, 4x161e0123456789AB, 4x161f0123456789AB
+D177	DATA8[] 4x16200123456789AB, 4x16210123456789AB, 4x16220123456789AB, 4x16230123456789AB, 4x16240123456789AB, 4x16250123456789AB, 4x16260123456789AB, 4x16270123456789AB, 4x16280123456789AB, 4x16290123456789AB, 4x162a0123456789AB, 4x162b0123456789AB, 4x162c0123456789AB, 4x162d0123456789AB, 4x162e0123456789AB, 4x162f0123456789AB, 4x16300123456789AB, 4x16310123456789AB, 4x16320123456789AB, 4x16330123456789AB, 4x16340123456789AB, 4x16350123456789AB, 4x16360123456789AB, 4x16370123456789AB, 4x16380123456789AB, 4x16390123456789AB, 4x163a0123456789AB, 4x163b0123456789AB, 4x163c0123456789AB, 4x163d0123456789AB, 4x163e0123456789AB, 4x163f0123456789AB
+D178	DATA8[] 4x16400123456789AB, 4x16410123456789AB, 4x16420123456789AB, 4x16430123456789AB, 4x16440123456789AB, 4x16450123456789AB, 4x16460123456789AB, 4x16470123456789AB, 4x16480123456789AB, 4x16490123456789AB, 4x164a0123456789AB, 4x164b0123456789AB, 4x164c0123456789AB, 4x164d0123456789AB, 4x164e0123456789AB, 4x164f0123456789AB, 4x16500123456789AB, 4x16510123456789AB, 4x16520123456789AB, 4x16530123456789AB, 4x16540123456789AB, 4x16550123456789AB, 4x16560123456789AB, 4x16570123456789AB, 4x16580123456789AB, 4x16590123456789AB, 4x165a0123456789AB, 4x165b0123456789AB, 4x165c0123456789AB, 4x165d0123456789AB, 4x165e0123456789AB, 4x165f0123456789AB
+D179	DATA8[] 4x16600123456789AB, 4x16610123456789AB, 4x16620123456789AB, 4x16630123456789AB, 4x16640123456789AB, 4x16650123456789AB, 4x16660123456789AB, 4x16670123456789AB, 4x16680123456789AB, 4x16690123456789AB, 4x166a0123456789AB, 4x166b0123456789AB, 4x166c0123456789AB, 4x166d0123456789AB, 4x166e0123456789AB, 4x166f0123456789AB, 4x16700123456789AB, 4x16710123456789AB, 4x16720123456789AB, 4x16730123456789AB, 4x16740123456789AB, 4x16750123456789AB, 4x16760123456789AB, 4x16770123456789AB, 4x16780123456789AB, 4x16790123456789AB, 4x167a0123456789AB, 4x167b0123456789AB, 4x167c0123456789AB, 4x167d0123456789AB, 4x167e0123456789AB, 4x167f0123456789AB
+D180	DATA8[] 4x16800123456789AB, 4x16810123456789AB, 4x16820123456789AB, 4x16830123456789AB, 4x16840123456789AB, 4x16850123456789AB, 4x16860123456789AB, 4x16870123456789AB, 4x16880123456789AB, 4x16890123456789AB, 4x168a0123456789AB, 4x168b0123456789AB, 4x168c0123456789AB, 4x168d0123456789AB, 4x168e0123456789AB, 4x168f0123456789AB, 4x16900123456789AB, 4x16910123456789AB, 4x16920123456789AB, 4x16930123456789AB, 4x16940123456789AB, 4x16950123456789AB, 4x16960123456789AB, 4x16970123456789AB, 4x16980123456789AB, 4x16990123456789AB, 4x169a0123456789AB, 4x169b0123456789AB, 4x169c0123456789AB, 4x169d0123456789AB, 4x169e0123456789AB, 4x169f0123456789AB
+D181	DATA8[] 4x16a00123456789AB, 4x16a10123456789AB, 4x16a20123456789AB, 4x16a30123456789AB, 4x16a40123456789AB, 4x16a50123456789AB, 4x16a60123456789AB, 4x16a70123456789AB, 4x16a80123456789AB, 4x16a90123456789AB, 4x16aa0123456789AB, 4x16ab0123456789AB, 4x16ac0123456789AB, 4x16ad0123456789AB, 4x16ae0123456789AB, 4x16af0123456789AB, 4x16b00123456789AB, 4x16b10123456789AB, 4x16b20123456789AB, 4x16b30123456789AB, 4x16b40123456789AB, 4x16b50123456789AB, 4x16b60123456789AB, 4x16b70123456789AB, 4x16b80123456789AB, 4x16b90123456789AB, 4x16ba0123456789AB, 4x16bb0123456789AB, 4x16bc0123456789AB, 4x16bd0123456789AB, 4x16be0123456789AB, 4x16bf0123456789AB
+D182	DATA8[] 4x16c00123456789AB, 4x16c10123456789AB, 4x16c20123456789AB, 4x16c30123456789AB, 4x16c40123456789AB, 4x16c50123456789AB, 4x16c60123456789AB, 4x16c70123456789AB, 4x16c80123456789AB, 4x16c90123456789AB, 4x16ca0123456789AB, 4x16cb0123456789AB, 4x16cc0123456789AB, 4x16cd0123456789AB, 4x16ce0123456789AB, 4x16cf0123456789AB, 4x16d00123456789AB, 4x16d10123456789AB, 4x16d20123456789AB, 4x16d30123456789AB, 4x16d40123456789AB, 4x16d50123456789AB, 4x16d60123456789AB, 4x16d70123456789AB, 4x16d80123456789AB, 4x16d90123456789AB, 4x16da0123456789AB, 4x16db0123456789AB, 4x16dc0123456789AB, 4x16dd0123456789AB, 4x16de0123456789AB, 4x16df0123456789AB
+D183	DATA8[] 4x16e00123456789AB, 4x16e10123456789AB, 4x16e20123456789AB, 4x16e30123456789AB, 4x16e40123456789AB, 4x16e50123456789AB, 4x16e60123456789AB, 4x16e70123456789AB, 4x16e80123456789AB, 4x16e90123456789AB, 4x16ea0123456789AB, 4x16eb0123456789AB, 4x16ec0123456789AB, 4x16ed0123456789AB, 4x16ee0123456789AB, 4x16ef0123456789AB, 4x16f00123456789AB, 4x16f10123456789AB, 4x16f20123456789AB, 4x16f30123456789AB, 4x16f40123456789AB, 4x16f50123456789AB, 4x16f60123456789AB, 4x16f70123456789AB, 4x16f80123456789AB, 4x16f90123456789AB, 4x16fa0123456789AB, 4x16fb0123456789AB, 4x16fc0123456789AB, 4x16fd0123456789AB, 4x16fe0123456789AB, 4x16ff0123456789AB
+D184	DATA8[] 4x17000123456789AB, 4x17010123456789AB, 4x17020123456789AB, 4x17030123456789AB, 4x17040123456789AB, 4x17050123456789AB, 4x17060123456789AB, 4x17070123456789AB, 4x17080123456789AB, 4x17090123456789AB, 4x170a0123456789AB, 4x170b0123456789AB, 4x170c0123456789AB, 4x170d0123456789AB, 4x170e0123456789AB, 4x170f0123456789AB, 4x17100123456789AB, 4x17110123456789AB, 4x17120123456789AB, 4x17130123456789AB, 4x17140123456789AB, 4x17150123456789AB, 4x17160123456789AB, 4x17170123456789AB, 4x17180123456789AB, 4x17190123456789AB, 4x171a0123456789AB, 4x171b0123456789AB, 4x171c0123456789AB, 4x171d0123456789AB, 4x171e0123456789AB, 4x171f0123456789AB
+D185	DATA8[] 4x17200123456789AB, 4x17210123456789AB, 4x17220123456789AB, 4x17230123456789AB, 4x17240123456789AB, 4x17250123456789AB, 4x17260123456789AB, 4x17270123456789AB, 4x17280123456789AB, 4x17290123456789AB, 4x172a0123456789AB, 4x172b0123456789AB, 4x172c0123456789AB, 4x172d0123456789AB, 4x172e0123456789AB, 4x172f0123456789AB, 4x17300123456789AB, 4x17310123456789AB, 4x17320123456789AB, 4x17330123456789AB, 4x17340123456789AB, 4x17350123456789AB, 4x17360123456789AB, 4x17370123456789AB, 4x17380123456789AB, 4x17390123456789AB, 4x173a0123456789AB, 4x173b0123456789AB, 4x173c0123456789AB, 4x173d0123456789AB, 4x173e0123456789AB, 4x173f0123456789AB
+D186	DATA8[] 4x17400123456789AB, 4x17410123456789AB, 4x17420123456789AB, 4x17430123456789AB, 4x17440123456789AB, 4x17450123456789AB, 4x17460123456789AB, 4x17470123456789AB, 4x17480123456789AB, 4x17490123456789AB, 4x174a0123456789AB, 4x174b0123456789AB, 4x174c0123456789AB, 4x174d0123456789AB, 4x174e0123456789AB, 4x174f0123456789AB, 4x17500123456789AB, 4x17510123456789AB, 4x17520123456789AB, 4x17530123456789AB, 4x17540123456789AB, 4x17550123456789AB, 4x17560123456789AB, 4x17570123456789AB, 4x17580123456789AB, 4x17590123456789AB, 4x175a0123456789AB, 4x175b0123456789AB, 4x175c0123456789AB, 4x175d0123456789AB, 4x175e0123456789AB, 4x175f0123456789AB
+D187	DATA8[] 4x17600123456789AB, 4x17610123456789AB, 4x17620123456789AB, 4x17630123456789AB, 4x17640123456789AB, 4x17650123456789AB, 4x17660123456789AB, 4x17670123456789AB, 4x17680123456789AB, 4x17690123456789AB, 4x176a0123456789AB, 4x176b0123456789AB, 4x176c0123456789AB, 4x176d0123456789AB, 4x176e0123456789AB, 4x176f0123456789AB, 4x17700123456789AB, 4x17710123456789AB, 4x17720123456789AB, 4x17730123456789AB, 4x17740123456789AB, 4x17750123456789AB, 4x17760123456789AB, 4x17770123456789AB, 4x17780123456789AB, 4x17790123456789AB, 4x177a0123456789AB, 4x177b0123456789AB, 4x177c0123456789AB, 4x177d0123456789AB, 4x177e0123456789AB, 4x177f0123456789AB
+D188	DATA8[] 4x17800123456789AB, 4x17810123456789AB, 4x17820123456789AB, 4x17830123456789AB, 4x17840123456789AB, 4x17850123456789AB, 4x17860123456789AB, 4x17870123456789AB, 4x17880123456789AB, 4x17890123456789AB, 4x178a0123456789AB, 4x178b0123456789AB, 4x178c0123456789AB, 4x178d0123456789AB, 4x178e0123456789AB, 4x178f0123456789AB, 4x17900123456789AB, 4x17910123456789AB, 4x17920123456789AB, 4x17930123456789AB, 4x17940123456789AB, 4x17950123456789AB, 4x17960123456789AB, 4x17970123456789AB, 4x17980123456789AB, 4x17990123456789AB, 4x179a0123456789AB, 4x179b0123456789AB, 4x179c0123456789AB, 4x179d0123456789AB, 4x179e0123456789AB, 4x179f0123456789AB
+D189	DATA8[] 4x17a00123456789AB, 4x17a10123456789AB, 4x17a20123456789AB, 4x17a30123456789AB, 4x17a40123456789AB, 4x17a50123456789AB, 4x17a60123456789AB, 4x17a70123456789AB, 4x17a80123456789AB, 4x17a90123456789AB, 4x17aa0123456789AB, 4x17ab0123456789AB, 4x17ac0123456789AB, 4x17ad0123456789AB, 4x17ae0123456789AB, 4x17af0123456789AB, 4x17b00123456789AB, 4x17b10123456789AB, 4x17b20123456789AB, 4x17b30123456789AB, 4x17b40123456789AB, 4x17b50123456789AB, 4x17b60123456789AB, 4x17b70123456789AB, 4x17b80123456789AB, 4x17b90123456789AB, 4x17ba0123456789AB, 4x17bb0123456789AB, 4x17bc0123456789AB, 4x17bd0123456789AB, 4x17be0123456789AB, 4x17bf0123456789AB
+D190	DATA8[] 4x17c00123456789AB, 4x17c10123456789AB, 4x17c20123456789AB, 4x17c30123456789AB, 4x17c40123456789AB, 4x17c50123456789AB, 4x17c60123456789AB, 4x17c70123456789AB, 4x17c80123456789AB, 4x17c90123456789AB, 4x17ca0123456789AB, 4x17cb0123456789AB, 4x17cc0123456789AB, 4x17cd0123456789AB, 4x17ce0123456789AB, 4x17cf0123456789AB, 4x17d00123456789AB, 4x17d10123456789AB, 4x17d20123456789AB, 4x17d30123456789AB, 4x17d40123456789AB, 4x17d50123456789AB, 4x17d60123456789AB, 4x17d70123456789AB, 4x17d80123456789AB, 4x17d90123456789AB, 4x17da0123456789AB, 4x17db0123456789AB, 4x17dc0123456789AB, 4x17dd0123456789AB, 4x17de0123456789AB, 4x17df0123456789AB
+D191	DATA8[] 4x17e00123456789AB, 4x17e10123456789AB, 4x17e20123456789AB, 4x17e30123456789AB, 4x17e40123456789AB, 4x17e50123456789AB, 4x17e60123456789AB, 4x17e70123456789AB, 4x17e80123456789AB, 4x17e90123456789AB, 4x17ea0123456789AB, 4x17eb0123456789AB, 4x17ec0123456789AB, 4x17ed0123456789AB, 4x17ee0123456789AB, 4x17ef0123456789AB, 4x17f00123456789AB, 4x17f10123456789AB, 4x17f20123456789AB, 4x17f30123456789AB, 4x17f40123456789AB, 4x17f50123456789AB, 4x17f60123456789AB, 4x17f70123456789AB, 4x17f80123456789AB, 4x17f90123456789AB, 4x17fa0123456789AB, 4x17fb0123456789AB, 4x17fc0123456789AB, 4x17fd0123456789AB, 4x17fe0123456789AB, 4x17ff0123456789AB
+D192	DATA8[] 4x18000123456789AB, 4x18010123456789AB, 4x18020123456789AB, 4x18030123456789AB, 4x18040123456789AB, 4x18050123456789AB, 4x18060123456789AB, 4x18070123456789AB, 4x18080123456789AB, 4x18090123456789AB, 4x180a0123456789AB, 4x180b0123456789AB, 4x180c0123456789AB, 4x180d0123456789AB, 4x180e0123456789AB, 4x180f0123456789AB, 4x18100123456789AB, 4x18110123456789AB, 4x18120123456789AB, 4x18130123456789AB, 4x18140123456789AB, 4x18150123456789AB, 4x18160123456789AB, 4x18170123456789AB, 4x18180123456789AB, 4x18190123456789AB, 4x181a0123456789AB, 4x181b0123456789AB, 4x181c0123456789AB, 4x181d0123456789AB, 4x181e0123456789AB, 4x181f0123456789AB
+D193	DATA8[] 4x18200123456789AB, 4x18210123456789AB, 4x18220123456789AB, 4x18230123456789AB, 4x18240123456789AB, 4x18250123456789AB, 4x18260123456789AB, 4x18270123456789AB, 4x18280123456789AB, 4x18290123456789AB, 4x182a0123456789AB, 4x182b0123456789AB, 4x182c0123456789AB, 4x182d0123456789AB, 4x182e0123456789AB, 4x182f0123456789AB, 4x18300123456789AB, 4x18310123456789AB, 4x18320123456789AB, 4x18330123456789AB, 4x18340123456789AB, 4x18350123456789AB, 4x18360123456789AB, 4x18370123456789AB, 4x18380123456789AB, 4x18390123456789AB, 4x183a0123456789AB, 4x183b0123456789AB, 4x183c0123456789AB, 4x183d0123456789AB, 4x183e0123456789AB, 4x183f0123456789AB
+D194	DATA8[] 4x18400123456789AB, 4x18410123456789AB, 4x18420123456789AB, 4x18430123456789AB, 4x18440123456789AB, 4x18450123456789AB, 4x18460123456789AB, 4x18470123456789AB, 4x18480123456789AB, 4x18490123456789AB, 4x184a0123456789AB, 4x184b0123456789AB, 4x184c0123456789AB, 4x184d0123456789AB, 4x184e0123456789AB, 4x184f0123456789AB, 4x18500123456789AB, 4x18510123456789AB, 4x18520123456789AB, 4x18530123456789AB, 4x18540123456789AB, 4x18550123456789AB, 4x18560123456789AB, 4x18570123456789AB, 4x18580123456789AB, 4x18590123456789AB, 4x185a0123456789AB, 4x185b0123456789AB, 4x185c0123456789AB, 4x185d0123456789AB, 4x185e0123456789AB, 4x185f0123456789AB
+D195	DATA8[] 4x18600123456789AB, 4x18610123456789AB, 4x18620123456789AB, 4x18630123456789AB, 4x18640123456789AB, 4x18650123456789AB, 4x18660123456789AB, 4x18670123456789AB, 4x18680123456789AB, 4x18690123456789AB, 4x186a0123456789AB, 4x186b0123456789AB, 4x186c0123456789AB, 4x186d0123456789AB, 4x186e0123456789AB, 4x186f0123456789AB, 4x18700123456789AB, 4x18710123456789AB, 4x18720123456789AB, 4x18730123456789AB, 4x18740123456789AB, 4x18750123456789AB, 4x18760123456789AB, 4x18770123456789AB, 4x18780123456789AB, 4x18790123456789AB, 4x187a0123456789AB, 4x187b0123456789AB, 4x187c0123456789AB, 4x187d0123456789AB, 4x187e0123456789AB, 4x187f0123456789AB
+D196	DATA8[] 4x18800123456789AB, 4x18810123456789AB, 4x18820123456789AB, 4x18830123456789AB, 4x18840123456789AB, 4x18850123456789AB, 4x18860123456789AB, 4x18870123456789AB, 4x18880123456789AB, 4x18890123456789AB, 4x188a0123456789AB, 4x188b0123456789AB, 4x188c0123456789AB, 4x188d0123456789AB, 4x188e0123456789AB, 4x188f0123456789AB, 4x18900123456789AB, 4x18910123456789AB, 4x18920123456789AB, 4x18930123456789AB, 4x18940123456789AB, 4x18950123456789AB, 4x18960123456789AB, 4x18970123456789AB, 4x18980123456789AB, 4x18990123456789AB, 4x189a0123456789AB, 4x189b0123456789AB, 4x189c0123456789AB, 4x189d0123456789AB, 4x189e0123456789AB, 4x189f0123456789AB
+D197	DATA8[] 4x18a00123456789AB, 4x18a10123456789AB, 4x18a20123456789AB, 4x18a30123456789AB, 4x18a40123456789AB, 4x18a50123456789AB, 4x18a60123456789AB, 4x18a70123456789AB, 4x18a80123456789AB, 4x18a90123456789AB, 4x18aa0123456789AB, 4x18ab0123456789AB, 4x18ac0123456789AB, 4x18ad0123456789AB, 4x18ae0123456789AB, 4x18af0123456789AB, 4x18b00123456789AB, 4x18b10123456789AB, 4x18b20123456789AB, 4x18b30123456789AB, 4x18b40123456789AB, 4x18b50123456789AB, 4x18b60123456789AB, 4x18b70123456789AB, 4x18b80123456789AB, 4x18b90123456789AB, 4x18ba0123456789AB, 4x18bb0123456789AB, 4x18bc0123456789AB, 4x18bd0123456789AB, 4x18be0123456789AB, 4x18bf0123456789AB
+D198	DATA8[] 4x18c00123456789AB, 4x18c10123456789AB, 4x18c20123456789AB, 4x18c30123456789AB, 4x18c40123456789AB, 4x18c50123456789AB, 4x18c60123456789AB, 4x18c70123456789AB, 4x18c80123456789AB, 4x18c90123456789AB, 4x18ca0123456789AB, 4x18cb0123456789AB, 4x18cc0123456789AB, 4x18cd0123456789AB, 4x18ce0123456789AB, 4x18cf0123456789AB, 4x18d00123456789AB, 4x18d10123456789AB, 4x18d20123456789AB, 4x18d30123456789AB, 4x18d40123456789AB, 4x18d50123456789AB, 4x18d60123456789AB, 4x18d70123456789AB, 4x18d80123456789AB, 4x18d90123456789AB, 4x18da0123456789AB, 4x18db0123456789AB, 4x18dc0123456789AB, 4x18dd0123456789AB, 4x18de0123456789AB, 4x18df0123456789AB
+D199	DATA8[] 4x18e00123456789AB, 4x18e10123456789AB, 4x18e20123456789AB, 4x18e30123456789AB, 4x18e40123456789AB, 4x18e50123456789AB, 4x18e60123456789AB, 4x18e70123456789AB, 4x18e80123456789AB, 4x18e90123456789AB, 4x18ea0123456789AB, 4x18eb0123456789AB, 4x18ec0123456789AB, 4x18ed0123456789AB, 4x18ee0123456789AB, 4x18ef0123456789AB, 4x18f00123456789AB, 4x18f10123456789AB, 4x18f20123456789AB, 4x18f30123456789AB, 4x18f40123456789AB, 4x18f50123456789AB, 4x18f60123456789AB, 4x18f70123456789AB, 4x18f80123456789AB, 4x18f90123456789AB, 4x18fa0123456789AB, 4x18fb0123456789AB, 4x18fc0123456789AB, 4x18fd0123456789AB, 4x18fe0123456789AB, 4x18ff0123456789AB
+D200	DATA8[] 4x19000123456789AB, 4x19010123456789AB, 4x19020123456789AB, 4x19030123456789AB, 4x19040123456789AB, 4x19050123456789AB, 4x19060123456789AB, 4x19070123456789AB, 4x19080123456789AB, 4x19090123456789AB, 4x190a0123456789AB, 4x190b0123456789AB, 4x190c0123456789AB, 4x190d0123456789AB, 4x190e0123456789AB, 4x190f0123456789AB, 4x19100123456789AB, 4x19110123456789AB, 4x19120123456789AB, 4x19130123456789AB, 4x19140123456789AB, 4x19150123456789AB, 4x19160123456789AB, 4x19170123456789AB, 4x19180123456789AB, 4x19190123456789AB, 4x191a0123456789AB, 4x191b0123456789AB, 4x191c0123456789AB, 4x191d0123456789AB, 4x191e0123456789AB, 4x191f0123456789AB
+D201	DATA8[] 4x19200123456789AB, 4x19210123456789AB, 4x19220123456789AB, 4x19230123456789AB, 4x19240123456789AB, 4x19250123456789AB, 4x19260123456789AB, 4x19270123456789AB, 4x19280123456789AB, 4x19290123456789AB, 4x192a0123456789AB, 4x192b0123456789AB, 4x192c0123456789AB, 4x192d0123456789AB, 4x192e0123456789AB, 4x192f0123456789AB, 4x19300123456789AB, 4x19310123456789AB, 4x19320123456789AB, 4x19330123456789AB, 4x19340123456789AB, 4x19350123456789AB, 4x19360123456789AB, 4x19370123456789AB, 4x19380123456789AB, 4x19390123456789AB, 4x193a0123456789AB, 4x193b0123456789AB, 4x193c0123456789AB, 4x193d0123456789AB, 4x193e0123456789AB, 4x193f0123456789AB
+D202	DATA8[] 4x19400123456789AB, 4x19410123456789AB, 4x19420123456789AB, 4x19430123456789AB, 4x19440123456789AB, 4x19450123456789AB, 4x19460123456789AB, 4x19470123456789AB, 4x19480123456789AB, 4x19490123456789AB, 4x194a0123456789AB, 4x194b0123456789AB, 4x194c0123456789AB, 4x194d0123456789AB, 4x194e0123456789AB, 4x194f0123456789AB, 4x19500123456789AB, 4x19510123456789AB, 4x19520123456789AB, 4x19530123456789AB, 4x19540123456789AB, 4x19550123456789AB, 4x19560123456789AB, 4x19570123456789AB, 4x19580123456789AB, 4x19590123456789AB, 4x195a0123456789AB, 4x195b0123456789AB, 4x195c0123456789AB, 4x195d0123456789AB, 4x195e0123456789AB, 4x195f0123456789AB
+D203	DATA8[] 4x19600123456789AB, 4x19610123456789AB, 4x19620123456789AB, 4x19630123456789AB, 4x19640123456789AB, 4x19650123456789AB, 4x19660123456789AB, 4x19670123456789AB, 4x19680123456789AB, 4x19690123456789AB, 4x196a0123456789AB, 4x196b0123456789AB, 4x196c0123456789AB, 4x196d0123456789AB, 4x196e0123456789AB, 4x196f0123456789AB, 4x19700123456789AB, 4x19710123456789AB, 4x19720123456789AB, 4x19730123456789AB, 4x19740123456789AB, 4x19750123456789AB, 4x19760123456789AB, 4x19770123456789AB, 4x19780123456789AB, 4x19790123456789AB, 4x197a0123456789AB, 4x197b0123456789AB, 4x197c0123456789AB, 4x197d0123456789AB, 4x197e0123456789AB, 4x197f0123456789AB
+D204	DATA8[] 4x19800123456789AB, 4x19810123456789AB, 4x19820123456789AB, 4x19830123456789AB, 4x19840123456789AB, 4x19850123456789AB, 4x19860123456789AB, 4x19870123456789AB, 4x19880123456789AB, 4x19890123456789AB, 4x198a0123456789AB, 4x198b0123456789AB, 4x198c0123456789AB, 4x198d0123456789AB, 4x198e0123456789AB, 4x198f0123456789AB, 4x19900123456789AB, 4x19910123456789AB, 4x19920123456789AB, 4x19930123456789AB, 4x19940123456789AB, 4x19950123456789AB, 4x19960123456789AB, 4x19970123456789AB, 4x19980123456789AB, 4x19990123456789AB, 4x199a0123456789AB, 4x199b0123456789AB, 4x199c0123456789AB, 4x199d0123456789AB, 4x199e0123456789AB, 4x199f0123456789AB
+D205	DATA8[] 4x19a00123456789AB, 4x19a10123456789AB, 4x19a20123456789AB, 4x19a30123456789AB, 4x19a40123456789AB, 4x19a50123456789AB, 4x19a60123456789AB, 4x19a70123456789AB, 4x19a80123456789AB, 4x19a90123456789AB, 4x19aa0123456789AB, 4x19ab0123456789AB, 4x19ac0123456789AB, 4x19ad0123456789AB, 4x19ae0123456789AB, 4x19af0123456789AB, 4x19b00123456789AB, 4x19b10123456789AB, 4x19b20123456789AB, 4x19b30123456789AB, 4x19b40123456789AB, 4x19b50123456789AB, 4x19b60123456789AB, 4x19b70123456789AB, 4x19b80123456789AB, 4x19b90123456789AB, 4x19ba0123456789AB, 4x19bb0123456789AB, 4x19bc0123456789AB, 4x19bd0123456789AB, 4x19be0123456789AB, 4x19bf0123456789AB
+D206	DATA8[] 4x19c00123456789AB, 4x19c10123456789AB, 4x19c20123456789AB, 4x19c30123456789AB, 4x19c40123456789AB, 4x19c50123456789AB, 4x19c60123456789AB, 4x19c70123456789AB, 4x19c80123456789AB, 4x19c90123456789AB, 4x19ca0123456789AB, 4x19cb0123456789AB, 4x19cc0123456789AB, 4x19cd0123456789AB, 4x19ce0123456789AB, 4x19cf0123456789AB, 4x19d00123456789AB, 4x19d10123456789AB, 4x19d20123456789AB, 4x19d30123456789AB, 4x19d40123456789AB, 4x19d50123456789AB, 4x19d60123456789AB, 4x19d70123456789AB, 4x19d80123456789AB, 4x19d90123456789AB, 4x19da0123456789AB, 4x19db0123456789AB, 4x19dc0123456789AB, 4x19dd0123456789AB, 4x19de0123456789AB, 4x19df0123456789AB
+D207	DATA8[] 4x19e00123456789AB, 4x19e10123456789AB, 4x19e20123456789AB, 4x19e30123456789AB, 4x19e40123456789AB, 4x19e50123456789AB, 4x19e60123456789AB, 4x19e70123456789AB, 4x19e80123456789AB, 4x19e90123456789AB, 4x19ea0123456789AB, 4x19eb0123456789AB, 4x19ec0123456789AB, 4x19ed0123456789AB, 4x19ee0123456789AB, 4x19ef0123456789AB, 4x19f00123456789AB, 4x19f10123456789AB, 4x19f20123456789AB, 4x19f30123456789AB, 4x19f40123456789AB, 4x19f50123456789AB, 4x19f60123456789AB, 4x19f70123456789AB, 4x19f80123456789AB, 4x19f90123456789AB, 4x19fa0123456789AB, 4x19fb0123456789AB, 4x19fc0123456789AB, 4x19fd0123456789AB, 4x19fe0123456789AB, 4x19ff0123456789AB
+D208	DATA8[] 4x1a000123456789AB, 4x1a010123456789AB, 4x1a020123456789AB, 4x1a030123456789AB, 4x1a040123456789AB, 4x1a050123456789AB, 4x1a060123456789AB, 4x1a070123456789AB, 4x1a080123456789AB, 4x1a090123456789AB, 4x1a0a0123456789AB, 4x1a0b0123456789AB, 4x1a0c0123456789AB, 4x1a0d0123456789AB, 4x1a0e0123456789AB, 4x1a0f0123456789AB, 4x1a100123456789AB, 4x1a110123456789AB, 4x1a120123456789AB, 4x1a130123456789AB, 4x1a140123456789AB, 4x1a150123456789AB, 4x1a160123456789AB, 4x1a170123456789AB, 4x1a180123456789AB, 4x1a190123456789AB, 4x1a1a0123456789AB, 4x1a1b0123456789AB, 4x1a1c0123456789AB, 4x1a1d0123456789AB, 4x1a1e0123456789AB, 4x1a1f0123456789AB
+D209	DATA8[] 4x1a200123456789AB, 4x1a210123456789AB, 4x1a220123456789AB, 4x1a230123456789AB, 4x1a240123456789AB, 4x1a250123456789AB, 4x1a260123456789AB, 4x1a270123456789AB, 4x1a280123456789AB, 4x1a290123456789AB, 4x1a2a0123456789AB, 4x1a2b0123456789AB, 4x1a2c0123456789AB, 4x1a2d0123456789AB, 4x1a2e0123456789AB, 4x1a2f0123456789AB, 4x1a300123456789AB, 4x1a310123456789AB, 4x1a320123456789AB, 4x1a330123456789AB, 4x1a340123456789AB, 4x1a350123456789AB, 4x1a360123456789AB, 4x1a370123456789AB, 4x1a380123456789AB, 4x1a390123456789AB, 4x1a3a0123456789AB, 4x1a3b0123456789AB, 4x1a3c0123456789AB, 4x1a3d0123456789AB, 4x1a3e0123456789AB, 4x1a3f0123456789AB
+D210	DATA8[] 4x1a400123456789AB, 4x1a410123456789AB, 4x1a420123456789AB, 4x1a430123456789AB, 4x1a440123456789AB, 4x1a450123456789AB, 4x1a460123456789AB, 4x1a470123456789AB, 4x1a480123456789AB, 4x1a490123456789AB, 4x1a4a0123456789AB, 4x1a4b0123456789AB, 4x1a4c0123456789AB, 4x1a4d0123456789AB, 4x1a4e0123456789AB, 4x1a4f0123456789AB, 4x1a500123456789AB, 4x1a510123456789AB, 4x1a520123456789AB, 4x1a530123456789AB, 4x1a540123456789AB, 4x1a550123456789AB, 4x1a560123456789AB, 4x1a570123456789AB, 4x1a580123456789AB, 4x1a590123456789AB, 4x1a5a0123456789AB, 4x1a5b0123456789AB, 4x1a5c0123456789AB, 4x1a5d0123456789AB, 4x1a5e0123456789AB, 4x1a5f0123456789AB
+D211	DATA8[] 4x1a600123456789AB, 4x1a610123456789AB, 4x1a620123456789AB, 4x1a630123456789AB, 4x1a640123456789AB, 4x1a650123456789AB, 4x1a660123456789AB, 4x1a670123456789AB, 4x1a680123456789AB, 4x1a690123456789AB, 4x1a6a0123456789AB, 4x1a6b0123456789AB, 4x1a6c0123456789AB, 4x1a6d0123456789AB, 4x1a6e0123456789AB, 4x1a6f0123456789AB, 4x1a700123456789AB, 4x1a710123456789AB, 4x1a720123456789AB, 4x1a730123456789AB, 4x1a740123456789AB, 4x1a750123456789AB, 4x1a760123456789AB, 4x1a770123456789AB, 4x1a780123456789AB, 4x1a790123456789AB, 4x1a7a0123456789AB, 4x1a7b0123456789AB, 4x1a7c0123456789AB, 4x1a7d0123456789AB, 4x1a7e0123456789AB, 4x1a7f0123456789AB
+D212	DATA8[] 4x1a800123456789AB, 4x1a810123456789AB, 4x1a820123456789AB, 4x1a830123456789AB, 4x1a840123456789AB, 4x1a850123456789AB, 4x1a860123456789AB, 4x1a870123456789AB, 4x1a880123456789AB, 4x1a890123456789AB, 4x1a8a0123456789AB, 4x1a8b0123456789AB, 4x1a8c0123456789AB, 4x1a8d0123456789AB, 4x1a8e0123456789AB, 4x1a8f0123456789AB, 4x1a900123456789AB, 4x1a910123456789AB, 4x1a920123456789AB, 4x1a930123456789AB, 4x1a940123456789AB, 4x1a950123456789AB, 4x1a960123456789AB, 4x1a970123456789AB, 4x1a980123456789AB, 4x1a990123456789AB, 4x1a9a0123456789AB, 4x1a9b0123456789AB, 4x1a9c0123456789AB, 4x1a9d0123456789AB, 4x1a9e0123456789AB, 4x1a9f0123456789AB
+D213	DATA8[] 4x1aa00123456789AB, 4x1aa10123456789AB, 4x1aa20123456789AB, 4x1aa30123456789AB, 4x1aa40123456789AB, 4x1aa50123456789AB, 4x1aa60123456789AB, 4x1aa70123456789AB, 4x1aa80123456789AB, 4x1aa90123456789AB, 4x1aaa0123456789AB, 4x1aab0123456789AB, 4x1aac0123456789AB, 4x1aad0123456789AB, 4x1aae0123456789AB, 4x1aaf0123456789AB, 4x1ab00123456789AB, 4x1ab10123456789AB, 4x1ab20123456789AB, 4x1ab30123456789AB, 4x1ab40123456789AB, 4x1ab50123456789AB, 4x1ab60123456789AB, 4x1ab70123456789AB, 4x1ab80123456789AB, 4x1ab90123456789AB, 4x1aba0123456789AB, 4x1abb0123456789AB, 4x1abc0123456789AB, 4x1abd0123456789AB, 4x1abe0123456789AB, 4x1abf0123456789AB
+D214	DATA8[] 4x1ac00123456789AB, 4x1ac10123456789AB, 4x1ac20123456789AB, 4x1ac30123456789AB, 4x1ac40123456789AB, 4x1ac50123456789AB, 4x1ac60123456789AB, 4x1ac70123456789AB, 4x1ac80123456789AB, 4x1ac90123456789AB, 4x1aca0123456789AB, 4x1acb0123456789AB, 4x1acc0123456789AB, 4x1acd0123456789AB, 4x1ace0123456789AB, 4x1acf0123456789AB, 4x1ad00123456789AB, 4x1ad10123456789AB, 4x1ad20123456789AB, 4x1ad30123456789AB, 4x1ad40123456789AB, 4x1ad50123456789AB, 4x1ad60123456789AB, 4x1ad70123456789AB, 4x1ad80123456789AB, 4x1ad90123456789AB, 4x1ada0123456789AB, 4x1adb0123456789AB, 4x1adc0123456789AB, 4x1add0123456789AB, 4x1ade0123456789AB, 4x1adf0123456789AB
+D215	DATA8[] 4x1ae00123456789AB, 4x1ae10123456789AB, 4x1ae20123456789AB, 4x1ae30123456789AB, 4x1ae40123456789AB, 4x1ae50123456789AB, 4x1ae60123456789AB, 4x1ae70123456789AB, 4x1ae80123456789AB, 4x1ae90123456789AB, 4x1aea0123456789AB, 4x1aeb0123456789AB, 4x1aec0123456789AB, 4x1aed0123456789AB, 4x1aee0123456789AB, 4x1aef0123456789AB, 4x1af00123456789AB, 4x1af10123456789AB, 4x1af20123456789AB, 4x1af30123456789AB, 4x1af40123456789AB, 4x1af50123456789AB, 4x1af60123456789AB, 4x1af70123456789AB, 4x1af80123456789AB, 4x1af90123456789AB, 4x1afa0123456789AB, 4x1afb0123456789AB, 4x1afc0123456789AB, 4x1afd0123456789AB, 4x1afe0123456789AB, 4x1aff0123456789AB
+D216	DATA8[] 4x1b000123456789AB, 4x1b010123456789AB, 4x1b020123456789AB, 4x1b030123456789AB, 4x1b040123456789AB, 4x1b050123456789AB, 4x1b060123456789AB, 4x1b070123456789AB, 4x1b080123456789AB, 4x1b090123456789AB, 4x1b0a0123456789AB, 4x1b0b0123456789AB, 4x1b0c0123456789AB, 4x1b0d0123456789AB, 4x1b0e0123456789AB, 4x1b0f0123456789AB, 4x1b100123456789AB, 4x1b110123456789AB, 4x1b120123456789AB, 4x1b130123456789AB, 4x1b140123456789AB, 4x1b150123456789AB, 4x1b160123456789AB, 4x1b170123456789AB, 4x1b180123456789AB, 4x1b190123456789AB, 4x1b1a0123456789AB, 4x1b1b0123456789AB, 4x1b1c0123456789AB, 4x1b1d0123456789AB, 4x1b1e0123456789AB, 4x1b1f0123456789AB
+D217	DATA8[] 4x1b200123456789AB, 4x1b210123456789AB, 4x1b220123456789AB, 4x1b230123456789AB, 4x1b240123456789AB, 4x1b250123456789AB, 4x1b260123456789AB, 4x1b270123456789AB, 4x1b280123456789AB, 4x1b290123456789AB, 4x1b2a0123456789AB, 4x1b2b0123456789AB, 4x1b2c0123456789AB, 4x1b2d0123456789AB, 4x1b2e0123456789AB, 4x1b2f0123456789AB, 4x1b300123456789AB, 4x1b310123456789AB, 4x1b320123456789AB, 4x1b330123456789AB, 4x1b340123456789AB, 4x1b350123456789AB, 4x1b360123456789AB, 4x1b370123456789AB, 4x1b380123456789AB, 4x1b390123456789AB, 4x1b3a0123456789AB, 4x1b3b0123456789AB, 4x1b3c0123456789AB, 4x1b3d0123456789AB, 4x1b3e0123456789AB, 4x1b3f0123456789AB
+D218	DATA8[] 4x1b400123456789AB, 4x1b410123456789AB, 4x1b420123456789AB, 4x1b430123456789AB, 4x1b440123456789AB, 4x1b450123456789AB, 4x1b460123456789AB, 4x1b470123456789AB, 4x1b480123456789AB, 4x1b490123456789AB, 4x1b4a0123456789AB, 4x1b4b0123456789AB, 4x1b4c0123456789AB, 4x1b4d0123456789AB, 4x1b4e0123456789AB, 4x1b4f0123456789AB, 4x1b500123456789AB, 4x1b510123456789AB, 4x1b520123456789AB, 4x1b530123456789AB, 4x1b540123456789AB, 4x1b550123456789AB, 4x1b560123456789AB, 4x1b570123456789AB, 4x1b580123456789AB, 4x1b590123456789AB, 4x1b5a0123456789AB, 4x1b5b0123456789AB, 4x1b5c0123456789AB, 4x1b5d0123456789AB, 4x1b5e0123456789AB, 4x1b5f0123456789AB
+D219	DATA8[] 4x1b600123456789AB, 4x1b610123456789AB, 4x1b620123456789AB, 4x1b630123456789AB, 4x1b640123456789AB, 4x1b650123456789AB, 4x1b660123456789AB, 4x1b670123456789AB, 4x1b680123456789AB, 4x1b690123456789AB, 4x1b6a0123456789AB, 4x1b6b0123456789AB, 4x1b6c0123456789AB, 4x1b6d0123456789AB, 4x1b6e0123456789AB, 4x1b6f0123456789AB, 4x1b700123456789AB, 4x1b710123456789AB, 4x1b720123456789AB, 4x1b730123456789AB, 4x1b740123456789AB, 4x1b750123456789AB, 4x1b760123456789AB, 4x1b770123456789AB, 4x1b780123456789AB, 4x1b790123456789AB, 4x1b7a0123456789AB, 4x1b7b0123456789AB, 4x1b7c0123456789AB, 4x1b7d0123456789AB, 4x1b7e0123456789AB, 4x1b7f0123456789AB
+D220	DATA8[] 4x1b800123456789AB, 4x1b810123456789AB, 4x1b820123456789AB, 4x1b830123456789AB, 4x1b840123456789AB, 4x1b850123456789AB, 4x1b860123456789AB, 4x1b870123456789AB, 4x1b880123456789AB, 4x1b890123456789AB, 4x1b8a0123456789AB, 4x1b8b0123456789AB, 4x1b8c0123456789AB, 4x1b8d0123456789AB, 4x1b8e0123456789AB, 4x1b8f0123456789AB, 4x1b900123456789AB, 4x1b910123456789AB, 4x1b920123456789AB, 4x1b930123456789AB, 4x1b940123456789AB, 4x1b950123456789AB, 4x1b960123456789AB, 4x1b970123456789AB, 4x1b980123456789AB, 4x1b990123456789AB, 4x1b9a0123456789AB, 4x1b9b0123456789AB, 4x1b9c0123456789AB, 4x1b9d0123456789AB, 4x1b9e0123456789AB, 4x1b9f0123456789AB
+D221	DATA8[] 4x1ba00123456789AB, 4x1ba10123456789AB, 4x1ba20123456789AB, 4x1ba30123456789AB, 4x1ba40123456789AB, 4x1ba50123456789AB, 4x1ba60123456789AB, 4x1ba70123456789AB, 4x1ba80123456789AB, 4x1ba90123456789AB, 4x1baa0123456789AB, 4x1bab0123456789AB, 4x1bac0123456789AB, 4x1bad0123456789AB, 4x1bae0123456789AB, 4x1baf0123456789AB, 4x1bb00123456789AB, 4x1bb10123456789AB, 4x1bb20123456789AB, 4x1bb30123456789AB, 4x1bb40123456789AB, 4x1bb50123456789AB, 4x1bb60123456789AB, 4x1bb70123456789AB, 4x1bb80123456789AB, 4x1bb90123456789AB, 4x1bba0123456789AB, 4x1bbb0123456789AB, 4x1bbc0123456789AB, 4x1bbd0123456789AB, 4x1bbe0123456789AB, 4x1bbf0123456789AB
+D222	DATA8[] 4x1bc00123456789AB, 4x1bc10123456789AB, 4x1bc20123456789AB, 4x1bc30123456789AB, 4x1bc40123456789AB, 4x1bc50123456789AB, 4x1bc60123456789AB, 4x1bc70123456789AB, 4x1bc80123456789AB, 4x1bc90123456789AB, 4x1bca0123456789AB, 4x1bcb0123456789AB, 4x1bcc0123456789AB, 4x1bcd0123456789AB, 4x1bce0123456789AB, 4x1bcf0123456789AB, 4x1bd00123456789AB, 4x1bd10123456789AB, 4x1bd20123456789AB, 4x1bd30123456789AB, 4x1bd40123456789AB, 4x1bd50123456789AB, 4x1bd60123456789AB, 4x1bd70123456789AB, 4x1bd80123456789AB, 4x1bd90123456789AB, 4x1bda0123456789AB, 4x1bdb0123456789AB, 4x1bdc0123456789AB, 4x1bdd0123456789AB, 4x1bde0123456789AB, 4x1bdf0123456789AB
+D223	DATA8[] 4x1be00123456789AB, 4x1be10123456789AB, 4x1be20123456789AB, 4x1be30123456789AB, 4x1be40123456789AB, 4x1be50123456789AB, 4x1be60123456789AB, 4x1be70123456789AB, 4x1be80123456789AB, 4x1be90123456789AB, 4x1bea0123456789AB, 4x1beb0123456789AB, 4x1bec0123456789AB, 4x1bed0123456789AB, 4x1bee0123456789AB, 4x1bef0123456789AB, 4x1bf00123456789AB, 4x1bf10123456789AB, 4x1bf20123456789AB, 4x1bf30123456789AB, 4x1bf40123456789AB, 4x1bf50123456789AB, 4x1bf60123456789AB, 4x1bf70123456789AB, 4x1bf80123456789AB, 4x1bf90123456789AB, 4x1bfa0123456789AB, 4x1bfb0123456789AB, 4x1bfc0123456789AB, 4x1bfd0123456789AB, 4x1bfe0123456789AB, 4x1bff0123456789AB
+D224	DATA8[] 4x1c000123456789AB, 4x1c010123456789AB, 4x1c020123456789AB, 4x1c030123456789AB, 4x1c040123456789AB, 4x1c050123456789AB, 4x1c060123456789AB, 4x1c070123456789AB, 4x1c080123456789AB, 4x1c090123456789AB, 4x1c0a0123456789AB, 4x1c0b0123456789AB, 4x1c0c0123456789AB, 4x1c0d0123456789AB, 4x1c0e0123456789AB, 4x1c0f0123456789AB, 4x1c100123456789AB, 4x1c110123456789AB, 4x1c120123456789AB, 4x1c130123456789AB, 4x1c140123456789AB, 4x1c150123456789AB, 4x1c160123456789AB, 4x1c170123456789AB, 4x1c180123456789AB, 4x1c190123456789AB, 4x1c1a0123456789AB, 4x1c1b0123456789AB, 4x1c1c0123456789AB, 4x1c1d0123456789AB, 4x1c1e0123456789AB, 4x1c1f0123456789AB
+D225	DATA8[] 4x1c200123456789AB, 4x1c210123456789AB, 4x1c220123456789AB, 4x1c230123456789AB, 4x1c240123456789AB, 4x1c250123456789AB, 4x1c260123456789AB, 4x1c270123456789AB, 4x1c280123456789AB, 4x1c290123456789AB, 4x1c2a0123456789AB, 4x1c2b0123456789AB, 4x1c2c0123456789AB, 4x1c2d0123456789AB, 4x1c2e0123456789AB, 4x1c2f0123456789AB, 4x1c300123456789AB, 4x1c310123456789AB, 4x1c320123456789AB, 4x1c330123456789AB, 4x1c340123456789AB, 4x1c350123456789AB, 4x1c360123456789AB, 4x1c370123456789AB, 4x1c380123456789AB, 4x1c390123456789AB, 4x1c3a0123456789AB, 4x1c3b0123456789AB, 4x1c3c0123456789AB, 4x1c3d0123456789AB, 4x1c3e0123456789AB, 4x1c3f0123456789AB
+D226	DATA8[] 4x1c400123456789AB, 4x1c410123456789AB, 4x1c420123456789AB, 4x1c430123456789AB, 4x1c440123456789AB, 4x1c450123456789AB, 4x1c460123456789AB, 4x1c470123456789AB, 4x1c480123456789AB, 4x1c490123456789AB, 4x1c4a0123456789AB, 4x1c4b0123456789AB, 4x1c4c0123456789AB, 4x1c4d0123456789AB, 4x1c4e0123456789AB, 4x1c4f0123456789AB, 4x1c500123456789AB, 4x1c510123456789AB, 4x1c520123456789AB, 4x1c530123456789AB, 4x1c540123456789AB, 4x1c550123456789AB, 4x1c560123456789AB, 4x1c570123456789AB, 4x1c580123456789AB, 4x1c590123456789AB, 4x1c5a0123456789AB, 4x1c5b0123456789AB, 4x1c5c0123456789AB, 4x1c5d0123456789AB, 4x1c5e0123456789AB, 4x1c5f0123456789AB
+D227	DATA8[] 4x1c600123456789AB, 4x1c610123456789AB, 4x1c620123456789AB, 4x1c630123456789AB, 4x1c640123456789AB, 4x1c650123456789AB, 4x1c660123456789AB, 4x1c670123456789AB, 4x1c680123456789AB, 4x1c690123456789AB, 4x1c6a0123456789AB, 4x1c6b0123456789AB, 4x1c6c0123456789AB, 4x1c6d0123456789AB, 4x1c6e0123456789AB, 4x1c6f0123456789AB, 4x1c700123456789AB, 4x1c710123456789AB, 4x1c720123456789AB, 4x1c730123456789AB, 4x1c740123456789AB, 4x1c750123456789AB, 4x1c760123456789AB, 4x1c770123456789AB, 4x1c780123456789AB, 4x1c790123456789AB, 4x1c7a0123456789AB, 4x1c7b0123456789AB, 4x1c7c0123456789AB, 4x1c7d0123456789AB, 4x1c7e0123456789AB, 4x1c7f0123456789AB
+D228	DATA8[] 4x1c800123456789AB, 4x1c810123456789AB, 4x1c820123456789AB, 4x1c830123456789AB, 4x1c840123456789AB, 4x1c850123456789AB, 4x1c860123456789AB, 4x1c870123456789AB, 4x1c880123456789AB, 4x1c890123456789AB, 4x1c8a0123456789AB, 4x1c8b0123456789AB, 4x1c8c0123456789AB, 4x1c8d0123456789AB, 4x1c8e0123456789AB, 4x1c8f0123456789AB, 4x1c900123456789AB, 4x1c910123456789AB, 4x1c920123456789AB, 4x1c930123456789AB, 4x1c940123456789AB, 4x1c950123456789AB, 4x1c960123456789AB, 4x1c970123456789AB, 4x1c980123456789AB, 4x1c990123456789AB, 4x1c9a0123456789AB, 4x1c9b0123456789AB, 4x1c9c0123456789AB, 4x1c9d0123456789AB, 4x1c9e0123456789AB, 4x1c9f0123456789AB
+D229	DATA8[] 4x1ca00123456789AB, 4x1ca10123456789AB, 4x1ca20123456789AB, 4x1ca30123456789AB, 4x1ca40123456789AB, 4x1ca50123456789AB, 4x1ca60123456789AB, 4x1ca70123456789AB, 4x1ca80123456789AB, 4x1ca90123456789AB, 4x1caa0123456789AB, 4x1cab0123456789AB, 4x1cac0123456789AB, 4x1cad0123456789AB, 4x1cae0123456789AB, 4x1caf0123456789AB, 4x1cb00123456789AB, 4x1cb10123456789AB, 4x1cb20123456789AB, 4x1cb30123456789AB, 4x1cb40123456789AB, 4x1cb50123456789AB, 4x1cb60123456789AB, 4x1cb70123456789AB, 4x1cb80123456789AB, 4x1cb90123456789AB, 4x1cba0123456789AB, 4x1cbb0123456789AB, 4x1cbc0123456789AB, 4x1cbd0123456789AB, 4x1cbe0123456789AB, 4x1cbf0123456789AB
+D230	DATA8[] 4x1cc00123456789AB, 4x1cc10123456789AB, 4x1cc20123456789AB, 4x1cc30123456789AB, 4x1cc40123456789AB, 4x1cc50123456789AB, 4x1cc60123456789AB, 4x1cc70123456789AB, 4x1cc80123456789AB, 4x1cc90123456789AB, 4x1cca0123456789AB, 4x1ccb0123456789AB, 4x1ccc0123456789AB, 4x1ccd0123456789AB, 4x1cce0123456789AB, 4x1ccf0123456789AB, 4x1cd00123456789AB, 4x1cd10123456789AB, 4x1cd20123456789AB, 4x1cd30123456789AB, 4x1cd40123456789AB, 4x1cd50123456789AB, 4x1cd60123456789AB, 4x1cd70123456789AB, 4x1cd80123456789AB, 4x1cd90123456789AB, 4x1cda0123456789AB, 4x1cdb0123456789AB, 4x1cdc0123456789AB, 4x1cdd0123456789AB, 4x1cde0123456789AB, 4x1cdf0123456789AB
+D231	DATA8[] 4x1ce00123456789AB, 4x1ce10123456789AB, 4x1ce20123456789AB, 4x1ce30123456789AB, 4x1ce40123456789AB, 4x1ce50123456789AB, 4x1ce60123456789AB, 4x1ce70123456789AB, 4x1ce80123456789AB, 4x1ce90123456789AB, 4x1cea0123456789AB, 4x1ceb0123456789AB, 4x1cec0123456789AB, 4x1ced0123456789AB, 4x1cee0123456789AB, 4x1cef0123456789AB, 4x1cf00123456789AB, 4x1cf10123456789AB, 4x1cf20123456789AB, 4x1cf30123456789AB, 4x1cf40123456789AB, 4x1cf50123456789AB, 4x1cf60123456789AB, 4x1cf70123456789AB, 4x1cf80123456789AB, 4x1cf90123456789AB, 4x1cfa0123456789AB, 4x1cfb0123456789AB, 4x1cfc0123456789AB, 4x1cfd0123456789AB, 4x1cfe0123456789AB, 4x1cff0123456789AB
+D232	DATA8[] 4x1d000123456789AB, 4x1d010123456789AB, 4x1d020123456789AB, 4x1d030123456789AB, 4x1d040123456789AB, 4x1d050123456789AB, 4x1d060123456789AB, 4x1d070123456789AB, 4x1d080123456789AB, 4x1d090123456789AB, 4x1d0a0123456789AB, 4x1d0b0123456789AB, 4x1d0c0123456789AB, 4x1d0d0123456789AB, 4x1d0e0123456789AB, 4x1d0f0123456789AB, 4x1d100123456789AB, 4x1d110123456789AB, 4x1d120123456789AB, 4x1d130123456789AB, 4x1d140123456789AB, 4x1d150123456789AB, 4x1d160123456789AB, 4x1d170123456789AB, 4x1d180123456789AB, 4x1d190123456789AB, 4x1d1a0123456789AB, 4x1d1b0123456789AB, 4x1d1c0123456789AB, 4x1d1d0123456789AB, 4x1d1e0123456789AB, 4x1d1f0123456789AB
+D233	DATA8[] 4x1d200123456789AB, 4x1d210123456789AB, 4x1d220123456789AB, 4x1d230123456789AB, 4x1d240123456789AB, 4x1d250123456789AB, 4x1d260123456789AB, 4x1d270123456789AB, 4x1d280123456789AB, 4x1d290123456789AB, 4x1d2a0123456789AB, 4x1d2b0123456789AB, 4x1d2c0123456789AB, 4x1d2d0123456789AB, 4x1d2e0123456789AB, 4x1d2f0123456789AB, 4x1d300123456789AB, 4x1d310123456789AB, 4x1d320123456789AB, 4x1d330123456789AB, 4x1d340123456789AB, 4x1d350123456789AB, 4x1d360123456789AB, 4x1d370123456789AB, 4x1d380123456789AB, 4x1d390123456789AB, 4x1d3a0123456789AB, 4x1d3b0123456789AB, 4x1d3c0123456789AB, 4x1d3d0123456789AB, 4x1d3e0123456789AB, 4x1d3f0123456789AB
+D234	DATA8[] 4x1d400123456789AB, 4x1d410123456789AB, 4x1d420123456789AB, 4x1d430123456789AB, 4x1d440123456789AB, 4x1d450123456789AB, 4x1d460123456789AB, 4x1d470123456789AB, 4x1d480123456789AB, 4x1d490123456789AB, 4x1d4a0123456789AB, 4x1d4b0123456789AB, 4x1d4c0123456789AB, 4x1d4d0123456789AB, 4x1d4e0123456789AB, 4x1d4f0123456789AB, 4x1d500123456789AB, 4x1d510123456789AB, 4x1d520123456789AB, 4x1d530123456789AB, 4x1d540123456789AB, 4x1d550123456789AB, 4x1d560123456789AB, 4x1d570123456789AB, 4x1d580123456789AB, 4x1d590123456789AB, 4x1d5a0123456789AB, 4x1d5b0123456789AB, 4x1d5c0123456789AB, 4x1d5d0123456789AB, 4x1d5e0123456789AB, 4x1d5f0123456789AB
+D235	DATA8[] 4x1d600123456789AB, 4x1d610123456789AB, 4x1d620123456789AB, 4x1d630123456789AB, 4x1d640123456789AB, 4x1d650123456789AB, 4x1d660123456789AB, 4x1d670123456789AB, 4x1d680123456789AB, 4x1d690123456789AB, 4x1d6a0123456789AB, 4x1d6b0123456789AB, 4x1d6c0123456789AB, 4x1d6d0123456789AB, 4x1d6e0123456789AB, 4x1d6f0123456789AB, 4x1d700123456789AB, 4x1d710123456789AB, 4x1d720123456789AB, 4x1d730123456789AB, 4x1d740123456789AB, 4x1d750123456789AB, 4x1d760123456789AB, 4x1d770123456789AB, 4x1d780123456789AB, 4x1d790123456789AB, 4x1d7a0123456789AB, 4x1d7b0123456789AB, 4x1d7c0123456789AB, 4x1d7d0123456789AB, 4x1d7e0123456789AB, 4x1d7f0123456789AB
+D236	DATA8[] 4x1d800123456789AB, 4x1d810123456789AB, 4x1d820123456789AB, 4x1d830123456789AB, 4x1d840123456789AB, 4x1d850123456789AB, 4x1d860123456789AB, 4x1d870123456789AB, 4x1d880123456789AB, 4x1d890123456789AB, 4x1d8a0123456789AB, 4x1d8b0123456789AB, 4x1d8c0123456789AB, 4x1d8d0123456789AB, 4x1d8e0123456789AB, 4x1d8f0123456789AB, 4x1d900123456789AB, 4x1d910123456789AB, 4x1d920123456789AB, 4x1d930123456789AB, 4x1d940123456789AB, 4x1d950123456789AB, 4x1d960123456789AB, 4x1d970123456789AB, 4x1d980123456789AB, 4x1d990123456789AB, 4x1d9a0123456789AB, 4x1d9b0123456789AB, 4x1d9c0123456789AB, 4x1d9d0123456789AB, 4x1d9e0123456789AB, 4x1d9f0123456789AB
+D237	DATA8[] 4x1da00123456789AB, 4x1da10123456789AB, 4x1da20123456789AB, 4x1da30123456789AB, 4x1da40123456789AB, 4x1da50123456789AB, 4x1da60123456789AB, 4x1da70123456789AB, 4x1da80123456789AB, 4x1da90123456789AB, 4x1daa0123456789AB, 4x1dab0123456789AB, 4x1dac0123456789AB, 4x1dad0123456789AB, 4x1dae0123456789AB, 4x1daf0123456789AB, 4x1db00123456789AB, 4x1db10123456789AB, 4x1db20123456789AB, 4x1db30123456789AB, 4x1db40123456789AB, 4x1db50123456789AB, 4x1db60123456789AB, 4x1db70123456789AB, 4x1db80123456789AB, 4x1db90123456789AB, 4x1dba0123456789AB, 4x1dbb0123456789AB, 4x1dbc0123456789AB, 4x1dbd0123456789AB, 4x1dbe0123456789AB, 4x1dbf0123456789AB
+D238	DATA8[] 4x1dc00123456789AB, 4x1dc10123456789AB, 4x1dc20123456789AB, 4x1dc30123456789AB, 4x1dc40123456789AB, 4x1dc50123456789AB, 4x1dc60123456789AB, 4x1dc70123456789AB, 4x1dc80123456789AB, 4x1dc90123456789AB, 4x1dca0123456789AB, 4x1dcb0123456789AB, 4x1dcc0123456789AB, 4x1dcd0123456789AB, 4x1dce0123456789AB, 4x1dcf0123456789AB, 4x1dd00123456789AB, 4x1dd10123456789AB, 4x1dd20123456789AB, 4x1dd30123456789AB, 4x1dd40123456789AB, 4x1dd50123456789AB, 4x1dd60123456789AB, 4x1dd70123456789AB, 4x1dd80123456789AB, 4x1dd90123456789AB, 4x1dda0123456789AB, 4x1ddb0123456789AB, 4x1ddc0123456789AB, 4x1ddd0123456789AB, 4x1dde0123456789AB, 4x1ddf0123456789AB
+D239	DATA8[] 4x1de00123456789AB, 4x1de10123456789AB, 4x1de20123456789AB, 4x1de30123456789AB, 4x1de40123456789AB, 4x1de50123456789AB, 4x1de60123456789AB, 4x1de70123456789AB, 4x1de80123456789AB, 4x1de90123456789AB, 4x1dea0123456789AB, 4x1deb0123456789AB, 4x1dec0123456789AB, 4x1ded0123456789AB, 4x1dee0123456789AB, 4x1def0123456789AB, 4x1df00123456789AB, 4x1df10123456789AB, 4x1df20123456789AB, 4x1df30123456789AB, 4x1df40123456789AB, 4x1df50123456789AB, 4x1df60123456789AB, 4x1df70123456789AB, 4x1df80123456789AB, 4x1df90123456789AB, 4x1dfa0123456789AB, 4x1dfb0123456789AB, 4x1dfc0123456789AB, 4x1dfd0123456789AB, 4x1dfe0123456789AB, 4x1dff0123456789AB
+D240	DATA8[] 4x1e000123456789AB, 4x1e010123456789AB, 4x1e020123456789AB, 4x1e030123456789AB, 4x1e040123456789AB, 4x1e050123456789AB, 4x1e060123456789AB, 4x1e070123456789AB, 4x1e080123456789AB, 4x1e090123456789AB, 4x1e0a0123456789AB, 4x1e0b0123456789AB, 4x1e0c0123456789AB, 4x1e0d0123456789AB, 4x1e0e0123456789AB, 4x1e0f0123456789AB, 4x1e100123456789AB, 4x1e110123456789AB, 4x1e120123456789AB, 4x1e130123456789AB, 4x1e140123456789AB, 4x1e150123456789AB, 4x1e160123456789AB, 4x1e170123456789AB, 4x1e180123456789AB, 4x1e190123456789AB, 4x1e1a0123456789AB, 4x1e1b0123456789AB, 4x1e1c0123456789AB, 4x1e1d0123456789AB, 4x1e1e0123456789AB, 4x1e1f0123456789AB
+D241	DATA8[] 4x1e200123456789AB, 4x1e210123456789AB, 4x1e220123456789AB, 4x1e230123456789AB, 4x1e240123456789AB, 4x1e250123456789AB, 4x1e260123456789AB, 4x1e270123456789AB, 4x1e280123456789AB, 4x1e290123456789AB, 4x1e2a0123456789AB, 4x1e2b0123456789AB, 4x1e2c0123456789AB, 4x1e2d0123456789AB, 4x1e2e0123456789AB, 4x1e2f0123456789AB, 4x1e300123456789AB, 4x1e310123456789AB, 4x1e320123456789AB, 4x1e330123456789AB, 4x1e340123456789AB, 4x1e350123456789AB, 4x1e360123456789AB, 4x1e370123456789AB, 4x1e380123456789AB, 4x1e390123456789AB, 4x1e3a0123456789AB, 4x1e3b0123456789AB, 4x1e3c0123456789AB, 4x1e3d0123456789AB, 4x1e3e0123456789AB, 4x1e3f0123456789AB
+D242	DATA8[] 4x1e400123456789AB, 4x1e410123456789AB, 4x1e420123456789AB, 4x1e430123456789AB, 4x1e440123456789AB, 4x1e450123456789AB, 4x1e460123456789AB, 4x1e470123456789AB, 4x1e480123456789AB, 4x1e490123456789AB, 4x1e4a0123456789AB, 4x1e4b0123456789AB, 4x1e4c0123456789AB, 4x1e4d0123456789AB, 4x1e4e0123456789AB, 4x1e4f0123456789AB, 4x1e500123456789AB, 4x1e510123456789AB, 4x1e520123456789AB, 4x1e530123456789AB, 4x1e540123456789AB, 4x1e550123456789AB, 4x1e560123456789AB, 4x1e570123456789AB, 4x1e580123456789AB, 4x1e590123456789AB, 4x1e5a0123456789AB, 4x1e5b0123456789AB, 4x1e5c0123456789AB, 4x1e5d0123456789AB, 4x1e5e0123456789AB, 4x1e5f0123456789AB
+D243	DATA8[] 4x1e600123456789AB, 4x1e610123456789AB, 4x1e620123456789AB, 4x1e630123456789AB, 4x1e640123456789AB, 4x1e650123456789AB, 4x1e660123456789AB, 4x1e670123456789AB, 4x1e680123456789AB, 4x1e690123456789AB, 4x1e6a0123456789AB, 4x1e6b0123456789AB, 4x1e6c0123456789AB, 4x1e6d0123456789AB, 4x1e6e0123456789AB, 4x1e6f0123456789AB, 4x1e700123456789AB, 4x1e710123456789AB, 4x1e720123456789AB, 4x1e730123456789AB, 4x1e740123456789AB, 4x1e750123456789AB, 4x1e760123456789AB, 4x1e770123456789AB, 4x1e780123456789AB, 4x1e790123456789AB, 4x1e7a0123456789AB, 4x1e7b0123456789AB, 4x1e7c0123456789AB, 4x1e7d0123456789AB, 4x1e7e0123456789AB, 4x1e7f0123456789AB
+D244	DATA8[] 4x1e800123456789AB, 4x1e810123456789AB, 4x1e820123456789AB, 4x1e830123456789AB, 4x1e840123456789AB, 4x1e850123456789AB, 4x1e860123456789AB, 4x1e870123456789AB, 4x1e880123456789AB, 4x1e890123456789AB, 4x1e8a0123456789AB, 4x1e8b0123456789AB, 4x1e8c0123456789AB, 4x1e8d0123456789AB, 4x1e8e0123456789AB, 4x1e8f0123456789AB, 4x1e900123456789AB, 4x1e910123456789AB, 4x1e920123456789AB, 4x1e930123456789AB, 4x1e940123456789AB, 4x1e950123456789AB, 4x1e960123456789AB, 4x1e970123456789AB, 4x1e980123456789AB, 4x1e990123456789AB, 4x1e9a0123456789AB, 4x1e9b0123456789AB, 4x1e9c0123456789AB, 4x1e9d0123456789AB, 4x1e9e0123456789AB, 4x1e9f0123456789AB
+D245	DATA8[] 4x1ea00123456789AB, 4x1ea10123456789AB, 4x1ea20123456789AB, 4x1ea30123456789AB, 4x1ea40123456789AB, 4x1ea50123456789AB, 4x1ea60123456789AB, 4x1ea70123456789AB, 4x1ea80123456789AB, 4x1ea90123456789AB, 4x1eaa0123456789AB, 4x1eab0123456789AB, 4x1eac0123456789AB, 4x1ead0123456789AB, 4x1eae0123456789AB, 4x1eaf0123456789AB, 4x1eb00123456789AB, 4x1eb10123456789AB, 4x1eb20123456789AB, 4x1eb30123456789AB, 4x1eb40123456789AB, 4x1eb50123456789AB, 4x1eb60123456789AB, 4x1eb70123456789AB, 4x1eb80123456789AB, 4x1eb90123456789AB, 4x1eba0123456789AB, 4x1ebb0123456789AB, 4x1ebc0123456789AB, 4x1ebd0123456789AB, 4x1ebe0123456789AB, 4x1ebf0123456789AB
+D246	DATA8[] 4x1ec00123456789AB, 4x1ec10123456789AB, 4x1ec20123456789AB, 4x1ec30123456789AB, 4x1ec40123456789AB, 4x1ec50123456789AB, 4x1ec60123456789AB, 4x1ec70123456789AB, 4x1ec80123456789AB, 4x1ec90123456789AB, 4x1eca0123456789AB, 4x1ecb0123456789AB, 4x1ecc0123456789AB, 4x1ecd0123456789AB, 4x1ece0123456789AB, 4x1ecf0123456789AB, 4x1ed00123456789AB, 4x1ed10123456789AB, 4x1ed20123456789AB, 4x1ed30123456789AB, 4x1ed40123456789AB, 4x1ed50123456789AB, 4x1ed60123456789AB, 4x1ed70123456789AB, 4x1ed80123456789AB, 4x1ed90123456789AB, 4x1eda0123456789AB, 4x1edb0123456789AB, 4x1edc0123456789AB, 4x1edd0123456789AB, 4x1ede0123456789AB, 4x1edf0123456789AB
+D247	DATA8[] 4x1ee00123456789AB, 4x1ee10123456789AB, 4x1ee20123456789AB, 4x1ee30123456789AB, 4x1ee40123456789AB, 4x1ee50123456789AB, 4x1ee60123456789AB, 4x1ee70123456789AB, 4x1ee80123456789AB, 4x1ee90123456789AB, 4x1eea0123456789AB, 4x1eeb0123456789AB, 4x1eec0123456789AB, 4x1eed0123456789AB, 4x1eee0123456789AB, 4x1eef0123456789AB, 4x1ef00123456789AB, 4x1ef10123456789AB, 4x1ef20123456789AB, 4x1ef30123456789AB, 4x1ef40123456789AB, 4x1ef50123456789AB, 4x1ef60123456789AB, 4x1ef70123456789AB, 4x1ef80123456789AB, 4x1ef90123456789AB, 4x1efa0123456789AB, 4x1efb0123456789AB, 4x1efc0123456789AB, 4x1efd0123456789AB, 4x1efe0123456789AB, 4x1eff0123456789AB
+D248	DATA8[] 4x1f000123456789AB, 4x1f010123456789AB, 4x1f020123456789AB, 4x1f030123456789AB, 4x1f040123456789AB, 4x1f050123456789AB, 4x1f060123456789AB, 4x1f070123456789AB, 4x1f080123456789AB, 4x1f090123456789AB, 4x1f0a0123456789AB, 4x1f0b0123456789AB, 4x1f0c0123456789AB, 4x1f0d0123456789AB, 4x1f0e0123456789AB, 4x1f0f0123456789AB, 4x1f100123456789AB, 4x1f110123456789AB, 4x1f120123456789AB, 4x1f130123456789AB, 4x1f140123456789AB, 4x1f150123456789AB, 4x1f160123456789AB, 4x1f170123456789AB, 4x1f180123456789AB, 4x1f190123456789AB, 4x1f1a0123456789AB, 4x1f1b0123456789AB, 4x1f1c0123456789AB, 4x1f1d0123456789AB, 4x1f1e0123456789AB, 4x1f1f0123456789AB
+D249	DATA8[] 4x1f200123456789AB, 4x1f210123456789AB, 4x1f220123456789AB, 4x1f230123456789AB, 4x1f240123456789AB, 4x1f250123456789AB, 4x1f260123456789AB, 4x1f270123456789AB, 4x1f280123456789AB, 4x1f290123456789AB, 4x1f2a0123456789AB, 4x1f2b0123456789AB, 4x1f2c0123456789AB, 4x1f2d0123456789AB, 4x1f2e0123456789AB, 4x1f2f0123456789AB, 4x1f300123456789AB, 4x1f310123456789AB, 4x1f320123456789AB, 4x1f330123456789AB, 4x1f340123456789AB, 4x1f350123456789AB, 4x1f360123456789AB, 4x1f370123456789AB, 4x1f380123456789AB, 4x1f390123456789AB, 4x1f3a0123456789AB, 4x1f3b0123456789AB, 4x1f3c0123456789AB, 4x1f3d0123456789AB, 4x1f3e0123456789AB, 4x1f3f0123456789AB
+D250	DATA8[] 4x1f400123456789AB, 4x1f410123456789AB, 4x1f420123456789AB, 4x1f430123456789AB, 4x1f440123456789AB, 4x1f450123456789AB, 4x1f460123456789AB, 4x1f470123456789AB, 4x1f480123456789AB, 4x1f490123456789AB, 4x1f4a0123456789AB, 4x1f4b0123456789AB, 4x1f4c0123456789AB, 4x1f4d0123456789AB, 4x1f4e0123456789AB, 4x1f4f0123456789AB, 4x1f500123456789AB, 4x1f510123456789AB, 4x1f520123456789AB, 4x1f530123456789AB, 4x1f540123456789AB, 4x1f550123456789AB, 4x1f560123456789AB, 4x1f570123456789AB, 4x1f580123456789AB, 4x1f590123456789AB, 4x1f5a0123456789AB, 4x1f5b0123456789AB, 4x1f5c0123456789AB, 4x1f5d0123456789AB, 4x1f5e0123456789AB, 4x1f5f0123456789AB
+D251	DATA8[] 4x1f600123456789AB, 4x1f610123456789AB, 4x1f620123456789AB, 4x1f630123456789AB, 4x1f640123456789AB, 4x1f650123456789AB, 4x1f660123456789AB, 4x1f670123456789AB, 4x1f680123456789AB, 4x1f690123456789AB, 4x1f6a0123456789AB, 4x1f6b0123456789AB, 4x1f6c0123456789AB, 4x1f6d0123456789AB, 4x1f6e0123456789AB, 4x1f6f0123456789AB, 4x1f700123456789AB, 4x1f710123456789AB, 4x1f720123456789AB, 4x1f730123456789AB, 4x1f740123456789AB, 4x1f750123456789AB, 4x1f760123456789AB, 4x1f770123456789AB, 4x1f780123456789AB, 4x1f790123456789AB, 4x1f7a0123456789AB, 4x1f7b0123456789AB, 4x1f7c0123456789AB, 4x1f7d0123456789AB, 4x1f7e0123456789AB, 4x1f7f0123456789AB
+D252	DATA8[] 4x1f800123456789AB, 4x1f810123456789AB, 4x1f820123456789AB, 4x1f830123456789AB, 4x1f840123456789AB, 4x1f850123456789AB, 4x1f860123456789AB, 4x1f870123456789AB, 4x1f880123456789AB, 4x1f890123456789AB, 4x1f8a0123456789AB, 4x1f8b0123456789AB, 4x1f8c0123456789AB, 4x1f8d0123456789AB, 4x1f8e0123456789AB, 4x1f8f0123456789AB, 4x1f900123456789AB, 4x1f910123456789AB, 4x1f920123456789AB, 4x1f930123456789AB, 4x1f940123456789AB, 4x1f950123456789AB, 4x1f960123456789AB, 4x1f970123456789AB, 4x1f980123456789AB, 4x1f990123456789AB, 4x1f9a0123456789AB, 4x1f9b0123456789AB, 4x1f9c0123456789AB, 4x1f9d0123456789AB, 4x1f9e0123456789AB, 4x1f9f0123456789AB
+D253	DATA8[] 4x1fa00123456789AB, 4x1fa10123456789AB, 4x1fa20123456789AB, 4x1fa30123456789AB, 4x1fa40123456789AB, 4x1fa50123456789AB, 4x1fa60123456789AB, 4x1fa70123456789AB, 4x1fa80123456789AB, 4x1fa90123456789AB, 4x1faa0123456789AB, 4x1fab0123456789AB, 4x1fac0123456789AB, 4x1fad0123456789AB, 4x1fae0123456789AB, 4x1faf0123456789AB, 4x1fb00123456789AB, 4x1fb10123456789AB, 4x1fb20123456789AB, 4x1fb30123456789AB, 4x1fb40123456789AB, 4x1fb50123456789AB, 4x1fb60123456789AB, 4x1fb70123456789AB, 4x1fb80123456789AB, 4x1fb90123456789AB, 4x1fba0123456789AB, 4x1fbb0123456789AB, 4x1fbc0123456789AB, 4x1fbd0123456789AB, 4x1fbe0123456789AB, 4x1fbf0123456789AB
+D254	DATA8[] 4x1fc00123456789AB, 4x1fc10123456789AB, 4x1fc20123456789AB, 4x1fc30123456789AB, 4x1fc40123456789AB, 4x1fc50123456789AB, 4x1fc60123456789AB, 4x1fc70123456789AB, 4x1fc80123456789AB, 4x1fc90123456789AB, 4x1fca0123456789AB, 4x1fcb0123456789AB, 4x1fcc0123456789AB, 4x1fcd0123456789AB, 4x1fce0123456789AB, 4x1fcf0123456789AB, 4x1fd00123456789AB, 4x1fd10123456789AB, 4x1fd20123456789AB, 4x1fd30123456789AB, 4x1fd40123456789AB, 4x1fd50123456789AB, 4x1fd60123456789AB, 4x1fd70123456789AB, 4x1fd80123456789AB, 4x1fd90123456789AB, 4x1fda0123456789AB, 4x1fdb0123456789AB, 4x1fdc0123456789AB, 4x1fdd0123456789AB, 4x1fde0123456789AB, 4x1fdf0123456789AB
+D255	DATA8[] 4x1fe00123456789AB, 4x1fe10123456789AB, 4x1fe20123456789AB, 4x1fe30123456789AB, 4x1fe40123456789AB, 4x1fe50123456789AB, 4x1fe60123456789AB, 4x1fe70123456789AB, 4x1fe80123456789AB, 4x1fe90123456789AB, 4x1fea0123456789AB, 4x1feb0123456789AB, 4x1fec0123456789AB, 4x1fed0123456789AB, 4x1fee0123456789AB, 4x1fef0123456789AB, 4x1ff00123456789AB, 4x1ff10123456789AB, 4x1ff20123456789AB, 4x1ff30123456789AB, 4x1ff40123456789AB, 4x1ff50123456789AB, 4x1ff60123456789AB, 4x1ff70123456789AB, 4x1ff80123456789AB, 4x1ff90123456789AB, 4x1ffa0123456789AB, 4x1ffb0123456789AB, 4x1ffc0123456789AB, 4x1ffd0123456789AB, 4x1ffe0123456789AB, 4x1fff0123456789AB
+D256	DATA8[] 4x20000123456789AB, 4x20010123456789AB, 4x20020123456789AB, 4x20030123456789AB, 4x20040123456789AB, 4x20050123456789AB, 4x20060123456789AB, 4x20070123456789AB, 4x20080123456789AB, 4x20090123456789AB, 4x200a0123456789AB, 4x200b0123456789AB, 4x200c0123456789AB, 4x200d0123456789AB, 4x200e0123456789AB, 4x200f0123456789AB, 4x20100123456789AB, 4x20110123456789AB, 4x20120123456789AB, 4x20130123456789AB, 4x20140123456789AB, 4x20150123456789AB, 4x20160123456789AB, 4x20170123456789AB, 4x20180123456789AB, 4x20190123456789AB, 4x201a0123456789AB, 4x201b0123456789AB, 4x201c0123456789AB, 4x201d0123456789AB, 4x201e0123456789AB, 4x201f0123456789AB
+D257	DATA8[] 4x20200123456789AB, 4x20210123456789AB, 4x20220123456789AB, 4x20230123456789AB, 4x20240123456789AB, 4x20250123456789AB, 4x20260123456789AB, 4x20270123456789AB, 4x20280123456789AB, 4x20290123456789AB, 4x202a0123456789AB, 4x202b0123456789AB, 4x202c0123456789AB, 4x202d0123456789AB, 4x202e0123456789AB, 4x202f0123456789AB, 4x20300123456789AB, 4x20310123456789AB, 4x20320123456789AB, 4x20330123456789AB, 4x20340123456789AB, 4x20350123456789AB, 4x20360123456789AB, 4x20370123456789AB, 4x20380123456789AB, 4x20390123456789AB, 4x203a0123456789AB, 4x203b0123456789AB, 4x203c0123456789AB, 4x203d0123456789AB, 4x203e0123456789AB, 4x203f0123456789AB
+D258	DATA8[] 4x20400123456789AB, 4x20410123456789AB, 4x20420123456789AB, 4x20430123456789AB, 4x20440123456789AB, 4x20450123456789AB, 4x20460123456789AB, 4x20470123456789AB, 4x20480123456789AB, 4x20490123456789AB, 4x204a0123456789AB, 4x204b0123456789AB, 4x204c0123456789AB, 4x204d0123456789AB, 4x204e0123456789AB, 4x204f0123456789AB, 4x20500123456789AB, 4x20510123456789AB, 4x20520123456789AB, 4x20530123456789AB, 4x20540123456789AB, 4x20550123456789AB, 4x20560123456789AB, 4x20570123456789AB, 4x20580123456789AB, 4x20590123456789AB, 4x205a0123456789AB, 4x205b0123456789AB, 4x205c0123456789AB, 4x205d0123456789AB, 4x205e0123456789AB, 4x205f0123456789AB
+D259	DATA8[] 4x20600123456789AB, 4x20610123456789AB, 4x20620123456789AB, 4x20630123456789AB, 4x20640123456789AB, 4x20650123456789AB, 4x20660123456789AB, 4x20670123456789AB, 4x20680123456789AB, 4x20690123456789AB, 4x206a0123456789AB, 4x206b0123456789AB, 4x206c0123456789AB, 4x206d0123456789AB, 4x206e0123456789AB, 4x206f0123456789AB, 4x20700123456789AB, 4x20710123456789AB, 4x20720123456789AB, 4x20730123456789AB, 4x20740123456789AB, 4x20750123456789AB, 4x20760123456789AB, 4x20770123456789AB, 4x20780123456789AB, 4x20790123456789AB, 4x207a0123456789AB, 4x207b0123456789AB, 4x207c0123456789AB, 4x207d0123456789AB, 4x207e0123456789AB, 4x207f0123456789AB
+D260	DATA8[] 4x20800123456789AB, 4x20810123456789AB, 4x20820123456789AB, 4x20830123456789AB, 4x20840123456789AB, 4x20850123456789AB, 4x20860123456789AB, 4x20870123456789AB, 4x20880123456789AB, 4x20890123456789AB, 4x208a0123456789AB, 4x208b0123456789AB, 4x208c0123456789AB, 4x208d0123456789AB, 4x208e0123456789AB, 4x208f0123456789AB, 4x20900123456789AB, 4x20910123456789AB, 4x20920123456789AB, 4x20930123456789AB, 4x20940123456789AB, 4x20950123456789AB, 4x20960123456789AB, 4x20970123456789AB, 4x20980123456789AB, 4x20990123456789AB, 4x209a0123456789AB, 4x209b0123456789AB, 4x209c0123456789AB, 4x209d0123456789AB, 4x209e0123456789AB, 4x209f0123456789AB
+D261	DATA8[] 4x20a00123456789AB, 4x20a10123456789AB, 4x20a20123456789AB, 4x20a30123456789AB, 4x20a40123456789AB, 4x20a50123456789AB, 4x20a60123456789AB, 4x20a70123456789AB, 4x20a80123456789AB, 4x20a90123456789AB, 4x20aa0123456789AB, 4x20ab0123456789AB, 4x20ac0123456789AB, 4x20ad0123456789AB, 4x20ae0123456789AB, 4x20af0123456789AB, 4x20b00123456789AB, 4x20b10123456789AB, 4x20b20123456789AB, 4x20b30123456789AB, 4x20b40123456789AB, 4x20b50123456789AB, 4x20b60123456789AB, 4x20b70123456789AB, 4x20b80123456789AB, 4x20b90123456789AB, 4x20ba0123456789AB, 4x20bb0123456789AB, 4x20bc0123456789AB, 4x20bd0123456789AB, 4x20be0123456789AB, 4x20bf0123456789AB
+D262	DATA8[] 4x20c00123456789AB, 4x20c10123456789AB, 4x20c20123456789AB, 4x20c30123456789AB, 4x20c40123456789AB, 4x20c50123456789AB, 4x20c60123456789AB, 4x20c70123456789AB, 4x20c80123456789AB, 4x20c90123456789AB, 4x20ca0123456789AB, 4x20cb0123456789AB, 4x20cc0123456789AB, 4x20cd0123456789AB, 4x20ce0123456789AB, 4x20cf0123456789AB, 4x20d00123456789AB, 4x20d10123456789AB, 4x20d20123456789AB, 4x20d30123456789AB, 4x20d40123456789AB, 4x20d50123456789AB, 4x20d60123456789AB, 4x20d70123456789AB, 4x20d80123456789AB, 4x20d90123456789AB, 4x20da0123456789AB, 4x20db0123456789AB, 4x20dc0123456789AB, 4x20dd0123456789AB, 4x20de0123456789AB, 4x20df0123456789AB
+D263	DATA8[] 4x20e00123456789AB, 4x20e10123456789AB, 4x20e20123456789AB, 4x20e30123456789AB, 4x20e40123456789AB, 4x20e50123456789AB, 4x20e60123456789AB, 4x20e70123456789AB, 4x20e80123456789AB, 4x20e90123456789AB, 4x20ea0123456789AB, 4x20eb0123456789AB, 4x20ec0123456789AB, 4x20ed0123456789AB, 4x20ee0123456789AB, 4x20ef0123456789AB, 4x20f00123456789AB, 4x20f10123456789AB, 4x20f20123456789AB, 4x20f30123456789AB, 4x20f40123456789AB, 4x20f50123456789AB, 4x20f60123456789AB, 4x20f70123456789AB, 4x20f80123456789AB, 4x20f90123456789AB, 4x20fa0123456789AB, 4x20fb0123456789AB, 4x20fc0123456789AB, 4x20fd0123456789AB, 4x20fe0123456789AB, 4x20ff0123456789AB
+D264	DATA8[] 4x21000123456789AB, 4x21010123456789AB, 4x21020123456789AB, 4x21030123456789AB, 4x21040123456789AB, 4x21050123456789AB, 4x21060123456789AB, 4x21070123456789AB, 4x21080123456789AB, 4x21090123456789AB, 4x210a0123456789AB, 4x210b0123456789AB, 4x210c0123456789AB, 4x210d0123456789AB, 4x210e0123456789AB, 4x210f0123456789AB, 4x21100123456789AB, 4x21110123456789AB, 4x21120123456789AB, 4x21130123456789AB, 4x21140123456789AB, 4x21150123456789AB, 4x21160123456789AB, 4x21170123456789AB, 4x21180123456789AB, 4x21190123456789AB, 4x211a0123456789AB, 4x211b0123456789AB, 4x211c0123456789AB, 4x211d0123456789AB, 4x211e0123456789AB, 4x211f0123456789AB
+D265	DATA8[] 4x21200123456789AB, 4x21210123456789AB, 4x21220123456789AB, 4x21230123456789AB, 4x21240123456789AB, 4x21250123456789AB, 4x21260123456789AB, 4x21270123456789AB, 4x21280123456789AB, 4x21290123456789AB, 4x212a0123456789AB, 4x212b0123456789AB, 4x212c0123456789AB, 4x212d0123456789AB, 4x212e0123456789AB, 4x212f0123456789AB, 4x21300123456789AB, 4x21310123456789AB, 4x21320123456789AB, 4x21330123456789AB, 4x21340123456789AB, 4x21350123456789AB, 4x21360123456789AB, 4x21370123456789AB, 4x21380123456789AB, 4x21390123456789AB, 4x213a0123456789AB, 4x213b0123456789AB, 4x213c0123456789AB, 4x213d0123456789AB, 4x213e0123456789AB, 4x213f0123456789AB
+D266	DATA8[] 4x21400123456789AB, 4x21410123456789AB, 4x21420123456789AB, 4x21430123456789AB, 4x21440123456789AB, 4x21450123456789AB, 4x21460123456789AB, 4x21470123456789AB, 4x21480123456789AB, 4x21490123456789AB, 4x214a0123456789AB, 4x214b0123456789AB, 4x214c0123456789AB, 4x214d0123456789AB, 4x214e0123456789AB, 4x214f0123456789AB, 4x21500123456789AB, 4x21510123456789AB, 4x21520123456789AB, 4x21530123456789AB, 4x21540123456789AB, 4x21550123456789AB, 4x21560123456789AB, 4x21570123456789AB, 4x21580123456789AB, 4x21590123456789AB, 4x215a0123456789AB, 4x215b0123456789AB, 4x215c0123456789AB, 4x215d0123456789AB, 4x215e0123456789AB, 4x215f0123456789AB
+D267	DATA8[] 4x21600123456789AB, 4x21610123456789AB, 4x21620123456789AB, 4x21630123456789AB, 4x21640123456789AB, 4x21650123456789AB, 4x21660123456789AB, 4x21670123456789AB, 4x21680123456789AB, 4x21690123456789AB, 4x216a0123456789AB, 4x216b0123456789AB, 4x216c0123456789AB, 4x216d0123456789AB, 4x216e0123456789AB, 4x216f0123456789AB, 4x21700123456789AB, 4x21710123456789AB, 4x21720123456789AB, 4x21730123456789AB, 4x21740123456789AB, 4x21750123456789AB, 4x21760123456789AB, 4x21770123456789AB, 4x21780123456789AB, 4x21790123456789AB, 4x217a0123456789AB, 4x217b0123456789AB, 4x217c0123456789AB, 4x217d0123456789AB, 4x217e0123456789AB, 4x217f0123456789AB
+D268	DATA8[] 4x21800123456789AB, 4x21810123456789AB, 4x21820123456789AB, 4x21830123456789AB, 4x21840123456789AB, 4x21850123456789AB, 4x21860123456789AB, 4x21870123456789AB, 4x21880123456789AB, 4x21890123456789AB, 4x218a0123456789AB, 4x218b0123456789AB, 4x218c0123456789AB, 4x218d0123456789AB, 4x218e0123456789AB, 4x218f0123456789AB, 4x21900123456789AB, 4x21910123456789AB, 4x21920123456789AB, 4x21930123456789AB, 4x21940123456789AB, 4x21950123456789AB, 4x21960123456789AB, 4x21970123456789AB, 4x21980123456789AB, 4x21990123456789AB, 4x219a0123456789AB, 4x219b0123456789AB, 4x219c0123456789AB, 4x219d0123456789AB, 4x219e0123456789AB, 4x219f0123456789AB
+D269	DATA8[] 4x21a00123456789AB, 4x21a10123456789AB, 4x21a20123456789AB, 4x21a30123456789AB, 4x21a40123456789AB, 4x21a50123456789AB, 4x21a60123456789AB, 4x21a70123456789AB, 4x21a80123456789AB, 4x21a90123456789AB, 4x21aa0123456789AB, 4x21ab0123456789AB, 4x21ac0123456789AB, 4x21ad0123456789AB, 4x21ae0123456789AB, 4x21af0123456789AB, 4x21b00123456789AB, 4x21b10123456789AB, 4x21b20123456789AB, 4x21b30123456789AB, 4x21b40123456789AB, 4x21b50123456789AB, 4x21b60123456789AB, 4x21b70123456789AB, 4x21b80123456789AB, 4x21b90123456789AB, 4x21ba0123456789AB, 4x21bb0123456789AB, 4x21bc0123456789AB, 4x21bd0123456789AB, 4x21be0123456789AB, 4x21bf0123456789AB
+D270	DATA8[] 4x21c00123456789AB, 4x21c10123456789AB, 4x21c20123456789AB, 4x21c30123456789AB, 4x21c40123456789AB, 4x21c50123456789AB, 4x21c60123456789AB, 4x21c70123456789AB, 4x21c80123456789AB, 4x21c90123456789AB, 4x21ca0123456789AB, 4x21cb0123456789AB, 4x21cc0123456789AB, 4x21cd0123456789AB, 4x21ce0123456789AB, 4x21cf0123456789AB, 4x21d00123456789AB, 4x21d10123456789AB, 4x21d20123456789AB, 4x21d30123456789AB, 4x21d40123456789AB, 4x21d50123456789AB, 4x21d60123456789AB, 4x21d70123456789AB, 4x21d80123456789AB, 4x21d90123456789AB, 4x21da0123456789AB, 4x21db0123456789AB, 4x21dc0123456789AB, 4x21dd0123456789AB, 4x21de0123456789AB, 4x21df0123456789AB
+D271	DATA8[] 4x21e00123456789AB, 4x21e10123456789AB, 4x21e20123456789AB, 4x21e30123456789AB, 4x21e40123456789AB, 4x21e50123456789AB, 4x21e60123456789AB, 4x21e70123456789AB, 4x21e80123456789AB, 4x21e90123456789AB, 4x21ea0123456789AB, 4x21eb0123456789AB, 4x21ec0123456789AB, 4x21ed0123456789AB, 4x21ee0123456789AB, 4x21ef0123456789AB, 4x21f00123456789AB, 4x21f10123456789AB, 4x21f20123456789AB, 4x21f30123456789AB, 4x21f40123456789AB, 4x21f50123456789AB, 4x21f60123456789AB, 4x21f70123456789AB, 4x21f80123456789AB, 4x21f90123456789AB, 4x21fa0123456789AB, 4x21fb0123456789AB, 4x21fc0123456789AB, 4x21fd0123456789AB, 4x21fe0123456789AB, 4x21ff0123456789AB
+D272	DATA8[] 4x22000123456789AB, 4x22010123456789AB, 4x22020123456789AB, 4x22030123456789AB, 4x22040123456789AB, 4x22050123456789AB, 4x22060123456789AB, 4x22070123456789AB, 4x22080123456789AB, 4x22090123456789AB, 4x220a0123456789AB, 4x220b0123456789AB, 4x220c0123456789AB, 4x220d0123456789AB, 4x220e0123456789AB, 4x220f0123456789AB, 4x22100123456789AB, 4x22110123456789AB, 4x22120123456789AB, 4x22130123456789AB, 4x22140123456789AB, 4x22150123456789AB, 4x22160123456789AB, 4x22170123456789AB, 4x22180123456789AB, 4x22190123456789AB, 4x221a0123456789AB, 4x221b0123456789AB, 4x221c0123456789AB, 4x221d0123456789AB, 4x221e0123456789AB, 4x221f0123456789AB
+D273	DATA8[] 4x22200123456789AB, 4x22210123456789AB, 4x22220123456789AB, 4x22230123456789AB, 4x22240123456789AB, 4x22250123456789AB, 4x22260123456789AB, 4x22270123456789AB, 4x22280123456789AB, 4x22290123456789AB, 4x222a0123456789AB, 4x222b0123456789AB, 4x222c0123456789AB, 4x222d0123456789AB, 4x222e0123456789AB, 4x222f0123456789AB, 4x22300123456789AB, 4x22310123456789AB, 4x22320123456789AB, 4x22330123456789AB, 4x22340123456789AB, 4x22350123456789AB, 4x22360123456789AB, 4x22370123456789AB, 4x22380123456789AB, 4x22390123456789AB, 4x223a0123456789AB, 4x223b0123456789AB, 4x223c0123456789AB, 4x223d0123456789AB, 4x223e0123456789AB, 4x223f0123456789AB
+D274	DATA8[] 4x22400123456789AB, 4x22410123456789AB, 4x22420123456789AB, 4x22430123456789AB, 4x22440123456789AB, 4x22450123456789AB, 4x22460123456789AB, 4x22470123456789AB, 4x22480123456789AB, 4x22490123456789AB, 4x224a0123456789AB, 4x224b0123456789AB, 4x224c0123456789AB, 4x224d0123456789AB, 4x224e0123456789AB, 4x224f0123456789AB, 4x22500123456789AB, 4x22510123456789AB, 4x22520123456789AB, 4x22530123456789AB, 4x22540123456789AB, 4x22550123456789AB, 4x22560123456789AB, 4x22570123456789AB, 4x22580123456789AB, 4x22590123456789AB, 4x225a0123456789AB, 4x225b0123456789AB, 4x225c0123456789AB, 4x225d0123456789AB, 4x225e0123456789AB, 4x225f0123456789AB
+D275	DATA8[] 4x22600123456789AB, 4x22610123456789AB, 4x22620123456789AB, 4x22630123456789AB, 4x22640123456789AB, 4x22650123456789AB, 4x22660123456789AB, 4x22670123456789AB, 4x22680123456789AB, 4x22690123456789AB, 4x226a0123456789AB, 4x226b0123456789AB, 4x226c0123456789AB, 4x226d0123456789AB, 4x226e0123456789AB, 4x226f0123456789AB, 4x22700123456789AB, 4x22710123456789AB, 4x22720123456789AB, 4x22730123456789AB, 4x22740123456789AB, 4x22750123456789AB, 4x22760123456789AB, 4x22770123456789AB, 4x22780123456789AB, 4x22790123456789AB, 4x227a0123456789AB, 4x227b0123456789AB, 4x227c0123456789AB, 4x227d0123456789AB, 4x227e0123456789AB, 4x227f0123456789AB
+D276	DATA8[] 4x22800123456789AB, 4x22810123456789AB, 4x22820123456789AB, 4x22830123456789AB, 4x22840123456789AB, 4x22850123456789AB, 4x22860123456789AB, 4x22870123456789AB, 4x22880123456789AB, 4x22890123456789AB, 4x228a0123456789AB, 4x228b0123456789AB, 4x228c0123456789AB, 4x228d0123456789AB, 4x228e0123456789AB, 4x228f0123456789AB, 4x22900123456789AB, 4x22910123456789AB, 4x22920123456789AB, 4x22930123456789AB, 4x22940123456789AB, 4x22950123456789AB, 4x22960123456789AB, 4x22970123456789AB, 4x22980123456789AB, 4x22990123456789AB, 4x229a0123456789AB, 4x229b0123456789AB, 4x229c0123456789AB, 4x229d0123456789AB, 4x229e0123456789AB, 4x229f0123456789AB
+D277	DATA8[] 4x22a00123456789AB, 4x22a10123456789AB, 4x22a20123456789AB, 4x22a30123456789AB, 4x22a40123456789AB, 4x22a50123456789AB, 4x22a60123456789AB, 4x22a70123456789AB, 4x22a80123456789AB, 4x22a90123456789AB, 4x22aa0123456789AB, 4x22ab0123456789AB, 4x22ac0123456789AB, 4x22ad0123456789AB, 4x22ae0123456789AB, 4x22af0123456789AB, 4x22b00123456789AB, 4x22b10123456789AB, 4x22b20123456789AB, 4x22b30123456789AB, 4x22b40123456789AB, 4x22b50123456789AB, 4x22b60123456789AB, 4x22b70123456789AB, 4x22b80123456789AB, 4x22b90123456789AB, 4x22ba0123456789AB, 4x22bb0123456789AB, 4x22bc0123456789AB, 4x22bd0123456789AB, 4x22be0123456789AB, 4x22bf0123456789AB
+D278	DATA8[] 4x22c00123456789AB, 4x22c10123456789AB, 4x22c20123456789AB, 4x22c30123456789AB, 4x22c40123456789AB, 4x22c50123456789AB, 4x22c60123456789AB, 4x22c70123456789AB, 4x22c80123456789AB, 4x22c90123456789AB, 4x22ca0123456789AB, 4x22cb0123456789AB, 4x22cc0123456789AB, 4x22cd0123456789AB, 4x22ce0123456789AB, 4x22cf0123456789AB, 4x22d00123456789AB, 4x22d10123456789AB, 4x22d20123456789AB, 4x22d30123456789AB, 4x22d40123456789AB, 4x22d50123456789AB, 4x22d60123456789AB, 4x22d70123456789AB, 4x22d80123456789AB, 4x22d90123456789AB, 4x22da0123456789AB, 4x22db0123456789AB, 4x22dc0123456789AB, 4x22dd0123456789AB, 4x22de0123456789AB, 4x22df0123456789AB
+D279	DATA8[] 4x22e00123456789AB, 4x22e10123456789AB, 4x22e20123456789AB, 4x22e30123456789AB, 4x22e40123456789AB, 4x22e50123456789AB, 4x22e60123456789AB, 4x22e70123456789AB, 4x22e80123456789AB, 4x22e90123456789AB, 4x22ea0123456789AB, 4x22eb0123456789AB, 4x22ec0123456789AB, 4x22ed0123456789AB, 4x22ee0123456789AB, 4x22ef0123456789AB, 4x22f00123456789AB, 4x22f10123456789AB, 4x22f20123456789AB, 4x22f30123456789AB, 4x22f40123456789AB, 4x22f50123456789AB, 4x22f60123456789AB, 4x22f70123456789AB, 4x22f80123456789AB, 4x22f90123456789AB, 4x22fa0123456789AB, 4x22fb0123456789AB, 4x22fc0123456789AB, 4x22fd0123456789AB, 4x22fe0123456789AB, 4x22ff0123456789AB
+D280	DATA8[] 4x23000123456789AB, 4x23010123456789AB, 4x23020123456789AB, 4x23030123456789AB, 4x23040123456789AB, 4x23050123456789AB, 4x23060123456789AB, 4x23070123456789AB, 4x23080123456789AB, 4x23090123456789AB, 4x230a0123456789AB, 4x230b0123456789AB, 4x230c0123456789AB, 4x230d0123456789AB, 4x230e0123456789AB, 4x230f0123456789AB, 4x23100123456789AB, 4x23110123456789AB, 4x23120123456789AB, 4x23130123456789AB, 4x23140123456789AB, 4x23150123456789AB, 4x23160123456789AB, 4x23170123456789AB, 4x23180123456789AB, 4x23190123456789AB, 4x231a0123456789AB, 4x231b0123456789AB, 4x231c0123456789AB, 4x231d0123456789AB, 4x231e0123456789AB, 4x231f0123456789AB
+D281	DATA8[] 4x23200123456789AB, 4x23210123456789AB, 4x23220123456789AB, 4x23230123456789AB, 4x23240123456789AB, 4x23250123456789AB, 4x23260123456789AB, 4x23270123456789AB, 4x23280123456789AB, 4x23290123456789AB, 4x232a0123456789AB, 4x232b0123456789AB, 4x232c0123456789AB, 4x232d0123456789AB, 4x232e0123456789AB, 4x232f0123456789AB, 4x23300123456789AB, 4x23310123456789AB, 4x23320123456789AB, 4x23330123456789AB, 4x23340123456789AB, 4x23350123456789AB, 4x23360123456789AB, 4x23370123456789AB, 4x23380123456789AB, 4x23390123456789AB, 4x233a0123456789AB, 4x233b0123456789AB, 4x233c0123456789AB, 4x233d0123456789AB, 4x233e0123456789AB, 4x233f0123456789AB
+D282	DATA8[] 4x23400123456789AB, 4x23410123456789AB, 4x23420123456789AB, 4x23430123456789AB, 4x23440123456789AB, 4x23450123456789AB, 4x23460123456789AB, 4x23470123456789AB, 4x23480123456789AB, 4x23490123456789AB, 4x234a0123456789AB, 4x234b0123456789AB, 4x234c0123456789AB, 4x234d0123456789AB, 4x234e0123456789AB, 4x234f0123456789AB, 4x23500123456789AB, 4x23510123456789AB, 4x23520123456789AB, 4x23530123456789AB, 4x23540123456789AB, 4x23550123456789AB, 4x23560123456789AB, 4x23570123456789AB, 4x23580123456789AB, 4x23590123456789AB, 4x235a0123456789AB, 4x235b0123456789AB, 4x235c0123456789AB, 4x235d0123456789AB, 4x235e0123456789AB, 4x235f0123456789AB
+D283	DATA8[] 4x23600123456789AB, 4x23610123456789AB, 4x23620123456789AB, 4x23630123456789AB, 4x23640123456789AB, 4x23650123456789AB, 4x23660123456789AB, 4x23670123456789AB, 4x23680123456789AB, 4x23690123456789AB, 4x236a0123456789AB, 4x236b0123456789AB, 4x236c0123456789AB, 4x236d0123456789AB, 4x236e0123456789AB, 4x236f0123456789AB, 4x23700123456789AB, 4x23710123456789AB, 4x23720123456789AB, 4x23730123456789AB, 4x23740123456789AB, 4x23750123456789AB, 4x23760123456789AB, 4x23770123456789AB, 4x23780123456789AB, 4x23790123456789AB, 4x237a0123456789AB, 4x237b0123456789AB, 4x237c0123456789AB, 4x237d0123456789AB, 4x237e0123456789AB, 4x237f0123456789AB
+D284	DATA8[] 4x23800123456789AB, 4x23810123456789AB, 4x23820123456789AB, 4x23830123456789AB, 4x23840123456789AB, 4x23850123456789AB, 4x23860123456789AB, 4x23870123456789AB, 4x23880123456789AB, 4x23890123456789AB, 4x238a0123456789AB, 4x238b0123456789AB, 4x238c0123456789AB, 4x238d0123456789AB, 4x238e0123456789AB, 4x238f0123456789AB, 4x23900123456789AB, 4x23910123456789AB, 4x23920123456789AB, 4x23930123456789AB, 4x23940123456789AB, 4x23950123456789AB, 4x23960123456789AB, 4x23970123456789AB, 4x23980123456789AB, 4x23990123456789AB, 4x239a0123456789AB, 4x239b0123456789AB, 4x239c0123456789AB, 4x239d0123456789AB, 4x239e0123456789AB, 4x239f0123456789AB
+D285	DATA8[] 4x23a00123456789AB, 4x23a10123456789AB, 4x23a20123456789AB, 4x23a30123456789AB, 4x23a40123456789AB, 4x23a50123456789AB, 4x23a60123456789AB, 4x23a70123456789AB, 4x23a80123456789AB, 4x23a90123456789AB, 4x23aa0123456789AB, 4x23ab0123456789AB, 4x23ac0123456789AB, 4x23ad0123456789AB, 4x23ae0123456789AB, 4x23af0123456789AB, 4x23b00123456789AB, 4x23b10123456789AB, 4x23b20123456789AB, 4x23b30123456789AB, 4x23b40123456789AB, 4x23b50123456789AB, 4x23b60123456789AB, 4x23b70123456789AB, 4x23b80123456789AB, 4x23b90123456789AB, 4x23ba0123456789AB, 4x23bb0123456789AB, 4x23bc0123456789AB, 4x23bd0123456789AB, 4x23be0123456789AB, 4x23bf0123456789AB
+D286	DATA8[] 4x23c00123456789AB, 4x23c10123456789AB, 4x23c20123456789AB, 4x23c30123456789AB, 4x23c40123456789AB, 4x23c50123456789AB, 4x23c60123456789AB, 4x23c70123456789AB, 4x23c80123456789AB, 4x23c90123456789AB, 4x23ca0123456789AB, 4x23cb0123456789AB, 4x23cc0123456789AB, 4x23cd0123456789AB, 4x23ce0123456789AB, 4x23cf0123456789AB, 4x23d00123456789AB, 4x23d10123456789AB, 4x23d20123456789AB, 4x23d30123456789AB, 4x23d40123456789AB, 4x23d50123456789AB, 4x23d60123456789AB, 4x23d70123456789AB, 4x23d80123456789AB, 4x23d90123456789AB, 4x23da0123456789AB, 4x23db0123456789AB, 4x23dc0123456789AB, 4x23dd0123456789AB, 4x23de0123456789AB, 4x23df0123456789AB
+D287	DATA8[] 4x23e00123456789AB, 4x23e10123456789AB, 4x23e20123456789AB, 4x23e30123456789AB, 4x23e40123456789AB, 4x23e50123456789AB, 4x23e60123456789AB, 4x23e70123456789AB, 4x23e80123456789AB, 4x23e90123456789AB, 4x23ea0123456789AB, 4x23eb0123456789AB, 4x23ec0123456789AB, 4x23ed0123456789AB, 4x23ee0123456789AB, 4x23ef0123456789AB, 4x23f00123456789AB, 4x23f10123456789AB, 4x23f20123456789AB, 4x23f30123456789AB, 4x23f40123456789AB, 4x23f50123456789AB, 4x23f60123456789AB, 4x23f70123456789AB, 4x23f80123456789AB, 4x23f90123456789AB, 4x23fa0123456789AB, 4x23fb0123456789AB, 4x23fc0123456789AB, 4x23fd0123456789AB, 4x23fe0123456789AB, 4x23ff0123456789AB
+D288	DATA8[] 4x24000123456789AB, 4x24010123456789AB, 4x24020123456789AB, 4x24030123456789AB, 4x24040123456789AB, 4x24050123456789AB, 4x24060123456789AB, 4x24070123456789AB, 4x24080123456789AB, 4x24090123456789AB, 4x240a0123456789AB, 4x240b0123456789AB, 4x240c0123456789AB, 4x240d0123456789AB, 4x240e0123456789AB, 4x240f0123456789AB, 4x24100123456789AB, 4x24110123456789AB, 4x24120123456789AB, 4x24130123456789AB, 4x24140123456789AB, 4x24150123456789AB, 4x24160123456789AB, 4x24170123456789AB, 4x24180123456789AB, 4x24190123456789AB, 4x241a0123456789AB, 4x241b0123456789AB, 4x241c0123456789AB, 4x241d0123456789AB, 4x241e0123456789AB, 4x241f0123456789AB
+D289	DATA8[] 4x24200123456789AB, 4x24210123456789AB, 4x24220123456789AB, 4x24230123456789AB, 4x24240123456789AB, 4x24250123456789AB, 4x24260123456789AB, 4x24270123456789AB, 4x24280123456789AB, 4x24290123456789AB, 4x242a0123456789AB, 4x242b0123456789AB, 4x242c0123456789AB, 4x242d0123456789AB, 4x242e0123456789AB, 4x242f0123456789AB, 4x24300123456789AB, 4x24310123456789AB, 4x24320123456789AB, 4x24330123456789AB, 4x24340123456789AB, 4x24350123456789AB, 4x24360123456789AB, 4x24370123456789AB, 4x24380123456789AB, 4x24390123456789AB, 4x243a0123456789AB, 4x243b0123456789AB, 4x243c0123456789AB, 4x243d0123456789AB, 4x243e0123456789AB, 4x243f0123456789AB
+D290	DATA8[] 4x24400123456789AB, 4x24410123456789AB, 4x24420123456789AB, 4x24430123456789AB, 4x24440123456789AB, 4x24450123456789AB, 4x24460123456789AB, 4x24470123456789AB, 4x24480123456789AB, 4x24490123456789AB, 4x244a0123456789AB, 4x244b0123456789AB, 4x244c0123456789AB, 4x244d0123456789AB, 4x244e0123456789AB, 4x244f0123456789AB, 4x24500123456789AB, 4x24510123456789AB, 4x24520123456789AB, 4x24530123456789AB, 4x24540123456789AB, 4x24550123456789AB, 4x24560123456789AB, 4x24570123456789AB, 4x24580123456789AB, 4x24590123456789AB, 4x245a0123456789AB, 4x245b0123456789AB, 4x245c0123456789AB, 4x245d0123456789AB, 4x245e0123456789AB, 4x245f0123456789AB
+D291	DATA8[] 4x24600123456789AB, 4x24610123456789AB, 4x24620123456789AB, 4x24630123456789AB, 4x24640123456789AB, 4x24650123456789AB, 4x24660123456789AB, 4x24670123456789AB, 4x24680123456789AB, 4x24690123456789AB, 4x246a0123456789AB, 4x246b0123456789AB, 4x246c0123456789AB, 4x246d0123456789AB, 4x246e0123456789AB, 4x246f0123456789AB, 4x24700123456789AB, 4x24710123456789AB, 4x24720123456789AB, 4x24730123456789AB, 4x24740123456789AB, 4x24750123456789AB, 4x24760123456789AB, 4x24770123456789AB, 4x24780123456789AB, 4x24790123456789AB, 4x247a0123456789AB, 4x247b0123456789AB, 4x247c0123456789AB, 4x247d0123456789AB, 4x247e0123456789AB, 4x247f0123456789AB
+D292	DATA8[] 4x24800123456789AB, 4x24810123456789AB, 4x24820123456789AB, 4x24830123456789AB, 4x24840123456789AB, 4x24850123456789AB, 4x24860123456789AB, 4x24870123456789AB, 4x24880123456789AB, 4x24890123456789AB, 4x248a0123456789AB, 4x248b0123456789AB, 4x248c0123456789AB, 4x248d0123456789AB, 4x248e0123456789AB, 4x248f0123456789AB, 4x24900123456789AB, 4x24910123456789AB, 4x24920123456789AB, 4x24930123456789AB, 4x24940123456789AB, 4x24950123456789AB, 4x24960123456789AB, 4x24970123456789AB, 4x24980123456789AB, 4x24990123456789AB, 4x249a0123456789AB, 4x249b0123456789AB, 4x249c0123456789AB, 4x249d0123456789AB, 4x249e0123456789AB, 4x249f0123456789AB
+D293	DATA8[] 4x24a00123456789AB, 4x24a10123456789AB, 4x24a20123456789AB, 4x24a30123456789AB, 4x24a40123456789AB, 4x24a50123456789AB, 4x24a60123456789AB, 4x24a70123456789AB, 4x24a80123456789AB, 4x24a90123456789AB, 4x24aa0123456789AB, 4x24ab0123456789AB, 4x24ac0123456789AB, 4x24ad0123456789AB, 4x24ae0123456789AB, 4x24af0123456789AB, 4x24b00123456789AB, 4x24b10123456789AB, 4x24b20123456789AB, 4x24b30123456789AB, 4x24b40123456789AB, 4x24b50123456789AB, 4x24b60123456789AB, 4x24b70123456789AB, 4x24b80123456789AB, 4x24b90123456789AB, 4x24ba0123456789AB, 4x24bb0123456789AB, 4x24bc0123456789AB, 4x24bd0123456789AB, 4x24be0123456789AB, 4x24bf0123456789AB
+D294	DATA8[] 4x24c00123456789AB, 4x24c10123456789AB, 4x24c20123456789AB, 4x24c30123456789AB, 4x24c40123456789AB, 4x24c50123456789AB, 4x24c60123456789AB, 4x24c70123456789AB, 4x24c80123456789AB, 4x24c90123456789AB, 4x24ca0123456789AB, 4x24cb0123456789AB, 4x24cc0123456789AB, 4x24cd0123456789AB, 4x24ce0123456789AB, 4x24cf0123456789AB, 4x24d00123456789AB, 4x24d10123456789AB, 4x24d20123456789AB, 4x24d30123456789AB, 4x24d40123456789AB, 4x24d50123456789AB, 4x24d60123456789AB, 4x24d70123456789AB, 4x24d80123456789AB, 4x24d90123456789AB, 4x24da0123456789AB, 4x24db0123456789AB, 4x24dc0123456789AB, 4x24dd0123456789AB, 4x24de0123456789AB, 4x24df0123456789AB
+D295	DATA8[] 4x24e00123456789AB, 4x24e10123456789AB, 4x24e20123456789AB, 4x24e30123456789AB, 4x24e40123456789AB, 4x24e50123456789AB, 4x24e60123456789AB, 4x24e70123456789AB, 4x24e80123456789AB, 4x24e90123456789AB, 4x24ea0123456789AB, 4x24eb0123456789AB, 4x24ec0123456789AB, 4x24ed0123456789AB, 4x24ee0123456789AB, 4x24ef0123456789AB, 4x24f00123456789AB, 4x24f10123456789AB, 4x24f20123456789AB, 4x24f30123456789AB, 4x24f40123456789AB, 4x24f50123456789AB, 4x24f60123456789AB, 4x24f70123456789AB, 4x24f80123456789AB, 4x24f90123456789AB, 4x24fa0123456789AB, 4x24fb0123456789AB, 4x24fc0123456789AB, 4x24fd0123456789AB, 4x24fe0123456789AB, 4x24ff0123456789AB
+D296	DATA8[] 4x25000123456789AB, 4x25010123456789AB, 4x25020123456789AB, 4x25030123456789AB, 4x25040123456789AB, 4x25050123456789AB, 4x25060123456789AB, 4x25070123456789AB, 4x25080123456789AB, 4x25090123456789AB, 4x250a0123456789AB, 4x250b0123456789AB, 4x250c0123456789AB, 4x250d0123456789AB, 4x250e0123456789AB, 4x250f0123456789AB, 4x25100123456789AB, 4x25110123456789AB, 4x25120123456789AB, 4x25130123456789AB, 4x25140123456789AB, 4x25150123456789AB, 4x25160123456789AB, 4x25170123456789AB, 4x25180123456789AB, 4x25190123456789AB, 4x251a0123456789AB, 4x251b0123456789AB, 4x251c0123456789AB, 4x251d0123456789AB, 4x251e0123456789AB, 4x251f0123456789AB
+D297	DATA8[] 4x25200123456789AB, 4x25210123456789AB, 4x25220123456789AB, 4x25230123456789AB, 4x25240123456789AB, 4x25250123456789AB, 4x25260123456789AB, 4x25270123456789AB, 4x25280123456789AB, 4x25290123456789AB, 4x252a0123456789AB, 4x252b0123456789AB, 4x252c0123456789AB, 4x252d0123456789AB, 4x252e0123456789AB, 4x252f0123456789AB, 4x25300123456789AB, 4x25310123456789AB, 4x25320123456789AB, 4x25330123456789AB, 4x25340123456789AB, 4x25350123456789AB, 4x25360123456789AB, 4x25370123456789AB, 4x25380123456789AB, 4x25390123456789AB, 4x253a0123456789AB, 4x253b0123456789AB, 4x253c0123456789AB, 4x253d0123456789AB, 4x253e0123456789AB, 4x253f0123456789AB
+D298	DATA8[] 4x25400123456789AB, 4x25410123456789AB, 4x25420123456789AB, 4x25430123456789AB, 4x25440123456789AB, 4x25450123456789AB, 4x25460123456789AB, 4x25470123456789AB, 4x25480123456789AB, 4x25490123456789AB, 4x254a0123456789AB, 4x254b0123456789AB, 4x254c0123456789AB, 4x254d0123456789AB, 4x254e0123456789AB, 4x254f0123456789AB, 4x25500123456789AB, 4x25510123456789AB, 4x25520123456789AB, 4x25530123456789AB, 4x25540123456789AB, 4x25550123456789AB, 4x25560123456789AB, 4x25570123456789AB, 4x25580123456789AB, 4x25590123456789AB, 4x255a0123456789AB, 4x255b0123456789AB, 4x255c0123456789AB, 4x255d0123456789AB, 4x255e0123456789AB, 4x255f0123456789AB
+D299	DATA8[] 4x25600123456789AB, 4x25610123456789AB, 4x25620123456789AB, 4x25630123456789AB, 4x25640123456789AB, 4x25650123456789AB, 4x25660123456789AB, 4x25670123456789AB, 4x25680123456789AB, 4x25690123456789AB, 4x256a0123456789AB, 4x256b0123456789AB, 4x256c0123456789AB, 4x256d0123456789AB, 4x256e0123456789AB, 4x256f0123456789AB, 4x25700123456789AB, 4x25710123456789AB, 4x25720123456789AB, 4x25730123456789AB, 4x25740123456789AB, 4x25750123456789AB, 4x25760123456789AB, 4x25770123456789AB, 4x25780123456789AB, 4x25790123456789AB, 4x257a0123456789AB, 4x257b0123456789AB, 4x257c0123456789AB, 4x257d0123456789AB, 4x257e0123456789AB, 4x257f0123456789AB
+D300	DATA8[] 4x25800123456789AB, 4x25810123456789AB, 4x25820123456789AB, 4x25830123456789AB, 4x25840123456789AB, 4x25850123456789AB, 4x25860123456789AB, 4x25870123456789AB, 4x25880123456789AB, 4x25890123456789AB, 4x258a0123456789AB, 4x258b0123456789AB, 4x258c0123456789AB, 4x258d0123456789AB, 4x258e0123456789AB, 4x258f0123456789AB, 4x25900123456789AB, 4x25910123456789AB, 4x25920123456789AB, 4x25930123456789AB, 4x25940123456789AB, 4x25950123456789AB, 4x25960123456789AB, 4x25970123456789AB, 4x25980123456789AB, 4x25990123456789AB, 4x259a0123456789AB, 4x259b0123456789AB, 4x259c0123456789AB, 4x259d0123456789AB, 4x259e0123456789AB, 4x259f0123456789AB
+D301	DATA8[] 4x25a00123456789AB, 4x25a10123456789AB, 4x25a20123456789AB, 4x25a30123456789AB, 4x25a40123456789AB, 4x25a50123456789AB, 4x25a60123456789AB, 4x25a70123456789AB, 4x25a80123456789AB, 4x25a90123456789AB, 4x25aa0123456789AB, 4x25ab0123456789AB, 4x25ac0123456789AB, 4x25ad0123456789AB, 4x25ae0123456789AB, 4x25af0123456789AB, 4x25b00123456789AB, 4x25b10123456789AB, 4x25b20123456789AB, 4x25b30123456789AB, 4x25b40123456789AB, 4x25b50123456789AB, 4x25b60123456789AB, 4x25b70123456789AB, 4x25b80123456789AB, 4x25b90123456789AB, 4x25ba0123456789AB, 4x25bb0123456789AB, 4x25bc0123456789AB, 4x25bd0123456789AB, 4x25be0123456789AB, 4x25bf0123456789AB
+D302	DATA8[] 4x25c00123456789AB, 4x25c10123456789AB, 4x25c20123456789AB, 4x25c30123456789AB, 4x25c40123456789AB, 4x25c50123456789AB, 4x25c60123456789AB, 4x25c70123456789AB, 4x25c80123456789AB, 4x25c90123456789AB, 4x25ca0123456789AB, 4x25cb0123456789AB, 4x25cc0123456789AB, 4x25cd0123456789AB, 4x25ce0123456789AB, 4x25cf0123456789AB, 4x25d00123456789AB, 4x25d10123456789AB, 4x25d20123456789AB, 4x25d30123456789AB, 4x25d40123456789AB, 4x25d50123456789AB, 4x25d60123456789AB, 4x25d70123456789AB, 4x25d80123456789AB, 4x25d90123456789AB, 4x25da0123456789AB, 4x25db0123456789AB, 4x25dc0123456789AB, 4x25dd0123456789AB, 4x25de0123456789AB, 4x25df0123456789AB
+D303	DATA8[] 4x25e00123456789AB, 4x25e10123456789AB, 4x25e20123456789AB, 4x25e30123456789AB, 4x25e40123456789AB, 4x25e50123456789AB, 4x25e60123456789AB, 4x25e70123456789AB, 4x25e80123456789AB, 4x25e90123456789AB, 4x25ea0123456789AB, 4x25eb0123456789AB, 4x25ec0123456789AB, 4x25ed0123456789AB, 4x25ee0123456789AB, 4x25ef0123456789AB, 4x25f00123456789AB, 4x25f10123456789AB, 4x25f20123456789AB, 4x25f30123456789AB, 4x25f40123456789AB, 4x25f50123456789AB, 4x25f60123456789AB, 4x25f70123456789AB, 4x25f80123456789AB, 4x25f90123456789AB, 4x25fa0123456789AB, 4x25fb0123456789AB, 4x25fc0123456789AB, 4x25fd0123456789AB, 4x25fe0123456789AB, 4x25ff0123456789AB
+D304	DATA8[] 4x26000123456789AB, 4x26010123456789AB, 4x26020123456789AB, 4x26030123456789AB, 4x26040123456789AB, 4x26050123456789AB, 4x26060123456789AB, 4x26070123456789AB, 4x26080123456789AB, 4x26090123456789AB, 4x260a0123456789AB, 4x260b0123456789AB, 4x260c0123456789AB, 4x260d0123456789AB, 4x260e0123456789AB, 4x260f0123456789AB, 4x26100123456789AB, 4x26110123456789AB, 4x26120123456789AB, 4x26130123456789AB, 4x26140123456789AB, 4x26150123456789AB, 4x26160123456789AB, 4x26170123456789AB, 4x26180123456789AB, 4x26190123456789AB, 4x261a0123456789AB, 4x261b0123456789AB, 4x261c0123456789AB, 4x261d0123456789AB, 4x261e0123456789AB, 4x261f0123456789AB
+D305	DATA8[] 4x26200123456789AB, 4x26210123456789AB, 4x26220123456789AB, 4x26230123456789AB, 4x26240123456789AB, 4x26250123456789AB, 4x26260123456789AB, 4x26270123456789AB, 4x26280123456789AB, 4x26290123456789AB, 4x262a0123456789AB, 4x262b0123456789AB, 4x262c0123456789AB, 4x262d0123456789AB, 4x262e0123456789AB, 4x262f0123456789AB, 4x26300123456789AB, 4x26310123456789AB, 4x26320123456789AB, 4x26330123456789AB, 4x26340123456789AB, 4x26350123456789AB, 4x26360123456789AB, 4x26370123456789AB, 4x26380123456789AB, 4x26390123456789AB, 4x263a0123456789AB, 4x263b0123456789AB, 4x263c0123456789AB, 4x263d0123456789AB, 4x263e0123456789AB, 4x263f0123456789AB
+D306	DATA8[] 4x26400123456789AB, 4x26410123456789AB, 4x26420123456789AB, 4x26430123456789AB, 4x26440123456789AB, 4x26450123456789AB, 4x26460123456789AB, 4x26470123456789AB, 4x26480123456789AB, 4x26490123456789AB, 4x264a0123456789AB, 4x264b0123456789AB, 4x264c0123456789AB, 4x264d0123456789AB, 4x264e0123456789AB, 4x264f0123456789AB, 4x26500123456789AB, 4x26510123456789AB, 4x26520123456789AB, 4x26530123456789AB, 4x26540123456789AB, 4x26550123456789AB, 4x26560123456789AB, 4x26570123456789AB, 4x26580123456789AB, 4x26590123456789AB, 4x265a0123456789AB, 4x265b0123456789AB, 4x265c0123456789AB, 4x265d0123456789AB, 4x265e0123456789AB, 4x265f0123456789AB
+D307	DATA8[] 4x26600123456789AB, 4x26610123456789AB, 4x26620123456789AB, 4x26630123456789AB, 4x26640123456789AB, 4x26650123456789AB, 4x26660123456789AB, 4x26670123456789AB, 4x26680123456789AB, 4x26690123456789AB, 4x266a0123456789AB, 4x266b0123456789AB, 4x266c0123456789AB, 4x266d0123456789AB, 4x266e0123456789AB, 4x266f0123456789AB, 4x26700123456789AB, 4x26710123456789AB, 4x26720123456789AB, 4x26730123456789AB, 4x26740123456789AB, 4x26750123456789AB, 4x26760123456789AB, 4x26770123456789AB, 4x26780123456789AB, 4x26790123456789AB, 4x267a0123456789AB, 4x267b0123456789AB, 4x267c0123456789AB, 4x267d0123456789AB, 4x267e0123456789AB, 4x267f0123456789AB
+D308	DATA8[] 4x26800123456789AB, 4x26810123456789AB, 4x26820123456789AB, 4x26830123456789AB, 4x26840123456789AB, 4x26850123456789AB, 4x26860123456789AB, 4x26870123456789AB, 4x26880123456789AB, 4x26890123456789AB, 4x268a0123456789AB, 4x268b0123456789AB, 4x268c0123456789AB, 4x268d0123456789AB, 4x268e0123456789AB, 4x268f0123456789AB, 4x26900123456789AB, 4x26910123456789AB, 4x26920123456789AB, 4x26930123456789AB, 4x26940123456789AB, 4x26950123456789AB, 4x26960123456789AB, 4x26970123456789AB, 4x26980123456789AB, 4x26990123456789AB, 4x269a0123456789AB, 4x269b0123456789AB, 4x269c0123456789AB, 4x269d0123456789AB, 4x269e0123456789AB, 4x269f0123456789AB
+D309	DATA8[] 4x26a00123456789AB, 4x26a10123456789AB, 4x26a20123456789AB, 4x26a30123456789AB, 4x26a40123456789AB, 4x26a50123456789AB, 4x26a60123456789AB, 4x26a70123456789AB, 4x26a80123456789AB, 4x26a90123456789AB, 4x26aa0123456789AB, 4x26ab0123456789AB, 4x26ac0123456789AB, 4x26ad0123456789AB, 4x26ae0123456789AB, 4x26af0123456789AB, 4x26b00123456789AB, 4x26b10123456789AB, 4x26b20123456789AB, 4x26b30123456789AB, 4x26b40123456789AB, 4x26b50123456789AB, 4x26b60123456789AB, 4x26b70123456789AB, 4x26b80123456789AB, 4x26b90123456789AB, 4x26ba0123456789AB, 4x26bb0123456789AB, 4x26bc0123456789AB, 4x26bd0123456789AB, 4x26be0123456789AB, 4x26bf0123456789AB
+D310	DATA8[] 4x26c00123456789AB, 4x26c10123456789AB, 4x26c20123456789AB, 4x26c30123456789AB, 4x26c40123456789AB, 4x26c50123456789AB, 4x26c60123456789AB, 4x26c70123456789AB, 4x26c80123456789AB, 4x26c90123456789AB, 4x26ca0123456789AB, 4x26cb0123456789AB, 4x26cc0123456789AB, 4x26cd0123456789AB, 4x26ce0123456789AB, 4x26cf0123456789AB, 4x26d00123456789AB, 4x26d10123456789AB, 4x26d20123456789AB, 4x26d30123456789AB, 4x26d40123456789AB, 4x26d50123456789AB, 4x26d60123456789AB, 4x26d70123456789AB, 4x26d80123456789AB, 4x26d90123456789AB, 4x26da0123456789AB, 4x26db0123456789AB, 4x26dc0123456789AB, 4x26dd0123456789AB, 4x26de0123456789AB, 4x26df0123456789AB
+D311	DATA8[] 4x26e00123456789AB, 4x26e10123456789AB, 4x26e20123456789AB, 4x26e30123456789AB, 4x26e40123456789AB, 4x26e50123456789AB, 4x26e60123456789AB, 4x26e70123456789AB, 4x26e80123456789AB, 4x26e90123456789AB, 4x26ea0123456789AB, 4x26eb0123456789AB, 4x26ec0123456789AB, 4x26ed0123456789AB, 4x26ee0123456789AB, 4x26ef0123456789AB, 4x26f00123456789AB, 4x26f10123456789AB, 4x26f20123456789AB, 4x26f30123456789AB, 4x26f40123456789AB, 4x26f50123456789AB, 4x26f60123456789AB, 4x26f70123456789AB, 4x26f80123456789AB, 4x26f90123456789AB, 4x26fa0123456789AB, 4x26fb0123456789AB, 4x26fc0123456789AB, 4x26fd0123456789AB, 4x26fe0123456789AB, 4x26ff0123456789AB
+D312	DATA8[] 4x27000123456789AB, 4x27010123456789AB, 4x27020123456789AB, 4x27030123456789AB, 4x27040123456789AB, 4x27050123456789AB, 4x27060123456789AB, 4x27070123456789AB, 4x27080123456789AB, 4x27090123456789AB, 4x270a0123456789AB, 4x270b0123456789AB, 4x270c0123456789AB, 4x270d0123456789AB, 4x270e0123456789AB, 4x270f0123456789AB, 4x27100123456789AB, 4x27110123456789AB, 4x27120123456789AB, 4x27130123456789AB, 4x27140123456789AB, 4x27150123456789AB, 4x27160123456789AB, 4x27170123456789AB, 4x27180123456789AB, 4x27190123456789AB, 4x271a0123456789AB, 4x271b0123456789AB, 4x271c0123456789AB, 4x271d0123456789AB, 4x271e0123456789AB, 4x271f0123456789AB
+D313	DATA8[] 4x27200123456789AB, 4x27210123456789AB, 4x27220123456789AB, 4x27230123456789AB, 4x27240123456789AB, 4x27250123456789AB, 4x27260123456789AB, 4x27270123456789AB, 4x27280123456789AB, 4x27290123456789AB, 4x272a0123456789AB, 4x272b0123456789AB, 4x272c0123456789AB, 4x272d0123456789AB, 4x272e0123456789AB, 4x272f0123456789AB, 4x27300123456789AB, 4x27310123456789AB, 4x27320123456789AB, 4x27330123456789AB, 4x27340123456789AB, 4x27350123456789AB, 4x27360123456789AB, 4x27370123456789AB, 4x27380123456789AB, 4x27390123456789AB, 4x273a0123456789AB, 4x273b0123456789AB, 4x273c0123456789AB, 4x273d0123456789AB, 4x273e0123456789AB, 4x273f0123456789AB
+D314	DATA8[] 4x27400123456789AB, 4x27410123456789AB, 4x27420123456789AB, 4x27430123456789AB, 4x27440123456789AB, 4x27450123456789AB, 4x27460123456789AB, 4x27470123456789AB, 4x27480123456789AB, 4x27490123456789AB, 4x274a0123456789AB, 4x274b0123456789AB, 4x274c0123456789AB, 4x274d0123456789AB, 4x274e0123456789AB, 4x274f0123456789AB, 4x27500123456789AB, 4x27510123456789AB, 4x27520123456789AB, 4x27530123456789AB, 4x27540123456789AB, 4x27550123456789AB, 4x27560123456789AB, 4x27570123456789AB, 4x27580123456789AB, 4x27590123456789AB, 4x275a0123456789AB, 4x275b0123456789AB, 4x275c0123456789AB, 4x275d0123456789AB, 4x275e0123456789AB, 4x275f0123456789AB
+D315	DATA8[] 4x27600123456789AB, 4x27610123456789AB, 4x27620123456789AB, 4x27630123456789AB, 4x27640123456789AB, 4x27650123456789AB, 4x27660123456789AB, 4x27670123456789AB, 4x27680123456789AB, 4x27690123456789AB, 4x276a0123456789AB, 4x276b0123456789AB, 4x276c0123456789AB, 4x276d0123456789AB, 4x276e0123456789AB, 4x276f0123456789AB, 4x27700123456789AB, 4x27710123456789AB, 4x27720123456789AB, 4x27730123456789AB, 4x27740123456789AB, 4x27750123456789AB, 4x27760123456789AB, 4x27770123456789AB, 4x27780123456789AB, 4x27790123456789AB, 4x277a0123456789AB, 4x277b0123456789AB, 4x277c0123456789AB, 4x277d0123456789AB, 4x277e0123456789AB, 4x277f0123456789AB
+D316	DATA8[] 4x27800123456789AB, 4x27810123456789AB, 4x27820123456789AB, 4x27830123456789AB, 4x27840123456789AB, 4x27850123456789AB, 4x27860123456789AB, 4x27870123456789AB, 4x27880123456789AB, 4x27890123456789AB, 4x278a0123456789AB, 4x278b0123456789AB, 4x278c0123456789AB, 4x278d0123456789AB, 4x278e0123456789AB, 4x278f0123456789AB, 4x27900123456789AB, 4x27910123456789AB, 4x27920123456789AB, 4x27930123456789AB, 4x27940123456789AB, 4x27950123456789AB, 4x27960123456789AB, 4x27970123456789AB, 4x27980123456789AB, 4x27990123456789AB, 4x279a0123456789AB, 4x279b0123456789AB, 4x279c0123456789AB, 4x279d0123456789AB, 4x279e0123456789AB, 4x279f0123456789AB
+D317	DATA8[] 4x27a00123456789AB, 4x27a10123456789AB, 4x27a20123456789AB, 4x27a30123456789AB, 4x27a40123456789AB, 4x27a50123456789AB, 4x27a60123456789AB, 4x27a70123456789AB, 4x27a80123456789AB, 4x27a90123456789AB, 4x27aa0123456789AB, 4x27ab0123456789AB, 4x27ac0123456789AB, 4x27ad0123456789AB, 4x27ae0123456789AB, 4x27af0123456789AB, 4x27b00123456789AB, 4x27b10123456789AB, 4x27b20123456789AB, 4x27b30123456789AB, 4x27b40123456789AB, 4x27b50123456789AB, 4x27b60123456789AB, 4x27b70123456789AB, 4x27b80123456789AB, 4x27b90123456789AB, 4x27ba0123456789AB, 4x27bb0123456789AB, 4x27bc0123456789AB, 4x27bd0123456789AB, 4x27be0123456789AB, 4x27bf0123456789AB
+D318	DATA8[] 4x27c00123456789AB, 4x27c10123456789AB, 4x27c20123456789AB, 4x27c30123456789AB, 4x27c40123456789AB, 4x27c50123456789AB, 4x27c60123456789AB, 4x27c70123456789AB, 4x27c80123456789AB, 4x27c90123456789AB, 4x27ca0123456789AB, 4x27cb0123456789AB, 4x27cc0123456789AB, 4x27cd0123456789AB, 4x27ce0123456789AB, 4x27cf0123456789AB, 4x27d00123456789AB, 4x27d10123456789AB, 4x27d20123456789AB, 4x27d30123456789AB, 4x27d40123456789AB, 4x27d50123456789AB, 4x27d60123456789AB, 4x27d70123456789AB, 4x27d80123456789AB, 4x27d90123456789AB, 4x27da0123456789AB, 4x27db0123456789AB, 4x27dc0123456789AB, 4x27dd0123456789AB, 4x27de0123456789AB, 4x27df0123456789AB
+D319	DATA8[] 4x27e00123456789AB, 4x27e10123456789AB, 4x27e20123456789AB, 4x27e30123456789AB, 4x27e40123456789AB, 4x27e50123456789AB, 4x27e60123456789AB, 4x27e70123456789AB, 4x27e80123456789AB, 4x27e90123456789AB, 4x27ea0123456789AB, 4x27eb0123456789AB, 4x27ec0123456789AB, 4x27ed0123456789AB, 4x27ee0123456789AB, 4x27ef0123456789AB, 4x27f00123456789AB, 4x27f10123456789AB, 4x27f20123456789AB, 4x27f30123456789AB, 4x27f40123456789AB, 4x27f50123456789AB, 4x27f60123456789AB, 4x27f70123456789AB, 4x27f80123456789AB, 4x27f90123456789AB, 4x27fa0123456789AB, 4x27fb0123456789AB, 4x27fc0123456789AB, 4x27fd0123456789AB, 4x27fe0123456789AB, 4x27ff0123456789AB
+D320	DATA8[] 4x28000123456789AB, 4x28010123456789AB, 4x28020123456789AB, 4x28030123456789AB, 4x28040123456789AB, 4x28050123456789AB, 4x28060123456789AB, 4x28070123456789AB, 4x28080123456789AB, 4x28090123456789AB, 4x280a0123456789AB, 4x280b0123456789AB, 4x280c0123456789AB, 4x280d0123456789AB, 4x280e0123456789AB, 4x280f0123456789AB, 4x28100123456789AB, 4x28110123456789AB, 4x28120123456789AB, 4x28130123456789AB, 4x28140123456789AB, 4x28150123456789AB, 4x28160123456789AB, 4x28170123456789AB, 4x28180123456789AB, 4x28190123456789AB, 4x281a0123456789AB, 4x281b0123456789AB, 4x281c0123456789AB, 4x281d0123456789AB, 4x281e0123456789AB, 4x281f0123456789AB
+D321	DATA8[] 4x28200123456789AB, 4x28210123456789AB, 4x28220123456789AB, 4x28230123456789AB, 4x28240123456789AB, 4x28250123456789AB, 4x28260123456789AB, 4x28270123456789AB, 4x28280123456789AB, 4x28290123456789AB, 4x282a0123456789AB, 4x282b0123456789AB, 4x282c0123456789AB, 4x282d0123456789AB, 4x282e0123456789AB, 4x282f0123456789AB, 4x28300123456789AB, 4x28310123456789AB, 4x28320123456789AB, 4x28330123456789AB, 4x28340123456789AB, 4x28350123456789AB, 4x28360123456789AB, 4x28370123456789AB, 4x28380123456789AB, 4x28390123456789AB, 4x283a0123456789AB, 4x283b0123456789AB, 4x283c0123456789AB, 4x283d0123456789AB, 4x283e0123456789AB, 4x283f0123456789AB
+D322	DATA8[] 4x28400123456789AB, 4x28410123456789AB, 4x28420123456789AB, 4x28430123456789AB, 4x28440123456789AB, 4x28450123456789AB, 4x28460123456789AB, 4x28470123456789AB, 4x28480123456789AB, 4x28490123456789AB, 4x284a0123456789AB, 4x284b0123456789AB, 4x284c0123456789AB, 4x284d0123456789AB, 4x284e0123456789AB, 4x284f0123456789AB, 4x28500123456789AB, 4x28510123456789AB, 4x28520123456789AB, 4x28530123456789AB, 4x28540123456789AB, 4x28550123456789AB, 4x28560123456789AB, 4x28570123456789AB, 4x28580123456789AB, 4x28590123456789AB, 4x285a0123456789AB, 4x285b0123456789AB, 4x285c0123456789AB, 4x285d0123456789AB, 4x285e0123456789AB, 4x285f0123456789AB
+D323	DATA8[] 4x28600123456789AB, 4x28610123456789AB, 4x28620123456789AB, 4x28630123456789AB, 4x28640123456789AB, 4x28650123456789AB, 4x28660123456789AB, 4x28670123456789AB, 4x28680123456789AB, 4x28690123456789AB, 4x286a0123456789AB, 4x286b0123456789AB, 4x286c0123456789AB, 4x286d0123456789AB, 4x286e0123456789AB, 4x286f0123456789AB, 4x28700123456789AB, 4x28710123456789AB, 4x28720123456789AB, 4x28730123456789AB, 4x28740123456789AB, 4x28750123456789AB, 4x28760123456789AB, 4x28770123456789AB, 4x28780123456789AB, 4x28790123456789AB, 4x287a0123456789AB, 4x287b0123456789AB, 4x287c0123456789AB, 4x287d0123456789AB, 4x287e0123456789AB, 4x287f0123456789AB
+D324	DATA8[] 4x28800123456789AB, 4x28810123456789AB, 4x28820123456789AB, 4x28830123456789AB, 4x28840123456789AB, 4x28850123456789AB, 4x28860123456789AB, 4x28870123456789AB, 4x28880123456789AB, 4x28890123456789AB, 4x288a0123456789AB, 4x288b0123456789AB, 4x288c0123456789AB, 4x288d0123456789AB, 4x288e0123456789AB, 4x288f0123456789AB, 4x28900123456789AB, 4x28910123456789AB, 4x28920123456789AB, 4x28930123456789AB, 4x28940123456789AB, 4x28950123456789AB, 4x28960123456789AB, 4x28970123456789AB, 4x28980123456789AB, 4x28990123456789AB, 4x289a0123456789AB, 4x289b0123456789AB, 4x289c0123456789AB, 4x289d0123456789AB, 4x289e0123456789AB, 4x289f0123456789AB
+D325	DATA8[] 4x28a00123456789AB, 4x28a10123456789AB, 4x28a20123456789AB, 4x28a30123456789AB, 4x28a40123456789AB, 4x28a50123456789AB, 4x28a60123456789AB, 4x28a70123456789AB, 4x28a80123456789AB, 4x28a90123456789AB, 4x28aa0123456789AB, 4x28ab0123456789AB, 4x28ac0123456789AB, 4x28ad0123456789AB, 4x28ae0123456789AB, 4x28af0123456789AB, 4x28b00123456789AB, 4x28b10123456789AB, 4x28b20123456789AB, 4x28b30123456789AB, 4x28b40123456789AB, 4x28b50123456789AB, 4x28b60123456789AB, 4x28b70123456789AB, 4x28b80123456789AB, 4x28b90123456789AB, 4x28ba0123456789AB, 4x28bb0123456789AB, 4x28bc0123456789AB, 4x28bd0123456789AB, 4x28be0123456789AB, 4x28bf0123456789AB
+D326	DATA8[] 4x28c00123456789AB, 4x28c10123456789AB, 4x28c20123456789AB, 4x28c30123456789AB, 4x28c40123456789AB, 4x28c50123456789AB, 4x28c60123456789AB, 4x28c70123456789AB, 4x28c80123456789AB, 4x28c90123456789AB, 4x28ca0123456789AB, 4x28cb0123456789AB, 4x28cc0123456789AB, 4x28cd0123456789AB, 4x28ce0123456789AB, 4x28cf0123456789AB, 4x28d00123456789AB, 4x28d10123456789AB, 4x28d20123456789AB, 4x28d30123456789AB, 4x28d40123456789AB, 4x28d50123456789AB, 4x28d60123456789AB, 4x28d70123456789AB, 4x28d80123456789AB, 4x28d90123456789AB, 4x28da0123456789AB, 4x28db0123456789AB, 4x28dc0123456789AB, 4x28dd0123456789AB, 4x28de0123456789AB, 4x28df0123456789AB
+D327	DATA8[] 4x28e00123456789AB, 4x28e10123456789AB, 4x28e20123456789AB, 4x28e30123456789AB, 4x28e40123456789AB, 4x28e50123456789AB, 4x28e60123456789AB, 4x28e70123456789AB, 4x28e80123456789AB, 4x28e90123456789AB, 4x28ea0123456789AB, 4x28eb0123456789AB, 4x28ec0123456789AB, 4x28ed0123456789AB, 4x28ee0123456789AB, 4x28ef0123456789AB, 4x28f00123456789AB, 4x28f10123456789AB, 4x28f20123456789AB, 4x28f30123456789AB, 4x28f40123456789AB, 4x28f50123456789AB, 4x28f60123456789AB, 4x28f70123456789AB, 4x28f80123456789AB, 4x28f90123456789AB, 4x28fa0123456789AB, 4x28fb0123456789AB, 4x28fc0123456789AB, 4x28fd0123456789AB, 4x28fe0123456789AB, 4x28ff0123456789AB
+D328	DATA8[] 4x29000123456789AB, 4x29010123456789AB, 4x29020123456789AB, 4x29030123456789AB, 4x29040123456789AB, 4x29050123456789AB, 4x29060123456789AB, 4x29070123456789AB, 4x29080123456789AB, 4x29090123456789AB, 4x290a0123456789AB, 4x290b0123456789AB, 4x290c0123456789AB, 4x290d0123456789AB, 4x290e0123456789AB, 4x290f0123456789AB, 4x29100123456789AB, 4x29110123456789AB, 4x29120123456789AB, 4x29130123456789AB, 4x29140123456789AB, 4x29150123456789AB, 4x29160123456789AB, 4x29170123456789AB, 4x29180123456789AB, 4x29190123456789AB, 4x291a0123456789AB, 4x291b0123456789AB, 4x291c0123456789AB, 4x291d0123456789AB, 4x291e0123456789AB, 4x291f0123456789AB
+D329	DATA8[] 4x29200123456789AB, 4x29210123456789AB, 4x29220123456789AB, 4x29230123456789AB, 4x29240123456789AB, 4x29250123456789AB, 4x29260123456789AB, 4x29270123456789AB, 4x29280123456789AB, 4x29290123456789AB, 4x292a0123456789AB, 4x292b0123456789AB, 4x292c0123456789AB, 4x292d0123456789AB, 4x292e0123456789AB, 4x292f0123456789AB, 4x29300123456789AB, 4x29310123456789AB, 4x29320123456789AB, 4x29330123456789AB, 4x29340123456789AB, 4x29350123456789AB, 4x29360123456789AB, 4x29370123456789AB, 4x29380123456789AB, 4x29390123456789AB, 4x293a0123456789AB, 4x293b0123456789AB, 4x293c0123456789AB, 4x293d0123456789AB, 4x293e0123456789AB, 4x293f0123456789AB
+D330	DATA8[] 4x29400123456789AB, 4x29410123456789AB, 4x29420123456789AB, 4x29430123456789AB, 4x29440123456789AB, 4x29450123456789AB, 4x29460123456789AB, 4x29470123456789AB, 4x29480123456789AB, 4x29490123456789AB, 4x294a0123456789AB, 4x294b0123456789AB, 4x294c0123456789AB, 4x294d0123456789AB, 4x294e0123456789AB, 4x294f0123456789AB, 4x29500123456789AB, 4x29510123456789AB, 4x29520123456789AB, 4x29530123456789AB, 4x29540123456789AB, 4x29550123456789AB, 4x29560123456789AB, 4x29570123456789AB, 4x29580123456789AB, 4x29590123456789AB, 4x295a0123456789AB, 4x295b0123456789AB, 4x295c0123456789AB, 4x295d0123456789AB, 4x295e0123456789AB, 4x295f0123456789AB
+D331	DATA8[] 4x29600123456789AB, 4x29610123456789AB, 4x29620123456789AB, 4x29630123456789AB, 4x29640123456789AB, 4x29650123456789AB, 4x29660123456789AB, 4x29670123456789AB, 4x29680123456789AB, 4x29690123456789AB, 4x296a0123456789AB, 4x296b0123456789AB, 4x296c0123456789AB, 4x296d0123456789AB, 4x296e0123456789AB, 4x296f0123456789AB, 4x29700123456789AB, 4x29710123456789AB, 4x29720123456789AB, 4x29730123456789AB, 4x29740123456789AB, 4x29750123456789AB, 4x29760123456789AB, 4x29770123456789AB, 4x29780123456789AB, 4x29790123456789AB, 4x297a0123456789AB, 4x297b0123456789AB, 4x297c0123456789AB, 4x297d0123456789AB, 4x297e0123456789AB, 4x297f0123456789AB
+D332	DATA8[] 4x29800123456789AB, 4x29810123456789AB, 4x29820123456789AB, 4x29830123456789AB, 4x29840123456789AB, 4x29850123456789AB, 4x29860123456789AB, 4x29870123456789AB, 4x29880123456789AB, 4x29890123456789AB, 4x298a0123456789AB, 4x298b0123456789AB, 4x298c0123456789AB, 4x298d0123456789AB, 4x298e0123456789AB, 4x298f0123456789AB, 4x29900123456789AB, 4x29910123456789AB, 4x29920123456789AB, 4x29930123456789AB, 4x29940123456789AB, 4x29950123456789AB, 4x29960123456789AB, 4x29970123456789AB, 4x29980123456789AB, 4x29990123456789AB, 4x299a0123456789AB, 4x299b0123456789AB, 4x299c0123456789AB, 4x299d0123456789AB, 4x299e0123456789AB, 4x299f0123456789AB
+D333	DATA8[] 4x29a00123456789AB, 4x29a10123456789AB, 4x29a20123456789AB, 4x29a30123456789AB, 4x29a40123456789AB, 4x29a50123456789AB, 4x29a60123456789AB, 4x29a70123456789AB, 4x29a80123456789AB, 4x29a90123456789AB, 4x29aa0123456789AB, 4x29ab0123456789AB, 4x29ac0123456789AB, 4x29ad0123456789AB, 4x29ae0123456789AB, 4x29af0123456789AB, 4x29b00123456789AB, 4x29b10123456789AB, 4x29b20123456789AB, 4x29b30123456789AB, 4x29b40123456789AB, 4x29b50123456789AB, 4x29b60123456789AB, 4x29b70123456789AB, 4x29b80123456789AB, 4x29b90123456789AB, 4x29ba0123456789AB, 4x29bb0123456789AB, 4x29bc0123456789AB, 4x29bd0123456789AB, 4x29be0123456789AB, 4x29bf0123456789AB
+D334	DATA8[] 4x29c00123456789AB, 4x29c10123456789AB, 4x29c20123456789AB, 4x29c30123456789AB, 4x29c40123456789AB, 4x29c50123456789AB, 4x29c60123456789AB, 4x29c70123456789AB, 4x29c80123456789AB, 4x29c90123456789AB, 4x29ca0123456789AB, 4x29cb0123456789AB, 4x29cc0123456789AB, 4x29cd0123456789AB, 4x29ce0123456789AB, 4x29cf0123456789AB, 4x29d00123456789AB, 4x29d10123456789AB, 4x29d20123456789AB, 4x29d30123456789AB, 4x29d40123456789AB, 4x29d50123456789AB, 4x29d60123456789AB, 4x29d70123456789AB, 4x29d80123456789AB, 4x29d90123456789AB, 4x29da0123456789AB, 4x29db0123456789AB, 4x29dc0123456789AB, 4x29dd0123456789AB, 4x29de0123456789AB, 4x29df0123456789AB
+D335	DATA8[] 4x29e00123456789AB, 4x29e10123456789AB, 4x29e20123456789AB, 4x29e30123456789AB, 4x29e40123456789AB, 4x29e50123456789AB, 4x29e60123456789AB, 4x29e70123456789AB, 4x29e80123456789AB, 4x29e90123456789AB, 4x29ea0123456789AB, 4x29eb0123456789AB, 4x29ec0123456789AB, 4x29ed0123456789AB, 4x29ee0123456789AB, 4x29ef0123456789AB, 4x29f00123456789AB, 4x29f10123456789AB, 4x29f20123456789AB, 4x29f30123456789AB, 4x29f40123456789AB, 4x29f50123456789AB, 4x29f60123456789AB, 4x29f70123456789AB, 4x29f80123456789AB, 4x29f90123456789AB, 4x29fa0123456789AB, 4x29fb0123456789AB, 4x29fc0123456789AB, 4x29fd0123456789AB, 4x29fe0123456789AB, 4x29ff0123456789AB
+D336	DATA8[] 4x2a000123456789AB, 4x2a010123456789AB, 4x2a020123456789AB, 4x2a030123456789AB, 4x2a040123456789AB, 4x2a050123456789AB, 4x2a060123456789AB, 4x2a070123456789AB, 4x2a080123456789AB, 4x2a090123456789AB, 4x2a0a0123456789AB, 4x2a0b0123456789AB, 4x2a0c0123456789AB, 4x2a0d0123456789AB, 4x2a0e0123456789AB, 4x2a0f0123456789AB, 4x2a100123456789AB, 4x2a110123456789AB, 4x2a120123456789AB, 4x2a130123456789AB, 4x2a140123456789AB, 4x2a150123456789AB, 4x2a160123456789AB, 4x2a170123456789AB, 4x2a180123456789AB, 4x2a190123456789AB, 4x2a1a0123456789AB, 4x2a1b0123456789AB, 4x2a1c0123456789AB, 4x2a1d0123456789AB, 4x2a1e0123456789AB, 4x2a1f0123456789AB
+D337	DATA8[] 4x2a200123456789AB, 4x2a210123456789AB, 4x2a220123456789AB, 4x2a230123456789AB, 4x2a240123456789AB, 4x2a250123456789AB, 4x2a260123456789AB, 4x2a270123456789AB, 4x2a280123456789AB, 4x2a290123456789AB, 4x2a2a0123456789AB, 4x2a2b0123456789AB, 4x2a2c0123456789AB, 4x2a2d0123456789AB, 4x2a2e0123456789AB, 4x2a2f0123456789AB, 4x2a300123456789AB, 4x2a310123456789AB, 4x2a320123456789AB, 4x2a330123456789AB, 4x2a340123456789AB, 4x2a350123456789AB, 4x2a360123456789AB, 4x2a370123456789AB, 4x2a380123456789AB, 4x2a390123456789AB, 4x2a3a0123456789AB, 4x2a3b0123456789AB, 4x2a3c0123456789AB, 4x2a3d0123456789AB, 4x2a3e0123456789AB, 4x2a3f0123456789AB
+D338	DATA8[] 4x2a400123456789AB, 4x2a410123456789AB, 4x2a420123456789AB, 4x2a430123456789AB, 4x2a440123456789AB, 4x2a450123456789AB, 4x2a460123456789AB, 4x2a470123456789AB, 4x2a480123456789AB, 4x2a490123456789AB, 4x2a4a0123456789AB, 4x2a4b0123456789AB, 4x2a4c0123456789AB, 4x2a4d0123456789AB, 4x2a4e0123456789AB, 4x2a4f0123456789AB, 4x2a500123456789AB, 4x2a510123456789AB, 4x2a520123456789AB, 4x2a530123456789AB, 4x2a540123456789AB, 4x2a550123456789AB, 4x2a560123456789AB, 4x2a570123456789AB, 4x2a580123456789AB, 4x2a590123456789AB, 4x2a5a0123456789AB, 4x2a5b0123456789AB, 4x2a5c0123456789AB, 4x2a5d0123456789AB, 4x2a5e0123456789AB, 4x2a5f0123456789AB
+D339	DATA8[] 4x2a600123456789AB, 4x2a610123456789AB, 4x2a620123456789AB, 4x2a630123456789AB, 4x2a640123456789AB, 4x2a650123456789AB, 4x2a660123456789AB, 4x2a670123456789AB, 4x2a680123456789AB, 4x2a690123456789AB, 4x2a6a0123456789AB, 4x2a6b0123456789AB, 4x2a6c0123456789AB, 4x2a6d0123456789AB, 4x2a6e0123456789AB, 4x2a6f0123456789AB, 4x2a700123456789AB, 4x2a710123456789AB, 4x2a720123456789AB, 4x2a730123456789AB, 4x2a740123456789AB, 4x2a750123456789AB, 4x2a760123456789AB, 4x2a770123456789AB, 4x2a780123456789AB, 4x2a790123456789AB, 4x2a7a0123456789AB, 4x2a7b0123456789AB, 4x2a7c0123456789AB, 4x2a7d0123456789AB, 4x2a7e0123456789AB, 4x2a7f0123456789AB
+D340	DATA8[] 4x2a800123456789AB, 4x2a810123456789AB, 4x2a820123456789AB, 4x2a830123456789AB, 4x2a840123456789AB, 4x2a850123456789AB, 4x2a860123456789AB, 4x2a870123456789AB, 4x2a880123456789AB, 4x2a890123456789AB, 4x2a8a0123456789AB, 4x2a8b0123456789AB, 4x2a8c0123456789AB, 4x2a8d0123456789AB, 4x2a8e0123456789AB, 4x2a8f0123456789AB, 4x2a900123456789AB, 4x2a910123456789AB, 4x2a920123456789AB, 4x2a930123456789AB, 4x2a940123456789AB, 4x2a950123456789AB, 4x2a960123456789AB, 4x2a970123456789AB, 4x2a980123456789AB, 4x2a990123456789AB, 4x2a9a0123456789AB, 4x2a9b0123456789AB, 4x2a9c0123456789AB, 4x2a9d0123456789AB, 4x2a9e0123456789AB, 4x2a9f0123456789AB
+D341	DATA8[] 4x2aa00123456789AB, 4x2aa10123456789AB, 4x2aa20123456789AB, 4x2aa30123456789AB, 4x2aa40123456789AB, 4x2aa50123456789AB, 4x2aa60123456789AB, 4x2aa70123456789AB, 4x2aa80123456789AB, 4x2aa90123456789AB, 4x2aaa0123456789AB, 4x2aab0123456789AB, 4x2aac0123456789AB, 4x2aad0123456789AB, 4x2aae0123456789AB, 4x2aaf0123456789AB, 4x2ab00123456789AB, 4x2ab10123456789AB, 4x2ab20123456789AB, 4x2ab30123456789AB, 4x2ab40123456789AB, 4x2ab50123456789AB, 4x2ab60123456789AB, 4x2ab70123456789AB, 4x2ab80123456789AB, 4x2ab90123456789AB, 4x2aba0123456789AB, 4x2abb0123456789AB, 4x2abc0123456789AB, 4x2abd0123456789AB, 4x2abe0123456789AB, 4x2abf0123456789AB
+D342	DATA8[] 4x2ac00123456789AB, 4x2ac10123456789AB, 4x2ac20123456789AB, 4x2ac30123456789AB, 4x2ac40123456789AB, 4x2ac50123456789AB, 4x2ac60123456789AB, 4x2ac70123456789AB, 4x2ac80123456789AB, 4x2ac90123456789AB, 4x2aca0123456789AB, 4x2acb0123456789AB, 4x2acc0123456789AB, 4x2acd0123456789AB, 4x2ace0123456789AB, 4x2acf0123456789AB, 4x2ad00123456789AB, 4x2ad10123456789AB, 4x2ad20123456789AB, 4x2ad30123456789AB, 4x2ad40123456789AB, 4x2ad50123456789AB, 4x2ad60123456789AB, 4x2ad70123456789AB, 4x2ad80123456789AB, 4x2ad90123456789AB, 4x2ada0123456789AB, 4x2adb0123456789AB, 4x2adc0123456789AB, 4x2add0123456789AB, 4x2ade0123456789AB, 4x2adf0123456789AB
+D343	DATA8[] 4x2ae00123456789AB, 4x2ae10123456789AB, 4x2ae20123456789AB, 4x2ae30123456789AB, 4x2ae40123456789AB, 4x2ae50123456789AB, 4x2ae60123456789AB, 4x2ae70123456789AB, 4x2ae80123456789AB, 4x2ae90123456789AB, 4x2aea0123456789AB, 4x2aeb0123456789AB, 4x2aec0123456789AB, 4x2aed0123456789AB, 4x2aee0123456789AB, 4x2aef0123456789AB, 4x2af00123456789AB, 4x2af10123456789AB, 4x2af20123456789AB, 4x2af30123456789AB, 4x2af40123456789AB, 4x2af50123456789AB, 4x2af60123456789AB, 4x2af70123456789AB, 4x2af80123456789AB, 4x2af90123456789AB, 4x2afa0123456789AB, 4x2afb0123456789AB, 4x2afc0123456789AB, 4x2afd0123456789AB, 4x2afe0123456789AB, 4x2aff0123456789AB
+D344	DATA8[] 4x2b000123456789AB, 4x2b010123456789AB, 4x2b020123456789AB, 4x2b030123456789AB, 4x2b040123456789AB, 4x2b050123456789AB, 4x2b060123456789AB, 4x2b070123456789AB, 4x2b080123456789AB, 4x2b090123456789AB, 4x2b0a0123456789AB, 4x2b0b0123456789AB, 4x2b0c0123456789AB, 4x2b0d0123456789AB, 4x2b0e0123456789AB, 4x2b0f0123456789AB, 4x2b100123456789AB, 4x2b110123456789AB, 4x2b120123456789AB, 4x2b130123456789AB, 4x2b140123456789AB, 4x2b150123456789AB, 4x2b160123456789AB, 4x2b170123456789AB, 4x2b180123456789AB, 4x2b190123456789AB, 4x2b1a0123456789AB, 4x2b1b0123456789AB, 4x2b1c0123456789AB, 4x2b1d0123456789AB, 4x2b1e0123456789AB, 4x2b1f0123456789AB
+D345	DATA8[] 4x2b200123456789AB, 4x2b210123456789AB, 4x2b220123456789AB, 4x2b230123456789AB, 4x2b240123456789AB, 4x2b250123456789AB, 4x2b260123456789AB, 4x2b270123456789AB, 4x2b280123456789AB, 4x2b290123456789AB, 4x2b2a0123456789AB, 4x2b2b0123456789AB, 4x2b2c0123456789AB, 4x2b2d0123456789AB, 4x2b2e0123456789AB, 4x2b2f0123456789AB, 4x2b300123456789AB, 4x2b310123456789AB, 4x2b320123456789AB, 4x2b330123456789AB, 4x2b340123456789AB, 4x2b350123456789AB, 4x2b360123456789AB, 4x2b370123456789AB, 4x2b380123456789AB, 4x2b390123456789AB, 4x2b3a0123456789AB, 4x2b3b0123456789AB, 4x2b3c0123456789AB, 4x2b3d0123456789AB, 4x2b3e0123456789AB, 4x2b3f0123456789AB
+D346	DATA8[] 4x2b400123456789AB, 4x2b410123456789AB, 4x2b420123456789AB, 4x2b430123456789AB, 4x2b440123456789AB, 4x2b450123456789AB, 4x2b460123456789AB, 4x2b470123456789AB, 4x2b480123456789AB, 4x2b490123456789AB, 4x2b4a0123456789AB, 4x2b4b0123456789AB, 4x2b4c0123456789AB, 4x2b4d0123456789AB, 4x2b4e0123456789AB, 4x2b4f0123456789AB, 4x2b500123456789AB, 4x2b510123456789AB, 4x2b520123456789AB, 4x2b530123456789AB, 4x2b540123456789AB, 4x2b550123456789AB, 4x2b560123456789AB, 4x2b570123456789AB, 4x2b580123456789AB, 4x2b590123456789AB, 4x2b5a0123456789AB, 4x2b5b0123456789AB, 4x2b5c0123456789AB, 4x2b5d0123456789AB, 4x2b5e0123456789AB, 4x2b5f0123456789AB
+D347	DATA8[] 4x2b600123456789AB, 4x2b610123456789AB, 4x2b620123456789AB, 4x2b630123456789AB, 4x2b640123456789AB, 4x2b650123456789AB, 4x2b660123456789AB, 4x2b670123456789AB, 4x2b680123456789AB, 4x2b690123456789AB, 4x2b6a0123456789AB, 4x2b6b0123456789AB, 4x2b6c0123456789AB, 4x2b6d0123456789AB, 4x2b6e0123456789AB, 4x2b6f0123456789AB, 4x2b700123456789AB, 4x2b710123456789AB, 4x2b720123456789AB, 4x2b730123456789AB, 4x2b740123456789AB, 4x2b750123456789AB, 4x2b760123456789AB, 4x2b770123456789AB, 4x2b780123456789AB, 4x2b790123456789AB, 4x2b7a0123456789AB, 4x2b7b0123456789AB, 4x2b7c0123456789AB, 4x2b7d0123456789AB, 4x2b7e0123456789AB, 4x2b7f0123456789AB
+D348	DATA8[] 4x2b800123456789AB, 4x2b810123456789AB, 4x2b820123456789AB, 4x2b830123456789AB, 4x2b840123456789AB, 4x2b850123456789AB, 4x2b860123456789AB, 4x2b870123456789AB, 4x2b880123456789AB, 4x2b890123456789AB, 4x2b8a0123456789AB, 4x2b8b0123456789AB, 4x2b8c0123456789AB, 4x2b8d0123456789AB, 4x2b8e0123456789AB, 4x2b8f0123456789AB, 4x2b900123456789AB, 4x2b910123456789AB, 4x2b920123456789AB, 4x2b930123456789AB, 4x2b940123456789AB, 4x2b950123456789AB, 4x2b960123456789AB, 4x2b970123456789AB, 4x2b980123456789AB, 4x2b990123456789AB, 4x2b9a0123456789AB, 4x2b9b0123456789AB, 4x2b9c0123456789AB, 4x2b9d0123456789AB, 4x2b9e0123456789AB, 4x2b9f0123456789AB
+D349	DATA8[] 4x2ba00123456789AB, 4x2ba10123456789AB, 4x2ba20123456789AB, 4x2ba30123456789AB, 4x2ba40123456789AB, 4x2ba50123456789AB, 4x2ba60123456789AB, 4x2ba70123456789AB, 4x2ba80123456789AB, 4x2ba90123456789AB, 4x2baa0123456789AB, 4x2bab0123456789AB, 4x2bac0123456789AB, 4x2bad0123456789AB, 4x2bae0123456789AB, 4x2baf0123456789AB, 4x2bb00123456789AB, 4x2bb10123456789AB, 4x2bb20123456789AB, 4x2bb30123456789AB, 4x2bb40123456789AB, 4x2bb50123456789AB, 4x2bb60123456789AB, 4x2bb70123456789AB, 4x2bb80123456789AB, 4x2bb90123456789AB, 4x2bba0123456789AB, 4x2bbb0123456789AB, 4x2bbc0123456789AB, 4x2bbd0123456789AB, 4x2bbe0123456789AB, 4x2bbf0123456789AB
+D350	DATA8[] 4x2bc00123456789AB, 4x2bc10123456789AB, 4x2bc20123456789AB, 4x2bc30123456789AB, 4x2bc40123456789AB, 4x2bc50123456789AB, 4x2bc60123456789AB, 4x2bc70123456789AB, 4x2bc80123456789AB, 4x2bc90123456789AB, 4x2bca0123456789AB, 4x2bcb0123456789AB, 4x2bcc0123456789AB, 4x2bcd0123456789AB, 4x2bce0123456789AB, 4x2bcf0123456789AB, 4x2bd00123456789AB, 4x2bd10123456789AB, 4x2bd20123456789AB, 4x2bd30123456789AB, 4x2bd40123456789AB, 4x2bd50123456789AB, 4x2bd60123456789AB, 4x2bd70123456789AB, 4x2bd80123456789AB, 4x2bd90123456789AB, 4x2bda0123456789AB, 4x2bdb0123456789AB, 4x2bdc0123456789AB, 4x2bdd0123456789AB, 4x2bde0123456789AB, 4x2bdf0123456789AB
+D351	DATA8[] 4x2be00123456789AB, 4x2be10123456789AB, 4x2be20123456789AB, 4x2be30123456789AB, 4x2be40123456789AB, 4x2be50123456789AB, 4x2be60123456789AB, 4x2be70123456789AB, 4x2be80123456789AB, 4x2be90123456789AB, 4x2bea0123456789AB, 4x2beb0123456789AB, 4x2bec0123456789AB, 4x2bed0123456789AB, 4x2bee0123456789AB, 4x2bef0123456789AB, 4x2bf00123456789AB, 4x2bf10123456789AB, 4x2bf20123456789AB, 4x2bf30123456789AB, 4x2bf40123456789AB, 4x2bf50123456789AB, 4x2bf60123456789AB, 4x2bf70123456789AB, 4x2bf80123456789AB, 4x2bf90123456789AB, 4x2bfa0123456789AB, 4x2bfb0123456789AB, 4x2bfc0123456789AB, 4x2bfd0123456789AB, 4x2bfe0123456789AB, 4x2bff0123456789AB
+D352	DATA8[] 4x2c000123456789AB, 4x2c010123456789AB, 4x2c020123456789AB, 4x2c030123456789AB, 4x2c040123456789AB, 4x2c050123456789AB, 4x2c060123456789AB, 4x2c070123456789AB, 4x2c080123456789AB, 4x2c090123456789AB, 4x2c0a0123456789AB, 4x2c0b0123456789AB, 4x2c0c0123456789AB, 4x2c0d0123456789AB, 4x2c0e0123456789AB, 4x2c0f0123456789AB, 4x2c100123456789AB, 4x2c110123456789AB, 4x2c120123456789AB, 4x2c130123456789AB, 4x2c140123456789AB, 4x2c150123456789AB, 4x2c160123456789AB, 4x2c170123456789AB, 4x2c180123456789AB, 4x2c190123456789AB, 4x2c1a0123456789AB, 4x2c1b0123456789AB, 4x2c1c0123456789AB, 4x2c1d0123456789AB, 4x2c1e0123456789AB, 4x2c1f0123456789AB
+D353	DATA8[] 4x2c200123456789AB, 4x2c210123456789AB, 4x2c220123456789AB, 4x2c230123456789AB, 4x2c240123456789AB, 4x2c250123456789AB, 4x2c260123456789AB, 4x2c270123456789AB, 4x2c280123456789AB, 4x2c290123456789AB, 4x2c2a0123456789AB, 4x2c2b0123456789AB, 4x2c2c0123456789AB, 4x2c2d0123456789AB, 4x2c2e0123456789AB, 4x2c2f0123456789AB, 4x2c300123456789AB, 4x2c310123456789AB, 4x2c320123456789AB, 4x2c330123456789AB, 4x2c340123456789AB, 4x2c350123456789AB, 4x2c360123456789AB, 4x2c370123456789AB, 4x2c380123456789AB, 4x2c390123456789AB, 4x2c3a0123456789AB, 4x2c3b0123456789AB, 4x2c3c0123456789AB, 4x2c3d0123456789AB, 4x2c3e0123456789AB, 4x2c3f0123456789AB
+D354	DATA8[] 4x2c400123456789AB, 4x2c410123456789AB, 4x2c420123456789AB, 4x2c430123456789AB, 4x2c440123456789AB, 4x2c450123456789AB, 4x2c460123456789AB, 4x2c470123456789AB, 4x2c480123456789AB, 4x2c490123456789AB, 4x2c4a0123456789AB, 4x2c4b0123456789AB, 4x2c4c0123456789AB, 4x2c4d0123456789AB, 4x2c4e0123456789AB, 4x2c4f0123456789AB, 4x2c500123456789AB, 4x2c510123456789AB, 4x2c520123456789AB, 4x2c530123456789AB, 4x2c540123456789AB, 4x2c550123456789AB, 4x2c560123456789AB, 4x2c570123456789AB, 4x2c580123456789AB, 4x2c590123456789AB, 4x2c5a0123456789AB, 4x2c5b0123456789AB, 4x2c5c0123456789AB, 4x2c5d0123456789AB, 4x2c5e0123456789AB, 4x2c5f0123456789AB
+D355	DATA8[] 4x2c600123456789AB, 4x2c610123456789AB, 4x2c620123456789AB, 4x2c630123456789AB, 4x2c640123456789AB, 4x2c650123456789AB, 4x2c660123456789AB, 4x2c670123456789AB, 4x2c680123456789AB, 4x2c690123456789AB, 4x2c6a0123456789AB, 4x2c6b0123456789AB, 4x2c6c0123456789AB, 4x2c6d0123456789AB, 4x2c6e0123456789AB, 4x2c6f0123456789AB, 4x2c700123456789AB, 4x2c710123456789AB, 4x2c720123456789AB, 4x2c730123456789AB, 4x2c740123456789AB, 4x2c750123456789AB, 4x2c760123456789AB, 4x2c770123456789AB, 4x2c780123456789AB, 4x2c790123456789AB, 4x2c7a0123456789AB, 4x2c7b0123456789AB, 4x2c7c0123456789AB, 4x2c7d0123456789AB, 4x2c7e0123456789AB, 4x2c7f0123456789AB
+D356	DATA8[] 4x2c800123456789AB, 4x2c810123456789AB, 4x2c820123456789AB, 4x2c830123456789AB, 4x2c840123456789AB, 4x2c850123456789AB, 4x2c860123456789AB, 4x2c870123456789AB, 4x2c880123456789AB, 4x2c890123456789AB, 4x2c8a0123456789AB, 4x2c8b0123456789AB, 4x2c8c0123456789AB, 4x2c8d0123456789AB, 4x2c8e0123456789AB, 4x2c8f0123456789AB, 4x2c900123456789AB, 4x2c910123456789AB, 4x2c920123456789AB, 4x2c930123456789AB, 4x2c940123456789AB, 4x2c950123456789AB, 4x2c960123456789AB, 4x2c970123456789AB, 4x2c980123456789AB, 4x2c990123456789AB, 4x2c9a0123456789AB, 4x2c9b0123456789AB, 4x2c9c0123456789AB, 4x2c9d0123456789AB, 4x2c9e0123456789AB, 4x2c9f0123456789AB
+D357	DATA8[] 4x2ca00123456789AB, 4x2ca10123456789AB, 4x2ca20123456789AB, 4x2ca30123456789AB, 4x2ca40123456789AB, 4x2ca50123456789AB, 4x2ca60123456789AB, 4x2ca70123456789AB, 4x2ca80123456789AB, 4x2ca90123456789AB, 4x2caa0123456789AB, 4x2cab0123456789AB, 4x2cac0123456789AB, 4x2cad0123456789AB, 4x2cae0123456789AB, 4x2caf0123456789AB, 4x2cb00123456789AB, 4x2cb10123456789AB, 4x2cb20123456789AB, 4x2cb30123456789AB, 4x2cb40123456789AB, 4x2cb50123456789AB, 4x2cb60123456789AB, 4x2cb70123456789AB, 4x2cb80123456789AB, 4x2cb90123456789AB, 4x2cba0123456789AB, 4x2cbb0123456789AB, 4x2cbc0123456789AB, 4x2cbd0123456789AB, 4x2cbe0123456789AB, 4x2cbf0123456789AB
+D358	DATA8[] 4x2cc00123456789AB, 4x2cc10123456789AB, 4x2cc20123456789AB, 4x2cc30123456789AB, 4x2cc40123456789AB, 4x2cc50123456789AB, 4x2cc60123456789AB, 4x2cc70123456789AB, 4x2cc80123456789AB, 4x2cc90123456789AB, 4x2cca0123456789AB, 4x2ccb0123456789AB, 4x2ccc0123456789AB, 4x2ccd0123456789AB, 4x2cce0123456789AB, 4x2ccf0123456789AB, 4x2cd00123456789AB, 4x2cd10123456789AB, 4x2cd20123456789AB, 4x2cd30123456789AB, 4x2cd40123456789AB, 4x2cd50123456789AB, 4x2cd60123456789AB, 4x2cd70123456789AB, 4x2cd80123456789AB, 4x2cd90123456789AB, 4x2cda0123456789AB, 4x2cdb0123456789AB, 4x2cdc0123456789AB, 4x2cdd0123456789AB, 4x2cde0123456789AB, 4x2cdf0123456789AB
+D359	DATA8[] 4x2ce00123456789AB, 4x2ce10123456789AB, 4x2ce20123456789AB, 4x2ce30123456789AB, 4x2ce40123456789AB, 4x2ce50123456789AB, 4x2ce60123456789AB, 4x2ce70123456789AB, 4x2ce80123456789AB, 4x2ce90123456789AB, 4x2cea0123456789AB, 4x2ceb0123456789AB, 4x2cec0123456789AB, 4x2ced0123456789AB, 4x2cee0123456789AB, 4x2cef0123456789AB, 4x2cf00123456789AB, 4x2cf10123456789AB, 4x2cf20123456789AB, 4x2cf30123456789AB, 4x2cf40123456789AB, 4x2cf50123456789AB, 4x2cf60123456789AB, 4x2cf70123456789AB, 4x2cf80123456789AB, 4x2cf90123456789AB, 4x2cfa0123456789AB, 4x2cfb0123456789AB, 4x2cfc0123456789AB, 4x2cfd0123456789AB, 4x2cfe0123456789AB, 4x2cff0123456789AB
+D360	DATA8[] 4x2d000123456789AB, 4x2d010123456789AB, 4x2d020123456789AB, 4x2d030123456789AB, 4x2d040123456789AB, 4x2d050123456789AB, 4x2d060123456789AB, 4x2d070123456789AB, 4x2d080123456789AB, 4x2d090123456789AB, 4x2d0a0123456789AB, 4x2d0b0123456789AB, 4x2d0c0123456789AB, 4x2d0d0123456789AB, 4x2d0e0123456789AB, 4x2d0f0123456789AB, 4x2d100123456789AB, 4x2d110123456789AB, 4x2d120123456789AB, 4x2d130123456789AB, 4x2d140123456789AB, 4x2d150123456789AB, 4x2d160123456789AB, 4x2d170123456789AB, 4x2d180123456789AB, 4x2d190123456789AB, 4x2d1a0123456789AB, 4x2d1b0123456789AB, 4x2d1c0123456789AB, 4x2d1d0123456789AB, 4x2d1e0123456789AB, 4x2d1f0123456789AB
+D361	DATA8[] 4x2d200123456789AB, 4x2d210123456789AB, 4x2d220123456789AB, 4x2d230123456789AB, 4x2d240123456789AB, 4x2d250123456789AB, 4x2d260123456789AB, 4x2d270123456789AB, 4x2d280123456789AB, 4x2d290123456789AB, 4x2d2a0123456789AB, 4x2d2b0123456789AB, 4x2d2c0123456789AB, 4x2d2d0123456789AB, 4x2d2e0123456789AB, 4x2d2f0123456789AB, 4x2d300123456789AB, 4x2d310123456789AB, 4x2d320123456789AB, 4x2d330123456789AB, 4x2d340123456789AB, 4x2d350123456789AB, 4x2d360123456789AB, 4x2d370123456789AB, 4x2d380123456789AB, 4x2d390123456789AB, 4x2d3a0123456789AB, 4x2d3b0123456789AB, 4x2d3c0123456789AB, 4x2d3d0123456789AB, 4x2d3e0123456789AB, 4x2d3f0123456789AB
+D362	DATA8[] 4x2d400123456789AB, 4x2d410123456789AB, 4x2d420123456789AB, 4x2d430123456789AB, 4x2d440123456789AB, 4x2d450123456789AB, 4x2d460123456789AB, 4x2d470123456789AB, 4x2d480123456789AB, 4x2d490123456789AB, 4x2d4a0123456789AB, 4x2d4b0123456789AB, 4x2d4c0123456789AB, 4x2d4d0123456789AB, 4x2d4e0123456789AB, 4x2d4f0123456789AB, 4x2d500123456789AB, 4x2d510123456789AB, 4x2d520123456789AB, 4x2d530123456789AB, 4x2d540123456789AB, 4x2d550123456789AB, 4x2d560123456789AB, 4x2d570123456789AB, 4x2d580123456789AB, 4x2d590123456789AB, 4x2d5a0123456789AB, 4x2d5b0123456789AB, 4x2d5c0123456789AB, 4x2d5d0123456789AB, 4x2d5e0123456789AB, 4x2d5f0123456789AB
+D363	DATA8[] 4x2d600123456789AB, 4x2d610123456789AB, 4x2d620123456789AB, 4x2d630123456789AB, 4x2d640123456789AB, 4x2d650123456789AB, 4x2d660123456789AB, 4x2d670123456789AB, 4x2d680123456789AB, 4x2d690123456789AB, 4x2d6a0123456789AB, 4x2d6b0123456789AB, 4x2d6c0123456789AB, 4x2d6d0123456789AB, 4x2d6e0123456789AB, 4x2d6f0123456789AB, 4x2d700123456789AB, 4x2d710123456789AB, 4x2d720123456789AB, 4x2d730123456789AB, 4x2d740123456789AB, 4x2d750123456789AB, 4x2d760123456789AB, 4x2d770123456789AB, 4x2d780123456789AB, 4x2d790123456789AB, 4x2d7a0123456789AB, 4x2d7b0123456789AB, 4x2d7c0123456789AB, 4x2d7d0123456789AB, 4x2d7e0123456789AB, 4x2d7f0123456789AB
+D364	DATA8[] 4x2d800123456789AB, 4x2d810123456789AB, 4x2d820123456789AB, 4x2d830123456789AB, 4x2d840123456789AB, 4x2d850123456789AB, 4x2d860123456789AB, 4x2d870123456789AB, 4x2d880123456789AB, 4x2d890123456789AB, 4x2d8a0123456789AB, 4x2d8b0123456789AB, 4x2d8c0123456789AB, 4x2d8d0123456789AB, 4x2d8e0123456789AB, 4x2d8f0123456789AB, 4x2d900123456789AB, 4x2d910123456789AB, 4x2d920123456789AB, 4x2d930123456789AB, 4x2d940123456789AB, 4x2d950123456789AB, 4x2d960123456789AB, 4x2d970123456789AB, 4x2d980123456789AB, 4x2d990123456789AB, 4x2d9a0123456789AB, 4x2d9b0123456789AB, 4x2d9c0123456789AB, 4x2d9d0123456789AB, 4x2d9e0123456789AB, 4x2d9f0123456789AB
+D365	DATA8[] 4x2da00123456789AB, 4x2da10123456789AB, 4x2da20123456789AB, 4x2da30123456789AB, 4x2da40123456789AB, 4x2da50123456789AB, 4x2da60123456789AB, 4x2da70123456789AB, 4x2da80123456789AB, 4x2da90123456789AB, 4x2daa0123456789AB, 4x2dab0123456789AB, 4x2dac0123456789AB, 4x2dad0123456789AB, 4x2dae0123456789AB, 4x2daf0123456789AB, 4x2db00123456789AB, 4x2db10123456789AB, 4x2db20123456789AB, 4x2db30123456789AB, 4x2db40123456789AB, 4x2db50123456789AB, 4x2db60123456789AB, 4x2db70123456789AB, 4x2db80123456789AB, 4x2db90123456789AB, 4x2dba0123456789AB, 4x2dbb0123456789AB, 4x2dbc0123456789AB, 4x2dbd0123456789AB, 4x2dbe0123456789AB, 4x2dbf0123456789AB
+D366	DATA8[] 4x2dc00123456789AB, 4x2dc10123456789AB, 4x2dc20123456789AB, 4x2dc30123456789AB, 4x2dc40123456789AB, 4x2dc50123456789AB, 4x2dc60123456789AB, 4x2dc70123456789AB, 4x2dc80123456789AB, 4x2dc90123456789AB, 4x2dca0123456789AB, 4x2dcb0123456789AB, 4x2dcc0123456789AB, 4x2dcd0123456789AB, 4x2dce0123456789AB, 4x2dcf0123456789AB, 4x2dd00123456789AB, 4x2dd10123456789AB, 4x2dd20123456789AB, 4x2dd30123456789AB, 4x2dd40123456789AB, 4x2dd50123456789AB, 4x2dd60123456789AB, 4x2dd70123456789AB, 4x2dd80123456789AB, 4x2dd90123456789AB, 4x2dda0123456789AB, 4x2ddb0123456789AB, 4x2ddc0123456789AB, 4x2ddd0123456789AB, 4x2dde0123456789AB, 4x2ddf0123456789AB
+D367	DATA8[] 4x2de00123456789AB, 4x2de10123456789AB, 4x2de20123456789AB, 4x2de30123456789AB, 4x2de40123456789AB, 4x2de50123456789AB, 4x2de60123456789AB, 4x2de70123456789AB, 4x2de80123456789AB, 4x2de90123456789AB, 4x2dea0123456789AB, 4x2deb0123456789AB, 4x2dec0123456789AB, 4x2ded0123456789AB, 4x2dee0123456789AB, 4x2def0123456789AB, 4x2df00123456789AB, 4x2df10123456789AB, 4x2df20123456789AB, 4x2df30123456789AB, 4x2df40123456789AB, 4x2df50123456789AB, 4x2df60123456789AB, 4x2df70123456789AB, 4x2df80123456789AB, 4x2df90123456789AB, 4x2dfa0123456789AB, 4x2dfb0123456789AB, 4x2dfc0123456789AB, 4x2dfd0123456789AB, 4x2dfe0123456789AB, 4x2dff0123456789AB
+D368	DATA8[] 4x2e000123456789AB, 4x2e010123456789AB, 4x2e020123456789AB, 4x2e030123456789AB, 4x2e040123456789AB, 4x2e050123456789AB, 4x2e060123456789AB, 4x2e070123456789AB, 4x2e080123456789AB, 4x2e090123456789AB, 4x2e0a0123456789AB, 4x2e0b0123456789AB, 4x2e0c0123456789AB, 4x2e0d0123456789AB, 4x2e0e0123456789AB, 4x2e0f0123456789AB, 4x2e100123456789AB, 4x2e110123456789AB, 4x2e120123456789AB, 4x2e130123456789AB, 4x2e140123456789AB, 4x2e150123456789AB, 4x2e160123456789AB, 4x2e170123456789AB, 4x2e180123456789AB, 4x2e190123456789AB, 4x2e1a0123456789AB, 4x2e1b0123456789AB, 4x2e1c0123456789AB, 4x2e1d0123456789AB, 4x2e1e0123456789AB, 4x2e1f0123456789AB
+D369	DATA8[] 4x2e200123456789AB, 4x2e210123456789AB, 4x2e220123456789AB, 4x2e230123456789AB, 4x2e240123456789AB, 4x2e250123456789AB, 4x2e260123456789AB, 4x2e270123456789AB, 4x2e280123456789AB, 4x2e290123456789AB, 4x2e2a0123456789AB, 4x2e2b0123456789AB, 4x2e2c0123456789AB, 4x2e2d0123456789AB, 4x2e2e0123456789AB, 4x2e2f0123456789AB, 4x2e300123456789AB, 4x2e310123456789AB, 4x2e320123456789AB, 4x2e330123456789AB, 4x2e340123456789AB, 4x2e350123456789AB, 4x2e360123456789AB, 4x2e370123456789AB, 4x2e380123456789AB, 4x2e390123456789AB, 4x2e3a0123456789AB, 4x2e3b0123456789AB, 4x2e3c0123456789AB, 4x2e3d0123456789AB, 4x2e3e0123456789AB, 4x2e3f0123456789AB
+D370	DATA8[] 4x2e400123456789AB, 4x2e410123456789AB, 4x2e420123456789AB, 4x2e430123456789AB, 4x2e440123456789AB, 4x2e450123456789AB, 4x2e460123456789AB, 4x2e470123456789AB, 4x2e480123456789AB, 4x2e490123456789AB, 4x2e4a0123456789AB, 4x2e4b0123456789AB, 4x2e4c0123456789AB, 4x2e4d0123456789AB, 4x2e4e0123456789AB, 4x2e4f0123456789AB, 4x2e500123456789AB, 4x2e510123456789AB, 4x2e520123456789AB, 4x2e530123456789AB, 4x2e540123456789AB, 4x2e550123456789AB, 4x2e560123456789AB, 4x2e570123456789AB, 4x2e580123456789AB, 4x2e590123456789AB, 4x2e5a0123456789AB, 4x2e5b0123456789AB, 4x2e5c0123456789AB, 4x2e5d0123456789AB, 4x2e5e0123456789AB, 4x2e5f0123456789AB
+D371	DATA8[] 4x2e600123456789AB, 4x2e610123456789AB, 4x2e620123456789AB, 4x2e630123456789AB, 4x2e640123456789AB, 4x2e650123456789AB, 4x2e660123456789AB, 4x2e670123456789AB, 4x2e680123456789AB, 4x2e690123456789AB, 4x2e6a0123456789AB, 4x2e6b0123456789AB, 4x2e6c0123456789AB, 4x2e6d0123456789AB, 4x2e6e0123456789AB, 4x2e6f0123456789AB, 4x2e700123456789AB, 4x2e710123456789AB, 4x2e720123456789AB, 4x2e730123456789AB, 4x2e740123456789AB, 4x2e750123456789AB, 4x2e760123456789AB, 4x2e770123456789AB, 4x2e780123456789AB, 4x2e790123456789AB, 4x2e7a0123456789AB, 4x2e7b0123456789AB, 4x2e7c0123456789AB, 4x2e7d0123456789AB, 4x2e7e0123456789AB, 4x2e7f0123456789AB
+D372	DATA8[] 4x2e800123456789AB, 4x2e810123456789AB, 4x2e820123456789AB, 4x2e830123456789AB, 4x2e840123456789AB, 4x2e850123456789AB, 4x2e860123456789AB, 4x2e870123456789AB, 4x2e880123456789AB, 4x2e890123456789AB, 4x2e8a0123456789AB, 4x2e8b0123456789AB, 4x2e8c0123456789AB, 4x2e8d0123456789AB, 4x2e8e0123456789AB, 4x2e8f0123456789AB, 4x2e900123456789AB, 4x2e910123456789AB, 4x2e920123456789AB, 4x2e930123456789AB, 4x2e940123456789AB, 4x2e950123456789AB, 4x2e960123456789AB, 4x2e970123456789AB, 4x2e980123456789AB, 4x2e990123456789AB, 4x2e9a0123456789AB, 4x2e9b0123456789AB, 4x2e9c0123456789AB, 4x2e9d0123456789AB, 4x2e9e0123456789AB, 4x2e9f0123456789AB
+D373	DATA8[] 4x2ea00123456789AB, 4x2ea10123456789AB, 4x2ea20123456789AB, 4x2ea30123456789AB, 4x2ea40123456789AB, 4x2ea50123456789AB, 4x2ea60123456789AB, 4x2ea70123456789AB, 4x2ea80123456789AB, 4x2ea90123456789AB, 4x2eaa0123456789AB, 4x2eab0123456789AB, 4x2eac0123456789AB, 4x2ead0123456789AB, 4x2eae0123456789AB, 4x2eaf0123456789AB, 4x2eb00123456789AB, 4x2eb10123456789AB, 4x2eb20123456789AB, 4x2eb30123456789AB, 4x2eb40123456789AB, 4x2eb50123456789AB, 4x2eb60123456789AB, 4x2eb70123456789AB, 4x2eb80123456789AB, 4x2eb90123456789AB, 4x2eba0123456789AB, 4x2ebb0123456789AB, 4x2ebc0123456789AB, 4x2ebd0123456789AB, 4x2ebe0123456789AB, 4x2ebf0123456789AB
+D374	DATA8[] 4x2ec00123456789AB, 4x2ec10123456789AB, 4x2ec20123456789AB, 4x2ec30123456789AB, 4x2ec40123456789AB, 4x2ec50123456789AB, 4x2ec60123456789AB, 4x2ec70123456789AB, 4x2ec80123456789AB, 4x2ec90123456789AB, 4x2eca0123456789AB, 4x2ecb0123456789AB, 4x2ecc0123456789AB, 4x2ecd0123456789AB, 4x2ece0123456789AB, 4x2ecf0123456789AB, 4x2ed00123456789AB, 4x2ed10123456789AB, 4x2ed20123456789AB, 4x2ed30123456789AB, 4x2ed40123456789AB, 4x2ed50123456789AB, 4x2ed60123456789AB, 4x2ed70123456789AB, 4x2ed80123456789AB, 4x2ed90123456789AB, 4x2eda0123456789AB, 4x2edb0123456789AB, 4x2edc0123456789AB, 4x2edd0123456789AB, 4x2ede0123456789AB, 4x2edf0123456789AB
+D375	DATA8[] 4x2ee00123456789AB, 4x2ee10123456789AB, 4x2ee20123456789AB, 4x2ee30123456789AB, 4x2ee40123456789AB, 4x2ee50123456789AB, 4x2ee60123456789AB, 4x2ee70123456789AB, 4x2ee80123456789AB, 4x2ee90123456789AB, 4x2eea0123456789AB, 4x2eeb0123456789AB, 4x2eec0123456789AB, 4x2eed0123456789AB, 4x2eee0123456789AB, 4x2eef0123456789AB, 4x2ef00123456789AB, 4x2ef10123456789AB, 4x2ef20123456789AB, 4x2ef30123456789AB, 4x2ef40123456789AB, 4x2ef50123456789AB, 4x2ef60123456789AB, 4x2ef70123456789AB, 4x2ef80123456789AB, 4x2ef90123456789AB, 4x2efa0123456789AB, 4x2efb0123456789AB, 4x2efc0123456789AB, 4x2efd0123456789AB, 4x2efe0123456789AB, 4x2eff0123456789AB
+D376	DATA8[] 4x2f000123456789AB, 4x2f010123456789AB, 4x2f020123456789AB, 4x2f030123456789AB, 4x2f040123456789AB, 4x2f050123456789AB, 4x2f060123456789AB, 4x2f070123456789AB, 4x2f080123456789AB, 4x2f090123456789AB, 4x2f0a0123456789AB, 4x2f0b0123456789AB, 4x2f0c0123456789AB, 4x2f0d0123456789AB, 4x2f0e0123456789AB, 4x2f0f0123456789AB, 4x2f100123456789AB, 4x2f110123456789AB, 4x2f120123456789AB, 4x2f130123456789AB, 4x2f140123456789AB, 4x2f150123456789AB, 4x2f160123456789AB, 4x2f170123456789AB, 4x2f180123456789AB, 4x2f190123456789AB, 4x2f1a0123456789AB, 4x2f1b0123456789AB, 4x2f1c0123456789AB, 4x2f1d0123456789AB, 4x2f1e0123456789AB, 4x2f1f0123456789AB
+D377	DATA8[] 4x2f200123456789AB, 4x2f210123456789AB, 4x2f220123456789AB, 4x2f230123456789AB, 4x2f240123456789AB, 4x2f250123456789AB, 4x2f260123456789AB, 4x2f270123456789AB, 4x2f280123456789AB, 4x2f290123456789AB, 4x2f2a0123456789AB, 4x2f2b0123456789AB, 4x2f2c0123456789AB, 4x2f2d0123456789AB, 4x2f2e0123456789AB, 4x2f2f0123456789AB, 4x2f300123456789AB, 4x2f310123456789AB, 4x2f320123456789AB, 4x2f330123456789AB, 4x2f340123456789AB, 4x2f350123456789AB, 4x2f360123456789AB, 4x2f370123456789AB, 4x2f380123456789AB, 4x2f390123456789AB, 4x2f3a0123456789AB, 4x2f3b0123456789AB, 4x2f3c0123456789AB, 4x2f3d0123456789AB, 4x2f3e0123456789AB, 4x2f3f0123456789AB
+D378	DATA8[] 4x2f400123456789AB, 4x2f410123456789AB, 4x2f420123456789AB, 4x2f430123456789AB, 4x2f440123456789AB, 4x2f450123456789AB, 4x2f460123456789AB, 4x2f470123456789AB, 4x2f480123456789AB, 4x2f490123456789AB, 4x2f4a0123456789AB, 4x2f4b0123456789AB, 4x2f4c0123456789AB, 4x2f4d0123456789AB, 4x2f4e0123456789AB, 4x2f4f0123456789AB, 4x2f500123456789AB, 4x2f510123456789AB, 4x2f520123456789AB, 4x2f530123456789AB, 4x2f540123456789AB, 4x2f550123456789AB, 4x2f560123456789AB, 4x2f570123456789AB, 4x2f580123456789AB, 4x2f590123456789AB, 4x2f5a0123456789AB, 4x2f5b0123456789AB, 4x2f5c0123456789AB, 4x2f5d0123456789AB, 4x2f5e0123456789AB, 4x2f5f0123456789AB
+D379	DATA8[] 4x2f600123456789AB, 4x2f610123456789AB, 4x2f620123456789AB, 4x2f630123456789AB, 4x2f640123456789AB, 4x2f650123456789AB, 4x2f660123456789AB, 4x2f670123456789AB, 4x2f680123456789AB, 4x2f690123456789AB, 4x2f6a0123456789AB, 4x2f6b0123456789AB, 4x2f6c0123456789AB, 4x2f6d0123456789AB, 4x2f6e0123456789AB, 4x2f6f0123456789AB, 4x2f700123456789AB, 4x2f710123456789AB, 4x2f720123456789AB, 4x2f730123456789AB, 4x2f740123456789AB, 4x2f750123456789AB, 4x2f760123456789AB, 4x2f770123456789AB, 4x2f780123456789AB, 4x2f790123456789AB, 4x2f7a0123456789AB, 4x2f7b0123456789AB, 4x2f7c0123456789AB, 4x2f7d0123456789AB, 4x2f7e0123456789AB, 4x2f7f0123456789AB
+D380	DATA8[] 4x2f800123456789AB, 4x2f810123456789AB, 4x2f820123456789AB, 4x2f830123456789AB, 4x2f840123456789AB, 4x2f850123456789AB, 4x2f860123456789AB, 4x2f870123456789AB, 4x2f880123456789AB, 4x2f890123456789AB, 4x2f8a0123456789AB, 4x2f8b0123456789AB, 4x2f8c0123456789AB, 4x2f8d0123456789AB, 4x2f8e0123456789AB, 4x2f8f0123456789AB, 4x2f900123456789AB, 4x2f910123456789AB, 4x2f920123456789AB, 4x2f930123456789AB, 4x2f940123456789AB, 4x2f950123456789AB, 4x2f960123456789AB, 4x2f970123456789AB, 4x2f980123456789AB, 4x2f990123456789AB, 4x2f9a0123456789AB, 4x2f9b0123456789AB, 4x2f9c0123456789AB, 4x2f9d0123456789AB, 4x2f9e0123456789AB, 4x2f9f0123456789AB
+D381	DATA8[] 4x2fa00123456789AB, 4x2fa10123456789AB, 4x2fa20123456789AB, 4x2fa30123456789AB, 4x2fa40123456789AB, 4x2fa50123456789AB, 4x2fa60123456789AB, 4x2fa70123456789AB, 4x2fa80123456789AB, 4x2fa90123456789AB, 4x2faa0123456789AB, 4x2fab0123456789AB, 4x2fac0123456789AB, 4x2fad0123456789AB, 4x2fae0123456789AB, 4x2faf0123456789AB, 4x2fb00123456789AB, 4x2fb10123456789AB, 4x2fb20123456789AB, 4x2fb30123456789AB, 4x2fb40123456789AB, 4x2fb50123456789AB, 4x2fb60123456789AB, 4x2fb70123456789AB, 4x2fb80123456789AB, 4x2fb90123456789AB, 4x2fba0123456789AB, 4x2fbb0123456789AB, 4x2fbc0123456789AB, 4x2fbd0123456789AB, 4x2fbe0123456789AB, 4x2fbf0123456789AB
+D382	DATA8[] 4x2fc00123456789AB, 4x2fc10123456789AB, 4x2fc20123456789AB, 4x2fc30123456789AB, 4x2fc40123456789AB, 4x2fc50123456789AB, 4x2fc60123456789AB, 4x2fc70123456789AB, 4x2fc80123456789AB, 4x2fc90123456789AB, 4x2fca0123456789AB, 4x2fcb0123456789AB, 4x2fcc0123456789AB, 4x2fcd0123456789AB, 4x2fce0123456789AB, 4x2fcf0123456789AB, 4x2fd00123456789AB, 4x2fd10123456789AB, 4x2fd20123456789AB, 4x2fd30123456789AB, 4x2fd40123456789AB, 4x2fd50123456789AB, 4x2fd60123456789AB, 4x2fd70123456789AB, 4x2fd80123456789AB, 4x2fd90123456789AB, 4x2fda0123456789AB, 4x2fdb0123456789AB, 4x2fdc0123456789AB, 4x2fdd0123456789AB, 4x2fde0123456789AB, 4x2fdf0123456789AB
+D383	DATA8[] 4x2fe00123456789AB, 4x2fe10123456789AB, 4x2fe20123456789AB, 4x2fe30123456789AB, 4x2fe40123456789AB, 4x2fe50123456789AB, 4x2fe60123456789AB, 4x2fe70123456789AB, 4x2fe80123456789AB, 4x2fe90123456789AB, 4x2fea0123456789AB, 4x2feb0123456789AB, 4x2fec0123456789AB, 4x2fed0123456789AB, 4x2fee0123456789AB, 4x2fef0123456789AB, 4x2ff00123456789AB, 4x2ff10123456789AB, 4x2ff20123456789AB, 4x2ff30123456789AB, 4x2ff40123456789AB, 4x2ff50123456789AB, 4x2ff60123456789AB, 4x2ff70123456789AB, 4x2ff80123456789AB, 4x2ff90123456789AB, 4x2ffa0123456789AB, 4x2ffb0123456789AB, 4x2ffc0123456789AB, 4x2ffd0123456789AB, 4x2ffe0123456789AB, 4x2fff0123456789AB
+D384	DATA8[] 4x30000123456789AB, 4x30010123456789AB, 4x30020123456789AB, 4x30030123456789AB, 4x30040123456789AB, 4x30050123456789AB, 4x30060123456789AB, 4x30070123456789AB, 4x30080123456789AB, 4x30090123456789AB, 4x300a0123456789AB, 4x300b0123456789AB, 4x300c0123456789AB, 4x300d0123456789AB, 4x300e0123456789AB, 4x300f0123456789AB, 4x30100123456789AB, 4x30110123456789AB, 4x30120123456789AB, 4x30130123456789AB, 4x30140123456789AB, 4x30150123456789AB, 4x30160123456789AB, 4x30170123456789AB, 4x30180123456789AB, 4x30190123456789AB, 4x301a0123456789AB, 4x301b0123456789AB, 4x301c0123456789AB, 4x301d0123456789AB, 4x301e0123456789AB, 4x301f0123456789AB
+D385	DATA8[] 4x30200123456789AB, 4x30210123456789AB, 4x30220123456789AB, 4x30230123456789AB, 4x30240123456789AB, 4x30250123456789AB, 4x30260123456789AB, 4x30270123456789AB, 4x30280123456789AB, 4x30290123456789AB, 4x302a0123456789AB, 4x302b0123456789AB, 4x302c0123456789AB, 4x302d0123456789AB, 4x302e0123456789AB, 4x302f0123456789AB, 4x30300123456789AB, 4x30310123456789AB, 4x30320123456789AB, 4x30330123456789AB, 4x30340123456789AB, 4x30350123456789AB, 4x30360123456789AB, 4x30370123456789AB, 4x30380123456789AB, 4x30390123456789AB, 4x303a0123456789AB, 4x303b0123456789AB, 4x303c0123456789AB, 4x303d0123456789AB, 4x303e0123456789AB, 4x303f0123456789AB
+D386	DATA8[] 4x30400123456789AB, 4x30410123456789AB, 4x30420123456789AB, 4x30430123456789AB, 4x30440123456789AB, 4x30450123456789AB, 4x30460123456789AB, 4x30470123456789AB, 4x30480123456789AB, 4x30490123456789AB, 4x304a0123456789AB, 4x304b0123456789AB, 4x304c0123456789AB, 4x304d0123456789AB, 4x304e0123456789AB, 4x304f0123456789AB, 4x30500123456789AB, 4x30510123456789AB, 4x30520123456789AB, 4x30530123456789AB, 4x30540123456789AB, 4x30550123456789AB, 4x30560123456789AB, 4x30570123456789AB, 4x30580123456789AB, 4x30590123456789AB, 4x305a0123456789AB, 4x305b0123456789AB, 4x305c0123456789AB, 4x305d0123456789AB, 4x305e0123456789AB, 4x305f0123456789AB
+D387	DATA8[] 4x30600123456789AB, 4x30610123456789AB, 4x30620123456789AB, 4x30630123456789AB, 4x30640123456789AB, 4x30650123456789AB, 4x30660123456789AB, 4x30670123456789AB, 4x30680123456789AB, 4x30690123456789AB, 4x306a0123456789AB, 4x306b0123456789AB, 4x306c0123456789AB, 4x306d0123456789AB, 4x306e0123456789AB, 4x306f0123456789AB, 4x30700123456789AB, 4x30710123456789AB, 4x30720123456789AB, 4x30730123456789AB, 4x30740123456789AB, 4x30750123456789AB, 4x30760123456789AB, 4x30770123456789AB, 4x30780123456789AB, 4x30790123456789AB, 4x307a0123456789AB, 4x307b0123456789AB, 4x307c0123456789AB, 4x307d0123456789AB, 4x307e0123456789AB, 4x307f0123456789AB
+D388	DATA8[] 4x30800123456789AB, 4x30810123456789AB, 4x30820123456789AB, 4x30830123456789AB, 4x30840123456789AB, 4x30850123456789AB, 4x30860123456789AB, 4x30870123456789AB, 4x30880123456789AB, 4x30890123456789AB, 4x308a0123456789AB, 4x308b0123456789AB, 4x308c0123456789AB, 4x308d0123456789AB, 4x308e0123456789AB, 4x308f0123456789AB, 4x30900123456789AB, 4x30910123456789AB, 4x30920123456789AB, 4x30930123456789AB, 4x30940123456789AB, 4x30950123456789AB, 4x30960123456789AB, 4x30970123456789AB, 4x30980123456789AB, 4x30990123456789AB, 4x309a0123456789AB, 4x309b0123456789AB, 4x309c0123456789AB, 4x309d0123456789AB, 4x309e0123456789AB, 4x309f0123456789AB
+D389	DATA8[] 4x30a00123456789AB, 4x30a10123456789AB, 4x30a20123456789AB, 4x30a30123456789AB, 4x30a40123456789AB, 4x30a50123456789AB, 4x30a60123456789AB, 4x30a70123456789AB, 4x30a80123456789AB, 4x30a90123456789AB, 4x30aa0123456789AB, 4x30ab0123456789AB, 4x30ac0123456789AB, 4x30ad0123456789AB, 4x30ae0123456789AB, 4x30af0123456789AB, 4x30b00123456789AB, 4x30b10123456789AB, 4x30b20123456789AB, 4x30b30123456789AB, 4x30b40123456789AB, 4x30b50123456789AB, 4x30b60123456789AB, 4x30b70123456789AB, 4x30b80123456789AB, 4x30b90123456789AB, 4x30ba0123456789AB, 4x30bb0123456789AB, 4x30bc0123456789AB, 4x30bd0123456789AB, 4x30be0123456789AB, 4x30bf0123456789AB
+D390	DATA8[] 4x30c00123456789AB, 4x30c10123456789AB, 4x30c20123456789AB, 4x30c30123456789AB, 4x30c40123456789AB, 4x30c50123456789AB, 4x30c60123456789AB, 4x30c70123456789AB, 4x30c80123456789AB, 4x30c90123456789AB, 4x30ca0123456789AB, 4x30cb0123456789AB, 4x30cc0123456789AB, 4x30cd0123456789AB, 4x30ce0123456789AB, 4x30cf0123456789AB, 4x30d00123456789AB, 4x30d10123456789AB, 4x30d20123456789AB, 4x30d30123456789AB, 4x30d40123456789AB, 4x30d50123456789AB, 4x30d60123456789AB, 4x30d70123456789AB, 4x30d80123456789AB, 4x30d90123456789AB, 4x30da0123456789AB, 4x30db0123456789AB, 4x30dc0123456789AB, 4x30dd0123456789AB, 4x30de0123456789AB, 4x30df0123456789AB
+D391	DATA8[] 4x30e00123456789AB, 4x30e10123456789AB, 4x30e20123456789AB, 4x30e30123456789AB, 4x30e40123456789AB, 4x30e50123456789AB, 4x30e60123456789AB, 4x30e70123456789AB, 4x30e80123456789AB, 4x30e90123456789AB, 4x30ea0123456789AB, 4x30eb0123456789AB, 4x30ec0123456789AB, 4x30ed0123456789AB, 4x30ee0123456789AB, 4x30ef0123456789AB, 4x30f00123456789AB, 4x30f10123456789AB, 4x30f20123456789AB, 4x30f30123456789AB, 4x30f40123456789AB, 4x30f50123456789AB, 4x30f60123456789AB, 4x30f70123456789AB, 4x30f80123456789AB, 4x30f90123456789AB, 4x30fa0123456789AB, 4x30fb0123456789AB, 4x30fc0123456789AB, 4x30fd0123456789AB, 4x30fe0123456789AB, 4x30ff0123456789AB
+D392	DATA8[] 4x31000123456789AB, 4x31010123456789AB, 4x31020123456789AB, 4x31030123456789AB, 4x31040123456789AB, 4x31050123456789AB, 4x31060123456789AB, 4x31070123456789AB, 4x31080123456789AB, 4x31090123456789AB, 4x310a0123456789AB, 4x310b0123456789AB, 4x310c0123456789AB, 4x310d0123456789AB, 4x310e0123456789AB, 4x310f0123456789AB, 4x31100123456789AB, 4x31110123456789AB, 4x31120123456789AB, 4x31130123456789AB, 4x31140123456789AB, 4x31150123456789AB, 4x31160123456789AB, 4x31170123456789AB, 4x31180123456789AB, 4x31190123456789AB, 4x311a0123456789AB, 4x311b0123456789AB, 4x311c0123456789AB, 4x311d0123456789AB, 4x311e0123456789AB, 4x311f0123456789AB
+D393	DATA8[] 4x31200123456789AB, 4x31210123456789AB, 4x31220123456789AB, 4x31230123456789AB, 4x31240123456789AB, 4x31250123456789AB, 4x31260123456789AB, 4x31270123456789AB, 4x31280123456789AB, 4x31290123456789AB, 4x312a0123456789AB, 4x312b0123456789AB, 4x312c0123456789AB, 4x312d0123456789AB, 4x312e0123456789AB, 4x312f0123456789AB, 4x31300123456789AB, 4x31310123456789AB, 4x31320123456789AB, 4x31330123456789AB, 4x31340123456789AB, 4x31350123456789AB, 4x31360123456789AB, 4x31370123456789AB, 4x31380123456789AB, 4x31390123456789AB, 4x313a0123456789AB, 4x313b0123456789AB, 4x313c0123456789AB, 4x313d0123456789AB, 4x313e0123456789AB, 4x313f0123456789AB
+D394	DATA8[] 4x31400123456789AB, 4x31410123456789AB, 4x31420123456789AB, 4x31430123456789AB, 4x31440123456789AB, 4x31450123456789AB, 4x31460123456789AB, 4x31470123456789AB, 4x31480123456789AB, 4x31490123456789AB, 4x314a0123456789AB, 4x314b0123456789AB, 4x314c0123456789AB, 4x314d0123456789AB, 4x314e0123456789AB, 4x314f0123456789AB, 4x31500123456789AB, 4x31510123456789AB, 4x31520123456789AB, 4x31530123456789AB, 4x31540123456789AB, 4x31550123456789AB, 4x31560123456789AB, 4x31570123456789AB, 4x31580123456789AB, 4x31590123456789AB, 4x315a0123456789AB, 4x315b0123456789AB, 4x315c0123456789AB, 4x315d0123456789AB, 4x315e0123456789AB, 4x315f0123456789AB
+D395	DATA8[] 4x31600123456789AB, 4x31610123456789AB, 4x31620123456789AB, 4x31630123456789AB, 4x31640123456789AB, 4x31650123456789AB, 4x31660123456789AB, 4x31670123456789AB, 4x31680123456789AB, 4x31690123456789AB, 4x316a0123456789AB, 4x316b0123456789AB, 4x316c0123456789AB, 4x316d0123456789AB, 4x316e0123456789AB, 4x316f0123456789AB, 4x31700123456789AB, 4x31710123456789AB, 4x31720123456789AB, 4x31730123456789AB, 4x31740123456789AB, 4x31750123456789AB, 4x31760123456789AB, 4x31770123456789AB, 4x31780123456789AB, 4x31790123456789AB, 4x317a0123456789AB, 4x317b0123456789AB, 4x317c0123456789AB, 4x317d0123456789AB, 4x317e0123456789AB, 4x317f0123456789AB
+D396	DATA8[] 4x31800123456789AB, 4x31810123456789AB, 4x31820123456789AB, 4x31830123456789AB, 4x31840123456789AB, 4x31850123456789AB, 4x31860123456789AB, 4x31870123456789AB, 4x31880123456789AB, 4x31890123456789AB, 4x318a0123456789AB, 4x318b0123456789AB, 4x318c0123456789AB, 4x318d0123456789AB, 4x318e0123456789AB, 4x318f0123456789AB, 4x31900123456789AB, 4x31910123456789AB, 4x31920123456789AB, 4x31930123456789AB, 4x31940123456789AB, 4x31950123456789AB, 4x31960123456789AB, 4x31970123456789AB, 4x31980123456789AB, 4x31990123456789AB, 4x319a0123456789AB, 4x319b0123456789AB, 4x319c0123456789AB, 4x319d0123456789AB, 4x319e0123456789AB, 4x319f0123456789AB
+D397	DATA8[] 4x31a00123456789AB, 4x31a10123456789AB, 4x31a20123456789AB, 4x31a30123456789AB, 4x31a40123456789AB, 4x31a50123456789AB, 4x31a60123456789AB, 4x31a70123456789AB, 4x31a80123456789AB, 4x31a90123456789AB, 4x31aa0123456789AB, 4x31ab0123456789AB, 4x31ac0123456789AB, 4x31ad0123456789AB, 4x31ae0123456789AB, 4x31af0123456789AB, 4x31b00123456789AB, 4x31b10123456789AB, 4x31b20123456789AB, 4x31b30123456789AB, 4x31b40123456789AB, 4x31b50123456789AB, 4x31b60123456789AB, 4x31b70123456789AB, 4x31b80123456789AB, 4x31b90123456789AB, 4x31ba0123456789AB, 4x31bb0123456789AB, 4x31bc0123456789AB, 4x31bd0123456789AB, 4x31be0123456789AB, 4x31bf0123456789AB
+D398	DATA8[] 4x31c00123456789AB, 4x31c10123456789AB, 4x31c20123456789AB, 4x31c30123456789AB, 4x31c40123456789AB, 4x31c50123456789AB, 4x31c60123456789AB, 4x31c70123456789AB, 4x31c80123456789AB, 4x31c90123456789AB, 4x31ca0123456789AB, 4x31cb0123456789AB, 4x31cc0123456789AB, 4x31cd0123456789AB, 4x31ce0123456789AB, 4x31cf0123456789AB, 4x31d00123456789AB, 4x31d10123456789AB, 4x31d20123456789AB, 4x31d30123456789AB, 4x31d40123456789AB, 4x31d50123456789AB, 4x31d60123456789AB, 4x31d70123456789AB, 4x31d80123456789AB, 4x31d90123456789AB, 4x31da0123456789AB, 4x31db0123456789AB, 4x31dc0123456789AB, 4x31dd0123456789AB, 4x31de0123456789AB, 4x31df0123456789AB
+D399	DATA8[] 4x31e00123456789AB, 4x31e10123456789AB, 4x31e20123456789AB, 4x31e30123456789AB, 4x31e40123456789AB, 4x31e50123456789AB, 4x31e60123456789AB, 4x31e70123456789AB, 4x31e80123456789AB, 4x31e90123456789AB, 4x31ea0123456789AB, 4x31eb0123456789AB, 4x31ec0123456789AB, 4x31ed0123456789AB, 4x31ee0123456789AB, 4x31ef0123456789AB, 4x31f00123456789AB, 4x31f10123456789AB, 4x31f20123456789AB, 4x31f30123456789AB, 4x31f40123456789AB, 4x31f50123456789AB, 4x31f60123456789AB, 4x31f70123456789AB, 4x31f80123456789AB, 4x31f90123456789AB, 4x31fa0123456789AB, 4x31fb0123456789AB, 4x31fc0123456789AB, 4x31fd0123456789AB, 4x31fe0123456789AB, 4x31ff0123456789AB
+D400	DATA8[] 4x32000123456789AB, 4x32010123456789AB, 4x32020123456789AB, 4x32030123456789AB, 4x32040123456789AB, 4x32050123456789AB, 4x32060123456789AB, 4x32070123456789AB, 4x32080123456789AB, 4x32090123456789AB, 4x320a0123456789AB, 4x320b0123456789AB, 4x320c0123456789AB, 4x320d0123456789AB, 4x320e0123456789AB, 4x320f0123456789AB, 4x32100123456789AB, 4x32110123456789AB, 4x32120123456789AB, 4x32130123456789AB, 4x32140123456789AB, 4x32150123456789AB, 4x32160123456789AB, 4x32170123456789AB, 4x32180123456789AB, 4x32190123456789AB, 4x321a0123456789AB, 4x321b0123456789AB, 4x321c0123456789AB, 4x321d0123456789AB, 4x321e0123456789AB, 4x321f0123456789AB
+D401	DATA8[] 4x32200123456789AB, 4x32210123456789AB, 4x32220123456789AB, 4x32230123456789AB, 4x32240123456789AB, 4x32250123456789AB, 4x32260123456789AB, 4x32270123456789AB, 4x32280123456789AB, 4x32290123456789AB, 4x322a0123456789AB, 4x322b0123456789AB, 4x322c0123456789AB, 4x322d0123456789AB, 4x322e0123456789AB, 4x322f0123456789AB, 4x32300123456789AB, 4x32310123456789AB, 4x32320123456789AB, 4x32330123456789AB, 4x32340123456789AB, 4x32350123456789AB, 4x32360123456789AB, 4x32370123456789AB, 4x32380123456789AB, 4x32390123456789AB, 4x323a0123456789AB, 4x323b0123456789AB, 4x323c0123456789AB, 4x323d0123456789AB, 4x323e0123456789AB, 4x323f0123456789AB
+D402	DATA8[] 4x32400123456789AB, 4x32410123456789AB, 4x32420123456789AB, 4x32430123456789AB, 4x32440123456789AB, 4x32450123456789AB, 4x32460123456789AB, 4x32470123456789AB, 4x32480123456789AB, 4x32490123456789AB, 4x324a0123456789AB, 4x324b0123456789AB, 4x324c0123456789AB, 4x324d0123456789AB, 4x324e0123456789AB, 4x324f0123456789AB, 4x32500123456789AB, 4x32510123456789AB, 4x32520123456789AB, 4x32530123456789AB, 4x32540123456789AB, 4x32550123456789AB, 4x32560123456789AB, 4x32570123456789AB, 4x32580123456789AB, 4x32590123456789AB, 4x325a0123456789AB, 4x325b0123456789AB, 4x325c0123456789AB, 4x325d0123456789AB, 4x325e0123456789AB, 4x325f0123456789AB
+D403	DATA8[] 4x32600123456789AB, 4x32610123456789AB, 4x32620123456789AB, 4x32630123456789AB, 4x32640123456789AB, 4x32650123456789AB, 4x32660123456789AB, 4x32670123456789AB, 4x32680123456789AB, 4x32690123456789AB, 4x326a0123456789AB, 4x326b0123456789AB, 4x326c0123456789AB, 4x326d0123456789AB, 4x326e0123456789AB, 4x326f0123456789AB, 4x32700123456789AB, 4x32710123456789AB, 4x32720123456789AB, 4x32730123456789AB, 4x32740123456789AB, 4x32750123456789AB, 4x32760123456789AB, 4x32770123456789AB, 4x32780123456789AB, 4x32790123456789AB, 4x327a0123456789AB, 4x327b0123456789AB, 4x327c0123456789AB, 4x327d0123456789AB, 4x327e0123456789AB, 4x327f0123456789AB
+D404	DATA8[] 4x32800123456789AB, 4x32810123456789AB, 4x32820123456789AB, 4x32830123456789AB, 4x32840123456789AB, 4x32850123456789AB, 4x32860123456789AB, 4x32870123456789AB, 4x32880123456789AB, 4x32890123456789AB, 4x328a0123456789AB, 4x328b0123456789AB, 4x328c0123456789AB, 4x328d0123456789AB, 4x328e0123456789AB, 4x328f0123456789AB, 4x32900123456789AB, 4x32910123456789AB, 4x32920123456789AB, 4x32930123456789AB, 4x32940123456789AB, 4x32950123456789AB, 4x32960123456789AB, 4x32970123456789AB, 4x32980123456789AB, 4x32990123456789AB, 4x329a0123456789AB, 4x329b0123456789AB, 4x329c0123456789AB, 4x329d0123456789AB, 4x329e0123456789AB, 4x329f0123456789AB
+D405	DATA8[] 4x32a00123456789AB, 4x32a10123456789AB, 4x32a20123456789AB, 4x32a30123456789AB, 4x32a40123456789AB, 4x32a50123456789AB, 4x32a60123456789AB, 4x32a70123456789AB, 4x32a80123456789AB, 4x32a90123456789AB, 4x32aa0123456789AB, 4x32ab0123456789AB, 4x32ac0123456789AB, 4x32ad0123456789AB, 4x32ae0123456789AB, 4x32af0123456789AB, 4x32b00123456789AB, 4x32b10123456789AB, 4x32b20123456789AB, 4x32b30123456789AB, 4x32b40123456789AB, 4x32b50123456789AB, 4x32b60123456789AB, 4x32b70123456789AB, 4x32b80123456789AB, 4x32b90123456789AB, 4x32ba0123456789AB, 4x32bb0123456789AB, 4x32bc0123456789AB, 4x32bd0123456789AB, 4x32be0123456789AB, 4x32bf0123456789AB
+D406	DATA8[] 4x32c00123456789AB, 4x32c10123456789AB, 4x32c20123456789AB, 4x32c30123456789AB, 4x32c40123456789AB, 4x32c50123456789AB, 4x32c60123456789AB, 4x32c70123456789AB, 4x32c80123456789AB, 4x32c90123456789AB, 4x32ca0123456789AB, 4x32cb0123456789AB, 4x32cc0123456789AB, 4x32cd0123456789AB, 4x32ce0123456789AB, 4x32cf0123456789AB, 4x32d00123456789AB, 4x32d10123456789AB, 4x32d20123456789AB, 4x32d30123456789AB, 4x32d40123456789AB, 4x32d50123456789AB, 4x32d60123456789AB, 4x32d70123456789AB, 4x32d80123456789AB, 4x32d90123456789AB, 4x32da0123456789AB, 4x32db0123456789AB, 4x32dc0123456789AB, 4x32dd0123456789AB, 4x32de0123456789AB, 4x32df0123456789AB
+D407	DATA8[] 4x32e00123456789AB, 4x32e10123456789AB, 4x32e20123456789AB, 4x32e30123456789AB, 4x32e40123456789AB, 4x32e50123456789AB, 4x32e60123456789AB, 4x32e70123456789AB, 4x32e80123456789AB, 4x32e90123456789AB, 4x32ea0123456789AB, 4x32eb0123456789AB, 4x32ec0123456789AB, 4x32ed0123456789AB, 4x32ee0123456789AB, 4x32ef0123456789AB, 4x32f00123456789AB, 4x32f10123456789AB, 4x32f20123456789AB, 4x32f30123456789AB, 4x32f40123456789AB, 4x32f50123456789AB, 4x32f60123456789AB, 4x32f70123456789AB, 4x32f80123456789AB, 4x32f90123456789AB, 4x32fa0123456789AB, 4x32fb0123456789AB, 4x32fc0123456789AB, 4x32fd0123456789AB, 4x32fe0123456789AB, 4x32ff0123456789AB
+D408	DATA8[] 4x33000123456789AB, 4x33010123456789AB, 4x33020123456789AB, 4x33030123456789AB, 4x33040123456789AB, 4x33050123456789AB, 4x33060123456789AB, 4x33070123456789AB, 4x33080123456789AB, 4x33090123456789AB, 4x330a0123456789AB, 4x330b0123456789AB, 4x330c0123456789AB, 4x330d0123456789AB, 4x330e0123456789AB, 4x330f0123456789AB, 4x33100123456789AB, 4x33110123456789AB, 4x33120123456789AB, 4x33130123456789AB, 4x33140123456789AB, 4x33150123456789AB, 4x33160123456789AB, 4x33170123456789AB, 4x33180123456789AB, 4x33190123456789AB, 4x331a0123456789AB, 4x331b0123456789AB, 4x331c0123456789AB, 4x331d0123456789AB, 4x331e0123456789AB, 4x331f0123456789AB
+D409	DATA8[] 4x33200123456789AB, 4x33210123456789AB, 4x33220123456789AB, 4x33230123456789AB, 4x33240123456789AB, 4x33250123456789AB, 4x33260123456789AB, 4x33270123456789AB, 4x33280123456789AB, 4x33290123456789AB, 4x332a0123456789AB, 4x332b0123456789AB, 4x332c0123456789AB, 4x332d0123456789AB, 4x332e0123456789AB, 4x332f0123456789AB, 4x33300123456789AB, 4x33310123456789AB, 4x33320123456789AB, 4x33330123456789AB, 4x33340123456789AB, 4x33350123456789AB, 4x33360123456789AB, 4x33370123456789AB, 4x33380123456789AB, 4x33390123456789AB, 4x333a0123456789AB, 4x333b0123456789AB, 4x333c0123456789AB, 4x333d0123456789AB, 4x333e0123456789AB, 4x333f0123456789AB
+D410	DATA8[] 4x33400123456789AB, 4x33410123456789AB, 4x33420123456789AB, 4x33430123456789AB, 4x33440123456789AB, 4x33450123456789AB, 4x33460123456789AB, 4x33470123456789AB, 4x33480123456789AB, 4x33490123456789AB, 4x334a0123456789AB, 4x334b0123456789AB, 4x334c0123456789AB, 4x334d0123456789AB, 4x334e0123456789AB, 4x334f0123456789AB, 4x33500123456789AB, 4x33510123456789AB, 4x33520123456789AB, 4x33530123456789AB, 4x33540123456789AB, 4x33550123456789AB, 4x33560123456789AB, 4x33570123456789AB, 4x33580123456789AB, 4x33590123456789AB, 4x335a0123456789AB, 4x335b0123456789AB, 4x335c0123456789AB, 4x335d0123456789AB, 4x335e0123456789AB, 4x335f0123456789AB
+D411	DATA8[] 4x33600123456789AB, 4x33610123456789AB, 4x33620123456789AB, 4x33630123456789AB, 4x33640123456789AB, 4x33650123456789AB, 4x33660123456789AB, 4x33670123456789AB, 4x33680123456789AB, 4x33690123456789AB, 4x336a0123456789AB, 4x336b0123456789AB, 4x336c0123456789AB, 4x336d0123456789AB, 4x336e0123456789AB, 4x336f0123456789AB, 4x33700123456789AB, 4x33710123456789AB, 4x33720123456789AB, 4x33730123456789AB, 4x33740123456789AB, 4x33750123456789AB, 4x33760123456789AB, 4x33770123456789AB, 4x33780123456789AB, 4x33790123456789AB, 4x337a0123456789AB, 4x337b0123456789AB, 4x337c0123456789AB, 4x337d0123456789AB, 4x337e0123456789AB, 4x337f0123456789AB
+D412	DATA8[] 4x33800123456789AB, 4x33810123456789AB, 4x33820123456789AB, 4x33830123456789AB, 4x33840123456789AB, 4x33850123456789AB, 4x33860123456789AB, 4x33870123456789AB, 4x33880123456789AB, 4x33890123456789AB, 4x338a0123456789AB, 4x338b0123456789AB, 4x338c0123456789AB, 4x338d0123456789AB, 4x338e0123456789AB, 4x338f0123456789AB, 4x33900123456789AB, 4x33910123456789AB, 4x33920123456789AB, 4x33930123456789AB, 4x33940123456789AB, 4x33950123456789AB, 4x33960123456789AB, 4x33970123456789AB, 4x33980123456789AB, 4x33990123456789AB, 4x339a0123456789AB, 4x339b0123456789AB, 4x339c0123456789AB, 4x339d0123456789AB, 4x339e0123456789AB, 4x339f0123456789AB
+D413	DATA8[] 4x33a00123456789AB, 4x33a10123456789AB, 4x33a20123456789AB, 4x33a30123456789AB, 4x33a40123456789AB, 4x33a50123456789AB, 4x33a60123456789AB, 4x33a70123456789AB, 4x33a80123456789AB, 4x33a90123456789AB, 4x33aa0123456789AB, 4x33ab0123456789AB, 4x33ac0123456789AB, 4x33ad0123456789AB, 4x33ae0123456789AB, 4x33af0123456789AB, 4x33b00123456789AB, 4x33b10123456789AB, 4x33b20123456789AB, 4x33b30123456789AB, 4x33b40123456789AB, 4x33b50123456789AB, 4x33b60123456789AB, 4x33b70123456789AB, 4x33b80123456789AB, 4x33b90123456789AB, 4x33ba0123456789AB, 4x33bb0123456789AB, 4x33bc0123456789AB, 4x33bd0123456789AB, 4x33be0123456789AB, 4x33bf0123456789AB
+D414	DATA8[] 4x33c00123456789AB, 4x33c10123456789AB, 4x33c20123456789AB, 4x33c30123456789AB, 4x33c40123456789AB, 4x33c50123456789AB, 4x33c60123456789AB, 4x33c70123456789AB, 4x33c80123456789AB, 4x33c90123456789AB, 4x33ca0123456789AB, 4x33cb0123456789AB, 4x33cc0123456789AB, 4x33cd0123456789AB, 4x33ce0123456789AB, 4x33cf0123456789AB, 4x33d00123456789AB, 4x33d10123456789AB, 4x33d20123456789AB, 4x33d30123456789AB, 4x33d40123456789AB, 4x33d50123456789AB, 4x33d60123456789AB, 4x33d70123456789AB, 4x33d80123456789AB, 4x33d90123456789AB, 4x33da0123456789AB, 4x33db0123456789AB, 4x33dc0123456789AB, 4x33dd0123456789AB, 4x33de0123456789AB, 4x33df0123456789AB
+D415	DATA8[] 4x33e00123456789AB, 4x33e10123456789AB, 4x33e20123456789AB, 4x33e30123456789AB, 4x33e40123456789AB, 4x33e50123456789AB, 4x33e60123456789AB, 4x33e70123456789AB, 4x33e80123456789AB, 4x33e90123456789AB, 4x33ea0123456789AB, 4x33eb0123456789AB, 4x33ec0123456789AB, 4x33ed0123456789AB, 4x33ee0123456789AB, 4x33ef0123456789AB, 4x33f00123456789AB, 4x33f10123456789AB, 4x33f20123456789AB, 4x33f30123456789AB, 4x33f40123456789AB, 4x33f50123456789AB, 4x33f60123456789AB, 4x33f70123456789AB, 4x33f80123456789AB, 4x33f90123456789AB, 4x33fa0123456789AB, 4x33fb0123456789AB, 4x33fc0123456789AB, 4x33fd0123456789AB, 4x33fe0123456789AB, 4x33ff0123456789AB
+D416	DATA8[] 4x34000123456789AB, 4x34010123456789AB, 4x34020123456789AB, 4x34030123456789AB, 4x34040123456789AB, 4x34050123456789AB, 4x34060123456789AB, 4x34070123456789AB, 4x34080123456789AB, 4x34090123456789AB, 4x340a0123456789AB, 4x340b0123456789AB, 4x340c0123456789AB, 4x340d0123456789AB, 4x340e0123456789AB, 4x340f0123456789AB, 4x34100123456789AB, 4x34110123456789AB, 4x34120123456789AB, 4x34130123456789AB, 4x34140123456789AB, 4x34150123456789AB, 4x34160123456789AB, 4x34170123456789AB, 4x34180123456789AB, 4x34190123456789AB, 4x341a0123456789AB, 4x341b0123456789AB, 4x341c0123456789AB, 4x341d0123456789AB, 4x341e0123456789AB, 4x341f0123456789AB
+D417	DATA8[] 4x34200123456789AB, 4x34210123456789AB, 4x34220123456789AB, 4x34230123456789AB, 4x34240123456789AB, 4x34250123456789AB, 4x34260123456789AB, 4x34270123456789AB, 4x34280123456789AB, 4x34290123456789AB, 4x342a0123456789AB, 4x342b0123456789AB, 4x342c0123456789AB, 4x342d0123456789AB, 4x342e0123456789AB, 4x342f0123456789AB, 4x34300123456789AB, 4x34310123456789AB, 4x34320123456789AB, 4x34330123456789AB, 4x34340123456789AB, 4x34350123456789AB, 4x34360123456789AB, 4x34370123456789AB, 4x34380123456789AB, 4x34390123456789AB, 4x343a0123456789AB, 4x343b0123456789AB, 4x343c0123456789AB, 4x343d0123456789AB, 4x343e0123456789AB, 4x343f0123456789AB
+D418	DATA8[] 4x34400123456789AB, 4x34410123456789AB, 4x34420123456789AB, 4x34430123456789AB, 4x34440123456789AB, 4x34450123456789AB, 4x34460123456789AB, 4x34470123456789AB, 4x34480123456789AB, 4x34490123456789AB, 4x344a0123456789AB, 4x344b0123456789AB, 4x344c0123456789AB, 4x344d0123456789AB, 4x344e0123456789AB, 4x344f0123456789AB, 4x34500123456789AB, 4x34510123456789AB, 4x34520123456789AB, 4x34530123456789AB, 4x34540123456789AB, 4x34550123456789AB, 4x34560123456789AB, 4x34570123456789AB, 4x34580123456789AB, 4x34590123456789AB, 4x345a0123456789AB, 4x345b0123456789AB, 4x345c0123456789AB, 4x345d0123456789AB, 4x345e0123456789AB, 4x345f0123456789AB
+D419	DATA8[] 4x34600123456789AB, 4x34610123456789AB, 4x34620123456789AB, 4x34630123456789AB, 4x34640123456789AB, 4x34650123456789AB, 4x34660123456789AB, 4x34670123456789AB, 4x34680123456789AB, 4x34690123456789AB, 4x346a0123456789AB, 4x346b0123456789AB, 4x346c0123456789AB, 4x346d0123456789AB, 4x346e0123456789AB, 4x346f0123456789AB, 4x34700123456789AB, 4x34710123456789AB, 4x34720123456789AB, 4x34730123456789AB, 4x34740123456789AB, 4x34750123456789AB, 4x34760123456789AB, 4x34770123456789AB, 4x34780123456789AB, 4x34790123456789AB, 4x347a0123456789AB, 4x347b0123456789AB, 4x347c0123456789AB, 4x347d0123456789AB, 4x347e0123456789AB, 4x347f0123456789AB
+D420	DATA8[] 4x34800123456789AB, 4x34810123456789AB, 4x34820123456789AB, 4x34830123456789AB, 4x34840123456789AB, 4x34850123456789AB, 4x34860123456789AB, 4x34870123456789AB, 4x34880123456789AB, 4x34890123456789AB, 4x348a0123456789AB, 4x348b0123456789AB, 4x348c0123456789AB, 4x348d0123456789AB, 4x348e0123456789AB, 4x348f0123456789AB, 4x34900123456789AB, 4x34910123456789AB, 4x34920123456789AB, 4x34930123456789AB, 4x34940123456789AB, 4x34950123456789AB, 4x34960123456789AB, 4x34970123456789AB, 4x34980123456789AB, 4x34990123456789AB, 4x349a0123456789AB, 4x349b0123456789AB, 4x349c0123456789AB, 4x349d0123456789AB, 4x349e0123456789AB, 4x349f0123456789AB
+D421	DATA8[] 4x34a00123456789AB, 4x34a10123456789AB, 4x34a20123456789AB, 4x34a30123456789AB, 4x34a40123456789AB, 4x34a50123456789AB, 4x34a60123456789AB, 4x34a70123456789AB, 4x34a80123456789AB, 4x34a90123456789AB, 4x34aa0123456789AB, 4x34ab0123456789AB, 4x34ac0123456789AB, 4x34ad0123456789AB, 4x34ae0123456789AB, 4x34af0123456789AB, 4x34b00123456789AB, 4x34b10123456789AB, 4x34b20123456789AB, 4x34b30123456789AB, 4x34b40123456789AB, 4x34b50123456789AB, 4x34b60123456789AB, 4x34b70123456789AB, 4x34b80123456789AB, 4x34b90123456789AB, 4x34ba0123456789AB, 4x34bb0123456789AB, 4x34bc0123456789AB, 4x34bd0123456789AB, 4x34be0123456789AB, 4x34bf0123456789AB
+D422	DATA8[] 4x34c00123456789AB, 4x34c10123456789AB, 4x34c20123456789AB, 4x34c30123456789AB, 4x34c40123456789AB, 4x34c50123456789AB, 4x34c60123456789AB, 4x34c70123456789AB, 4x34c80123456789AB, 4x34c90123456789AB, 4x34ca0123456789AB, 4x34cb0123456789AB, 4x34cc0123456789AB, 4x34cd0123456789AB, 4x34ce0123456789AB, 4x34cf0123456789AB, 4x34d00123456789AB, 4x34d10123456789AB, 4x34d20123456789AB, 4x34d30123456789AB, 4x34d40123456789AB, 4x34d50123456789AB, 4x34d60123456789AB, 4x34d70123456789AB, 4x34d80123456789AB, 4x34d90123456789AB, 4x34da0123456789AB, 4x34db0123456789AB, 4x34dc0123456789AB, 4x34dd0123456789AB, 4x34de0123456789AB, 4x34df0123456789AB
+D423	DATA8[] 4x34e00123456789AB, 4x34e10123456789AB, 4x34e20123456789AB, 4x34e30123456789AB, 4x34e40123456789AB, 4x34e50123456789AB, 4x34e60123456789AB, 4x34e70123456789AB, 4x34e80123456789AB, 4x34e90123456789AB, 4x34ea0123456789AB, 4x34eb0123456789AB, 4x34ec0123456789AB, 4x34ed0123456789AB, 4x34ee0123456789AB, 4x34ef0123456789AB, 4x34f00123456789AB, 4x34f10123456789AB, 4x34f20123456789AB, 4x34f30123456789AB, 4x34f40123456789AB, 4x34f50123456789AB, 4x34f60123456789AB, 4x34f70123456789AB, 4x34f80123456789AB, 4x34f90123456789AB, 4x34fa0123456789AB, 4x34fb0123456789AB, 4x34fc0123456789AB, 4x34fd0123456789AB, 4x34fe0123456789AB, 4x34ff0123456789AB
+D424	DATA8[] 4x35000123456789AB, 4x35010123456789AB, 4x35020123456789AB, 4x35030123456789AB, 4x35040123456789AB, 4x35050123456789AB, 4x35060123456789AB, 4x35070123456789AB, 4x35080123456789AB, 4x35090123456789AB, 4x350a0123456789AB, 4x350b0123456789AB, 4x350c0123456789AB, 4x350d0123456789AB, 4x350e0123456789AB, 4x350f0123456789AB, 4x35100123456789AB, 4x35110123456789AB, 4x35120123456789AB, 4x35130123456789AB, 4x35140123456789AB, 4x35150123456789AB, 4x35160123456789AB, 4x35170123456789AB, 4x35180123456789AB, 4x35190123456789AB, 4x351a0123456789AB, 4x351b0123456789AB, 4x351c0123456789AB, 4x351d0123456789AB, 4x351e0123456789AB, 4x351f0123456789AB
+D425	DATA8[] 4x35200123456789AB, 4x35210123456789AB, 4x35220123456789AB, 4x35230123456789AB, 4x35240123456789AB, 4x35250123456789AB, 4x35260123456789AB, 4x35270123456789AB, 4x35280123456789AB, 4x35290123456789AB, 4x352a0123456789AB, 4x352b0123456789AB, 4x352c0123456789AB, 4x352d0123456789AB, 4x352e0123456789AB, 4x352f0123456789AB, 4x35300123456789AB, 4x35310123456789AB, 4x35320123456789AB, 4x35330123456789AB, 4x35340123456789AB, 4x35350123456789AB, 4x35360123456789AB, 4x35370123456789AB, 4x35380123456789AB, 4x35390123456789AB, 4x353a0123456789AB, 4x353b0123456789AB, 4x353c0123456789AB, 4x353d0123456789AB, 4x353e0123456789AB, 4x353f0123456789AB
+D426	DATA8[] 4x35400123456789AB, 4x35410123456789AB, 4x35420123456789AB, 4x35430123456789AB, 4x35440123456789AB, 4x35450123456789AB, 4x35460123456789AB, 4x35470123456789AB, 4x35480123456789AB, 4x35490123456789AB, 4x354a0123456789AB, 4x354b0123456789AB, 4x354c0123456789AB, 4x354d0123456789AB, 4x354e0123456789AB, 4x354f0123456789AB, 4x35500123456789AB, 4x35510123456789AB, 4x35520123456789AB, 4x35530123456789AB, 4x35540123456789AB, 4x35550123456789AB, 4x35560123456789AB, 4x35570123456789AB, 4x35580123456789AB, 4x35590123456789AB, 4x355a0123456789AB, 4x355b0123456789AB, 4x355c0123456789AB, 4x355d0123456789AB, 4x355e0123456789AB, 4x355f0123456789AB
+D427	DATA8[] 4x35600123456789AB, 4x35610123456789AB, 4x35620123456789AB, 4x35630123456789AB, 4x35640123456789AB, 4x35650123456789AB, 4x35660123456789AB, 4x35670123456789AB, 4x35680123456789AB, 4x35690123456789AB, 4x356a0123456789AB, 4x356b0123456789AB, 4x356c0123456789AB, 4x356d0123456789AB, 4x356e0123456789AB, 4x356f0123456789AB, 4x35700123456789AB, 4x35710123456789AB, 4x35720123456789AB, 4x35730123456789AB, 4x35740123456789AB, 4x35750123456789AB, 4x35760123456789AB, 4x35770123456789AB, 4x35780123456789AB, 4x35790123456789AB, 4x357a0123456789AB, 4x357b0123456789AB, 4x357c0123456789AB, 4x357d0123456789AB, 4x357e0123456789AB, 4x357f0123456789AB
+D428	DATA8[] 4x35800123456789AB, 4x35810123456789AB, 4x35820123456789AB, 4x35830123456789AB, 4x35840123456789AB, 4x35850123456789AB, 4x35860123456789AB, 4x35870123456789AB, 4x35880123456789AB, 4x35890123456789AB, 4x358a0123456789AB, 4x358b0123456789AB, 4x358c0123456789AB, 4x358d0123456789AB, 4x358e0123456789AB, 4x358f0123456789AB, 4x35900123456789AB, 4x35910123456789AB, 4x35920123456789AB, 4x35930123456789AB, 4x35940123456789AB, 4x35950123456789AB, 4x35960123456789AB, 4x35970123456789AB, 4x35980123456789AB, 4x35990123456789AB, 4x359a0123456789AB, 4x359b0123456789AB, 4x359c0123456789AB, 4x359d0123456789AB, 4x359e0123456789AB, 4x359f0123456789AB
+D429	DATA8[] 4x35a00123456789AB, 4x35a10123456789AB, 4x35a20123456789AB, 4x35a30123456789AB, 4x35a40123456789AB, 4x35a50123456789AB, 4x35a60123456789AB, 4x35a70123456789AB, 4x35a80123456789AB, 4x35a90123456789AB, 4x35aa0123456789AB, 4x35ab0123456789AB, 4x35ac0123456789AB, 4x35ad0123456789AB, 4x35ae0123456789AB, 4x35af0123456789AB, 4x35b00123456789AB, 4x35b10123456789AB, 4x35b20123456789AB, 4x35b30123456789AB, 4x35b40123456789AB, 4x35b50123456789AB, 4x35b60123456789AB, 4x35b70123456789AB, 4x35b80123456789AB, 4x35b90123456789AB, 4x35ba0123456789AB, 4x35bb0123456789AB, 4x35bc0123456789AB, 4x35bd0123456789AB, 4x35be0123456789AB, 4x35bf0123456789AB
+D430	DATA8[] 4x35c00123456789AB, 4x35c10123456789AB, 4x35c20123456789AB, 4x35c30123456789AB, 4x35c40123456789AB, 4x35c50123456789AB, 4x35c60123456789AB, 4x35c70123456789AB, 4x35c80123456789AB, 4x35c90123456789AB, 4x35ca0123456789AB, 4x35cb0123456789AB, 4x35cc0123456789AB, 4x35cd0123456789AB, 4x35ce0123456789AB, 4x35cf0123456789AB, 4x35d00123456789AB, 4x35d10123456789AB, 4x35d20123456789AB, 4x35d30123456789AB, 4x35d40123456789AB, 4x35d50123456789AB, 4x35d60123456789AB, 4x35d70123456789AB, 4x35d80123456789AB, 4x35d90123456789AB, 4x35da0123456789AB, 4x35db0123456789AB, 4x35dc0123456789AB, 4x35dd0123456789AB, 4x35de0123456789AB, 4x35df0123456789AB
+D431	DATA8[] 4x35e00123456789AB, 4x35e10123456789AB, 4x35e20123456789AB, 4x35e30123456789AB, 4x35e40123456789AB, 4x35e50123456789AB, 4x35e60123456789AB, 4x35e70123456789AB, 4x35e80123456789AB, 4x35e90123456789AB, 4x35ea0123456789AB, 4x35eb0123456789AB, 4x35ec0123456789AB, 4x35ed0123456789AB, 4x35ee0123456789AB, 4x35ef0123456789AB, 4x35f00123456789AB, 4x35f10123456789AB, 4x35f20123456789AB, 4x35f30123456789AB, 4x35f40123456789AB, 4x35f50123456789AB, 4x35f60123456789AB, 4x35f70123456789AB, 4x35f80123456789AB, 4x35f90123456789AB, 4x35fa0123456789AB, 4x35fb0123456789AB, 4x35fc0123456789AB, 4x35fd0123456789AB, 4x35fe0123456789AB, 4x35ff0123456789AB
+D432	DATA8[] 4x36000123456789AB, 4x36010123456789AB, 4x36020123456789AB, 4x36030123456789AB, 4x36040123456789AB, 4x36050123456789AB, 4x36060123456789AB, 4x36070123456789AB, 4x36080123456789AB, 4x36090123456789AB, 4x360a0123456789AB, 4x360b0123456789AB, 4x360c0123456789AB, 4x360d0123456789AB, 4x360e0123456789AB, 4x360f0123456789AB, 4x36100123456789AB, 4x36110123456789AB, 4x36120123456789AB, 4x36130123456789AB, 4x36140123456789AB, 4x36150123456789AB, 4x36160123456789AB, 4x36170123456789AB, 4x36180123456789AB, 4x36190123456789AB, 4x361a0123456789AB, 4x361b0123456789AB, 4x361c0123456789AB, 4x361d0123456789AB, 4x361e0123456789AB, 4x361f0123456789AB
+D433	DATA8[] 4x36200123456789AB, 4x36210123456789AB, 4x36220123456789AB, 4x36230123456789AB, 4x36240123456789AB, 4x36250123456789AB, 4x36260123456789AB, 4x36270123456789AB, 4x36280123456789AB, 4x36290123456789AB, 4x362a0123456789AB, 4x362b0123456789AB, 4x362c0123456789AB, 4x362d0123456789AB, 4x362e0123456789AB, 4x362f0123456789AB, 4x36300123456789AB, 4x36310123456789AB, 4x36320123456789AB, 4x36330123456789AB, 4x36340123456789AB, 4x36350123456789AB, 4x36360123456789AB, 4x36370123456789AB, 4x36380123456789AB, 4x36390123456789AB, 4x363a0123456789AB, 4x363b0123456789AB, 4x363c0123456789AB, 4x363d0123456789AB, 4x363e0123456789AB, 4x363f0123456789AB
+D434	DATA8[] 4x36400123456789AB, 4x36410123456789AB, 4x36420123456789AB, 4x36430123456789AB, 4x36440123456789AB, 4x36450123456789AB, 4x36460123456789AB, 4x36470123456789AB, 4x36480123456789AB, 4x36490123456789AB, 4x364a0123456789AB, 4x364b0123456789AB, 4x364c0123456789AB, 4x364d0123456789AB, 4x364e0123456789AB, 4x364f0123456789AB, 4x36500123456789AB, 4x36510123456789AB, 4x36520123456789AB, 4x36530123456789AB, 4x36540123456789AB, 4x36550123456789AB, 4x36560123456789AB, 4x36570123456789AB, 4x36580123456789AB, 4x36590123456789AB, 4x365a0123456789AB, 4x365b0123456789AB, 4x365c0123456789AB, 4x365d0123456789AB, 4x365e0123456789AB, 4x365f0123456789AB
+D435	DATA8[] 4x36600123456789AB, 4x36610123456789AB, 4x36620123456789AB, 4x36630123456789AB, 4x36640123456789AB, 4x36650123456789AB, 4x36660123456789AB, 4x36670123456789AB, 4x36680123456789AB, 4x36690123456789AB, 4x366a0123456789AB, 4x366b0123456789AB, 4x366c0123456789AB, 4x366d0123456789AB, 4x366e0123456789AB, 4x366f0123456789AB, 4x36700123456789AB, 4x36710123456789AB, 4x36720123456789AB, 4x36730123456789AB, 4x36740123456789AB, 4x36750123456789AB, 4x36760123456789AB, 4x36770123456789AB, 4x36780123456789AB, 4x36790123456789AB, 4x367a0123456789AB, 4x367b0123456789AB, 4x367c0123456789AB, 4x367d0123456789AB, 4x367e0123456789AB, 4x367f0123456789AB
+D436	DATA8[] 4x36800123456789AB, 4x36810123456789AB, 4x36820123456789AB, 4x36830123456789AB, 4x36840123456789AB, 4x36850123456789AB, 4x36860123456789AB, 4x36870123456789AB, 4x36880123456789AB, 4x36890123456789AB, 4x368a0123456789AB, 4x368b0123456789AB, 4x368c0123456789AB, 4x368d0123456789AB, 4x368e0123456789AB, 4x368f0123456789AB, 4x36900123456789AB, 4x36910123456789AB, 4x36920123456789AB, 4x36930123456789AB, 4x36940123456789AB, 4x36950123456789AB, 4x36960123456789AB, 4x36970123456789AB, 4x36980123456789AB, 4x36990123456789AB, 4x369a0123456789AB, 4x369b0123456789AB, 4x369c0123456789AB, 4x369d0123456789AB, 4x369e0123456789AB, 4x369f0123456789AB
+D437	DATA8[] 4x36a00123456789AB, 4x36a10123456789AB, 4x36a20123456789AB, 4x36a30123456789AB, 4x36a40123456789AB, 4x36a50123456789AB, 4x36a60123456789AB, 4x36a70123456789AB, 4x36a80123456789AB, 4x36a90123456789AB, 4x36aa0123456789AB, 4x36ab0123456789AB, 4x36ac0123456789AB, 4x36ad0123456789AB, 4x36ae0123456789AB, 4x36af0123456789AB, 4x36b00123456789AB, 4x36b10123456789AB, 4x36b20123456789AB, 4x36b30123456789AB, 4x36b40123456789AB, 4x36b50123456789AB, 4x36b60123456789AB, 4x36b70123456789AB, 4x36b80123456789AB, 4x36b90123456789AB, 4x36ba0123456789AB, 4x36bb0123456789AB, 4x36bc0123456789AB, 4x36bd0123456789AB, 4x36be0123456789AB, 4x36bf0123456789AB
+D438	DATA8[] 4x36c00123456789AB, 4x36c10123456789AB, 4x36c20123456789AB, 4x36c30123456789AB, 4x36c40123456789AB, 4x36c50123456789AB, 4x36c60123456789AB, 4x36c70123456789AB, 4x36c80123456789AB, 4x36c90123456789AB, 4x36ca0123456789AB, 4x36cb0123456789AB, 4x36cc0123456789AB, 4x36cd0123456789AB, 4x36ce0123456789AB, 4x36cf0123456789AB, 4x36d00123456789AB, 4x36d10123456789AB, 4x36d20123456789AB, 4x36d30123456789AB, 4x36d40123456789AB, 4x36d50123456789AB, 4x36d60123456789AB, 4x36d70123456789AB, 4x36d80123456789AB, 4x36d90123456789AB, 4x36da0123456789AB, 4x36db0123456789AB, 4x36dc0123456789AB, 4x36dd0123456789AB, 4x36de0123456789AB, 4x36df0123456789AB
+D439	DATA8[] 4x36e00123456789AB, 4x36e10123456789AB, 4x36e20123456789AB, 4x36e30123456789AB, 4x36e40123456789AB, 4x36e50123456789AB, 4x36e60123456789AB, 4x36e70123456789AB, 4x36e80123456789AB, 4x36e90123456789AB, 4x36ea0123456789AB, 4x36eb0123456789AB, 4x36ec0123456789AB, 4x36ed0123456789AB, 4x36ee0123456789AB, 4x36ef0123456789AB, 4x36f00123456789AB, 4x36f10123456789AB, 4x36f20123456789AB, 4x36f30123456789AB, 4x36f40123456789AB, 4x36f50123456789AB, 4x36f60123456789AB, 4x36f70123456789AB, 4x36f80123456789AB, 4x36f90123456789AB, 4x36fa0123456789AB, 4x36fb0123456789AB, 4x36fc0123456789AB, 4x36fd0123456789AB, 4x36fe0123456789AB, 4x36ff0123456789AB
+D440	DATA8[] 4x37000123456789AB, 4x37010123456789AB, 4x37020123456789AB, 4x37030123456789AB, 4x37040123456789AB, 4x37050123456789AB, 4x37060123456789AB, 4x37070123456789AB, 4x37080123456789AB, 4x37090123456789AB, 4x370a0123456789AB, 4x370b0123456789AB, 4x370c0123456789AB, 4x370d0123456789AB, 4x370e0123456789AB, 4x370f0123456789AB, 4x37100123456789AB, 4x37110123456789AB, 4x37120123456789AB, 4x37130123456789AB, 4x37140123456789AB, 4x37150123456789AB, 4x37160123456789AB, 4x37170123456789AB, 4x37180123456789AB, 4x37190123456789AB, 4x371a0123456789AB, 4x371b0123456789AB, 4x371c0123456789AB, 4x371d0123456789AB, 4x371e0123456789AB, 4x371f0123456789AB
+D441	DATA8[] 4x37200123456789AB, 4x37210123456789AB, 4x37220123456789AB, 4x37230123456789AB, 4x37240123456789AB, 4x37250123456789AB, 4x37260123456789AB, 4x37270123456789AB, 4x37280123456789AB, 4x37290123456789AB, 4x372a0123456789AB, 4x372b0123456789AB, 4x372c0123456789AB, 4x372d0123456789AB, 4x372e0123456789AB, 4x372f0123456789AB, 4x37300123456789AB, 4x37310123456789AB, 4x37320123456789AB, 4x37330123456789AB, 4x37340123456789AB, 4x37350123456789AB, 4x37360123456789AB, 4x37370123456789AB, 4x37380123456789AB, 4x37390123456789AB, 4x373a0123456789AB, 4x373b0123456789AB, 4x373c0123456789AB, 4x373d0123456789AB, 4x373e0123456789AB, 4x373f0123456789AB
+D442	DATA8[] 4x37400123456789AB, 4x37410123456789AB, 4x37420123456789AB, 4x37430123456789AB, 4x37440123456789AB, 4x37450123456789AB, 4x37460123456789AB, 4x37470123456789AB, 4x37480123456789AB, 4x37490123456789AB, 4x374a0123456789AB, 4x374b0123456789AB, 4x374c0123456789AB, 4x374d0123456789AB, 4x374e0123456789AB, 4x374f0123456789AB, 4x37500123456789AB, 4x37510123456789AB, 4x37520123456789AB, 4x37530123456789AB, 4x37540123456789AB, 4x37550123456789AB, 4x37560123456789AB, 4x37570123456789AB, 4x37580123456789AB, 4x37590123456789AB, 4x375a0123456789AB, 4x375b0123456789AB, 4x375c0123456789AB, 4x375d0123456789AB, 4x375e0123456789AB, 4x375f0123456789AB
+D443	DATA8[] 4x37600123456789AB, 4x37610123456789AB, 4x37620123456789AB, 4x37630123456789AB, 4x37640123456789AB, 4x37650123456789AB, 4x37660123456789AB, 4x37670123456789AB, 4x37680123456789AB, 4x37690123456789AB, 4x376a0123456789AB, 4x376b0123456789AB, 4x376c0123456789AB, 4x376d0123456789AB, 4x376e0123456789AB, 4x376f0123456789AB, 4x37700123456789AB, 4x37710123456789AB, 4x37720123456789AB, 4x37730123456789AB, 4x37740123456789AB, 4x37750123456789AB, 4x37760123456789AB, 4x37770123456789AB, 4x37780123456789AB, 4x37790123456789AB, 4x377a0123456789AB, 4x377b0123456789AB, 4x377c0123456789AB, 4x377d0123456789AB, 4x377e0123456789AB, 4x377f0123456789AB
+D444	DATA8[] 4x37800123456789AB, 4x37810123456789AB, 4x37820123456789AB, 4x37830123456789AB, 4x37840123456789AB, 4x37850123456789AB, 4x37860123456789AB, 4x37870123456789AB, 4x37880123456789AB, 4x37890123456789AB, 4x378a0123456789AB, 4x378b0123456789AB, 4x378c0123456789AB, 4x378d0123456789AB, 4x378e0123456789AB, 4x378f0123456789AB, 4x37900123456789AB, 4x37910123456789AB, 4x37920123456789AB, 4x37930123456789AB, 4x37940123456789AB, 4x37950123456789AB, 4x37960123456789AB, 4x37970123456789AB, 4x37980123456789AB, 4x37990123456789AB, 4x379a0123456789AB, 4x379b0123456789AB, 4x379c0123456789AB, 4x379d0123456789AB, 4x379e0123456789AB, 4x379f0123456789AB
+D445	DATA8[] 4x37a00123456789AB, 4x37a10123456789AB, 4x37a20123456789AB, 4x37a30123456789AB, 4x37a40123456789AB, 4x37a50123456789AB, 4x37a60123456789AB, 4x37a70123456789AB, 4x37a80123456789AB, 4x37a90123456789AB, 4x37aa0123456789AB, 4x37ab0123456789AB, 4x37ac0123456789AB, 4x37ad0123456789AB, 4x37ae0123456789AB, 4x37af0123456789AB, 4x37b00123456789AB, 4x37b10123456789AB, 4x37b20123456789AB, 4x37b30123456789AB, 4x37b40123456789AB, 4x37b50123456789AB, 4x37b60123456789AB, 4x37b70123456789AB, 4x37b80123456789AB, 4x37b90123456789AB, 4x37ba0123456789AB, 4x37bb0123456789AB, 4x37bc0123456789AB, 4x37bd0123456789AB, 4x37be0123456789AB, 4x37bf0123456789AB
+D446	DATA8[] 4x37c00123456789AB, 4x37c10123456789AB, 4x37c20123456789AB, 4x37c30123456789AB, 4x37c40123456789AB, 4x37c50123456789AB, 4x37c60123456789AB, 4x37c70123456789AB, 4x37c80123456789AB, 4x37c90123456789AB, 4x37ca0123456789AB, 4x37cb0123456789AB, 4x37cc0123456789AB, 4x37cd0123456789AB, 4x37ce0123456789AB, 4x37cf0123456789AB, 4x37d00123456789AB, 4x37d10123456789AB, 4x37d20123456789AB, 4x37d30123456789AB, 4x37d40123456789AB, 4x37d50123456789AB, 4x37d60123456789AB, 4x37d70123456789AB, 4x37d80123456789AB, 4x37d90123456789AB, 4x37da0123456789AB, 4x37db0123456789AB, 4x37dc0123456789AB, 4x37dd0123456789AB, 4x37de0123456789AB, 4x37df0123456789AB
+D447	DATA8[] 4x37e00123456789AB, 4x37e10123456789AB, 4x37e20123456789AB, 4x37e30123456789AB, 4x37e40123456789AB, 4x37e50123456789AB, 4x37e60123456789AB, 4x37e70123456789AB, 4x37e80123456789AB, 4x37e90123456789AB, 4x37ea0123456789AB, 4x37eb0123456789AB, 4x37ec0123456789AB, 4x37ed0123456789AB, 4x37ee0123456789AB, 4x37ef0123456789AB, 4x37f00123456789AB, 4x37f10123456789AB, 4x37f20123456789AB, 4x37f30123456789AB, 4x37f40123456789AB, 4x37f50123456789AB, 4x37f60123456789AB, 4x37f70123456789AB, 4x37f80123456789AB, 4x37f90123456789AB, 4x37fa0123456789AB, 4x37fb0123456789AB, 4x37fc0123456789AB, 4x37fd0123456789AB, 4x37fe0123456789AB, 4x37ff0123456789AB
+D448	DATA8[] 4x38000123456789AB, 4x38010123456789AB, 4x38020123456789AB, 4x38030123456789AB, 4x38040123456789AB, 4x38050123456789AB, 4x38060123456789AB, 4x38070123456789AB, 4x38080123456789AB, 4x38090123456789AB, 4x380a0123456789AB, 4x380b0123456789AB, 4x380c0123456789AB, 4x380d0123456789AB, 4x380e0123456789AB, 4x380f0123456789AB, 4x38100123456789AB, 4x38110123456789AB, 4x38120123456789AB, 4x38130123456789AB, 4x38140123456789AB, 4x38150123456789AB, 4x38160123456789AB, 4x38170123456789AB, 4x38180123456789AB, 4x38190123456789AB, 4x381a0123456789AB, 4x381b0123456789AB, 4x381c0123456789AB, 4x381d0123456789AB, 4x381e0123456789AB, 4x381f0123456789AB
+D449	DATA8[] 4x38200123456789AB, 4x38210123456789AB, 4x38220123456789AB, 4x38230123456789AB, 4x38240123456789AB, 4x38250123456789AB, 4x38260123456789AB, 4x38270123456789AB, 4x38280123456789AB, 4x38290123456789AB, 4x382a0123456789AB, 4x382b0123456789AB, 4x382c0123456789AB, 4x382d0123456789AB, 4x382e0123456789AB, 4x382f0123456789AB, 4x38300123456789AB, 4x38310123456789AB, 4x38320123456789AB, 4x38330123456789AB, 4x38340123456789AB, 4x38350123456789AB, 4x38360123456789AB, 4x38370123456789AB, 4x38380123456789AB, 4x38390123456789AB, 4x383a0123456789AB, 4x383b0123456789AB, 4x383c0123456789AB, 4x383d0123456789AB, 4x383e0123456789AB, 4x383f0123456789AB
+D450	DATA8[] 4x38400123456789AB, 4x38410123456789AB, 4x38420123456789AB, 4x38430123456789AB, 4x38440123456789AB, 4x38450123456789AB, 4x38460123456789AB, 4x38470123456789AB, 4x38480123456789AB, 4x38490123456789AB, 4x384a0123456789AB, 4x384b0123456789AB, 4x384c0123456789AB, 4x384d0123456789AB, 4x384e0123456789AB, 4x384f0123456789AB, 4x38500123456789AB, 4x38510123456789AB, 4x38520123456789AB, 4x38530123456789AB, 4x38540123456789AB, 4x38550123456789AB, 4x38560123456789AB, 4x38570123456789AB, 4x38580123456789AB, 4x38590123456789AB, 4x385a0123456789AB, 4x385b0123456789AB, 4x385c0123456789AB, 4x385d0123456789AB, 4x385e0123456789AB, 4x385f0123456789AB
+D451	DATA8[] 4x38600123456789AB, 4x38610123456789AB, 4x38620123456789AB, 4x38630123456789AB, 4x38640123456789AB, 4x38650123456789AB, 4x38660123456789AB, 4x38670123456789AB, 4x38680123456789AB, 4x38690123456789AB, 4x386a0123456789AB, 4x386b0123456789AB, 4x386c0123456789AB, 4x386d0123456789AB, 4x386e0123456789AB, 4x386f0123456789AB, 4x38700123456789AB, 4x38710123456789AB, 4x38720123456789AB, 4x38730123456789AB, 4x38740123456789AB, 4x38750123456789AB, 4x38760123456789AB, 4x38770123456789AB, 4x38780123456789AB, 4x38790123456789AB, 4x387a0123456789AB, 4x387b0123456789AB, 4x387c0123456789AB, 4x387d0123456789AB, 4x387e0123456789AB, 4x387f0123456789AB
+D452	DATA8[] 4x38800123456789AB, 4x38810123456789AB, 4x38820123456789AB, 4x38830123456789AB, 4x38840123456789AB, 4x38850123456789AB, 4x38860123456789AB, 4x38870123456789AB, 4x38880123456789AB, 4x38890123456789AB, 4x388a0123456789AB, 4x388b0123456789AB, 4x388c0123456789AB, 4x388d0123456789AB, 4x388e0123456789AB, 4x388f0123456789AB, 4x38900123456789AB, 4x38910123456789AB, 4x38920123456789AB, 4x38930123456789AB, 4x38940123456789AB, 4x38950123456789AB, 4x38960123456789AB, 4x38970123456789AB, 4x38980123456789AB, 4x38990123456789AB, 4x389a0123456789AB, 4x389b0123456789AB, 4x389c0123456789AB, 4x389d0123456789AB, 4x389e0123456789AB, 4x389f0123456789AB
+D453	DATA8[] 4x38a00123456789AB, 4x38a10123456789AB, 4x38a20123456789AB, 4x38a30123456789AB, 4x38a40123456789AB, 4x38a50123456789AB, 4x38a60123456789AB, 4x38a70123456789AB, 4x38a80123456789AB, 4x38a90123456789AB, 4x38aa0123456789AB, 4x38ab0123456789AB, 4x38ac0123456789AB, 4x38ad0123456789AB, 4x38ae0123456789AB, 4x38af0123456789AB, 4x38b00123456789AB, 4x38b10123456789AB, 4x38b20123456789AB, 4x38b30123456789AB, 4x38b40123456789AB, 4x38b50123456789AB, 4x38b60123456789AB, 4x38b70123456789AB, 4x38b80123456789AB, 4x38b90123456789AB, 4x38ba0123456789AB, 4x38bb0123456789AB, 4x38bc0123456789AB, 4x38bd0123456789AB, 4x38be0123456789AB, 4x38bf0123456789AB
+D454	DATA8[] 4x38c00123456789AB, 4x38c10123456789AB, 4x38c20123456789AB, 4x38c30123456789AB, 4x38c40123456789AB, 4x38c50123456789AB, 4x38c60123456789AB, 4x38c70123456789AB, 4x38c80123456789AB, 4x38c90123456789AB, 4x38ca0123456789AB, 4x38cb0123456789AB, 4x38cc0123456789AB, 4x38cd0123456789AB, 4x38ce0123456789AB, 4x38cf0123456789AB, 4x38d00123456789AB, 4x38d10123456789AB, 4x38d20123456789AB, 4x38d30123456789AB, 4x38d40123456789AB, 4x38d50123456789AB, 4x38d60123456789AB, 4x38d70123456789AB, 4x38d80123456789AB, 4x38d90123456789AB, 4x38da0123456789AB, 4x38db0123456789AB, 4x38dc0123456789AB, 4x38dd0123456789AB, 4x38de0123456789AB, 4x38df0123456789AB
+D455	DATA8[] 4x38e00123456789AB, 4x38e10123456789AB, 4x38e20123456789AB, 4x38e30123456789AB, 4x38e40123456789AB, 4x38e50123456789AB, 4x38e60123456789AB, 4x38e70123456789AB, 4x38e80123456789AB, 4x38e90123456789AB, 4x38ea0123456789AB, 4x38eb0123456789AB, 4x38ec0123456789AB, 4x38ed0123456789AB, 4x38ee0123456789AB, 4x38ef0123456789AB, 4x38f00123456789AB, 4x38f10123456789AB, 4x38f20123456789AB, 4x38f30123456789AB, 4x38f40123456789AB, 4x38f50123456789AB, 4x38f60123456789AB, 4x38f70123456789AB, 4x38f80123456789AB, 4x38f90123456789AB, 4x38fa0123456789AB, 4x38fb0123456789AB, 4x38fc0123456789AB, 4x38fd0123456789AB, 4x38fe0123456789AB, 4x38ff0123456789AB
+D456	DATA8[] 4x39000123456789AB, 4x39010123456789AB, 4x39020123456789AB, 4x39030123456789AB, 4x39040123456789AB, 4x39050123456789AB, 4x39060123456789AB, 4x39070123456789AB, 4x39080123456789AB, 4x39090123456789AB, 4x390a0123456789AB, 4x390b0123456789AB, 4x390c0123456789AB, 4x390d0123456789AB, 4x390e0123456789AB, 4x390f0123456789AB, 4x39100123456789AB, 4x39110123456789AB, 4x39120123456789AB, 4x39130123456789AB, 4x39140123456789AB, 4x39150123456789AB, 4x39160123456789AB, 4x39170123456789AB, 4x39180123456789AB, 4x39190123456789AB, 4x391a0123456789AB, 4x391b0123456789AB, 4x391c0123456789AB, 4x391d0123456789AB, 4x391e0123456789AB, 4x391f0123456789AB
+D457	DATA8[] 4x39200123456789AB, 4x39210123456789AB, 4x39220123456789AB, 4x39230123456789AB, 4x39240123456789AB, 4x39250123456789AB, 4x39260123456789AB, 4x39270123456789AB, 4x39280123456789AB, 4x39290123456789AB, 4x392a0123456789AB, 4x392b0123456789AB, 4x392c0123456789AB, 4x392d0123456789AB, 4x392e0123456789AB, 4x392f0123456789AB, 4x39300123456789AB, 4x39310123456789AB, 4x39320123456789AB, 4x39330123456789AB, 4x39340123456789AB, 4x39350123456789AB, 4x39360123456789AB, 4x39370123456789AB, 4x39380123456789AB, 4x39390123456789AB, 4x393a0123456789AB, 4x393b0123456789AB, 4x393c0123456789AB, 4x393d0123456789AB, 4x393e0123456789AB, 4x393f0123456789AB
+D458	DATA8[] 4x39400123456789AB, 4x39410123456789AB, 4x39420123456789AB, 4x39430123456789AB, 4x39440123456789AB, 4x39450123456789AB, 4x39460123456789AB, 4x39470123456789AB, 4x39480123456789AB, 4x39490123456789AB, 4x394a0123456789AB, 4x394b0123456789AB, 4x394c0123456789AB, 4x394d0123456789AB, 4x394e0123456789AB, 4x394f0123456789AB, 4x39500123456789AB, 4x39510123456789AB, 4x39520123456789AB, 4x39530123456789AB, 4x39540123456789AB, 4x39550123456789AB, 4x39560123456789AB, 4x39570123456789AB, 4x39580123456789AB, 4x39590123456789AB, 4x395a0123456789AB, 4x395b0123456789AB, 4x395c0123456789AB, 4x395d0123456789AB, 4x395e0123456789AB, 4x395f0123456789AB
+D459	DATA8[] 4x39600123456789AB, 4x39610123456789AB, 4x39620123456789AB, 4x39630123456789AB, 4x39640123456789AB, 4x39650123456789AB, 4x39660123456789AB, 4x39670123456789AB, 4x39680123456789AB, 4x39690123456789AB, 4x396a0123456789AB, 4x396b0123456789AB, 4x396c0123456789AB, 4x396d0123456789AB, 4x396e0123456789AB, 4x396f0123456789AB, 4x39700123456789AB, 4x39710123456789AB, 4x39720123456789AB, 4x39730123456789AB, 4x39740123456789AB, 4x39750123456789AB, 4x39760123456789AB, 4x39770123456789AB, 4x39780123456789AB, 4x39790123456789AB, 4x397a0123456789AB, 4x397b0123456789AB, 4x397c0123456789AB, 4x397d0123456789AB, 4x397e0123456789AB, 4x397f0123456789AB
+D460	DATA8[] 4x39800123456789AB, 4x39810123456789AB, 4x39820123456789AB, 4x39830123456789AB, 4x39840123456789AB, 4x39850123456789AB, 4x39860123456789AB, 4x39870123456789AB, 4x39880123456789AB, 4x39890123456789AB, 4x398a0123456789AB, 4x398b0123456789AB, 4x398c0123456789AB, 4x398d0123456789AB, 4x398e0123456789AB, 4x398f0123456789AB, 4x39900123456789AB, 4x39910123456789AB, 4x39920123456789AB, 4x39930123456789AB, 4x39940123456789AB, 4x39950123456789AB, 4x39960123456789AB, 4x39970123456789AB, 4x39980123456789AB, 4x39990123456789AB, 4x399a0123456789AB, 4x399b0123456789AB, 4x399c0123456789AB, 4x399d0123456789AB, 4x399e0123456789AB, 4x399f0123456789AB
+D461	DATA8[] 4x39a00123456789AB, 4x39a10123456789AB, 4x39a20123456789AB, 4x39a30123456789AB, 4x39a40123456789AB, 4x39a50123456789AB, 4x39a60123456789AB, 4x39a70123456789AB, 4x39a80123456789AB, 4x39a90123456789AB, 4x39aa0123456789AB, 4x39ab0123456789AB, 4x39ac0123456789AB, 4x39ad0123456789AB, 4x39ae0123456789AB, 4x39af0123456789AB, 4x39b00123456789AB, 4x39b10123456789AB, 4x39b20123456789AB, 4x39b30123456789AB, 4x39b40123456789AB, 4x39b50123456789AB, 4x39b60123456789AB, 4x39b70123456789AB, 4x39b80123456789AB, 4x39b90123456789AB, 4x39ba0123456789AB, 4x39bb0123456789AB, 4x39bc0123456789AB, 4x39bd0123456789AB, 4x39be0123456789AB, 4x39bf0123456789AB
+D462	DATA8[] 4x39c00123456789AB, 4x39c10123456789AB, 4x39c20123456789AB, 4x39c30123456789AB, 4x39c40123456789AB, 4x39c50123456789AB, 4x39c60123456789AB, 4x39c70123456789AB, 4x39c80123456789AB, 4x39c90123456789AB, 4x39ca0123456789AB, 4x39cb0123456789AB, 4x39cc0123456789AB, 4x39cd0123456789AB, 4x39ce0123456789AB, 4x39cf0123456789AB, 4x39d00123456789AB, 4x39d10123456789AB, 4x39d20123456789AB, 4x39d30123456789AB, 4x39d40123456789AB, 4x39d50123456789AB, 4x39d60123456789AB, 4x39d70123456789AB, 4x39d80123456789AB, 4x39d90123456789AB, 4x39da0123456789AB, 4x39db0123456789AB, 4x39dc0123456789AB, 4x39dd0123456789AB, 4x39de0123456789AB, 4x39df0123456789AB
+D463	DATA8[] 4x39e00123456789AB, 4x39e10123456789AB, 4x39e20123456789AB, 4x39e30123456789AB, 4x39e40123456789AB, 4x39e50123456789AB, 4x39e60123456789AB, 4x39e70123456789AB, 4x39e80123456789AB, 4x39e90123456789AB, 4x39ea0123456789AB, 4x39eb0123456789AB, 4x39ec0123456789AB, 4x39ed0123456789AB, 4x39ee0123456789AB, 4x39ef0123456789AB, 4x39f00123456789AB, 4x39f10123456789AB, 4x39f20123456789AB, 4x39f30123456789AB, 4x39f40123456789AB, 4x39f50123456789AB, 4x39f60123456789AB, 4x39f70123456789AB, 4x39f80123456789AB, 4x39f90123456789AB, 4x39fa0123456789AB, 4x39fb0123456789AB, 4x39fc0123456789AB, 4x39fd0123456789AB, 4x39fe0123456789AB, 4x39ff0123456789AB
+D464	DATA8[] 4x3a000123456789AB, 4x3a010123456789AB, 4x3a020123456789AB, 4x3a030123456789AB, 4x3a040123456789AB, 4x3a050123456789AB, 4x3a060123456789AB, 4x3a070123456789AB, 4x3a080123456789AB, 4x3a090123456789AB, 4x3a0a0123456789AB, 4x3a0b0123456789AB, 4x3a0c0123456789AB, 4x3a0d0123456789AB, 4x3a0e0123456789AB, 4x3a0f0123456789AB, 4x3a100123456789AB, 4x3a110123456789AB, 4x3a120123456789AB, 4x3a130123456789AB, 4x3a140123456789AB, 4x3a150123456789AB, 4x3a160123456789AB, 4x3a170123456789AB, 4x3a180123456789AB, 4x3a190123456789AB, 4x3a1a0123456789AB, 4x3a1b0123456789AB, 4x3a1c0123456789AB, 4x3a1d0123456789AB, 4x3a1e0123456789AB, 4x3a1f0123456789AB
+D465	DATA8[] 4x3a200123456789AB, 4x3a210123456789AB, 4x3a220123456789AB, 4x3a230123456789AB, 4x3a240123456789AB, 4x3a250123456789AB, 4x3a260123456789AB, 4x3a270123456789AB, 4x3a280123456789AB, 4x3a290123456789AB, 4x3a2a0123456789AB, 4x3a2b0123456789AB, 4x3a2c0123456789AB, 4x3a2d0123456789AB, 4x3a2e0123456789AB, 4x3a2f0123456789AB, 4x3a300123456789AB, 4x3a310123456789AB, 4x3a320123456789AB, 4x3a330123456789AB, 4x3a340123456789AB, 4x3a350123456789AB, 4x3a360123456789AB, 4x3a370123456789AB, 4x3a380123456789AB, 4x3a390123456789AB, 4x3a3a0123456789AB, 4x3a3b0123456789AB, 4x3a3c0123456789AB, 4x3a3d0123456789AB, 4x3a3e0123456789AB, 4x3a3f0123456789AB
+D466	DATA8[] 4x3a400123456789AB, 4x3a410123456789AB, 4x3a420123456789AB, 4x3a430123456789AB, 4x3a440123456789AB, 4x3a450123456789AB, 4x3a460123456789AB, 4x3a470123456789AB, 4x3a480123456789AB, 4x3a490123456789AB, 4x3a4a0123456789AB, 4x3a4b0123456789AB, 4x3a4c0123456789AB, 4x3a4d0123456789AB, 4x3a4e0123456789AB, 4x3a4f0123456789AB, 4x3a500123456789AB, 4x3a510123456789AB, 4x3a520123456789AB, 4x3a530123456789AB, 4x3a540123456789AB, 4x3a550123456789AB, 4x3a560123456789AB, 4x3a570123456789AB, 4x3a580123456789AB, 4x3a590123456789AB, 4x3a5a0123456789AB, 4x3a5b0123456789AB, 4x3a5c0123456789AB, 4x3a5d0123456789AB, 4x3a5e0123456789AB, 4x3a5f0123456789AB
+D467	DATA8[] 4x3a600123456789AB, 4x3a610123456789AB, 4x3a620123456789AB, 4x3a630123456789AB, 4x3a640123456789AB, 4x3a650123456789AB, 4x3a660123456789AB, 4x3a670123456789AB, 4x3a680123456789AB, 4x3a690123456789AB, 4x3a6a0123456789AB, 4x3a6b0123456789AB, 4x3a6c0123456789AB, 4x3a6d0123456789AB, 4x3a6e0123456789AB, 4x3a6f0123456789AB, 4x3a700123456789AB, 4x3a710123456789AB, 4x3a720123456789AB, 4x3a730123456789AB, 4x3a740123456789AB, 4x3a750123456789AB, 4x3a760123456789AB, 4x3a770123456789AB, 4x3a780123456789AB, 4x3a790123456789AB, 4x3a7a0123456789AB, 4x3a7b0123456789AB, 4x3a7c0123456789AB, 4x3a7d0123456789AB, 4x3a7e0123456789AB, 4x3a7f0123456789AB
+D468	DATA8[] 4x3a800123456789AB, 4x3a810123456789AB, 4x3a820123456789AB, 4x3a830123456789AB, 4x3a840123456789AB, 4x3a850123456789AB, 4x3a860123456789AB, 4x3a870123456789AB, 4x3a880123456789AB, 4x3a890123456789AB, 4x3a8a0123456789AB, 4x3a8b0123456789AB, 4x3a8c0123456789AB, 4x3a8d0123456789AB, 4x3a8e0123456789AB, 4x3a8f0123456789AB, 4x3a900123456789AB, 4x3a910123456789AB, 4x3a920123456789AB, 4x3a930123456789AB, 4x3a940123456789AB, 4x3a950123456789AB, 4x3a960123456789AB, 4x3a970123456789AB, 4x3a980123456789AB, 4x3a990123456789AB, 4x3a9a0123456789AB, 4x3a9b0123456789AB, 4x3a9c0123456789AB, 4x3a9d0123456789AB, 4x3a9e0123456789AB, 4x3a9f0123456789AB
+D469	DATA8[] 4x3aa00123456789AB, 4x3aa10123456789AB, 4x3aa20123456789AB, 4x3aa30123456789AB, 4x3aa40123456789AB, 4x3aa50123456789AB, 4x3aa60123456789AB, 4x3aa70123456789AB, 4x3aa80123456789AB, 4x3aa90123456789AB, 4x3aaa0123456789AB, 4x3aab0123456789AB, 4x3aac0123456789AB, 4x3aad0123456789AB, 4x3aae0123456789AB, 4x3aaf0123456789AB, 4x3ab00123456789AB, 4x3ab10123456789AB, 4x3ab20123456789AB, 4x3ab30123456789AB, 4x3ab40123456789AB, 4x3ab50123456789AB, 4x3ab60123456789AB, 4x3ab70123456789AB, 4x3ab80123456789AB, 4x3ab90123456789AB, 4x3aba0123456789AB, 4x3abb0123456789AB, 4x3abc0123456789AB, 4x3abd0123456789AB, 4x3abe0123456789AB, 4x3abf0123456789AB
+D470	DATA8[] 4x3ac00123456789AB, 4x3ac10123456789AB, 4x3ac20123456789AB, 4x3ac30123456789AB, 4x3ac40123456789AB, 4x3ac50123456789AB, 4x3ac60123456789AB, 4x3ac70123456789AB, 4x3ac80123456789AB, 4x3ac90123456789AB, 4x3aca0123456789AB, 4x3acb0123456789AB, 4x3acc0123456789AB, 4x3acd0123456789AB, 4x3ace0123456789AB, 4x3acf0123456789AB, 4x3ad00123456789AB, 4x3ad10123456789AB, 4x3ad20123456789AB, 4x3ad30123456789AB, 4x3ad40123456789AB, 4x3ad50123456789AB, 4x3ad60123456789AB, 4x3ad70123456789AB, 4x3ad80123456789AB, 4x3ad90123456789AB, 4x3ada0123456789AB, 4x3adb0123456789AB, 4x3adc0123456789AB, 4x3add0123456789AB, 4x3ade0123456789AB, 4x3adf0123456789AB
+D471	DATA8[] 4x3ae00123456789AB, 4x3ae10123456789AB, 4x3ae20123456789AB, 4x3ae30123456789AB, 4x3ae40123456789AB, 4x3ae50123456789AB, 4x3ae60123456789AB, 4x3ae70123456789AB, 4x3ae80123456789AB, 4x3ae90123456789AB, 4x3aea0123456789AB, 4x3aeb0123456789AB, 4x3aec0123456789AB, 4x3aed0123456789AB, 4x3aee0123456789AB, 4x3aef0123456789AB, 4x3af00123456789AB, 4x3af10123456789AB, 4x3af20123456789AB, 4x3af30123456789AB, 4x3af40123456789AB, 4x3af50123456789AB, 4x3af60123456789AB, 4x3af70123456789AB, 4x3af80123456789AB, 4x3af90123456789AB, 4x3afa0123456789AB, 4x3afb0123456789AB, 4x3afc0123456789AB, 4x3afd0123456789AB, 4x3afe0123456789AB, 4x3aff0123456789AB
+D472	DATA8[] 4x3b000123456789AB, 4x3b010123456789AB, 4x3b020123456789AB, 4x3b030123456789AB, 4x3b040123456789AB, 4x3b050123456789AB, 4x3b060123456789AB, 4x3b070123456789AB, 4x3b080123456789AB, 4x3b090123456789AB, 4x3b0a0123456789AB, 4x3b0b0123456789AB, 4x3b0c0123456789AB, 4x3b0d0123456789AB, 4x3b0e0123456789AB, 4x3b0f0123456789AB, 4x3b100123456789AB, 4x3b110123456789AB, 4x3b120123456789AB, 4x3b130123456789AB, 4x3b140123456789AB, 4x3b150123456789AB, 4x3b160123456789AB, 4x3b170123456789AB, 4x3b180123456789AB, 4x3b190123456789AB, 4x3b1a0123456789AB, 4x3b1b0123456789AB, 4x3b1c0123456789AB, 4x3b1d0123456789AB, 4x3b1e0123456789AB, 4x3b1f0123456789AB
+D473	DATA8[] 4x3b200123456789AB, 4x3b210123456789AB, 4x3b220123456789AB, 4x3b230123456789AB, 4x3b240123456789AB, 4x3b250123456789AB, 4x3b260123456789AB, 4x3b270123456789AB, 4x3b280123456789AB, 4x3b290123456789AB, 4x3b2a0123456789AB, 4x3b2b0123456789AB, 4x3b2c0123456789AB, 4x3b2d0123456789AB, 4x3b2e0123456789AB, 4x3b2f0123456789AB, 4x3b300123456789AB, 4x3b310123456789AB, 4x3b320123456789AB, 4x3b330123456789AB, 4x3b340123456789AB, 4x3b350123456789AB, 4x3b360123456789AB, 4x3b370123456789AB, 4x3b380123456789AB, 4x3b390123456789AB, 4x3b3a0123456789AB, 4x3b3b0123456789AB, 4x3b3c0123456789AB, 4x3b3d0123456789AB, 4x3b3e0123456789AB, 4x3b3f0123456789AB
+D474	DATA8[] 4x3b400123456789AB, 4x3b410123456789AB, 4x3b420123456789AB, 4x3b430123456789AB, 4x3b440123456789AB, 4x3b450123456789AB, 4x3b460123456789AB, 4x3b470123456789AB, 4x3b480123456789AB, 4x3b490123456789AB, 4x3b4a0123456789AB, 4x3b4b0123456789AB, 4x3b4c0123456789AB, 4x3b4d0123456789AB, 4x3b4e0123456789AB, 4x3b4f0123456789AB, 4x3b500123456789AB, 4x3b510123456789AB, 4x3b520123456789AB, 4x3b530123456789AB, 4x3b540123456789AB, 4x3b550123456789AB, 4x3b560123456789AB, 4x3b570123456789AB, 4x3b580123456789AB, 4x3b590123456789AB, 4x3b5a0123456789AB, 4x3b5b0123456789AB, 4x3b5c0123456789AB, 4x3b5d0123456789AB, 4x3b5e0123456789AB, 4x3b5f0123456789AB
+D475	DATA8[] 4x3b600123456789AB, 4x3b610123456789AB, 4x3b620123456789AB, 4x3b630123456789AB, 4x3b640123456789AB, 4x3b650123456789AB, 4x3b660123456789AB, 4x3b670123456789AB, 4x3b680123456789AB, 4x3b690123456789AB, 4x3b6a0123456789AB, 4x3b6b0123456789AB, 4x3b6c0123456789AB, 4x3b6d0123456789AB, 4x3b6e0123456789AB, 4x3b6f0123456789AB, 4x3b700123456789AB, 4x3b710123456789AB, 4x3b720123456789AB, 4x3b730123456789AB, 4x3b740123456789AB, 4x3b750123456789AB, 4x3b760123456789AB, 4x3b770123456789AB, 4x3b780123456789AB, 4x3b790123456789AB, 4x3b7a0123456789AB, 4x3b7b0123456789AB, 4x3b7c0123456789AB, 4x3b7d0123456789AB, 4x3b7e0123456789AB, 4x3b7f0123456789AB
+D476	DATA8[] 4x3b800123456789AB, 4x3b810123456789AB, 4x3b820123456789AB, 4x3b830123456789AB, 4x3b840123456789AB, 4x3b850123456789AB, 4x3b860123456789AB, 4x3b870123456789AB, 4x3b880123456789AB, 4x3b890123456789AB, 4x3b8a0123456789AB, 4x3b8b0123456789AB, 4x3b8c0123456789AB, 4x3b8d0123456789AB, 4x3b8e0123456789AB, 4x3b8f0123456789AB, 4x3b900123456789AB, 4x3b910123456789AB, 4x3b920123456789AB, 4x3b930123456789AB, 4x3b940123456789AB, 4x3b950123456789AB, 4x3b960123456789AB, 4x3b970123456789AB, 4x3b980123456789AB, 4x3b990123456789AB, 4x3b9a0123456789AB, 4x3b9b0123456789AB, 4x3b9c0123456789AB, 4x3b9d0123456789AB, 4x3b9e0123456789AB, 4x3b9f0123456789AB
+D477	DATA8[] 4x3ba00123456789AB, 4x3ba10123456789AB, 4x3ba20123456789AB, 4x3ba30123456789AB, 4x3ba40123456789AB, 4x3ba50123456789AB, 4x3ba60123456789AB, 4x3ba70123456789AB, 4x3ba80123456789AB, 4x3ba90123456789AB, 4x3baa0123456789AB, 4x3bab0123456789AB, 4x3bac0123456789AB, 4x3bad0123456789AB, 4x3bae0123456789AB, 4x3baf0123456789AB, 4x3bb00123456789AB, 4x3bb10123456789AB, 4x3bb20123456789AB, 4x3bb30123456789AB, 4x3bb40123456789AB, 4x3bb50123456789AB, 4x3bb60123456789AB, 4x3bb70123456789AB, 4x3bb80123456789AB, 4x3bb90123456789AB, 4x3bba0123456789AB, 4x3bbb0123456789AB, 4x3bbc0123456789AB, 4x3bbd0123456789AB, 4x3bbe0123456789AB, 4x3bbf0123456789AB
+D478	DATA8[] 4x3bc00123456789AB, 4x3bc10123456789AB, 4x3bc20123456789AB, 4x3bc30123456789AB, 4x3bc40123456789AB, 4x3bc50123456789AB, 4x3bc60123456789AB, 4x3bc70123456789AB, 4x3bc80123456789AB, 4x3bc90123456789AB, 4x3bca0123456789AB, 4x3bcb0123456789AB, 4x3bcc0123456789AB, 4x3bcd0123456789AB, 4x3bce0123456789AB, 4x3bcf0123456789AB, 4x3bd00123456789AB, 4x3bd10123456789AB, 4x3bd20123456789AB, 4x3bd30123456789AB, 4x3bd40123456789AB, 4x3bd50123456789AB, 4x3bd60123456789AB, 4x3bd70123456789AB, 4x3bd80123456789AB, 4x3bd90123456789AB, 4x3bda0123456789AB, 4x3bdb0123456789AB, 4x3bdc0123456789AB, 4x3bdd0123456789AB, 4x3bde0123456789AB, 4x3bdf0123456789AB
+D479	DATA8[] 4x3be00123456789AB, 4x3be10123456789AB, 4x3be20123456789AB, 4x3be30123456789AB, 4x3be40123456789AB, 4x3be50123456789AB, 4x3be60123456789AB, 4x3be70123456789AB, 4x3be80123456789AB, 4x3be90123456789AB, 4x3bea0123456789AB, 4x3beb0123456789AB, 4x3bec0123456789AB, 4x3bed0123456789AB, 4x3bee0123456789AB, 4x3bef0123456789AB, 4x3bf00123456789AB, 4x3bf10123456789AB, 4x3bf20123456789AB, 4x3bf30123456789AB, 4x3bf40123456789AB, 4x3bf50123456789AB, 4x3bf60123456789AB, 4x3bf70123456789AB, 4x3bf80123456789AB, 4x3bf90123456789AB, 4x3bfa0123456789AB, 4x3bfb0123456789AB, 4x3bfc0123456789AB, 4x3bfd0123456789AB, 4x3bfe0123456789AB, 4x3bff0123456789AB
+D480	DATA8[] 4x3c000123456789AB, 4x3c010123456789AB, 4x3c020123456789AB, 4x3c030123456789AB, 4x3c040123456789AB, 4x3c050123456789AB, 4x3c060123456789AB, 4x3c070123456789AB, 4x3c080123456789AB, 4x3c090123456789AB, 4x3c0a0123456789AB, 4x3c0b0123456789AB, 4x3c0c0123456789AB, 4x3c0d0123456789AB, 4x3c0e0123456789AB, 4x3c0f0123456789AB, 4x3c100123456789AB, 4x3c110123456789AB, 4x3c120123456789AB, 4x3c130123456789AB, 4x3c140123456789AB, 4x3c150123456789AB, 4x3c160123456789AB, 4x3c170123456789AB, 4x3c180123456789AB, 4x3c190123456789AB, 4x3c1a0123456789AB, 4x3c1b0123456789AB, 4x3c1c0123456789AB, 4x3c1d0123456789AB, 4x3c1e0123456789AB, 4x3c1f0123456789AB
+D481	DATA8[] 4x3c200123456789AB, 4x3c210123456789AB, 4x3c220123456789AB, 4x3c230123456789AB, 4x3c240123456789AB, 4x3c250123456789AB, 4x3c260123456789AB, 4x3c270123456789AB, 4x3c280123456789AB, 4x3c290123456789AB, 4x3c2a0123456789AB, 4x3c2b0123456789AB, 4x3c2c0123456789AB, 4x3c2d0123456789AB, 4x3c2e0123456789AB, 4x3c2f0123456789AB, 4x3c300123456789AB, 4x3c310123456789AB, 4x3c320123456789AB, 4x3c330123456789AB, 4x3c340123456789AB, 4x3c350123456789AB, 4x3c360123456789AB, 4x3c370123456789AB, 4x3c380123456789AB, 4x3c390123456789AB, 4x3c3a0123456789AB, 4x3c3b0123456789AB, 4x3c3c0123456789AB, 4x3c3d0123456789AB, 4x3c3e0123456789AB, 4x3c3f0123456789AB
+D482	DATA8[] 4x3c400123456789AB, 4x3c410123456789AB, 4x3c420123456789AB, 4x3c430123456789AB, 4x3c440123456789AB, 4x3c450123456789AB, 4x3c460123456789AB, 4x3c470123456789AB, 4x3c480123456789AB, 4x3c490123456789AB, 4x3c4a0123456789AB, 4x3c4b0123456789AB, 4x3c4c0123456789AB, 4x3c4d0123456789AB, 4x3c4e0123456789AB, 4x3c4f0123456789AB, 4x3c500123456789AB, 4x3c510123456789AB, 4x3c520123456789AB, 4x3c530123456789AB, 4x3c540123456789AB, 4x3c550123456789AB, 4x3c560123456789AB, 4x3c570123456789AB, 4x3c580123456789AB, 4x3c590123456789AB, 4x3c5a0123456789AB, 4x3c5b0123456789AB, 4x3c5c0123456789AB, 4x3c5d0123456789AB, 4x3c5e0123456789AB, 4x3c5f0123456789AB
+D483	DATA8[] 4x3c600123456789AB, 4x3c610123456789AB, 4x3c620123456789AB, 4x3c630123456789AB, 4x3c640123456789AB, 4x3c650123456789AB, 4x3c660123456789AB, 4x3c670123456789AB, 4x3c680123456789AB, 4x3c690123456789AB, 4x3c6a0123456789AB, 4x3c6b0123456789AB, 4x3c6c0123456789AB, 4x3c6d0123456789AB, 4x3c6e0123456789AB, 4x3c6f0123456789AB, 4x3c700123456789AB, 4x3c710123456789AB, 4x3c720123456789AB, 4x3c730123456789AB, 4x3c740123456789AB, 4x3c750123456789AB, 4x3c760123456789AB, 4x3c770123456789AB, 4x3c780123456789AB, 4x3c790123456789AB, 4x3c7a0123456789AB, 4x3c7b0123456789AB, 4x3c7c0123456789AB, 4x3c7d0123456789AB, 4x3c7e0123456789AB, 4x3c7f0123456789AB
+D484	DATA8[] 4x3c800123456789AB, 4x3c810123456789AB, 4x3c820123456789AB, 4x3c830123456789AB, 4x3c840123456789AB, 4x3c850123456789AB, 4x3c860123456789AB, 4x3c870123456789AB, 4x3c880123456789AB, 4x3c890123456789AB, 4x3c8a0123456789AB, 4x3c8b0123456789AB, 4x3c8c0123456789AB, 4x3c8d0123456789AB, 4x3c8e0123456789AB, 4x3c8f0123456789AB, 4x3c900123456789AB, 4x3c910123456789AB, 4x3c920123456789AB, 4x3c930123456789AB, 4x3c940123456789AB, 4x3c950123456789AB, 4x3c960123456789AB, 4x3c970123456789AB, 4x3c980123456789AB, 4x3c990123456789AB, 4x3c9a0123456789AB, 4x3c9b0123456789AB, 4x3c9c0123456789AB, 4x3c9d0123456789AB, 4x3c9e0123456789AB, 4x3c9f0123456789AB
+D485	DATA8[] 4x3ca00123456789AB, 4x3ca10123456789AB, 4x3ca20123456789AB, 4x3ca30123456789AB, 4x3ca40123456789AB, 4x3ca50123456789AB, 4x3ca60123456789AB, 4x3ca70123456789AB, 4x3ca80123456789AB, 4x3ca90123456789AB, 4x3caa0123456789AB, 4x3cab0123456789AB, 4x3cac0123456789AB, 4x3cad0123456789AB, 4x3cae0123456789AB, 4x3caf0123456789AB, 4x3cb00123456789AB, 4x3cb10123456789AB, 4x3cb20123456789AB, 4x3cb30123456789AB, 4x3cb40123456789AB, 4x3cb50123456789AB, 4x3cb60123456789AB, 4x3cb70123456789AB, 4x3cb80123456789AB, 4x3cb90123456789AB, 4x3cba0123456789AB, 4x3cbb0123456789AB, 4x3cbc0123456789AB, 4x3cbd0123456789AB, 4x3cbe0123456789AB, 4x3cbf0123456789AB
+D486	DATA8[] 4x3cc00123456789AB, 4x3cc10123456789AB, 4x3cc20123456789AB, 4x3cc30123456789AB, 4x3cc40123456789AB, 4x3cc50123456789AB, 4x3cc60123456789AB, 4x3cc70123456789AB, 4x3cc80123456789AB, 4x3cc90123456789AB, 4x3cca0123456789AB, 4x3ccb0123456789AB, 4x3ccc0123456789AB, 4x3ccd0123456789AB, 4x3cce0123456789AB, 4x3ccf0123456789AB, 4x3cd00123456789AB, 4x3cd10123456789AB, 4x3cd20123456789AB, 4x3cd30123456789AB, 4x3cd40123456789AB, 4x3cd50123456789AB, 4x3cd60123456789AB, 4x3cd70123456789AB, 4x3cd80123456789AB, 4x3cd90123456789AB, 4x3cda0123456789AB, 4x3cdb0123456789AB, 4x3cdc0123456789AB, 4x3cdd0123456789AB, 4x3cde0123456789AB, 4x3cdf0123456789AB
+D487	DATA8[] 4x3ce00123456789AB, 4x3ce10123456789AB, 4x3ce20123456789AB, 4x3ce30123456789AB, 4x3ce40123456789AB, 4x3ce50123456789AB, 4x3ce60123456789AB, 4x3ce70123456789AB, 4x3ce80123456789AB, 4x3ce90123456789AB, 4x3cea0123456789AB, 4x3ceb0123456789AB, 4x3cec0123456789AB, 4x3ced0123456789AB, 4x3cee0123456789AB, 4x3cef0123456789AB, 4x3cf00123456789AB, 4x3cf10123456789AB, 4x3cf20123456789AB, 4x3cf30123456789AB, 4x3cf40123456789AB, 4x3cf50123456789AB, 4x3cf60123456789AB, 4x3cf70123456789AB, 4x3cf80123456789AB, 4x3cf90123456789AB, 4x3cfa0123456789AB, 4x3cfb0123456789AB, 4x3cfc0123456789AB, 4x3cfd0123456789AB, 4x3cfe0123456789AB, 4x3cff0123456789AB
+D488	DATA8[] 4x3d000123456789AB, 4x3d010123456789AB, 4x3d020123456789AB, 4x3d030123456789AB, 4x3d040123456789AB, 4x3d050123456789AB, 4x3d060123456789AB, 4x3d070123456789AB, 4x3d080123456789AB, 4x3d090123456789AB, 4x3d0a0123456789AB, 4x3d0b0123456789AB, 4x3d0c0123456789AB, 4x3d0d0123456789AB, 4x3d0e0123456789AB, 4x3d0f0123456789AB, 4x3d100123456789AB, 4x3d110123456789AB, 4x3d120123456789AB, 4x3d130123456789AB, 4x3d140123456789AB, 4x3d150123456789AB, 4x3d160123456789AB, 4x3d170123456789AB, 4x3d180123456789AB, 4x3d190123456789AB, 4x3d1a0123456789AB, 4x3d1b0123456789AB, 4x3d1c0123456789AB, 4x3d1d0123456789AB, 4x3d1e0123456789AB, 4x3d1f0123456789AB
+D489	DATA8[] 4x3d200123456789AB, 4x3d210123456789AB, 4x3d220123456789AB, 4x3d230123456789AB, 4x3d240123456789AB, 4x3d250123456789AB, 4x3d260123456789AB, 4x3d270123456789AB, 4x3d280123456789AB, 4x3d290123456789AB, 4x3d2a0123456789AB, 4x3d2b0123456789AB, 4x3d2c0123456789AB, 4x3d2d0123456789AB, 4x3d2e0123456789AB, 4x3d2f0123456789AB, 4x3d300123456789AB, 4x3d310123456789AB, 4x3d320123456789AB, 4x3d330123456789AB, 4x3d340123456789AB, 4x3d350123456789AB, 4x3d360123456789AB, 4x3d370123456789AB, 4x3d380123456789AB, 4x3d390123456789AB, 4x3d3a0123456789AB, 4x3d3b0123456789AB, 4x3d3c0123456789AB, 4x3d3d0123456789AB, 4x3d3e0123456789AB, 4x3d3f0123456789AB
+D490	DATA8[] 4x3d400123456789AB, 4x3d410123456789AB, 4x3d420123456789AB, 4x3d430123456789AB, 4x3d440123456789AB, 4x3d450123456789AB, 4x3d460123456789AB, 4x3d470123456789AB, 4x3d480123456789AB, 4x3d490123456789AB, 4x3d4a0123456789AB, 4x3d4b0123456789AB, 4x3d4c0123456789AB, 4x3d4d0123456789AB, 4x3d4e0123456789AB, 4x3d4f0123456789AB, 4x3d500123456789AB, 4x3d510123456789AB, 4x3d520123456789AB, 4x3d530123456789AB, 4x3d540123456789AB, 4x3d550123456789AB, 4x3d560123456789AB, 4x3d570123456789AB, 4x3d580123456789AB, 4x3d590123456789AB, 4x3d5a0123456789AB, 4x3d5b0123456789AB, 4x3d5c0123456789AB, 4x3d5d0123456789AB, 4x3d5e0123456789AB, 4x3d5f0123456789AB
+D491	DATA8[] 4x3d600123456789AB, 4x3d610123456789AB, 4x3d620123456789AB, 4x3d630123456789AB, 4x3d640123456789AB, 4x3d650123456789AB, 4x3d660123456789AB, 4x3d670123456789AB, 4x3d680123456789AB, 4x3d690123456789AB, 4x3d6a0123456789AB, 4x3d6b0123456789AB, 4x3d6c0123456789AB, 4x3d6d0123456789AB, 4x3d6e0123456789AB, 4x3d6f0123456789AB, 4x3d700123456789AB, 4x3d710123456789AB, 4x3d720123456789AB, 4x3d730123456789AB, 4x3d740123456789AB, 4x3d750123456789AB, 4x3d760123456789AB, 4x3d770123456789AB, 4x3d780123456789AB, 4x3d790123456789AB, 4x3d7a0123456789AB, 4x3d7b0123456789AB, 4x3d7c0123456789AB, 4x3d7d0123456789AB, 4x3d7e0123456789AB, 4x3d7f0123456789AB
+D492	DATA8[] 4x3d800123456789AB, 4x3d810123456789AB, 4x3d820123456789AB, 4x3d830123456789AB, 4x3d840123456789AB, 4x3d850123456789AB, 4x3d860123456789AB, 4x3d870123456789AB, 4x3d880123456789AB, 4x3d890123456789AB, 4x3d8a0123456789AB, 4x3d8b0123456789AB, 4x3d8c0123456789AB, 4x3d8d0123456789AB, 4x3d8e0123456789AB, 4x3d8f0123456789AB, 4x3d900123456789AB, 4x3d910123456789AB, 4x3d920123456789AB, 4x3d930123456789AB, 4x3d940123456789AB, 4x3d950123456789AB, 4x3d960123456789AB, 4x3d970123456789AB, 4x3d980123456789AB, 4x3d990123456789AB, 4x3d9a0123456789AB, 4x3d9b0123456789AB, 4x3d9c0123456789AB, 4x3d9d0123456789AB, 4x3d9e0123456789AB, 4x3d9f0123456789AB
+D493	DATA8[] 4x3da00123456789AB, 4x3da10123456789AB, 4x3da20123456789AB, 4x3da30123456789AB, 4x3da40123456789AB, 4x3da50123456789AB, 4x3da60123456789AB, 4x3da70123456789AB, 4x3da80123456789AB, 4x3da90123456789AB, 4x3daa0123456789AB, 4x3dab0123456789AB, 4x3dac0123456789AB, 4x3dad0123456789AB, 4x3dae0123456789AB, 4x3daf0123456789AB, 4x3db00123456789AB, 4x3db10123456789AB, 4x3db20123456789AB, 4x3db30123456789AB, 4x3db40123456789AB, 4x3db50123456789AB, 4x3db60123456789AB, 4x3db70123456789AB, 4x3db80123456789AB, 4x3db90123456789AB, 4x3dba0123456789AB, 4x3dbb0123456789AB, 4x3dbc0123456789AB, 4x3dbd0123456789AB, 4x3dbe0123456789AB, 4x3dbf0123456789AB
+D494	DATA8[] 4x3dc00123456789AB, 4x3dc10123456789AB, 4x3dc20123456789AB, 4x3dc30123456789AB, 4x3dc40123456789AB, 4x3dc50123456789AB, 4x3dc60123456789AB, 4x3dc70123456789AB, 4x3dc80123456789AB, 4x3dc90123456789AB, 4x3dca0123456789AB, 4x3dcb0123456789AB, 4x3dcc0123456789AB, 4x3dcd0123456789AB, 4x3dce0123456789AB, 4x3dcf0123456789AB, 4x3dd00123456789AB, 4x3dd10123456789AB, 4x3dd20123456789AB, 4x3dd30123456789AB, 4x3dd40123456789AB, 4x3dd50123456789AB, 4x3dd60123456789AB, 4x3dd70123456789AB, 4x3dd80123456789AB, 4x3dd90123456789AB, 4x3dda0123456789AB, 4x3ddb0123456789AB, 4x3ddc0123456789AB, 4x3ddd0123456789AB, 4x3dde0123456789AB, 4x3ddf0123456789AB
+D495	DATA8[] 4x3de00123456789AB, 4x3de10123456789AB, 4x3de20123456789AB, 4x3de30123456789AB, 4x3de40123456789AB, 4x3de50123456789AB, 4x3de60123456789AB, 4x3de70123456789AB, 4x3de80123456789AB, 4x3de90123456789AB, 4x3dea0123456789AB, 4x3deb0123456789AB, 4x3dec0123456789AB, 4x3ded0123456789AB, 4x3dee0123456789AB, 4x3def0123456789AB, 4x3df00123456789AB, 4x3df10123456789AB, 4x3df20123456789AB, 4x3df30123456789AB, 4x3df40123456789AB, 4x3df50123456789AB, 4x3df60123456789AB, 4x3df70123456789AB, 4x3df80123456789AB, 4x3df90123456789AB, 4x3dfa0123456789AB, 4x3dfb0123456789AB, 4x3dfc0123456789AB, 4x3dfd0123456789AB, 4x3dfe0123456789AB, 4x3dff0123456789AB
+D496	DATA8[] 4x3e000123456789AB, 4x3e010123456789AB, 4x3e020123456789AB, 4x3e030123456789AB, 4x3e040123456789AB, 4x3e050123456789AB, 4x3e060123456789AB, 4x3e070123456789AB, 4x3e080123456789AB, 4x3e090123456789AB, 4x3e0a0123456789AB, 4x3e0b0123456789AB, 4x3e0c0123456789AB, 4x3e0d0123456789AB, 4x3e0e0123456789AB, 4x3e0f0123456789AB, 4x3e100123456789AB, 4x3e110123456789AB, 4x3e120123456789AB, 4x3e130123456789AB, 4x3e140123456789AB, 4x3e150123456789AB, 4x3e160123456789AB, 4x3e170123456789AB, 4x3e180123456789AB, 4x3e190123456789AB, 4x3e1a0123456789AB, 4x3e1b0123456789AB, 4x3e1c0123456789AB, 4x3e1d0123456789AB, 4x3e1e0123456789AB, 4x3e1f0123456789AB
+D497	DATA8[] 4x3e200123456789AB, 4x3e210123456789AB, 4x3e220123456789AB, 4x3e230123456789AB, 4x3e240123456789AB, 4x3e250123456789AB, 4x3e260123456789AB, 4x3e270123456789AB, 4x3e280123456789AB, 4x3e290123456789AB, 4x3e2a0123456789AB, 4x3e2b0123456789AB, 4x3e2c0123456789AB, 4x3e2d0123456789AB, 4x3e2e0123456789AB, 4x3e2f0123456789AB, 4x3e300123456789AB, 4x3e310123456789AB, 4x3e320123456789AB, 4x3e330123456789AB, 4x3e340123456789AB, 4x3e350123456789AB, 4x3e360123456789AB, 4x3e370123456789AB, 4x3e380123456789AB, 4x3e390123456789AB, 4x3e3a0123456789AB, 4x3e3b0123456789AB, 4x3e3c0123456789AB, 4x3e3d0123456789AB, 4x3e3e0123456789AB, 4x3e3f0123456789AB
+D498	DATA8[] 4x3e400123456789AB, 4x3e410123456789AB, 4x3e420123456789AB, 4x3e430123456789AB, 4x3e440123456789AB, 4x3e450123456789AB, 4x3e460123456789AB, 4x3e470123456789AB, 4x3e480123456789AB, 4x3e490123456789AB, 4x3e4a0123456789AB, 4x3e4b0123456789AB, 4x3e4c0123456789AB, 4x3e4d0123456789AB, 4x3e4e0123456789AB, 4x3e4f0123456789AB, 4x3e500123456789AB, 4x3e510123456789AB, 4x3e520123456789AB, 4x3e530123456789AB, 4x3e540123456789AB, 4x3e550123456789AB, 4x3e560123456789AB, 4x3e570123456789AB, 4x3e580123456789AB, 4x3e590123456789AB, 4x3e5a0123456789AB, 4x3e5b0123456789AB, 4x3e5c0123456789AB, 4x3e5d0123456789AB, 4x3e5e0123456789AB, 4x3e5f0123456789AB
+D499	DATA8[] 4x3e600123456789AB, 4x3e610123456789AB, 4x3e620123456789AB, 4x3e630123456789AB, 4x3e640123456789AB, 4x3e650123456789AB, 4x3e660123456789AB, 4x3e670123456789AB, 4x3e680123456789AB, 4x3e690123456789AB, 4x3e6a0123456789AB, 4x3e6b0123456789AB, 4x3e6c0123456789AB, 4x3e6d0123456789AB, 4x3e6e0123456789AB, 4x3e6f0123456789AB, 4x3e700123456789AB, 4x3e710123456789AB, 4x3e720123456789AB, 4x3e730123456789AB, 4x3e740123456789AB, 4x3e750123456789AB, 4x3e760123456789AB, 4x3e770123456789AB, 4x3e780123456789AB, 4x3e790123456789AB, 4x3e7a0123456789AB, 4x3e7b0123456789AB, 4x3e7c0123456789AB, 4x3e7d0123456789AB, 4x3e7e0123456789AB, 4x3e7f0123456789AB
+	.END
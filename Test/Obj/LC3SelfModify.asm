@@ -0,0 +1,13 @@
+;Patches an instruction of the block it is in, then loops forever
+	.ORIG x3000
+	AND R1, R1, #0
+	AND R3, R3, #0
+	ADD R3, R3, #2
+PATCH	ADD R1, R1, #1
+	LD R2, NEWI
+	ST R2, PATCH
+	ADD R3, R3, #-1
+	BRp PATCH
+DONE	BRnzp DONE
+NEWI	ADD R1, R1, #7
+	.END
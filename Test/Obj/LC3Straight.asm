@@ -0,0 +1,34 @@
+;Benchmark block: one ALU instruction after another and a branch,
+;forever
+	.ORIG x3000
+LOOP	ADD R1, R1, #1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	ADD R2, R2, R1
+	BRnzp LOOP
+	.END
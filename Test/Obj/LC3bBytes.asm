@@ -0,0 +1,20 @@
+;Byte and word loads and stores to the same words
+ORIGIN 4x3000
+SEGMENT
+	lea r7, Data
+	and r1, r1, 0
+	add r2, r1, 15
+Loop:
+	stb r1, r7, 0
+	stb r1, r7, 1
+	ldb r3, r7, 1
+	ldr r4, r7, 0
+	str r4, r7, 1
+	add r1, r1, 7
+	add r2, r2, -1
+	brp Loop
+Done:
+	br Done
+Data:
+	data2 4x1234
+	data2 4x5678
@@ -0,0 +1,18 @@
+;Benchmark loop: an ALU instruction, a load, a store, a call and a
+;branch, forever
+ORIGIN 4x3000
+SEGMENT
+	lea r4, Data
+Loop:
+	add r1, r1, 1
+	ldr r3, r4, 0
+	str r1, r4, 1
+	jsr Sub
+	add r2, r2, -1
+	br Loop
+Sub:
+	add r5, r5, 1
+	ret
+Data:
+	data2 0
+	data2 0
@@ -0,0 +1,83 @@
+;Every LC-3b instruction but TRAP and RTI, with the hazards of the
+;five-stage pipeline, a patched instruction and a jump
+ORIGIN 4x3000
+SEGMENT
+Start:
+	lea r6, Stack
+	lea r5, Data
+	and r0, r0, 0
+	add r1, r0, 12
+Outer:
+	add r2, r1, r1
+	add r3, r2, r1
+	and r4, r3, 4x1F
+	not r4, r4
+	lshf r4, r4, 3
+	rshfa r3, r4, 2
+	rshfl r2, r4, 5
+	str r3, r5, 0
+	ldr r2, r5, 0
+	add r2, r2, 1
+	stb r2, r5, 3
+	ldb r3, r5, 3
+	brz Skip
+	add r0, r0, r3
+Skip:
+	ldr r4, r5, 0
+	brn Neg
+	add r0, r0, 1
+Neg:
+	sti r1, r5, 2
+	ldi r2, r5, 2
+	add r0, r0, r2
+	jsr Sub
+	lea r4, Sub2
+	jsrr r4
+	add r1, r1, -1
+	brp Outer
+	; self-modifying code: overwrite the instruction right behind the store
+	lea r4, Patch
+	ldr r3, r5, 4
+	str r3, r4, 0
+Patch:
+	add r0, r0, 1
+	add r0, r0, 1
+	; jmp through a register
+	lea r4, Done
+	jmp r4
+	add r0, r0, 7
+Done:
+	br Done
+
+Sub:
+	add r6, r6, -2
+	str r7, r6, 0
+	add r0, r0, r1
+	jsr Leaf
+	ldr r7, r6, 0
+	add r6, r6, 2
+	ret
+Leaf:
+	add r0, r0, 2
+	ret
+Sub2:
+	add r0, r0, -1
+	ret
+
+Data:
+	data2 0
+	data2 0
+	data2 Ptr
+	data2 0
+	add r0, r0, 5
+Ptr:
+	data2 0
+	data2 0
+	data2 0
+	data2 0
+	data2 0
+	data2 0
+	data2 0
+	data2 0
+Stack:
+	data2 0
@@ -0,0 +1,48 @@
+;Every LC-3 instruction in a loop, then output, a jump and an RTI in
+;user mode. Runs with the operating system.
+	.ORIG x3000
+	AND R1, R1, #0
+	LD R2, COUNT
+	LEA R4, ARRA
+LOOP	ADD R1, R1, #3
+	AND R6, R1, #5
+	NOT R5, R1
+	ADD R5, R5, R1
+	AND R3, R5, R2
+	LDR R3, R4, #0
+	ADD R3, R3, R1
+	STR R3, R4, #1
+	STI R1, PTR
+	LDI R0, PTR
+	ST R0, ARRA
+	LD R0, ARRA
+	JSR SUB
+	LEA R3, SUB2
+	JSRR R3
+	ADD R2, R2, #-1
+	BRzp LOOP
+	LEA R0, MSG
+	PUTS
+	LD R0, CH
+	OUT
+	LEA R3, CONT
+	JMP R3
+	HALT
+CONT	RTI
+	HALT
+SUB	ADD R5, R5, #1
+	RET
+SUB2	BRn SUB2X
+	ADD R6, R6, #-1
+SUB2X	RET
+COUNT	.FILL #1000
+PTR	.FILL ARRB
+CH	.FILL x41
+ARRA	.FILL 0
+	.FILL 0
+	.FILL 0
+	.FILL 0
+ARRB	.FILL 0
+	.FILL 0
+MSG	.STRINGZ "hi"
+	.END
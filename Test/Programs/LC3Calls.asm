@@ -0,0 +1,36 @@
+;Calls through a jump table, and recursion on the stack
+	.ORIG x3000
+	LD R5, COUNT
+	LEA R4, TABLE
+LOOP:	AND R3, R5, #3
+	ADD R3, R3, R4
+	LDR R0, R3, #0
+	JSRR R0
+	LD R1, DEPTH
+	JSR REC
+	ADD R5, R5, #-1
+	BRp LOOP
+	LEA R0, DONE
+	JMP R0
+COUNT:	.FILL #40
+DEPTH:	.FILL #12
+TABLE:	.FILL FA
+	.FILL FB
+	.FILL FA
+	.FILL FC
+FA:	ADD R2, R2, #1
+	RET
+FB:	ADD R2, R2, #2
+	RET
+FC:	ADD R2, R2, #3
+	RET
+REC:	ADD R6, R6, #-1
+	STR R7, R6, #0
+	ADD R1, R1, #-1
+	BRz RECEND
+	JSR REC
+RECEND:	LDR R7, R6, #0
+	ADD R6, R6, #1
+	RET
+DONE:	HALT
+	.END
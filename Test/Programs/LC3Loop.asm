@@ -0,0 +1,15 @@
+;Benchmark loop: an ALU instruction, a load, a store, a call and a
+;branch, forever
+	.ORIG x3000
+	LEA R4, DATA
+LOOP	ADD R1, R1, #1
+	LDR R3, R4, #0
+	STR R1, R4, #1
+	JSR SUB
+	ADD R2, R2, #-1
+	BRnzp LOOP
+SUB	ADD R5, R5, #1
+	RET
+DATA	.FILL #0
+	.FILL #0
+	.END
@@ -0,0 +1,13 @@
+;Loads and stores to the same words, forever
+	.ORIG x3000
+	LEA R4, DATA
+LOOP	ADD R1, R1, #1
+	LDR R3, R4, #0
+	STR R1, R4, #1
+	LDR R5, R4, #1
+	STR R3, R4, #2
+	BRnzp LOOP
+DATA	.FILL #0
+	.FILL #0
+	.FILL #0
+	.END
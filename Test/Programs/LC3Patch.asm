@@ -0,0 +1,12 @@
+;Patches the instruction right behind the store that writes it
+	.ORIG x3000
+	AND R1, R1, #0
+	LD R2, NEWI
+	ST R2, PATCH
+PATCH	ADD R1, R1, #1
+	LEA R0, MSG
+	PUTS
+	HALT
+NEWI	ADD R1, R1, #7
+MSG	.STRINGZ "hello"
+	.END
@@ -0,0 +1,20 @@
+;Output traps and a call. Runs with the operating system.
+ORIGIN 4x3000
+SEGMENT
+	LEA R0, Msg
+	TRAP 4x22
+	AND R1, R1, 0
+	ADD R1, R1, 5
+Loop:	LEA R2, Chars
+	ADD R2, R2, R1
+	LDB R0, R2, 0
+	TRAP 4x21
+	ADD R1, R1, -1
+	BRp Loop
+	JSR Sub
+	TRAP 4x24
+Sub:	ADD R3, R3, 7
+	RET
+Msg:	DATA1[] "hello\n\0"
+ALIGN 2
+Chars:	DATA1[] "abcdefg"
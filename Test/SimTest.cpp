@@ -0,0 +1,215 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#include "SimTest.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <ctime>
+#include <algorithm>
+#include "../LC3Assembler/AsmUI.h"
+
+using namespace std;
+using namespace JMT;
+using namespace Assembler;
+using namespace Simulator;
+
+//The LC-3b assembler's AsmUI.h has the same include guard as the LC-3's
+namespace LC3b
+{
+	bool AssemblerUI(vector<Program *> &, RamImage &);
+}
+
+namespace SimTest
+{
+
+const char *const sTestProgramDir = "Test/Programs/";
+const char *const sTestOSDir = "AshOS/";
+const char *const sTestScratchDir = "Test/Obj/";
+
+TestConsole *pCurrentConsole = NULL;
+
+TestProgram::~TestProgram()
+{
+	for(unsigned int i = 0; i < Programs.size(); i++)
+		delete Programs[i];
+}
+
+/******************************************************************************\
+	CopyTestFile( [in] source file, [in] destination file )
+
+	Returns false if either file can't be opened.
+\******************************************************************************/
+static bool CopyTestFile(const string &sFrom, const string &sTo)
+{
+	ifstream FromFile(sFrom.c_str(), ios::in | ios::binary);
+	if(!FromFile.good())
+	{
+		cerr << "Error:   Unable to open file " << sFrom << endl;
+		return false;
+	}
+	ofstream ToFile(sTo.c_str(), ios::out | ios::binary | ios::trunc);
+	ToFile << FromFile.rdbuf();
+	if(!ToFile.good())
+	{
+		cerr << "Error:   Unable to create file " << sTo << endl;
+		return false;
+	}
+	return true;
+}
+
+bool AssembleTest(TestProgram &TheProgram, const string &sName, LanguageEnum Language, bool fUseOS, const string &sSource)
+{
+	TheProgram.sName = sName;
+	TheProgram.Language = Language;
+	TheProgram.fUseOS = fUseOS;
+
+	TheContext.InputList.clear();
+	if(fUseOS)
+	{
+		//The operating system includes its header from its own directory
+		string sOS = (Language == LangLC3 ? "AshOS_LC3" : "AshOS_LC3b");
+		if(!CopyTestFile(string(sTestOSDir) + sOS + ".asm", string(sTestScratchDir) + sOS + ".asm") || !CopyTestFile(string(sTestOSDir) + sOS + ".ah", string(sTestScratchDir) + sOS + ".ah"))
+			return false;
+		TheContext.InputList.push_back(CreateStandardPath(string(sTestScratchDir) + sOS + ".asm"));
+	}
+	if(sSource.empty())
+	{
+		if(!CopyTestFile(string(sTestProgramDir) + sName, string(sTestScratchDir) + sName))
+			return false;
+	}
+	else
+	{
+		ofstream ToFile((string(sTestScratchDir) + sName).c_str(), ios::out | ios::trunc);
+		ToFile << sSource;
+		if(!ToFile.good())
+		{
+			cerr << "Error:   Unable to create file " << sTestScratchDir << sName << endl;
+			return false;
+		}
+	}
+	TheContext.InputList.push_back(CreateStandardPath(string(sTestScratchDir) + sName));
+	TheContext.Flags.fOldLC3 = (Language == LangLC3);
+	TheContext.Flags.fUseOS = fUseOS;
+	TheContext.Flags.fSimulate = true;
+
+	ostringstream strMessages;
+	streambuf *pCoutBuffer = cout.rdbuf(strMessages.rdbuf());
+	bool fAssembled;
+	if(Language == LangLC3)
+		fAssembled = LC3::AssemblerUI(TheProgram.Programs, TheProgram.Image);
+	else
+		fAssembled = LC3b::AssemblerUI(TheProgram.Programs, TheProgram.Image);
+	cout.rdbuf(pCoutBuffer);
+	if(!fAssembled)
+		cerr << strMessages.str() << "Error:   Unable to assemble " << sName << endl;
+	return fAssembled;
+}
+
+bool TestCallBack(MessageEnum MessageType, const string &sMessage)
+{
+	if(pCurrentConsole && (MessageType == Error || MessageType == Fatal || MessageType == JMT::Exception))
+		pCurrentConsole->sMessage = sMessage;
+	return true;
+}
+
+bool TestMessageCallBack(MessageEnum MessageType, const string &sMessage, const LocationVector &)
+{
+	return TestCallBack(MessageType, sMessage);
+}
+
+bool TestCommand(string &)
+{
+	//Tests are run without the command prompt
+	return false;
+}
+
+bool TestReadConsole(string &sBuffer, unsigned int CharsToRead, unsigned int &CharsRead)
+{
+	TestConsole &TheConsole = *pCurrentConsole;
+	sBuffer = TheConsole.sInput.substr(MIN(TheConsole.InputPosition, TheConsole.sInput.size()), CharsToRead);
+	CharsRead = sBuffer.size();
+	TheConsole.InputPosition += CharsRead;
+	//Running out of input is the same as end of input on the console
+	return CharsRead == CharsToRead;
+}
+
+bool TestWriteConsole(const string &sBuffer, unsigned int CharsToWrite, unsigned int &CharsWritten)
+{
+	CharsWritten = MIN(CharsToWrite, sBuffer.size());
+	pCurrentConsole->sOutput.append(sBuffer, 0, CharsWritten);
+	return true;
+}
+
+void CaptureState(const Architecture &TheArch, uint64 Cycle, uint64 Instruction, const TestConsole &TheConsole, const vector<string> &Excluded, TestState &State)
+{
+	State.Cycle = Cycle;
+	State.Instruction = Instruction;
+	State.Registers.clear();
+	for(map<string, RegisterSet>::const_iterator SetIter = TheArch.RegisterSets.begin(); SetIter != TheArch.RegisterSets.end(); SetIter++)
+	{
+		if(find(Excluded.begin(), Excluded.end(), SetIter->first) != Excluded.end())
+			continue;
+		for(RegisterSet::RegisterMap::const_iterator RegIter = SetIter->second.Registers.begin(); RegIter != SetIter->second.Registers.end(); RegIter++)
+		{
+			string sName = SetIter->first + "." + RegIter->first;
+			if(find(Excluded.begin(), Excluded.end(), sName) == Excluded.end())
+				State.Registers.push_back(pair<string, uint64>(sName, RegIter->second.Value));
+		}
+	}
+	State.Bytes.clear();
+	for(map<string, Memory>::const_iterator MemIter = TheArch.Memories.begin(); MemIter != TheArch.Memories.end(); MemIter++)
+	{
+		const SparseArray<uint64, MemoryLocation> &Array = MemIter->second.Array;
+		for(uint64 i = Array.Begin(); i <= Array.End(); i++)
+			State.Bytes.push_back(Array[i].Value);
+	}
+	State.sOutput = TheConsole.sOutput;
+}
+
+string CompareStates(const TestState &Expected, const TestState &State, bool fCycles)
+{
+	char sBuffer[128];
+	if(fCycles && Expected.Cycle != State.Cycle)
+	{
+		sprintf(sBuffer, "cycle %u, expected %u", (unsigned int)State.Cycle, (unsigned int)Expected.Cycle);
+		return sBuffer;
+	}
+	if(Expected.Instruction != State.Instruction)
+	{
+		sprintf(sBuffer, "instruction %u, expected %u", (unsigned int)State.Instruction, (unsigned int)Expected.Instruction);
+		return sBuffer;
+	}
+	if(Expected.Registers.size() != State.Registers.size())
+		return "different registers";
+	for(size_t i = 0; i < Expected.Registers.size(); i++)
+	{
+		if(Expected.Registers[i] != State.Registers[i])
+		{
+			sprintf(sBuffer, "%.31s = 0x%X, expected 0x%X", State.Registers[i].first.c_str(), (unsigned int)State.Registers[i].second, (unsigned int)Expected.Registers[i].second);
+			return sBuffer;
+		}
+	}
+	if(Expected.Bytes.size() != State.Bytes.size())
+		return "different memories";
+	for(size_t i = 0; i < Expected.Bytes.size(); i++)
+	{
+		if(Expected.Bytes[i] != State.Bytes[i])
+		{
+			sprintf(sBuffer, "memory byte 0x%X = 0x%02X, expected 0x%02X", (unsigned int)i, State.Bytes[i], Expected.Bytes[i]);
+			return sBuffer;
+		}
+	}
+	if(Expected.sOutput != State.sOutput)
+		return "console output \"" + State.sOutput + "\", expected \"" + Expected.sOutput + "\"";
+	return "";
+}
+
+double CPUSeconds()
+{
+	return (double)clock() / CLOCKS_PER_SEC;
+}
+
+}	//namespace SimTest
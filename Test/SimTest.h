@@ -0,0 +1,202 @@
+//	Copyright 2003 Ashley Wise
+//	University Of Illinois Urbana-Champaign
+//	awise@crhc.uiuc.edu
+
+#ifndef SIMTEST_H
+#define SIMTEST_H
+
+#pragma warning (disable:4786)
+#include <string>
+#include <vector>
+#include "../Assembler/Base.h"
+#include "../Assembler/Program.h"
+#include "../Assembler/RamImage.h"
+#include "../Simulator/Simulator.h"
+
+using namespace std;
+using namespace JMT;
+using namespace Assembler;
+using namespace Simulator;
+
+namespace SimTest
+{
+	//Where the test programs and the operating systems are kept, and the
+	//scratch directory they are assembled in, relative to the top of the tree
+	extern const char *const sTestProgramDir;
+	extern const char *const sTestOSDir;
+	extern const char *const sTestScratchDir;
+
+	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
+		TestProgram
+
+		An assembled program, ready to be loaded into any number of
+		simulators of its language. The simulators keep pointers to the
+		programs, so it has to outlive them.
+	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
+	class TestProgram
+	{
+	public:
+		//File name of the program in sTestProgramDir
+		string sName;
+		LanguageEnum Language;
+		//true if assembled with the operating system
+		bool fUseOS;
+		vector<Program *> Programs;
+		RamImage Image;
+
+		TestProgram() : Language(LangNone), fUseOS(false) {}
+		~TestProgram();
+
+	private:
+		//The programs are owned, so it can't be copied
+		TestProgram(const TestProgram &);
+		TestProgram &operator=(const TestProgram &);
+	};
+
+	/**************************************************************************\
+		AssembleTest( [out] the program, [in] file name, [in] language,
+			[in] true to assemble with the operating system, [in] source
+			of a generated program )
+
+		Copies the program (and the operating system) from the test program
+		directories into the scratch directory and assembles it there, since
+		the LC-3 assembler writes the converted source next to its input.
+		If the source is given, it is written to the scratch directory
+		under the file name instead. The assembler's messages are only
+		printed if it fails.
+
+		Returns true if it assembled.
+	\******/
+	bool AssembleTest(TestProgram &, const string &, LanguageEnum, bool, const string & = "");
+
+	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
+		TestConsole
+
+		The console of one simulator: the characters it may read and those
+		it has written. The callbacks use the console of the simulator
+		which is running.
+	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
+	struct TestConsole
+	{
+		string sInput;
+		size_t InputPosition;
+		string sOutput;
+		//The last error or exception message
+		string sMessage;
+
+		TestConsole() : InputPosition(0) {}
+	};
+	extern TestConsole *pCurrentConsole;
+
+	bool TestCallBack(MessageEnum, const string &);
+	bool TestMessageCallBack(MessageEnum, const string &, const LocationVector &);
+	bool TestCommand(string &);
+	bool TestReadConsole(string &, unsigned int, unsigned int &);
+	bool TestWriteConsole(const string &, unsigned int, unsigned int &);
+
+	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
+		TestState
+
+		The architectural state of a simulator at one point of a run, which
+		every engine has to agree on.
+	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
+	struct TestState
+	{
+		uint64 Cycle, Instruction;
+		//"set.register" and the value of each register compared
+		vector< pair<string, uint64> > Registers;
+		//Contents of each memory, in name order
+		vector<unsigned char> Bytes;
+		string sOutput;
+	};
+
+	/**************************************************************************\
+		CompareStates( [in] expected state, [in] state, [in] true to also
+			compare the cycle count )
+
+		Returns a description of the first difference, or an empty string if
+		there is none.
+	\******/
+	string CompareStates(const TestState &, const TestState &, bool fCycles = true);
+
+	/**************************************************************************\
+		CaptureState( [in] architecture, [in] simulator cycles, [in] simulator
+			instructions, [in] console, [in] register sets or "set.register"
+			names to leave out, [out] state )
+	\******/
+	void CaptureState(const Architecture &, uint64, uint64, const TestConsole &, const vector<string> &, TestState &);
+
+	//CPU seconds used by the process so far
+	double CPUSeconds();
+
+	/*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*\
+		TestSim
+
+		A simulator, its architecture and its console. Runs are made with
+		no command prompt and print nothing.
+	\*_,-=~~""``^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^``""~~==-,_*/
+	template<class ISA, class ArchType>
+	class TestSim
+	{
+	public:
+		ArchSim<ISA> Sim;
+		ArchType Arch;
+		TestConsole Console;
+		//true if the loaded program runs on the operating system
+		bool fUseOS;
+
+		TestSim() : Sim(TestMessageCallBack, TestCallBack, TestCommand, TestReadConsole, TestWriteConsole), Arch(Sim), fUseOS(false)
+		{
+		}
+
+		/**********************************************************************\
+			Load( [in] program, [in] engine name )
+
+			Selects the engine and loads the program. Returns false if the
+			architecture has no such engine or the simulator fails to reset.
+		\******/
+		bool Load(TestProgram &TheProgram, const string &sEngine)
+		{
+			for(Arch.Engine = 0; Arch.Engine < Arch.Engines.size(); Arch.Engine++)
+				if(Arch.Engines[Arch.Engine] == sEngine)
+					break;
+			if(Arch.Engine == Arch.Engines.size())
+			{
+				Arch.Engine = 0;
+				return false;
+			}
+			fUseOS = TheProgram.fUseOS;
+			TheContext.Flags.fUseOS = fUseOS;
+			Console = TestConsole();
+			return Sim.Reset(Arch, TheProgram.Programs, TheProgram.Image);
+		}
+
+		/**********************************************************************\
+			Run( [in] maximum number of cycles )
+
+			Runs until the cycles are used up or the simulator breaks.
+		\******/
+		bool Run(uint64 Cycles)
+		{
+			pCurrentConsole = &Console;
+			TheContext.Flags.fUseOS = fUseOS;
+			Sim.fBreak = false;
+			bool fRetVal = Sim.RunBatch(Cycles);
+			pCurrentConsole = NULL;
+			return fRetVal;
+		}
+
+		//true once the program has stopped the clock
+		bool Halted()
+		{
+			return !Arch.RegisterSets.find("mmio")->second["mcr"][15];
+		}
+
+		void Capture(const vector<string> &Excluded, TestState &State) const
+		{
+			CaptureState(Arch, Sim.SimCycle, Sim.SimInstruction, Console, Excluded, State);
+		}
+	};
+}
+
+#endif